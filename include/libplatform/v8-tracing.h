@@ -25,6 +25,7 @@ namespace v8 {
 
 namespace base {
 class Mutex;
+class SharedMutex;
 }  // namespace base
 
 namespace platform {
@@ -316,6 +317,10 @@ class V8_PLATFORM_EXPORT TracingController
   std::unique_ptr<perfetto::TracingSession> tracing_session_;
 #else   // !defined(V8_USE_PERFETTO)
   std::unique_ptr<TraceBuffer> trace_buffer_;
+  // Held shared while an event in |trace_buffer_| is written and exclusively
+  // while the buffer is flushed, so that threads only contend on the buffer
+  // itself when adding events.
+  std::unique_ptr<base::SharedMutex> trace_buffer_mutex_;
 #endif  // !defined(V8_USE_PERFETTO)
 
   // Disallow copy and assign
@@ -122,6 +122,9 @@
  *  - bool
  *  - int32_t
  *  - uint32_t
+ *  - const FastApiTypedArray<uint8_t>&, for a Uint8Array
+ *  - const FastApiTypedArray<double>&, for a Float64Array
+ *  - const FastOneByteString&, for a sequential one-byte string
  * To be supported types:
  *  - int64_t
  *  - uint64_t
@@ -129,6 +132,13 @@
  *  - float64_t
  *  - arrays of C types
  *  - arrays of embedder types
+ *
+ * If an argument passed from JavaScript does not match the expected typed
+ * array or string type, e.g. because the typed array is detached or the
+ * string is not flat, the optimized code calls the slow callback instead.
+ * The fast callback may also ask for the slow callback to be called by
+ * setting the trailing fallback argument, which is available to functions
+ * created with CFunction::MakeWithErrorSupport.
  */
 
 #ifndef INCLUDE_V8_FAST_API_CALLS_H_
@@ -153,11 +163,14 @@ class CTypeInfo {
     kFloat32,
     kFloat64,
     kV8Value,
+    kUint8,          // Only used as the element type of typed arrays.
+    kOneByteString,  // A FastOneByteString.
   };
 
   enum class ArgFlags : uint8_t {
     kNone = 0,
-    kIsArrayBit = 1 << 0,  // This argument is first in an array of values.
+    kIsArrayBit = 1 << 0,       // This argument is first in an array of values.
+    kIsTypedArrayBit = 1 << 1,  // This argument is a FastApiTypedArray.
   };
 
   static CTypeInfo FromWrapperType(ArgFlags flags = ArgFlags::kNone) {
@@ -187,6 +200,10 @@ class CTypeInfo {
     return payload_ & static_cast<int>(ArgFlags::kIsArrayBit);
   }
 
+  constexpr bool IsTypedArray() const {
+    return payload_ & static_cast<int>(ArgFlags::kIsTypedArrayBit);
+  }
+
   static const CTypeInfo& Invalid() {
     static CTypeInfo invalid = CTypeInfo(0);
     return invalid;
@@ -196,11 +213,11 @@ class CTypeInfo {
   explicit constexpr CTypeInfo(uintptr_t payload) : payload_(payload) {}
 
   // That must be the last bit after ArgFlags.
-  static constexpr uintptr_t kIsWrapperTypeBit = 1 << 1;
+  static constexpr uintptr_t kIsWrapperTypeBit = 1 << 2;
   static constexpr uintptr_t kWrapperTypeInfoMask = static_cast<uintptr_t>(~0)
-                                                    << 2;
+                                                    << 3;
 
-  static constexpr unsigned int kTypeOffset = kIsWrapperTypeBit;
+  static constexpr unsigned int kTypeOffset = 3;
   static constexpr unsigned int kTypeSize = 8 - kTypeOffset;
   static constexpr uintptr_t kTypeMask =
       (~(static_cast<uintptr_t>(~0) << kTypeSize)) << kTypeOffset;
@@ -219,6 +236,27 @@ struct ApiObject {
   uintptr_t address;
 };
 
+/**
+ * The contents of a typed array passed to a fast API function. The data
+ * may live on the V8 heap, so it is only valid for the duration of the
+ * call and must not be retained.
+ */
+template <typename T>
+struct FastApiTypedArray {
+  T* data;
+  size_t length;
+};
+
+/**
+ * The characters of a sequential one-byte string passed to a fast API
+ * function. The characters are not null-terminated, live on the V8 heap and
+ * are only valid for the duration of the call.
+ */
+struct FastOneByteString {
+  const char* data;
+  uint32_t length;
+};
+
 namespace internal {
 
 template <typename T>
@@ -249,6 +287,28 @@ struct GetCType {
 
 SUPPORTED_C_TYPES(SPECIALIZE_GET_C_TYPE_FOR)
 
+#define SPECIALIZE_GET_C_TYPE_FOR_TYPED_ARRAY(ctype, ctypeinfo)           \
+  template <>                                                             \
+  struct GetCType<const FastApiTypedArray<ctype>&> {                      \
+    static constexpr CTypeInfo Get() {                                    \
+      return CTypeInfo::FromCType(CTypeInfo::Type::ctypeinfo,             \
+                                  CTypeInfo::ArgFlags::kIsTypedArrayBit); \
+    }                                                                     \
+  };
+
+#define SUPPORTED_TYPED_ARRAY_ELEMENT_TYPES(V) \
+  V(uint8_t, kUint8)                           \
+  V(double, kFloat64)
+
+SUPPORTED_TYPED_ARRAY_ELEMENT_TYPES(SPECIALIZE_GET_C_TYPE_FOR_TYPED_ARRAY)
+
+template <>
+struct GetCType<const FastOneByteString&> {
+  static constexpr CTypeInfo Get() {
+    return CTypeInfo::FromCType(CTypeInfo::Type::kOneByteString);
+  }
+};
+
 // T* where T is a primitive (array of primitives).
 template <typename T, typename = void>
 struct GetCTypePointerImpl {
@@ -41,6 +41,10 @@ struct WasmModuleInstantiated {
 struct WasmModuleTieredUp {
   bool lazy = false;
   size_t code_size_in_bytes = 0;
+  // Code space currently committed for the module, and the size of code that
+  // was freed again (e.g. baseline code replaced by top-tier code).
+  size_t committed_code_size_in_bytes = 0;
+  size_t freed_code_size_in_bytes = 0;
   int64_t wall_clock_time_in_us = 0;
 };
 
@@ -48,13 +52,93 @@ struct WasmModulesPerIsolate {
   size_t count = 0;
 };
 
+/**
+ * Reported after a garbage collection that exceeded the budget set with
+ * v8::Isolate::SetGCPauseBudget(), either because its pause was longer than
+ * the maximum pause or, for full garbage collections, because the mutator
+ * utilization dropped below the target.
+ */
+struct GarbageCollectionBudgetExceeded {
+  bool is_full = false;
+  int64_t pause_in_us = 0;
+  int64_t max_pause_in_us = 0;
+  double mutator_utilization = 0.0;
+  double mutator_utilization_target = 0.0;
+};
+
+/**
+ * Reported when a background thread starts executing a concurrent optimizing
+ * compilation job, with the time the job waited in the queue and the number of
+ * jobs still waiting.
+ */
+struct OptimizedCompilationJobStarted {
+  int64_t queue_time_in_us = 0;
+  size_t queue_length = 0;
+};
+
+/**
+ * Reported after a function was compiled to bytecode on its first call.
+ */
+struct JavaScriptFunctionCompiled {
+  bool success = false;
+  size_t bytecode_size_in_bytes = 0;
+  int64_t wall_clock_time_in_us = 0;
+};
+
+/**
+ * Reported after an optimizing compilation job was finalized on the main
+ * thread. The queue time is the time the job spent waiting between its phases,
+ * e.g. for a background thread to pick it up or for the main thread to
+ * install the code.
+ */
+struct OptimizedCompilationJobFinished {
+  bool concurrent = false;
+  bool osr = false;
+  int64_t prepare_time_in_us = 0;
+  int64_t execute_time_in_us = 0;
+  int64_t finalize_time_in_us = 0;
+  int64_t queue_time_in_us = 0;
+};
+
+/**
+ * Reported after optimized code was deoptimized. The deoptimization was eager
+ * unless it was lazy or soft.
+ */
+struct Deoptimization {
+  bool lazy = false;
+  bool soft = false;
+};
+
+/**
+ * Reported after every garbage collection, with the durations of its main
+ * phases. For full garbage collections the mark time includes incremental
+ * marking; for young generation garbage collections the evacuation time is the
+ * time spent scavenging.
+ */
+struct GarbageCollectionCycle {
+  bool is_full = false;
+  int64_t pause_in_us = 0;
+  int64_t mark_time_in_us = 0;
+  int64_t sweep_time_in_us = 0;
+  int64_t evacuate_time_in_us = 0;
+  size_t heap_size_before_in_bytes = 0;
+  size_t heap_size_after_in_bytes = 0;
+};
+
 #define V8_MAIN_THREAD_METRICS_EVENTS(V) \
   V(WasmModuleDecoded)                   \
   V(WasmModuleCompiled)                  \
   V(WasmModuleInstantiated)              \
-  V(WasmModuleTieredUp)
+  V(WasmModuleTieredUp)                  \
+  V(JavaScriptFunctionCompiled)          \
+  V(OptimizedCompilationJobFinished)     \
+  V(Deoptimization)
 
-#define V8_THREAD_SAFE_METRICS_EVENTS(V) V(WasmModulesPerIsolate)
+#define V8_THREAD_SAFE_METRICS_EVENTS(V) \
+  V(WasmModulesPerIsolate)               \
+  V(GarbageCollectionBudgetExceeded)     \
+  V(OptimizedCompilationJobStarted)      \
+  V(GarbageCollectionCycle)
 
 /**
  * This class serves as a base class for recording event-based metrics in V8.
@@ -78,6 +162,10 @@ struct WasmModulesPerIsolate {
  * a valid context using Recorder::GetContext() at the time the metric is
  * recorded. In this case, an empty handle will be returned.
  *
+ * Compilation and deoptimization events are frequent, so V8 always delays
+ * them and delivers them in batches from a foreground task rather than from
+ * the code path that triggered them.
+ *
  * The embedder is expected to call v8::Isolate::SetMetricsRecorder()
  * providing its implementation and have the virtual methods overwritten
  * for the events it cares about.
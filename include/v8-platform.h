@@ -202,6 +202,13 @@ class JobHandle {
    */
   virtual void Cancel() = 0;
 
+  /**
+   * Forces all existing workers to yield ASAP but doesn't wait for them.
+   * Warning, this is dangerous if the Job's callback is bound to or has access
+   * to state which may be deleted after this call.
+   */
+  virtual void CancelAndDetach() { Cancel(); }
+
   /**
    * Returns true if associated with a Job and other methods may be called.
    * Returns false after Join() or Cancel() was called.
@@ -392,6 +399,33 @@ class PageAllocator {
    */
   virtual bool DiscardSystemPages(void* address, size_t size) { return true; }
 
+  /**
+   * Requests that physical memory for the given [address, address + size)
+   * range is preferably allocated on the given NUMA node. address and size
+   * should be operating system page-aligned. Pages that are already backed by
+   * physical memory are not migrated. Returns false if NUMA binding is not
+   * supported.
+   */
+  virtual bool BindToNumaNode(void* address, size_t size, int node) {
+    return false;
+  }
+
+  /**
+   * Marks the given [address, address + size) range as a candidate for
+   * merging with identical pages of other processes, e.g. by the kernel's
+   * same-page merging. address and size should be operating system
+   * page-aligned. Returns false if page merging is not supported.
+   */
+  virtual bool MarkMergeable(void* address, size_t size) { return false; }
+
+  /**
+   * Asks for the given [address, address + size) range to be backed by huge
+   * pages where possible, e.g. transparent huge pages on Linux. address and
+   * size should be operating system page-aligned. Returns false if huge pages
+   * are not supported.
+   */
+  virtual bool AdviseHugePages(void* address, size_t size) { return false; }
+
   /**
    * INTERNAL ONLY: This interface has not been stabilised and may change
    * without notice from one release to another without being deprecated first.
@@ -367,6 +367,16 @@ class V8_EXPORT CpuProfiler {
    */
   CpuProfile* StopProfiling(Local<String> title);
 
+  /**
+   * Finishes the CPU profile with a given title and returns it, like
+   * StopProfiling, but keeps collecting samples into a new profile with the
+   * same title and options. Meant for continuous profiling: deleting each
+   * returned profile after exporting it keeps the memory used by the
+   * profiler bounded. If the title given is empty, restarts the last profile
+   * started. Returns nullptr if there is no such profile.
+   */
+  CpuProfile* RestartProfiling(Local<String> title);
+
   /**
    * Generate more detailed source positions to code objects. This results in
    * better results when mapping profiling samples to script source.
@@ -847,6 +857,18 @@ class V8_EXPORT HeapProfiler {
       ObjectNameResolver* global_object_name_resolver = nullptr,
       bool treat_global_objects_as_roots = true);
 
+  /**
+   * Takes a heap snapshot and serializes it to |stream| in JSON format,
+   * without retaining it in the profiler. Nodes and edges are released as
+   * soon as they have been written, so the peak memory use is lower than
+   * with TakeHeapSnapshot() followed by HeapSnapshot::Serialize(). Returns
+   * false if taking the snapshot was aborted through |control|.
+   */
+  bool TakeHeapSnapshotToStream(
+      OutputStream* stream, ActivityControl* control = nullptr,
+      ObjectNameResolver* global_object_name_resolver = nullptr,
+      bool treat_global_objects_as_roots = true);
+
   /**
    * Starts tracking of heap objects population statistics. After calling
    * this method, all heap objects relocations done by the garbage collector
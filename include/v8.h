@@ -64,6 +64,7 @@ class Number;
 class NumberObject;
 class Object;
 class ObjectOperationDescriptor;
+class OutputStream;
 class ObjectTemplate;
 class Platform;
 class Primitive;
@@ -1686,6 +1687,8 @@ class V8_EXPORT ScriptCompiler {
     // data and guarantees that it stays alive until the CachedData object is
     // destroyed. If the policy is BufferOwned, the given data will be deleted
     // (with delete[]) when the CachedData object is destroyed.
+    // Data that is pointer-aligned, e.g. a read-only mapping of a file
+    // holding a code cache, is deserialized in place without being copied.
     CachedData(const uint8_t* data, int length,
                BufferPolicy buffer_policy = BufferNotOwned);
     ~CachedData();
@@ -1864,6 +1867,18 @@ class V8_EXPORT ScriptCompiler {
     kNoCacheBecauseDeferredProduceCodeCache
   };
 
+  /**
+   * Controls how CreateCodeCacheAfterExecution treats functions of the script
+   * whose compilation was started on a background thread but has not been
+   * installed yet.
+   */
+  enum PendingCompilePolicy {
+    // Finish all such compilations, blocking on the ones still in progress.
+    kIncludePendingCompiles = 0,
+    // Only include the compilations that have already finished.
+    kSkipPendingCompiles
+  };
+
   /**
    * Compiles the specified script (context-independent).
    * Cached data as part of the source object can be optionally produced to be
@@ -1981,6 +1996,20 @@ class V8_EXPORT ScriptCompiler {
    */
   static CachedData* CreateCodeCache(Local<UnboundScript> unbound_script);
 
+  /**
+   * Creates and returns code cache for the specified unbound_script after it
+   * has been run for a warm-up period. In addition to the top-level code, the
+   * cache contains every function of the script that was lazily compiled
+   * while it ran, so that consuming the cache avoids compiling them again.
+   * Functions whose compilation was posted to a background thread are
+   * included as well, according to |policy|.
+   * This will return nullptr if the script cannot be serialized. The
+   * CachedData returned by this function should be owned by the caller.
+   */
+  static CachedData* CreateCodeCacheAfterExecution(
+      Local<UnboundScript> unbound_script,
+      PendingCompilePolicy policy = kIncludePendingCompiles);
+
   /**
    * Creates and returns code cache for the specified unbound_module_script.
    * This will return nullptr if the script cannot be serialized. The
@@ -2300,6 +2329,69 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Like Stringify, but writes the result encoded as UTF-8 to |stream|, in
+   * chunks of the stream's preferred size. This avoids transcoding the
+   * result with String::WriteUtf8 into one more buffer.
+   *
+   * \return False if the stream aborted the writing.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToUtf8(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
+
+  /**
+   * Parses JSON text that arrives in chunks of UTF-8 encoded bytes, e.g. from
+   * the network. Chunks may be split anywhere, even inside a character.
+   *
+   * If the text is an array, each of its elements is parsed as soon as its
+   * text is complete, so only the text of one element is buffered at a time.
+   * Other values are buffered and parsed by Finish.
+   *
+   * After Feed or Finish failed, the parser must not be used anymore.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    class V8_EXPORT Client {
+     public:
+      virtual ~Client() = default;
+
+      /**
+       * Called with each element of a top-level array, in order. Returning
+       * Nothing (with an exception pending) aborts parsing.
+       */
+      virtual Maybe<bool> OnArrayElement(Local<Context> context,
+                                         Local<Value> element) = 0;
+    };
+
+    /**
+     * If |client| is null, the elements of a top-level array are collected
+     * and Finish returns the array. Otherwise they are passed to the client
+     * and Finish returns undefined for an array.
+     */
+    explicit StreamingParser(Isolate* isolate, Client* client = nullptr);
+    ~StreamingParser();
+
+    /**
+     * Feeds the next |length| bytes of the text. Fails with a SyntaxError as
+     * soon as a complete array element is malformed.
+     */
+    V8_WARN_UNUSED_RESULT Maybe<bool> Feed(Local<Context> context,
+                                           const uint8_t* data, size_t length);
+
+    /**
+     * Signals the end of the text and returns the parsed value.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+    StreamingParser(const StreamingParser&) = delete;
+    void operator=(const StreamingParser&) = delete;
+
+   private:
+    struct PrivateData;
+    PrivateData* private_;
+  };
 };
 
 /**
@@ -3298,6 +3390,17 @@ class V8_EXPORT String : public Name {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalOneByte(
       Isolate* isolate, ExternalOneByteStringResource* resource);
 
+  /**
+   * Creates a new string from the UTF-8 data in the given resource, whose
+   * length() is the number of bytes. If all bytes are ASCII, the data is
+   * also valid Latin-1 and the result is an external one-byte string backed
+   * by the resource without copying, with the same lifetime rules as
+   * NewExternalOneByte. Otherwise the data is decoded into a new string and
+   * the resource is disposed before this function returns.
+   */
+  static V8_WARN_UNUSED_RESULT MaybeLocal<String> NewExternalUtf8(
+      Isolate* isolate, ExternalOneByteStringResource* resource);
+
   /**
    * Associate an external string resource with this string by transforming it
    * in place so that existing references to this string in the JavaScript heap
@@ -3717,6 +3820,18 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT Maybe<bool> Set(Local<Context> context, uint32_t index,
                                         Local<Value> value);
 
+  /**
+   * Sets |count| properties, |keys[i]| to |values[i]|, with a single entry
+   * into V8. Equivalent to calling Set for each key in order, but cheaper for
+   * hot paths that write several fields of an object. Returns Just(true) or
+   * Empty() if one of the stores threw, in which case the remaining keys are
+   * not set.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> SetProperties(Local<Context> context,
+                                                  const Local<Name>* keys,
+                                                  const Local<Value>* values,
+                                                  size_t count);
+
   // Implements CreateDataProperty (ECMA-262, 7.3.4).
   //
   // Defines a configurable, writable, enumerable property with the given value
@@ -3764,6 +3879,18 @@ class V8_EXPORT Object : public Value {
   V8_WARN_UNUSED_RESULT MaybeLocal<Value> Get(Local<Context> context,
                                               uint32_t index);
 
+  /**
+   * Gets |count| properties, storing the value of |keys[i]| in |values[i]|,
+   * with a single entry into V8. Equivalent to calling Get for each key in
+   * order, but cheaper for hot paths that read several fields of an object.
+   * Returns Just(true) or Empty() if one of the loads threw, in which case
+   * |values| is left untouched.
+   */
+  V8_WARN_UNUSED_RESULT Maybe<bool> GetProperties(Local<Context> context,
+                                                  const Local<Name>* keys,
+                                                  size_t count,
+                                                  Local<Value>* values);
+
   /**
    * Gets the property attributes of a property which can be None or
    * any combination of ReadOnly, DontEnum and DontDelete. Returns
@@ -4867,7 +4994,9 @@ class V8_EXPORT WasmStreaming final {
     virtual ~Client() = default;
     /**
      * Passes the fully compiled module to the client. This can be used to
-     * implement code caching.
+     * implement code caching. With dynamic tiering, the module is passed
+     * again whenever more hot functions got tiered up, so that the cache can
+     * be refreshed with their optimized code.
      */
     virtual void OnModuleCompiled(CompiledWasmModule compiled_module) = 0;
   };
@@ -5027,6 +5156,16 @@ class V8_EXPORT BackingStore : public v8::internal::BackingStoreBase {
       v8::Isolate* isolate, std::unique_ptr<BackingStore> backing_store,
       size_t byte_length);
 
+  /**
+   * Grows or shrinks a backing store created by
+   * ArrayBuffer::NewResizableBackingStore in place, without copying. Returns
+   * false if |byte_length| exceeds its maximum or the memory cannot be
+   * committed. Grown bytes are zero. ArrayBuffers keep the length they were
+   * created with, so pass the backing store to ArrayBuffer::New again to
+   * expose the new length.
+   */
+  bool ResizeInPlace(v8::Isolate* isolate, size_t byte_length);
+
   /**
    * This callback is used only if the memory block for a BackingStore cannot be
    * allocated with an ArrayBuffer::Allocator. In such cases the destructor of
@@ -5103,6 +5242,18 @@ class V8_EXPORT ArrayBuffer : public Object {
      */
     virtual void Free(void* data, size_t length) = 0;
 
+    /**
+     * Free |count| memory blocks at once. Block |i| is pointed to by |data[i]|
+     * and has size |lengths[i]|. All blocks are guaranteed to be previously
+     * allocated by |Allocate| or |AllocateUninitialized|. V8 uses this method
+     * when releasing many dead ArrayBuffers after a garbage collection; it may
+     * be called from a background thread.
+     *
+     * The default implementation calls |Free| for each block.
+     */
+    virtual void FreeBatch(void* const* data, const size_t* lengths,
+                           size_t count);
+
     /**
      * Reallocate the memory block of size |old_length| to a memory block of
      * size |new_length| by expanding, contracting, or copying the existing
@@ -5251,6 +5402,19 @@ class V8_EXPORT ArrayBuffer : public Object {
       void* data, size_t byte_length, v8::BackingStore::DeleterCallback deleter,
       void* deleter_data);
 
+  /**
+   * Returns a new standalone BackingStore of |byte_length| zeroed bytes that
+   * can be grown in place up to |max_byte_length| with
+   * BackingStore::ResizeInPlace. The address space for |max_byte_length| is
+   * reserved up front, and pages are committed as the backing store grows.
+   *
+   * If the address space cannot be reserved, then the function may cause GCs
+   * in the given isolate and re-try the reservation. If GCs do not help, then
+   * the function will crash with an out-of-memory error.
+   */
+  static std::unique_ptr<BackingStore> NewResizableBackingStore(
+      Isolate* isolate, size_t byte_length, size_t max_byte_length);
+
   /**
    * Returns true if ArrayBuffer is externalized, that is, does not
    * own its memory block.
@@ -5932,9 +6096,10 @@ class V8_EXPORT RegExp : public Object {
     kSticky = 1 << 3,
     kUnicode = 1 << 4,
     kDotAll = 1 << 5,
+    kLinear = 1 << 6,
   };
 
-  static constexpr int kFlagCount = 6;
+  static constexpr int kFlagCount = 7;
 
   /**
    * Creates a regular expression from the given pattern string and
@@ -6814,6 +6979,16 @@ class V8_EXPORT ObjectTemplate : public Template {
       SideEffectType getter_side_effect_type = SideEffectType::kHasSideEffect,
       SideEffectType setter_side_effect_type = SideEffectType::kHasSideEffect);
 
+  /**
+   * Sets a native data property that returns the value of the internal field
+   * at |index| of the receiver. The field must hold a JavaScript value set
+   * with Object::SetInternalField, not an aligned pointer. Unlike accessors
+   * with a callback, loads of the property are compiled into direct loads of
+   * the field by the inline caches and the optimizing compiler.
+   */
+  void SetInternalFieldAccessor(Local<Name> name, int index,
+                                PropertyAttribute attribute = None);
+
   /**
    * Sets a named property handler on the object template.
    *
@@ -7101,6 +7276,8 @@ class V8_EXPORT ResourceConstraints {
    * garbage collections and invoke the NearHeapLimitCallback.
    * If the garbage collections do not help and the callback does not
    * increase the limit, then V8 will crash with V8::FatalProcessOutOfMemory.
+   * With pointer compression, the heap of each isolate lives in its own 4GB
+   * reservation, and larger limits are clamped to fit into it.
    */
   size_t max_old_generation_size_in_bytes() const {
     return max_old_generation_size_;
@@ -7170,6 +7347,81 @@ class V8_EXPORT ResourceConstraints {
   uint32_t* stack_limit_ = nullptr;
 };
 
+/**
+ * Thresholds that control when the functions of an isolate are optimized.
+ * Isolates running short-lived workloads can optimize early, while long-lived
+ * ones can spend more time compiling to get better code. A value of zero
+ * keeps the default, which is given by V8's flags.
+ */
+class V8_EXPORT TieringPolicy {
+ public:
+  /**
+   * The amount of bytecode, in bytes, a function executes between two
+   * profiler ticks. Functions are considered for optimization on every tick.
+   */
+  int interrupt_budget() const { return interrupt_budget_; }
+  void set_interrupt_budget(int bytes) { interrupt_budget_ = bytes; }
+
+  /**
+   * The amount of bytecode, in bytes, a function executes before feedback is
+   * collected for it, if feedback vectors are allocated lazily.
+   */
+  int budget_for_feedback_vector_allocation() const {
+    return budget_for_feedback_vector_allocation_;
+  }
+  void set_budget_for_feedback_vector_allocation(int bytes) {
+    budget_for_feedback_vector_allocation_ = bytes;
+  }
+
+  /**
+   * The number of profiler ticks a function needs to get before it is
+   * optimized, plus one tick for every |bytecode_size_allowance_per_tick|
+   * bytes of bytecode it has.
+   */
+  int ticks_before_optimization() const { return ticks_before_optimization_; }
+  void set_ticks_before_optimization(int ticks) {
+    ticks_before_optimization_ = ticks;
+  }
+  int bytecode_size_allowance_per_tick() const {
+    return bytecode_size_allowance_per_tick_;
+  }
+  void set_bytecode_size_allowance_per_tick(int bytes) {
+    bytecode_size_allowance_per_tick_ = bytes;
+  }
+
+  /**
+   * Functions with less bytecode than this, in bytes, are optimized on their
+   * first profiler tick if no inline cache changed since the last one.
+   */
+  int max_bytecode_size_for_early_optimization() const {
+    return max_bytecode_size_for_early_optimization_;
+  }
+  void set_max_bytecode_size_for_early_optimization(int bytes) {
+    max_bytecode_size_for_early_optimization_ = bytes;
+  }
+
+  /**
+   * Bounds the compile CPU time spent in the background: at most this many
+   * concurrent optimization jobs are queued at a time. Functions that find
+   * the queue full keep running unoptimized and are considered again on
+   * later profiler ticks.
+   */
+  int max_concurrent_optimization_jobs() const {
+    return max_concurrent_optimization_jobs_;
+  }
+  void set_max_concurrent_optimization_jobs(int jobs) {
+    max_concurrent_optimization_jobs_ = jobs;
+  }
+
+ private:
+  int interrupt_budget_ = 0;
+  int budget_for_feedback_vector_allocation_ = 0;
+  int ticks_before_optimization_ = 0;
+  int bytecode_size_allowance_per_tick_ = 0;
+  int max_bytecode_size_for_early_optimization_ = 0;
+  int max_concurrent_optimization_jobs_ = 0;
+};
+
 
 // --- Exceptions ---
 
@@ -7591,6 +7843,16 @@ typedef void (*InterruptCallback)(Isolate* isolate, void* data);
 typedef size_t (*NearHeapLimitCallback)(void* data, size_t current_heap_limit,
                                         size_t initial_heap_limit);
 
+/**
+ * This callback is invoked after a full garbage collection in which the size
+ * of live objects in the old generation reached the given fraction of the heap
+ * limit. It allows embedders to release caches before the heap gets close to
+ * the limit. The callback is invoked again only after the live size dropped
+ * below the fraction in between.
+ */
+typedef void (*HeapLimitFractionCallback)(void* data, size_t live_size,
+                                          size_t heap_limit, double fraction);
+
 /**
  * Collection of shared per-process V8 memory information.
  *
@@ -7638,6 +7900,31 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_native_contexts() { return number_of_native_contexts_; }
   size_t number_of_detached_contexts() { return number_of_detached_contexts_; }
 
+  /**
+   * Returns the current capacity of a single new space semi-space as chosen
+   * by the GC heuristics, e.g. by --scavenge-target-pause-ms.
+   */
+  size_t new_space_capacity() { return new_space_capacity_; }
+
+  /**
+   * Returns the memory of dead ArrayBuffers that is kept for reuse by new
+   * ArrayBuffers of the same length (see --array-buffer-pool-size), and how
+   * many ArrayBuffer allocations were served from it or not.
+   */
+  size_t pooled_array_buffer_memory() { return pooled_array_buffer_memory_; }
+  size_t array_buffer_pool_hits() { return array_buffer_pool_hits_; }
+  size_t array_buffer_pool_misses() { return array_buffer_pool_misses_; }
+
+  /**
+   * Returns the external memory reported through
+   * Isolate::AdjustAmountOfExternalAllocatedMemory, which includes the backing
+   * stores of ArrayBuffers, and the amount at which reporting more external
+   * memory triggers a garbage collection. Unlike external_memory(), this does
+   * not include external strings.
+   */
+  size_t reported_external_memory() { return reported_external_memory_; }
+  size_t external_memory_limit() { return external_memory_limit_; }
+
   /**
    * Returns a 0/1 boolean, which signifies whether the V8 overwrite heap
    * garbage with a bit pattern.
@@ -7659,6 +7946,12 @@ class V8_EXPORT HeapStatistics {
   size_t number_of_detached_contexts_;
   size_t total_global_handles_size_;
   size_t used_global_handles_size_;
+  size_t new_space_capacity_;
+  size_t pooled_array_buffer_memory_;
+  size_t array_buffer_pool_hits_;
+  size_t array_buffer_pool_misses_;
+  size_t reported_external_memory_;
+  size_t external_memory_limit_;
 
   friend class V8;
   friend class Isolate;
@@ -7717,6 +8010,37 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Statistics about the isolate's in-memory cache of compiled scripts and
+ * eval sources, which lets identical sources compiled in any context of the
+ * isolate share one compilation. The eval statistics cover eval and the
+ * Function constructor.
+ */
+class V8_EXPORT CompilationCacheStatistics {
+ public:
+  CompilationCacheStatistics();
+  size_t script_hits() { return script_hits_; }
+  size_t script_misses() { return script_misses_; }
+  size_t script_evictions() { return script_evictions_; }
+  size_t script_source_size() { return script_source_size_; }
+  size_t eval_hits() { return eval_hits_; }
+  size_t eval_misses() { return eval_misses_; }
+  size_t eval_evictions() { return eval_evictions_; }
+  size_t eval_source_size() { return eval_source_size_; }
+
+ private:
+  size_t script_hits_;
+  size_t script_misses_;
+  size_t script_evictions_;
+  size_t script_source_size_;
+  size_t eval_hits_;
+  size_t eval_misses_;
+  size_t eval_evictions_;
+  size_t eval_source_size_;
+
+  friend class Isolate;
+};
+
 /**
  * A JIT code event is issued each time code is added, moved or removed.
  *
@@ -8192,7 +8516,8 @@ class V8_EXPORT Isolate {
           allow_atomics_wait(true),
           only_terminate_in_safe_scope(false),
           embedder_wrapper_type_index(-1),
-          embedder_wrapper_object_index(-1) {}
+          embedder_wrapper_object_index(-1),
+          numa_node(-1) {}
 
     /**
      * Allows the host application to provide the address of a function that is
@@ -8264,6 +8589,13 @@ class V8_EXPORT Isolate {
      */
     int embedder_wrapper_type_index;
     int embedder_wrapper_object_index;
+
+    /**
+     * If non-negative, the heap pages of the isolate are preferably backed by
+     * physical memory of the given NUMA node. This is only a hint and
+     * currently only supported on Linux.
+     */
+    int numa_node;
   };
 
 
@@ -8498,6 +8830,7 @@ class V8_EXPORT Isolate {
     kWasmRefTypes = 108,
     kWasmBulkMemory = 109,
     kWasmMultiValue = 110,
+    kDeoptimizationLoopDetected = 111,
 
     // If you add new values here, you'll also need to update Chromium's:
     // web_feature.mojom, use_counter_callback.cc, and enums.xml. V8 changes to
@@ -8730,6 +9063,36 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get statistics about the compilation cache. Script and eval sources kept
+   * alive by the cache can be bounded with --compilation-cache-script-max-size
+   * and --compilation-cache-eval-max-size, in which case the least recently
+   * used entries are evicted.
+   *
+   * \param cache_statistics The CompilationCacheStatistics object to fill in
+   *   hits, misses and evictions of the script and eval caches, and the size
+   *   of the sources they keep alive.
+   * \returns true on success.
+   */
+  bool GetCompilationCacheStatistics(
+      CompilationCacheStatistics* cache_statistics);
+
+  using RuntimeCallStatsCallback = void (*)(const char* name, int64_t count,
+                                            int64_t time_in_us, void* data);
+
+  /**
+   * Reports the runtime call statistics of this isolate, which are collected
+   * with --runtime-call-stats. The counters of background threads are merged
+   * into those of the isolate's thread first. With --rcs-sampling-interval,
+   * counts and times are extrapolated from the measured scopes. Must be
+   * called on the isolate's thread.
+   *
+   * \param callback Called with |data| for every counter that has been
+   *   entered, with its name, count and time in microseconds.
+   * \returns false if runtime call statistics are not collected.
+   */
+  bool GetRuntimeCallStats(RuntimeCallStatsCallback callback, void* data);
+
   /**
    * This API is experimental and may change significantly.
    *
@@ -8750,6 +9113,17 @@ class V8_EXPORT Isolate {
   MaybeLocal<Promise> MeasureMemory(Local<Context> context,
                                     MeasureMemoryMode mode);
 
+  /**
+   * This API is experimental and may change significantly.
+   *
+   * Returns the number of bytes attributed to the given context by the last
+   * full garbage collection. The first call for a context starts tracking it,
+   * so that every following full garbage collection updates its size, and
+   * returns 0. Objects that cannot be attributed to a single context are not
+   * included. The call does not trigger a garbage collection.
+   */
+  size_t GetContextMemoryUsage(Local<Context> context);
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -9019,6 +9393,22 @@ class V8_EXPORT Isolate {
    */
   void CancelTerminateExecution();
 
+  /**
+   * Terminate the current thread of JavaScript execution once
+   * |timeout_in_ms| milliseconds have passed, like TerminateExecution().
+   * Setting a new deadline replaces the previous one. The deadline is tracked
+   * by a delayed platform worker task, so no thread is needed per request.
+   * Termination does not create a message or capture a stack trace.
+   */
+  void SetExecutionDeadline(double timeout_in_ms);
+
+  /**
+   * Remove the deadline set with SetExecutionDeadline(), e.g. after the
+   * request finished in time. A termination that already happened needs
+   * CancelTerminateExecution() as usual.
+   */
+  void CancelExecutionDeadline();
+
   /**
    * Request V8 to interrupt long running JavaScript code and invoke
    * the given |callback| passing the given |data| to it. After |callback|
@@ -9250,6 +9640,28 @@ class V8_EXPORT Isolate {
    */
   void SetRAILMode(RAILMode rail_mode);
 
+  /**
+   * Optional notification to bound the latency impact of garbage collection.
+   * |max_pause_ms| limits the duration of incremental marking steps and
+   * sizes the young generation and the compaction work of full garbage
+   * collections such that their pauses are expected to stay within the
+   * budget. |mutator_utilization_target| is the fraction of time, in [0, 1],
+   * that should be left to the mutator across full garbage collection
+   * cycles; memory reducing garbage collections are postponed while it is
+   * missed. Garbage collections exceeding the budget are reported as
+   * v8::metrics::GarbageCollectionBudgetExceeded events. Passing 0 disables
+   * the respective limit.
+   */
+  void SetGCPauseBudget(double max_pause_ms,
+                        double mutator_utilization_target = 0.0);
+
+  /**
+   * Sets the thresholds that control when functions are optimized in this
+   * isolate, see TieringPolicy. Budgets that are already running down keep
+   * their current value.
+   */
+  void SetTieringPolicy(const TieringPolicy& policy);
+
   /**
    * Optional notification to tell V8 the current isolate is used for debugging
    * and requires higher heap limit.
@@ -9372,6 +9784,21 @@ class V8_EXPORT Isolate {
   void RemoveNearHeapLimitCallback(NearHeapLimitCallback callback,
                                    size_t heap_limit);
 
+  /**
+   * Add a callback to invoke when the old generation live size after a full
+   * garbage collection reaches |fraction| of the heap limit. The fraction is a
+   * number in (0.0, 1.0] range. The same callback can be added for several
+   * fractions to get tiered notifications.
+   */
+  void AddHeapLimitFractionCallback(HeapLimitFractionCallback callback,
+                                    void* data, double fraction);
+
+  /**
+   * Remove all registrations of the given callback with the given data.
+   */
+  void RemoveHeapLimitFractionCallback(HeapLimitFractionCallback callback,
+                                       void* data);
+
   /**
    * If the heap limit was changed by the NearHeapLimitCallback, then the
    * initial heap limit will be restored once the heap size falls below the
@@ -10484,6 +10911,19 @@ class V8_EXPORT Context {
    */
   void SetContinuationPreservedEmbedderData(Local<Value> context);
 
+  /**
+   * Installs JavaScript functions as promise hooks of this context. Unlike
+   * Isolate::SetPromiseHook, the hooks are called directly from the builtins,
+   * so promise operations keep taking their fast paths apart from the calls
+   * themselves. The init hook is called with the new promise and its parent
+   * promise or undefined, the other hooks are called with the promise only.
+   * Empty handles uninstall the respective hook. Exceptions thrown by a hook
+   * are reported as messages and don't affect the promise.
+   */
+  void SetPromiseHooks(Local<Function> init_hook, Local<Function> before_hook,
+                       Local<Function> after_hook,
+                       Local<Function> resolve_hook);
+
   /**
    * Stack-allocated class which sets the execution context for all
    * operations executed within a local scope.
@@ -289,9 +289,12 @@ MaybeHandle<JSObject> ProbeInstantiationsCache(
     Isolate* isolate, Handle<NativeContext> native_context, int serial_number,
     CachingMode caching_mode) {
   DCHECK_LE(1, serial_number);
-  if (serial_number <= TemplateInfo::kFastTemplateInstantiationsCacheSize) {
+  if (serial_number <= TemplateInfo::kMaxFastTemplateInstantiationsCacheSize) {
     FixedArray fast_cache =
         native_context->fast_template_instantiations_cache();
+    // The cache only grows once a template with a large serial number is
+    // instantiated.
+    if (serial_number > fast_cache.length()) return {};
     Handle<Object> object{fast_cache.get(serial_number - 1), isolate};
     if (object->IsUndefined(isolate)) return {};
     return Handle<JSObject>::cast(object);
@@ -313,7 +316,7 @@ void CacheTemplateInstantiation(Isolate* isolate,
                                 int serial_number, CachingMode caching_mode,
                                 Handle<JSObject> object) {
   DCHECK_LE(1, serial_number);
-  if (serial_number <= TemplateInfo::kFastTemplateInstantiationsCacheSize) {
+  if (serial_number <= TemplateInfo::kMaxFastTemplateInstantiationsCacheSize) {
     Handle<FixedArray> fast_cache =
         handle(native_context->fast_template_instantiations_cache(), isolate);
     Handle<FixedArray> new_cache =
@@ -338,7 +341,7 @@ void UncacheTemplateInstantiation(Isolate* isolate,
                                   Handle<NativeContext> native_context,
                                   int serial_number, CachingMode caching_mode) {
   DCHECK_LE(1, serial_number);
-  if (serial_number <= TemplateInfo::kFastTemplateInstantiationsCacheSize) {
+  if (serial_number <= TemplateInfo::kMaxFastTemplateInstantiationsCacheSize) {
     FixedArray fast_cache =
         native_context->fast_template_instantiations_cache();
     DCHECK(!fast_cache.get(serial_number - 1).IsUndefined(isolate));
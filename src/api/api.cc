@@ -7,7 +7,9 @@
 #include <algorithm>  // For min
 #include <cmath>      // For isnan.
 #include <limits>
+#include <sstream>
 #include <string>
+#include <unordered_set>
 #include <utility>  // For move
 #include <vector>
 
@@ -25,6 +27,7 @@
 #include "src/base/utils/random-number-generator.h"
 #include "src/builtins/accessors.h"
 #include "src/builtins/builtins-utils.h"
+#include "src/codegen/compilation-cache.h"
 #include "src/codegen/compiler.h"
 #include "src/codegen/cpu-features.h"
 #include "src/common/assert-scope.h"
@@ -38,6 +41,7 @@
 #include "src/debug/debug.h"
 #include "src/debug/liveedit.h"
 #include "src/deoptimizer/deoptimizer.h"
+#include "src/diagnostics/basic-block-profiler.h"
 #include "src/diagnostics/gdb-jit.h"
 #include "src/execution/execution.h"
 #include "src/execution/frames-inl.h"
@@ -50,6 +54,7 @@
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles.h"
 #include "src/handles/persistent-handles.h"
+#include "src/heap/array-buffer-pool.h"
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/heap-inl.h"
 #include "src/init/bootstrapper.h"
@@ -57,6 +62,7 @@
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
 #include "src/json/json-parser.h"
+#include "src/json/json-streaming-parser.h"
 #include "src/json/json-stringifier.h"
 #include "src/logging/counters.h"
 #include "src/logging/metrics.h"
@@ -66,6 +72,7 @@
 #include "src/objects/contexts.h"
 #include "src/objects/embedder-data-array-inl.h"
 #include "src/objects/embedder-data-slot-inl.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/frame-array-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/heap-object.h"
@@ -104,6 +111,7 @@
 #include "src/snapshot/startup-serializer.h"  // For SerializedHandleChecker.
 #include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-hasher.h"
+#include "src/strings/unicode-decoder.h"
 #include "src/strings/unicode-inl.h"
 #include "src/tracing/trace-event.h"
 #include "src/trap-handler/trap-handler.h"
@@ -1785,6 +1793,21 @@ void ObjectTemplate::SetAccessor(v8::Local<Name> name,
                       getter_side_effect_type, setter_side_effect_type);
 }
 
+void ObjectTemplate::SetInternalFieldAccessor(v8::Local<Name> name, int index,
+                                              PropertyAttribute attribute) {
+  auto isolate = Utils::OpenHandle(this)->GetIsolate();
+  Utils::ApiCheck(index >= 0 && index < i::Smi::kMaxValue,
+                  "v8::ObjectTemplate::SetInternalFieldAccessor()",
+                  "Invalid internal field index");
+  TemplateSetAccessor(
+      this, name, &i::Accessors::InternalFieldGetter,
+      static_cast<AccessorNameSetterCallback>(nullptr),
+      v8::Integer::New(reinterpret_cast<v8::Isolate*>(isolate), index),
+      DEFAULT, attribute, Local<AccessorSignature>(), true, false,
+      SideEffectType::kHasNoSideEffect,
+      SideEffectType::kHasSideEffectToReceiver);
+}
+
 template <typename Getter, typename Setter, typename Query, typename Descriptor,
           typename Deleter, typename Enumerator, typename Definer>
 static i::Handle<i::InterceptorInfo> CreateInterceptorInfo(
@@ -2680,6 +2703,23 @@ ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
   return i::CodeSerializer::Serialize(shared);
 }
 
+ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCacheAfterExecution(
+    Local<UnboundScript> unbound_script, PendingCompilePolicy policy) {
+  i::Handle<i::SharedFunctionInfo> shared =
+      i::Handle<i::SharedFunctionInfo>::cast(
+          Utils::OpenHandle(*unbound_script));
+  DCHECK(shared->is_toplevel());
+  i::Isolate* isolate = shared->GetIsolate();
+  i::CompilerDispatcher* dispatcher = isolate->compiler_dispatcher();
+  if (dispatcher->IsEnabled()) {
+    i::HandleScope scope(isolate);
+    i::Handle<i::Script> script(i::Script::cast(shared->script()), isolate);
+    dispatcher->FinishJobsForScript(script,
+                                    policy == kIncludePendingCompiles);
+  }
+  return i::CodeSerializer::Serialize(shared);
+}
+
 // static
 ScriptCompiler::CachedData* ScriptCompiler::CreateCodeCache(
     Local<UnboundModuleScript> unbound_module_script) {
@@ -3097,6 +3137,44 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+struct JSON::StreamingParser::PrivateData {
+  PrivateData(i::Isolate* isolate, Client* client) : parser(isolate, client) {}
+  i::JsonStreamingParser parser;
+};
+
+JSON::StreamingParser::StreamingParser(Isolate* isolate, Client* client)
+    : private_(new PrivateData(reinterpret_cast<i::Isolate*>(isolate),
+                               client)) {}
+
+JSON::StreamingParser::~StreamingParser() { delete private_; }
+
+Maybe<bool> JSON::StreamingParser::Feed(Local<Context> context,
+                                        const uint8_t* data, size_t length) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, JSON, StreamingParser_Feed, Nothing<bool>(),
+           i::HandleScope);
+  Maybe<bool> result = Just(true);
+  // Feed chunks that don't fit a Vector piecewise.
+  while (length > 0 && result.IsJust()) {
+    size_t piece = std::min(length, static_cast<size_t>(i::kMaxInt));
+    result = private_->parser.Feed(
+        i::Vector<const uint8_t>(data, static_cast<int>(piece)));
+    data += piece;
+    length -= piece;
+  }
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Finish(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, StreamingParser_Finish, Value);
+  Local<Value> result;
+  has_pending_exception = !ToLocal<Value>(private_->parser.Finish(), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3117,6 +3195,28 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToUtf8(Local<Context> context,
+                                  Local<Value> json_object,
+                                  OutputStream* stream, Local<String> gap) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, JSON, StringifyToUtf8, Nothing<bool>(),
+           i::HandleScope);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::Object> replacer = isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  i::Handle<i::Object> maybe;
+  has_pending_exception =
+      !i::JsonStringify(isolate, object, replacer, gap_string).ToHandle(&maybe);
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  i::Handle<i::String> result;
+  has_pending_exception =
+      !i::Object::ToString(isolate, maybe).ToHandle(&result);
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return Just(i::WriteUtf8ToStream(isolate, result, stream));
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -3800,6 +3900,16 @@ std::unique_ptr<v8::BackingStore> v8::BackingStore::Reallocate(
   return backing_store;
 }
 
+bool v8::BackingStore::ResizeInPlace(v8::Isolate* isolate,
+                                     size_t byte_length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  i::BackingStore* i_this = reinterpret_cast<i::BackingStore*>(this);
+  Utils::ApiCheck(i_this->is_resizable(), "v8::BackingStore::ResizeInPlace",
+                  "BackingStore was not created as resizable");
+  if (byte_length > i::JSArrayBuffer::kMaxByteLength) return false;
+  return i_this->ResizeInPlace(i_isolate, byte_length);
+}
+
 // static
 void v8::BackingStore::EmptyDeleter(void* data, size_t length,
                                     void* deleter_data) {
@@ -4050,6 +4160,28 @@ Maybe<bool> v8::Object::Set(v8::Local<v8::Context> context,
   return Just(true);
 }
 
+Maybe<bool> v8::Object::SetProperties(Local<Context> context,
+                                      const Local<Name>* keys,
+                                      const Local<Value>* values,
+                                      size_t count) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, Object, SetProperties, Nothing<bool>(),
+           i::HandleScope);
+  auto self = Utils::OpenHandle(this);
+  for (size_t i = 0; i < count; i++) {
+    i::HandleScope loop_scope(isolate);
+    has_pending_exception =
+        i::Runtime::SetObjectProperty(isolate, self,
+                                      Utils::OpenHandle(*keys[i]),
+                                      Utils::OpenHandle(*values[i]),
+                                      i::StoreOrigin::kMaybeKeyed,
+                                      Just(i::ShouldThrow::kDontThrow))
+            .is_null();
+    RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  }
+  return Just(true);
+}
+
 Maybe<bool> v8::Object::Set(v8::Local<v8::Context> context, uint32_t index,
                             v8::Local<Value> value) {
   auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
@@ -4290,6 +4422,38 @@ MaybeLocal<Value> v8::Object::Get(Local<Context> context, uint32_t index) {
   RETURN_ESCAPED(Utils::ToLocal(result));
 }
 
+Maybe<bool> v8::Object::GetProperties(Local<Context> context,
+                                      const Local<Name>* keys, size_t count,
+                                      Local<Value>* values) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  CHECK_LE(count, static_cast<size_t>(i::FixedArray::kMaxLength));
+  i::Handle<i::FixedArray> results;
+  {
+    ENTER_V8(isolate, context, Object, GetProperties, Nothing<bool>(),
+             i::HandleScope);
+    auto self = Utils::OpenHandle(this);
+    i::Handle<i::FixedArray> loaded =
+        isolate->factory()->NewFixedArray(static_cast<int>(count));
+    for (size_t i = 0; i < count; i++) {
+      i::HandleScope loop_scope(isolate);
+      i::Handle<i::Object> result;
+      has_pending_exception =
+          !i::Runtime::GetObjectProperty(isolate, self,
+                                         Utils::OpenHandle(*keys[i]))
+               .ToHandle(&result);
+      RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+      loaded->set(static_cast<int>(i), *result);
+    }
+    // The values need handles in the caller's scope.
+    results = handle_scope.CloseAndEscape(loaded);
+  }
+  for (size_t i = 0; i < count; i++) {
+    values[i] =
+        Utils::ToLocal(i::handle(results->get(static_cast<int>(i)), isolate));
+  }
+  return Just(true);
+}
+
 MaybeLocal<Value> v8::Object::GetPrivate(Local<Context> context,
                                          Local<Private> key) {
   return Get(context, Local<Value>(reinterpret_cast<Value*>(*key)));
@@ -5787,7 +5951,13 @@ HeapStatistics::HeapStatistics()
       peak_malloced_memory_(0),
       does_zap_garbage_(false),
       number_of_native_contexts_(0),
-      number_of_detached_contexts_(0) {}
+      number_of_detached_contexts_(0),
+      new_space_capacity_(0),
+      pooled_array_buffer_memory_(0),
+      array_buffer_pool_hits_(0),
+      array_buffer_pool_misses_(0),
+      reported_external_memory_(0),
+      external_memory_limit_(0) {}
 
 HeapSpaceStatistics::HeapSpaceStatistics()
     : space_name_(nullptr),
@@ -5807,6 +5977,16 @@ HeapCodeStatistics::HeapCodeStatistics()
       bytecode_and_metadata_size_(0),
       external_script_source_size_(0) {}
 
+CompilationCacheStatistics::CompilationCacheStatistics()
+    : script_hits_(0),
+      script_misses_(0),
+      script_evictions_(0),
+      script_source_size_(0),
+      eval_hits_(0),
+      eval_misses_(0),
+      eval_evictions_(0),
+      eval_source_size_(0) {}
+
 bool v8::V8::InitializeICU(const char* icu_data_file) {
   return i::InitializeICU(icu_data_file);
 }
@@ -6151,6 +6331,32 @@ void Context::SetContinuationPreservedEmbedderData(Local<Value> data) {
       *i::Handle<i::HeapObject>::cast(Utils::OpenHandle(*data)));
 }
 
+void Context::SetPromiseHooks(Local<Function> init_hook,
+                              Local<Function> before_hook,
+                              Local<Function> after_hook,
+                              Local<Function> resolve_hook) {
+  i::Handle<i::Context> context = Utils::OpenHandle(this);
+  i::Isolate* isolate = context->GetIsolate();
+  i::Handle<i::Object> undefined = isolate->factory()->undefined_value();
+  auto hook_or_undefined = [&](Local<Function> hook) -> i::Handle<i::Object> {
+    if (hook.IsEmpty()) return undefined;
+    return Utils::OpenHandle(*hook);
+  };
+  i::NativeContext native_context = context->native_context();
+  native_context.set_promise_hook_init_function(*hook_or_undefined(init_hook));
+  native_context.set_promise_hook_before_function(
+      *hook_or_undefined(before_hook));
+  native_context.set_promise_hook_after_function(
+      *hook_or_undefined(after_hook));
+  native_context.set_promise_hook_resolve_function(
+      *hook_or_undefined(resolve_hook));
+  // The flag is never cleared, since other contexts may still have hooks.
+  if (!init_hook.IsEmpty() || !before_hook.IsEmpty() ||
+      !after_hook.IsEmpty() || !resolve_hook.IsEmpty()) {
+    isolate->SetHasContextPromiseHooks(true);
+  }
+}
+
 MaybeLocal<Context> metrics::Recorder::GetContext(
     Isolate* isolate, metrics::Recorder::ContextId id) {
   i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
@@ -6464,6 +6670,41 @@ MaybeLocal<String> v8::String::NewExternalOneByte(
   return Utils::ToLocal(string);
 }
 
+MaybeLocal<String> v8::String::NewExternalUtf8(
+    Isolate* isolate, v8::String::ExternalOneByteStringResource* resource) {
+  CHECK_NOT_NULL(resource);
+  if (resource->length() > static_cast<size_t>(i::String::kMaxLength)) {
+    return MaybeLocal<String>();
+  }
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  LOG_API(i_isolate, String, NewExternalUtf8);
+  int length = static_cast<int>(resource->length());
+  if (length == 0) {
+    // The resource isn't going to be used, free it immediately.
+    resource->Dispose();
+    return Utils::ToLocal(i_isolate->factory()->empty_string());
+  }
+  CHECK_NOT_NULL(resource->data());
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(resource->data());
+  if (i::NonAsciiStart(data, length) >= length) {
+    // ASCII is a subset of both UTF-8 and Latin-1, so the bytes can be used
+    // as they are.
+    i::Handle<i::String> string = i_isolate->factory()
+                                      ->NewExternalStringFromOneByte(resource)
+                                      .ToHandleChecked();
+    return Utils::ToLocal(string);
+  }
+  // Decoding never produces more characters than there are bytes, so this
+  // can't exceed the maximum string length.
+  i::Handle<i::String> string =
+      i_isolate->factory()
+          ->NewStringFromUtf8(i::Vector<const char>(resource->data(), length))
+          .ToHandleChecked();
+  resource->Dispose();
+  return Utils::ToLocal(string);
+}
+
 bool v8::String::MakeExternal(v8::String::ExternalStringResource* resource) {
   i::DisallowHeapAllocation no_allocation;
 
@@ -7313,6 +7554,14 @@ void WasmModuleObjectBuilderStreaming::Finish() {}
 
 void WasmModuleObjectBuilderStreaming::Abort(MaybeLocal<Value> exception) {}
 
+void v8::ArrayBuffer::Allocator::FreeBatch(void* const* data,
+                                          const size_t* lengths,
+                                          size_t count) {
+  for (size_t i = 0; i < count; i++) {
+    Free(data[i], lengths[i]);
+  }
+}
+
 void* v8::ArrayBuffer::Allocator::Reallocate(void* data, size_t old_length,
                                              size_t new_length) {
   if (old_length == new_length) return data;
@@ -7482,7 +7731,7 @@ v8::ArrayBuffer::Contents v8::ArrayBuffer::GetContents(bool externalize) {
   i::GlobalBackingStoreRegistry::Register(backing_store);
 
   auto allocation_mode =
-      backing_store->is_wasm_memory()
+      backing_store->is_wasm_memory() || backing_store->is_resizable()
           ? v8::ArrayBuffer::Allocator::AllocationMode::kReservation
           : v8::ArrayBuffer::Allocator::AllocationMode::kNormal;
 
@@ -7595,6 +7844,24 @@ std::unique_ptr<v8::BackingStore> v8::ArrayBuffer::NewBackingStore(
       static_cast<v8::BackingStore*>(backing_store.release()));
 }
 
+std::unique_ptr<v8::BackingStore> v8::ArrayBuffer::NewResizableBackingStore(
+    Isolate* isolate, size_t byte_length, size_t max_byte_length) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  LOG_API(i_isolate, ArrayBuffer, NewResizableBackingStore);
+  CHECK_LE(byte_length, max_byte_length);
+  CHECK_LE(max_byte_length, i::JSArrayBuffer::kMaxByteLength);
+  ENTER_V8_NO_SCRIPT_NO_EXCEPTION(i_isolate);
+  std::unique_ptr<i::BackingStoreBase> backing_store =
+      i::BackingStore::AllocateResizable(i_isolate, byte_length,
+                                         max_byte_length);
+  if (!backing_store) {
+    i::FatalProcessOutOfMemory(i_isolate,
+                               "v8::ArrayBuffer::NewResizableBackingStore");
+  }
+  return std::unique_ptr<v8::BackingStore>(
+      static_cast<v8::BackingStore*>(backing_store.release()));
+}
+
 Local<ArrayBuffer> v8::ArrayBufferView::Buffer() {
   i::Handle<i::JSArrayBufferView> obj = Utils::OpenHandle(this);
   i::Handle<i::JSArrayBuffer> buffer;
@@ -8228,6 +8495,16 @@ void Isolate::CancelTerminateExecution() {
   isolate->CancelTerminateExecution();
 }
 
+void Isolate::SetExecutionDeadline(double timeout_in_ms) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->SetExecutionDeadline(timeout_in_ms);
+}
+
+void Isolate::CancelExecutionDeadline() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->CancelExecutionDeadline();
+}
+
 void Isolate::RequestInterrupt(InterruptCallback callback, void* data) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->RequestInterrupt(callback, data);
@@ -8304,6 +8581,7 @@ void Isolate::Initialize(Isolate* isolate,
   i_isolate->set_allow_atomics_wait(params.allow_atomics_wait);
 
   i_isolate->heap()->ConfigureHeap(params.constraints);
+  i_isolate->heap()->set_numa_node(params.numa_node);
   if (params.constraints.stack_limit() != nullptr) {
     uintptr_t limit =
         reinterpret_cast<uintptr_t>(params.constraints.stack_limit());
@@ -8525,6 +8803,16 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
   heap_statistics->number_of_detached_contexts_ =
       heap->NumberOfDetachedContexts();
   heap_statistics->does_zap_garbage_ = heap->ShouldZapGarbage();
+  heap_statistics->new_space_capacity_ = heap->new_space()->TotalCapacity();
+  i::ArrayBufferPool* array_buffer_pool = heap->array_buffer_pool();
+  heap_statistics->pooled_array_buffer_memory_ =
+      array_buffer_pool->pooled_bytes();
+  heap_statistics->array_buffer_pool_hits_ = array_buffer_pool->hits();
+  heap_statistics->array_buffer_pool_misses_ = array_buffer_pool->misses();
+  heap_statistics->reported_external_memory_ =
+      static_cast<size_t>(std::max(heap->external_memory(), int64_t{0}));
+  heap_statistics->external_memory_limit_ =
+      static_cast<size_t>(std::max(heap->external_memory_limit(), int64_t{0}));
 }
 
 size_t Isolate::NumberOfHeapSpaces() {
@@ -8615,6 +8903,47 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+bool Isolate::GetCompilationCacheStatistics(
+    CompilationCacheStatistics* cache_statistics) {
+  if (!cache_statistics) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::CompilationCache* compilation_cache = isolate->compilation_cache();
+  i::CompilationCacheScript* script_cache = compilation_cache->script_cache();
+  cache_statistics->script_hits_ = script_cache->hits();
+  cache_statistics->script_misses_ = script_cache->misses();
+  cache_statistics->script_evictions_ = script_cache->evictions();
+  cache_statistics->script_source_size_ = script_cache->SourceSize();
+  i::CompilationCacheEval* global = compilation_cache->eval_global_cache();
+  i::CompilationCacheEval* contextual =
+      compilation_cache->eval_contextual_cache();
+  cache_statistics->eval_hits_ = global->hits() + contextual->hits();
+  cache_statistics->eval_misses_ = global->misses() + contextual->misses();
+  cache_statistics->eval_evictions_ =
+      global->evictions() + contextual->evictions();
+  cache_statistics->eval_source_size_ =
+      global->SourceSize() + contextual->SourceSize();
+  return true;
+}
+
+bool Isolate::GetRuntimeCallStats(RuntimeCallStatsCallback callback,
+                                  void* data) {
+  if (!i::TracingFlags::is_runtime_stats_enabled()) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::RuntimeCallStats* stats = isolate->counters()->runtime_call_stats();
+  isolate->counters()->worker_thread_runtime_call_stats()->AddToMainTable(
+      stats);
+  const int64_t interval = i::RuntimeCallStats::SamplingInterval();
+  for (int i = 0; i < i::RuntimeCallStats::kNumberOfCounters; i++) {
+    i::RuntimeCallCounter* counter = stats->GetCounter(i);
+    if (counter->count() == 0) continue;
+    callback(counter->name(), counter->count() * interval,
+             counter->time().InMicroseconds() * interval, data);
+  }
+  return true;
+}
+
 v8::MaybeLocal<v8::Promise> Isolate::MeasureMemory(
     v8::Local<v8::Context> context, MeasureMemoryMode mode) {
   return v8::MaybeLocal<v8::Promise>();
@@ -8626,6 +8955,14 @@ bool Isolate::MeasureMemory(std::unique_ptr<MeasureMemoryDelegate> delegate,
   return isolate->heap()->MeasureMemory(std::move(delegate), execution);
 }
 
+size_t Isolate::GetContextMemoryUsage(Local<Context> context) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::HandleScope scope(isolate);
+  i::Handle<i::NativeContext> native_context =
+      handle(Utils::OpenHandle(*context)->native_context(), isolate);
+  return isolate->heap()->ContextMemoryUsage(native_context);
+}
+
 std::unique_ptr<MeasureMemoryDelegate> MeasureMemoryDelegate::Default(
     Isolate* isolate, Local<Context> context,
     Local<Promise::Resolver> promise_resolver, MeasureMemoryMode mode) {
@@ -8880,6 +9217,17 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
   return isolate->SetRAILMode(rail_mode);
 }
 
+void Isolate::SetGCPauseBudget(double max_pause_ms,
+                               double mutator_utilization_target) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->SetGCPauseBudget(max_pause_ms, mutator_utilization_target);
+}
+
+void Isolate::SetTieringPolicy(const TieringPolicy& policy) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->SetTieringPolicy(policy);
+}
+
 void Isolate::IncreaseHeapLimitForDebugging() {
   // No-op.
 }
@@ -9024,6 +9372,18 @@ void Isolate::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
   isolate->heap()->RemoveNearHeapLimitCallback(callback, heap_limit);
 }
 
+void Isolate::AddHeapLimitFractionCallback(
+    v8::HeapLimitFractionCallback callback, void* data, double fraction) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->AddHeapLimitFractionCallback(callback, data, fraction);
+}
+
+void Isolate::RemoveHeapLimitFractionCallback(
+    v8::HeapLimitFractionCallback callback, void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->RemoveHeapLimitFractionCallback(callback, data);
+}
+
 void Isolate::AutomaticallyRestoreInitialHeapLimit(double threshold_percent) {
   DCHECK_GT(threshold_percent, 0.0);
   DCHECK_LT(threshold_percent, 1.0);
@@ -9957,6 +10317,87 @@ void debug::TierUpAllModulesPerIsolate(Isolate* v8_isolate) {
   isolate->wasm_engine()->TierUpAllModulesPerIsolate(isolate);
 }
 
+std::vector<Local<Function>> debug::GetFunctionsWithFeedback(
+    Isolate* v8_isolate, int min_invocation_count) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  std::vector<Local<Function>> result;
+  std::unordered_set<i::Address> seen_vectors;
+  i::HeapObjectIterator iterator(isolate->heap());
+  i::DisallowHeapAllocation no_gc;
+  for (i::HeapObject obj = iterator.Next(); !obj.is_null();
+       obj = iterator.Next()) {
+    if (!obj.IsJSFunction()) continue;
+    i::JSFunction function = i::JSFunction::cast(obj);
+    if (!function.has_feedback_vector()) continue;
+    i::FeedbackVector vector = function.feedback_vector();
+    if (vector.invocation_count() < min_invocation_count) continue;
+    if (!seen_vectors.insert(vector.ptr()).second) continue;
+    result.push_back(Utils::ToLocal(i::handle(function, isolate)));
+  }
+  return result;
+}
+
+namespace {
+
+debug::InlineCacheState ToInlineCacheState(i::InlineCacheState state) {
+  switch (state) {
+    case i::NO_FEEDBACK:
+    case i::UNINITIALIZED:
+      return debug::InlineCacheState::kUninitialized;
+    case i::MONOMORPHIC:
+    case i::RECOMPUTE_HANDLER:
+      return debug::InlineCacheState::kMonomorphic;
+    case i::POLYMORPHIC:
+      return debug::InlineCacheState::kPolymorphic;
+    case i::MEGAMORPHIC:
+      return debug::InlineCacheState::kMegamorphic;
+    case i::GENERIC:
+      return debug::InlineCacheState::kGeneric;
+  }
+  UNREACHABLE();
+}
+
+bool IsPropertyAccessICKind(i::FeedbackSlotKind kind) {
+  return i::IsLoadICKind(kind) || i::IsKeyedLoadICKind(kind) ||
+         i::IsKeyedHasICKind(kind) || i::IsStoreICKind(kind) ||
+         i::IsStoreOwnICKind(kind) || i::IsKeyedStoreICKind(kind) ||
+         i::IsStoreInArrayLiteralICKind(kind);
+}
+
+}  // namespace
+
+std::vector<debug::FeedbackSlotState> debug::GetFeedbackSlotStates(
+    Local<Function> function) {
+  std::vector<FeedbackSlotState> result;
+  i::Handle<i::JSReceiver> receiver = Utils::OpenHandle(*function);
+  if (!receiver->IsJSFunction()) return result;
+  i::Handle<i::JSFunction> js_function =
+      i::Handle<i::JSFunction>::cast(receiver);
+  if (!js_function->has_feedback_vector()) return result;
+  i::Isolate* isolate = js_function->GetIsolate();
+  i::HandleScope scope(isolate);
+  i::Handle<i::FeedbackVector> vector(js_function->feedback_vector(), isolate);
+  i::FeedbackMetadataIterator iter(i::handle(vector->metadata(), isolate));
+  while (iter.HasNext()) {
+    i::FeedbackSlot slot = iter.Next();
+    if (!IsPropertyAccessICKind(iter.kind())) continue;
+    i::FeedbackNexus nexus(vector, slot);
+    i::MapHandles maps;
+    int map_count = nexus.ExtractMaps(&maps);
+    result.push_back(
+        {slot.ToInt(), ToInlineCacheState(nexus.ic_state()), map_count});
+  }
+  return result;
+}
+
+std::string debug::GetBasicBlockProfile(Isolate* v8_isolate,
+                                        bool reset_counts) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
+  std::ostringstream os;
+  i::BasicBlockProfiler::Get()->PrintJSON(os, isolate, reset_counts);
+  return os.str();
+}
+
 void debug::SetDebugDelegate(Isolate* v8_isolate,
                              debug::DebugDelegate* delegate) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(v8_isolate);
@@ -10664,6 +11105,12 @@ CpuProfile* CpuProfiler::StopProfiling(Local<String> title) {
           *Utils::OpenHandle(*title)));
 }
 
+CpuProfile* CpuProfiler::RestartProfiling(Local<String> title) {
+  return reinterpret_cast<CpuProfile*>(
+      reinterpret_cast<i::CpuProfiler*>(this)->RestartProfiling(
+          *Utils::OpenHandle(*title)));
+}
+
 void CpuProfiler::UseDetailedSourcePositionsForProfiling(Isolate* isolate) {
   reinterpret_cast<i::Isolate*>(isolate)
       ->set_detailed_source_positions_for_profiling(true);
@@ -10899,6 +11346,14 @@ const HeapSnapshot* HeapProfiler::TakeHeapSnapshot(
           control, resolver, treat_global_objects_as_roots));
 }
 
+bool HeapProfiler::TakeHeapSnapshotToStream(OutputStream* stream,
+                                            ActivityControl* control,
+                                            ObjectNameResolver* resolver,
+                                            bool treat_global_objects_as_roots) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->TakeSnapshotToStream(
+      stream, control, resolver, treat_global_objects_as_roots);
+}
+
 void HeapProfiler::StartTrackingHeapObjects(bool track_allocations) {
   reinterpret_cast<i::HeapProfiler*>(this)->StartHeapObjectsTracking(
       track_allocations);
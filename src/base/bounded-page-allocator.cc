@@ -135,5 +135,18 @@ bool BoundedPageAllocator::DiscardSystemPages(void* address, size_t size) {
   return page_allocator_->DiscardSystemPages(address, size);
 }
 
+bool BoundedPageAllocator::BindToNumaNode(void* address, size_t size,
+                                          int node) {
+  return page_allocator_->BindToNumaNode(address, size, node);
+}
+
+bool BoundedPageAllocator::MarkMergeable(void* address, size_t size) {
+  return page_allocator_->MarkMergeable(address, size);
+}
+
+bool BoundedPageAllocator::AdviseHugePages(void* address, size_t size) {
+  return page_allocator_->AdviseHugePages(address, size);
+}
+
 }  // namespace base
 }  // namespace v8
@@ -69,6 +69,12 @@ class V8_BASE_EXPORT BoundedPageAllocator : public v8::PageAllocator {
 
   bool DiscardSystemPages(void* address, size_t size) override;
 
+  bool BindToNumaNode(void* address, size_t size, int node) override;
+
+  bool MarkMergeable(void* address, size_t size) override;
+
+  bool AdviseHugePages(void* address, size_t size) override;
+
  private:
   v8::base::Mutex mutex_;
   const size_t allocate_page_size_;
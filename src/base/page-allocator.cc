@@ -136,5 +136,17 @@ bool PageAllocator::DiscardSystemPages(void* address, size_t size) {
   return base::OS::DiscardSystemPages(address, size);
 }
 
+bool PageAllocator::BindToNumaNode(void* address, size_t size, int node) {
+  return base::OS::BindToNumaNode(address, size, node);
+}
+
+bool PageAllocator::MarkMergeable(void* address, size_t size) {
+  return base::OS::MarkMergeable(address, size);
+}
+
+bool PageAllocator::AdviseHugePages(void* address, size_t size) {
+  return base::OS::AdviseHugePages(address, size);
+}
+
 }  // namespace base
 }  // namespace v8
@@ -47,6 +47,12 @@ class V8_BASE_EXPORT PageAllocator
 
   bool DiscardSystemPages(void* address, size_t size) override;
 
+  bool BindToNumaNode(void* address, size_t size, int node) override;
+
+  bool MarkMergeable(void* address, size_t size) override;
+
+  bool AdviseHugePages(void* address, size_t size) override;
+
  private:
   friend class v8::base::SharedMemory;
 
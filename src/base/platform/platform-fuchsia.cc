@@ -133,6 +133,20 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return true;
 }
 
+// static
+bool OS::BindToNumaNode(void* address, size_t size, int node) {
+  return false;
+}
+
+// static
+bool OS::MarkMergeable(void* address, size_t size) { return false; }
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
+// static
+bool OS::RemapPagesToHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(scottmg): Port, https://crbug.com/731217.
@@ -455,6 +455,95 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ret == 0;
 }
 
+// static
+bool OS::BindToNumaNode(void* address, size_t size, int node) {
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
+  DCHECK_EQ(0, size % CommitPageSize());
+  DCHECK_LE(0, node);
+#if V8_OS_LINUX && defined(__NR_mbind)
+  // Avoid a dependency on libnuma by issuing the system call directly.
+  constexpr int kMpolPreferred = 1;
+  unsigned long node_mask = 0;  // NOLINT(runtime/int)
+  constexpr int kNodeMaskBits = sizeof(node_mask) * CHAR_BIT;
+  if (node >= kNodeMaskBits) return false;
+  node_mask = 1ul << node;
+  // The kernel expects the number of bits plus one, see mbind(2).
+  return syscall(__NR_mbind, address, size, kMpolPreferred, &node_mask,
+                 kNodeMaskBits + 1, 0) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool OS::MarkMergeable(void* address, size_t size) {
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
+  DCHECK_EQ(0, size % CommitPageSize());
+#if V8_OS_LINUX && defined(MADV_MERGEABLE)
+  return madvise(address, size, MADV_MERGEABLE) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  DCHECK_EQ(0, reinterpret_cast<uintptr_t>(address) % CommitPageSize());
+  DCHECK_EQ(0, size % CommitPageSize());
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool OS::RemapPagesToHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE) && defined(MREMAP_FIXED)
+  // Transparent huge pages are PMD-sized, i.e. 2 MB with 4 KB base pages.
+  constexpr uintptr_t kHugePageSize = uintptr_t{2} << 20;
+  const uintptr_t start =
+      RoundUp(reinterpret_cast<uintptr_t>(address), kHugePageSize);
+  const uintptr_t end =
+      RoundDown(reinterpret_cast<uintptr_t>(address) + size, kHugePageSize);
+  if (start >= end) return false;
+  const size_t length = end - start;
+
+  // The copy must be huge page-aligned too, so that mremap can move whole
+  // huge pages. Over-reserve and trim to get there.
+  void* reservation = mmap(nullptr, length + kHugePageSize,
+                           PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                           kMmapFd, 0);
+  if (reservation == MAP_FAILED) return false;
+  const uintptr_t reservation_start = reinterpret_cast<uintptr_t>(reservation);
+  const uintptr_t copy_start = RoundUp(reservation_start, kHugePageSize);
+  const uintptr_t reservation_end = reservation_start + length + kHugePageSize;
+  if (copy_start > reservation_start) {
+    CHECK_EQ(0, munmap(reservation, copy_start - reservation_start));
+  }
+  if (reservation_end > copy_start + length) {
+    CHECK_EQ(0, munmap(reinterpret_cast<void*>(copy_start + length),
+                       reservation_end - copy_start - length));
+  }
+  void* copy = reinterpret_cast<void*>(copy_start);
+
+  if (madvise(copy, length, MADV_HUGEPAGE) != 0) {
+    CHECK_EQ(0, munmap(copy, length));
+    return false;
+  }
+  memcpy(copy, reinterpret_cast<void*>(start), length);
+  if (mprotect(copy, length, PROT_READ | PROT_EXEC) != 0 ||
+      mremap(copy, length, length, MREMAP_MAYMOVE | MREMAP_FIXED,
+             reinterpret_cast<void*>(start)) == MAP_FAILED) {
+    CHECK_EQ(0, munmap(copy, length));
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
 // static
 bool OS::HasLazyCommits() {
 #if V8_OS_AIX || V8_OS_LINUX || V8_OS_MACOSX
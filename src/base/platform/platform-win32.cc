@@ -903,6 +903,20 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ptr;
 }
 
+// static
+bool OS::BindToNumaNode(void* address, size_t size, int node) {
+  return false;
+}
+
+// static
+bool OS::MarkMergeable(void* address, size_t size) { return false; }
+
+// static
+bool OS::AdviseHugePages(void* address, size_t size) { return false; }
+
+// static
+bool OS::RemapPagesToHugePages(void* address, size_t size) { return false; }
+
 // static
 bool OS::HasLazyCommits() {
   // TODO(alph): implement for the platform.
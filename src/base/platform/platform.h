@@ -256,6 +256,13 @@ class V8_BASE_EXPORT OS {
 
   static void ExitProcess(int exit_code);
 
+  // Moves the huge page-aligned part of the given executable range, e.g. of
+  // code linked into the binary, onto anonymous memory backed by huge pages.
+  // The contents and addresses stay the same, but the range must not be
+  // executing concurrently. Returns false if nothing was remapped.
+  V8_WARN_UNUSED_RESULT static bool RemapPagesToHugePages(void* address,
+                                                          size_t size);
+
  private:
   // These classes use the private memory management API below.
   friend class MemoryMappedFile;
@@ -291,6 +298,14 @@ class V8_BASE_EXPORT OS {
   V8_WARN_UNUSED_RESULT static bool DiscardSystemPages(void* address,
                                                        size_t size);
 
+  V8_WARN_UNUSED_RESULT static bool BindToNumaNode(void* address, size_t size,
+                                                   int node);
+
+  V8_WARN_UNUSED_RESULT static bool MarkMergeable(void* address, size_t size);
+
+  V8_WARN_UNUSED_RESULT static bool AdviseHugePages(void* address,
+                                                    size_t size);
+
   static const int msPerSecond = 1000;
 
 #if V8_OS_POSIX
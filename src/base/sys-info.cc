@@ -18,6 +18,12 @@
 #include <sys/sysctl.h>
 #endif
 
+#if V8_OS_LINUX
+#include <sched.h>
+#include <stdio.h>
+#endif
+
+#include <algorithm>
 #include <limits>
 
 #include "src/base/logging.h"
@@ -29,6 +35,40 @@
 namespace v8 {
 namespace base {
 
+#if V8_OS_LINUX
+namespace {
+
+// Returns the integer in the file at |path|, or -1 if there is none.
+long long ReadCgroupValue(const char* path) {  // NOLINT(runtime/int)
+  long long value = -1;                        // NOLINT(runtime/int)
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) return -1;
+  if (fscanf(file, "%lld", &value) != 1) value = -1;
+  fclose(file);
+  return value;
+}
+
+// Returns the CPU quota of the process' cgroup as a number of processors,
+// rounded up, or 0 if there is no quota.
+int CgroupCpuQuota() {
+  long long quota = -1;   // NOLINT(runtime/int)
+  long long period = -1;  // NOLINT(runtime/int)
+  if (FILE* file = fopen("/sys/fs/cgroup/cpu.max", "r")) {
+    // cgroup v2 has "<quota> <period>", or "max <period>" without a quota.
+    if (fscanf(file, "%lld %lld", &quota, &period) != 2) quota = -1;
+    fclose(file);
+  } else {
+    // cgroup v1 has a quota of -1 if there is none.
+    quota = ReadCgroupValue("/sys/fs/cgroup/cpu/cpu.cfs_quota_us");
+    period = ReadCgroupValue("/sys/fs/cgroup/cpu/cpu.cfs_period_us");
+  }
+  if (quota <= 0 || period <= 0) return 0;
+  return static_cast<int>((quota + period - 1) / period);
+}
+
+}  // namespace
+#endif  // V8_OS_LINUX
+
 // static
 int SysInfo::NumberOfProcessors() {
 #if V8_OS_OPENBSD
@@ -52,6 +92,21 @@ int SysInfo::NumberOfProcessors() {
 #endif
 }
 
+// static
+int SysInfo::NumberOfProcessorsAvailable() {
+  int result = NumberOfProcessors();
+#if V8_OS_LINUX
+  cpu_set_t cpu_set;
+  if (sched_getaffinity(0, sizeof(cpu_set), &cpu_set) == 0) {
+    int count = CPU_COUNT(&cpu_set);
+    if (count > 0) result = std::min(result, count);
+  }
+  int quota = CgroupCpuQuota();
+  if (quota > 0) result = std::min(result, quota);
+#endif
+  return result;
+}
+
 
 // static
 int64_t SysInfo::AmountOfPhysicalMemory() {
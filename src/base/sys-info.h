@@ -18,6 +18,11 @@ class V8_BASE_EXPORT SysInfo final {
   // Returns the number of logical processors/core on the current machine.
   static int NumberOfProcessors();
 
+  // Returns the number of processors the current process can use. This is
+  // NumberOfProcessors() limited by the process' CPU affinity and, on Linux,
+  // by the CPU quota of its cgroup, e.g. when running in a container.
+  static int NumberOfProcessorsAvailable();
+
   // Returns the number of bytes of physical memory on the current machine.
   static int64_t AmountOfPhysicalMemory();
 
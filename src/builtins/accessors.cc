@@ -14,6 +14,7 @@
 #include "src/logging/counters.h"
 #include "src/objects/api-callbacks.h"
 #include "src/objects/contexts.h"
+#include "src/objects/embedder-data-slot-inl.h"
 #include "src/objects/field-index-inl.h"
 #include "src/objects/js-array-inl.h"
 #include "src/objects/js-regexp-inl.h"
@@ -80,6 +81,26 @@ bool Accessors::IsJSObjectFieldAccessor(Isolate* isolate, Handle<Map> map,
   }
 }
 
+bool Accessors::IsInternalFieldAccessor(Handle<Map> map,
+                                        Handle<Object> accessors,
+                                        FieldIndex* index) {
+  if (!accessors->IsAccessorInfo()) return false;
+  AccessorInfo info = AccessorInfo::cast(*accessors);
+  if (v8::ToCData<Address>(info.getter()) !=
+      FUNCTION_ADDR(&Accessors::InternalFieldGetter)) {
+    return false;
+  }
+  if (!map->IsJSObjectMap()) return false;
+  int field = Smi::ToInt(info.data());
+  if (field >= JSObject::GetEmbedderFieldCount(*map)) return false;
+  *index = FieldIndex::ForInObjectOffset(
+      JSObject::GetEmbedderFieldsStartOffset(*map) +
+          field * kEmbedderDataSlotSize +
+          EmbedderDataSlot::kTaggedPayloadOffset,
+      FieldIndex::kTagged);
+  return true;
+}
+
 V8_WARN_UNUSED_RESULT MaybeHandle<Object>
 Accessors::ReplaceAccessorWithDataProperty(Handle<Object> receiver,
                                            Handle<JSObject> holder,
@@ -224,6 +245,25 @@ Handle<AccessorInfo> Accessors::MakeArrayLengthInfo(Isolate* isolate) {
                       &ArrayLengthGetter, &ArrayLengthSetter);
 }
 
+//
+// Accessors::InternalField
+//
+
+void Accessors::InternalFieldGetter(
+    v8::Local<v8::Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(info.GetIsolate());
+  DisallowHeapAllocation no_allocation;
+  HandleScope scope(isolate);
+  Object holder = *Utils::OpenHandle(*info.Holder());
+  int field = Smi::ToInt(*Utils::OpenHandle(*info.Data()));
+  Object result = ReadOnlyRoots(isolate).undefined_value();
+  if (holder.IsJSObject() &&
+      field < JSObject::cast(holder).GetEmbedderFieldCount()) {
+    result = EmbedderDataSlot(JSObject::cast(holder), field).load_tagged();
+  }
+  info.GetReturnValue().Set(Utils::ToLocal(Handle<Object>(result, isolate)));
+}
+
 //
 // Accessors::ModuleNamespaceEntry
 //
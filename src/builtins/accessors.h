@@ -55,6 +55,10 @@ class JavaScriptFrame;
   V(ModuleNamespaceEntrySetter) \
   V(ReconfigureToDataProperty)
 
+// Getters of accessors that embedders install through templates. They have no
+// AccessorInfo of their own, but templates may be part of a snapshot.
+#define ACCESSOR_TEMPLATE_GETTER_LIST(V) V(InternalFieldGetter)
+
 // Accessors contains all predefined proxy accessors.
 
 class Accessors : public AllStatic {
@@ -83,6 +87,17 @@ class Accessors : public AllStatic {
       ACCESSOR_SETTER_LIST(COUNT_ACCESSOR);
 #undef COUNT_ACCESSOR
 
+  static constexpr int kAccessorTemplateGetterCount =
+#define COUNT_ACCESSOR(...) +1
+      ACCESSOR_TEMPLATE_GETTER_LIST(COUNT_ACCESSOR);
+#undef COUNT_ACCESSOR
+
+  // Returns the value of the internal field whose index is the data of the
+  // accessor, see v8::ObjectTemplate::SetInternalFieldAccessor.
+  static void InternalFieldGetter(
+      v8::Local<v8::Name> name,
+      const v8::PropertyCallbackInfo<v8::Value>& info);
+
   static void ModuleNamespaceEntryGetter(
       v8::Local<v8::Name> name,
       const v8::PropertyCallbackInfo<v8::Value>& info);
@@ -101,6 +116,13 @@ class Accessors : public AllStatic {
                                       Handle<Name> name,
                                       FieldIndex* field_index);
 
+  // Returns true if |accessors| reads an internal field that objects with
+  // |map| have. Loads of such accessors from the receiver itself are plain
+  // field loads at the FieldIndex returned through |field_index|.
+  static bool IsInternalFieldAccessor(Handle<Map> map,
+                                      Handle<Object> accessors,
+                                      FieldIndex* field_index);
+
   static MaybeHandle<Object> ReplaceAccessorWithDataProperty(
       Handle<Object> receiver, Handle<JSObject> holder, Handle<Name> name,
       Handle<Object> value);
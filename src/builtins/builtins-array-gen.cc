@@ -586,8 +586,44 @@ class ArrayIncludesIndexofAssembler : public CodeStubAssembler {
     Return(value);
     BIND(&done);
   }
+
+  // Searches the remaining elements with the C++ {function} if there are
+  // enough of them to pay for the call. Jumps to {if_found} with the index in
+  // {index_var} or to {if_not_found}, and falls through otherwise.
+  void SearchInCIfLong(ExternalReference function,
+                       TNode<FixedArrayBase> elements,
+                       TNode<Object> search_element,
+                       TNode<IntPtrT> array_length,
+                       TVariable<IntPtrT>* index_var, Label* if_found,
+                       Label* if_not_found);
+
+ private:
+  static constexpr int kMinLengthForSearchInC = 32;
 };
 
+void ArrayIncludesIndexofAssembler::SearchInCIfLong(
+    ExternalReference function, TNode<FixedArrayBase> elements,
+    TNode<Object> search_element, TNode<IntPtrT> array_length,
+    TVariable<IntPtrT>* index_var, Label* if_found, Label* if_not_found) {
+  Label call_c(this), done(this);
+  Branch(IntPtrGreaterThanOrEqual(IntPtrSub(array_length, index_var->value()),
+                                  IntPtrConstant(kMinLengthForSearchInC)),
+         &call_c, &done);
+
+  BIND(&call_c);
+  TNode<IntPtrT> result = UncheckedCast<IntPtrT>(CallCFunction(
+      ExternalConstant(function), MachineType::IntPtr(),
+      std::make_pair(MachineType::AnyTagged(), elements),
+      std::make_pair(MachineType::UintPtr(), array_length),
+      std::make_pair(MachineType::UintPtr(), index_var->value()),
+      std::make_pair(MachineType::AnyTagged(), search_element)));
+  GotoIf(IntPtrLessThan(result, IntPtrConstant(0)), if_not_found);
+  *index_var = result;
+  Goto(if_found);
+
+  BIND(&done);
+}
+
 void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
                                              TNode<IntPtrT> argc,
                                              TNode<Context> context) {
@@ -656,7 +692,8 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   GotoIf(IntPtrGreaterThanOrEqual(index_var.value(), array_length_untagged),
          &return_not_found);
 
-  Label if_smiorobjects(this), if_packed_doubles(this), if_holey_doubles(this);
+  Label if_smis(this), if_smiorobjects(this), if_packed_doubles(this),
+      if_holey_doubles(this), return_found(this);
 
   TNode<Int32T> elements_kind = LoadElementsKind(array);
   TNode<FixedArrayBase> elements = LoadElements(array);
@@ -664,6 +701,8 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
   STATIC_ASSERT(HOLEY_SMI_ELEMENTS == 1);
   STATIC_ASSERT(PACKED_ELEMENTS == 2);
   STATIC_ASSERT(HOLEY_ELEMENTS == 3);
+  GotoIf(IsElementsKindLessThanOrEqual(elements_kind, HOLEY_SMI_ELEMENTS),
+         &if_smis);
   GotoIf(IsElementsKindLessThanOrEqual(elements_kind, HOLEY_ELEMENTS),
          &if_smiorobjects);
   GotoIf(
@@ -676,6 +715,17 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
          &if_smiorobjects);
   Goto(&return_not_found);
 
+  BIND(&if_smis);
+  {
+    // Smi elements are equal to a Smi exactly if they are identical, and
+    // the hole never is.
+    GotoIfNot(TaggedIsSmi(search_element), &if_smiorobjects);
+    SearchInCIfLong(ExternalReference::array_indexof_includes_smi_or_object(),
+                    elements, search_element, array_length_untagged,
+                    &index_var, &return_found, &return_not_found);
+    Goto(&if_smiorobjects);
+  }
+
   BIND(&if_smiorobjects);
   {
     Callable callable =
@@ -715,6 +765,13 @@ void ArrayIncludesIndexofAssembler::Generate(SearchVariant variant,
     args.PopAndReturn(result);
   }
 
+  BIND(&return_found);
+  if (variant == kIncludes) {
+    args.PopAndReturn(TrueConstant());
+  } else {
+    args.PopAndReturn(SmiTag(index_var.value()));
+  }
+
   BIND(&return_not_found);
   if (variant == kIncludes) {
     args.PopAndReturn(FalseConstant());
@@ -763,6 +820,9 @@ void ArrayIncludesIndexofAssembler::GenerateSmiOrObject(
   TNode<Uint16T> search_type = LoadMapInstanceType(map);
   GotoIf(IsStringInstanceType(search_type), &string_loop);
   GotoIf(IsBigIntInstanceType(search_type), &bigint_loop);
+  SearchInCIfLong(ExternalReference::array_indexof_includes_smi_or_object(),
+                  elements, search_element, array_length_untagged, &index_var,
+                  &return_found, &return_not_found);
   Goto(&ident_loop);
 
   BIND(&ident_loop);
@@ -914,14 +974,14 @@ void ArrayIncludesIndexofAssembler::GeneratePackedDoubles(
   TNode<IntPtrT> array_length_untagged = SmiUntag(array_length);
 
   Label nan_loop(this, &index_var), not_nan_loop(this, &index_var),
-      hole_loop(this, &index_var), search_notnan(this), return_found(this),
-      return_not_found(this);
+      hole_loop(this, &index_var), search_notnan(this), not_nan_search(this),
+      return_found(this), return_not_found(this);
   TVARIABLE(Float64T, search_num);
   search_num = Float64Constant(0);
 
   GotoIfNot(TaggedIsSmi(search_element), &search_notnan);
   search_num = SmiToFloat64(CAST(search_element));
-  Goto(&not_nan_loop);
+  Goto(&not_nan_search);
 
   BIND(&search_notnan);
   GotoIfNot(IsHeapNumber(CAST(search_element)), &return_not_found);
@@ -929,7 +989,13 @@ void ArrayIncludesIndexofAssembler::GeneratePackedDoubles(
   search_num = LoadHeapNumberValue(CAST(search_element));
 
   Label* nan_handling = variant == kIncludes ? &nan_loop : &return_not_found;
-  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_loop);
+  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_search);
+
+  BIND(&not_nan_search);
+  SearchInCIfLong(ExternalReference::array_indexof_includes_double(), elements,
+                  search_element, array_length_untagged, &index_var,
+                  &return_found, &return_not_found);
+  Goto(&not_nan_loop);
 
   BIND(&not_nan_loop);
   {
@@ -982,14 +1048,14 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
   TNode<IntPtrT> array_length_untagged = SmiUntag(array_length);
 
   Label nan_loop(this, &index_var), not_nan_loop(this, &index_var),
-      hole_loop(this, &index_var), search_notnan(this), return_found(this),
-      return_not_found(this);
+      hole_loop(this, &index_var), search_notnan(this), not_nan_search(this),
+      return_found(this), return_not_found(this);
   TVARIABLE(Float64T, search_num);
   search_num = Float64Constant(0);
 
   GotoIfNot(TaggedIsSmi(search_element), &search_notnan);
   search_num = SmiToFloat64(CAST(search_element));
-  Goto(&not_nan_loop);
+  Goto(&not_nan_search);
 
   BIND(&search_notnan);
   if (variant == kIncludes) {
@@ -1000,7 +1066,13 @@ void ArrayIncludesIndexofAssembler::GenerateHoleyDoubles(
   search_num = LoadHeapNumberValue(CAST(search_element));
 
   Label* nan_handling = variant == kIncludes ? &nan_loop : &return_not_found;
-  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_loop);
+  BranchIfFloat64IsNaN(search_num.value(), nan_handling, &not_nan_search);
+
+  BIND(&not_nan_search);
+  SearchInCIfLong(ExternalReference::array_indexof_includes_double(), elements,
+                  search_element, array_length_untagged, &index_var,
+                  &return_found, &return_not_found);
+  Goto(&not_nan_loop);
 
   BIND(&not_nan_loop);
   {
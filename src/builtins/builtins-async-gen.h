@@ -62,6 +62,14 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                                TNode<SharedFunctionInfo> on_resolve_sfi,
                                TNode<SharedFunctionInfo> on_reject_sfi,
                                TNode<Oddball> is_predicted_as_caught);
+  // Awaits a {value} that is not a JSReceiver, when neither promise hooks nor
+  // the debugger can observe the wrapper promise.
+  void AwaitPrimitive(TNode<Context> context,
+                      TNode<JSGeneratorObject> generator, TNode<Object> value,
+                      TNode<SharedFunctionInfo> on_resolve_sfi);
+  void InitializeAwaitContext(TNode<NativeContext> native_context,
+                              TNode<Context> closure_context,
+                              TNode<JSGeneratorObject> generator);
 };
 
 }  // namespace internal
@@ -675,7 +675,9 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
                                              Label* entry_found,
                                              Label* not_found);
   TNode<IntPtrT> ComputeStringHash(TNode<String> string_key);
-  void SameValueZeroString(TNode<String> key_string,
+  // {key_hash} is the hash of {key_string}, as computed by
+  // ComputeStringHash.
+  void SameValueZeroString(TNode<String> key_string, TNode<IntPtrT> key_hash,
                            TNode<Object> candidate_key, Label* if_same,
                            Label* if_not_same);
 
@@ -1295,7 +1297,8 @@ void CollectionsBuiltinsAssembler::FindOrderedHashTableEntryForStringKey(
   FindOrderedHashTableEntry<CollectionType>(
       table, hash,
       [&](TNode<Object> other_key, Label* if_same, Label* if_not_same) {
-        SameValueZeroString(key_tagged, other_key, if_same, if_not_same);
+        SameValueZeroString(key_tagged, hash, other_key, if_same,
+                            if_not_same);
       },
       result, entry_found, not_found);
 }
@@ -1365,14 +1368,26 @@ TNode<IntPtrT> CollectionsBuiltinsAssembler::ComputeStringHash(
 }
 
 void CollectionsBuiltinsAssembler::SameValueZeroString(
-    TNode<String> key_string, TNode<Object> candidate_key, Label* if_same,
-    Label* if_not_same) {
+    TNode<String> key_string, TNode<IntPtrT> key_hash,
+    TNode<Object> candidate_key, Label* if_same, Label* if_not_same) {
   // If the candidate is not a string, the keys are not equal.
   GotoIf(TaggedIsSmi(candidate_key), if_not_same);
   GotoIfNot(IsString(CAST(candidate_key)), if_not_same);
-
+  TNode<String> candidate_string = CAST(candidate_key);
+  GotoIf(TaggedEqual(key_string, candidate_string), if_same);
+
+  // Equal strings have equal hashes. Keys in the table have their hash
+  // computed when they are added, so comparing hashes rejects most other
+  // strings in the bucket chain without calling StringEqual.
+  Label compare_contents(this);
+  const TNode<IntPtrT> candidate_hash = ChangeInt32ToIntPtr(
+      LoadNameHash(candidate_string, &compare_contents));
+  GotoIf(WordNotEqual(key_hash, candidate_hash), if_not_same);
+  Goto(&compare_contents);
+
+  BIND(&compare_contents);
   Branch(TaggedEqual(CallBuiltin(Builtins::kStringEqual, NoContextConstant(),
-                                 key_string, candidate_key),
+                                 key_string, candidate_string),
                      TrueConstant()),
          if_same, if_not_same);
 }
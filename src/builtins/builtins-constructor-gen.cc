@@ -139,16 +139,23 @@ TF_BUILTIN(FastNewClosure, ConstructorBuiltinsAssembler) {
 
   IncrementCounter(isolate()->counters()->fast_new_closure_total(), 1);
 
-  // Bump the closure counter encoded the {feedback_cell}s map.
+  // Bump the closure counter encoded the {feedback_cell}s map. Sites that
+  // create closures repeatedly are already in the many closures state, so
+  // check for that first and leave the transitions to the deferred code.
   {
     const TNode<Map> feedback_cell_map = LoadMap(feedback_cell);
-    Label no_closures(this), one_closure(this), cell_done(this);
+    Label not_many_closures(this, Label::kDeferred),
+        no_closures(this, Label::kDeferred),
+        one_closure(this, Label::kDeferred), cell_done(this);
 
+    Branch(IsManyClosuresCellMap(feedback_cell_map), &cell_done,
+           &not_many_closures);
+
+    BIND(&not_many_closures);
     GotoIf(IsNoClosuresCellMap(feedback_cell_map), &no_closures);
-    GotoIf(IsOneClosureCellMap(feedback_cell_map), &one_closure);
-    CSA_ASSERT(this, IsManyClosuresCellMap(feedback_cell_map),
-               feedback_cell_map, feedback_cell);
-    Goto(&cell_done);
+    CSA_ASSERT(this, IsOneClosureCellMap(feedback_cell_map), feedback_cell_map,
+               feedback_cell);
+    Goto(&one_closure);
 
     BIND(&no_closures);
     StoreMapNoWriteBarrier(feedback_cell, RootIndex::kOneClosureCellMap);
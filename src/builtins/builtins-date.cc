@@ -14,6 +14,7 @@
 #include "src/objects/intl-objects.h"
 #include "src/objects/js-date-time-format.h"
 #endif
+#include "src/strings/char-predicates-inl.h"
 #include "src/strings/string-stream.h"
 
 namespace v8 {
@@ -108,12 +109,59 @@ const char* kShortWeekDays[] = {"Sun", "Mon", "Tue", "Wed",
 const char* kShortMonths[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun",
                               "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
 
+// The format produced by Date.prototype.toISOString for years 0 to 9999.
+const char kISOStringPattern[] = "dddd-dd-ddTdd:dd:dd.dddZ";
+const int kISOStringLength = arraysize(kISOStringPattern) - 1;
+
+// Parses strings in exactly the format of kISOStringPattern without going
+// through the DateParser, which accepts them with the same result. Returns
+// false if the string has any other format, or if a field is out of range.
+template <typename Char>
+bool ParseISOString(Vector<const Char> str, double* result) {
+  if (str.length() != kISOStringLength) return false;
+  int fields[7] = {0};
+  int field = 0;
+  for (int i = 0; i < kISOStringLength; ++i) {
+    Char c = str[i];
+    if (kISOStringPattern[i] == 'd') {
+      if (!IsDecimalDigit(c)) return false;
+      fields[field] = fields[field] * 10 + (c - '0');
+    } else {
+      if (c != kISOStringPattern[i]) return false;
+      ++field;
+    }
+  }
+  int const year = fields[0];
+  int const month = fields[1];
+  int const day = fields[2];
+  int const hour = fields[3];
+  int const minute = fields[4];
+  int const second = fields[5];
+  int const millisecond = fields[6];
+  if (month < 1 || month > 12 || day < 1 || day > 31) return false;
+  if (minute > 59 || second > 59) return false;
+  // Allow 24:00:00.000, but no other time starting with 24.
+  if (hour > 24 || (hour == 24 && (minute | second | millisecond) != 0)) {
+    return false;
+  }
+  double const date = MakeDate(MakeDay(year, month - 1, day),
+                               MakeTime(hour, minute, second, millisecond));
+  *result = DateCache::TimeClip(date);
+  return true;
+}
+
 // ES6 section 20.3.1.16 Date Time String Format
 double ParseDateTimeString(Isolate* isolate, Handle<String> str) {
   str = String::Flatten(isolate, str);
   double out[DateParser::OUTPUT_SIZE];
   DisallowHeapAllocation no_gc;
   String::FlatContent str_content = str->GetFlatContent(no_gc);
+  double date;
+  if (str_content.IsOneByte()
+          ? ParseISOString(str_content.ToOneByteVector(), &date)
+          : ParseISOString(str_content.ToUC16Vector(), &date)) {
+    return date;
+  }
   bool result;
   if (str_content.IsOneByte()) {
     result = DateParser::Parse(isolate, str_content.ToOneByteVector(), out);
@@ -126,7 +174,7 @@ double ParseDateTimeString(Isolate* isolate, Handle<String> str) {
   double const time =
       MakeTime(out[DateParser::HOUR], out[DateParser::MINUTE],
                out[DateParser::SECOND], out[DateParser::MILLISECOND]);
-  double date = MakeDate(day, time);
+  date = MakeDate(day, time);
   if (std::isnan(out[DateParser::UTC_OFFSET])) {
     if (date >= -DateCache::kMaxTimeBeforeUTCInMs &&
         date <= DateCache::kMaxTimeBeforeUTCInMs) {
@@ -140,6 +188,17 @@ double ParseDateTimeString(Isolate* isolate, Handle<String> str) {
   return DateCache::TimeClip(date);
 }
 
+// Writes the non-negative |value| zero-padded to |digits| digits.
+char* WriteDigits(char* p, int value, int digits) {
+  DCHECK_LE(0, value);
+  for (int i = digits - 1; i >= 0; --i) {
+    p[i] = '0' + value % 10;
+    value /= 10;
+  }
+  DCHECK_EQ(0, value);
+  return p + digits;
+}
+
 enum ToDateStringMode { kDateOnly, kTimeOnly, kDateAndTime };
 
 using DateBuffer = base::SmallVector<char, 128>;
@@ -813,17 +872,29 @@ BUILTIN(DatePrototypeToISOString) {
   int year, month, day, weekday, hour, min, sec, ms;
   isolate->date_cache()->BreakDownTime(time_ms, &year, &month, &day, &weekday,
                                        &hour, &min, &sec, &ms);
-  char buffer[128];
+  // Write the digits directly, this is hot when serializing dates to JSON.
+  char buffer[kISOStringLength + 3 + 1];
+  char* p = buffer;
   if (year >= 0 && year <= 9999) {
-    SNPrintF(ArrayVector(buffer), "%04d-%02d-%02dT%02d:%02d:%02d.%03dZ", year,
-             month + 1, day, hour, min, sec, ms);
-  } else if (year < 0) {
-    SNPrintF(ArrayVector(buffer), "-%06d-%02d-%02dT%02d:%02d:%02d.%03dZ", -year,
-             month + 1, day, hour, min, sec, ms);
+    p = WriteDigits(p, year, 4);
   } else {
-    SNPrintF(ArrayVector(buffer), "+%06d-%02d-%02dT%02d:%02d:%02d.%03dZ", year,
-             month + 1, day, hour, min, sec, ms);
+    *p++ = year < 0 ? '-' : '+';
+    p = WriteDigits(p, std::abs(year), 6);
   }
+  *p++ = '-';
+  p = WriteDigits(p, month + 1, 2);
+  *p++ = '-';
+  p = WriteDigits(p, day, 2);
+  *p++ = 'T';
+  p = WriteDigits(p, hour, 2);
+  *p++ = ':';
+  p = WriteDigits(p, min, 2);
+  *p++ = ':';
+  p = WriteDigits(p, sec, 2);
+  *p++ = '.';
+  p = WriteDigits(p, ms, 3);
+  *p++ = 'Z';
+  *p = '\0';
   return *isolate->factory()->NewStringFromAsciiChecked(buffer);
 }
 
@@ -552,6 +552,8 @@ namespace internal {
   TFH(StoreGlobalICTrampoline, StoreGlobal)                                    \
   TFH(StoreIC, StoreWithVector)                                                \
   TFH(StoreICTrampoline, Store)                                                \
+  TFH(StoreOwnIC, StoreWithVector)                                             \
+  TFH(StoreOwnICTrampoline, Store)                                             \
   TFH(KeyedStoreIC, StoreWithVector)                                           \
   TFH(KeyedStoreICTrampoline, Store)                                           \
   TFH(StoreInArrayLiteralIC, StoreWithVector)                                  \
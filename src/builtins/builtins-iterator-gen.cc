@@ -295,18 +295,26 @@ TF_BUILTIN(StringListFromIterable, IteratorBuiltinsAssembler) {
 // an actual iteration, where holes should be replaced with undefined (if the
 // prototype has no elements). To maintain the correct behavior for holey
 // arrays, use the builtins IterableToList or IterableToListWithSymbolLookup.
+// Primitive strings, sets and set iterators, and map iterators take the same
+// fast paths as in IterableToListWithSymbolLookup, which copy the entries
+// without allocating an iterator result object per entry.
 TF_BUILTIN(IterableToListMayPreserveHoles, IteratorBuiltinsAssembler) {
   TNode<Context> context = CAST(Parameter(Descriptor::kContext));
   TNode<Object> iterable = CAST(Parameter(Descriptor::kIterable));
   TNode<Object> iterator_fn = CAST(Parameter(Descriptor::kIteratorFn));
 
-  Label slow_path(this);
+  Label check_other_iterables(this), slow_path(this);
 
-  GotoIfNot(IsFastJSArrayWithNoCustomIteration(context, iterable), &slow_path);
+  GotoIfNot(IsFastJSArrayWithNoCustomIteration(context, iterable),
+            &check_other_iterables);
 
   // The fast path will copy holes to the new array.
   TailCallBuiltin(Builtins::kCloneFastJSArray, context, iterable);
 
+  BIND(&check_other_iterables);
+  GotoIfForceSlowPath(&slow_path);
+  Return(FastIterableToList(context, iterable, &slow_path));
+
   BIND(&slow_path);
   TailCallBuiltin(Builtins::kIterableToList, context, iterable, iterator_fn);
 }
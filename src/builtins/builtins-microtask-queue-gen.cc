@@ -482,6 +482,25 @@ void MicrotaskQueueBuiltinsAssembler::RunPromiseHook(
 
         [=] { return promise_or_capability; });
     GotoIf(IsUndefined(promise), &done_hook);
+
+    // Call the JS hook of the native context, if any, without going through
+    // the runtime.
+    Label context_hook_done(this), call_runtime(this);
+    GotoIfNot(IsJSPromise(promise), &context_hook_done);
+    if (id == Runtime::kPromiseHookBefore) {
+      RunContextPromiseHookBefore(context, CAST(promise));
+    } else {
+      DCHECK_EQ(Runtime::kPromiseHookAfter, id);
+      RunContextPromiseHookAfter(context, CAST(promise));
+    }
+    Goto(&context_hook_done);
+
+    BIND(&context_hook_done);
+    GotoIf(IsPromiseHookEnabled(), &call_runtime);
+    GotoIf(HasAsyncEventDelegate(), &call_runtime);
+    Branch(IsDebugActive(), &call_runtime, &done_hook);
+
+    BIND(&call_runtime);
     CallRuntime(id, context, promise);
     Goto(&done_hook);
   }
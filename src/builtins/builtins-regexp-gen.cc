@@ -180,20 +180,20 @@ TNode<JSRegExpResult> RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
   TNode<IntPtrT> num_indices = SmiUntag(CAST(UnsafeLoadFixedArrayElement(
       match_info, RegExpMatchInfo::kNumberOfCapturesIndex)));
   TNode<Smi> num_results = SmiTag(WordShr(num_indices, 1));
-  TNode<Smi> start = CAST(UnsafeLoadFixedArrayElement(
+  TNode<Smi> match_start = CAST(UnsafeLoadFixedArrayElement(
       match_info, RegExpMatchInfo::kFirstCaptureIndex));
-  TNode<Smi> end = CAST(UnsafeLoadFixedArrayElement(
+  TNode<Smi> match_end = CAST(UnsafeLoadFixedArrayElement(
       match_info, RegExpMatchInfo::kFirstCaptureIndex + 1));
 
   // Calculate the substring of the first match before creating the result array
   // to avoid an unnecessary write barrier storing the first result.
 
-  TNode<String> first =
-      CAST(CallBuiltin(Builtins::kSubString, context, string, start, end));
+  TNode<String> first = CAST(CallBuiltin(Builtins::kSubString, context, string,
+                                         match_start, match_end));
 
   TNode<FixedArray> result_elements;
   TNode<JSRegExpResult> result =
-      AllocateRegExpResult(context, num_results, start, string, regexp,
+      AllocateRegExpResult(context, num_results, match_start, string, regexp,
                            last_index, &result_elements);
 
   UnsafeStoreFixedArrayElement(result_elements, 0, first);
@@ -227,6 +227,17 @@ TNode<JSRegExpResult> RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
     TNode<Smi> end =
         CAST(UnsafeLoadFixedArrayElement(match_info, from_cursor_plus1));
 
+    // Captures spanning the whole match, as in /(\w+)/, share its string
+    // instead of allocating an identical substring.
+    Label store_first(this), store_substring(this);
+    GotoIfNot(SmiEqual(start, match_start), &store_substring);
+    Branch(SmiEqual(end, match_end), &store_first, &store_substring);
+
+    BIND(&store_first);
+    UnsafeStoreFixedArrayElement(result_elements, to_cursor, first);
+    Goto(&next_iter);
+
+    BIND(&store_substring);
     TNode<String> capture =
         CAST(CallBuiltin(Builtins::kSubString, context, string, start, end));
     UnsafeStoreFixedArrayElement(result_elements, to_cursor, capture);
@@ -250,10 +261,14 @@ TNode<JSRegExpResult> RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
         CAST(LoadObjectField(regexp, JSRegExp::kDataOffset));
 
     // We reach this point only if captures exist, implying that this is an
-    // IRREGEXP JSRegExp.
-    CSA_ASSERT(this,
-               SmiEqual(CAST(LoadFixedArrayElement(data, JSRegExp::kTagIndex)),
-                        SmiConstant(JSRegExp::IRREGEXP)));
+    // IRREGEXP or EXPERIMENTAL JSRegExp.
+    CSA_ASSERT(
+        this,
+        Word32Or(
+            SmiEqual(CAST(LoadFixedArrayElement(data, JSRegExp::kTagIndex)),
+                     SmiConstant(JSRegExp::IRREGEXP)),
+            SmiEqual(CAST(LoadFixedArrayElement(data, JSRegExp::kTagIndex)),
+                     SmiConstant(JSRegExp::EXPERIMENTAL))));
 
     // The names fixed array associates names at even indices with a capture
     // index at odd indices.
@@ -396,12 +411,14 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
       TNode<Int32T> tag = LoadAndUntagToWord32FixedArrayElement(
           data, IntPtrConstant(JSRegExp::kTagIndex));
 
+      // Experimental regexps are executed in the runtime.
       int32_t values[] = {
           JSRegExp::IRREGEXP,
           JSRegExp::ATOM,
           JSRegExp::NOT_COMPILED,
+          JSRegExp::EXPERIMENTAL,
       };
-      Label* labels[] = {&next, &atom, &runtime};
+      Label* labels[] = {&next, &atom, &runtime, &runtime};
 
       STATIC_ASSERT(arraysize(values) == arraysize(labels));
       Switch(tag, &unreachable, values, labels, arraysize(values));
@@ -585,8 +602,16 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
                        IntPtrConstant(RegExp::kInternalRegExpException)),
            &if_exception);
 
-    CSA_ASSERT(this, IntPtrEqual(int_result,
-                                 IntPtrConstant(RegExp::kInternalRegExpRetry)));
+    // The runtime re-executes the regexp on the experimental engine if the
+    // generated code gave up after excessive backtracking.
+    CSA_ASSERT(
+        this,
+        Word32Or(
+            IntPtrEqual(int_result,
+                        IntPtrConstant(RegExp::kInternalRegExpRetry)),
+            IntPtrEqual(int_result,
+                        IntPtrConstant(
+                            RegExp::kInternalRegExpFallbackToExperimental))));
     Goto(&runtime);
   }
 
@@ -908,6 +933,7 @@ TNode<String> RegExpBuiltinsAssembler::FlagsGetter(TNode<Context> context,
 
     CASE_FOR_FLAG(JSRegExp::kGlobal);
     CASE_FOR_FLAG(JSRegExp::kIgnoreCase);
+    CASE_FOR_FLAG(JSRegExp::kLinear);
     CASE_FOR_FLAG(JSRegExp::kMultiline);
     CASE_FOR_FLAG(JSRegExp::kDotAll);
     CASE_FOR_FLAG(JSRegExp::kUnicode);
@@ -935,6 +961,21 @@ TNode<String> RegExpBuiltinsAssembler::FlagsGetter(TNode<Context> context,
 
     CASE_FOR_FLAG("global", JSRegExp::kGlobal);
     CASE_FOR_FLAG("ignoreCase", JSRegExp::kIgnoreCase);
+    {
+      // The linear flag is only observable with
+      // --enable-experimental-regexp-engine.
+      Label skip_linear(this);
+      const ExternalReference flag_address =
+          ExternalReference::address_of_enable_experimental_regexp_engine();
+      TNode<Word32T> flag_value = UncheckedCast<Word32T>(
+          Load(MachineType::Uint8(), ExternalConstant(flag_address)));
+      GotoIf(Word32Equal(Word32And(flag_value, Int32Constant(0xFF)),
+                         Int32Constant(0)),
+             &skip_linear);
+      CASE_FOR_FLAG("linear", JSRegExp::kLinear);
+      Goto(&skip_linear);
+      BIND(&skip_linear);
+    }
     CASE_FOR_FLAG("multiline", JSRegExp::kMultiline);
     CASE_FOR_FLAG("dotAll", JSRegExp::kDotAll);
     CASE_FOR_FLAG("unicode", JSRegExp::kUnicode);
@@ -965,6 +1006,7 @@ TNode<String> RegExpBuiltinsAssembler::FlagsGetter(TNode<Context> context,
 
     CASE_FOR_FLAG(JSRegExp::kGlobal, 'g');
     CASE_FOR_FLAG(JSRegExp::kIgnoreCase, 'i');
+    CASE_FOR_FLAG(JSRegExp::kLinear, 'l');
     CASE_FOR_FLAG(JSRegExp::kMultiline, 'm');
     CASE_FOR_FLAG(JSRegExp::kDotAll, 's');
     CASE_FOR_FLAG(JSRegExp::kUnicode, 'u');
@@ -1197,6 +1239,9 @@ TNode<BoolT> RegExpBuiltinsAssembler::SlowFlagGetter(TNode<Context> context,
     case JSRegExp::kDotAll:
       UNREACHABLE();  // Never called for dotAll.
       break;
+    case JSRegExp::kLinear:
+      name = isolate()->factory()->linear_string();
+      break;
     case JSRegExp::kSticky:
       name = isolate()->factory()->sticky_string();
       break;
@@ -33,14 +33,15 @@ void TypedArrayBuiltinsAssembler::SetupTypedArrayEmbedderFields(
 // elements.
 // TODO(bmeurer,v8:4153): Rename this and maybe fix up the implementation a bit.
 TNode<JSArrayBuffer> TypedArrayBuiltinsAssembler::AllocateEmptyOnHeapBuffer(
-    TNode<Context> context, TNode<UintPtrT> byte_length) {
+    TNode<Context> context, TNode<UintPtrT> byte_length,
+    AllocationFlags flags) {
   TNode<NativeContext> native_context = LoadNativeContext(context);
   TNode<Map> map =
       CAST(LoadContextElement(native_context, Context::ARRAY_BUFFER_MAP_INDEX));
   TNode<FixedArray> empty_fixed_array = EmptyFixedArrayConstant();
 
   TNode<JSArrayBuffer> buffer = UncheckedCast<JSArrayBuffer>(
-      Allocate(JSArrayBuffer::kSizeWithEmbedderFields));
+      Allocate(JSArrayBuffer::kSizeWithEmbedderFields, flags));
   StoreMapNoWriteBarrier(buffer, map);
   StoreObjectFieldNoWriteBarrier(buffer, JSArray::kPropertiesOrHashOffset,
                                  empty_fixed_array);
@@ -79,6 +80,78 @@ TNode<JSArrayBuffer> TypedArrayBuiltinsAssembler::AllocateEmptyOnHeapBuffer(
   return buffer;
 }
 
+TNode<BoolT> TypedArrayBuiltinsAssembler::IsTypedArrayPretenuringFlag() {
+  TNode<Word32T> flag_value = UncheckedCast<Word32T>(Load(
+      MachineType::Uint8(),
+      ExternalConstant(
+          ExternalReference::address_of_typed_array_pretenuring_flag())));
+  return Word32NotEqual(Word32And(flag_value, Int32Constant(0xFF)),
+                        Int32Constant(0));
+}
+
+TNode<HeapObject> TypedArrayBuiltinsAssembler::LoadTypedArrayAllocationSite(
+    TNode<Context> context, TNode<Map> map) {
+  TVARIABLE(HeapObject, var_site, UndefinedConstant());
+  Label done(this), load_site(this);
+  GotoIfNot(IsTypedArrayPretenuringFlag(), &done);
+
+  TNode<NativeContext> native_context = LoadNativeContext(context);
+  TVARIABLE(Object, var_sites,
+            LoadContextElement(native_context,
+                               Context::TYPED_ARRAY_ALLOCATION_SITES_INDEX));
+  GotoIfNot(IsUndefined(var_sites.value()), &load_site);
+  var_sites = CallRuntime(Runtime::kCreateTypedArrayAllocationSites, context);
+  Goto(&load_site);
+
+  BIND(&load_site);
+  TNode<IntPtrT> index =
+      IntPtrSub(ChangeInt32ToIntPtr(LoadMapElementsKind(map)),
+                IntPtrConstant(FIRST_FIXED_TYPED_ARRAY_ELEMENTS_KIND));
+  var_site = CAST(LoadFixedArrayElement(CAST(var_sites.value()), index));
+  Goto(&done);
+
+  BIND(&done);
+  return var_site.value();
+}
+
+TNode<BoolT> TypedArrayBuiltinsAssembler::IsPretenuredAllocationSite(
+    TNode<AllocationSite> site) {
+  TNode<Int32T> pretenure_data =
+      LoadObjectField<Int32T>(site, AllocationSite::kPretenureDataOffset);
+  TNode<Uint32T> decision =
+      DecodeWord32<AllocationSite::PretenureDecisionBits>(pretenure_data);
+  return Word32Equal(decision, Int32Constant(AllocationSite::kTenure));
+}
+
+TNode<JSTypedArray> TypedArrayBuiltinsAssembler::AllocateJSTypedArrayFromMap(
+    TNode<Map> map, TNode<AllocationSite> allocation_site) {
+  CSA_ASSERT(this, Word32BinaryNot(IsDictionaryMap(map)));
+  TNode<IntPtrT> instance_size =
+      TimesTaggedSize(LoadMapInstanceSizeInWords(map));
+  TVARIABLE(HeapObject, var_object);
+  Label pretenured(this), young(this), initialize(this);
+  Branch(IsPretenuredAllocationSite(allocation_site), &pretenured, &young);
+
+  BIND(&pretenured);
+  var_object = Allocate(instance_size, kPretenured);
+  Goto(&initialize);
+
+  BIND(&young);
+  {
+    TNode<HeapObject> object = Allocate(
+        IntPtrAdd(instance_size, IntPtrConstant(AllocationMemento::kSize)));
+    InitializeAllocationMemento(object, instance_size, allocation_site);
+    var_object = object;
+    Goto(&initialize);
+  }
+
+  BIND(&initialize);
+  StoreMapNoWriteBarrier(var_object.value(), map);
+  InitializeJSObjectFromMap(var_object.value(), map, instance_size,
+                            base::nullopt, base::nullopt, kWithSlackTracking);
+  return UncheckedCast<JSTypedArray>(var_object.value());
+}
+
 TF_BUILTIN(TypedArrayBaseConstructor, TypedArrayBuiltinsAssembler) {
   TNode<Context> context = CAST(Parameter(Descriptor::kContext));
   ThrowTypeError(context, MessageTemplate::kConstructAbstractClass,
@@ -21,11 +21,26 @@ class TypedArrayBuiltinsAssembler : public CodeStubAssembler {
                     TNode<Map> map, TNode<Smi> length,
                     TNode<UintPtrT> byte_offset);
 
-  TNode<JSArrayBuffer> AllocateEmptyOnHeapBuffer(TNode<Context> context,
-                                                 TNode<UintPtrT> byte_length);
+  TNode<JSArrayBuffer> AllocateEmptyOnHeapBuffer(
+      TNode<Context> context, TNode<UintPtrT> byte_length,
+      AllocationFlags flags = kNone);
+
+  // Returns the allocation site that collects pretenuring feedback for
+  // typed arrays with the given map, or undefined if typed arrays are not
+  // pretenured, see --typed-array-pretenuring.
+  TNode<HeapObject> LoadTypedArrayAllocationSite(TNode<Context> context,
+                                                 TNode<Map> map);
+  TNode<BoolT> IsPretenuredAllocationSite(TNode<AllocationSite> site);
+
+  // Allocates a JSTypedArray for the given fast map, either in old space if
+  // |allocation_site| requests pretenuring, or in new space followed by an
+  // AllocationMemento.
+  TNode<JSTypedArray> AllocateJSTypedArrayFromMap(
+      TNode<Map> map, TNode<AllocationSite> allocation_site);
 
   TNode<Map> LoadMapForType(TNode<JSTypedArray> array);
   TNode<BoolT> IsMockArrayBufferAllocatorFlag();
+  TNode<BoolT> IsTypedArrayPretenuringFlag();
   TNode<UintPtrT> CalculateExternalPointer(TNode<UintPtrT> backing_store,
                                            TNode<UintPtrT> byte_offset);
 
@@ -38,17 +38,12 @@ class ProfileDataFromFileInternal : public ProfileDataFromFile {
   bool hash_has_value_ = false;
 };
 
-const std::unordered_map<std::string, ProfileDataFromFileInternal>&
-EnsureInitProfileData() {
-  static base::LeakyObject<
-      std::unordered_map<std::string, ProfileDataFromFileInternal>>
-      data;
-  static bool initialized = false;
+using ProfileDataMap =
+    std::unordered_map<std::string, ProfileDataFromFileInternal>;
 
-  if (initialized) return *data.get();
-  initialized = true;
+void ReadProfileData(ProfileDataMap* data) {
   const char* filename = FLAG_turbo_profiling_log_file;
-  if (filename == nullptr) return *data.get();
+  if (filename == nullptr) return;
   std::ifstream file(filename);
   CHECK_WITH_MSG(file.good(), "Can't read log file");
   for (std::string line; std::getline(file, line);) {
@@ -69,8 +64,7 @@ EnsureInitProfileData() {
       CHECK(line_stream.eof());
       uint32_t count = static_cast<uint32_t>(strtoul(token.c_str(), &end, 0));
       CHECK(errno == 0 && end != token.c_str());
-      ProfileDataFromFileInternal& counters_and_hash =
-          (*data.get())[builtin_name];
+      ProfileDataFromFileInternal& counters_and_hash = (*data)[builtin_name];
       // We allow concatenating data from several Isolates, so we might see the
       // same block multiple times. Just sum them all.
       counters_and_hash.AddCountToBlock(id, count);
@@ -85,8 +79,7 @@ EnsureInitProfileData() {
       char* end = nullptr;
       int hash = static_cast<int>(strtol(token.c_str(), &end, 0));
       CHECK(errno == 0 && end != token.c_str());
-      ProfileDataFromFileInternal& counters_and_hash =
-          (*data.get())[builtin_name];
+      ProfileDataFromFileInternal& counters_and_hash = (*data)[builtin_name];
       // We allow concatenating data from several Isolates, but expect them all
       // to be running the same build. Any file with mismatched hashes for a
       // function is considered ill-formed.
@@ -95,17 +88,25 @@ EnsureInitProfileData() {
       counters_and_hash.set_hash(hash);
     }
   }
-  for (const auto& pair : *data.get()) {
+  for (const auto& pair : *data) {
     // Every function is required to have a hash in the log.
     CHECK(pair.second.hash_has_value());
   }
-  if (data.get()->size() == 0) {
+  if (data->size() == 0) {
     PrintF(
         "No basic block counters were found in log file.\n"
         "Did you build with v8_enable_builtins_profiling=true\n"
         "and run with --turbo-profiling-log-builtins?\n");
   }
+}
 
+const ProfileDataMap& EnsureInitProfileData() {
+  // Optimized JavaScript functions may look up profile data from background
+  // compile threads, so the file is read exactly once under the static
+  // initialization guard.
+  static base::LeakyObject<ProfileDataMap> data;
+  static const bool initialized = (ReadProfileData(data.get()), true);
+  USE(initialized);
   return *data.get();
 }
 
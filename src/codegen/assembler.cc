@@ -72,6 +72,10 @@ AssemblerOptions AssemblerOptions::Default(Isolate* isolate) {
   const base::AddressRegion& code_range = isolate->heap()->code_range();
   DCHECK_IMPLIES(code_range.begin() != kNullAddress, !code_range.is_empty());
   options.code_range_start = code_range.begin();
+#endif
+#if V8_TARGET_ARCH_X64
+  options.short_builtin_calls = isolate->is_short_builtin_calls_enabled() &&
+                                !serializer && !generating_embedded_builtin;
 #endif
   return options;
 }
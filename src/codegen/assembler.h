@@ -176,6 +176,10 @@ struct V8_EXPORT_PRIVATE AssemblerOptions {
   // this flag, the code range must be small enough to fit all offsets into
   // the instruction immediates.
   bool use_pc_relative_calls_and_jumps = false;
+  // Call and jump to embedded builtins pc-relative instead of through a
+  // register. Only valid if the code range can reach the embedded blob and
+  // the code does not survive the process.
+  bool short_builtin_calls = false;
   // Enables the collection of information useful for the generation of unwind
   // info. This is useful in some platform (Win64) where the unwind info depends
   // on a function prologue/epilogue.
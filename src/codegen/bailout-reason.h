@@ -92,6 +92,7 @@ namespace internal {
   V(kCodeGenerationFailed, "Code generation failed")                        \
   V(kCyclicObjectStateDetectedInEscapeAnalysis,                             \
     "Cyclic object state detected by escape analysis")                      \
+  V(kDeoptimizationLoop, "Optimized code deoptimized too often")            \
   V(kFunctionBeingDebugged, "Function is being debugged")                   \
   V(kGraphBuildingFailed, "Optimized graph construction failed")            \
   V(kFunctionTooBig, "Function is too big to be optimized")                 \
@@ -86,15 +86,11 @@ Callable CodeFactory::LoadGlobalICInOptimizedCode(Isolate* isolate,
 }
 
 Callable CodeFactory::StoreOwnIC(Isolate* isolate) {
-  // TODO(ishell): Currently we use StoreOwnIC only for storing properties that
-  // already exist in the boilerplate therefore we can use StoreIC.
-  return Builtins::CallableFor(isolate, Builtins::kStoreICTrampoline);
+  return Builtins::CallableFor(isolate, Builtins::kStoreOwnICTrampoline);
 }
 
 Callable CodeFactory::StoreOwnICInOptimizedCode(Isolate* isolate) {
-  // TODO(ishell): Currently we use StoreOwnIC only for storing properties that
-  // already exist in the boilerplate therefore we can use StoreIC.
-  return Builtins::CallableFor(isolate, Builtins::kStoreIC);
+  return Builtins::CallableFor(isolate, Builtins::kStoreOwnIC);
 }
 
 Callable CodeFactory::KeyedStoreIC_SloppyArguments(Isolate* isolate,
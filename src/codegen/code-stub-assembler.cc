@@ -3353,7 +3353,7 @@ CodeStubAssembler::AllocateOrderedHashTable<OrderedHashSet>();
 
 TNode<JSObject> CodeStubAssembler::AllocateJSObjectFromMap(
     TNode<Map> map, base::Optional<TNode<HeapObject>> properties,
-    base::Optional<TNode<FixedArray>> elements, AllocationFlags flags,
+    base::Optional<TNode<FixedArrayBase>> elements, AllocationFlags flags,
     SlackTrackingMode slack_tracking_mode) {
   CSA_ASSERT(this, IsMap(map));
   CSA_ASSERT(this, Word32BinaryNot(IsJSFunctionMap(map)));
@@ -3371,7 +3371,7 @@ TNode<JSObject> CodeStubAssembler::AllocateJSObjectFromMap(
 void CodeStubAssembler::InitializeJSObjectFromMap(
     TNode<HeapObject> object, TNode<Map> map, TNode<IntPtrT> instance_size,
     base::Optional<TNode<HeapObject>> properties,
-    base::Optional<TNode<FixedArray>> elements,
+    base::Optional<TNode<FixedArrayBase>> elements,
     SlackTrackingMode slack_tracking_mode) {
   CSA_SLOW_ASSERT(this, IsMap(map));
   // This helper assumes that the object is in new-space, as guarded by the
@@ -12759,6 +12759,12 @@ TNode<BoolT> CodeStubAssembler::
                         Int32Constant(0));
 }
 
+TNode<BoolT> CodeStubAssembler::IsContextPromiseHookEnabled() {
+  const TNode<Uint8T> has_context_promise_hooks = Load<Uint8T>(ExternalConstant(
+      ExternalReference::has_context_promise_hooks_address(isolate())));
+  return Word32NotEqual(has_context_promise_hooks, Int32Constant(0));
+}
+
 TNode<Code> CodeStubAssembler::LoadBuiltin(TNode<Smi> builtin_id) {
   CSA_ASSERT(this, SmiBelow(builtin_id, SmiConstant(Builtins::builtin_count)));
 
@@ -1790,14 +1790,14 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
   TNode<JSObject> AllocateJSObjectFromMap(
       TNode<Map> map,
       base::Optional<TNode<HeapObject>> properties = base::nullopt,
-      base::Optional<TNode<FixedArray>> elements = base::nullopt,
+      base::Optional<TNode<FixedArrayBase>> elements = base::nullopt,
       AllocationFlags flags = kNone,
       SlackTrackingMode slack_tracking_mode = kNoSlackTracking);
 
   void InitializeJSObjectFromMap(
       TNode<HeapObject> object, TNode<Map> map, TNode<IntPtrT> instance_size,
       base::Optional<TNode<HeapObject>> properties = base::nullopt,
-      base::Optional<TNode<FixedArray>> elements = base::nullopt,
+      base::Optional<TNode<FixedArrayBase>> elements = base::nullopt,
       SlackTrackingMode slack_tracking_mode = kNoSlackTracking);
 
   void InitializeJSObjectBodyWithSlackTracking(
@@ -3523,6 +3523,9 @@ class V8_EXPORT_PRIVATE CodeStubAssembler
   TNode<BoolT> HasAsyncEventDelegate();
   TNode<BoolT> IsPromiseHookEnabledOrHasAsyncEventDelegate();
   TNode<BoolT> IsPromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate();
+  // Whether any native context has JS promise hooks. The combined predicates
+  // above include this, so that the fast paths are left.
+  TNode<BoolT> IsContextPromiseHookEnabled();
 
   // for..in helpers
   void CheckPrototypeEnumCache(TNode<JSReceiver> receiver,
@@ -92,6 +92,34 @@ void CompilationSubCache::Clear() {
                 generations());
 }
 
+size_t CompilationSubCache::SourceSize() {
+  HandleScope scope(isolate());
+  return GetFirstTable()->SourceSize();
+}
+
+int CompilationSubCache::NextUse() {
+  // Rather than renumbering the entries, start over with an empty cache once
+  // the stamps run out.
+  if (next_use_ == Smi::kMaxValue) {
+    Clear();
+    next_use_ = 0;
+  }
+  return next_use_++;
+}
+
+void CompilationSubCache::EvictToSizeLimit(Handle<CompilationCacheTable> table,
+                                           size_t max_size) {
+  if (max_size == 0) return;
+  max_size *= KB;
+  size_t size = table->SourceSize();
+  while (size > max_size) {
+    size_t removed = table->RemoveLeastRecentlyUsed();
+    if (removed == 0) break;
+    size -= removed;
+    evictions_++;
+  }
+}
+
 void CompilationSubCache::Remove(Handle<SharedFunctionInfo> function_info) {
   // Probe the script generation tables. Make sure not to leak handles
   // into the caller's handle scope.
@@ -152,9 +180,10 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheScript::Lookup(
     HandleScope scope(isolate());
     const int generation = 0;
     DCHECK_EQ(generations(), 1);
+    int last_use = NextUse();
     Handle<CompilationCacheTable> table = GetTable(generation);
     MaybeHandle<SharedFunctionInfo> probe = CompilationCacheTable::LookupScript(
-        table, source, native_context, language_mode);
+        table, source, native_context, language_mode, last_use);
     Handle<SharedFunctionInfo> function_info;
     if (probe.ToHandle(&function_info)) {
       // Break when we've found a suitable shared function info that
@@ -178,9 +207,11 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheScript::Lookup(
                      resource_options));
 #endif
     isolate()->counters()->compilation_cache_hits()->Increment();
+    hits_++;
     LOG(isolate(), CompilationCacheEvent("hit", "script", *function_info));
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
+    misses_++;
   }
   return result;
 }
@@ -190,9 +221,12 @@ void CompilationCacheScript::Put(Handle<String> source,
                                  LanguageMode language_mode,
                                  Handle<SharedFunctionInfo> function_info) {
   HandleScope scope(isolate());
-  Handle<CompilationCacheTable> table = GetFirstTable();
-  SetFirstTable(CompilationCacheTable::PutScript(table, source, native_context,
-                                                 language_mode, function_info));
+  int last_use = NextUse();
+  Handle<CompilationCacheTable> table = CompilationCacheTable::PutScript(
+      GetFirstTable(), source, native_context, language_mode, function_info,
+      last_use);
+  SetFirstTable(table);
+  EvictToSizeLimit(table, FLAG_compilation_cache_script_max_size);
 }
 
 InfoCellPair CompilationCacheEval::Lookup(Handle<String> source,
@@ -207,13 +241,17 @@ InfoCellPair CompilationCacheEval::Lookup(Handle<String> source,
   InfoCellPair result;
   const int generation = 0;
   DCHECK_EQ(generations(), 1);
+  int last_use = NextUse();
   Handle<CompilationCacheTable> table = GetTable(generation);
-  result = CompilationCacheTable::LookupEval(
-      table, source, outer_info, native_context, language_mode, position);
+  result = CompilationCacheTable::LookupEval(table, source, outer_info,
+                                             native_context, language_mode,
+                                             position, last_use);
   if (result.has_shared()) {
     isolate()->counters()->compilation_cache_hits()->Increment();
+    hits_++;
   } else {
     isolate()->counters()->compilation_cache_misses()->Increment();
+    misses_++;
   }
   return result;
 }
@@ -225,11 +263,13 @@ void CompilationCacheEval::Put(Handle<String> source,
                                Handle<FeedbackCell> feedback_cell,
                                int position) {
   HandleScope scope(isolate());
+  int last_use = NextUse();
   Handle<CompilationCacheTable> table = GetFirstTable();
-  table =
-      CompilationCacheTable::PutEval(table, source, outer_info, function_info,
-                                     native_context, feedback_cell, position);
+  table = CompilationCacheTable::PutEval(table, source, outer_info,
+                                         function_info, native_context,
+                                         feedback_cell, position, last_use);
   SetFirstTable(table);
+  EvictToSizeLimit(table, FLAG_compilation_cache_eval_max_size);
 }
 
 MaybeHandle<FixedArray> CompilationCacheRegExp::Lookup(Handle<String> source,
@@ -60,6 +60,13 @@ class CompilationSubCache {
   // Number of generations in this sub-cache.
   int generations() const { return generations_; }
 
+  // Statistics of the script and eval sub-caches, reported to the embedder
+  // through v8::Isolate::GetCompilationCacheStatistics.
+  size_t hits() const { return hits_; }
+  size_t misses() const { return misses_; }
+  size_t evictions() const { return evictions_; }
+  size_t SourceSize();
+
  protected:
   Isolate* isolate() const { return isolate_; }
 
@@ -68,11 +75,24 @@ class CompilationSubCache {
   static void AgeByGeneration(CompilationSubCache* c);
   static void AgeCustom(CompilationSubCache* c);
 
+  // Returns the next last-use stamp for the LRU eviction of entries.
+  int NextUse();
+
+  // Evicts the least recently used entries until the sources kept alive by
+  // {table} fit into {max_size} KB. A {max_size} of 0 means unbounded.
+  void EvictToSizeLimit(Handle<CompilationCacheTable> table, size_t max_size);
+
+  size_t hits_ = 0;
+  size_t misses_ = 0;
+
  private:
   Isolate* const isolate_;
   const int generations_;
   Object tables_[kMaxGenerations];  // One for each generation.
 
+  int next_use_ = 0;
+  size_t evictions_ = 0;
+
   DISALLOW_IMPLICIT_CONSTRUCTORS(CompilationSubCache);
 };
 
@@ -114,6 +134,12 @@ class CompilationCacheScript : public CompilationSubCache {
 //    More specifically these are the CompileString, DebugEvaluate and
 //    DebugEvaluateGlobal runtime functions.
 // 4. The start position of the calling scope.
+// Indirect eval and CreateDynamicFunction compile in the native context with
+// the empty function as the calling function, so identical sources share one
+// entry across call sites. The empty function's shared function info is the
+// same in all native contexts created from the snapshot, which lets them share
+// entries too; feedback cells are kept per native context. Entries are evicted
+// least recently used first beyond --compilation-cache-eval-max-size.
 class CompilationCacheEval : public CompilationSubCache {
  public:
   explicit CompilationCacheEval(Isolate* isolate)
@@ -207,6 +233,10 @@ class V8_EXPORT_PRIVATE CompilationCache {
 
   MaybeHandle<Code> LookupCode(Handle<SharedFunctionInfo> sfi);
 
+  CompilationCacheScript* script_cache() { return &script_; }
+  CompilationCacheEval* eval_global_cache() { return &eval_global_; }
+  CompilationCacheEval* eval_contextual_cache() { return &eval_contextual_; }
+
   // Associate the (source, kind) pair to the shared function
   // info. This may overwrite an existing mapping.
   void PutScript(Handle<String> source, Handle<Context> native_context,
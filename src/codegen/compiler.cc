@@ -39,6 +39,7 @@
 #include "src/init/bootstrapper.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/log-inl.h"
+#include "src/logging/metrics.h"
 #include "src/objects/feedback-cell-inl.h"
 #include "src/objects/map.h"
 #include "src/objects/object-list-macros.h"
@@ -204,6 +205,12 @@ struct ScopedTimer {
 
 namespace {
 
+bool IsLoggingCodeCreation(Isolate* isolate) {
+  return isolate->logger()->is_listening_to_code_events() ||
+         isolate->is_profiling() || FLAG_log_function_events ||
+         isolate->code_event_dispatcher()->IsListeningToCodeEvents();
+}
+
 void LogFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
                             Handle<SharedFunctionInfo> shared,
                             Handle<Script> script,
@@ -215,11 +222,7 @@ void LogFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
   // Log the code generation. If source information is available include
   // script name and line number. Check explicitly whether logging is
   // enabled as finding the line number is not free.
-  if (!isolate->logger()->is_listening_to_code_events() &&
-      !isolate->is_profiling() && !FLAG_log_function_events &&
-      !isolate->code_event_dispatcher()->IsListeningToCodeEvents()) {
-    return;
-  }
+  if (!IsLoggingCodeCreation(isolate)) return;
 
   int line_num = Script::GetLineNumber(script, shared->StartPosition()) + 1;
   int column_num = Script::GetColumnNumber(script, shared->StartPosition()) + 1;
@@ -301,19 +304,19 @@ CompilationJob::Status UnoptimizedCompilationJob::FinalizeJob(
 
 namespace {
 
-void RecordUnoptimizedCompilationStats(Isolate* isolate,
-                                       Handle<SharedFunctionInfo> shared_info) {
-  int code_size;
-  if (shared_info->HasBytecodeArray()) {
-    code_size = shared_info->GetBytecodeArray().SizeIncludingMetadata();
-  } else {
-    code_size = shared_info->asm_wasm_data().Size();
+int UnoptimizedCodeSize(SharedFunctionInfo shared_info) {
+  if (shared_info.HasBytecodeArray()) {
+    return shared_info.GetBytecodeArray().SizeIncludingMetadata();
   }
+  return shared_info.asm_wasm_data().Size();
+}
 
+void RecordUnoptimizedCompilationStats(Isolate* isolate, int code_size,
+                                       int compile_count) {
   Counters* counters = isolate->counters();
   // TODO(4280): Rename counters from "baseline" to "unoptimized" eventually.
   counters->total_baseline_code_size()->Increment(code_size);
-  counters->total_baseline_compile_count()->Increment(1);
+  counters->total_baseline_compile_count()->Increment(compile_count);
 
   // TODO(5203): Add timers for each phase of compilation.
   // Also add total time (there's now already timer_ on the base class).
@@ -343,6 +346,40 @@ void RecordUnoptimizedFunctionCompilation(
 
 }  // namespace
 
+// ----------------------------------------------------------------------------
+// Implementation of FinalizeUnoptimizedCompilationData
+
+FinalizeUnoptimizedCompilationData::FinalizeUnoptimizedCompilationData(
+    Isolate* isolate, Handle<SharedFunctionInfo> function_handle,
+    base::TimeDelta time_taken_to_execute,
+    base::TimeDelta time_taken_to_finalize)
+    : time_taken_to_execute_(time_taken_to_execute),
+      time_taken_to_finalize_(time_taken_to_finalize),
+      code_size_(UnoptimizedCodeSize(*function_handle)),
+      function_handle_(function_handle),
+      handle_state_(kHandle) {}
+
+FinalizeUnoptimizedCompilationData::FinalizeUnoptimizedCompilationData(
+    OffThreadIsolate* isolate, Handle<SharedFunctionInfo> function_handle,
+    base::TimeDelta time_taken_to_execute,
+    base::TimeDelta time_taken_to_finalize)
+    : time_taken_to_execute_(time_taken_to_execute),
+      time_taken_to_finalize_(time_taken_to_finalize),
+      code_size_(UnoptimizedCodeSize(*function_handle)),
+      function_literal_id_(function_handle->function_literal_id()),
+      handle_state_(kFunctionLiteralId) {}
+
+MaybeHandle<SharedFunctionInfo>
+FinalizeUnoptimizedCompilationData::function_handle(
+    Isolate* isolate, Handle<Script> script) const {
+  switch (handle_state_) {
+    case kHandle:
+      return function_handle_;
+    case kFunctionLiteralId:
+      return script->FindSharedFunctionInfo(isolate, function_literal_id_);
+  }
+}
+
 // ----------------------------------------------------------------------------
 // Implementation of OptimizedCompilationJob
 
@@ -399,6 +436,23 @@ void OptimizedCompilationJob::RecordCompilationStats(CompilationMode mode,
   double ms_codegen = time_taken_to_finalize_.InMillisecondsF();
   CompilerTracer::TraceCompilationStats(
       isolate, compilation_info(), ms_creategraph, ms_optimize, ms_codegen);
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (recorder->HasEmbedderRecorder()) {
+    v8::metrics::OptimizedCompilationJobFinished event;
+    event.concurrent = mode == kConcurrent;
+    event.osr = compilation_info()->is_osr();
+    event.prepare_time_in_us = time_taken_to_prepare_.InMicroseconds();
+    event.execute_time_in_us = time_taken_to_execute_.InMicroseconds();
+    event.finalize_time_in_us = time_taken_to_finalize_.InMicroseconds();
+    event.queue_time_in_us =
+        (ElapsedTime() - time_taken_to_prepare_ - time_taken_to_execute_ -
+         time_taken_to_finalize_)
+            .InMicroseconds();
+    recorder->DelayMainThreadEvent(
+        event, isolate->GetOrRegisterRecorderContextId(
+                   handle(function->native_context(), isolate)));
+  }
   if (FLAG_trace_opt_stats) {
     static double compilation_time = 0.0;
     static int compiled_functions = 0;
@@ -599,7 +653,6 @@ void LogUnoptimizedCompilation(Isolate* isolate,
   RecordUnoptimizedFunctionCompilation(isolate, log_tag, shared_info,
                                        time_taken_to_execute,
                                        time_taken_to_finalize);
-  RecordUnoptimizedCompilationStats(isolate, shared_info);
 }
 
 template <typename LocalIsolate>
@@ -1011,6 +1064,13 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   Isolate* isolate = function->GetIsolate();
   Handle<SharedFunctionInfo> shared(function->shared(), isolate);
 
+  // While a concurrent job is running for the function, loops only pick up
+  // the code that is in the OSR code cache already.
+  if (!osr_offset.IsNone() && mode == ConcurrencyMode::kConcurrent &&
+      function->IsInOptimizationQueue()) {
+    return GetCodeFromOptimizedCodeCache(function, osr_offset);
+  }
+
   // Make sure we clear the optimization marker on the function so that we
   // don't try to re-optimize.
   if (function->HasOptimizationMarker()) {
@@ -1103,6 +1163,9 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
         function->SetOptimizationMarker(
             OptimizationMarker::kInOptimizationQueue);
       }
+      // The loop keeps running in the interpreter until the code for it shows
+      // up in the OSR code cache.
+      if (!osr_offset.IsNone()) return {};
       DCHECK(function->IsInterpreted() ||
              (!function->is_compiled() && function->shared().IsInterpreted()));
       DCHECK(function->shared().HasBytecodeArray());
@@ -1169,12 +1232,31 @@ void FinalizeUnoptimizedCompilation(
     compile_state->pending_error_handler()->ReportWarnings(isolate, script);
   }
 
+  int total_code_size = 0;
+  for (const auto& finalize_data : finalize_unoptimized_compilation_data_list) {
+    total_code_size += finalize_data.code_size();
+  }
+  RecordUnoptimizedCompilationStats(
+      isolate, total_code_size,
+      static_cast<int>(finalize_unoptimized_compilation_data_list.size()));
+
   bool need_source_positions = FLAG_stress_lazy_source_positions ||
                                (!flags.collect_source_positions() &&
                                 isolate->NeedsSourcePositionsForProfiling());
 
+  // Avoid touching every compiled function unless something needs to see them,
+  // so that e.g. finalizing a large streamed script stays cheap.
+  if (!need_source_positions && !FLAG_interpreted_frames_native_stack &&
+      !IsLoggingCodeCreation(isolate)) {
+    return;
+  }
+
   for (const auto& finalize_data : finalize_unoptimized_compilation_data_list) {
-    Handle<SharedFunctionInfo> shared_info = finalize_data.function_handle();
+    Handle<SharedFunctionInfo> shared_info;
+    if (!finalize_data.function_handle(isolate, script)
+             .ToHandle(&shared_info)) {
+      continue;
+    }
     // It's unlikely, but possible, that the bytecode was flushed between being
     // allocated and now, so guard against that case, and against it being
     // flushed in the middle of this loop.
@@ -1229,6 +1311,17 @@ void FinalizeUnoptimizedScriptCompilation(
   }
 }
 
+// Aborts the dispatcher jobs that parsing enqueued for a script which did not
+// get finalized, since no SharedFunctionInfo will ever be registered for them.
+void AbortParallelCompileTasks(const UnoptimizedCompileState* compile_state) {
+  UnoptimizedCompileState::ParallelTasks* parallel_tasks =
+      compile_state->parallel_tasks();
+  if (!parallel_tasks) return;
+  for (auto& it : *parallel_tasks) {
+    parallel_tasks->dispatcher()->AbortJob(it.second);
+  }
+}
+
 // Create shared function info for top level and shared function infos array for
 // inner functions.
 template <typename LocalIsolate>
@@ -1670,9 +1763,11 @@ bool Compiler::CollectSourcePositions(Isolate* isolate,
 }
 
 // static
-bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
-                       ClearExceptionFlag flag,
-                       IsCompiledScope* is_compiled_scope) {
+namespace {
+
+bool CompileLazy(Handle<SharedFunctionInfo> shared_info,
+                 Compiler::ClearExceptionFlag flag,
+                 IsCompiledScope* is_compiled_scope) {
   // We should never reach here if the function is already compiled.
   DCHECK(!shared_info->is_compiled());
   DCHECK(!is_compiled_scope->is_compiled());
@@ -1744,6 +1839,39 @@ bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
   return true;
 }
 
+}  // namespace
+
+// static
+bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
+                       ClearExceptionFlag flag,
+                       IsCompiledScope* is_compiled_scope) {
+  Isolate* isolate = shared_info->GetIsolate();
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (!recorder->HasEmbedderRecorder()) {
+    return CompileLazy(shared_info, flag, is_compiled_scope);
+  }
+
+  using Event = v8::metrics::JavaScriptFunctionCompiled;
+  Event event;
+  {
+    metrics::TimedScope<Event> timed_scope(&event,
+                                           &Event::wall_clock_time_in_us);
+    event.success = CompileLazy(shared_info, flag, is_compiled_scope);
+  }
+  if (event.success && shared_info->HasBytecodeArray()) {
+    event.bytecode_size_in_bytes = shared_info->GetBytecodeArray().length();
+  }
+  // Functions can also be compiled outside of any context, e.g. through the
+  // debugger.
+  v8::metrics::Recorder::ContextId context_id =
+      isolate->context().is_null()
+          ? v8::metrics::Recorder::ContextId::Empty()
+          : isolate->GetOrRegisterRecorderContextId(isolate->native_context());
+  recorder->DelayMainThreadEvent(event, context_id);
+  return event.success;
+}
+
 // static
 bool Compiler::Compile(Handle<JSFunction> function, ClearExceptionFlag flag,
                        IsCompiledScope* is_compiled_scope) {
@@ -2761,6 +2889,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
         task->language_mode());
     if (!maybe_result.is_null()) {
       compile_timer.set_hit_isolate_cache();
+      AbortParallelCompileTasks(task->compile_state());
     }
   }
 
@@ -2833,6 +2962,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
 
     Handle<SharedFunctionInfo> result;
     if (!maybe_result.ToHandle(&result)) {
+      AbortParallelCompileTasks(task->compile_state());
       FailWithPreparedPendingException(
           isolate, script, task->compile_state()->pending_error_handler());
     } else {
@@ -2912,8 +3042,17 @@ MaybeHandle<Code> Compiler::GetOptimizedCodeForOSR(Handle<JSFunction> function,
                                                    JavaScriptFrame* osr_frame) {
   DCHECK(!osr_offset.IsNone());
   DCHECK_NOT_NULL(osr_frame);
-  return GetOptimizedCode(function, ConcurrencyMode::kNotConcurrent,
-                          CompilationTarget::kTurbofan, osr_offset, osr_frame);
+  // The marker guarding against duplicate jobs shares its slot with the
+  // optimized code, so functions that have optimized code already, but still
+  // run a loop in the interpreter, compile for OSR synchronously.
+  Isolate* isolate = function->GetIsolate();
+  bool concurrent = FLAG_concurrent_osr &&
+                    isolate->concurrent_recompilation_enabled() &&
+                    !function->HasOptimizedCode();
+  ConcurrencyMode mode = concurrent ? ConcurrencyMode::kConcurrent
+                                    : ConcurrencyMode::kNotConcurrent;
+  return GetOptimizedCode(function, mode, CompilationTarget::kTurbofan,
+                          osr_offset, osr_frame);
 }
 
 // static
@@ -2932,8 +3071,9 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
 
   Handle<SharedFunctionInfo> shared = compilation_info->shared_info();
 
+  const bool is_osr = !compilation_info->osr_offset().IsNone();
   const bool should_install_code_on_function =
-      !IsForNativeContextIndependentCachingOnly(compilation_info);
+      !IsForNativeContextIndependentCachingOnly(compilation_info) && !is_osr;
   if (should_install_code_on_function) {
     // Reset profiler ticks, function is no longer considered hot.
     compilation_info->closure()->feedback_vector().set_profiler_ticks(0);
@@ -2959,6 +3099,14 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
       CompilerTracer::TraceCompletedJob(isolate, compilation_info);
       if (should_install_code_on_function) {
         compilation_info->closure()->set_code(*compilation_info->code());
+      } else if (is_osr) {
+        // The loop enters the code through the OSR code cache on its next
+        // iteration.
+        if (compilation_info->closure()->IsInOptimizationQueue()) {
+          compilation_info->closure()->ClearOptimizationMarker();
+        }
+        OSROptimizedCodeCache::ArmBackEdges(isolate, shared,
+                                            compilation_info->osr_offset());
       }
       return CompilationJob::SUCCEEDED;
     }
@@ -2974,6 +3122,43 @@ bool Compiler::FinalizeOptimizedCompilationJob(OptimizedCompilationJob* job,
   return CompilationJob::FAILED;
 }
 
+// static
+bool Compiler::InstallCachedCode(Handle<JSFunction> function,
+                                 IsCompiledScope* is_compiled_scope) {
+  Isolate* isolate = function->GetIsolate();
+  Handle<SharedFunctionInfo> shared(function->shared(), isolate);
+  Handle<Code> code;
+  if (!shared->TryGetCachedCode(isolate).ToHandle(&code)) {
+    if (FLAG_turbo_nci_cross_context_sharing &&
+        shared->may_have_cached_code() && !shared->optimization_disabled() &&
+        !function->IsOptimized() && !function->HasOptimizedCode()) {
+      // The function was hot enough to be optimized in some native context,
+      // but its code has been aged out of the compilation cache since. Skip
+      // the warm-up in this context and have the code compiled again.
+      shared->set_may_have_cached_code(false);
+      JSFunction::EnsureFeedbackVector(function, is_compiled_scope);
+      if (!function->HasOptimizationMarker()) {
+        function->MarkForOptimization(ConcurrencyMode::kConcurrent);
+      }
+    }
+    return false;
+  }
+
+  function->set_code(*code);
+  JSFunction::EnsureFeedbackVector(function, is_compiled_scope);
+  if (FLAG_turbo_nci_cross_context_sharing) {
+    // Also publish the code in the optimized code slot, so that further
+    // closures sharing the feedback vector pick it up in CompileLazy without
+    // calling into the runtime.
+    Handle<FeedbackVector> vector(function->feedback_vector(), isolate);
+    if (!vector->has_optimized_code() && !vector->has_optimization_marker()) {
+      FeedbackVector::SetOptimizedCode(vector, code);
+    }
+  }
+  if (FLAG_trace_turbo_nci) CompilationCacheCode::TraceHit(shared, code);
+  return true;
+}
+
 // static
 void Compiler::PostInstantiation(Handle<JSFunction> function) {
   Isolate* isolate = function->GetIsolate();
@@ -2993,6 +3178,10 @@ void Compiler::PostInstantiation(Handle<JSFunction> function) {
       DCHECK(!code.marked_for_deoptimization());
       DCHECK(function->shared().is_compiled());
       function->set_code(code);
+    } else if (FLAG_turbo_nci_cross_context_sharing) {
+      // Let all closures sharing the feedback vector pick up the code that
+      // another native context cached for this function.
+      InstallCachedCode(function, &is_compiled_scope);
     }
 
     if (FLAG_always_opt && shared->allows_lazy_compilation() &&
@@ -3001,6 +3190,23 @@ void Compiler::PostInstantiation(Handle<JSFunction> function) {
       JSFunction::EnsureFeedbackVector(function, &is_compiled_scope);
       function->MarkForOptimization(ConcurrencyMode::kNotConcurrent);
     }
+
+    // The function was optimized in the isolate that produced the code cache
+    // it was deserialized from. Skip the warm-up and optimize on first call;
+    // later closures pick up the cached native context independent code.
+    if (V8_UNLIKELY(shared->optimize_from_code_cache())) {
+      shared->set_optimize_from_code_cache(false);
+      if (FLAG_turbo_nci && shared->allows_lazy_compilation() &&
+          !shared->optimization_disabled() && !function->IsOptimized() &&
+          !function->HasOptimizedCode()) {
+        JSFunction::EnsureFeedbackVector(function, &is_compiled_scope);
+        if (!function->IsMarkedForOptimization() &&
+            !function->IsMarkedForConcurrentOptimization() &&
+            !function->IsInOptimizationQueue()) {
+          function->MarkForOptimization(ConcurrencyMode::kConcurrent);
+        }
+      }
+    }
   }
 
   if (shared->is_toplevel() || shared->is_wrapped()) {
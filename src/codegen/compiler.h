@@ -110,6 +110,12 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
   // offer this chance, optimized closure instantiation will not call this.
   static void PostInstantiation(Handle<JSFunction> function);
 
+  // Installs the native context independent code that was cached for the
+  // SharedFunctionInfo of {function} by any native context of the isolate.
+  // Returns false if there is no such code.
+  static bool InstallCachedCode(Handle<JSFunction> function,
+                                IsCompiledScope* is_compiled_scope);
+
   // ===========================================================================
   // The following family of methods instantiates new functions for scripts or
   // function literals. The decision whether those functions will be compiled,
@@ -382,34 +388,28 @@ class OptimizedCompilationJob : public CompilationJob {
   const char* compiler_name_;
 };
 
+// Records what the main thread needs to know about a function once its
+// unoptimized compilation job has been finalized. Functions finalized
+// off-thread are identified by their function literal id rather than by a
+// transfer handle, so that publishing a streamed script does not create a
+// handle per compiled function. They are only looked up on the script if the
+// main thread turns out to need them, e.g. for logging.
 class FinalizeUnoptimizedCompilationData {
  public:
   FinalizeUnoptimizedCompilationData(Isolate* isolate,
                                      Handle<SharedFunctionInfo> function_handle,
                                      base::TimeDelta time_taken_to_execute,
-                                     base::TimeDelta time_taken_to_finalize)
-      : time_taken_to_execute_(time_taken_to_execute),
-        time_taken_to_finalize_(time_taken_to_finalize),
-        function_handle_(function_handle),
-        handle_state_(kHandle) {}
+                                     base::TimeDelta time_taken_to_finalize);
 
   FinalizeUnoptimizedCompilationData(OffThreadIsolate* isolate,
                                      Handle<SharedFunctionInfo> function_handle,
                                      base::TimeDelta time_taken_to_execute,
-                                     base::TimeDelta time_taken_to_finalize)
-      : time_taken_to_execute_(time_taken_to_execute),
-        time_taken_to_finalize_(time_taken_to_finalize),
-        function_transfer_handle_(isolate->TransferHandle(function_handle)),
-        handle_state_(kTransferHandle) {}
+                                     base::TimeDelta time_taken_to_finalize);
 
-  Handle<SharedFunctionInfo> function_handle() const {
-    switch (handle_state_) {
-      case kHandle:
-        return function_handle_;
-      case kTransferHandle:
-        return function_transfer_handle_.ToHandle();
-    }
-  }
+  // Returns the compiled function, or an empty handle if it has died since it
+  // was compiled.
+  MaybeHandle<SharedFunctionInfo> function_handle(Isolate* isolate,
+                                                  Handle<Script> script) const;
 
   base::TimeDelta time_taken_to_execute() const {
     return time_taken_to_execute_;
@@ -417,15 +417,17 @@ class FinalizeUnoptimizedCompilationData {
   base::TimeDelta time_taken_to_finalize() const {
     return time_taken_to_finalize_;
   }
+  int code_size() const { return code_size_; }
 
  private:
   base::TimeDelta time_taken_to_execute_;
   base::TimeDelta time_taken_to_finalize_;
+  int code_size_;
   union {
     Handle<SharedFunctionInfo> function_handle_;
-    OffThreadTransferHandle<SharedFunctionInfo> function_transfer_handle_;
+    int function_literal_id_;
   };
-  enum { kHandle, kTransferHandle } handle_state_;
+  enum { kHandle, kFunctionLiteralId } handle_state_;
 };
 
 using FinalizeUnoptimizedCompilationDataList =
@@ -44,6 +44,7 @@ const char* const
         // Accessors:
         ACCESSOR_INFO_LIST_GENERATOR(ADD_ACCESSOR_INFO_NAME, /* not used */)
         ACCESSOR_SETTER_LIST(ADD_ACCESSOR_SETTER_NAME)
+        ACCESSOR_TEMPLATE_GETTER_LIST(ADD_ACCESSOR_SETTER_NAME)
         // Stub cache:
         "Load StubCache::primary_->key",
         "Load StubCache::primary_->value",
@@ -51,12 +52,18 @@ const char* const
         "Load StubCache::secondary_->key",
         "Load StubCache::secondary_->value",
         "Load StubCache::secondary_->map",
+        "Load StubCache::primary_mask_",
+        "Load StubCache::secondary_mask_",
+        "Load StubCache::stats_",
         "Store StubCache::primary_->key",
         "Store StubCache::primary_->value",
         "Store StubCache::primary_->map",
         "Store StubCache::secondary_->key",
         "Store StubCache::secondary_->value",
         "Store StubCache::secondary_->map",
+        "Store StubCache::primary_mask_",
+        "Store StubCache::secondary_mask_",
+        "Store StubCache::stats_",
         // Native code counters:
         STATS_COUNTER_NATIVE_CODE_LIST(ADD_STATS_COUNTER_NAME)
 };
@@ -192,6 +199,8 @@ void ExternalReferenceTable::AddAccessors(int* index) {
   // Setters:
 #define ACCESSOR_SETTER_DECLARATION(name) FUNCTION_ADDR(&Accessors::name),
           ACCESSOR_SETTER_LIST(ACCESSOR_SETTER_DECLARATION)
+  // Template getters:
+          ACCESSOR_TEMPLATE_GETTER_LIST(ACCESSOR_SETTER_DECLARATION)
 #undef ACCESSOR_SETTER_DECLARATION
   };
 
@@ -220,6 +229,9 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
   Add(load_stub_cache->key_reference(StubCache::kSecondary).address(), index);
   Add(load_stub_cache->value_reference(StubCache::kSecondary).address(), index);
   Add(load_stub_cache->map_reference(StubCache::kSecondary).address(), index);
+  Add(load_stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+  Add(load_stub_cache->mask_reference(StubCache::kSecondary).address(), index);
+  Add(load_stub_cache->stats_reference().address(), index);
 
   StubCache* store_stub_cache = isolate->store_stub_cache();
 
@@ -231,6 +243,10 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
   Add(store_stub_cache->value_reference(StubCache::kSecondary).address(),
       index);
   Add(store_stub_cache->map_reference(StubCache::kSecondary).address(), index);
+  Add(store_stub_cache->mask_reference(StubCache::kPrimary).address(), index);
+  Add(store_stub_cache->mask_reference(StubCache::kSecondary).address(),
+      index);
+  Add(store_stub_cache->stats_reference().address(), index);
 
   CHECK_EQ(kSpecialReferenceCount + kExternalReferenceCount +
                kBuiltinsReferenceCount + kRuntimeReferenceCount +
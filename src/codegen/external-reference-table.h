@@ -35,9 +35,10 @@ class ExternalReferenceTable {
       Runtime::kNumInlineFunctions;  // Don't count dupe kInline... functions.
   static constexpr int kIsolateAddressReferenceCount = kIsolateAddressCount;
   static constexpr int kAccessorReferenceCount =
-      Accessors::kAccessorInfoCount + Accessors::kAccessorSetterCount;
+      Accessors::kAccessorInfoCount + Accessors::kAccessorSetterCount +
+      Accessors::kAccessorTemplateGetterCount;
   // The number of stub cache external references, see AddStubCache.
-  static constexpr int kStubCacheReferenceCount = 12;
+  static constexpr int kStubCacheReferenceCount = 18;
   static constexpr int kStatsCountersReferenceCount =
 #define SC(...) +1
       STATS_COUNTER_NATIVE_CODE_LIST(SC);
@@ -15,6 +15,7 @@
 #include "src/logging/counters.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/elements.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/ordered-hash-table.h"
 #include "src/execution/isolate.h"
 #include "src/execution/microtask-queue.h"
@@ -231,6 +232,17 @@ ExternalReference ExternalReference::date_cache_stamp(Isolate* isolate) {
   return ExternalReference(isolate->date_cache()->stamp_address());
 }
 
+ExternalReference ExternalReference::descriptor_lookup_cache_keys(
+    Isolate* isolate) {
+  return ExternalReference(isolate->descriptor_lookup_cache()->keys_address());
+}
+
+ExternalReference ExternalReference::descriptor_lookup_cache_results(
+    Isolate* isolate) {
+  return ExternalReference(
+      isolate->descriptor_lookup_cache()->results_address());
+}
+
 // static
 ExternalReference
 ExternalReference::runtime_function_table_address_for_unittests(
@@ -414,11 +426,24 @@ ExternalReference ExternalReference::address_of_min_int() {
   return ExternalReference(reinterpret_cast<Address>(&double_min_int_constant));
 }
 
+ExternalReference
+ExternalReference::address_of_enable_experimental_regexp_engine() {
+  return ExternalReference(&FLAG_enable_experimental_regexp_engine);
+}
+
 ExternalReference
 ExternalReference::address_of_mock_arraybuffer_allocator_flag() {
   return ExternalReference(&FLAG_mock_arraybuffer_allocator);
 }
 
+ExternalReference ExternalReference::address_of_typed_array_pretenuring_flag() {
+  return ExternalReference(&FLAG_typed_array_pretenuring);
+}
+
+ExternalReference ExternalReference::address_of_ic_stats_flag() {
+  return ExternalReference(&TracingFlags::ic_stats);
+}
+
 ExternalReference ExternalReference::address_of_runtime_stats_flag() {
   return ExternalReference(&TracingFlags::runtime_stats);
 }
@@ -671,6 +696,9 @@ FUNCTION_REFERENCE(copy_fast_number_jsarray_elements_to_typed_array,
 FUNCTION_REFERENCE(copy_typed_array_elements_to_typed_array,
                    CopyTypedArrayElementsToTypedArray)
 FUNCTION_REFERENCE(copy_typed_array_elements_slice, CopyTypedArrayElementsSlice)
+FUNCTION_REFERENCE(array_indexof_includes_smi_or_object,
+                   ArrayIndexOfIncludesSmiOrObject)
+FUNCTION_REFERENCE(array_indexof_includes_double, ArrayIndexOfIncludesDouble)
 FUNCTION_REFERENCE(try_internalize_string_function,
                    StringTable::LookupStringIfExists_NoAllocate)
 FUNCTION_REFERENCE(string_to_array_index_function, String::ToArrayIndex)
@@ -754,6 +782,11 @@ ExternalReference ExternalReference::
           ->promise_hook_or_debug_is_active_or_async_event_delegate_address());
 }
 
+ExternalReference ExternalReference::has_context_promise_hooks_address(
+    Isolate* isolate) {
+  return ExternalReference(isolate->has_context_promise_hooks_address());
+}
+
 ExternalReference ExternalReference::debug_execution_mode_address(
     Isolate* isolate) {
   return ExternalReference(isolate->debug_execution_mode_address());
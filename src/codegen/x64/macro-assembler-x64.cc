@@ -1538,8 +1538,12 @@ void TurboAssembler::Jump(Handle<Code> code_object, RelocInfo::Mode rmode,
       CHECK_NE(builtin_index, Builtins::kNoBuiltinId);
       EmbeddedData d = EmbeddedData::FromBlob();
       Address entry = d.InstructionStartOfBuiltin(builtin_index);
-      Move(kScratchRegister, entry, RelocInfo::OFF_HEAP_TARGET);
-      jmp(kScratchRegister);
+      if (options().short_builtin_calls) {
+        jmp(entry, RelocInfo::RUNTIME_ENTRY);
+      } else {
+        Move(kScratchRegister, entry, RelocInfo::OFF_HEAP_TARGET);
+        jmp(kScratchRegister);
+      }
       bind(&skip);
       return;
     }
@@ -1614,6 +1618,11 @@ void TurboAssembler::CallBuiltin(int builtin_index) {
   CHECK_NE(builtin_index, Builtins::kNoBuiltinId);
   EmbeddedData d = EmbeddedData::FromBlob();
   Address entry = d.InstructionStartOfBuiltin(builtin_index);
+  if (options().short_builtin_calls) {
+    // The builtin is in pc-relative reach, see Isolate::Init.
+    call(entry, RelocInfo::RUNTIME_ENTRY);
+    return;
+  }
   Move(kScratchRegister, entry, RelocInfo::OFF_HEAP_TARGET);
   call(kScratchRegister);
 }
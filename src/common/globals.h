@@ -835,6 +835,8 @@ enum Executability { NOT_EXECUTABLE, EXECUTABLE };
 enum class BytecodeFlushMode {
   kDoNotFlushBytecode,
   kFlushBytecode,
+  // Also flush bytecode that has only gone cold, for memory-reducing GCs.
+  kFlushColdBytecode,
   kStressFlushBytecode,
 };
 
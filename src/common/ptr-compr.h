@@ -13,6 +13,9 @@ namespace v8 {
 namespace internal {
 
 // See v8:7703 for details about how pointer compression works.
+// Compressed pointers are 32-bit offsets from the isolate root, so the heap of
+// an isolate can't be bigger than this reservation. Every isolate gets its own
+// reservation, i.e. the limit applies per isolate and not per process.
 constexpr size_t kPtrComprHeapReservationSize = size_t{4} * GB;
 constexpr size_t kPtrComprIsolateRootAlignment = size_t{4} * GB;
 
@@ -4,6 +4,8 @@
 
 #include "src/compiler-dispatcher/compiler-dispatcher.h"
 
+#include <vector>
+
 #include "src/ast/ast.h"
 #include "src/base/platform/time.h"
 #include "src/codegen/compiler.h"
@@ -59,8 +61,11 @@ base::Optional<CompilerDispatcher::JobId> CompilerDispatcher::Enqueue(
     const FunctionLiteral* function_literal) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.CompilerDispatcherEnqueue");
+  // This may be called from the background thread that parses a streamed
+  // script, so use the parser's runtime call stats rather than the isolate's.
   RuntimeCallTimerScope runtimeTimer(
-      isolate_, RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
+      outer_parse_info->runtime_call_stats(),
+      RuntimeCallCounterId::kCompileEnqueueOnDispatcher);
 
   if (!IsEnabled()) return base::nullopt;
 
@@ -88,17 +93,21 @@ base::Optional<CompilerDispatcher::JobId> CompilerDispatcher::Enqueue(
 bool CompilerDispatcher::IsEnabled() const { return FLAG_compiler_dispatcher; }
 
 bool CompilerDispatcher::IsEnqueued(Handle<SharedFunctionInfo> function) const {
-  if (jobs_.empty()) return false;
+  {
+    base::MutexGuard lock(&jobs_mutex_);
+    if (jobs_.empty()) return false;
+  }
   return GetJobFor(function) != jobs_.end();
 }
 
 bool CompilerDispatcher::IsEnqueued(JobId job_id) const {
+  base::MutexGuard lock(&jobs_mutex_);
   return jobs_.find(job_id) != jobs_.end();
 }
 
 void CompilerDispatcher::RegisterSharedFunctionInfo(
     JobId job_id, SharedFunctionInfo function) {
-  DCHECK_NE(jobs_.find(job_id), jobs_.end());
+  DCHECK(IsEnqueued(job_id));
 
   if (trace_compiler_dispatcher_) {
     PrintF("CompilerDispatcher: registering ");
@@ -111,9 +120,13 @@ void CompilerDispatcher::RegisterSharedFunctionInfo(
       isolate_->global_handles()->Create(function));
 
   // Register mapping.
-  auto job_it = jobs_.find(job_id);
-  DCHECK_NE(job_it, jobs_.end());
-  Job* job = job_it->second.get();
+  Job* job;
+  {
+    base::MutexGuard lock(&jobs_mutex_);
+    auto job_it = jobs_.find(job_id);
+    DCHECK_NE(job_it, jobs_.end());
+    job = job_it->second.get();
+  }
   shared_to_unoptimized_job_id_.Set(function_handle, job_id);
 
   {
@@ -177,11 +190,37 @@ bool CompilerDispatcher::FinishNow(Handle<SharedFunctionInfo> function) {
   return success;
 }
 
+void CompilerDispatcher::FinishJobsForScript(Handle<Script> script,
+                                             bool include_pending) {
+  std::vector<Handle<SharedFunctionInfo>> functions;
+  {
+    base::MutexGuard lock(&mutex_);
+    base::MutexGuard jobs_lock(&jobs_mutex_);
+    for (const auto& it : jobs_) {
+      Job* job = it.second.get();
+      Handle<SharedFunctionInfo> function;
+      if (job->aborted || !job->function.ToHandle(&function)) continue;
+      if (function->script() != *script) continue;
+      if (!include_pending && !job->IsReadyToFinalize(lock)) continue;
+      // The job's global handle is destroyed once the job is finished.
+      functions.push_back(handle(*function, isolate_));
+    }
+  }
+
+  for (Handle<SharedFunctionInfo> function : functions) {
+    if (!FinishNow(function)) isolate_->clear_pending_exception();
+  }
+}
+
 void CompilerDispatcher::AbortJob(JobId job_id) {
   if (trace_compiler_dispatcher_) {
     PrintF("CompilerDispatcher: aborted job %zu\n", job_id);
   }
-  JobMap::const_iterator job_it = jobs_.find(job_id);
+  JobMap::const_iterator job_it;
+  {
+    base::MutexGuard lock(&jobs_mutex_);
+    job_it = jobs_.find(job_id);
+  }
   Job* job = job_it->second.get();
 
   base::LockGuard<base::Mutex> lock(&mutex_);
@@ -198,13 +237,16 @@ void CompilerDispatcher::AbortJob(JobId job_id) {
 void CompilerDispatcher::AbortAll() {
   task_manager_->TryAbortAll();
 
-  for (auto& it : jobs_) {
-    WaitForJobIfRunningOnBackground(it.second.get());
-    if (trace_compiler_dispatcher_) {
-      PrintF("CompilerDispatcher: aborted job %zu\n", it.first);
+  {
+    base::MutexGuard lock(&jobs_mutex_);
+    for (auto& it : jobs_) {
+      WaitForJobIfRunningOnBackground(it.second.get());
+      if (trace_compiler_dispatcher_) {
+        PrintF("CompilerDispatcher: aborted job %zu\n", it.first);
+      }
     }
+    jobs_.clear();
   }
-  jobs_.clear();
   shared_to_unoptimized_job_id_.Clear();
   {
     base::MutexGuard lock(&mutex_);
@@ -220,6 +262,7 @@ CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::GetJobFor(
   JobId* job_id_ptr = shared_to_unoptimized_job_id_.Find(shared);
   JobMap::const_iterator job = jobs_.end();
   if (job_id_ptr) {
+    base::MutexGuard lock(&jobs_mutex_);
     job = jobs_.find(*job_id_ptr);
   }
   return job;
@@ -322,6 +365,7 @@ void CompilerDispatcher::DoIdleWork(double deadline_in_seconds) {
     CompilerDispatcher::JobMap::const_iterator it;
     {
       base::MutexGuard lock(&mutex_);
+      base::MutexGuard jobs_lock(&jobs_mutex_);
       for (it = jobs_.cbegin(); it != jobs_.cend(); ++it) {
         if (it->second->IsReadyToFinalize(lock)) break;
       }
@@ -356,6 +400,7 @@ CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::InsertJob(
     std::unique_ptr<Job> job) {
   bool added;
   JobMap::const_iterator it;
+  base::MutexGuard lock(&jobs_mutex_);
   std::tie(it, added) =
       jobs_.insert(std::make_pair(next_job_id_++, std::move(job)));
   DCHECK(added);
@@ -376,6 +421,7 @@ CompilerDispatcher::JobMap::const_iterator CompilerDispatcher::RemoveJob(
   }
 
   // Delete job.
+  base::MutexGuard lock(&jobs_mutex_);
   return jobs_.erase(it);
 }
 
@@ -39,6 +39,7 @@ class DeferredHandles;
 class FunctionLiteral;
 class Isolate;
 class ParseInfo;
+class Script;
 class SharedFunctionInfo;
 class TimedHistogram;
 class WorkerThreadRuntimeCallStats;
@@ -101,6 +102,11 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
   // possible). Returns true if the compile job was successful.
   bool FinishNow(Handle<SharedFunctionInfo> function);
 
+  // Finalizes the jobs registered for functions of |script|, e.g. so that they
+  // can be included in a code cache. Jobs that have not finished running on a
+  // background thread yet are only finished if |include_pending| is true.
+  void FinishJobsForScript(Handle<Script> script, bool include_pending);
+
   // Aborts compilation job |job_id|.
   void AbortJob(JobId job_id);
 
@@ -162,6 +168,11 @@ class V8_EXPORT_PRIVATE CompilerDispatcher {
 
   std::unique_ptr<CancelableTaskManager> task_manager_;
 
+  // Jobs are enqueued from the background thread while a streamed script is
+  // parsed, so the job map and the next id are guarded by |jobs_mutex_|. All
+  // other uses of the jobs are on the main thread.
+  mutable base::Mutex jobs_mutex_;
+
   // Id for next job to be added
   JobId next_job_id_;
 
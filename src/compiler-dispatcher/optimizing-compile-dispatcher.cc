@@ -11,6 +11,7 @@
 #include "src/init/v8.h"
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
+#include "src/logging/metrics.h"
 #include "src/objects/objects-inl.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
@@ -101,18 +102,48 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
     DCHECK_EQ(0, ref_count_);
   }
 #endif
-  DCHECK_EQ(0, input_queue_length_);
-  DeleteArray(input_queue_);
+  DCHECK(input_queue_.empty());
+}
+
+// static
+double OptimizingCompileDispatcher::ComputePriority(
+    OptimizedCompilationJob* job) {
+  // Hot functions come first. Among functions of similar hotness, smaller ones
+  // are preferred as they finish sooner and large compiles would otherwise
+  // hold up everything queued behind them.
+  static constexpr int kBytecodeSizeUnit = 1 * KB;
+  OptimizedCompilationInfo* info = job->compilation_info();
+  Handle<JSFunction> function = info->closure();
+  const int invocation_count =
+      function->has_feedback_vector()
+          ? function->feedback_vector().invocation_count()
+          : 0;
+  const int bytecode_length =
+      info->has_bytecode_array() ? info->bytecode_array()->length() : 0;
+  return (invocation_count + 1.0) /
+         (1 + bytecode_length / kBytecodeSizeUnit);
 }
 
 OptimizedCompilationJob* OptimizingCompileDispatcher::NextInput(
     bool check_if_flushing) {
   base::MutexGuard access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return nullptr;
-  OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
+  if (input_queue_.empty()) return nullptr;
+  auto next = input_queue_.begin();
+  for (auto it = input_queue_.begin() + 1; it != input_queue_.end(); ++it) {
+    if (it->priority > next->priority ||
+        (it->priority == next->priority &&
+         it->sequence_number < next->sequence_number)) {
+      next = it;
+    }
+  }
+  OptimizedCompilationJob* job = next->job;
   DCHECK_NOT_NULL(job);
-  input_queue_shift_ = InputQueueIndex(1);
-  input_queue_length_--;
+  const base::TimeDelta queue_time = base::TimeTicks::Now() - next->queued_at;
+  input_queue_.erase(next);
+  v8::metrics::OptimizedCompilationJobStarted event;
+  event.queue_time_in_us = queue_time.InMicroseconds();
+  event.queue_length = input_queue_.size();
+  isolate_->metrics_recorder()->AddThreadSafeEvent(event);
   if (check_if_flushing) {
     if (mode_ == FLUSH) {
       AllowHandleDereference allow_handle_dereference;
@@ -160,13 +191,11 @@ void OptimizingCompileDispatcher::Flush(BlockingBehavior blocking_behavior) {
   if (blocking_behavior == BlockingBehavior::kDontBlock) {
     if (FLAG_block_concurrent_recompilation) Unblock();
     base::MutexGuard access_input_queue_(&input_queue_mutex_);
-    while (input_queue_length_ > 0) {
-      OptimizedCompilationJob* job = input_queue_[InputQueueIndex(0)];
-      DCHECK_NOT_NULL(job);
-      input_queue_shift_ = InputQueueIndex(1);
-      input_queue_length_--;
-      DisposeCompilationJob(job, true);
+    for (const QueuedJob& queued : input_queue_) {
+      DCHECK_NOT_NULL(queued.job);
+      DisposeCompilationJob(queued.job, true);
     }
+    input_queue_.clear();
     FlushOutputQueue(true);
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Flushed concurrent recompilation queues (not blocking).\n");
@@ -196,8 +225,8 @@ void OptimizingCompileDispatcher::Stop() {
   }
 
   // At this point the optimizing compiler thread's event loop has stopped.
-  // There is no need for a mutex when reading input_queue_length_.
-  DCHECK_EQ(input_queue_length_, 0);
+  // There is no need for a mutex when reading input_queue_.
+  DCHECK(input_queue_.empty());
   FlushOutputQueue(false);
 }
 
@@ -230,12 +259,12 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
   DCHECK(IsQueueAvailable());
+  const double priority = ComputePriority(job);
   {
-    // Add job to the back of the input queue.
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
-    input_queue_length_++;
+    DCHECK_LT(static_cast<int>(input_queue_.size()), input_queue_capacity_);
+    input_queue_.push_back(
+        {job, priority, next_sequence_number_++, base::TimeTicks::Now()});
   }
   if (FLAG_block_concurrent_recompilation) {
     blocked_jobs_++;
@@ -7,13 +7,16 @@
 
 #include <atomic>
 #include <queue>
+#include <vector>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/utils/allocation.h"
+#include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
 namespace internal {
@@ -27,13 +30,11 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   explicit OptimizingCompileDispatcher(Isolate* isolate)
       : isolate_(isolate),
         input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
-        input_queue_length_(0),
-        input_queue_shift_(0),
         mode_(COMPILE),
         blocked_jobs_(0),
         ref_count_(0),
         recompilation_delay_(FLAG_concurrent_recompilation_delay) {
-    input_queue_ = NewArray<OptimizedCompilationJob*>(input_queue_capacity_);
+    input_queue_.reserve(input_queue_capacity_);
   }
 
   ~OptimizingCompileDispatcher();
@@ -47,7 +48,16 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   inline bool IsQueueAvailable() {
     base::MutexGuard access_input_queue(&input_queue_mutex_);
-    return input_queue_length_ < input_queue_capacity_;
+    int queued_jobs = static_cast<int>(input_queue_.size());
+    return queued_jobs < input_queue_capacity_ &&
+           (max_queued_jobs_ == 0 || queued_jobs < max_queued_jobs_);
+  }
+
+  // Limits the number of queued jobs below the capacity of the queue. Zero
+  // means no limit.
+  void set_max_queued_jobs(int jobs) {
+    base::MutexGuard access_input_queue(&input_queue_mutex_);
+    max_queued_jobs_ = jobs;
   }
 
   static bool Enabled() { return FLAG_concurrent_recompilation; }
@@ -57,27 +67,35 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   enum ModeFlag { COMPILE, FLUSH };
 
+  struct QueuedJob {
+    OptimizedCompilationJob* job;
+    // Jobs with a higher priority are compiled first, see ComputePriority.
+    double priority;
+    // Orders jobs of equal priority by arrival.
+    uint64_t sequence_number;
+    base::TimeTicks queued_at;
+  };
+
+  // Computes the priority of a job on the main thread when it is queued.
+  static double ComputePriority(OptimizedCompilationJob* job);
+
   void FlushOutputQueue(bool restore_function_code);
   void CompileNext(OptimizedCompilationJob* job, RuntimeCallStats* stats);
   OptimizedCompilationJob* NextInput(bool check_if_flushing = false);
 
-  inline int InputQueueIndex(int i) {
-    int result = (i + input_queue_shift_) % input_queue_capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, input_queue_capacity_);
-    return result;
-  }
-
   Isolate* isolate_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompilationJob** input_queue_;
+  // Incoming recompilation tasks (including OSR). Every worker task picks the
+  // job with the highest priority, so a burst of small hot functions does not
+  // wait behind a large compile queued earlier.
+  std::vector<QueuedJob> input_queue_;
   int input_queue_capacity_;
-  int input_queue_length_;
-  int input_queue_shift_;
+  int max_queued_jobs_ = 0;
+  uint64_t next_sequence_number_ = 0;
   base::Mutex input_queue_mutex_;
 
-  // Queue of recompilation tasks ready to be installed (excluding OSR).
+  // Queue of recompilation tasks ready to be installed. With --concurrent-osr,
+  // this includes OSR jobs, whose code goes into the OSR code cache.
   std::queue<OptimizedCompilationJob*> output_queue_;
   // Used for job based recompilation which has multiple producers on
   // different threads.
@@ -97,6 +115,8 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // Since flags might get modified while the background thread is running, it
   // is not safe to access them directly.
   int recompilation_delay_;
+
+  FRIEND_TEST(OptimizingCompileDispatcherTest, PrioritizesHotSmallFunctions);
 };
 }  // namespace internal
 }  // namespace v8
@@ -466,6 +466,15 @@ PropertyAccessInfo AccessInfoFactory::ComputeAccessorDescriptorAccessInfo(
                                                 Handle<Object>(), holder);
   }
   Handle<Object> accessors(descriptors->GetStrongValue(descriptor), isolate());
+  FieldIndex field_index;
+  if (access_mode == AccessMode::kLoad && holder.is_null() &&
+      Accessors::IsInternalFieldAccessor(receiver_map, accessors,
+                                         &field_index)) {
+    // Internal fields can be changed by the embedder at any time.
+    return PropertyAccessInfo::DataField(
+        zone(), receiver_map, {{}, zone()}, field_index,
+        Representation::Tagged(), Type::NonInternal(), receiver_map);
+  }
   if (!accessors->IsAccessorPair()) {
     return PropertyAccessInfo::Invalid(zone());
   }
@@ -450,7 +450,82 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
+namespace {
+
+// Latencies on Neoverse N1 that differ from the generic model below, following
+// the Neoverse N1 Software Optimization Guide. The N1 has a much shorter load
+// pipeline and faster multipliers and dividers than the cores the generic
+// model was tuned on. Division latencies depend on the operands; these are
+// typical values. Returns -1 if the generic latency applies.
+int GetTunedInstructionLatency(
+    InstructionScheduler::MicroArchitecture micro_architecture,
+    ArchOpcode opcode) {
+  if (micro_architecture !=
+      InstructionScheduler::MicroArchitecture::kNeoverseN1) {
+    return -1;
+  }
+  switch (opcode) {
+    case kArm64LdrDecompressTaggedSigned:
+    case kArm64LdrDecompressTaggedPointer:
+    case kArm64LdrDecompressAnyTagged:
+    case kArm64Ldr:
+    case kArm64LdrW:
+    case kArm64Ldrb:
+    case kArm64Ldrh:
+    case kArm64Ldrsb:
+    case kArm64Ldrsh:
+    case kArm64Ldrsw:
+      return 4;
+    case kArm64LdrD:
+    case kArm64LdrS:
+      return 5;
+    case kArm64Madd32:
+    case kArm64Mneg32:
+    case kArm64Msub32:
+    case kArm64Mul32:
+    case kArm64Madd:
+    case kArm64Mneg:
+    case kArm64Msub:
+    case kArm64Mul:
+      return 2;
+    case kArm64Idiv32:
+    case kArm64Udiv32:
+      return 8;
+    case kArm64Idiv:
+    case kArm64Udiv:
+      return 12;
+    case kArm64Float32Add:
+    case kArm64Float32Sub:
+    case kArm64Float64Add:
+    case kArm64Float64Sub:
+    case kArm64Float32Abs:
+    case kArm64Float32Cmp:
+    case kArm64Float32Neg:
+    case kArm64Float64Abs:
+    case kArm64Float64Cmp:
+    case kArm64Float64Neg:
+      return 2;
+    case kArm64Float32Mul:
+    case kArm64Float64Mul:
+      return 3;
+    case kArm64Float32Div:
+    case kArm64Float32Sqrt:
+      return 9;
+    case kArm64Float64Div:
+    case kArm64Float64Sqrt:
+      return 13;
+    default:
+      return -1;
+  }
+}
+
+}  // namespace
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  int tuned_latency =
+      GetTunedInstructionLatency(HostMicroArchitecture(), instr->arch_opcode());
+  if (tuned_latency >= 0) return tuned_latency;
+
   // Basic latency modeling for arm64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
@@ -645,6 +645,9 @@ void InstructionSelector::VisitLoadTransform(Node* node) {
   }
   // ARM64 supports unaligned loads
   DCHECK_NE(params.kind, LoadKind::kUnaligned);
+  if (params.kind == LoadKind::kProtected) {
+    opcode |= MiscField::encode(kMemoryAccessProtected);
+  }
 
   Arm64OperandGenerator g(this);
   Node* base = node->InputAt(0);
@@ -735,7 +738,9 @@ void InstructionSelector::VisitLoad(Node* node) {
     case MachineRepresentation::kNone:
       UNREACHABLE();
   }
-  if (node->opcode() == IrOpcode::kPoisonedLoad) {
+  if (node->opcode() == IrOpcode::kProtectedLoad) {
+    opcode |= MiscField::encode(kMemoryAccessProtected);
+  } else if (node->opcode() == IrOpcode::kPoisonedLoad) {
     CHECK_NE(poisoning_level_, PoisoningMitigationLevel::kDontPoison);
     opcode |= MiscField::encode(kMemoryAccessPoisoned);
   }
@@ -745,10 +750,7 @@ void InstructionSelector::VisitLoad(Node* node) {
 
 void InstructionSelector::VisitPoisonedLoad(Node* node) { VisitLoad(node); }
 
-void InstructionSelector::VisitProtectedLoad(Node* node) {
-  // TODO(eholk)
-  UNIMPLEMENTED();
-}
+void InstructionSelector::VisitProtectedLoad(Node* node) { VisitLoad(node); }
 
 void InstructionSelector::VisitStore(Node* node) {
   Arm64OperandGenerator g(this);
@@ -845,6 +847,9 @@ void InstructionSelector::VisitStore(Node* node) {
       case MachineRepresentation::kNone:
         UNREACHABLE();
     }
+    if (node->opcode() == IrOpcode::kProtectedStore) {
+      opcode |= MiscField::encode(kMemoryAccessProtected);
+    }
 
     ExternalReferenceMatcher m(base);
     if (m.HasValue() && g.IsIntegerConstant(index) &&
@@ -886,8 +891,9 @@ void InstructionSelector::VisitStore(Node* node) {
 }
 
 void InstructionSelector::VisitProtectedStore(Node* node) {
-  // TODO(eholk)
-  UNIMPLEMENTED();
+  // Protected stores never need a write barrier, so they are handled like
+  // plain stores with a protected access mode.
+  VisitStore(node);
 }
 
 void InstructionSelector::VisitSimd128ReverseBytes(Node* node) {
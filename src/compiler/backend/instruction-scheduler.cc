@@ -4,6 +4,9 @@
 
 #include "src/compiler/backend/instruction-scheduler.h"
 
+#include <cstring>
+
+#include "src/base/cpu.h"
 #include "src/base/iterator.h"
 #include "src/base/optional.h"
 #include "src/base/utils/random-number-generator.h"
@@ -72,6 +75,30 @@ void InstructionScheduler::ScheduleGraphNode::AddSuccessor(
   node->unscheduled_predecessors_count_++;
 }
 
+// static
+InstructionScheduler::MicroArchitecture
+InstructionScheduler::HostMicroArchitecture() {
+  static const MicroArchitecture micro_architecture = [] {
+    base::CPU cpu;
+    if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && cpu.family() == 6 &&
+        cpu.model() == 0x55) {
+      // Skylake-SP, and Cascade Lake which shares its core.
+      return MicroArchitecture::kSkylakeServer;
+    }
+    if (strcmp(cpu.vendor(), "AuthenticAMD") == 0 &&
+        cpu.family() + cpu.ext_family() == 0x17 && cpu.model() >= 0x30) {
+      // Family 17h models from 30h on are Zen 2; earlier ones are Zen.
+      return MicroArchitecture::kZen2;
+    }
+    if (cpu.implementer() == base::CPU::ARM &&
+        cpu.part() == base::CPU::ARM_NEOVERSE_N1) {
+      return MicroArchitecture::kNeoverseN1;
+    }
+    return MicroArchitecture::kGeneric;
+  }();
+  return micro_architecture;
+}
+
 InstructionScheduler::InstructionScheduler(Zone* zone,
                                            InstructionSequence* sequence)
     : zone_(zone),
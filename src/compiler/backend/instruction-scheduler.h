@@ -48,6 +48,18 @@ class InstructionScheduler final : public ZoneObject {
 
   static bool SchedulerSupported();
 
+  // Micro-architectures with tuned instruction latencies. On all other CPUs,
+  // each backend uses its generic latency model.
+  enum class MicroArchitecture {
+    kGeneric,
+    kSkylakeServer,
+    kZen2,
+    kNeoverseN1
+  };
+
+  // Returns the micro-architecture of the host, detected once via base::CPU.
+  V8_EXPORT_PRIVATE static MicroArchitecture HostMicroArchitecture();
+
  private:
   // A scheduling graph node.
   // Represent an instruction and their dependencies.
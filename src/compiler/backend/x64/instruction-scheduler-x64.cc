@@ -453,7 +453,92 @@ int InstructionScheduler::GetTargetInstructionFlags(
   UNREACHABLE();
 }
 
+namespace {
+
+// Latencies on Skylake-SP and Zen 2 that differ from the generic model below,
+// following the vendors' optimization manuals. Division latencies depend on
+// the operands; these are typical values for small dividends. Returns -1 if
+// the generic latency applies.
+int GetTunedInstructionLatency(
+    InstructionScheduler::MicroArchitecture micro_architecture,
+    ArchOpcode opcode) {
+  switch (micro_architecture) {
+    case InstructionScheduler::MicroArchitecture::kSkylakeServer:
+      switch (opcode) {
+        case kSSEFloat32Add:
+        case kSSEFloat32Sub:
+        case kSSEFloat32Mul:
+        case kSSEFloat64Add:
+        case kSSEFloat64Sub:
+        case kSSEFloat64Mul:
+        case kAVXFloat32Add:
+        case kAVXFloat32Sub:
+        case kAVXFloat32Mul:
+        case kAVXFloat64Add:
+        case kAVXFloat64Sub:
+        case kAVXFloat64Mul:
+          return 4;
+        case kSSEFloat32Div:
+        case kAVXFloat32Div:
+          return 11;
+        case kSSEFloat64Div:
+        case kAVXFloat64Div:
+          return 14;
+        case kSSEFloat32Sqrt:
+          return 12;
+        case kSSEFloat64Sqrt:
+          return 18;
+        case kX64Idiv:
+          return 42;
+        case kX64Udiv:
+          return 35;
+        case kX64Idiv32:
+        case kX64Udiv32:
+          return 26;
+        default:
+          return -1;
+      }
+    case InstructionScheduler::MicroArchitecture::kZen2:
+      switch (opcode) {
+        case kSSEFloat64Mul:
+        case kAVXFloat32Add:
+        case kAVXFloat32Sub:
+        case kAVXFloat32Mul:
+        case kAVXFloat64Add:
+        case kAVXFloat64Sub:
+        case kAVXFloat64Mul:
+          return 3;
+        case kSSEFloat32Div:
+        case kAVXFloat32Div:
+          return 10;
+        case kSSEFloat64Div:
+        case kAVXFloat64Div:
+          return 13;
+        case kSSEFloat32Sqrt:
+          return 14;
+        case kSSEFloat64Sqrt:
+          return 20;
+        case kX64Idiv:
+        case kX64Udiv:
+          return 45;
+        case kX64Idiv32:
+        case kX64Udiv32:
+          return 29;
+        default:
+          return -1;
+      }
+    default:
+      return -1;
+  }
+}
+
+}  // namespace
+
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+  int tuned_latency =
+      GetTunedInstructionLatency(HostMicroArchitecture(), instr->arch_opcode());
+  if (tuned_latency >= 0) return tuned_latency;
+
   // Basic latency modeling for x64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
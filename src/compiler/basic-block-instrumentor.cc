@@ -8,12 +8,14 @@
 
 #include "src/codegen/optimized-compilation-info.h"
 #include "src/compiler/common-operator.h"
+#include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/machine-operator.h"
 #include "src/compiler/node.h"
 #include "src/compiler/operator-properties.h"
 #include "src/compiler/schedule.h"
 #include "src/objects/objects-inl.h"
+#include "src/objects/script-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -53,7 +55,7 @@ static const Operator* PointerConstant(CommonOperatorBuilder* common,
 
 BasicBlockProfilerData* BasicBlockInstrumentor::Instrument(
     OptimizedCompilationInfo* info, Graph* graph, Schedule* schedule,
-    Isolate* isolate) {
+    SourcePositionTable* source_positions, Isolate* isolate) {
   // Basic block profiling disables concurrent compilation, so handle deref is
   // fine.
   AllowHandleDereference allow_handle_dereference;
@@ -73,6 +75,13 @@ BasicBlockProfilerData* BasicBlockInstrumentor::Instrument(
   // BasicBlockProfilerData directly. The JS heap object is only used for
   // builtins.
   bool on_heap_counters = isolate && isolate->IsGeneratingEmbeddedBuiltins();
+  // Source positions are only useful for code compiled at runtime, where they
+  // can be mapped back to the script of the function.
+  bool record_source_positions = !on_heap_counters && info->has_shared_info();
+  if (record_source_positions) {
+    Object script = info->shared_info()->script();
+    if (script.IsScript()) data->SetScriptId(Script::cast(script).id());
+  }
   // Add the increment instructions to the start of every block.
   CommonOperatorBuilder common(graph->zone());
   MachineOperatorBuilder machine(graph->zone());
@@ -101,6 +110,18 @@ BasicBlockProfilerData* BasicBlockInstrumentor::Instrument(
     // Iteration is already in reverse post-order.
     DCHECK_EQ(block->rpo_number(), block_number);
     data->SetBlockId(block_number, block->id().ToInt());
+    if (record_source_positions) {
+      // Use the first node that comes from the function itself rather than
+      // from an inlinee, so that all positions refer to the same script.
+      for (Node* node : *block) {
+        SourcePosition position = source_positions->GetSourcePosition(node);
+        if (position.IsJavaScript() && !position.isInlined() &&
+            position.ScriptOffset() != kNoSourcePosition) {
+          data->SetSourcePosition(block_number, position.ScriptOffset());
+          break;
+        }
+      }
+    }
     // It is unnecessary to wire effect and control deps for load and store
     // since this happens after scheduling.
     // Construct increment operation.
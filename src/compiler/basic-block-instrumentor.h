@@ -17,12 +17,13 @@ namespace compiler {
 
 class Graph;
 class Schedule;
+class SourcePositionTable;
 
 class BasicBlockInstrumentor : public AllStatic {
  public:
-  static BasicBlockProfilerData* Instrument(OptimizedCompilationInfo* info,
-                                            Graph* graph, Schedule* schedule,
-                                            Isolate* isolate);
+  static BasicBlockProfilerData* Instrument(
+      OptimizedCompilationInfo* info, Graph* graph, Schedule* schedule,
+      SourcePositionTable* source_positions, Isolate* isolate);
 };
 
 }  // namespace compiler
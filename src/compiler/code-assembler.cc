@@ -908,8 +908,7 @@ TNode<Object> CodeAssembler::CallRuntimeImpl(
   int argc = static_cast<int>(args.size());
   auto call_descriptor = Linkage::GetRuntimeCallDescriptor(
       zone(), function, argc, Operator::kNoProperties,
-      Runtime::MayAllocate(function) ? CallDescriptor::kNoFlags
-                                     : CallDescriptor::kNoAllocate);
+      CallDescriptor::kNoFlags);
 
   TNode<ExternalReference> ref =
       ExternalConstant(ExternalReference::Create(function));
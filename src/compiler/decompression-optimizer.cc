@@ -78,13 +78,25 @@ void DecompressionOptimizer::MarkNodeInputs(Node* node) {
                                   State::kOnly32BitsObserved);  // value
       break;
     // BINOPS.
+    // With pointer compression, Smi arithmetic is done directly on the lower
+    // 32 bits of the tagged values (see GraphAssembler::SmiSub), so these
+    // don't need their inputs decompressed either.
+    case IrOpcode::kInt32Add:
+    case IrOpcode::kInt32AddWithOverflow:
     case IrOpcode::kInt32LessThan:
     case IrOpcode::kInt32LessThanOrEqual:
+    case IrOpcode::kInt32Mul:
+    case IrOpcode::kInt32Sub:
+    case IrOpcode::kInt32SubWithOverflow:
     case IrOpcode::kUint32LessThan:
     case IrOpcode::kUint32LessThanOrEqual:
     case IrOpcode::kWord32And:
     case IrOpcode::kWord32Equal:
+    case IrOpcode::kWord32Or:
+    case IrOpcode::kWord32Sar:
     case IrOpcode::kWord32Shl:
+    case IrOpcode::kWord32Shr:
+    case IrOpcode::kWord32Xor:
       DCHECK_EQ(node->op()->ValueInputCount(), 2);
       MaybeMarkAndQueueForRevisit(node->InputAt(0),
                                   State::kOnly32BitsObserved);  // value_0
@@ -23,6 +23,7 @@
 #include "src/execution/frames.h"
 #include "src/heap/factory-inl.h"
 #include "src/objects/heap-number.h"
+#include "src/objects/js-array-buffer.h"
 #include "src/objects/oddball.h"
 #include "src/objects/ordered-hash-table.h"
 
@@ -242,6 +243,13 @@ class EffectControlLinearizer {
 
   Node* BuildTypedArrayDataPointer(Node* base, Node* external);
 
+  Node* AdaptFastCallArgument(Node* value, const CTypeInfo& arg_type,
+                              GraphAssemblerLabel<0>* if_error);
+  Node* AdaptFastCallTypedArrayArgument(Node* value, CTypeInfo::Type type,
+                                        GraphAssemblerLabel<0>* if_error);
+  Node* AdaptFastCallOneByteStringArgument(Node* value,
+                                           GraphAssemblerLabel<0>* if_error);
+
   template <typename... Args>
   Node* CallBuiltin(Builtins::Name builtin, Operator::Properties properties,
                     Args...);
@@ -5025,8 +5033,10 @@ void EffectControlLinearizer::LowerStoreMessage(Node* node) {
 }
 
 // TODO(mslekova): Avoid code duplication with simplified lowering.
-static MachineType MachineTypeFor(CTypeInfo::Type type) {
-  switch (type) {
+static MachineType MachineTypeFor(const CTypeInfo& type_info) {
+  // Typed arrays are passed as a pointer to a FastApiTypedArray.
+  if (type_info.IsTypedArray()) return MachineType::Pointer();
+  switch (type_info.GetType()) {
     case CTypeInfo::Type::kVoid:
       return MachineType::AnyTagged();
     case CTypeInfo::Type::kBool:
@@ -5045,7 +5055,122 @@ static MachineType MachineTypeFor(CTypeInfo::Type type) {
       return MachineType::Float64();
     case CTypeInfo::Type::kV8Value:
       return MachineType::AnyTagged();
+    case CTypeInfo::Type::kUint8:
+      return MachineType::Uint8();
+    case CTypeInfo::Type::kOneByteString:
+      return MachineType::Pointer();
+  }
+}
+
+Node* EffectControlLinearizer::AdaptFastCallArgument(
+    Node* value, const CTypeInfo& arg_type, GraphAssemblerLabel<0>* if_error) {
+  if (arg_type.IsTypedArray()) {
+    return AdaptFastCallTypedArrayArgument(value, arg_type.GetType(), if_error);
+  }
+  if (arg_type.GetType() == CTypeInfo::Type::kOneByteString) {
+    return AdaptFastCallOneByteStringArgument(value, if_error);
+  }
+  return value;
+}
+
+Node* EffectControlLinearizer::AdaptFastCallTypedArrayArgument(
+    Node* value, CTypeInfo::Type type, GraphAssemblerLabel<0>* if_error) {
+  ElementsKind elements_kind;
+  switch (type) {
+    case CTypeInfo::Type::kUint8:
+      elements_kind = UINT8_ELEMENTS;
+      break;
+    case CTypeInfo::Type::kFloat64:
+      elements_kind = FLOAT64_ELEMENTS;
+      break;
+    default:
+      UNREACHABLE();
   }
+
+  // Check that {value} is a typed array with the expected elements kind.
+  __ GotoIf(ObjectIsSmi(value), if_error);
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), value);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  __ GotoIfNot(__ Word32Equal(value_instance_type,
+                              __ Int32Constant(JS_TYPED_ARRAY_TYPE)),
+               if_error);
+  Node* value_bit_field2 =
+      __ LoadField(AccessBuilder::ForMapBitField2(), value_map);
+  Node* value_kind = __ Word32Shr(
+      __ Word32And(value_bit_field2,
+                   __ Int32Constant(Map::Bits2::ElementsKindBits::kMask)),
+      __ Int32Constant(Map::Bits2::ElementsKindBits::kShift));
+  __ GotoIfNot(__ Word32Equal(value_kind, __ Int32Constant(elements_kind)),
+               if_error);
+
+  // Leave detached buffers to the slow callback.
+  Node* buffer =
+      __ LoadField(AccessBuilder::ForJSArrayBufferViewBuffer(), value);
+  Node* buffer_bit_field =
+      __ LoadField(AccessBuilder::ForJSArrayBufferBitField(), buffer);
+  __ GotoIfNot(
+      __ Word32Equal(
+          __ Word32And(buffer_bit_field,
+                       __ Int32Constant(JSArrayBuffer::WasDetachedBit::kMask)),
+          __ Int32Constant(0)),
+      if_error);
+
+  Node* base = __ LoadField(AccessBuilder::ForJSTypedArrayBasePointer(), value);
+  Node* external =
+      __ LoadField(AccessBuilder::ForJSTypedArrayExternalPointer(), value);
+  Node* data = BuildTypedArrayDataPointer(base, external);
+  Node* length = __ LoadField(AccessBuilder::ForJSTypedArrayLength(), value);
+
+  // The layout of FastApiTypedArray does not depend on the element type.
+  using TypedArray = FastApiTypedArray<uint8_t>;
+  Node* stack_slot = __ StackSlot(static_cast<int>(sizeof(TypedArray)),
+                                  static_cast<int>(alignof(TypedArray)));
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(TypedArray, data)), data);
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(TypedArray, length)), length);
+  return stack_slot;
+}
+
+Node* EffectControlLinearizer::AdaptFastCallOneByteStringArgument(
+    Node* value, GraphAssemblerLabel<0>* if_error) {
+  // Check that {value} is a sequential one-byte string.
+  __ GotoIf(ObjectIsSmi(value), if_error);
+  Node* value_map = __ LoadField(AccessBuilder::ForMap(), value);
+  Node* value_instance_type =
+      __ LoadField(AccessBuilder::ForMapInstanceType(), value_map);
+  Node* value_string_type = __ Word32And(
+      value_instance_type,
+      __ Int32Constant(kIsNotStringMask | kStringRepresentationMask |
+                       kStringEncodingMask));
+  __ GotoIfNot(
+      __ Word32Equal(value_string_type,
+                     __ Int32Constant(kStringTag | kSeqStringTag |
+                                      kOneByteStringTag)),
+      if_error);
+
+  // The characters are passed as an interior pointer, which is fine since
+  // fast API functions must not trigger a GC.
+  Node* data = __ IntAdd(
+      __ BitcastTaggedToWord(value),
+      __ IntPtrConstant(SeqOneByteString::kHeaderSize - kHeapObjectTag));
+  Node* length = __ LoadField(AccessBuilder::ForStringLength(), value);
+
+  Node* stack_slot =
+      __ StackSlot(static_cast<int>(sizeof(FastOneByteString)),
+                   static_cast<int>(alignof(FastOneByteString)));
+  __ Store(StoreRepresentation(MachineType::PointerRepresentation(),
+                               kNoWriteBarrier),
+           stack_slot, static_cast<int>(offsetof(FastOneByteString, data)),
+           data);
+  __ Store(
+      StoreRepresentation(MachineRepresentation::kWord32, kNoWriteBarrier),
+      stack_slot, static_cast<int>(offsetof(FastOneByteString, length)),
+      length);
+  return stack_slot;
 }
 
 Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
@@ -5059,6 +5184,10 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
   CHECK_EQ(FastApiCallNode::ArityForArgc(c_arg_count, js_arg_count),
            value_input_count);
 
+  // Arguments that do not match the expected typed array or string type, as
+  // well as errors reported by the fast callback, lead to the slow call.
+  auto if_error = __ MakeDeferredLabel();
+
   // Add the { has_error } output parameter.
   int kAlign = 4;
   int kSize = 4;
@@ -5069,11 +5198,10 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
 
   MachineSignature::Builder builder(
       graph()->zone(), 1, c_arg_count + FastApiCallNode::kHasErrorInputCount);
-  MachineType return_type = MachineTypeFor(c_signature->ReturnInfo().GetType());
+  MachineType return_type = MachineTypeFor(c_signature->ReturnInfo());
   builder.AddReturn(return_type);
   for (int i = 0; i < c_arg_count; ++i) {
-    MachineType machine_type =
-        MachineTypeFor(c_signature->ArgumentInfo(i).GetType());
+    MachineType machine_type = MachineTypeFor(c_signature->ArgumentInfo(i));
     builder.AddParam(machine_type);
   }
   builder.AddParam(MachineType::Pointer());  // has_error
@@ -5085,9 +5213,12 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
 
   Node** const inputs = graph()->zone()->NewArray<Node*>(
       c_arg_count + FastApiCallNode::kFastCallExtraInputCount);
-  for (int i = 0; i < c_arg_count + FastApiCallNode::kFastTargetInputCount;
-       ++i) {
-    inputs[i] = NodeProperties::GetValueInput(node, i);
+  inputs[0] = NodeProperties::GetValueInput(node, 0);  // Target.
+  for (int i = 0; i < c_arg_count; ++i) {
+    inputs[i + FastApiCallNode::kFastTargetInputCount] = AdaptFastCallArgument(
+        NodeProperties::GetValueInput(
+            node, i + FastApiCallNode::kFastTargetInputCount),
+        c_signature->ArgumentInfo(i), &if_error);
   }
   inputs[c_arg_count + 1] = has_error;
   inputs[c_arg_count + 2] = __ effect();
@@ -5103,7 +5234,6 @@ Node* EffectControlLinearizer::LowerFastApiCall(Node* node) {
       TNode<Boolean>::UncheckedCast(__ Word32Equal(load, __ Int32Constant(0)));
   // Hint to true.
   auto if_success = __ MakeLabel();
-  auto if_error = __ MakeDeferredLabel();
   auto merge = __ MakeLabel(MachineRepresentation::kTagged);
   __ Branch(cond, &if_success, &if_error);
 
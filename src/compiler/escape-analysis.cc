@@ -517,6 +517,10 @@ int OffsetOfElementAt(ElementAccess const& access, int index) {
          (index << ElementSizeLog2Of(access.machine_type.representation()));
 }
 
+// Loads with a non-constant index from virtual objects with at most this many
+// elements are turned into a chain of Selects.
+constexpr int kMaxElementsForSelect = 8;
+
 Maybe<int> OffsetOfElementsAccess(const Operator* op, Node* index_node) {
   DCHECK(op->opcode() == IrOpcode::kLoadElement ||
          op->opcode() == IrOpcode::kStoreElement);
@@ -639,9 +643,6 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
         int const length =
             (vobject->size() - access.header_size) >>
             ElementSizeLog2Of(access.machine_type.representation());
-        Variable var0, var1;
-        Node* value0;
-        Node* value1;
         if (length == 1 &&
             vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var) &&
             current->Get(var).To(&value) &&
@@ -652,37 +653,49 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
           // one element of {object}.
           current->SetReplacement(value);
           break;
-        } else if (length == 2 &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 0)).To(&var0) &&
-                   current->Get(var0).To(&value0) &&
-                   (value0 == nullptr ||
-                    NodeProperties::GetType(value0).Is(access.type)) &&
-                   vobject->FieldAt(OffsetOfElementAt(access, 1)).To(&var1) &&
-                   current->Get(var1).To(&value1) &&
-                   (value1 == nullptr ||
-                    NodeProperties::GetType(value1).Is(access.type))) {
-          if (value0 && value1) {
-            // The {object} has exactly two elements, so the LoadElement
-            // must return one of them (i.e. either the element at index
-            // 0 or the one at index 1). So we can turn the LoadElement
-            // into a Select operation instead (still allowing the {object}
-            // to be scalar replaced). We must however mark the elements
-            // of the {object} itself as escaping.
-            Node* check =
-                jsgraph->graph()->NewNode(jsgraph->simplified()->NumberEqual(),
-                                          index, jsgraph->ZeroConstant());
-            NodeProperties::SetType(check, Type::Boolean());
-            Node* select = jsgraph->graph()->NewNode(
-                jsgraph->common()->Select(access.machine_type.representation()),
-                check, value0, value1);
-            NodeProperties::SetType(select, access.type);
+        } else if (length >= 2 && length <= kMaxElementsForSelect) {
+          // The {object} has only a few elements, so the LoadElement must
+          // return one of them. We can turn the LoadElement into a chain of
+          // Select operations on the {index} instead (still allowing the
+          // {object} to be scalar replaced). We must however mark the
+          // elements of the {object} itself as escaping.
+          Node* values[kMaxElementsForSelect];
+          bool known = true;
+          bool complete = true;
+          for (int i = 0; i < length; ++i) {
+            if (!vobject->FieldAt(OffsetOfElementAt(access, i)).To(&var) ||
+                !current->Get(var).To(&values[i]) ||
+                (values[i] != nullptr &&
+                 !NodeProperties::GetType(values[i]).Is(access.type))) {
+              known = false;
+              break;
+            }
+            if (values[i] == nullptr) complete = false;
+          }
+          if (known) {
+            // If the variables have no values, we have not reached the
+            // fixed-point yet.
+            if (!complete) break;
+            Node* select = values[length - 1];
+            for (int i = length - 2; i >= 0; --i) {
+              Node* constant = jsgraph->Constant(i);
+              if (!NodeProperties::IsTyped(constant)) {
+                NodeProperties::SetType(
+                    constant, Type::Constant(i, jsgraph->graph()->zone()));
+              }
+              Node* check = jsgraph->graph()->NewNode(
+                  jsgraph->simplified()->NumberEqual(), index, constant);
+              NodeProperties::SetType(check, Type::Boolean());
+              select = jsgraph->graph()->NewNode(
+                  jsgraph->common()->Select(
+                      access.machine_type.representation()),
+                  check, values[i], select);
+              NodeProperties::SetType(select, access.type);
+            }
             current->SetReplacement(select);
-            current->SetEscaped(value0);
-            current->SetEscaped(value1);
-            break;
-          } else {
-            // If the variables have no values, we have
-            // not reached the fixed-point yet.
+            for (int i = 0; i < length; ++i) {
+              current->SetEscaped(values[i]);
+            }
             break;
           }
         }
@@ -3448,6 +3448,32 @@ Reduction JSCallReducer::ReduceArraySome(Node* node,
   return ReplaceWithSubgraph(&a, subgraph);
 }
 
+namespace {
+
+// Returns true if optimized code can pass all arguments of {c_signature}.
+// Arrays of values are not supported yet, and typed arrays only with the
+// element types that FastApiTypedArray is specialized for.
+bool CanOptimizeFastCall(const CFunctionInfo* c_signature) {
+  for (unsigned int i = 0; i < c_signature->ArgumentCount(); ++i) {
+    const CTypeInfo& arg_type = c_signature->ArgumentInfo(i);
+    if (arg_type.IsArray()) return false;
+    if (arg_type.IsTypedArray()) {
+      switch (arg_type.GetType()) {
+        case CTypeInfo::Type::kUint8:
+        case CTypeInfo::Type::kFloat64:
+          break;
+        default:
+          return false;
+      }
+    } else if (arg_type.GetType() == CTypeInfo::Type::kUint8) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
 Reduction JSCallReducer::ReduceCallApiFunction(
     Node* node, const SharedFunctionInfoRef& shared) {
   DisallowHeapAccessIf no_heap_access(should_disallow_heap_access());
@@ -3621,8 +3647,9 @@ Reduction JSCallReducer::ReduceCallApiFunction(
 
   Address c_function = function_template_info.c_function();
 
-  if (FLAG_turbo_fast_api_calls && c_function != kNullAddress) {
-    const CFunctionInfo* c_signature = function_template_info.c_signature();
+  const CFunctionInfo* c_signature = function_template_info.c_signature();
+  if (FLAG_turbo_fast_api_calls && c_function != kNullAddress &&
+      CanOptimizeFastCall(c_signature)) {
     FastApiCallReducerAssembler a(jsgraph(), graph()->zone(), node, c_function,
                                   c_signature, function_template_info, receiver,
                                   holder, shared, target, argc, effect);
@@ -3707,6 +3734,12 @@ Reduction JSCallReducer::ReduceCallOrConstructWithArrayLikeOrSpread(
 
   Node* arguments_list =
       NodeProperties::GetValueInput(node, arraylike_or_spread_index);
+  if (arguments_list->opcode() == IrOpcode::kJSCreateLiteralArray &&
+      IsCallWithArrayLikeOrSpread(node)) {
+    return ReduceCallWithArrayLikeOrSpreadOfArrayLiteral(
+        node, arraylike_or_spread_index, frequency, feedback,
+        speculation_mode);
+  }
   if (arguments_list->opcode() != IrOpcode::kJSCreateArguments) {
     return NoChange();
   }
@@ -3925,6 +3958,88 @@ Reduction JSCallReducer::ReduceCallOrConstructWithArrayLikeOrSpread(
   }
 }
 
+// Passes the elements of an array literal, as in f(...[a, b]) or
+// f.apply(o, [a, b]), as individual arguments. The literal must not have any
+// other value uses, so nothing can modify it between its creation and the
+// call.
+Reduction JSCallReducer::ReduceCallWithArrayLikeOrSpreadOfArrayLiteral(
+    Node* node, int arraylike_or_spread_index, CallFrequency const& frequency,
+    FeedbackSource const& feedback, SpeculationMode speculation_mode) {
+  DCHECK(IsCallWithArrayLikeOrSpread(node));
+  Node* arguments_list =
+      NodeProperties::GetValueInput(node, arraylike_or_spread_index);
+  DCHECK_EQ(IrOpcode::kJSCreateLiteralArray, arguments_list->opcode());
+
+  for (Edge edge : arguments_list->use_edges()) {
+    if (!NodeProperties::IsValueEdge(edge)) continue;
+    Node* const user = edge.from();
+    if (user == node && edge.index() == arraylike_or_spread_index) continue;
+    if (user->opcode() == IrOpcode::kFrameState ||
+        user->opcode() == IrOpcode::kStateValues) {
+      continue;
+    }
+    return NoChange();
+  }
+
+  // TODO(jgruber,v8:8888): Attempt to remove this restriction. The reason it
+  // currently exists is because we cannot create code dependencies in NCI code.
+  if (broker()->is_native_context_independent()) return NoChange();
+
+  // The length and elements kind of the literal are taken from its
+  // boilerplate. Holey literals are not handled, since holes would have to be
+  // looked up on the prototype chain.
+  JSCreateLiteralOpNode n(arguments_list);
+  ProcessedFeedback const& literal_feedback =
+      broker()->GetFeedbackForArrayOrObjectLiteral(n.Parameters().feedback());
+  if (literal_feedback.IsInsufficient()) return NoChange();
+  AllocationSiteRef site = literal_feedback.AsLiteral().value();
+  if (!site.IsFastLiteral()) return NoChange();
+  ElementsKind const elements_kind = site.GetElementsKind();
+  if (elements_kind != PACKED_SMI_ELEMENTS &&
+      elements_kind != PACKED_ELEMENTS) {
+    return NoChange();
+  }
+  ObjectRef length = site.boilerplate()->AsJSArray().length();
+  if (!length.IsSmi()) return NoChange();
+  static constexpr int kMaxArrayLiteralLength = 32;
+  int const array_length = length.AsSmi();
+  if (array_length > kMaxArrayLiteralLength) return NoChange();
+
+  // For call with spread, we need to also install a code dependency on the
+  // array iterator lookup protector cell to ensure that no one messed with
+  // the %ArrayIteratorPrototype%.next method or Array.prototype[@@iterator].
+  if (node->opcode() == IrOpcode::kJSCallWithSpread) {
+    if (!dependencies()->DependOnArrayIteratorProtector()) return NoChange();
+  }
+  dependencies()->DependOnElementsKind(site);
+
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  Node* elements = effect = graph()->NewNode(
+      simplified()->LoadField(AccessBuilder::ForJSObjectElements()),
+      arguments_list, effect, control);
+
+  // Replace the {arguments_list} input of the {node} with its elements.
+  node->RemoveInput(arraylike_or_spread_index);
+  int argc =
+      arraylike_or_spread_index - JSCallOrConstructNode::FirstArgumentIndex();
+  for (int i = 0; i < array_length; ++i) {
+    Node* value = effect = graph()->NewNode(
+        simplified()->LoadElement(
+            AccessBuilder::ForFixedArrayElement(elements_kind)),
+        elements, jsgraph()->Constant(i), effect, control);
+    node->InsertInput(graph()->zone(),
+                      JSCallOrConstructNode::ArgumentIndex(argc++), value);
+  }
+  NodeProperties::ChangeOp(
+      node, javascript()->Call(JSCallNode::ArityForArgc(argc), frequency,
+                               feedback, ConvertReceiverMode::kAny,
+                               speculation_mode,
+                               CallFeedbackRelation::kUnrelated));
+  NodeProperties::ReplaceEffectInput(node, effect);
+  return Changed(node).FollowedBy(ReduceJSCall(node));
+}
+
 namespace {
 
 bool ShouldUseCallICFeedback(Node* node) {
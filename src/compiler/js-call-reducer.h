@@ -117,6 +117,9 @@ class V8_EXPORT_PRIVATE JSCallReducer final : public AdvancedReducer {
       Node* node, int arraylike_or_spread_index, CallFrequency const& frequency,
       FeedbackSource const& feedback, SpeculationMode speculation_mode,
       CallFeedbackRelation feedback_relation);
+  Reduction ReduceCallWithArrayLikeOrSpreadOfArrayLiteral(
+      Node* node, int arraylike_or_spread_index, CallFrequency const& frequency,
+      FeedbackSource const& feedback, SpeculationMode speculation_mode);
   Reduction ReduceJSConstruct(Node* node);
   Reduction ReduceJSConstructWithArrayLike(Node* node);
   Reduction ReduceJSConstructWithSpread(Node* node);
@@ -51,6 +51,16 @@ bool HasOnlyJSArrayMaps(JSHeapBroker* broker,
   return true;
 }
 
+bool HasOnlyJSProxyMaps(JSHeapBroker* broker,
+                        ZoneVector<Handle<Map>> const& maps) {
+  if (maps.empty()) return false;
+  for (auto map : maps) {
+    MapRef map_ref(broker, map);
+    if (map_ref.instance_type() != JS_PROXY_TYPE) return false;
+  }
+  return true;
+}
+
 }  // namespace
 
 bool JSNativeContextSpecialization::should_disallow_heap_access() const {
@@ -1129,6 +1139,13 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     }
   }
 
+  // Check if all {receiver_maps} are JSProxy maps, in which case the access
+  // calls the proxy builtins directly.
+  if (key == nullptr && HasOnlyJSProxyMaps(broker(), receiver_maps)) {
+    return ReduceProxyAccess(node, value, feedback.name(), receiver_maps,
+                             access_mode);
+  }
+
   ZoneVector<PropertyAccessInfo> access_infos(zone());
   {
     ZoneVector<PropertyAccessInfo> access_infos_for_feedback(zone());
@@ -1372,6 +1389,65 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
   return Replace(value);
 }
 
+Reduction JSNativeContextSpecialization::ReduceProxyAccess(
+    Node* node, Node* value, NameRef const& name,
+    ZoneVector<Handle<Map>> const& receiver_maps, AccessMode access_mode) {
+  Builtins::Name builtin;
+  if (node->opcode() == IrOpcode::kJSLoadNamed) {
+    DCHECK_EQ(AccessMode::kLoad, access_mode);
+    builtin = Builtins::kProxyGetProperty;
+  } else if (node->opcode() == IrOpcode::kJSStoreNamed) {
+    DCHECK_EQ(AccessMode::kStore, access_mode);
+    builtin = Builtins::kProxySetProperty;
+  } else {
+    return NoChange();
+  }
+  // Private symbols are never forwarded to the proxy handler.
+  if (name.object()->IsPrivate()) return NoChange();
+
+  Node* receiver = NodeProperties::GetValueInput(node, 0);
+  Node* context = NodeProperties::GetContextInput(node);
+  Node* frame_state = NodeProperties::GetFrameStateInput(node);
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+
+  PropertyAccessBuilder access_builder(jsgraph(), broker(), dependencies());
+  access_builder.BuildCheckMaps(receiver, &effect, control, receiver_maps);
+
+  // The proxy is both the holder and the receiver of the access.
+  Callable const callable = Builtins::CallableFor(isolate(), builtin);
+  auto call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(),
+      CallDescriptor::kNeedsFrameState);
+  Node* stub_code = jsgraph()->HeapConstant(callable.code());
+  Node* name_node = jsgraph()->Constant(name);
+  if (access_mode == AccessMode::kLoad) {
+    value = effect = control = graph()->NewNode(
+        common()->Call(call_descriptor), stub_code, receiver, name_node,
+        receiver,
+        jsgraph()->SmiConstant(
+            static_cast<int>(OnNonExistent::kReturnUndefined)),
+        context, frame_state, effect, control);
+  } else {
+    effect = control = graph()->NewNode(
+        common()->Call(call_descriptor), stub_code, receiver, name_node, value,
+        receiver, context, frame_state, effect, control);
+  }
+
+  // Rewire the IfException edge if {node} is inside a try-block.
+  Node* if_exception = nullptr;
+  if (NodeProperties::IsExceptionalCall(node, &if_exception)) {
+    Node* const on_exception =
+        graph()->NewNode(common()->IfException(), control, effect);
+    ReplaceWithValue(if_exception, on_exception, on_exception, on_exception);
+    control = graph()->NewNode(common()->IfSuccess(), control);
+  }
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 Reduction JSNativeContextSpecialization::ReduceJSLoadNamed(Node* node) {
   JSLoadNamedNode n(node);
   NamedAccess const& p = n.Parameters();
@@ -102,6 +102,9 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
   Reduction ReduceNamedAccess(Node* node, Node* value,
                               NamedAccessFeedback const& processed,
                               AccessMode access_mode, Node* key = nullptr);
+  Reduction ReduceProxyAccess(Node* node, Node* value, NameRef const& name,
+                              ZoneVector<Handle<Map>> const& receiver_maps,
+                              AccessMode access_mode);
   Reduction ReduceMinimorphicPropertyAccess(
       Node* node, Node* value,
       MinimorphicLoadPropertyAccessFeedback const& feedback,
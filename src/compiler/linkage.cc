@@ -254,6 +254,15 @@ CallDescriptor* Linkage::GetRuntimeCallDescriptor(
         flags & ~CallDescriptor::kNeedsFrameState);
   }
 
+  // Calls to runtime functions that never allocate don't end the current
+  // allocation group in the MemoryOptimizer, so allocations around them can
+  // still be folded, and stores into objects allocated before them still
+  // don't need write barriers.
+  if (!Runtime::MayAllocate(function_id)) {
+    flags = static_cast<CallDescriptor::Flags>(
+        flags | CallDescriptor::kNoAllocate);
+  }
+
   return GetCEntryStubCallDescriptor(zone, return_count, js_parameter_count,
                                      debug_name, properties, flags);
 }
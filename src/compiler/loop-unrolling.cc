@@ -0,0 +1,234 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-unrolling.h"
+
+#include <algorithm>
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/compiler-source-position-table.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/loop-peeling.h"
+#include "src/compiler/node-origin-table.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/zone/zone.h"
+
+// Loop unrolling copies the body of a loop {count} - 1 times and chains the
+// copies along the backedges. Beginning with a loop as follows:
+//
+//            entry
+//              |
+//      +---> Loop ---> ( phi )
+//      |       |
+//      |     body ---> exit
+//      |       |
+//      +-------+
+//
+// the backedges of the original body now lead into the first copy, whose
+// header values are the values the original body passes along its backedges.
+// Only the last copy flows back into the loop header:
+//
+//            entry
+//              |
+//      +---> Loop ---> ( phi )
+//      |       |
+//      |     body ---------> exit
+//      |       |              ^
+//      |     body' --------> Merge
+//      |       |              ^
+//      |     body'' ---------+
+//      |       |
+//      +-------+
+//
+// The LoopExit of the loop takes a merge of the exits of all copies as its
+// control input, and LoopExitValue and LoopExitEffect markers take phis of
+// the corresponding values, so the exits stay explicitly marked and the loop
+// can still be peeled afterwards.
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// static
+Node* LoopUnroller::Map(NodeMap* copies, Node* node) {
+  if (copies == nullptr) return node;
+  auto it = copies->find(node);
+  return it == copies->end() ? node : it->second;
+}
+
+void LoopUnroller::CopyHeader(LoopTree::Loop* loop, NodeMap* previous,
+                              NodeMap* copies) {
+  // The header of a copy is whatever the previous iteration passes along its
+  // backedges.
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  int backedges = loop_node->InputCount() - 1;
+  if (backedges == 1) {
+    for (Node* node : loop_tree_->HeaderNodes(loop)) {
+      (*copies)[node] = Map(previous, node->InputAt(1));
+    }
+    return;
+  }
+
+  // Multiple backedges need to be merged, along with the values flowing along
+  // them.
+  NodeVector inputs(tmp_zone_);
+  for (int i = 1; i < loop_node->InputCount(); i++) {
+    inputs.push_back(Map(previous, loop_node->InputAt(i)));
+  }
+  Node* merge =
+      graph_->NewNode(common_->Merge(backedges), backedges, inputs.data());
+  (*copies)[loop_node] = merge;
+
+  for (Node* node : loop_tree_->HeaderNodes(loop)) {
+    if (node->opcode() == IrOpcode::kLoop) continue;  // already done.
+    inputs.clear();
+    for (int i = 0; i < backedges; i++) {
+      inputs.push_back(Map(previous, node->InputAt(1 + i)));
+    }
+    Node* value = inputs[0];
+    for (Node* input : inputs) {
+      if (input != inputs[0]) {  // Non-redundant phi.
+        inputs.push_back(merge);
+        const Operator* op = common_->ResizeMergeOrPhi(node->op(), backedges);
+        value = graph_->NewNode(op, backedges + 1, inputs.data());
+        break;
+      }
+    }
+    (*copies)[node] = value;
+  }
+}
+
+void LoopUnroller::CopyBody(LoopTree::Loop* loop, NodeMap* copies) {
+  NodeVector inputs(tmp_zone_);
+  // Copy all the nodes first.
+  for (Node* node : loop_tree_->BodyNodes(loop)) {
+    SourcePositionTable::Scope position(
+        source_positions_, source_positions_->GetSourcePosition(node));
+    NodeOriginTable::Scope origin_scope(node_origins_, "unroll loop", node);
+    inputs.clear();
+    for (Node* input : node->inputs()) {
+      inputs.push_back(Map(copies, input));
+    }
+    Node* copy =
+        graph_->NewNode(node->op(), node->InputCount(), inputs.data());
+    if (NodeProperties::IsTyped(node)) {
+      NodeProperties::SetType(copy, NodeProperties::GetType(node));
+    }
+    (*copies)[node] = copy;
+  }
+
+  // Fix remaining inputs of the copies.
+  for (Node* original : loop_tree_->BodyNodes(loop)) {
+    Node* copy = (*copies)[original];
+    for (int i = 0; i < copy->InputCount(); i++) {
+      copy->ReplaceInput(i, Map(copies, original->InputAt(i)));
+    }
+  }
+}
+
+bool LoopUnroller::Unroll(LoopTree::Loop* loop, uint32_t count) {
+  DCHECK_LE(2, count);
+  LoopPeeler peeler(graph_, common_, loop_tree_, tmp_zone_, source_positions_,
+                    node_origins_);
+  if (!peeler.CanPeel(loop)) return false;
+
+  //============================================================================
+  // Construct the copies of the loop body, each one starting where the
+  // previous one takes a backedge.
+  //============================================================================
+  ZoneVector<NodeMap*> iterations(tmp_zone_);
+  NodeMap* previous = nullptr;
+  for (uint32_t i = 1; i < count; i++) {
+    NodeMap* copies = tmp_zone_->New<NodeMap>(tmp_zone_);
+    CopyHeader(loop, previous, copies);
+    CopyBody(loop, copies);
+    iterations.push_back(copies);
+    previous = copies;
+  }
+
+  //============================================================================
+  // Let the last copy, instead of the original body, take the backedges.
+  //============================================================================
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  for (Node* node : loop_tree_->HeaderNodes(loop)) {
+    for (int i = 1; i < loop_node->InputCount(); i++) {
+      node->ReplaceInput(i, Map(previous, node->InputAt(i)));
+    }
+  }
+
+  //============================================================================
+  // Merge the exits of all iterations into the exit markers.
+  //============================================================================
+  NodeVector inputs(tmp_zone_);
+  for (Node* exit : loop_tree_->ExitNodes(loop)) {
+    if (exit->opcode() != IrOpcode::kLoopExit) continue;
+    inputs.clear();
+    inputs.push_back(exit->InputAt(0));
+    for (NodeMap* copies : iterations) {
+      inputs.push_back(Map(copies, exit->InputAt(0)));
+    }
+    Node* merge = graph_->NewNode(common_->Merge(static_cast<int>(count)),
+                                  static_cast<int>(count), inputs.data());
+    exit->ReplaceInput(0, merge);
+  }
+  for (Node* exit : loop_tree_->ExitNodes(loop)) {
+    const Operator* op;
+    switch (exit->opcode()) {
+      case IrOpcode::kLoopExitValue:
+        op = common_->Phi(MachineRepresentation::kTagged,
+                          static_cast<int>(count));
+        break;
+      case IrOpcode::kLoopExitEffect:
+        op = common_->EffectPhi(static_cast<int>(count));
+        break;
+      default:
+        continue;
+    }
+    Node* merge = NodeProperties::GetControlInput(exit->InputAt(1));
+    inputs.clear();
+    inputs.push_back(exit->InputAt(0));
+    for (NodeMap* copies : iterations) {
+      inputs.push_back(Map(copies, exit->InputAt(0)));
+    }
+    inputs.push_back(merge);
+    Node* phi = graph_->NewNode(op, static_cast<int>(count) + 1, inputs.data());
+    exit->ReplaceInput(0, phi);
+  }
+  return true;
+}
+
+void LoopUnroller::UnrollInnerLoops(LoopTree::Loop* loop) {
+  // If the loop has nested loops, unroll inside those.
+  if (!loop->children().empty()) {
+    for (LoopTree::Loop* inner_loop : loop->children()) {
+      UnrollInnerLoops(inner_loop);
+    }
+    return;
+  }
+  // Only unroll small loops, as many times as fits into the size limit.
+  uint32_t count = static_cast<uint32_t>(
+      std::min(static_cast<size_t>(kMaxUnrollingCount),
+               kMaxUnrolledNodes / std::max<size_t>(loop->TotalSize(), 1)));
+  if (count < 2) return;
+  if (FLAG_trace_turbo_loop) {
+    PrintF("Unrolling loop %u times with header: ", count);
+    for (Node* node : loop_tree_->HeaderNodes(loop)) {
+      PrintF("%i ", node->id());
+    }
+    PrintF("\n");
+  }
+
+  Unroll(loop, count);
+}
+
+void LoopUnroller::UnrollInnerLoopsOfTree() {
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    UnrollInnerLoops(loop);
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
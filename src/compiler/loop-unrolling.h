@@ -0,0 +1,71 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_UNROLLING_H_
+#define V8_COMPILER_LOOP_UNROLLING_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/common/globals.h"
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class CommonOperatorBuilder;
+class NodeOriginTable;
+class SourcePositionTable;
+
+// Implements loop unrolling. The body of a loop is copied so that each trip
+// around the backedge executes several iterations. Every copy keeps its own
+// exit checks, so unrolling does not depend on the trip count being known; it
+// merely removes loop overhead and exposes the iterations to later
+// optimizations such as load elimination.
+class V8_EXPORT_PRIVATE LoopUnroller {
+ public:
+  LoopUnroller(Graph* graph, CommonOperatorBuilder* common,
+               LoopTree* loop_tree, Zone* tmp_zone,
+               SourcePositionTable* source_positions,
+               NodeOriginTable* node_origins)
+      : graph_(graph),
+        common_(common),
+        loop_tree_(loop_tree),
+        tmp_zone_(tmp_zone),
+        source_positions_(source_positions),
+        node_origins_(node_origins) {}
+
+  // Unrolls {loop} so that its body appears {count} times. Returns false if
+  // the loop cannot be unrolled because it has unmarked exits.
+  bool Unroll(LoopTree::Loop* loop, uint32_t count);
+  void UnrollInnerLoopsOfTree();
+
+  // Innermost loops are unrolled as long as the unrolled loop stays within
+  // this size.
+  static const size_t kMaxUnrolledNodes = 200;
+  static const uint32_t kMaxUnrollingCount = 4;
+
+ private:
+  using NodeMap = ZoneUnorderedMap<Node*, Node*>;
+
+  Graph* const graph_;
+  CommonOperatorBuilder* const common_;
+  LoopTree* const loop_tree_;
+  Zone* const tmp_zone_;
+  SourcePositionTable* const source_positions_;
+  NodeOriginTable* const node_origins_;
+
+  // Returns the copy of {node} in {copies}, or {node} itself if it was not
+  // copied. A null {copies} stands for the original loop body.
+  static Node* Map(NodeMap* copies, Node* node);
+
+  void UnrollInnerLoops(LoopTree::Loop* loop);
+  void CopyHeader(LoopTree::Loop* loop, NodeMap* previous, NodeMap* copies);
+  void CopyBody(LoopTree::Loop* loop, NodeMap* copies);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_UNROLLING_H_
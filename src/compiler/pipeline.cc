@@ -57,6 +57,7 @@
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
 #include "src/compiler/loop-peeling.h"
+#include "src/compiler/loop-unrolling.h"
 #include "src/compiler/loop-variable-optimizer.h"
 #include "src/compiler/machine-graph-verifier.h"
 #include "src/compiler/machine-operator-reducer.h"
@@ -78,6 +79,7 @@
 #include "src/compiler/typed-optimization.h"
 #include "src/compiler/typer.h"
 #include "src/compiler/value-numbering-reducer.h"
+#include "src/compiler/vectorization-analysis.h"
 #include "src/compiler/verifier.h"
 #include "src/compiler/wasm-compiler.h"
 #include "src/compiler/zone-stats.h"
@@ -1114,10 +1116,35 @@ class PipelineJobScope {
  private:
   PipelineData* data_;
 };
+
+// Accounts the duration of a job phase that runs on the main thread to the
+// main thread line of --turbo-stats. Without --concurrent-inlining this
+// includes serialization for the heap broker and graph building.
+class MainThreadStatsScope {
+ public:
+  explicit MainThreadStatsScope(Isolate* isolate)
+      : stats_(FLAG_turbo_stats || FLAG_turbo_stats_nvp
+                   ? isolate->GetTurboStatistics()
+                   : nullptr) {
+    if (stats_ != nullptr) timer_.Start();
+  }
+
+  ~MainThreadStatsScope() {
+    if (stats_ == nullptr) return;
+    CompilationStatistics::BasicStats diff;
+    diff.delta_ = timer_.Elapsed();
+    stats_->RecordMainThreadStats(diff);
+  }
+
+ private:
+  CompilationStatistics* const stats_;
+  base::ElapsedTimer timer_;
+};
 }  // namespace
 
 PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
     Isolate* isolate) {
+  MainThreadStatsScope main_thread_stats_scope(isolate);
   // Ensure that the RuntimeCallStats table of main thread is available for
   // phases happening during PrepareJob.
   PipelineJobScope scope(&data_, isolate->counters()->runtime_call_stats());
@@ -1229,6 +1256,7 @@ PipelineCompilationJob::Status PipelineCompilationJob::ExecuteJobImpl(
 
 PipelineCompilationJob::Status PipelineCompilationJob::FinalizeJobImpl(
     Isolate* isolate) {
+  MainThreadStatsScope main_thread_stats_scope(isolate);
   // Ensure that the RuntimeCallStats table of main thread is available for
   // phases happening during PrepareJob.
   PipelineJobScope scope(&data_, isolate->counters()->runtime_call_stats());
@@ -1707,6 +1735,33 @@ struct LoopPeelingPhase {
   }
 };
 
+struct LoopUnrollingPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(LoopUnrolling)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    trimmer.TrimGraph(roots.begin(), roots.end());
+
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(
+        data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+    LoopUnroller(data->graph(), data->common(), loop_tree, temp_zone,
+                 data->source_positions(), data->node_origins())
+        .UnrollInnerLoopsOfTree();
+  }
+};
+
+struct VectorizationAnalysisPhase {
+  DECL_PIPELINE_PHASE_CONSTANTS(VectorizationAnalysis)
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(
+        data->jsgraph()->graph(), &data->info()->tick_counter(), temp_zone);
+    VectorizationAnalysis(loop_tree, temp_zone).Run();
+  }
+};
+
 struct LoopExitEliminationPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(LoopExitElimination)
 
@@ -1732,10 +1787,14 @@ struct GenericLoweringPhase {
 struct EarlyOptimizationPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(EarlyOptimization)
 
-  void Run(PipelineData* data, Zone* temp_zone) {
+  void Run(PipelineData* data, Zone* temp_zone, bool lower_generic) {
     GraphReducer graph_reducer(temp_zone, data->graph(),
                                &data->info()->tick_counter(),
                                data->jsgraph()->Dead());
+    // Generic lowering goes first, so that the other reducers only ever see
+    // the lowered calls.
+    JSGenericLowering generic_lowering(data->jsgraph(), &graph_reducer,
+                                       data->broker());
     DeadCodeElimination dead_code_elimination(&graph_reducer, data->graph(),
                                               data->common(), temp_zone);
     SimplifiedOperatorReducer simple_reducer(&graph_reducer, data->jsgraph(),
@@ -1746,6 +1805,7 @@ struct EarlyOptimizationPhase {
     CommonOperatorReducer common_reducer(&graph_reducer, data->graph(),
                                          data->broker(), data->common(),
                                          data->machine(), temp_zone);
+    if (lower_generic) AddReducer(data, &graph_reducer, &generic_lowering);
     AddReducer(data, &graph_reducer, &dead_code_elimination);
     AddReducer(data, &graph_reducer, &simple_reducer);
     AddReducer(data, &graph_reducer, &redundancy_elimination);
@@ -2123,6 +2183,22 @@ std::ostream& operator<<(std::ostream& out, const InstructionRangesAsJSON& s) {
   return out;
 }
 
+namespace {
+
+// Instruction scheduling is always on with --turbo-instruction-scheduling.
+// Otherwise it is on for optimized JavaScript and wasm code if the host has a
+// tuned latency model. Builtins and stubs are never scheduled by default, so
+// that the snapshot does not depend on the machine that built it.
+bool ShouldScheduleInstructions(OptimizedCompilationInfo* info) {
+  if (FLAG_turbo_instruction_scheduling) return true;
+  return FLAG_turbo_tuned_instruction_scheduling &&
+         (info->IsOptimizing() || info->IsWasm()) &&
+         InstructionScheduler::HostMicroArchitecture() !=
+             InstructionScheduler::MicroArchitecture::kGeneric;
+}
+
+}  // namespace
+
 struct InstructionSelectionPhase {
   DECL_PIPELINE_PHASE_CONSTANTS(SelectInstructions)
 
@@ -2140,7 +2216,7 @@ struct InstructionSelectionPhase {
             ? InstructionSelector::kAllSourcePositions
             : InstructionSelector::kCallSourcePositions,
         InstructionSelector::SupportedFeatures(),
-        FLAG_turbo_instruction_scheduling
+        ShouldScheduleInstructions(data->info())
             ? InstructionSelector::kEnableScheduling
             : InstructionSelector::kDisableScheduling,
         data->roots_relative_addressing_enabled()
@@ -2549,6 +2625,87 @@ bool PipelineImpl::CreateGraph() {
   return true;
 }
 
+namespace {
+
+// Compute a hash of the given graph, in a way that should provide the same
+// result in multiple runs of mksnapshot, meaning the hash cannot depend on any
+// external pointer values or uncompressed heap constants. This hash can be used
+// to reject profiling data if the builtin's current code doesn't match the
+// version that was profiled. Hash collisions are not catastrophic; in the worst
+// case, we just defer some blocks that ideally shouldn't be deferred. The
+// result value is in the valid Smi range.
+int HashGraphForPGO(Graph* graph) {
+  AccountingAllocator allocator;
+  Zone local_zone(&allocator, ZONE_NAME);
+
+  constexpr NodeId kUnassigned = static_cast<NodeId>(-1);
+
+  constexpr byte kUnvisited = 0;
+  constexpr byte kOnStack = 1;
+  constexpr byte kVisited = 2;
+
+  // Do a depth-first post-order traversal of the graph. For every node, hash:
+  //
+  //   - the node's traversal number
+  //   - the opcode
+  //   - the number of inputs
+  //   - each input node's traversal number
+  //
+  // What's a traversal number? We can't use node IDs because they're not stable
+  // build-to-build, so we assign a new number for each node as it is visited.
+
+  ZoneVector<byte> state(graph->NodeCount(), kUnvisited, &local_zone);
+  ZoneVector<NodeId> traversal_numbers(graph->NodeCount(), kUnassigned,
+                                       &local_zone);
+  ZoneStack<Node*> stack(&local_zone);
+
+  NodeId visited_count = 0;
+  size_t hash = 0;
+
+  stack.push(graph->end());
+  state[graph->end()->id()] = kOnStack;
+  traversal_numbers[graph->end()->id()] = visited_count++;
+  while (!stack.empty()) {
+    Node* n = stack.top();
+    bool pop = true;
+    for (Node* const i : n->inputs()) {
+      if (state[i->id()] == kUnvisited) {
+        state[i->id()] = kOnStack;
+        traversal_numbers[i->id()] = visited_count++;
+        stack.push(i);
+        pop = false;
+        break;
+      }
+    }
+    if (pop) {
+      state[n->id()] = kVisited;
+      stack.pop();
+      hash = base::hash_combine(hash, traversal_numbers[n->id()], n->opcode(),
+                                n->InputCount());
+      for (Node* const i : n->inputs()) {
+        DCHECK(traversal_numbers[i->id()] != kUnassigned);
+        hash = base::hash_combine(hash, traversal_numbers[i->id()]);
+      }
+    }
+  }
+  return Smi(IntToSmi(static_cast<int>(hash))).value();
+}
+
+// Optimized JavaScript functions don't have unique debug names, so their basic
+// block counters are logged and looked up under a name that also includes the
+// graph hash. Functions whose graph changed simply find no profile.
+std::unique_ptr<char[]> ProfileNameForJSFunction(const char* debug_name,
+                                                 int graph_hash) {
+  std::ostringstream os;
+  os << debug_name << "#" << graph_hash;
+  std::string name = os.str();
+  std::unique_ptr<char[]> result(new char[name.size() + 1]);
+  memcpy(result.get(), name.c_str(), name.size() + 1);
+  return result;
+}
+
+}  // namespace
+
 bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   PipelineData* data = this->data_;
 
@@ -2562,6 +2719,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<TypedLoweringPhase>();
   RunPrintAndVerify(TypedLoweringPhase::phase_name());
 
+  if (FLAG_turbo_loop_unrolling) {
+    Run<LoopUnrollingPhase>();
+    RunPrintAndVerify(LoopUnrollingPhase::phase_name(), true);
+  }
+
   if (data->info()->loop_peeling()) {
     Run<LoopPeelingPhase>();
     RunPrintAndVerify(LoopPeelingPhase::phase_name(), true);
@@ -2574,6 +2736,10 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
+
+  if (FLAG_trace_turbo_vectorization) {
+    Run<VectorizationAnalysisPhase>();
+  }
   data->DeleteTyper();
 
   if (FLAG_turbo_escape) {
@@ -2610,14 +2776,17 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   RunPrintAndVerify(UntyperPhase::phase_name(), true);
 #endif
 
-  // Run generic lowering pass.
-  Run<GenericLoweringPhase>();
-  RunPrintAndVerify(GenericLoweringPhase::phase_name(), true);
+  // Run generic lowering pass, unless it is fused into early optimization,
+  // which saves a full traversal of the graph.
+  if (!FLAG_turbo_fuse_generic_lowering) {
+    Run<GenericLoweringPhase>();
+    RunPrintAndVerify(GenericLoweringPhase::phase_name(), true);
+  }
 
   data->BeginPhaseKind("V8.TFBlockBuilding");
 
   // Run early optimization pass.
-  Run<EarlyOptimizationPhase>();
+  Run<EarlyOptimizationPhase>(FLAG_turbo_fuse_generic_lowering);
   RunPrintAndVerify(EarlyOptimizationPhase::phase_name(), true);
 
   Run<EffectControlLinearizationPhase>();
@@ -2655,9 +2824,28 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     data->node_origins()->RemoveDecorator();
   }
 
+  // Use basic block counters from a previous run, if any, to let the scheduler
+  // defer rarely executed blocks, as is done for builtins.
+  int graph_hash_before_scheduling = 0;
+  std::unique_ptr<char[]> profile_name;
+  if (FLAG_turbo_profiling || FLAG_turbo_profiling_log_file != nullptr) {
+    graph_hash_before_scheduling = HashGraphForPGO(data->graph());
+    profile_name = ProfileNameForJSFunction(data->debug_name(),
+                                            graph_hash_before_scheduling);
+  }
+  if (FLAG_turbo_profiling_log_file != nullptr) {
+    data->set_profile_data(ProfileDataFromFile::TryRead(profile_name.get()));
+  }
+
   ComputeScheduledGraph();
 
-  return SelectInstructions(linkage);
+  if (!SelectInstructions(linkage)) return false;
+
+  if (info()->profiler_data() != nullptr) {
+    info()->profiler_data()->SetHash(graph_hash_before_scheduling);
+    info()->profiler_data()->SetFunctionName(std::move(profile_name));
+  }
+  return true;
 }
 
 bool PipelineImpl::OptimizeGraphForMidTier(Linkage* linkage) {
@@ -2731,74 +2919,6 @@ bool PipelineImpl::OptimizeGraphForMidTier(Linkage* linkage) {
   return SelectInstructions(linkage);
 }
 
-namespace {
-
-// Compute a hash of the given graph, in a way that should provide the same
-// result in multiple runs of mksnapshot, meaning the hash cannot depend on any
-// external pointer values or uncompressed heap constants. This hash can be used
-// to reject profiling data if the builtin's current code doesn't match the
-// version that was profiled. Hash collisions are not catastrophic; in the worst
-// case, we just defer some blocks that ideally shouldn't be deferred. The
-// result value is in the valid Smi range.
-int HashGraphForPGO(Graph* graph) {
-  AccountingAllocator allocator;
-  Zone local_zone(&allocator, ZONE_NAME);
-
-  constexpr NodeId kUnassigned = static_cast<NodeId>(-1);
-
-  constexpr byte kUnvisited = 0;
-  constexpr byte kOnStack = 1;
-  constexpr byte kVisited = 2;
-
-  // Do a depth-first post-order traversal of the graph. For every node, hash:
-  //
-  //   - the node's traversal number
-  //   - the opcode
-  //   - the number of inputs
-  //   - each input node's traversal number
-  //
-  // What's a traversal number? We can't use node IDs because they're not stable
-  // build-to-build, so we assign a new number for each node as it is visited.
-
-  ZoneVector<byte> state(graph->NodeCount(), kUnvisited, &local_zone);
-  ZoneVector<NodeId> traversal_numbers(graph->NodeCount(), kUnassigned,
-                                       &local_zone);
-  ZoneStack<Node*> stack(&local_zone);
-
-  NodeId visited_count = 0;
-  size_t hash = 0;
-
-  stack.push(graph->end());
-  state[graph->end()->id()] = kOnStack;
-  traversal_numbers[graph->end()->id()] = visited_count++;
-  while (!stack.empty()) {
-    Node* n = stack.top();
-    bool pop = true;
-    for (Node* const i : n->inputs()) {
-      if (state[i->id()] == kUnvisited) {
-        state[i->id()] = kOnStack;
-        traversal_numbers[i->id()] = visited_count++;
-        stack.push(i);
-        pop = false;
-        break;
-      }
-    }
-    if (pop) {
-      state[n->id()] = kVisited;
-      stack.pop();
-      hash = base::hash_combine(hash, traversal_numbers[n->id()], n->opcode(),
-                                n->InputCount());
-      for (Node* const i : n->inputs()) {
-        DCHECK(traversal_numbers[i->id()] != kUnassigned);
-        hash = base::hash_combine(hash, traversal_numbers[i->id()]);
-      }
-    }
-  }
-  return Smi(IntToSmi(static_cast<int>(hash))).value();
-}
-
-}  // namespace
-
 MaybeHandle<Code> Pipeline::GenerateCodeForCodeStub(
     Isolate* isolate, CallDescriptor* call_descriptor, Graph* graph,
     JSGraph* jsgraph, SourcePositionTable* source_positions, Code::Kind kind,
@@ -3278,6 +3398,19 @@ void PipelineImpl::ComputeScheduledGraph() {
   TraceScheduleAndVerify(data->info(), data, data->schedule(), "schedule");
 }
 
+namespace {
+
+// The linear-scan allocator is superlinear in the number of instructions and
+// dominates compile time for huge functions. Above the threshold, the cheaper
+// mid-tier allocator is used at the cost of somewhat worse code.
+bool UseMidTierRegisterAllocatorForSize(InstructionSequence* sequence) {
+  if (FLAG_turbo_mid_tier_reg_alloc_threshold <= 0) return false;
+  return sequence->instructions().size() >=
+         static_cast<size_t>(FLAG_turbo_mid_tier_reg_alloc_threshold);
+}
+
+}  // namespace
+
 bool PipelineImpl::SelectInstructions(Linkage* linkage) {
   auto call_descriptor = linkage->GetIncomingDescriptor();
   PipelineData* data = this->data_;
@@ -3288,7 +3421,8 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
 
   if (FLAG_turbo_profiling) {
     data->info()->set_profiler_data(BasicBlockInstrumentor::Instrument(
-        info(), data->graph(), data->schedule(), data->isolate()));
+        info(), data->graph(), data->schedule(), data->source_positions(),
+        data->isolate()));
   }
 
   bool verify_stub_graph =
@@ -3384,7 +3518,8 @@ bool PipelineImpl::SelectInstructions(Linkage* linkage) {
       config = RegisterConfiguration::Default();
     }
 
-    if (FLAG_turboprop_mid_tier_reg_alloc) {
+    if (FLAG_turboprop_mid_tier_reg_alloc ||
+        UseMidTierRegisterAllocatorForSize(data->sequence())) {
       AllocateRegistersForMidTier(config, call_descriptor, run_verifier);
     } else {
       AllocateRegistersForTopTier(config, call_descriptor, run_verifier);
@@ -1706,8 +1706,10 @@ class RepresentationSelector {
     }
   }
 
-  static MachineType MachineTypeFor(CTypeInfo::Type type) {
-    switch (type) {
+  static MachineType MachineTypeFor(const CTypeInfo& type_info) {
+    // Typed arrays are passed as a pointer to a FastApiTypedArray.
+    if (type_info.IsTypedArray()) return MachineType::Pointer();
+    switch (type_info.GetType()) {
       case CTypeInfo::Type::kVoid:
         return MachineType::AnyTagged();
       case CTypeInfo::Type::kBool:
@@ -1726,12 +1728,20 @@ class RepresentationSelector {
         return MachineType::Float64();
       case CTypeInfo::Type::kV8Value:
         return MachineType::AnyTagged();
+      case CTypeInfo::Type::kUint8:
+        return MachineType::Uint8();
+      case CTypeInfo::Type::kOneByteString:
+        return MachineType::Pointer();
     }
   }
 
-  UseInfo UseInfoForFastApiCallArgument(CTypeInfo::Type type,
+  UseInfo UseInfoForFastApiCallArgument(const CTypeInfo& type_info,
                                         FeedbackSource const& feedback) {
-    switch (type) {
+    // Typed arrays and strings are checked and unpacked by the
+    // EffectControlLinearizer, which falls back to the slow call if the
+    // argument does not match.
+    if (type_info.IsTypedArray()) return UseInfo::AnyTagged();
+    switch (type_info.GetType()) {
       case CTypeInfo::Type::kVoid:
         UNREACHABLE();
       case CTypeInfo::Type::kBool:
@@ -1752,7 +1762,10 @@ class RepresentationSelector {
       case CTypeInfo::Type::kUint64:
         return UseInfo::Word64();
       case CTypeInfo::Type::kV8Value:
+      case CTypeInfo::Type::kOneByteString:
         return UseInfo::AnyTagged();
+      case CTypeInfo::Type::kUint8:
+        UNREACHABLE();
     }
   }
 
@@ -1777,7 +1790,7 @@ class RepresentationSelector {
     // Propagate representation information from TypeInfo.
     for (int i = 0; i < c_arg_count; i++) {
       arg_use_info[i] = UseInfoForFastApiCallArgument(
-          c_signature->ArgumentInfo(i).GetType(), op_params.feedback());
+          c_signature->ArgumentInfo(i), op_params.feedback());
       ProcessInput<T>(node, i + FastApiCallNode::kFastTargetInputCount,
                       arg_use_info[i]);
     }
@@ -1798,8 +1811,7 @@ class RepresentationSelector {
     }
     ProcessRemainingInputs<T>(node, value_input_count);
 
-    MachineType return_type =
-        MachineTypeFor(c_signature->ReturnInfo().GetType());
+    MachineType return_type = MachineTypeFor(c_signature->ReturnInfo());
     SetOutput<T>(node, return_type.representation());
   }
 
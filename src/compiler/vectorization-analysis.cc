@@ -0,0 +1,142 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/vectorization-analysis.h"
+
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+bool IsOne(Node* node) {
+  if (node->opcode() == IrOpcode::kNumberConstant) {
+    return NumberMatcher(node).Is(1);
+  }
+  return Int32Matcher(node).Is(1);
+}
+
+// Checks whether {node} computes {phi} + 1.
+bool IsUnitIncrement(Node* node, Node* phi) {
+  switch (node->opcode()) {
+    case IrOpcode::kInt32Add:
+    case IrOpcode::kNumberAdd:
+    case IrOpcode::kSpeculativeNumberAdd:
+    case IrOpcode::kSpeculativeSafeIntegerAdd: {
+      Node* left = NodeProperties::GetValueInput(node, 0);
+      Node* right = NodeProperties::GetValueInput(node, 1);
+      return (left == phi && IsOne(right)) || (right == phi && IsOne(left));
+    }
+    default:
+      return false;
+  }
+}
+
+bool IsVectorizableElementType(ExternalArrayType type) {
+  switch (type) {
+    case kExternalInt32Array:
+    case kExternalFloat32Array:
+    case kExternalFloat64Array:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+const char* VectorizationAnalysis::Analyze(LoopTree::Loop* loop,
+                                           Candidate* candidate) {
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  if (loop_node->InputCount() != 2) return "multiple backedges";
+
+  candidate->loop = loop_node;
+  candidate->induction_variable = nullptr;
+  for (Node* node : loop_tree_->HeaderNodes(loop)) {
+    if (node->opcode() == IrOpcode::kPhi &&
+        IsUnitIncrement(node->InputAt(1), node)) {
+      candidate->induction_variable = node;
+      break;
+    }
+  }
+  if (candidate->induction_variable == nullptr) {
+    return "no unit-stride induction variable";
+  }
+
+  bool has_element_type = false;
+  candidate->loads = 0;
+  candidate->stores = 0;
+  for (Node* node : loop_tree_->BodyNodes(loop)) {
+    ExternalArrayType type;
+    switch (node->opcode()) {
+      case IrOpcode::kLoadTypedElement:
+        type = ExternalArrayTypeOf(node->op());
+        candidate->loads++;
+        break;
+      case IrOpcode::kStoreTypedElement:
+        type = ExternalArrayTypeOf(node->op());
+        candidate->stores++;
+        break;
+      case IrOpcode::kJSStackCheck:
+        continue;
+      default:
+        // Loads, checks and speculative arithmetic are fine, anything else
+        // with side effects is not.
+        if (node->op()->EffectOutputCount() > 0 &&
+            !node->op()->HasProperty(Operator::kNoWrite)) {
+          return "side effects other than typed array stores";
+        }
+        continue;
+    }
+    if (!IsVectorizableElementType(type)) return "unsupported element type";
+    if (has_element_type && type != candidate->element_type) {
+      return "mixed element types";
+    }
+    candidate->element_type = type;
+    has_element_type = true;
+  }
+  if (!has_element_type) return "no typed array element accesses";
+  return nullptr;
+}
+
+void VectorizationAnalysis::AnalyzeInnerLoops(LoopTree::Loop* loop) {
+  // Only innermost loops are vectorized.
+  if (!loop->children().empty()) {
+    for (LoopTree::Loop* inner_loop : loop->children()) {
+      AnalyzeInnerLoops(inner_loop);
+    }
+    return;
+  }
+  Candidate candidate;
+  const char* reason = Analyze(loop, &candidate);
+  if (FLAG_trace_turbo_vectorization) {
+    Node* loop_node = loop_tree_->GetLoopControl(loop);
+    if (reason == nullptr) {
+      PrintF(
+          "Loop %i is vectorizable: induction variable %i, element type %d, "
+          "%d loads, %d stores\n",
+          loop_node->id(), candidate.induction_variable->id(),
+          static_cast<int>(candidate.element_type), candidate.loads,
+          candidate.stores);
+    } else {
+      PrintF("Loop %i is not vectorizable: %s\n", loop_node->id(), reason);
+    }
+  }
+  if (reason == nullptr) candidates_.push_back(candidate);
+}
+
+void VectorizationAnalysis::Run() {
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    AnalyzeInnerLoops(loop);
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,51 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_VECTORIZATION_ANALYSIS_H_
+#define V8_COMPILER_VECTORIZATION_ANALYSIS_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/common/globals.h"
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Finds innermost loops that a vectorizer could turn into SIMD code: loops
+// with a single backedge and a unit-stride induction variable, whose only
+// memory accesses are typed array element accesses of one 32-bit or 64-bit
+// element type, and that neither call out nor write anything else.
+class V8_EXPORT_PRIVATE VectorizationAnalysis {
+ public:
+  struct Candidate {
+    Node* loop;
+    Node* induction_variable;
+    ExternalArrayType element_type;
+    int loads;
+    int stores;
+  };
+
+  VectorizationAnalysis(LoopTree* loop_tree, Zone* zone)
+      : loop_tree_(loop_tree), candidates_(zone) {}
+
+  void Run();
+
+  const ZoneVector<Candidate>& candidates() const { return candidates_; }
+
+ private:
+  void AnalyzeInnerLoops(LoopTree::Loop* loop);
+  // Returns nullptr and fills in {candidate} if {loop} is vectorizable, or
+  // returns the reason why it is not.
+  const char* Analyze(LoopTree::Loop* loop, Candidate* candidate);
+
+  LoopTree* const loop_tree_;
+  ZoneVector<Candidate> candidates_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_VECTORIZATION_ANALYSIS_H_
@@ -2818,6 +2818,34 @@ void WasmGraphBuilder::LoadIndirectFunctionTable(uint32_t table_index,
                                                  Node** ift_sig_ids,
                                                  Node** ift_targets,
                                                  Node** ift_instances) {
+  if (table_index == 0 && env_->module->tables[0].has_fixed_size()) {
+    // The size of the table and its backing arrays never change, so the size
+    // is a constant and the arrays are loaded only once per graph. Like
+    // {globals_start_}, the loads can then be placed anywhere by the
+    // scheduler, which lets all indirect calls of the function share them.
+    *ift_size = mcgraph()->Int32Constant(env_->module->tables[0].initial_size);
+    auto load_once = [this](SetOncePointer<Node>* node, MachineType type,
+                            int offset) {
+      if (*node == nullptr) {
+        *node = graph()->NewNode(mcgraph()->machine()->Load(type),
+                                 instance_node_.get(),
+                                 mcgraph()->Int32Constant(offset),
+                                 graph()->start(), graph()->start());
+      }
+      return node->get();
+    };
+    *ift_sig_ids = load_once(
+        &ift_sig_ids_, MachineType::Pointer(),
+        WASM_INSTANCE_OBJECT_OFFSET(IndirectFunctionTableSigIds));
+    *ift_targets = load_once(
+        &ift_targets_, MachineType::Pointer(),
+        WASM_INSTANCE_OBJECT_OFFSET(IndirectFunctionTableTargets));
+    *ift_instances = load_once(
+        &ift_instances_, MachineType::TaggedPointer(),
+        WASM_INSTANCE_OBJECT_OFFSET(IndirectFunctionTableRefs));
+    return;
+  }
+
   if (table_index == 0) {
     *ift_size =
         LOAD_INSTANCE_FIELD(IndirectFunctionTableSize, MachineType::Uint32());
@@ -3492,6 +3520,39 @@ Node* WasmGraphBuilder::CheckBoundsAndAlignment(
   return index;
 }
 
+namespace {
+// Returns an upper bound of the 32-bit {index}, derived from the operation
+// computing it. Indices that are masked, shifted or reduced by a constant are
+// common in loops over ring buffers and hash tables, and often need no
+// dynamic bounds check at all.
+uint32_t IndexUpperBound(Node* index) {
+  switch (index->opcode()) {
+    case IrOpcode::kInt32Constant:
+      return static_cast<uint32_t>(OpParameter<int32_t>(index->op()));
+    case IrOpcode::kWord32And: {
+      Uint32BinopMatcher m(index);
+      if (m.right().HasValue()) return m.right().Value();
+      break;
+    }
+    case IrOpcode::kWord32Shr: {
+      Uint32BinopMatcher m(index);
+      if (m.right().HasValue()) return kMaxUInt32 >> (m.right().Value() & 31);
+      break;
+    }
+    case IrOpcode::kUint32Mod: {
+      Uint32BinopMatcher m(index);
+      if (m.right().HasValue() && m.right().Value() != 0) {
+        return m.right().Value() - 1;
+      }
+      break;
+    }
+    default:
+      break;
+  }
+  return kMaxUInt32;
+}
+}  // namespace
+
 // Insert code to bounds check a memory access if necessary. Return the
 // bounds-checked index, which is guaranteed to have (the equivalent of)
 // {uintptr_t} representation.
@@ -3500,6 +3561,7 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
                                        wasm::WasmCodePosition position,
                                        EnforceBoundsCheck enforce_check) {
   DCHECK_LE(1, access_size);
+  uint32_t index_upper_bound = IndexUpperBound(index);
   index = Uint32ToUintptr(index);
   if (!FLAG_wasm_bounds_checks) return index;
 
@@ -3533,15 +3595,12 @@ Node* WasmGraphBuilder::BoundsCheckMem(uint8_t access_size, Node* index,
     TrapIfFalse(wasm::kTrapMemOutOfBounds, cond, position);
   } else {
     // The end offset is smaller than the smallest memory, so only one check is
-    // required. Check to see if the index is also a constant.
-    UintPtrMatcher match(index);
-    if (match.HasValue()) {
-      uintptr_t index_val = match.Value();
-      if (index_val < env_->min_memory_size - end_offset) {
-        // The input index is a constant and everything is statically within
-        // bounds of the smallest possible memory.
-        return index;
-      }
+    // required. Check to see if the index is also bounded statically.
+    if (index_upper_bound < env_->min_memory_size - end_offset) {
+      // The input index is a constant or bounded by its computation, and
+      // everything is statically within bounds of the smallest possible
+      // memory.
+      return index;
     }
   }
 
@@ -5397,6 +5456,23 @@ void AssertFalse(GraphAssembler* gasm, Node* condition) {
 #endif
 }
 
+Node* WasmGraphBuilder::BuildIsRttSubtype(Node* map, Node* rtt) {
+  // Most casts succeed on an exact match, so check for that inline and only
+  // call the builtin to look {rtt} up among the supertypes of {map}.
+  auto check_subtype = gasm_->MakeDeferredLabel();
+  auto done = gasm_->MakeLabel(MachineRepresentation::kWord32);
+  gasm_->GotoIfNot(gasm_->TaggedEqual(map, rtt), &check_subtype);
+  gasm_->Goto(&done, gasm_->Int32Constant(1));
+
+  gasm_->Bind(&check_subtype);
+  gasm_->Goto(&done, BuildChangeSmiToInt32(CALL_BUILTIN(
+                         WasmIsRttSubtype, map, rtt,
+                         LOAD_INSTANCE_FIELD(NativeContext,
+                                             MachineType::TaggedPointer()))));
+  gasm_->Bind(&done);
+  return done.PhiAt(0);
+}
+
 Node* WasmGraphBuilder::RefTest(Node* object, Node* rtt,
                                 CheckForNull null_check, CheckForI31 i31_check,
                                 RttIsI31 rtt_is_i31) {
@@ -5419,10 +5495,7 @@ Node* WasmGraphBuilder::RefTest(Node* object, Node* rtt,
 
   Node* map = gasm_->Load(MachineType::TaggedPointer(), object,
                           HeapObject::kMapOffset - kHeapObjectTag);
-  // TODO(7748): Add a fast path for map == rtt.
-  Node* subtype_check = BuildChangeSmiToInt32(CALL_BUILTIN(
-      WasmIsRttSubtype, map, rtt,
-      LOAD_INSTANCE_FIELD(NativeContext, MachineType::TaggedPointer())));
+  Node* subtype_check = BuildIsRttSubtype(map, rtt);
 
   if (need_done_label) {
     gasm_->Goto(&done, subtype_check);
@@ -5452,10 +5525,7 @@ Node* WasmGraphBuilder::RefCast(Node* object, Node* rtt,
   }
   Node* map = gasm_->Load(MachineType::TaggedPointer(), object,
                           HeapObject::kMapOffset - kHeapObjectTag);
-  // TODO(7748): Add a fast path for map == rtt.
-  Node* check_result = BuildChangeSmiToInt32(CALL_BUILTIN(
-      WasmIsRttSubtype, map, rtt,
-      LOAD_INSTANCE_FIELD(NativeContext, MachineType::TaggedPointer())));
+  Node* check_result = BuildIsRttSubtype(map, rtt);
   TrapIfFalse(wasm::kTrapIllegalCast, check_result, position);
   return object;
 }
@@ -5500,10 +5570,7 @@ Node* WasmGraphBuilder::BrOnCast(Node* object, Node* rtt,
   // At this point, {object} is neither null nor an i31ref/Smi.
   Node* map = gasm_->Load(MachineType::TaggedPointer(), object,
                           HeapObject::kMapOffset - kHeapObjectTag);
-  // TODO(7748): Add a fast path for map == rtt.
-  Node* subtype_check = BuildChangeSmiToInt32(CALL_BUILTIN(
-      WasmIsRttSubtype, map, rtt,
-      LOAD_INSTANCE_FIELD(NativeContext, MachineType::TaggedPointer())));
+  Node* subtype_check = BuildIsRttSubtype(map, rtt);
   Node* cast_branch =
       graph()->NewNode(mcgraph()->common()->Branch(BranchHint::kFalse),
                        subtype_check, control());
@@ -5765,6 +5832,13 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
     return done.PhiAt(0);
   }
 
+  Node* BuildTestSmi(Node* value) {
+    return gasm_->Word32Equal(
+        gasm_->Word32And(BuildTruncateIntPtrToInt32(value),
+                         gasm_->Int32Constant(kSmiTagMask)),
+        gasm_->Int32Constant(0));
+  }
+
   Node* BuildChangeTaggedToInt32(Node* value, Node* context) {
     // We expect most integers at runtime to be Smis, so it is important for
     // wrapper performance that Smi conversion be inlined.
@@ -5772,11 +5846,7 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
     auto done = gasm_->MakeLabel(MachineRepresentation::kWord32);
 
     // Test if value is a Smi.
-    Node* is_smi =
-        gasm_->Word32Equal(gasm_->Word32And(BuildTruncateIntPtrToInt32(value),
-                                            gasm_->Int32Constant(kSmiTagMask)),
-                           gasm_->Int32Constant(0));
-    gasm_->GotoIfNot(is_smi, &builtin);
+    gasm_->GotoIfNot(BuildTestSmi(value), &builtin);
 
     // If Smi, convert to int32.
     Node* smi = BuildChangeSmiToInt32(value);
@@ -5816,6 +5886,31 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
   }
 
   Node* BuildChangeFloat64ToNumber(Node* value) {
+    // Integral doubles are common at the boundary, so convert them to Smis
+    // inline and only call the builtin for everything else.
+    auto builtin = gasm_->MakeDeferredLabel();
+    auto not_zero = gasm_->MakeLabel();
+    auto done = gasm_->MakeLabel(MachineRepresentation::kTagged);
+
+    // Test if value is an int32 by converting it back and forth.
+    Node* value32 = gasm_->ChangeFloat64ToInt32(value);
+    gasm_->GotoIfNot(
+        gasm_->Float64Equal(value, gasm_->ChangeInt32ToFloat64(value32)),
+        &builtin);
+
+    // -0 also converts to 0, but needs a HeapNumber.
+    gasm_->GotoIfNot(gasm_->Word32Equal(value32, gasm_->Int32Constant(0)),
+                     &not_zero);
+    gasm_->GotoIf(gasm_->Int32LessThan(gasm_->Float64ExtractHighWord32(value),
+                                       gasm_->Int32Constant(0)),
+                  &builtin);
+    gasm_->Goto(&not_zero);
+
+    gasm_->Bind(&not_zero);
+    gasm_->Goto(&done, BuildChangeInt32ToNumber(value32));
+
+    // Otherwise, call builtin, to convert to a HeapNumber.
+    gasm_->Bind(&builtin);
     CommonOperatorBuilder* common = mcgraph()->common();
     Node* target = GetTargetForBuiltinCall(wasm::WasmCode::kWasmFloat64ToNumber,
                                            Builtins::kWasmFloat64ToNumber);
@@ -5825,10 +5920,37 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
           CallDescriptor::kNoFlags, Operator::kNoProperties, stub_mode_);
       float64_to_number_operator_.set(common->Call(call_descriptor));
     }
-    return gasm_->Call(float64_to_number_operator_.get(), target, value);
+    Node* call = gasm_->Call(float64_to_number_operator_.get(), target, value);
+    gasm_->Goto(&done, call);
+    gasm_->Bind(&done);
+    return done.PhiAt(0);
   }
 
   Node* BuildChangeTaggedToFloat64(Node* value, Node* context) {
+    // Smis and HeapNumbers are by far the most common inputs, so load their
+    // values inline and only call the builtin for other objects.
+    auto not_smi = gasm_->MakeLabel();
+    auto builtin = gasm_->MakeDeferredLabel();
+    auto done = gasm_->MakeLabel(MachineRepresentation::kFloat64);
+
+    // If Smi, convert to float64.
+    gasm_->GotoIfNot(BuildTestSmi(value), &not_smi);
+    gasm_->Goto(&done,
+                gasm_->ChangeInt32ToFloat64(BuildChangeSmiToInt32(value)));
+
+    // If HeapNumber, load its value.
+    gasm_->Bind(&not_smi);
+    Node* map = gasm_->Load(MachineType::TaggedPointer(), value,
+                            HeapObject::kMapOffset - kHeapObjectTag);
+    Node* heap_number_map = LOAD_FULL_POINTER(
+        BuildLoadIsolateRoot(),
+        IsolateData::root_slot_offset(RootIndex::kHeapNumberMap));
+    gasm_->GotoIfNot(gasm_->WordEqual(map, heap_number_map), &builtin);
+    gasm_->Goto(&done, gasm_->Load(MachineType::Float64(), value,
+                                   HeapNumber::kValueOffset - kHeapObjectTag));
+
+    // Otherwise, call builtin which converts any other object to float64.
+    gasm_->Bind(&builtin);
     CommonOperatorBuilder* common = mcgraph()->common();
     Node* target = GetTargetForBuiltinCall(wasm::WasmCode::kWasmTaggedToFloat64,
                                            Builtins::kWasmTaggedToFloat64);
@@ -5841,7 +5963,9 @@ class WasmWrapperGraphBuilder : public WasmGraphBuilder {
     Node* call =
         gasm_->Call(tagged_to_float64_operator_.get(), target, value, context);
     SetSourcePosition(call, 1);
-    return call;
+    gasm_->Goto(&done, call);
+    gasm_->Bind(&done);
+    return done.PhiAt(0);
   }
 
   int AddArgumentNodes(Vector<Node*> args, int pos, int param_count,
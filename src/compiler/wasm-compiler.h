@@ -568,6 +568,8 @@ class WasmGraphBuilder {
   Node* BuildChangeSmiToIntPtr(Node* value);
   // generates {index > max ? Smi(max) : Smi(index)}
   Node* BuildConvertUint32ToSmiWithSaturation(Node* index, uint32_t maxval);
+  // Returns a Word32 that is 1 if {map} is {rtt} or one of its subtypes.
+  Node* BuildIsRttSubtype(Node* map, Node* rtt);
 
   // Asm.js specific functionality.
   Node* BuildI32AsmjsSConvertF32(Node* input);
@@ -630,6 +632,10 @@ class WasmGraphBuilder {
   SetOncePointer<Node> instance_node_;
   SetOncePointer<Node> globals_start_;
   SetOncePointer<Node> imported_mutable_globals_;
+  // The backing arrays of table 0 if it has a fixed size.
+  SetOncePointer<Node> ift_sig_ids_;
+  SetOncePointer<Node> ift_targets_;
+  SetOncePointer<Node> ift_instances_;
   SetOncePointer<Node> stack_check_code_node_;
   SetOncePointer<Node> isolate_root_node_;
   SetOncePointer<const Operator> stack_check_call_operator_;
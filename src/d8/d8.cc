@@ -13,6 +13,7 @@
 #include <iterator>
 #include <string>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -23,6 +24,7 @@
 
 #include "include/libplatform/libplatform.h"
 #include "include/libplatform/v8-tracing.h"
+#include "include/v8-fast-api-calls.h"
 #include "include/v8-inspector.h"
 #include "include/v8-profiler.h"
 #include "src/api/api-inl.h"
@@ -2056,6 +2058,97 @@ Local<String> Shell::Stringify(Isolate* isolate, Local<Value> value) {
   return result.ToLocalChecked().As<String>();
 }
 
+namespace {
+
+// The fastApi object installed by --expose-fast-api adds up the elements of
+// typed arrays and the lengths of strings into a checksum, both from fast API
+// calls and from the corresponding slow callbacks, so that the two can be
+// compared in benchmarks.
+void AddToFastApiChecksum(Isolate* isolate, double value) {
+  PerIsolateData::Get(isolate)->AddToFastApiChecksum(value);
+}
+
+template <typename T>
+void FastApiSumTypedArray(ApiObject receiver,
+                          const FastApiTypedArray<T>& array) {
+  double sum = 0;
+  for (size_t i = 0; i < array.length; ++i) sum += array.data[i];
+  AddToFastApiChecksum(reinterpret_cast<Object*>(&receiver)->GetIsolate(),
+                       sum);
+}
+
+template <typename T>
+void SlowApiSumTypedArray(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  if (args.Length() < 1 || !args[0]->IsTypedArray()) {
+    Throw(isolate, "Expected a typed array");
+    return;
+  }
+  Local<TypedArray> array = args[0].As<TypedArray>();
+  if ((std::is_same<T, uint8_t>::value && !array->IsUint8Array()) ||
+      (std::is_same<T, double>::value && !array->IsFloat64Array())) {
+    Throw(isolate, "Unexpected typed array type");
+    return;
+  }
+  std::vector<T> elements(array->Length());
+  array->CopyContents(elements.data(), elements.size() * sizeof(T));
+  double sum = 0;
+  for (T element : elements) sum += element;
+  AddToFastApiChecksum(isolate, sum);
+}
+
+void FastApiStringLength(ApiObject receiver, const FastOneByteString& string) {
+  AddToFastApiChecksum(reinterpret_cast<Object*>(&receiver)->GetIsolate(),
+                       string.length);
+}
+
+void SlowApiStringLength(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  if (args.Length() < 1 || !args[0]->IsString()) {
+    Throw(isolate, "Expected a string");
+    return;
+  }
+  AddToFastApiChecksum(isolate, args[0].As<String>()->Length());
+}
+
+void FastApiChecksum(const v8::FunctionCallbackInfo<v8::Value>& args) {
+  Isolate* isolate = args.GetIsolate();
+  args.GetReturnValue().Set(
+      Number::New(isolate, PerIsolateData::Get(isolate)->fast_api_checksum()));
+}
+
+template <typename F>
+Local<FunctionTemplate> NewFastApiFunctionTemplate(Isolate* isolate,
+                                                   FunctionCallback callback,
+                                                   F* fast_callback) {
+  CFunction c_function = CFunction::Make(fast_callback);
+  return FunctionTemplate::New(isolate, callback, Local<Value>(),
+                               Local<Signature>(), 1,
+                               ConstructorBehavior::kThrow,
+                               SideEffectType::kHasSideEffect, &c_function);
+}
+
+Local<ObjectTemplate> CreateFastApiTemplate(Isolate* isolate) {
+  Local<ObjectTemplate> fast_api_template = ObjectTemplate::New(isolate);
+  fast_api_template->Set(
+      isolate, "sumUint8Array",
+      NewFastApiFunctionTemplate(isolate, SlowApiSumTypedArray<uint8_t>,
+                                 FastApiSumTypedArray<uint8_t>));
+  fast_api_template->Set(
+      isolate, "sumFloat64Array",
+      NewFastApiFunctionTemplate(isolate, SlowApiSumTypedArray<double>,
+                                 FastApiSumTypedArray<double>));
+  fast_api_template->Set(
+      isolate, "stringLength",
+      NewFastApiFunctionTemplate(isolate, SlowApiStringLength,
+                                 FastApiStringLength));
+  fast_api_template->Set(isolate, "checksum",
+                         FunctionTemplate::New(isolate, FastApiChecksum));
+  return fast_api_template;
+}
+
+}  // namespace
+
 Local<ObjectTemplate> Shell::CreateGlobalTemplate(Isolate* isolate) {
   Local<ObjectTemplate> global_template = ObjectTemplate::New(isolate);
   global_template->Set(isolate, "print", FunctionTemplate::New(isolate, Print));
@@ -2174,6 +2267,10 @@ Local<ObjectTemplate> Shell::CreateGlobalTemplate(Isolate* isolate) {
     global_template->Set(isolate, "async_hooks", async_hooks_templ);
   }
 
+  if (i::FLAG_expose_fast_api) {
+    global_template->Set(isolate, "fastApi", CreateFastApiTemplate(isolate));
+  }
+
   return global_template;
 }
 
@@ -3283,6 +3380,21 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       argv[i] = nullptr;
     } else if (strcmp(argv[i], "--isolate") == 0) {
       options.num_isolates++;
+    } else if (strncmp(argv[i], "--throughput-isolates=", 22) == 0) {
+      options.throughput_isolates = atoi(argv[i] + 22);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--throughput-threads=", 21) == 0) {
+      options.throughput_threads = atoi(argv[i] + 21);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--throughput-requests=", 22) == 0) {
+      options.throughput_requests = atoi(argv[i] + 22);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--throughput-warmup=", 20) == 0) {
+      options.throughput_warmup_requests = atoi(argv[i] + 20);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--throughput-handler=", 21) == 0) {
+      options.throughput_handler = argv[i] + 21;
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--throws") == 0) {
       options.expected_to_throw = true;
       argv[i] = nullptr;
@@ -3492,6 +3604,264 @@ int Shell::RunMain(Isolate* isolate, bool last_run) {
   return success == Shell::options.expected_to_throw ? 1 : 0;
 }
 
+namespace {
+
+// Runs a share of the isolates of the throughput mode on one thread. The
+// isolates are set up before the measurement starts and take turns handling
+// requests, like a server that multiplexes tenants on a thread.
+class ThroughputThread : public base::Thread {
+ public:
+  ThroughputThread(int num_isolates, base::Semaphore* ready,
+                   base::Semaphore* start)
+      : base::Thread(base::Thread::Options("ThroughputThread")),
+        num_isolates_(num_isolates),
+        ready_(ready),
+        start_(start) {}
+
+  void Run() override;
+
+  bool success() const { return success_; }
+  const std::vector<double>& latencies_ms() const { return latencies_ms_; }
+  const std::vector<double>& gc_pauses_ms() const { return gc_pauses_ms_; }
+  double cpu_time_ms() const { return cpu_time_ms_; }
+
+ private:
+  static void GCPrologue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                         void* data) {
+    static_cast<ThroughputThread*>(data)->gc_start_ = base::TimeTicks::Now();
+  }
+
+  static void GCEpilogue(Isolate* isolate, GCType type, GCCallbackFlags flags,
+                         void* data) {
+    ThroughputThread* thread = static_cast<ThroughputThread*>(data);
+    if (!thread->measuring_) return;
+    thread->gc_pauses_ms_.push_back(
+        (base::TimeTicks::Now() - thread->gc_start_).InMillisecondsF());
+  }
+
+  // Calls the handler of every isolate once. Returns false if a handler
+  // threw.
+  bool HandleRequests(int request, bool measure);
+
+  const int num_isolates_;
+  base::Semaphore* const ready_;
+  base::Semaphore* const start_;
+  std::vector<Isolate*> isolates_;
+  std::vector<Global<Context>> contexts_;
+  std::vector<Global<Function>> handlers_;
+  bool success_ = true;
+  bool measuring_ = false;
+  base::TimeTicks gc_start_;
+  std::vector<double> latencies_ms_;
+  std::vector<double> gc_pauses_ms_;
+  double cpu_time_ms_ = 0;
+};
+
+void ThroughputThread::Run() {
+  const ShellOptions& options = Shell::options;
+  std::vector<std::unique_ptr<D8Console>> consoles;
+  std::vector<std::unique_ptr<PerIsolateData>> data;
+  std::vector<std::unique_ptr<PerIsolateData::RealmScope>> realm_scopes;
+  for (int i = 0; i < num_isolates_; ++i) {
+    Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = Shell::array_buffer_allocator;
+    Isolate* isolate = Isolate::New(create_params);
+    Shell::SetWaitUntilDone(isolate, false);
+    consoles.push_back(std::make_unique<D8Console>(isolate));
+    Shell::Initialize(isolate, consoles.back().get(), false);
+    isolate->AddGCPrologueCallback(GCPrologue, this);
+    isolate->AddGCEpilogueCallback(GCEpilogue, this);
+    isolates_.push_back(isolate);
+
+    Isolate::Scope isolate_scope(isolate);
+    data.push_back(std::make_unique<PerIsolateData>(isolate));
+    HandleScope handle_scope(isolate);
+    Local<Context> context = Shell::CreateEvaluationContext(isolate);
+    Context::Scope context_scope(context);
+    realm_scopes.push_back(
+        std::make_unique<PerIsolateData::RealmScope>(data.back().get()));
+    contexts_.emplace_back(isolate, context);
+    handlers_.emplace_back();
+    if (!success_) continue;
+    if (!options.isolate_sources[0].Execute(isolate) ||
+        !Shell::EmptyMessageQueues(isolate)) {
+      success_ = false;
+      continue;
+    }
+    Local<Value> handler;
+    if (!context->Global()
+             ->Get(context, String::NewFromUtf8(isolate,
+                                                options.throughput_handler)
+                                .ToLocalChecked())
+             .ToLocal(&handler) ||
+        !handler->IsFunction()) {
+      printf("Throughput handler '%s' is not a function.\n",
+             options.throughput_handler);
+      success_ = false;
+      continue;
+    }
+    handlers_.back().Reset(isolate, handler.As<Function>());
+  }
+
+  for (int r = 0; success_ && r < options.throughput_warmup_requests; ++r) {
+    success_ = HandleRequests(r, false);
+  }
+  ready_->Signal();
+  start_->Wait();
+
+  base::ThreadTicks cpu_start;
+  if (base::ThreadTicks::IsSupported()) cpu_start = base::ThreadTicks::Now();
+  measuring_ = true;
+  for (int r = 0; success_ && r < options.throughput_requests; ++r) {
+    success_ = HandleRequests(r, true);
+  }
+  measuring_ = false;
+  if (base::ThreadTicks::IsSupported()) {
+    cpu_time_ms_ = (base::ThreadTicks::Now() - cpu_start).InMillisecondsF();
+  }
+
+  for (int i = 0; i < num_isolates_; ++i) {
+    Isolate* isolate = isolates_[i];
+    {
+      Isolate::Scope isolate_scope(isolate);
+      {
+        HandleScope handle_scope(isolate);
+        realm_scopes[i].reset();
+        DisposeModuleEmbedderData(contexts_[i].Get(isolate));
+      }
+      handlers_[i].Reset();
+      contexts_[i].Reset();
+      data[i].reset();
+    }
+    isolate->Dispose();
+  }
+}
+
+bool ThroughputThread::HandleRequests(int request, bool measure) {
+  for (int i = 0; i < num_isolates_; ++i) {
+    Isolate* isolate = isolates_[i];
+    Isolate::Scope isolate_scope(isolate);
+    HandleScope handle_scope(isolate);
+    Local<Context> context = contexts_[i].Get(isolate);
+    Context::Scope context_scope(context);
+    Local<Value> argv[] = {Integer::New(isolate, request)};
+    base::TimeTicks start = base::TimeTicks::Now();
+    TryCatch try_catch(isolate);
+    // The request includes the promise jobs and tasks it scheduled.
+    if (handlers_[i]
+            .Get(isolate)
+            ->Call(context, Undefined(isolate), arraysize(argv), argv)
+            .IsEmpty() ||
+        !Shell::EmptyMessageQueues(isolate)) {
+      if (try_catch.HasCaught()) Shell::ReportException(isolate, &try_catch);
+      return false;
+    }
+    if (measure) {
+      latencies_ms_.push_back(
+          (base::TimeTicks::Now() - start).InMillisecondsF());
+    }
+  }
+  return true;
+}
+
+double ProcessUserTimeMs() {
+  uint32_t secs = 0;
+  uint32_t usecs = 0;
+  if (base::OS::GetUserTime(&secs, &usecs) != 0) return 0;
+  return secs * 1000.0 + usecs / 1000.0;
+}
+
+}  // namespace
+
+int Shell::RunThroughput() {
+  const int num_isolates = options.throughput_isolates;
+  const int num_threads = std::min(options.throughput_threads, num_isolates);
+  if (num_threads <= 0 || options.throughput_requests <= 0) {
+    printf("Throughput mode needs at least one thread and request.\n");
+    return 1;
+  }
+
+  base::Semaphore ready(0);
+  base::Semaphore start(0);
+  std::vector<std::unique_ptr<ThroughputThread>> threads;
+  for (int t = 0; t < num_threads; ++t) {
+    // Spread the isolates as evenly as possible over the threads.
+    int first = t * num_isolates / num_threads;
+    int last = (t + 1) * num_isolates / num_threads;
+    threads.push_back(
+        std::make_unique<ThroughputThread>(last - first, &ready, &start));
+    CHECK(threads.back()->Start());
+  }
+  for (int t = 0; t < num_threads; ++t) ready.Wait();
+
+  double process_cpu_start = ProcessUserTimeMs();
+  base::TimeTicks wall_start = base::TimeTicks::Now();
+  for (int t = 0; t < num_threads; ++t) start.Signal();
+  for (auto& thread : threads) thread->Join();
+  double wall_ms = (base::TimeTicks::Now() - wall_start).InMillisecondsF();
+  double process_cpu_ms = ProcessUserTimeMs() - process_cpu_start;
+
+  bool success = true;
+  double isolate_cpu_ms = 0;
+  std::vector<double> latencies;
+  std::vector<double> gc_pauses;
+  for (auto& thread : threads) {
+    success &= thread->success();
+    isolate_cpu_ms += thread->cpu_time_ms();
+    latencies.insert(latencies.end(), thread->latencies_ms().begin(),
+                     thread->latencies_ms().end());
+    gc_pauses.insert(gc_pauses.end(), thread->gc_pauses_ms().begin(),
+                     thread->gc_pauses_ms().end());
+  }
+  if (!success) return 1;
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](int p) {
+    size_t index = (latencies.size() - 1) * p / 100;
+    return latencies[index];
+  };
+  printf("Throughput: %d isolates on %d threads, %zu requests in %.1f ms\n",
+         num_isolates, num_threads, latencies.size(), wall_ms);
+  printf("  requests/s: %.1f\n", latencies.size() * 1000.0 / wall_ms);
+  printf("  latency (ms): p50 %.3f, p90 %.3f, p99 %.3f, max %.3f\n",
+         percentile(50), percentile(90), percentile(99), latencies.back());
+
+  // GC pauses are bucketed by powers of two milliseconds.
+  static constexpr int kNumBuckets = 10;
+  int buckets[kNumBuckets] = {0};
+  double total_pause_ms = 0;
+  for (double pause : gc_pauses) {
+    total_pause_ms += pause;
+    int bucket = 0;
+    while (bucket < kNumBuckets - 1 && pause >= (1 << bucket)) bucket++;
+    buckets[bucket]++;
+  }
+  printf("  GC pauses: %zu, total %.1f ms\n", gc_pauses.size(),
+         total_pause_ms);
+  for (int i = 0; i < kNumBuckets; ++i) {
+    if (buckets[i] == 0) continue;
+    int low = i == 0 ? 0 : 1 << (i - 1);
+    if (i == kNumBuckets - 1) {
+      printf("    [%d, inf) ms: %d\n", low, buckets[i]);
+    } else {
+      printf("    [%d, %d) ms: %d\n", low, 1 << i, buckets[i]);
+    }
+  }
+
+  // Background threads (concurrent compilation, concurrent and parallel GC)
+  // are approximated by the process CPU time not spent on the isolate
+  // threads.
+  if (base::ThreadTicks::IsSupported()) {
+    double background_cpu_ms = std::max(0.0, process_cpu_ms - isolate_cpu_ms);
+    printf("  isolate threads CPU: %.1f ms (%.1f%% of %d threads)\n",
+           isolate_cpu_ms, 100 * isolate_cpu_ms / (wall_ms * num_threads),
+           num_threads);
+    printf("  background threads CPU: %.1f ms (%.2f threads busy)\n",
+           background_cpu_ms, background_cpu_ms / wall_ms);
+  }
+  return 0;
+}
+
 void Shell::CollectGarbage(Isolate* isolate) {
   if (options.send_idle_notification) {
     const double kLongIdlePauseInSeconds = 1.0;
@@ -4148,6 +4518,8 @@ int Shell::Main(int argc, char* argv[]) {
         // Second run to consume the cache in current isolate
         result = RunMain(isolate, true);
         options.compile_options = v8::ScriptCompiler::kNoCompileOptions;
+      } else if (options.throughput_isolates > 0) {
+        result = RunThroughput();
       } else {
         bool last_run = true;
         result = RunMain(isolate, last_run);
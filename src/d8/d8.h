@@ -256,6 +256,11 @@ class PerIsolateData {
 
   AsyncHooks* GetAsyncHooks() { return async_hooks_wrapper_; }
 
+  // Accumulated by the functions of the fastApi object, see
+  // --expose-fast-api.
+  double fast_api_checksum() const { return fast_api_checksum_; }
+  void AddToFastApiChecksum(double value) { fast_api_checksum_ += value; }
+
   void RemoveUnhandledPromise(Local<Promise> promise);
   void AddUnhandledPromise(Local<Promise> promise, Local<Message> message,
                            Local<Value> exception);
@@ -276,6 +281,7 @@ class PerIsolateData {
   std::vector<std::tuple<Global<Promise>, Global<Message>, Global<Value>>>
       unhandled_promises_;
   AsyncHooks* async_hooks_wrapper_;
+  double fast_api_checksum_ = 0;
 
   int RealmIndexOrThrow(const v8::FunctionCallbackInfo<v8::Value>& args,
                         int arg_offset);
@@ -333,6 +339,15 @@ class ShellOptions {
   bool cpu_profiler = false;
   bool cpu_profiler_print = false;
   bool fuzzy_module_file_extensions = true;
+  // Throughput mode: the scripts of the first source group are loaded into
+  // each of |throughput_isolates| isolates, which are spread over
+  // |throughput_threads| threads and call the global |throughput_handler|
+  // function |throughput_requests| times each.
+  int throughput_isolates = 0;
+  int throughput_threads = 1;
+  int throughput_requests = 1000;
+  int throughput_warmup_requests = 100;
+  const char* throughput_handler = "handleRequest";
 };
 
 class Shell : public i::AllStatic {
@@ -358,6 +373,7 @@ class Shell : public i::AllStatic {
   static Local<String> ReadFile(Isolate* isolate, const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, bool last_run);
+  static int RunThroughput();
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate);
@@ -52,12 +52,11 @@ void DateCache::ResetDateCache(
   after_ = &dst_[1];
   ymd_valid_ = false;
 #ifdef V8_INTL_SUPPORT
-  if (!FLAG_icu_timezone_data) {
-#endif
-    local_offset_ms_ = kInvalidLocalOffsetInMs;
-#ifdef V8_INTL_SUPPORT
-  }
+  cache_local_offsets_ = FLAG_icu_timezone_data;
+#else
+  cache_local_offsets_ = false;
 #endif
+  if (!cache_local_offsets_) local_offset_ms_ = kInvalidLocalOffsetInMs;
   tz_cache_->Clear(time_zone_detection);
   tz_name_ = nullptr;
   dst_tz_name_ = nullptr;
@@ -297,7 +296,19 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
   int time_sec = (time_ms >= 0 && time_ms <= kMaxEpochTimeInMs)
                      ? static_cast<int>(time_ms / 1000)
                      : static_cast<int>(EquivalentTime(time_ms) / 1000);
+  // The segment cache holds local offsets, only LocalTimezone gets here.
+  if (cache_local_offsets_) return GetDaylightSavingsOffsetFromOS(time_sec);
+  return CachedOffsetInMs(time_sec);
+}
+
+int DateCache::GetCachedOffsetFromOS(int time_sec) {
+  if (cache_local_offsets_) {
+    return GetLocalOffsetFromOS(static_cast<int64_t>(time_sec) * 1000, true);
+  }
+  return GetDaylightSavingsOffsetFromOS(time_sec);
+}
 
+int DateCache::CachedOffsetInMs(int time_sec) {
   // Invalidate cache if the usage counter is close to overflow.
   // Note that dst_usage_counter is incremented less than ten times
   // in this function.
@@ -324,7 +335,7 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
     // Cache miss.
     before_->start_sec = time_sec;
     before_->end_sec = time_sec;
-    before_->offset_ms = GetDaylightSavingsOffsetFromOS(time_sec);
+    before_->offset_ms = GetCachedOffsetFromOS(time_sec);
     before_->last_used = ++dst_usage_counter_;
     return before_->offset_ms;
   }
@@ -338,7 +349,7 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
   if (time_sec - kDefaultDSTDeltaInSec > before_->end_sec) {
     // If the before_ segment ends too early, then just
     // query for the offset of the time_sec
-    int offset_ms = GetDaylightSavingsOffsetFromOS(time_sec);
+    int offset_ms = GetCachedOffsetFromOS(time_sec);
     ExtendTheAfterSegment(time_sec, offset_ms);
     // This swap helps the optimistic fast check in subsequent invocations.
     DST* temp = before_;
@@ -359,7 +370,7 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
           ? before_->end_sec + kDefaultDSTDeltaInSec
           : kMaxEpochTimeInSec;
   if (new_after_start_sec <= after_->start_sec) {
-    int new_offset_ms = GetDaylightSavingsOffsetFromOS(new_after_start_sec);
+    int new_offset_ms = GetCachedOffsetFromOS(new_after_start_sec);
     ExtendTheAfterSegment(new_after_start_sec, new_offset_ms);
   } else {
     DCHECK(!InvalidSegment(after_));
@@ -382,7 +393,7 @@ int DateCache::DaylightSavingsOffsetInMs(int64_t time_ms) {
   for (int i = 4; i >= 0; --i) {
     int delta = after_->start_sec - before_->end_sec;
     int middle_sec = (i == 0) ? time_sec : before_->end_sec + delta / 2;
-    int offset_ms = GetDaylightSavingsOffsetFromOS(middle_sec);
+    int offset_ms = GetCachedOffsetFromOS(middle_sec);
     if (before_->offset_ms == offset_ms) {
       before_->end_sec = middle_sec;
       if (time_sec <= before_->end_sec) {
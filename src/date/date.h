@@ -76,6 +76,12 @@ class V8_EXPORT_PRIVATE DateCache {
 
   // ECMA 262 - ES#sec-local-time-zone-adjustment
   int LocalOffsetInMs(int64_t time, bool is_utc) {
+    // The offset of a UTC time within the range of the segment cache is
+    // looked up there, so that nearby times don't query the OS again.
+    if (cache_local_offsets_ && is_utc && time >= 0 &&
+        time <= kMaxEpochTimeInMs) {
+      return CachedOffsetInMs(static_cast<int>(time / 1000));
+    }
     return GetLocalOffsetFromOS(time, is_utc);
   }
 
@@ -175,10 +181,11 @@ class V8_EXPORT_PRIVATE DateCache {
   static const int kDefaultDSTDeltaInSec = 19 * kSecPerDay;
 
   // Size of the Daylight Savings Time cache.
-  static const int kDSTSize = 32;
+  static const int kDSTSize = 64;
 
   // Daylight Savings Time segment stores a segment of time where
-  // daylight savings offset does not change.
+  // daylight savings offset does not change. If cache_local_offsets_ is set,
+  // segments store the whole local offset instead.
   struct DST {
     int start_sec;
     int end_sec;
@@ -190,6 +197,13 @@ class V8_EXPORT_PRIVATE DateCache {
   // ECMA 262 - 15.9.1.8
   int DaylightSavingsOffsetInMs(int64_t time_ms);
 
+  // Looks up the offset for the given time in the segment cache, querying
+  // the OS on a miss.
+  int CachedOffsetInMs(int time_sec);
+
+  // Queries the OS for the kind of offset that the segment cache stores.
+  int GetCachedOffsetFromOS(int time_sec);
+
   // Sets the before_ and the after_ segments from the DST cache such that
   // the before_ segment starts earlier than the given time and
   // the after_ segment start later than the given time.
@@ -219,6 +233,10 @@ class V8_EXPORT_PRIVATE DateCache {
   int dst_usage_counter_;
   DST* before_;
   DST* after_;
+  // Whether the segment cache stores local offsets rather than daylight
+  // savings offsets. This is the case with ICU timezone data, which also
+  // accounts for changes of the standard offset.
+  bool cache_local_offsets_;
 
   int local_offset_ms_;
 
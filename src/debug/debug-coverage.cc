@@ -394,6 +394,7 @@ bool IsBlockMode(debug::CoverageMode mode) {
   switch (mode) {
     case debug::CoverageMode::kBlockBinary:
     case debug::CoverageMode::kBlockCount:
+    case debug::CoverageMode::kBlockBestEffort:
       return true;
     default:
       return false;
@@ -522,11 +523,13 @@ void CollectAndMaybeResetCounts(Isolate* isolate,
       }
       break;
     }
-    case v8::debug::CoverageMode::kBestEffort: {
+    case v8::debug::CoverageMode::kBestEffort:
+    case v8::debug::CoverageMode::kBlockBestEffort: {
       DCHECK(!isolate->factory()
                   ->feedback_vectors_for_profiling_tools()
                   ->IsArrayList());
-      DCHECK_EQ(v8::debug::CoverageMode::kBestEffort, coverage_mode);
+      DCHECK(coverage_mode == v8::debug::CoverageMode::kBestEffort ||
+             coverage_mode == v8::debug::CoverageMode::kBlockBestEffort);
       HeapObjectIterator heap_iterator(isolate->heap());
       for (HeapObject current_obj = heap_iterator.Next();
            !current_obj.is_null(); current_obj = heap_iterator.Next()) {
@@ -543,7 +546,7 @@ void CollectAndMaybeResetCounts(Isolate* isolate,
           count =
               static_cast<uint32_t>(func.feedback_vector().invocation_count());
         } else if (func.raw_feedback_cell().interrupt_budget() <
-                   FLAG_budget_for_feedback_vector_allocation) {
+                   isolate->budget_for_feedback_vector_allocation()) {
           // We haven't allocated feedback vector, but executed the function
           // atleast once. We don't have precise invocation count here.
           count = 1;
@@ -696,6 +699,7 @@ std::unique_ptr<Coverage> Coverage::Collect(
             info.set_has_reported_binary_coverage(true);
             break;
           case v8::debug::CoverageMode::kBestEffort:
+          case v8::debug::CoverageMode::kBlockBestEffort:
             count = 1;
             break;
         }
@@ -758,6 +762,16 @@ void Coverage::SelectMode(Isolate* isolate, debug::CoverageMode mode) {
             ReadOnlyRoots(isolate).undefined_value());
       }
       break;
+    case debug::CoverageMode::kBlockBestEffort:
+      // Functions compiled from now on get block counters, which optimized
+      // code increments as well, so nothing needs to be deoptimized. Existing
+      // coverage infos are kept and invocation counts are taken from the heap
+      // as in best-effort mode.
+      if (!isolate->is_collecting_type_profile()) {
+        isolate->SetFeedbackVectorsForProfilingTools(
+            ReadOnlyRoots(isolate).undefined_value());
+      }
+      break;
     case debug::CoverageMode::kBlockBinary:
     case debug::CoverageMode::kBlockCount:
     case debug::CoverageMode::kPreciseBinary:
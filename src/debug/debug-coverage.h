@@ -53,11 +53,12 @@ struct CoverageScript {
 
 class Coverage : public std::vector<CoverageScript> {
  public:
-  // Collecting precise coverage only works if the modes kPreciseCount or
-  // kPreciseBinary is selected. The invocation count is reset on collection.
+  // Collecting precise coverage only works if a mode other than kBestEffort
+  // is selected. The invocation count is reset on collection.
   // In case of kPreciseCount, an updated count since last collection is
   // returned. In case of kPreciseBinary, a count of 1 is returned if a
   // function has been executed for the first time since last collection.
+  // In case of kBlockBestEffort, only the block counts are reset.
   static std::unique_ptr<Coverage> CollectPrecise(Isolate* isolate);
   // Collecting best effort coverage always works, but may be imprecise
   // depending on selected mode. The invocation count is not reset.
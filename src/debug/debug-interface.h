@@ -6,6 +6,8 @@
 #define V8_DEBUG_DEBUG_INTERFACE_H_
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "include/v8-inspector.h"
 #include "include/v8-util.h"
@@ -225,6 +227,40 @@ V8_EXPORT_PRIVATE void SetDebugDelegate(Isolate* isolate,
 V8_EXPORT_PRIVATE void TierDownAllModulesPerIsolate(Isolate* isolate);
 V8_EXPORT_PRIVATE void TierUpAllModulesPerIsolate(Isolate* isolate);
 
+// The state of an inline cache, as recorded in a function's feedback.
+enum class InlineCacheState {
+  kUninitialized,
+  kMonomorphic,
+  kPolymorphic,
+  kMegamorphic,
+  kGeneric,
+};
+
+struct FeedbackSlotState {
+  int slot;
+  InlineCacheState state;
+  // Number of receiver maps recorded in the slot. Megamorphic and generic
+  // slots don't record maps.
+  int map_count;
+};
+
+// Returns the functions that have feedback and were invoked at least
+// |min_invocation_count| times. Closures that share their feedback are only
+// returned once.
+V8_EXPORT_PRIVATE std::vector<Local<Function>> GetFunctionsWithFeedback(
+    Isolate* isolate, int min_invocation_count);
+
+// Returns the state of the property access inline caches of |function|, i.e.
+// of its named and keyed load, store and `in` slots. Returns nothing if the
+// function doesn't have feedback yet.
+V8_EXPORT_PRIVATE std::vector<FeedbackSlotState> GetFeedbackSlotStates(
+    Local<Function> function);
+
+// Returns the basic block counters collected with --turbo-profiling as JSON,
+// and resets them to zero if |reset_counts| is true.
+V8_EXPORT_PRIVATE std::string GetBasicBlockProfile(Isolate* isolate,
+                                                   bool reset_counts);
+
 class AsyncEventDelegate {
  public:
   virtual ~AsyncEventDelegate() = default;
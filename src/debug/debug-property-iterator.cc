@@ -7,6 +7,7 @@
 #include "src/api/api-inl.h"
 #include "src/base/flags.h"
 #include "src/objects/js-array-buffer-inl.h"
+#include "src/objects/js-array-inl.h"
 #include "src/objects/keys.h"
 #include "src/objects/property-descriptor.h"
 #include "src/objects/property-details.h"
@@ -145,9 +146,19 @@ void DebugPropertyIterator::FillKeysForCurrentPrototypeAndStage() {
   if (prototype_iterator_.IsAtEnd()) return;
   Handle<JSReceiver> receiver =
       PrototypeIterator::GetCurrent<JSReceiver>(prototype_iterator_);
-  bool has_exotic_indices = receiver->IsJSTypedArray();
+  // Typed arrays and packed arrays have exactly the indices [0, length), so
+  // they are enumerated without materializing (possibly millions of) keys.
+  bool has_exotic_indices =
+      receiver->IsJSTypedArray() ||
+      (receiver->IsJSArray() &&
+       IsFastPackedElementsKind(JSArray::cast(*receiver).GetElementsKind()));
   if (stage_ == kExoticIndices) {
     if (!has_exotic_indices) return;
+    if (receiver->IsJSArray()) {
+      exotic_length_ = static_cast<size_t>(
+          JSArray::cast(*receiver).length().Number());
+      return;
+    }
     Handle<JSTypedArray> typed_array = Handle<JSTypedArray>::cast(receiver);
     exotic_length_ = typed_array->WasDetached() ? 0 : typed_array->length();
     return;
@@ -106,7 +106,7 @@ void TypeProfile::SelectMode(Isolate* isolate, debug::TypeProfileMode mode) {
 
       // Delete the feedback vectors from the list if they're not used by code
       // coverage.
-      if (isolate->is_best_effort_code_coverage()) {
+      if (!isolate->needs_feedback_vectors_for_code_coverage()) {
         isolate->SetFeedbackVectorsForProfilingTools(
             ReadOnlyRoots(isolate).undefined_value());
       }
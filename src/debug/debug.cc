@@ -202,7 +202,7 @@ BreakIterator::BreakIterator(Handle<DebugInfo> debug_info)
     : debug_info_(debug_info),
       break_index_(-1),
       source_position_iterator_(
-          debug_info->DebugBytecodeArray().SourcePositionTable()) {
+          debug_info->shared().GetBytecodeArray().SourcePositionTable()) {
   position_ = debug_info->shared().StartPosition();
   statement_position_ = position_;
   // There is at least one break location.
@@ -249,7 +249,9 @@ void BreakIterator::Next() {
 }
 
 DebugBreakType BreakIterator::GetDebugBreakType() {
-  BytecodeArray bytecode_array = debug_info_->OriginalBytecodeArray();
+  // Break locations can be inspected before the function is prepared for
+  // debug execution, so read the original bytecode through the shared info.
+  BytecodeArray bytecode_array = debug_info_->shared().GetBytecodeArray();
   interpreter::Bytecode bytecode =
       interpreter::Bytecodes::FromByte(bytecode_array.get(code_offset()));
 
@@ -301,7 +303,10 @@ void BreakIterator::ClearDebugBreak() {
 
 BreakLocation BreakIterator::GetBreakLocation() {
   Handle<AbstractCode> code(
-      AbstractCode::cast(debug_info_->DebugBytecodeArray()), isolate());
+      AbstractCode::cast(debug_info_->HasInstrumentedBytecodeArray()
+                             ? debug_info_->DebugBytecodeArray()
+                             : debug_info_->shared().GetBytecodeArray()),
+      isolate());
   DebugBreakType type = GetDebugBreakType();
   int generator_object_reg_index = -1;
   if (type == DEBUG_BREAK_SLOT_AT_SUSPEND) {
@@ -310,7 +315,7 @@ BreakLocation BreakIterator::GetBreakLocation() {
     // index that holds the generator object by reading it directly off the
     // bytecode array, and we'll read the actual generator object off the
     // interpreter stack frame in GetGeneratorObjectForSuspendedFrame.
-    BytecodeArray bytecode_array = debug_info_->OriginalBytecodeArray();
+    BytecodeArray bytecode_array = debug_info_->shared().GetBytecodeArray();
     interpreter::BytecodeArrayAccessor accessor(
         handle(bytecode_array, isolate()), code_offset());
 
@@ -1385,7 +1390,7 @@ void GetBreakablePositions(Iterator* it, int start_position, int end_position,
 void FindBreakablePositions(Handle<DebugInfo> debug_info, int start_position,
                             int end_position,
                             std::vector<BreakLocation>* locations) {
-  DCHECK(debug_info->HasInstrumentedBytecodeArray());
+  DCHECK(debug_info->shared().HasBytecodeArray());
   BreakIterator it(debug_info);
   GetBreakablePositions(&it, start_position, end_position, locations);
 }
@@ -1402,8 +1407,9 @@ bool Debug::GetPossibleBreakpoints(Handle<Script> script, int start_position,
     // Make sure the function has set up the debug info.
     Handle<SharedFunctionInfo> shared =
         Handle<SharedFunctionInfo>::cast(result);
+    // Listing break locations only reads the bytecode, so the function is
+    // neither copied nor deoptimized until a break point is actually set.
     if (!EnsureBreakInfo(shared)) return false;
-    PrepareFunctionForDebugExecution(shared);
 
     Handle<DebugInfo> debug_info(shared->GetDebugInfo(), isolate_);
     FindBreakablePositions(debug_info, start_position, end_position, locations);
@@ -1442,7 +1448,6 @@ bool Debug::GetPossibleBreakpoints(Handle<Script> script, int start_position,
       DCHECK(is_compiled_scope.is_compiled());
       compiled_scopes.push_back(is_compiled_scope);
       if (!EnsureBreakInfo(candidate)) return false;
-      PrepareFunctionForDebugExecution(candidate);
     }
     if (was_compiled) continue;
 
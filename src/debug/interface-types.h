@@ -76,6 +76,12 @@ enum class CoverageMode {
   // lower granularity. Design doc: goo.gl/lA2swZ.
   kBlockCount,
   kBlockBinary,
+  // Block coverage with best effort invocation counts. Neither optimization
+  // nor GC is affected: block counters are incremented by optimized and
+  // inlined code as well, and feedback vectors are not kept alive. Only
+  // functions compiled after selecting this mode are instrumented. Collecting
+  // resets block counters to get incremental updates.
+  kBlockBestEffort,
 };
 
 enum class TypeProfileMode {
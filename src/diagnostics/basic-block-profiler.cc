@@ -5,6 +5,7 @@
 #include "src/diagnostics/basic-block-profiler.h"
 
 #include <algorithm>
+#include <iomanip>
 #include <numeric>
 #include <sstream>
 
@@ -18,7 +19,9 @@ namespace internal {
 DEFINE_LAZY_LEAKY_OBJECT_GETTER(BasicBlockProfiler, BasicBlockProfiler::Get)
 
 BasicBlockProfilerData::BasicBlockProfilerData(size_t n_blocks)
-    : block_ids_(n_blocks), counts_(n_blocks, 0) {}
+    : block_ids_(n_blocks),
+      counts_(n_blocks, 0),
+      source_positions_(n_blocks, kNoSourcePosition) {}
 
 void BasicBlockProfilerData::SetCode(const std::ostringstream& os) {
   code_ = os.str();
@@ -37,6 +40,15 @@ void BasicBlockProfilerData::SetBlockId(size_t offset, int32_t id) {
   block_ids_[offset] = id;
 }
 
+void BasicBlockProfilerData::SetSourcePosition(size_t offset, int position) {
+  DCHECK(offset < n_blocks());
+  source_positions_[offset] = position;
+}
+
+void BasicBlockProfilerData::SetScriptId(int script_id) {
+  script_id_ = script_id;
+}
+
 void BasicBlockProfilerData::SetHash(int hash) { hash_ = hash; }
 
 void BasicBlockProfilerData::ResetCounts() {
@@ -77,6 +89,7 @@ BasicBlockProfilerData::BasicBlockProfilerData(
     block_ids_.push_back(block_ids->get_int(i));
   }
   CHECK_EQ(block_ids_.size(), counts_.size());
+  source_positions_.resize(counts_.size(), kNoSourcePosition);
   hash_ = js_heap_data->hash();
 }
 
@@ -94,6 +107,8 @@ BasicBlockProfilerData::BasicBlockProfilerData(
     block_ids_.push_back(block_ids.get_int(i));
   }
   CHECK_EQ(block_ids_.size(), counts_.size());
+  source_positions_.resize(counts_.size(), kNoSourcePosition);
+  hash_ = js_heap_data.hash();
 }
 
 Handle<OnHeapBasicBlockProfilerData> BasicBlockProfilerData::CopyToJSHeap(
@@ -145,6 +160,9 @@ void BasicBlockProfiler::Print(std::ostream& os, Isolate* isolate) {
   os << "---- Start Profiling Data ----" << std::endl;
   for (const auto& data : data_list_) {
     os << *data;
+    // Off-heap data belongs to code compiled at runtime, so only log it if
+    // profiles for optimized JavaScript functions were requested.
+    if (FLAG_turbo_profiling_log_js) data->Log(isolate);
   }
   HandleScope scope(isolate);
   Handle<ArrayList> list(isolate->heap()->basic_block_profiling_data(),
@@ -165,6 +183,37 @@ void BasicBlockProfiler::Print(std::ostream& os, Isolate* isolate) {
   os << "---- End Profiling Data ----" << std::endl;
 }
 
+void BasicBlockProfiler::PrintJSON(std::ostream& os, Isolate* isolate,
+                                   bool reset_counts) {
+  os << "{\"functions\":[";
+  bool first = true;
+  auto print = [&](const BasicBlockProfilerData& data) {
+    if (std::none_of(data.counts_.begin(), data.counts_.end(),
+                     [](uint32_t count) { return count > 0; })) {
+      return;
+    }
+    if (!first) os << ",";
+    first = false;
+    data.PrintJSON(os);
+  };
+  {
+    base::MutexGuard lock(&data_list_mutex_);
+    for (const auto& data : data_list_) print(*data);
+  }
+  {
+    HandleScope scope(isolate);
+    Handle<ArrayList> list(isolate->heap()->basic_block_profiling_data(),
+                           isolate);
+    for (int i = 0; i < list->Length(); ++i) {
+      print(BasicBlockProfilerData(
+          handle(OnHeapBasicBlockProfilerData::cast(list->Get(i)), isolate),
+          isolate));
+    }
+  }
+  os << "]}";
+  if (reset_counts) ResetCounts(isolate);
+}
+
 std::vector<bool> BasicBlockProfiler::GetCoverageBitmap(Isolate* isolate) {
   DisallowHeapAllocation no_gc;
   ArrayList list(isolate->heap()->basic_block_profiling_data());
@@ -194,6 +243,36 @@ void BasicBlockProfilerData::Log(Isolate* isolate) {
   }
 }
 
+namespace {
+void PrintJSONString(std::ostream& os, const std::string& str) {
+  os << '"';
+  for (char c : str) {
+    if (c == '"' || c == '\\') {
+      os << '\\' << c;
+    } else if (static_cast<unsigned char>(c) < 0x20) {
+      os << "\\u" << std::hex << std::setw(4) << std::setfill('0')
+         << static_cast<int>(c) << std::dec << std::setfill(' ');
+    } else {
+      os << c;
+    }
+  }
+  os << '"';
+}
+}  // namespace
+
+void BasicBlockProfilerData::PrintJSON(std::ostream& os) const {
+  os << "{\"name\":";
+  PrintJSONString(os, function_name_);
+  os << ",\"hash\":" << hash_ << ",\"script\":" << script_id_
+     << ",\"blocks\":[";
+  for (size_t i = 0; i < n_blocks(); ++i) {
+    if (i > 0) os << ",";
+    os << "{\"id\":" << block_ids_[i] << ",\"count\":" << counts_[i]
+       << ",\"pos\":" << source_positions_[i] << "}";
+  }
+  os << "]}";
+}
+
 std::ostream& operator<<(std::ostream& os, const BasicBlockProfilerData& d) {
   int block_count_sum = std::accumulate(d.counts_.begin(), d.counts_.end(), 0);
   if (block_count_sum == 0) return os;
@@ -37,6 +37,8 @@ class BasicBlockProfilerData {
   void SetFunctionName(std::unique_ptr<char[]> name);
   void SetSchedule(const std::ostringstream& os);
   void SetBlockId(size_t offset, int32_t id);
+  void SetSourcePosition(size_t offset, int position);
+  void SetScriptId(int script_id);
   void SetHash(int hash);
 
   // Copy the data from this object into an equivalent object stored on the JS
@@ -46,6 +48,9 @@ class BasicBlockProfilerData {
 
   void Log(Isolate* isolate);
 
+  // Writes the counters of this function as a JSON object.
+  void PrintJSON(std::ostream& os) const;
+
  private:
   friend class BasicBlockProfiler;
   friend std::ostream& operator<<(std::ostream& os,
@@ -56,10 +61,14 @@ class BasicBlockProfilerData {
   // These vectors are indexed by reverse post-order block number.
   std::vector<int32_t> block_ids_;
   std::vector<uint32_t> counts_;
+  // Script offset of the first node in each block, or kNoSourcePosition. Only
+  // recorded for code compiled at runtime, relative to the script |script_id_|.
+  std::vector<int> source_positions_;
+  int script_id_ = -1;
   std::string function_name_;
   std::string schedule_;
   std::string code_;
-  int hash_;
+  int hash_ = 0;
   DISALLOW_COPY_AND_ASSIGN(BasicBlockProfilerData);
 };
 
@@ -76,6 +85,13 @@ class BasicBlockProfiler {
   V8_EXPORT_PRIVATE bool HasData(Isolate* isolate);
   V8_EXPORT_PRIVATE void Print(std::ostream& os, Isolate* isolate);
 
+  // Writes the counters of all functions that were entered at least once as a
+  // JSON object, and resets them afterwards if |reset_counts| is true. This
+  // allows an embedder to collect profiles periodically from a running
+  // process instead of only at exit.
+  V8_EXPORT_PRIVATE void PrintJSON(std::ostream& os, Isolate* isolate,
+                                   bool reset_counts);
+
   // Coverage bitmap in this context includes only on heap BasicBlockProfiler
   // data It is used to export coverage of builtins function loaded from
   // snapshot.
@@ -48,6 +48,24 @@ void CompilationStatistics::RecordTotalStats(size_t source_size,
   total_stats_.Accumulate(stats);
 }
 
+void CompilationStatistics::RecordMainThreadStats(const BasicStats& stats) {
+  base::MutexGuard guard(&record_mutex_);
+
+  main_thread_stats_.Accumulate(stats);
+}
+
+std::vector<std::pair<std::string, CompilationStatistics::BasicStats>>
+CompilationStatistics::GetPhaseStats() {
+  base::MutexGuard guard(&record_mutex_);
+
+  std::vector<std::pair<std::string, BasicStats>> result(phase_map_.size());
+  for (const auto& phase : phase_map_) {
+    result[phase.second.insert_order_] = phase;
+  }
+  result.emplace_back("totals", total_stats_);
+  return result;
+}
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -149,6 +167,10 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
 
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", s.total_stats_, s.total_stats_);
+  if (s.main_thread_stats_.delta_ != base::TimeDelta()) {
+    WriteLine(os, ps.machine_output, "main_thread", s.main_thread_stats_,
+              s.total_stats_);
+  }
 
   return os;
 }
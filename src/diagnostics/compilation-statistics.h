@@ -7,6 +7,8 @@
 
 #include <map>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include "src/base/platform/time.h"
 #include "src/utils/allocation.h"
@@ -50,6 +52,14 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(size_t source_size, const BasicStats& stats);
 
+  // Records time spent in the parts of optimizing compilation jobs that have
+  // to run on the main thread, i.e. job preparation and finalization.
+  void RecordMainThreadStats(const BasicStats& stats);
+
+  // Returns the accumulated stats of each phase in the order in which the
+  // phases were first recorded, followed by the totals as "totals".
+  std::vector<std::pair<std::string, BasicStats>> GetPhaseStats();
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -78,6 +88,7 @@ class CompilationStatistics final : public Malloced {
   using PhaseMap = std::map<std::string, PhaseStats>;
 
   TotalStats total_stats_;
+  BasicStats main_thread_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
   base::Mutex record_mutex_;
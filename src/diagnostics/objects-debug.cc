@@ -1256,6 +1256,19 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       CHECK(arr.get(JSRegExp::kIrregexpBacktrackLimit).IsSmi());
       break;
     }
+    case JSRegExp::EXPERIMENTAL: {
+      FixedArray arr = FixedArray::cast(data());
+      // The experimental engine has no native code; the same bytecode is
+      // used for both string representations.
+      Smi uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
+      CHECK_EQ(arr.get(JSRegExp::kIrregexpLatin1CodeIndex), uninitialized);
+      CHECK_EQ(arr.get(JSRegExp::kIrregexpUC16CodeIndex), uninitialized);
+      Object bytecode = arr.get(JSRegExp::kIrregexpLatin1BytecodeIndex);
+      CHECK(bytecode.IsByteArray());
+      CHECK_EQ(arr.get(JSRegExp::kIrregexpUC16BytecodeIndex), bytecode);
+      CHECK(arr.get(JSRegExp::kIrregexpCaptureCountIndex).IsSmi());
+      break;
+    }
     default:
       CHECK_EQ(JSRegExp::NOT_COMPILED, TypeTag());
       CHECK(data().IsUndefined(isolate));
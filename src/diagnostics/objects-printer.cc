@@ -1659,6 +1659,7 @@ void WasmTypeInfo::WasmTypeInfoPrint(std::ostream& os) {  // NOLINT
   PrintHeader(os, "WasmTypeInfo");
   os << "\n - type address: " << reinterpret_cast<void*>(foreign_address());
   os << "\n - parent: " << Brief(parent());
+  os << "\n - supertypes: " << Brief(supertypes());
   os << "\n";
 }
 
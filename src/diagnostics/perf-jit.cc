@@ -34,6 +34,7 @@
 #include <sys/mman.h>
 #include <unistd.h>
 #include <memory>
+#include <unordered_map>
 
 #include "src/codegen/assembler.h"
 #include "src/codegen/source-position-table.h"
@@ -84,6 +85,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -115,6 +126,7 @@ uint64_t PerfJitLogger::reference_count_ = 0;
 void* PerfJitLogger::marker_address_ = nullptr;
 uint64_t PerfJitLogger::code_index_ = 0;
 FILE* PerfJitLogger::perf_output_handle_ = nullptr;
+std::unordered_map<Address, uint64_t>* PerfJitLogger::code_ids_ = nullptr;
 
 void PerfJitLogger::OpenJitDumpFile() {
   // Open the perf JIT dump file.
@@ -141,12 +153,15 @@ void PerfJitLogger::OpenJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
 
   setvbuf(perf_output_handle_, nullptr, _IOFBF, kLogBufferSize);
+  code_ids_ = new std::unordered_map<Address, uint64_t>();
 }
 
 void PerfJitLogger::CloseJitDumpFile() {
   if (perf_output_handle_ == nullptr) return;
   fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
+  delete code_ids_;
+  code_ids_ = nullptr;
 }
 
 void* PerfJitLogger::OpenMarkerFile(int fd) {
@@ -251,6 +266,10 @@ void PerfJitLogger::LogRecordedBuffer(const wasm::WasmCode* code,
     LogWriteDebugInfo(code);
   }
 
+  // Wasm code has no eh_frame yet, but an empty one still tells perf to fall
+  // back to frame pointers instead of failing to unwind.
+  if (FLAG_perf_prof_unwinding_info) LogWriteUnwindingInfo(nullptr, 0);
+
   WriteJitCodeLoadEntry(code->instructions().begin(),
                         code->instructions().length(), name, length);
 }
@@ -272,6 +291,8 @@ void PerfJitLogger::WriteJitCodeLoadEntry(const uint8_t* code_pointer,
   code_load.code_size_ = code_size;
   code_load.code_id_ = code_index_;
 
+  // Code moves refer back to the id of the load, see CodeMoveEvent.
+  (*code_ids_)[reinterpret_cast<Address>(code_pointer)] = code_index_;
   code_index_++;
 
   LogWriteBytes(reinterpret_cast<const char*>(&code_load), sizeof(code_load));
@@ -461,13 +482,24 @@ void PerfJitLogger::LogWriteDebugInfo(const wasm::WasmCode* code) {
 }
 
 void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
+  if (code.has_unwinding_info()) {
+    LogWriteUnwindingInfo(
+        reinterpret_cast<const uint8_t*>(code.unwinding_info_start()),
+        static_cast<int>(code.unwinding_info_size()));
+  } else {
+    LogWriteUnwindingInfo(nullptr, 0);
+  }
+}
+
+void PerfJitLogger::LogWriteUnwindingInfo(const uint8_t* eh_frame,
+                                          int eh_frame_size) {
   PerfJitCodeUnwindingInfo unwinding_info_header;
   unwinding_info_header.event_ = PerfJitCodeLoad::kUnwindingInfo;
   unwinding_info_header.time_stamp_ = GetTimestamp();
   unwinding_info_header.eh_frame_hdr_size_ = EhFrameConstants::kEhFrameHdrSize;
 
-  if (code.has_unwinding_info()) {
-    unwinding_info_header.unwinding_size_ = code.unwinding_info_size();
+  if (eh_frame != nullptr) {
+    unwinding_info_header.unwinding_size_ = eh_frame_size;
     unwinding_info_header.mapped_size_ = unwinding_info_header.unwinding_size_;
   } else {
     unwinding_info_header.unwinding_size_ = EhFrameConstants::kEhFrameHdrSize;
@@ -482,9 +514,8 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
   LogWriteBytes(reinterpret_cast<const char*>(&unwinding_info_header),
                 sizeof(unwinding_info_header));
 
-  if (code.has_unwinding_info()) {
-    LogWriteBytes(reinterpret_cast<const char*>(code.unwinding_info_start()),
-                  code.unwinding_info_size());
+  if (eh_frame != nullptr) {
+    LogWriteBytes(reinterpret_cast<const char*>(eh_frame), eh_frame_size);
   } else {
     OFStream perf_output_stream(perf_output_handle_);
     EhFrameWriter::WriteEmptyEhFrame(perf_output_stream);
@@ -496,9 +527,38 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code code) {
 }
 
 void PerfJitLogger::CodeMoveEvent(AbstractCode from, AbstractCode to) {
-  // We may receive a CodeMove event if a BytecodeArray object moves. Otherwise
-  // code relocation is not supported.
-  CHECK(from.IsBytecodeArray());
+  // Bytecode is not reported to perf, so there is nothing to move.
+  if (from.IsBytecodeArray()) return;
+
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  // Code that was never reported, e.g. because of
+  // --perf-basic-prof-only-functions, has no load record to move.
+  Address from_address = from.InstructionStart();
+  auto it = code_ids_->find(from_address);
+  if (it == code_ids_->end()) return;
+  uint64_t code_id = it->second;
+  code_ids_->erase(it);
+
+  Address to_address = to.InstructionStart();
+  (*code_ids_)[to_address] = code_id;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeLoad::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ =
+      static_cast<uint32_t>(base::OS::GetCurrentProcessId());
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = static_cast<uint64_t>(to_address);
+  code_move.old_code_address_ = static_cast<uint64_t>(from_address);
+  code_move.new_code_address_ = static_cast<uint64_t>(to_address);
+  code_move.code_size_ = Code::cast(to).ExecutableInstructionSize();
+  code_move.code_id_ = code_id;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
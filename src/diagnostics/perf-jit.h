@@ -28,6 +28,8 @@
 #ifndef V8_DIAGNOSTICS_PERF_JIT_H_
 #define V8_DIAGNOSTICS_PERF_JIT_H_
 
+#include <unordered_map>
+
 #include "include/v8config.h"
 
 // {PerfJitLogger} is only implemented on Linux.
@@ -77,6 +79,8 @@ class PerfJitLogger : public CodeEventLogger {
   void LogWriteDebugInfo(Handle<Code> code, Handle<SharedFunctionInfo> shared);
   void LogWriteDebugInfo(const wasm::WasmCode* code);
   void LogWriteUnwindingInfo(Code code);
+  // Writes |eh_frame|, or an empty eh_frame if it is nullptr.
+  void LogWriteUnwindingInfo(const uint8_t* eh_frame, int eh_frame_size);
 
   static const uint32_t kElfMachIA32 = 3;
   static const uint32_t kElfMachX64 = 62;
@@ -125,6 +129,9 @@ class PerfJitLogger : public CodeEventLogger {
   static uint64_t reference_count_;
   static void* marker_address_;
   static uint64_t code_index_;
+  // Maps the instruction start of every reported code object to the id of
+  // its load record, so that moves can refer to it.
+  static std::unordered_map<Address, uint64_t>* code_ids_;
 };
 
 }  // namespace internal
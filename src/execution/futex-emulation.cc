@@ -5,6 +5,8 @@
 #include "src/execution/futex-emulation.h"
 
 #include <limits>
+#include <unordered_map>
+#include <vector>
 
 #include "src/api/api-inl.h"
 #include "src/base/logging.h"
@@ -24,6 +26,9 @@ namespace internal {
 
 using AtomicsWaitEvent = v8::Isolate::AtomicsWaitEvent;
 
+// The waiting nodes are kept in one list per wait location, so that Wake only
+// visits the nodes waiting on the location it wakes, no matter how many agents
+// wait elsewhere.
 class FutexWaitList {
  public:
   FutexWaitList() = default;
@@ -31,6 +36,16 @@ class FutexWaitList {
   void AddNode(FutexWaitListNode* node);
   void RemoveNode(FutexWaitListNode* node);
 
+  static void* ToWaitLocation(const BackingStore* backing_store, size_t addr) {
+    return static_cast<int8_t*>(backing_store->buffer_start()) + addr;
+  }
+
+  // Returns the first node waiting on |wait_location|, or nullptr.
+  FutexWaitListNode* head(void* wait_location) const {
+    auto it = location_lists_.find(wait_location);
+    return it == location_lists_.end() ? nullptr : it->second.head;
+  }
+
   // For checking the internal consistency of the FutexWaitList.
   void Verify();
   // Verifies the local consistency of |node|. If it's the first node of its
@@ -43,13 +58,13 @@ class FutexWaitList {
  private:
   friend class FutexEmulation;
 
-  FutexWaitListNode* head_ = nullptr;
-  FutexWaitListNode* tail_ = nullptr;
-
   struct HeadAndTail {
     FutexWaitListNode* head;
     FutexWaitListNode* tail;
   };
+  // Wait location -> linked list of Nodes waiting on it. Empty lists are
+  // removed.
+  std::unordered_map<void*, HeadAndTail> location_lists_;
   // Isolate* -> linked list of Nodes which are waiting for their Promises to
   // be resolved.
   std::map<Isolate*, HeadAndTail> isolate_promises_to_resolve_;
@@ -156,35 +171,41 @@ void FutexEmulation::NotifyAsyncWaiter(FutexWaitListNode* node) {
 void FutexWaitList::AddNode(FutexWaitListNode* node) {
   DCHECK_NULL(node->prev_);
   DCHECK_NULL(node->next_);
-  if (tail_) {
-    tail_->next_ = node;
+  DCHECK_NOT_NULL(node->wait_location_);
+  auto it = location_lists_.find(node->wait_location_);
+  if (it == location_lists_.end()) {
+    location_lists_.insert(
+        std::make_pair(node->wait_location_, HeadAndTail{node, node}));
   } else {
-    head_ = node;
+    it->second.tail->next_ = node;
+    node->prev_ = it->second.tail;
+    it->second.tail = node;
   }
 
-  node->prev_ = tail_;
-  tail_ = node;
-
   Verify();
 }
 
 void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
-  DCHECK(NodeIsOnList(node, head_));
+  auto it = location_lists_.find(node->wait_location_);
+  DCHECK_NE(location_lists_.end(), it);
+  DCHECK(NodeIsOnList(node, it->second.head));
 
   if (node->prev_) {
     node->prev_->next_ = node->next_;
   } else {
-    DCHECK_EQ(node, head_);
-    head_ = node->next_;
+    DCHECK_EQ(node, it->second.head);
+    it->second.head = node->next_;
   }
 
   if (node->next_) {
     node->next_->prev_ = node->prev_;
   } else {
-    DCHECK_EQ(node, tail_);
-    tail_ = node->prev_;
+    DCHECK_EQ(node, it->second.tail);
+    it->second.tail = node->prev_;
   }
 
+  if (it->second.head == nullptr) location_lists_.erase(it);
+
   node->prev_ = node->next_ = nullptr;
 
   Verify();
@@ -336,14 +357,15 @@ Object FutexEmulation::WaitSync(Isolate* isolate,
     FutexWaitListNode* node = isolate->futex_wait_list_node();
     node->backing_store_ = backing_store;
     node->wait_addr_ = addr;
+    node->wait_location_ =
+        FutexWaitList::ToWaitLocation(backing_store.get(), addr);
     node->waiting_ = true;
 
     // Reset node->waiting_ = false when leaving this scope (but while
     // still holding the lock).
     FutexWaitListNode::ResetWaitingOnScopeExit reset_waiting(node);
 
-    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(
-        static_cast<int8_t*>(backing_store->buffer_start()) + addr);
+    std::atomic<T>* p = reinterpret_cast<std::atomic<T>*>(node->wait_location_);
     if (p->load() != value) {
       result = handle(Smi::FromInt(WaitReturnValue::kNotEqual), isolate);
       callback_result = AtomicsWaitEvent::kNotEqual;
@@ -448,6 +470,8 @@ FutexWaitListNode::FutexWaitListNode(
     : isolate_for_async_waiters_(isolate),
       backing_store_(backing_store),
       wait_addr_(wait_addr),
+      wait_location_(
+          FutexWaitList::ToWaitLocation(backing_store.get(), wait_addr)),
       waiting_(true) {
   auto v8_isolate = reinterpret_cast<v8::Isolate*>(isolate);
   task_runner_ = V8::GetCurrentPlatform()->GetForegroundTaskRunner(v8_isolate);
@@ -563,7 +587,11 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   std::shared_ptr<BackingStore> backing_store = array_buffer->GetBackingStore();
 
   base::MutexGuard lock_guard(g_mutex.Pointer());
-  FutexWaitListNode* node = g_wait_list.Pointer()->head_;
+  // Only nodes waiting on this location are visited. Their backing store is
+  // still compared, since a dead backing store's memory may be reused for
+  // this one.
+  FutexWaitListNode* node = g_wait_list.Pointer()->head(
+      FutexWaitList::ToWaitLocation(backing_store.get(), addr));
   while (node && num_waiters_to_wake > 0) {
     bool delete_this_node = false;
     std::shared_ptr<BackingStore> node_backing_store =
@@ -573,8 +601,8 @@ Object FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
       node = node->next_;
       continue;
     }
-    if (backing_store.get() == node_backing_store.get() &&
-        addr == node->wait_addr_) {
+    if (backing_store.get() == node_backing_store.get()) {
+      DCHECK_EQ(addr, node->wait_addr_);
       node->waiting_ = false;
 
       // Retrieve the next node to iterate before calling NotifyAsyncWaiter,
@@ -765,20 +793,26 @@ void FutexEmulation::HandleAsyncWaiterTimeout(FutexWaitListNode* node) {
 void FutexEmulation::IsolateDeinit(Isolate* isolate) {
   base::MutexGuard lock_guard(g_mutex.Pointer());
 
-  FutexWaitListNode* node = g_wait_list.Pointer()->head_;
-  while (node) {
-    if (node->isolate_for_async_waiters_ == isolate) {
-      // The Isolate is going away; don't bother cleaning up the Promises in the
-      // NativeContext. Also we don't need to cancel the timeout task, since it
-      // will be cancelled by Isolate::Deinit.
-      node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
-      g_wait_list.Pointer()->RemoveNode(node);
-      node = DeleteAsyncWaiterNode(node);
-    } else {
-      node = node->next_;
+  // Removing nodes may remove their lists, so collect them first.
+  std::vector<FutexWaitListNode*> nodes_to_delete;
+  for (auto& location_list : g_wait_list.Pointer()->location_lists_) {
+    for (FutexWaitListNode* node = location_list.second.head; node;
+         node = node->next_) {
+      if (node->isolate_for_async_waiters_ == isolate) {
+        nodes_to_delete.push_back(node);
+      }
     }
   }
+  for (FutexWaitListNode* node : nodes_to_delete) {
+    // The Isolate is going away; don't bother cleaning up the Promises in the
+    // NativeContext. Also we don't need to cancel the timeout task, since it
+    // will be cancelled by Isolate::Deinit.
+    node->timeout_task_id_ = CancelableTaskManager::kInvalidTaskId;
+    g_wait_list.Pointer()->RemoveNode(node);
+    delete node;
+  }
 
+  FutexWaitListNode* node;
   auto& isolate_map = g_wait_list.Pointer()->isolate_promises_to_resolve_;
   auto it = isolate_map.find(isolate);
   if (it != isolate_map.end()) {
@@ -801,12 +835,12 @@ Object FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
   base::MutexGuard lock_guard(g_mutex.Pointer());
 
   int waiters = 0;
-  FutexWaitListNode* node = g_wait_list.Pointer()->head_;
+  FutexWaitListNode* node = g_wait_list.Pointer()->head(
+      FutexWaitList::ToWaitLocation(backing_store.get(), addr));
   while (node) {
     std::shared_ptr<BackingStore> node_backing_store =
         node->backing_store_.lock();
-    if (backing_store.get() == node_backing_store.get() &&
-        addr == node->wait_addr_ && node->waiting_) {
+    if (backing_store.get() == node_backing_store.get() && node->waiting_) {
       waiters++;
     }
 
@@ -820,12 +854,13 @@ Object FutexEmulation::NumAsyncWaitersForTesting(Isolate* isolate) {
   base::MutexGuard lock_guard(g_mutex.Pointer());
 
   int waiters = 0;
-  FutexWaitListNode* node = g_wait_list.Pointer()->head_;
-  while (node) {
-    if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
-      waiters++;
+  for (auto& location_list : g_wait_list.Pointer()->location_lists_) {
+    for (FutexWaitListNode* node = location_list.second.head; node;
+         node = node->next_) {
+      if (node->isolate_for_async_waiters_ == isolate && node->waiting_) {
+        waiters++;
+      }
     }
-    node = node->next_;
   }
 
   return Smi::FromInt(waiters);
@@ -885,10 +920,13 @@ void FutexWaitList::VerifyNode(FutexWaitListNode* node, FutexWaitListNode* head,
 
 void FutexWaitList::Verify() {
 #ifdef DEBUG
-  FutexWaitListNode* node = head_;
-  while (node) {
-    VerifyNode(node, head_, tail_);
-    node = node->next_;
+  for (auto it : location_lists_) {
+    auto node = it.second.head;
+    while (node) {
+      VerifyNode(node, it.second.head, it.second.tail);
+      DCHECK_EQ(it.first, node->wait_location_);
+      node = node->next_;
+    }
   }
 
   for (auto it : isolate_promises_to_resolve_) {
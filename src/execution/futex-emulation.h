@@ -94,12 +94,16 @@ class FutexWaitListNode {
   CancelableTaskManager* cancelable_task_manager_ = nullptr;
 
   base::ConditionVariable cond_;
-  // prev_ and next_ are protected by FutexEmulation::mutex_.
+  // prev_ and next_ are protected by FutexEmulation::mutex_. They link the
+  // nodes waiting on the same location, or the nodes whose Promises are
+  // about to be resolved.
   FutexWaitListNode* prev_ = nullptr;
   FutexWaitListNode* next_ = nullptr;
 
   std::weak_ptr<BackingStore> backing_store_;
   size_t wait_addr_ = 0;
+  // The address waited on; the key of the node's list in FutexWaitList.
+  void* wait_location_ = nullptr;
   // waiting_ and interrupted_ are protected by FutexEmulation::mutex_
   // if this node is currently contained in FutexEmulation::wait_list_
   // or an AtomicsWaitWakeHandle has access to it.
@@ -6,6 +6,7 @@
 
 #include <stdlib.h>
 
+#include <algorithm>
 #include <atomic>
 #include <fstream>  // NOLINT(readability/streams)
 #include <memory>
@@ -36,6 +37,7 @@
 #include "src/diagnostics/basic-block-profiler.h"
 #include "src/diagnostics/compilation-statistics.h"
 #include "src/execution/frames-inl.h"
+#include "src/execution/execution.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/messages.h"
 #include "src/execution/microtask-queue.h"
@@ -467,6 +469,25 @@ void Isolate::InitializeOncePerProcess() {
                       expected, true, std::memory_order_relaxed));
 #endif
   per_isolate_thread_data_key_ = base::Thread::CreateThreadLocalKey();
+
+  if (FLAG_remap_embedded_builtins) {
+    // Builtins are the hottest code in the process, so backing them with
+    // huge pages saves many iTLB entries. This has to happen before any
+    // isolate can run them. Addresses do not change, so symbols and unwind
+    // info remain valid. This is only a hint and failures are ignored.
+    const uint8_t* code = DefaultEmbeddedBlobCode();
+    if (code != nullptr) {
+      USE(base::OS::RemapPagesToHugePages(const_cast<uint8_t*>(code),
+                                          DefaultEmbeddedBlobCodeSize()));
+    }
+#ifdef V8_MULTI_SNAPSHOTS
+    code = TrustedEmbeddedBlobCode();
+    if (code != nullptr) {
+      USE(base::OS::RemapPagesToHugePages(const_cast<uint8_t*>(code),
+                                          TrustedEmbeddedBlobCodeSize()));
+    }
+#endif
+  }
 }
 
 Address Isolate::get_address_from_id(IsolateAddressId id) {
@@ -794,21 +815,6 @@ class FrameArrayBuilder {
     return elements_;
   }
 
-  // Creates a StackTraceFrame object for each frame in the FrameArray.
-  Handle<FixedArray> GetElementsAsStackTraceFrameArray() {
-    elements_->ShrinkToFit(isolate_);
-    const int frame_count = elements_->FrameCount();
-    Handle<FixedArray> stack_trace =
-        isolate_->factory()->NewFixedArray(frame_count);
-
-    for (int i = 0; i < frame_count; ++i) {
-      Handle<StackTraceFrame> frame =
-          isolate_->factory()->NewStackTraceFrame(elements_, i);
-      stack_trace->set(i, *frame);
-    }
-    return stack_trace;
-  }
-
  private:
   // Poison stack frames below the first strict mode frame.
   // The stack trace API should not expose receivers and function
@@ -1040,8 +1046,22 @@ struct CaptureStackTraceOptions {
   bool async_stack_trace;
 };
 
-Handle<Object> CaptureStackTrace(Isolate* isolate, Handle<Object> caller,
-                                 CaptureStackTraceOptions options) {
+// Creates a StackTraceFrame object for each frame in the FrameArray.
+Handle<FixedArray> GetStackTraceFrames(Isolate* isolate,
+                                       Handle<FrameArray> elements) {
+  const int frame_count = elements->FrameCount();
+  Handle<FixedArray> stack_trace =
+      isolate->factory()->NewFixedArray(frame_count);
+  for (int i = 0; i < frame_count; ++i) {
+    Handle<StackTraceFrame> frame =
+        isolate->factory()->NewStackTraceFrame(elements, i);
+    stack_trace->set(i, *frame);
+  }
+  return stack_trace;
+}
+
+Handle<FrameArray> CaptureStackTrace(Isolate* isolate, Handle<Object> caller,
+                                     CaptureStackTraceOptions options) {
   DisallowJavascriptExecution no_js(isolate);
 
   wasm::WasmCodeRefScope code_ref_scope;
@@ -1165,7 +1185,7 @@ Handle<Object> CaptureStackTrace(Isolate* isolate, Handle<Object> caller,
     }
   }
 
-  return builder.GetElementsAsStackTraceFrameArray();
+  return builder.GetElements();
 }
 
 }  // namespace
@@ -1184,6 +1204,8 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
   options.filter_mode = FrameArrayBuilder::CURRENT_SECURITY_CONTEXT;
   options.capture_only_frames_subject_to_debugging = false;
 
+  // Only the raw frames are captured here. StackTraceFrame objects, and the
+  // symbolization they do, are created if and when the stack is formatted.
   return CaptureStackTrace(this, caller, options);
 }
 
@@ -1279,8 +1301,8 @@ Handle<FixedArray> Isolate::CaptureCurrentStackTrace(
           : FrameArrayBuilder::CURRENT_SECURITY_CONTEXT;
   options.capture_only_frames_subject_to_debugging = true;
 
-  return Handle<FixedArray>::cast(
-      CaptureStackTrace(this, factory()->undefined_value(), options));
+  return GetStackTraceFrames(
+      this, CaptureStackTrace(this, factory()->undefined_value(), options));
 }
 
 void Isolate::PrintStack(FILE* out, PrintStackMode mode) {
@@ -1491,6 +1513,54 @@ void Isolate::CancelTerminateExecution() {
   }
 }
 
+namespace {
+
+class ExecutionDeadlineTask final : public CancelableTask {
+ public:
+  ExecutionDeadlineTask(Isolate* isolate, uint64_t deadline_id)
+      : CancelableTask(isolate),
+        isolate_(isolate),
+        deadline_id_(deadline_id) {}
+
+  void RunInternal() final {
+    isolate_->TerminateExecutionAtDeadline(deadline_id_);
+  }
+
+ private:
+  Isolate* const isolate_;
+  const uint64_t deadline_id_;
+
+  DISALLOW_COPY_AND_ASSIGN(ExecutionDeadlineTask);
+};
+
+}  // namespace
+
+void Isolate::SetExecutionDeadline(double timeout_in_ms) {
+  uint64_t deadline_id;
+  {
+    ExecutionAccess access(this);
+    deadline_id = ++execution_deadline_id_;
+  }
+  // Tasks of replaced or cancelled deadlines still run, but find a different
+  // id and do nothing.
+  V8::GetCurrentPlatform()->CallDelayedOnWorkerThread(
+      std::make_unique<ExecutionDeadlineTask>(this, deadline_id),
+      timeout_in_ms / base::Time::kMillisecondsPerSecond);
+}
+
+void Isolate::CancelExecutionDeadline() {
+  ExecutionAccess access(this);
+  ++execution_deadline_id_;
+}
+
+void Isolate::TerminateExecutionAtDeadline(uint64_t deadline_id) {
+  // Holding the lock makes the check and the request atomic with respect to
+  // CancelExecutionDeadline.
+  ExecutionAccess access(this);
+  if (execution_deadline_id_ != deadline_id) return;
+  stack_guard()->RequestTerminateExecution();
+}
+
 void Isolate::RequestInterrupt(InterruptCallback callback, void* data) {
   ExecutionAccess access(this);
   api_interrupts_queue_.push(InterruptEntry(callback, data));
@@ -1651,9 +1721,12 @@ Object Isolate::Throw(Object raw_exception, MessageLocation* location) {
   //    captures messages or is verbose (which reports despite the catch).
   // 3) ReThrow from v8::TryCatch: The message from a previous throw still
   //    exists and we preserve it instead of creating a new message.
-  bool requires_message = try_catch_handler() == nullptr ||
-                          try_catch_handler()->is_verbose_ ||
-                          try_catch_handler()->capture_message_;
+  // 4) Uncatchable exceptions: The message would never be reported or passed
+  //    to a v8::TryCatch, so termination skips the message and its location.
+  bool requires_message = (try_catch_handler() == nullptr ||
+                           try_catch_handler()->is_verbose_ ||
+                           try_catch_handler()->capture_message_) &&
+                          is_catchable_by_javascript(*exception);
   bool rethrowing_message = thread_local_top()->rethrowing_message_;
 
   thread_local_top()->rethrowing_message_ = false;
@@ -2120,12 +2193,12 @@ void Isolate::PrintCurrentStackTrace(FILE* out) {
   options.filter_mode = FrameArrayBuilder::CURRENT_SECURITY_CONTEXT;
   options.capture_only_frames_subject_to_debugging = false;
 
-  Handle<FixedArray> frames = Handle<FixedArray>::cast(
-      CaptureStackTrace(this, this->factory()->undefined_value(), options));
+  Handle<FrameArray> frames =
+      CaptureStackTrace(this, this->factory()->undefined_value(), options);
 
   IncrementalStringBuilder builder(this);
-  for (int i = 0; i < frames->length(); ++i) {
-    Handle<StackTraceFrame> frame(StackTraceFrame::cast(frames->get(i)), this);
+  for (int i = 0; i < frames->FrameCount(); ++i) {
+    Handle<StackTraceFrame> frame = factory()->NewStackTraceFrame(frames, i);
 
     SerializeStackTraceFrame(this, frame, &builder);
   }
@@ -2200,8 +2273,7 @@ bool Isolate::ComputeLocationFromStackTrace(MessageLocation* target,
       JSReceiver::GetDataProperty(Handle<JSObject>::cast(exception), key);
   if (!property->IsFixedArray()) return false;
 
-  Handle<FrameArray> elements =
-      GetFrameArrayFromStackTrace(this, Handle<FixedArray>::cast(property));
+  Handle<FrameArray> elements = Handle<FrameArray>::cast(property);
 
   const int frame_count = elements->FrameCount();
   for (int i = 0; i < frame_count; i++) {
@@ -2859,7 +2931,10 @@ class TracingAccountingAllocator : public AccountingAllocator {
     }
     out << "\"allocated\": " << total_segment_bytes_allocated << ", "
         << "\"used\": " << total_zone_allocation_size << ", "
-        << "\"freed\": " << total_zone_freed_size << "}";
+        << "\"freed\": " << total_zone_freed_size << ", "
+        << "\"pooled\": " << GetCurrentPoolSize() << ", "
+        << "\"pool_hits\": " << GetSegmentPoolHits() << ", "
+        << "\"pool_misses\": " << GetSegmentPoolMisses() << "}";
   }
 
   Isolate* const isolate_;
@@ -3507,8 +3582,10 @@ bool Isolate::Init(ReadOnlyDeserializer* read_only_deserializer,
   eternal_handles_ = new EternalHandles();
   bootstrapper_ = new Bootstrapper(this);
   handle_scope_implementer_ = new HandleScopeImplementer(this);
-  load_stub_cache_ = new StubCache(this);
-  store_stub_cache_ = new StubCache(this);
+  load_stub_cache_ = new StubCache(this, FLAG_stub_cache_primary_table_bits,
+                                   FLAG_stub_cache_secondary_table_bits);
+  store_stub_cache_ = new StubCache(this, FLAG_stub_cache_primary_table_bits,
+                                    FLAG_stub_cache_secondary_table_bits);
   materialized_object_store_ = new MaterializedObjectStore(this);
   regexp_stack_ = new RegExpStack();
   regexp_stack_->isolate_ = this;
@@ -3603,6 +3680,19 @@ bool Isolate::Init(ReadOnlyDeserializer* read_only_deserializer,
   // embedded blob setup).
   init_memcopy_functions();
 
+#if V8_TARGET_ARCH_X64
+  if (FLAG_short_builtin_calls && embedded_blob_code_ != nullptr &&
+      !heap_.code_range().is_empty()) {
+    // Every call site in the code range has to reach every builtin.
+    const base::AddressRegion& code_range = heap_.code_range();
+    Address blob = reinterpret_cast<Address>(embedded_blob_code_);
+    Address start = std::min(code_range.begin(), blob);
+    Address end = std::max(code_range.end(), blob + embedded_blob_code_size_);
+    is_short_builtin_calls_enabled_ =
+        end - start < kMaxPCRelativeCodeRangeInMB * MB;
+  }
+#endif  // V8_TARGET_ARCH_X64
+
   if (FLAG_log_internal_timer_events) {
     set_event_logger(Logger::DefaultEventLoggerSentinel);
   }
@@ -3857,6 +3947,13 @@ void Isolate::DumpAndResetStats() {
     counters()->runtime_call_stats()->Print();
     counters()->runtime_call_stats()->Reset();
   }
+  if (V8_UNLIKELY(TracingFlags::ic_stats.load(std::memory_order_relaxed) &
+                  v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE)) {
+    load_stub_cache()->PrintStats("Load");
+    store_stub_cache()->PrintStats("Store");
+    load_stub_cache()->ResetStats();
+    store_stub_cache()->ResetStats();
+  }
   if (BasicBlockProfiler::Get()->HasData(this)) {
     StdoutStream out;
     BasicBlockProfiler::Get()->Print(out, this);
@@ -4132,7 +4229,7 @@ void Isolate::FireCallCompletedCallback(MicrotaskQueue* microtask_queue) {
 
 void Isolate::PromiseHookStateUpdated() {
   bool promise_hook_or_async_event_delegate =
-      promise_hook_ || async_event_delegate_;
+      promise_hook_ || async_event_delegate_ || has_context_promise_hooks_;
   bool promise_hook_or_debug_is_active_or_async_event_delegate =
       promise_hook_or_async_event_delegate || debug()->is_active();
   if (promise_hook_or_debug_is_active_or_async_event_delegate &&
@@ -4327,6 +4424,43 @@ void Isolate::RunPromiseHook(PromiseHookType type, Handle<JSPromise> promise,
                 v8::Utils::ToLocal(parent));
 }
 
+void Isolate::RunAllPromiseHooks(PromiseHookType type,
+                                 Handle<JSPromise> promise,
+                                 Handle<Object> parent) {
+  if (has_context_promise_hooks_ && !context().is_null()) {
+    int index;
+    switch (type) {
+      case PromiseHookType::kInit:
+        index = Context::PROMISE_HOOK_INIT_FUNCTION_INDEX;
+        break;
+      case PromiseHookType::kResolve:
+        index = Context::PROMISE_HOOK_RESOLVE_FUNCTION_INDEX;
+        break;
+      case PromiseHookType::kBefore:
+        index = Context::PROMISE_HOOK_BEFORE_FUNCTION_INDEX;
+        break;
+      case PromiseHookType::kAfter:
+        index = Context::PROMISE_HOOK_AFTER_FUNCTION_INDEX;
+        break;
+    }
+    Handle<Object> hook(native_context()->get(index), this);
+    if (hook->IsCallable()) {
+      // Only the init hook gets to see the parent promise.
+      Handle<Object> argv[] = {promise, parent};
+      int argc = type == PromiseHookType::kInit ? 2 : 1;
+      // Exceptions thrown by the hook are reported, like those thrown by
+      // microtasks, and don't affect the promise.
+      MaybeHandle<Object> maybe_exception;
+      Execution::TryCall(this, hook, factory()->undefined_value(), argc, argv,
+                         Execution::MessageHandling::kReport,
+                         &maybe_exception);
+    }
+  }
+  if (promise_hook_ || async_event_delegate_) {
+    RunPromiseHook(type, promise, parent);
+  }
+}
+
 void Isolate::RunPromiseHookForAsyncEventDelegate(PromiseHookType type,
                                                   Handle<JSPromise> promise) {
   if (!async_event_delegate_) return;
@@ -4535,6 +4669,14 @@ void Isolate::SetRAILMode(RAILMode rail_mode) {
   }
 }
 
+void Isolate::SetTieringPolicy(const v8::TieringPolicy& policy) {
+  tiering_policy_ = policy;
+  if (concurrent_recompilation_enabled()) {
+    optimizing_compile_dispatcher_->set_max_queued_jobs(
+        policy.max_concurrent_optimization_jobs());
+  }
+}
+
 void Isolate::IsolateInBackgroundNotification() {
   is_isolate_in_background_ = true;
   heap()->ActivateMemoryReducerIfNeeded();
@@ -4585,14 +4727,64 @@ void Isolate::CollectSourcePositionsForAllBytecodeArrays() {
   }
 }
 
+void Isolate::DiscardLazySourcePositions() {
+  DCHECK(FLAG_enable_lazy_source_positions);
+  // Recollecting source positions relies on the bytecode being regenerated
+  // identically, which is not the case while any of these modes are on.
+  if (NeedsSourcePositionsForProfiling() || !is_best_effort_code_coverage() ||
+      is_collecting_type_profile()) {
+    return;
+  }
+  DisallowHeapAllocation no_gc;
+  Object undefined = ReadOnlyRoots(this).undefined_value();
+  HeapObjectIterator iterator(heap());
+  for (HeapObject obj = iterator.Next(); !obj.is_null();
+       obj = iterator.Next()) {
+    if (!obj.IsSharedFunctionInfo()) continue;
+    SharedFunctionInfo sfi = SharedFunctionInfo::cast(obj);
+    // The debugger keeps its own copy of the bytecode that shares the table.
+    if (!sfi.HasBytecodeArray() || sfi.HasDebugInfo()) continue;
+    BytecodeArray bytecode = sfi.GetBytecodeArray();
+    if (!bytecode.HasSourcePositionTable() ||
+        bytecode.SourcePositionTable().length() == 0) {
+      continue;
+    }
+    bytecode.set_source_position_table(undefined);
+  }
+}
+
 #ifdef V8_INTL_SUPPORT
-icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type) {
-  return icu_object_cache_[cache_type].get();
+icu::UMemory* Isolate::get_cached_icu_object(ICUObjectCacheType cache_type,
+                                             Handle<Object> locales) {
+  DCHECK(locales->IsUndefined(this) || locales->IsString());
+  std::vector<ICUObjectCacheEntry>& entries = icu_object_cache_[cache_type];
+  Handle<String> locales_string;
+  if (locales->IsString()) {
+    locales_string = String::Flatten(this, Handle<String>::cast(locales));
+    // The empty string is not a valid locale and must not match undefined.
+    if (locales_string->length() == 0) return nullptr;
+  }
+  for (auto it = entries.begin(); it != entries.end(); ++it) {
+    if (locales_string.is_null()
+            ? !it->locales.empty()
+            : !locales_string->IsOneByteEqualTo(VectorOf(it->locales))) {
+      continue;
+    }
+    std::rotate(entries.begin(), it, it + 1);
+    return entries.front().obj.get();
+  }
+  return nullptr;
 }
 
 void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
+                                      Handle<Object> locales,
                                       std::shared_ptr<icu::UMemory> obj) {
-  icu_object_cache_[cache_type] = obj;
+  DCHECK(locales->IsUndefined(this) || locales->IsString());
+  std::string key;
+  if (locales->IsString()) key = String::cast(*locales).ToCString().get();
+  std::vector<ICUObjectCacheEntry>& entries = icu_object_cache_[cache_type];
+  if (entries.size() == kICUObjectCacheSize) entries.pop_back();
+  entries.insert(entries.begin(), {std::move(key), std::move(obj)});
 }
 
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
@@ -430,6 +430,8 @@ using DebugObjectCache = std::vector<Handle<HeapObject>>;
   V(const v8::StartupData*, snapshot_blob, nullptr)                            \
   V(int, code_and_metadata_size, 0)                                            \
   V(int, bytecode_and_metadata_size, 0)                                        \
+  V(int, bytecode_constant_pool_size, 0)                                       \
+  V(int, bytecode_source_position_table_size, 0)                               \
   V(int, external_script_source_size, 0)                                       \
   /* true if being profiled. Causes collection of extra compile info. */       \
   V(bool, is_profiling, false)                                                 \
@@ -870,6 +872,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Object TerminateExecution();
   void CancelTerminateExecution();
 
+  // See v8::Isolate::SetExecutionDeadline.
+  void SetExecutionDeadline(double timeout_in_ms);
+  void CancelExecutionDeadline();
+  // Called on a worker thread when the deadline with {deadline_id} expires.
+  void TerminateExecutionAtDeadline(uint64_t deadline_id);
+
   void RequestInterrupt(InterruptCallback callback, void* data);
   void InvokeApiInterruptCallbacks();
 
@@ -1144,8 +1152,20 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return code_coverage_mode() == debug::CoverageMode::kBlockBinary;
   }
 
+  bool is_block_best_effort_code_coverage() const {
+    return code_coverage_mode() == debug::CoverageMode::kBlockBestEffort;
+  }
+
   bool is_block_code_coverage() const {
-    return is_block_count_code_coverage() || is_block_binary_code_coverage();
+    return is_block_count_code_coverage() || is_block_binary_code_coverage() ||
+           is_block_best_effort_code_coverage();
+  }
+
+  // Whether invocation counts are read from feedback vectors, which are then
+  // kept alive in feedback_vectors_for_profiling_tools.
+  bool needs_feedback_vectors_for_code_coverage() const {
+    return !is_best_effort_code_coverage() &&
+           !is_block_best_effort_code_coverage();
   }
 
   bool is_binary_code_coverage() const {
@@ -1193,8 +1213,12 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       kDefaultCollator, kDefaultNumberFormat, kDefaultSimpleDateFormat,
       kDefaultSimpleDateFormatForTime, kDefaultSimpleDateFormatForDate};
 
-  icu::UMemory* get_cached_icu_object(ICUObjectCacheType cache_type);
+  // The cache holds a few objects per type, keyed by the locales argument
+  // they were created for, which is either undefined or a string.
+  icu::UMemory* get_cached_icu_object(ICUObjectCacheType cache_type,
+                                      Handle<Object> locales);
   void set_icu_object_in_cache(ICUObjectCacheType cache_type,
+                               Handle<Object> locales,
                                std::shared_ptr<icu::UMemory> obj);
   void clear_cached_icu_object(ICUObjectCacheType cache_type);
   void ClearCachedIcuObjects();
@@ -1349,6 +1373,10 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
         &promise_hook_or_debug_is_active_or_async_event_delegate_);
   }
 
+  Address has_context_promise_hooks_address() {
+    return reinterpret_cast<Address>(&has_context_promise_hooks_);
+  }
+
   Address handle_scope_implementer_address() {
     return reinterpret_cast<Address>(&handle_scope_implementer_);
   }
@@ -1362,10 +1390,25 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
                               AtomicsWaitWakeHandle* stop_handle);
 
   void SetPromiseHook(PromiseHook hook);
+  // Runs the embedder's PromiseHook and the async event delegate. Builtins
+  // call the JS hooks of the native context themselves before they enter
+  // the runtime for this.
   void RunPromiseHook(PromiseHookType type, Handle<JSPromise> promise,
                       Handle<Object> parent);
+  // Runs the JS hook of the current native context as well as the hooks
+  // above, for promise events that are only visible to the runtime.
+  void RunAllPromiseHooks(PromiseHookType type, Handle<JSPromise> promise,
+                          Handle<Object> parent);
   void PromiseHookStateUpdated();
 
+  // Set once any native context has JS promise hooks installed, see
+  // v8::Context::SetPromiseHooks.
+  bool HasContextPromiseHooks() const { return has_context_promise_hooks_; }
+  void SetHasContextPromiseHooks(bool context_promise_hook) {
+    has_context_promise_hooks_ = context_promise_hook;
+    PromiseHookStateUpdated();
+  }
+
   void AddDetachedContext(Handle<Context> context);
   void CheckDetachedContextsAfterGC();
 
@@ -1492,6 +1535,22 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
 
   RAILMode rail_mode() { return rail_mode_.load(); }
 
+  void SetTieringPolicy(const v8::TieringPolicy& policy);
+
+  const v8::TieringPolicy& tiering_policy() const { return tiering_policy_; }
+
+  // The interrupt budgets of this isolate's functions, see v8::TieringPolicy.
+  int interrupt_budget() const {
+    return tiering_policy_.interrupt_budget() > 0
+               ? tiering_policy_.interrupt_budget()
+               : FLAG_interrupt_budget;
+  }
+  int budget_for_feedback_vector_allocation() const {
+    return tiering_policy_.budget_for_feedback_vector_allocation() > 0
+               ? tiering_policy_.budget_for_feedback_vector_allocation()
+               : FLAG_budget_for_feedback_vector_allocation;
+  }
+
   double LoadStartTimeMs();
 
   void IsolateInForegroundNotification();
@@ -1540,12 +1599,22 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   // before such a mode change to ensure that this cannot happen.
   void CollectSourcePositionsForAllBytecodeArrays();
 
+  // Drops the source position tables of bytecode arrays that can be collected
+  // again lazily. Used to shed memory under critical memory pressure.
+  void DiscardLazySourcePositions();
+
   void AddCodeMemoryChunk(MemoryChunk* chunk);
   void RemoveCodeMemoryChunk(MemoryChunk* chunk);
   void AddCodeRange(Address begin, size_t length_in_bytes);
 
   bool RequiresCodeRange() const;
 
+  // True if the code range and the embedded blob are close enough for
+  // generated code to call builtins pc-relative, see --short-builtin-calls.
+  bool is_short_builtin_calls_enabled() const {
+    return is_short_builtin_calls_enabled_;
+  }
+
   static Address load_from_stack_count_address(const char* function_name);
   static Address store_to_stack_count_address(const char* function_name);
 
@@ -1674,6 +1743,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   CompilationCache* compilation_cache_ = nullptr;
   std::shared_ptr<Counters> async_counters_;
   base::RecursiveMutex break_access_;
+  // Identifies the current execution deadline, guarded by {break_access_}.
+  uint64_t execution_deadline_id_ = 0;
   base::SharedMutex transition_array_access_;
   base::Mutex string_table_mutex_;
   Logger* logger_ = nullptr;
@@ -1710,6 +1781,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   base::RandomNumberGenerator* random_number_generator_ = nullptr;
   base::RandomNumberGenerator* fuzzer_rng_ = nullptr;
   std::atomic<RAILMode> rail_mode_;
+  v8::TieringPolicy tiering_policy_;
   v8::Isolate::AtomicsWaitCallback atomics_wait_callback_ = nullptr;
   void* atomics_wait_callback_data_ = nullptr;
   PromiseHook promise_hook_ = nullptr;
@@ -1728,7 +1800,15 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
       return static_cast<std::size_t>(a);
     }
   };
-  std::unordered_map<ICUObjectCacheType, std::shared_ptr<icu::UMemory>,
+  struct ICUObjectCacheEntry {
+    // The locales string, or empty for undefined locales.
+    std::string locales;
+    std::shared_ptr<icu::UMemory> obj;
+  };
+  // Maximum number of cached objects per type.
+  static const size_t kICUObjectCacheSize = 8;
+  // Entries are ordered from most to least recently used.
+  std::unordered_map<ICUObjectCacheType, std::vector<ICUObjectCacheEntry>,
                      ICUObjectCacheTypeHash>
       icu_object_cache_;
 
@@ -1853,6 +1933,8 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   const uint8_t* embedded_blob_metadata_ = nullptr;
   uint32_t embedded_blob_metadata_size_ = 0;
 
+  bool is_short_builtin_calls_enabled_ = false;
+
   v8::ArrayBuffer::Allocator* array_buffer_allocator_ = nullptr;
   std::shared_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_shared_;
 
@@ -1865,6 +1947,7 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   debug::AsyncEventDelegate* async_event_delegate_ = nullptr;
   bool promise_hook_or_async_event_delegate_ = false;
   bool promise_hook_or_debug_is_active_or_async_event_delegate_ = false;
+  bool has_context_promise_hooks_ = false;
   int async_task_count_ = 0;
 
   v8::Isolate::AbortOnUncaughtExceptionCallback
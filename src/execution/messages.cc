@@ -740,14 +740,14 @@ MaybeHandle<Object> ConstructCallSite(Isolate* isolate,
 // Convert the raw frames as written by Isolate::CaptureSimpleStackTrace into
 // a JSArray of JSCallSite objects.
 MaybeHandle<JSArray> GetStackFrames(Isolate* isolate,
-                                    Handle<FixedArray> elems) {
-  const int frame_count = elems->length();
+                                    Handle<FrameArray> elems) {
+  const int frame_count = elems->FrameCount();
 
   Handle<FixedArray> frames = isolate->factory()->NewFixedArray(frame_count);
   for (int i = 0; i < frame_count; i++) {
     Handle<Object> site;
-    Handle<StackTraceFrame> frame(StackTraceFrame::cast(elems->get(i)),
-                                  isolate);
+    Handle<StackTraceFrame> frame =
+        isolate->factory()->NewStackTraceFrame(elems, i);
     ASSIGN_RETURN_ON_EXCEPTION(isolate, site, ConstructCallSite(isolate, frame),
                                JSArray);
     frames->set(i, *site);
@@ -812,7 +812,7 @@ MaybeHandle<Object> ErrorUtils::FormatStackTrace(Isolate* isolate,
                                                  Handle<JSObject> error,
                                                  Handle<Object> raw_stack) {
   DCHECK(raw_stack->IsFixedArray());
-  Handle<FixedArray> elems = Handle<FixedArray>::cast(raw_stack);
+  Handle<FrameArray> elems = Handle<FrameArray>::cast(raw_stack);
 
   const bool in_recursion = isolate->formatting_stack_trace();
   if (!in_recursion) {
@@ -881,11 +881,11 @@ MaybeHandle<Object> ErrorUtils::FormatStackTrace(Isolate* isolate,
 
   wasm::WasmCodeRefScope wasm_code_ref_scope;
 
-  for (int i = 0; i < elems->length(); ++i) {
+  for (int i = 0; i < elems->FrameCount(); ++i) {
     builder.AppendCString("\n    at ");
 
-    Handle<StackTraceFrame> frame(StackTraceFrame::cast(elems->get(i)),
-                                  isolate);
+    Handle<StackTraceFrame> frame =
+        isolate->factory()->NewStackTraceFrame(elems, i);
     SerializeStackTraceFrame(isolate, frame, &builder);
 
     if (isolate->has_pending_exception()) {
@@ -38,6 +38,32 @@ static const int kOSRBytecodeSizeAllowancePerTick = 48;
 // the very first time it is seen on the stack.
 static const int kMaxBytecodeSizeForEarlyOpt = 90;
 
+// Number of times a function has to be seen on the stack before native context
+// independent code is compiled for it with --turbo-nci-as-midtier.
+static const int kProfilerTicksBeforeMidTier = 1;
+
+// The tiering policy of the isolate overrides the defaults above where it
+// sets a value.
+static int TieringPolicyValueOr(int value, int default_value) {
+  return value > 0 ? value : default_value;
+}
+
+static int ProfilerTicksForOptimization(Isolate* isolate,
+                                        BytecodeArray bytecode) {
+  const v8::TieringPolicy& policy = isolate->tiering_policy();
+  int ticks = TieringPolicyValueOr(policy.ticks_before_optimization(),
+                                   kProfilerTicksBeforeOptimization);
+  int allowance_per_tick = TieringPolicyValueOr(
+      policy.bytecode_size_allowance_per_tick(), kBytecodeSizeAllowancePerTick);
+  return ticks + (bytecode.length() / allowance_per_tick);
+}
+
+static int MaxBytecodeSizeForEarlyOpt(Isolate* isolate) {
+  return TieringPolicyValueOr(
+      isolate->tiering_policy().max_bytecode_size_for_early_optimization(),
+      kMaxBytecodeSizeForEarlyOpt);
+}
+
 #define OPTIMIZATION_REASON_LIST(V)   \
   V(DoNotOptimize, "do not optimize") \
   V(HotAndStable, "hot and stable")   \
@@ -150,7 +176,54 @@ void RuntimeProfiler::MaybeOptimize(JSFunction function,
 
   if (reason != OptimizationReason::kDoNotOptimize) {
     Optimize(function, reason);
+  } else if (FLAG_turbo_nci_as_midtier) {
+    MaybeTierUpToMidTier(function);
+  }
+}
+
+void RuntimeProfiler::MaybeTierUpToMidTier(JSFunction function) {
+  if (function.HasOptimizationMarker()) return;
+  SharedFunctionInfo shared = function.shared();
+  if (!shared.IsUserJavaScript()) return;
+  // Functions with cached code pick it up right away, others are compiled
+  // once they are warm.
+  if (!shared.may_have_cached_code() &&
+      function.feedback_vector().profiler_ticks() <
+          kProfilerTicksBeforeMidTier) {
+    return;
+  }
+  // Recursive functions show up more than once.
+  for (Handle<JSFunction> candidate : mid_tier_candidates_) {
+    if (*candidate == function) return;
   }
+  mid_tier_candidates_.push_back(handle(function, isolate_));
+}
+
+void RuntimeProfiler::TierUpToMidTier(Handle<JSFunction> function) {
+  if (function->HasOptimizationMarker() || function->IsOptimized()) return;
+
+  // Warm functions run the native context independent code that has been
+  // cached for them, possibly by another native context.
+  Handle<Code> code;
+  if (function->shared().TryGetCachedCode(isolate_).ToHandle(&code)) {
+    if (FLAG_trace_opt) {
+      CodeTracer::Scope scope(isolate_->GetCodeTracer());
+      PrintF(scope.file(), "[installing mid-tier code for ");
+      function->ShortPrint(scope.file());
+      PrintF(scope.file(), "]\n");
+    }
+    function->set_code(*code);
+    return;
+  }
+
+  // Don't compile again if the code has been cached before and aged out since.
+  if (function->shared().may_have_cached_code()) return;
+  TraceRecompile(*function, "warm", "mid-tier", isolate_);
+  ConcurrencyMode mode = isolate_->concurrent_recompilation_enabled()
+                             ? ConcurrencyMode::kConcurrent
+                             : ConcurrencyMode::kNotConcurrent;
+  Compiler::CompileOptimized(function, mode,
+                             CompilationTarget::kNativeContextIndependent);
 }
 
 bool RuntimeProfiler::MaybeOSR(JSFunction function, InterpretedFrame* frame) {
@@ -178,26 +251,24 @@ OptimizationReason RuntimeProfiler::ShouldOptimize(JSFunction function,
                                                    BytecodeArray bytecode) {
   if (function.HasOptimizedCode()) return OptimizationReason::kDoNotOptimize;
   int ticks = function.feedback_vector().profiler_ticks();
-  int ticks_for_optimization =
-      kProfilerTicksBeforeOptimization +
-      (bytecode.length() / kBytecodeSizeAllowancePerTick);
+  int ticks_for_optimization = ProfilerTicksForOptimization(isolate_, bytecode);
+  int max_bytecode_size_for_early_opt = MaxBytecodeSizeForEarlyOpt(isolate_);
   if (ticks >= ticks_for_optimization) {
     return OptimizationReason::kHotAndStable;
   } else if (!any_ic_changed_ &&
-             bytecode.length() < kMaxBytecodeSizeForEarlyOpt) {
+             bytecode.length() < max_bytecode_size_for_early_opt) {
     // If no IC was patched since the last tick and this function is very
     // small, optimistically optimize it now.
     return OptimizationReason::kSmallFunction;
   } else if (FLAG_trace_opt_verbose) {
     PrintF("[not yet optimizing ");
     function.PrintName();
-    PrintF(", not enough ticks: %d/%d and ", ticks,
-           kProfilerTicksBeforeOptimization);
+    PrintF(", not enough ticks: %d/%d and ", ticks, ticks_for_optimization);
     if (any_ic_changed_) {
       PrintF("ICs changed]\n");
     } else {
       PrintF(" too large for small function optimization: %d/%d]\n",
-             bytecode.length(), kMaxBytecodeSizeForEarlyOpt);
+             bytecode.length(), max_bytecode_size_for_early_opt);
     }
   }
   return OptimizationReason::kDoNotOptimize;
@@ -208,36 +279,47 @@ void RuntimeProfiler::MarkCandidatesForOptimizationFromBytecode() {
 
   if (!isolate_->use_optimizer()) return;
 
-  DisallowHeapAllocation no_gc;
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                "V8.MarkCandidatesForOptimization");
 
-  // Run through the JavaScript frames and collect them. If we already
-  // have a sample of the function, we mark it for optimizations
-  // (eagerly or lazily).
-  int frame_count = 0;
-  int frame_count_limit = FLAG_frame_count;
-  for (JavaScriptFrameIterator it(isolate_);
-       frame_count++ < frame_count_limit && !it.done(); it.Advance()) {
-    JavaScriptFrame* frame = it.frame();
-    if (!frame->is_interpreted()) continue;
-
-    JSFunction function = frame->function();
-    DCHECK(function.shared().is_compiled());
-    if (!function.shared().IsInterpreted()) continue;
-
-    if (!function.has_feedback_vector()) continue;
-
-    MaybeOptimize(function, InterpretedFrame::cast(frame));
-
-    // TODO(leszeks): Move this increment to before the maybe optimize checks,
-    // and update the tests to assume the increment has already happened.
-    int ticks = function.feedback_vector().profiler_ticks();
-    if (ticks < Smi::kMaxValue) {
-      function.feedback_vector().set_profiler_ticks(ticks + 1);
+  {
+    DisallowHeapAllocation no_gc;
+
+    // Run through the JavaScript frames and collect them. If we already
+    // have a sample of the function, we mark it for optimizations
+    // (eagerly or lazily).
+    int frame_count = 0;
+    int frame_count_limit = FLAG_frame_count;
+    for (JavaScriptFrameIterator it(isolate_);
+         frame_count++ < frame_count_limit && !it.done(); it.Advance()) {
+      JavaScriptFrame* frame = it.frame();
+      if (!frame->is_interpreted()) continue;
+
+      JSFunction function = frame->function();
+      DCHECK(function.shared().is_compiled());
+      if (!function.shared().IsInterpreted()) continue;
+
+      if (!function.has_feedback_vector()) continue;
+
+      MaybeOptimize(function, InterpretedFrame::cast(frame));
+
+      // TODO(leszeks): Move this increment to before the maybe optimize
+      // checks, and update the tests to assume the increment has already
+      // happened.
+      int ticks = function.feedback_vector().profiler_ticks();
+      if (ticks < Smi::kMaxValue) {
+        function.feedback_vector().set_profiler_ticks(ticks + 1);
+      }
     }
+    any_ic_changed_ = false;
   }
-  any_ic_changed_ = false;
+
+  // Looking up and compiling code allocates, so it happens once the frames
+  // have been walked.
+  for (Handle<JSFunction> function : mid_tier_candidates_) {
+    TierUpToMidTier(function);
+  }
+  mid_tier_candidates_.clear();
 }
 
 void RuntimeProfiler::MarkCandidatesForOptimizationFromCode() {
@@ -245,7 +327,40 @@ void RuntimeProfiler::MarkCandidatesForOptimizationFromCode() {
     StdoutStream os;
     os << "NCI tier-up: Marking candidates for optimization" << std::endl;
   }
-  // TODO(jgruber,v8:8888): Implement.
+  // TODO(jgruber,v8:8888): Tier up from NCI code that is the highest tier
+  // only for testing, too.
+  if (!FLAG_turbo_nci_as_midtier || !isolate_->use_optimizer()) return;
+
+  DisallowHeapAllocation no_gc;
+  TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+               "V8.MarkCandidatesForOptimization");
+
+  // Only native context independent code updates the interrupt budget, so the
+  // topmost frame runs the mid-tier code that ran out of budget.
+  JavaScriptFrameIterator it(isolate_);
+  if (it.done() || !it.frame()->is_optimized()) return;
+
+  JSFunction function = it.frame()->function();
+  if (!function.IsOptimized() || !function.has_feedback_vector()) return;
+  if (function.HasOptimizationMarker()) return;
+  SharedFunctionInfo shared = function.shared();
+  if (shared.optimization_disabled() || !shared.HasBytecodeArray()) return;
+
+  int ticks = function.feedback_vector().profiler_ticks();
+  if (ticks < Smi::kMaxValue) {
+    function.feedback_vector().set_profiler_ticks(ticks + 1);
+  }
+  if (ticks <
+      ProfilerTicksForOptimization(isolate_, shared.GetBytecodeArray())) {
+    return;
+  }
+
+  // The mid-tier code does not check the optimization marker, so send the
+  // function through CompileLazy again, which picks up the marker and runs
+  // bytecode until the optimized code is ready.
+  function.ClearOptimizedCodeSlot("tiering up from mid-tier code");
+  function.set_code(isolate_->builtins()->builtin(Builtins::kCompileLazy));
+  Optimize(function, OptimizationReason::kHotAndStable);
 }
 
 }  // namespace internal
@@ -5,6 +5,9 @@
 #ifndef V8_EXECUTION_RUNTIME_PROFILER_H_
 #define V8_EXECUTION_RUNTIME_PROFILER_H_
 
+#include <vector>
+
+#include "src/handles/handles.h"
 #include "src/utils/allocation.h"
 
 namespace v8 {
@@ -22,7 +25,8 @@ class RuntimeProfiler {
 
   // Called from the interpreter when the bytecode interrupt has been exhausted.
   void MarkCandidatesForOptimizationFromBytecode();
-  // Likewise, from generated code.
+  // Likewise, from generated code. With --turbo-nci-as-midtier, this tiers up
+  // functions running native context independent code to TurboFan.
   void MarkCandidatesForOptimizationFromCode();
 
   void NotifyICChanged() { any_ic_changed_ = true; }
@@ -37,11 +41,18 @@ class RuntimeProfiler {
   bool MaybeOSR(JSFunction function, InterpretedFrame* frame);
   OptimizationReason ShouldOptimize(JSFunction function,
                                     BytecodeArray bytecode_array);
+  // Records warm functions in {mid_tier_candidates_}. TierUpToMidTier then
+  // installs their cached native context independent code, or compiles it.
+  void MaybeTierUpToMidTier(JSFunction function);
+  void TierUpToMidTier(Handle<JSFunction> function);
   void Optimize(JSFunction function, OptimizationReason reason);
   void Baseline(JSFunction function, OptimizationReason reason);
 
   Isolate* isolate_;
   bool any_ic_changed_;
+  // Warm functions found while walking the stack, only valid within
+  // MarkCandidatesForOptimizationFromBytecode.
+  std::vector<Handle<JSFunction>> mid_tier_candidates_;
 };
 
 }  // namespace internal
@@ -116,6 +116,13 @@ bool ThreadManager::RestoreThread() {
   if (lazily_archived_thread_.IsValid()) {
     EagerlyArchiveThread();
   }
+  // If no thread has archived state, which is the case when isolates are only
+  // handed between threads by top-level Lockers, the current thread is new
+  // and its per-thread data doesn't need to be looked up.
+  if (FirstThreadStateInUse() == nullptr) {
+    InitThread(access);
+    return false;
+  }
   Isolate::PerIsolateThreadData* per_thread =
       isolate_->FindPerThreadDataForThisThread();
   if (per_thread == nullptr || per_thread->thread_state() == nullptr) {
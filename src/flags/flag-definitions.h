@@ -386,6 +386,10 @@ DEFINE_BOOL(assert_types, false,
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(typed_array_pretenuring, false,
+            "pretenure typed arrays and their buffers using per-constructor "
+            "allocation sites")
+DEFINE_IMPLICATION(typed_array_pretenuring, allocation_site_pretenuring)
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_BOOL(always_promote_young_mc, true,
             "always promote young objects during mark-compact")
@@ -474,6 +478,11 @@ DEFINE_BOOL(enable_lazy_source_positions, V8_LAZY_SOURCE_POSITIONS_BOOL,
             "regenerate when actually required")
 DEFINE_BOOL(stress_lazy_source_positions, false,
             "collect lazy source positions immediately after lazy compile")
+DEFINE_BOOL(discard_source_positions_on_memory_pressure, false,
+            "drop source positions that can be regenerated lazily on critical "
+            "memory pressure")
+DEFINE_NEG_NEG_IMPLICATION(enable_lazy_source_positions,
+                           discard_source_positions_on_memory_pressure)
 DEFINE_STRING(print_bytecode_filter, "*",
               "filter for selecting which functions to print bytecode")
 #ifdef V8_TRACE_IGNITION
@@ -504,6 +513,9 @@ DEFINE_BOOL(trace_generalization, false, "trace map generalization")
 DEFINE_BOOL(turboprop, false, "enable experimental turboprop mid-tier compiler")
 DEFINE_BOOL(turboprop_mid_tier_reg_alloc, false,
             "enable experimental mid-tier register allocator")
+DEFINE_INT(turbo_mid_tier_reg_alloc_threshold, 0,
+           "use the mid-tier register allocator for functions with at least "
+           "this many instructions (0 = never)")
 DEFINE_NEG_IMPLICATION(turboprop, turbo_inlining)
 DEFINE_IMPLICATION(turboprop, concurrent_inlining)
 DEFINE_VALUE_IMPLICATION(turboprop, interrupt_budget, 15 * KB)
@@ -566,6 +578,8 @@ DEFINE_BOOL(trace_turbo_trimming, false, "trace TurboFan's graph trimmer")
 DEFINE_BOOL(trace_turbo_jt, false, "trace TurboFan's jump threading")
 DEFINE_BOOL(trace_turbo_ceq, false, "trace TurboFan's control equivalence")
 DEFINE_BOOL(trace_turbo_loop, false, "trace TurboFan's loop optimizations")
+DEFINE_BOOL(trace_turbo_vectorization, false,
+            "trace which innermost loops TurboFan could vectorize")
 DEFINE_BOOL(trace_turbo_alloc, false, "trace TurboFan's register allocator")
 DEFINE_BOOL(trace_all_uses, false, "trace all use positions")
 DEFINE_BOOL(trace_representation, false, "trace representation types")
@@ -629,6 +643,12 @@ DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
 DEFINE_BOOL(trace_osr, false, "trace on-stack replacement")
+DEFINE_BOOL(concurrent_osr, false,
+            "compile code for on-stack replacement concurrently, while the "
+            "loop keeps running in the interpreter")
+DEFINE_BOOL(share_osr_code, false,
+            "keep back edges armed while code for on-stack replacement is "
+            "cached, so that all closures of a function enter it right away")
 DEFINE_BOOL(analyze_environment_liveness, true,
             "analyze liveness of environment slots and zap dead values")
 DEFINE_BOOL(trace_environment_liveness, false,
@@ -644,18 +664,30 @@ DEFINE_IMPLICATION(turbo_profiling_verbose, turbo_profiling)
 DEFINE_BOOL(turbo_profiling_log_builtins, false,
             "emit data about basic block usage in builtins to v8.log (requires "
             "that V8 was built with v8_enable_builtins_profiling=true)")
+DEFINE_BOOL(turbo_profiling_log_js, false,
+            "emit data about basic block usage in optimized JavaScript "
+            "functions to v8.log")
+DEFINE_IMPLICATION(turbo_profiling_log_js, turbo_profiling)
 DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
+DEFINE_BOOL(turbo_loop_unrolling, false,
+            "Turbofan loop unrolling of small innermost loops")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "Turbofan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
+DEFINE_BOOL(turbo_fuse_generic_lowering, true,
+            "run generic lowering in the same graph traversal as early "
+            "optimization")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "Turbofan allocation folding")
 DEFINE_BOOL(turbo_instruction_scheduling, false,
             "enable instruction scheduling in TurboFan")
+DEFINE_BOOL(turbo_tuned_instruction_scheduling, true,
+            "enable instruction scheduling of optimized JavaScript and wasm "
+            "code on CPUs with a tuned latency model")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
 DEFINE_IMPLICATION(turbo_stress_instruction_scheduling,
@@ -684,6 +716,16 @@ DEFINE_IMPLICATION(turbo_nci, turbo_collect_feedback_in_generic_lowering)
 DEFINE_BOOL(turbo_nci_as_highest_tier, false,
             "replace default TF with NCI code as the highest tier for testing "
             "purposes.")
+DEFINE_BOOL(turbo_nci_cross_context_sharing, false,
+            "share cached native context independent code and the hotness "
+            "of functions between all native contexts of an isolate")
+DEFINE_IMPLICATION(turbo_nci_cross_context_sharing, turbo_nci)
+DEFINE_BOOL(turbo_nci_as_midtier, false,
+            "use native context independent code as a mid tier between "
+            "Ignition and TurboFan: warm functions run cached NCI code, which "
+            "tiers up to TurboFan once it gets hot")
+DEFINE_IMPLICATION(turbo_nci_as_midtier, turbo_nci)
+DEFINE_NEG_IMPLICATION(turbo_nci_as_midtier, turbo_nci_as_highest_tier)
 DEFINE_BOOL(print_nci_code, false, "print native context independent code.")
 DEFINE_BOOL(trace_turbo_nci, false, "trace native context independent code.")
 DEFINE_BOOL(turbo_collect_feedback_in_generic_lowering, true,
@@ -735,8 +777,15 @@ DEFINE_UINT(wasm_max_code_space, v8::internal::kMaxWasmCodeMB,
 DEFINE_BOOL(wasm_tier_up, true,
             "enable tier up to the optimizing compiler (requires --liftoff to "
             "have an effect)")
-DEFINE_BOOL(wasm_dynamic_tiering, false,
-            "enable dynamic tier up to the optimizing compiler")
+DEFINE_BOOL(wasm_dynamic_tiering, true,
+            "only tier up functions to the optimizing compiler once Liftoff "
+            "code found them to be hot (requires --wasm-tier-up)")
+DEFINE_INT(wasm_tiering_budget, 1000,
+           "number of calls and loop iterations after which a function gets "
+           "tiered up with --wasm-dynamic-tiering")
+DEFINE_INT(wasm_caching_threshold, 1000000,
+           "bytes of top tier code generated with --wasm-dynamic-tiering "
+           "after which the module is offered for caching again")
 DEFINE_DEBUG_BOOL(trace_wasm_decoder, false, "trace decoding of wasm code")
 DEFINE_DEBUG_BOOL(trace_wasm_compiler, false, "trace compiling of wasm code")
 DEFINE_DEBUG_BOOL(trace_wasm_interpreter, false,
@@ -822,6 +871,9 @@ DEFINE_DEBUG_BOOL(trace_wasm_lazy_compilation, false,
                   "trace lazy compilation of wasm functions")
 DEFINE_BOOL(wasm_lazy_validation, false,
             "enable lazy validation for lazily compiled wasm functions")
+DEFINE_BOOL(wasm_lazy_compilation_prefetch, true,
+            "with lazy compilation, compile the start function, its direct "
+            "callees and all exported functions in the background")
 
 // Flags for wasm prototyping that are not strictly features i.e., part of
 // an existing proposal that may be conditionally enabled.
@@ -860,6 +912,10 @@ DEFINE_SIZE_T(max_semi_space_size, 0,
               "max size of a semi-space (in MBytes), the new space consists of "
               "two semi-spaces")
 DEFINE_INT(semi_space_growth_factor, 2, "factor by which to grow the new space")
+DEFINE_FLOAT(scavenge_target_pause_ms, 0.0,
+             "size the semi-spaces based on the observed survival rate such "
+             "that scavenges stay below the given pause time (in ms), 0 "
+             "disables the controller")
 DEFINE_SIZE_T(max_old_space_size, 0, "max size of the old space (in Mbytes)")
 DEFINE_SIZE_T(
     max_heap_size, 0,
@@ -932,6 +988,13 @@ DEFINE_INT(incremental_marking_hard_trigger, 0,
            "threshold for starting incremental marking immediately in percent "
            "of available space: limit - size")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
+DEFINE_SIZE_T(shared_page_pool_size, 0,
+              "maximum number of freed pages that are kept reserved in a "
+              "process-wide pool for reuse by any heap (heaps outside of a "
+              "pointer-compression cage only)")
+DEFINE_SIZE_T(isolate_reservation_cache_size, 0,
+              "maximum number of pointer-compression cage reservations of "
+              "disposed isolates that are kept for reuse by new isolates")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
 DEFINE_BOOL(scavenge_task, true, "schedule scavenge tasks")
 DEFINE_INT(scavenge_task_trigger, 80,
@@ -940,6 +1003,20 @@ DEFINE_BOOL(scavenge_separate_stack_scanning, false,
             "use a separate phase for stack scanning in scavenge")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
 DEFINE_BOOL(write_protect_code_memory, true, "write protect code memory")
+DEFINE_BOOL(mergeable_read_only_space, false,
+            "let the operating system merge read-only space pages with "
+            "identical pages of other processes")
+DEFINE_BOOL(huge_code_pages, false,
+            "back the code range with huge pages where the operating system "
+            "supports it")
+DEFINE_BOOL(short_builtin_calls, false,
+            "reserve the code range next to the embedded builtins so that "
+            "generated code can call them pc-relative (x64 only)")
+DEFINE_BOOL(huge_large_object_pages, false,
+            "back large object space pages with huge pages where the "
+            "operating system supports it")
+DEFINE_BOOL(remap_embedded_builtins, false,
+            "remap the embedded builtins onto huge pages at startup")
 #ifdef V8_CONCURRENT_MARKING
 #define V8_CONCURRENT_MARKING_BOOL true
 #else
@@ -957,10 +1034,15 @@ DEFINE_BOOL_READONLY(array_buffer_extension, V8_ARRAY_BUFFER_EXTENSION_BOOL,
 DEFINE_IMPLICATION(array_buffer_extension, always_promote_young_mc)
 DEFINE_BOOL(concurrent_array_buffer_sweeping, true,
             "concurrently sweep array buffers")
-DEFINE_BOOL(concurrent_allocation, false, "concurrently allocate in old space")
+DEFINE_SIZE_T(array_buffer_pool_size, 1 * MB,
+              "bytes of dead small array buffers kept for reuse (0 disables)")
+DEFINE_BOOL(concurrent_allocation, true, "concurrently allocate in old space")
 DEFINE_BOOL(local_heaps, false, "allow heap access from background tasks")
+DEFINE_NEG_NEG_IMPLICATION(local_heaps, concurrent_allocation)
 DEFINE_IMPLICATION(concurrent_inlining, local_heaps)
 DEFINE_NEG_NEG_IMPLICATION(array_buffer_extension, local_heaps)
+DEFINE_BOOL(object_start_bitmap, false,
+            "maintain a per-page bitmap of object starts in paged spaces")
 DEFINE_BOOL(stress_concurrent_allocation, false,
             "start background threads that allocate memory")
 DEFINE_IMPLICATION(stress_concurrent_allocation, concurrent_allocation)
@@ -974,7 +1056,15 @@ DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
 DEFINE_BOOL(concurrent_store_buffer, true,
             "use concurrent store buffer processing")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_BOOL(concurrent_code_space_sweeping, true,
+            "sweep code pages on background threads and only write the "
+            "freed memory of a page on the main thread")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
+DEFINE_FLOAT(compaction_pause_budget_ms, 0.0,
+             "limit the bytes evacuated by a single mark-compact to what can "
+             "be compacted within the given time (in ms) based on the "
+             "observed compaction speed, spreading defragmentation across "
+             "several GCs (0 means no budget)")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
@@ -1042,12 +1132,22 @@ DEFINE_BOOL(never_compact, false,
 DEFINE_BOOL(compact_code_space, true, "Compact code space on full collections")
 DEFINE_BOOL(flush_bytecode, true,
             "flush of bytecode when it has not been executed recently")
+DEFINE_INT(flush_bytecode_min_size, 256,
+           "bytecode smaller than this (in bytes) is only flushed once it has "
+           "reached the maximum age")
 DEFINE_BOOL(stress_flush_bytecode, false, "stress bytecode flushing")
 DEFINE_BOOL(trace_flush_bytecode, false, "trace bytecode flushing")
 DEFINE_IMPLICATION(stress_flush_bytecode, flush_bytecode)
+DEFINE_BOOL(flush_feedback_vectors, false,
+            "flush the feedback vectors of functions that have not been "
+            "executed recently, and reallocate them lazily on the next call")
+DEFINE_NEG_NEG_IMPLICATION(lazy_feedback_allocation, flush_feedback_vectors)
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
+DEFINE_BOOL(parallel_marking_progress_bar, true,
+            "Claim chunks of large arrays before scanning them, so that "
+            "several concurrent markers can scan the same array in parallel.")
 DEFINE_BOOL(stress_per_context_marking_worklist, false,
             "Use per-context worklist for marking")
 DEFINE_BOOL(force_marking_deque_overflows, false,
@@ -1180,6 +1280,8 @@ DEFINE_BOOL(experimental_stack_trace_frames, false,
 DEFINE_BOOL(disallow_code_generation_from_strings, false,
             "disallow eval and friends")
 DEFINE_BOOL(expose_async_hooks, false, "expose async_hooks object")
+DEFINE_BOOL(expose_fast_api, false,
+            "expose an object with fast API functions for testing")
 DEFINE_STRING(expose_cputracemark_as, nullptr,
               "expose cputracemark extension under the specified name")
 #ifdef ENABLE_VTUNE_TRACEMARK
@@ -1215,6 +1317,10 @@ DEFINE_BOOL(trace_file_names, false,
 DEFINE_BOOL(always_opt, false, "always try to optimize functions")
 DEFINE_BOOL(always_osr, false, "always try to OSR functions")
 DEFINE_BOOL(prepare_always_opt, false, "prepare for turning on always opt")
+DEFINE_INT(deopt_loop_threshold, 8,
+           "number of deoptimizations in a row for the same reason at the "
+           "same position after which a function is no longer optimized "
+           "(0 means never)")
 
 DEFINE_BOOL(trace_serializer, false, "print code serializer trace")
 #ifdef DEBUG
@@ -1224,6 +1330,14 @@ DEFINE_BOOL(external_reference_stats, false,
 
 // compilation-cache.cc
 DEFINE_BOOL(compilation_cache, true, "enable compilation cache")
+DEFINE_SIZE_T(compilation_cache_script_max_size, 0,
+              "maximum size in KB of the script sources kept alive by the "
+              "compilation cache, evicting least recently used scripts "
+              "beyond it (0 means unbounded)")
+DEFINE_SIZE_T(compilation_cache_eval_max_size, 0,
+              "maximum size in KB of the eval and Function constructor "
+              "sources kept alive by each eval compilation cache, evicting "
+              "least recently used entries beyond it (0 means unbounded)")
 
 DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
@@ -1237,6 +1351,9 @@ DEFINE_BOOL(trace_compiler_dispatcher, false,
 // cpu-profiler.cc
 DEFINE_INT(cpu_profiler_sampling_interval, 1000,
            "CPU profiler sampling interval in microseconds")
+DEFINE_BOOL(trace_cpu_profiler_overhead, false,
+            "print the time the CPU profiler spent taking and processing "
+            "samples")
 
 // debugger
 DEFINE_BOOL(
@@ -1271,6 +1388,9 @@ DEFINE_BOOL(heap_profiler_use_embedder_graph, true,
             "Use the new EmbedderGraph API to get embedder nodes")
 DEFINE_INT(heap_snapshot_string_limit, 1024,
            "truncate strings to this length in the heap snapshot")
+DEFINE_BOOL(parallel_heap_object_filtering, true,
+            "use parallel tasks to find reachable objects before iterating "
+            "the heap for heap snapshots")
 
 // sampling-heap-profiler.cc
 DEFINE_BOOL(sampling_heap_profiler_suppress_randomness, false,
@@ -1292,6 +1412,12 @@ DEFINE_BOOL(modify_field_representation_inplace, true,
             "enable in-place field representation updates")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
            "maximum number of valid maps to track in POLYMORPHIC state")
+DEFINE_INT(stub_cache_primary_table_bits, 11,
+           "log2 of the number of entries in the primary megamorphic stub "
+           "cache tables")
+DEFINE_INT(stub_cache_secondary_table_bits, 9,
+           "log2 of the number of entries in the secondary megamorphic stub "
+           "cache tables")
 
 DEFINE_BOOL(native_code_counters, DEBUG_BOOL,
             "generate extra code for manipulating stats counters")
@@ -1383,6 +1509,11 @@ DEFINE_GENERIC_IMPLICATION(
 DEFINE_BOOL(rcs, false, "report runtime call counts and times")
 DEFINE_IMPLICATION(rcs, runtime_call_stats)
 
+DEFINE_INT(rcs_sampling_interval, 0,
+           "with --runtime-call-stats, only measure every n-th outermost "
+           "runtime call scope on each thread and the scopes nested in it "
+           "(0 measures all scopes)")
+
 DEFINE_BOOL(rcs_cpu_time, false,
             "report runtime times in cpu time (the default is wall time)")
 DEFINE_IMPLICATION(rcs_cpu_time, rcs)
@@ -1392,6 +1523,11 @@ DEFINE_BOOL(profile_deserialization, false,
             "Print the time it takes to deserialize the snapshot.")
 DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
+DEFINE_BOOL(verify_code_cache_checksum, true,
+            "Verify the checksum of code caches before deserializing them.")
+DEFINE_BOOL(verify_snapshot_checksum, true,
+            "Verify the checksum of a snapshot blob the first time an isolate "
+            "is deserialized from it.")
 #ifdef V8_ENABLE_THIRD_PARTY_HEAP
 DEFINE_UINT_READONLY(serialization_chunk_size, 1,
                      "Custom size for serialization chunks")
@@ -1414,6 +1550,10 @@ DEFINE_BOOL(regexp_tier_up, true,
 DEFINE_INT(regexp_tier_up_ticks, 1,
            "set the number of executions for the regexp interpreter before "
            "tiering-up to the compiler")
+DEFINE_INT(regexp_tier_up_subject_chars, 0,
+           "if positive, tier-up to the compiler once the regexp interpreter "
+           "has been run on this many subject characters, instead of after "
+           "the number of executions set by the tier up ticks flag")
 DEFINE_BOOL(regexp_peephole_optimization, REGEXP_PEEPHOLE_OPTIMIZATION_BOOL,
             "enable peephole optimization for regexp bytecode")
 DEFINE_BOOL(trace_regexp_peephole_optimization, false,
@@ -1424,6 +1564,23 @@ DEFINE_BOOL(trace_regexp_assembler, false,
 DEFINE_BOOL(trace_regexp_parser, false, "trace regexp parsing")
 DEFINE_BOOL(trace_regexp_tier_up, false, "trace regexp tiering up execution")
 
+DEFINE_BOOL(enable_experimental_regexp_engine, false,
+            "recognize regexps with 'l' flag and run them on the linear-time "
+            "experimental engine")
+DEFINE_BOOL(default_to_experimental_regexp_engine, false,
+            "run regexps with the experimental engine where possible")
+DEFINE_IMPLICATION(default_to_experimental_regexp_engine,
+                   enable_experimental_regexp_engine)
+DEFINE_BOOL(enable_experimental_regexp_engine_on_excessive_backtracks, false,
+            "fall back to the linear-time experimental engine after a "
+            "regexp has exceeded the backtrack threshold")
+DEFINE_UINT(regexp_backtracks_before_fallback, 50000,
+            "number of backtracks during regexp execution before fallback "
+            "to the experimental engine if "
+            "enable_experimental_regexp_engine_on_excessive_backtracks is set")
+DEFINE_BOOL(trace_experimental_regexp_engine, false,
+            "trace execution of the experimental regexp engine")
+
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
 DEFINE_MAYBE_BOOL(testing_maybe_bool_flag, "testing_maybe_bool_flag")
@@ -1462,7 +1619,11 @@ DEFINE_BOOL(target_is_simulator, false,
             "(mksnapshot only)")
 DEFINE_STRING(turbo_profiling_log_file, nullptr,
               "Path of the input file containing basic block counters for "
-              "builtins. (mksnapshot only)")
+              "builtins (mksnapshot) or for optimized JavaScript functions "
+              "(see --turbo-profiling-log-js)")
+DEFINE_BOOL(reorder_builtins, false,
+            "Lay out embedded builtins ordered by their execution counts in "
+            "--turbo-profiling-log-file. (mksnapshot only)")
 
 //
 // Minor mark compact collector flags.
@@ -1668,7 +1829,6 @@ DEFINE_PERF_PROF_BOOL(
 DEFINE_PERF_PROF_BOOL(
     perf_prof_delete_file,
     "Remove the perf file right after creating it (for testing only).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
 // TODO(v8:8462) Remove implication once perf supports remapping.
 DEFINE_NEG_IMPLICATION(perf_prof, write_protect_code_memory)
 DEFINE_NEG_IMPLICATION(perf_prof, wasm_write_protect_code_memory)
@@ -1777,6 +1937,7 @@ DEFINE_IMPLICATION(print_all_code, code_comments)
 DEFINE_BOOL(predictable, false, "enable predictable mode")
 DEFINE_IMPLICATION(predictable, single_threaded)
 DEFINE_NEG_IMPLICATION(predictable, memory_reducer)
+DEFINE_NEG_IMPLICATION(predictable, turbo_tuned_instruction_scheduling)
 DEFINE_VALUE_IMPLICATION(single_threaded, wasm_num_compilation_tasks, 0)
 DEFINE_NEG_IMPLICATION(single_threaded, wasm_async_compilation)
 
@@ -601,9 +601,12 @@ void ComputeFlagListHash() {
   for (size_t i = 0; i < num_flags; ++i) {
     Flag* current = &flags[i];
     if (current->type() == Flag::TYPE_BOOL &&
-        current->bool_variable() == &FLAG_profile_deserialization) {
-      // We want to be able to flip --profile-deserialization without
-      // causing the code cache to get invalidated by this hash.
+        (current->bool_variable() == &FLAG_profile_deserialization ||
+         current->bool_variable() == &FLAG_verify_code_cache_checksum ||
+         current->bool_variable() == &FLAG_verify_snapshot_checksum)) {
+      // We want to be able to flip --profile-deserialization and the checksum
+      // verification flags without causing the code cache to get invalidated
+      // by this hash.
       continue;
     }
     if (!current->IsDefault()) {
@@ -1265,17 +1265,23 @@ void GlobalHandles::IterateYoungStrongAndDependentRoots(RootVisitor* v) {
 
 void GlobalHandles::MarkYoungWeakDeadObjectsPending(
     WeakSlotCallbackWithHeap is_dead) {
+  DCHECK_EQ(0, number_of_young_pending_finalizers_);
   for (Node* node : young_nodes_) {
     DCHECK(node->is_in_young_list());
     if (node->IsWeak() && is_dead(isolate_->heap(), node->location())) {
       if (!node->IsPhantomCallback() && !node->IsPhantomResetHandle()) {
         node->MarkPending();
+        ++number_of_young_pending_finalizers_;
       }
     }
   }
 }
 
 void GlobalHandles::IterateYoungWeakDeadObjectsForFinalizers(RootVisitor* v) {
+  // Embedders mostly use phantom handles, which never become pending here. Skip
+  // the walk over all young nodes if there is no finalizer to keep alive.
+  if (number_of_young_pending_finalizers_ == 0) return;
+  number_of_young_pending_finalizers_ = 0;
   for (Node* node : young_nodes_) {
     DCHECK(node->is_in_young_list());
     if (node->IsWeakRetainer() && (node->state() == Node::PENDING)) {
@@ -1436,7 +1442,10 @@ void GlobalHandles::UpdateAndCompactListOfYoungNode(
   }
   DCHECK_LE(last, node_list->size());
   node_list->resize(last);
-  node_list->shrink_to_fit();
+  // Embedders that create and destroy many handles between scavenges would
+  // otherwise regrow the list after every scavenge. Only give memory back
+  // once most of it is unused.
+  if (last < node_list->capacity() / 4) node_list->shrink_to_fit();
 }
 
 void GlobalHandles::UpdateListOfYoungNodes() {
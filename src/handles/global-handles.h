@@ -241,6 +241,9 @@ class V8_EXPORT_PRIVATE GlobalHandles final {
   std::unique_ptr<OnStackTracedNodeSpace> on_stack_nodes_;
 
   size_t number_of_phantom_handle_resets_ = 0;
+  // Nodes marked pending by MarkYoungWeakDeadObjectsPending during the
+  // current scavenge.
+  size_t number_of_young_pending_finalizers_ = 0;
 
   std::vector<std::pair<Node*, PendingPhantomCallback>>
       regular_pending_phantom_callbacks_;
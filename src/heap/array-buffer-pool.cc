@@ -0,0 +1,70 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/array-buffer-pool.h"
+
+#include "src/base/bits.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+int ArrayBufferPool::SizeClass(size_t length) {
+  DCHECK_LT(0, length);
+  DCHECK_LE(length, kMaxPooledLength);
+  int size_class =
+      base::bits::WhichPowerOfTwo(base::bits::RoundUpToPowerOfTwo64(length));
+  DCHECK_LT(size_class, kNumSizeClasses);
+  return size_class;
+}
+
+bool ArrayBufferPool::Add(void* data, size_t length) {
+  if (length == 0 || length > kMaxPooledLength) return false;
+  if (pooled_bytes() + length > max_bytes_) return false;
+  base::MutexGuard guard(&mutex_);
+  std::vector<Entry>& entries = size_classes_[SizeClass(length)];
+  if (entries.size() == kMaxEntriesPerSizeClass) return false;
+  if (pooled_bytes() + length > max_bytes_) return false;
+  entries.push_back({data, length});
+  pooled_bytes_.fetch_add(length, std::memory_order_relaxed);
+  return true;
+}
+
+void* ArrayBufferPool::Take(size_t length) {
+  if (length == 0 || length > kMaxPooledLength) return nullptr;
+  if (pooled_bytes() == 0) {
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+  }
+  base::MutexGuard guard(&mutex_);
+  std::vector<Entry>& entries = size_classes_[SizeClass(length)];
+  // Search from the back, the most recently freed memory is likely to still
+  // be in the cache.
+  for (size_t i = entries.size(); i > 0; --i) {
+    Entry entry = entries[i - 1];
+    if (entry.length != length) continue;
+    entries[i - 1] = entries.back();
+    entries.pop_back();
+    pooled_bytes_.fetch_sub(length, std::memory_order_relaxed);
+    hits_.fetch_add(1, std::memory_order_relaxed);
+    return entry.data;
+  }
+  misses_.fetch_add(1, std::memory_order_relaxed);
+  return nullptr;
+}
+
+void ArrayBufferPool::ReleaseAll() {
+  base::MutexGuard guard(&mutex_);
+  for (std::vector<Entry>& entries : size_classes_) {
+    for (const Entry& entry : entries) {
+      allocator_->Free(entry.data, entry.length);
+    }
+    entries.clear();
+    entries.shrink_to_fit();
+  }
+  pooled_bytes_.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,77 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_ARRAY_BUFFER_POOL_H_
+#define V8_HEAP_ARRAY_BUFFER_POOL_H_
+
+#include <array>
+#include <atomic>
+#include <vector>
+
+#include "include/v8.h"
+#include "src/base/platform/mutex.h"
+#include "src/common/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Keeps the memory of small dead ArrayBuffers for reuse by new ArrayBuffers
+// of the same length, so that code which allocates and drops many buffers of
+// a few sizes doesn't go through the embedder's ArrayBuffer::Allocator every
+// time. The ArrayBufferSweeper adds memory, possibly on a background thread;
+// BackingStore::Allocate takes it on the main thread. All memory in the pool
+// was allocated by the isolate's allocator with exactly the pooled length.
+class ArrayBufferPool final {
+ public:
+  static constexpr size_t kMaxPooledLength = 64 * KB;
+
+  ArrayBufferPool(v8::ArrayBuffer::Allocator* allocator, size_t max_bytes)
+      : allocator_(allocator), max_bytes_(max_bytes) {}
+  ~ArrayBufferPool() { ReleaseAll(); }
+
+  ArrayBufferPool(const ArrayBufferPool&) = delete;
+  ArrayBufferPool& operator=(const ArrayBufferPool&) = delete;
+
+  // Takes ownership of |data| and returns true if the pool has room for it.
+  bool Add(void* data, size_t length);
+
+  // Returns pooled memory of exactly |length| bytes, with the contents of
+  // the dead buffer it belonged to, or nullptr.
+  void* Take(size_t length);
+
+  // Returns all pooled memory to the allocator.
+  void ReleaseAll();
+
+  size_t pooled_bytes() const {
+    return pooled_bytes_.load(std::memory_order_relaxed);
+  }
+  size_t hits() const { return hits_.load(std::memory_order_relaxed); }
+  size_t misses() const { return misses_.load(std::memory_order_relaxed); }
+
+ private:
+  struct Entry {
+    void* data;
+    size_t length;
+  };
+
+  // Lengths up to kMaxPooledLength are binned by the power of two that they
+  // round up to. A bin is searched for an exact length match.
+  static constexpr int kNumSizeClasses = 17;
+  static constexpr size_t kMaxEntriesPerSizeClass = 64;
+  static int SizeClass(size_t length);
+
+  v8::ArrayBuffer::Allocator* const allocator_;
+  const size_t max_bytes_;
+
+  base::Mutex mutex_;
+  std::array<std::vector<Entry>, kNumSizeClasses> size_classes_;
+  std::atomic<size_t> pooled_bytes_{0};
+  std::atomic<size_t> hits_{0};
+  std::atomic<size_t> misses_{0};
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_ARRAY_BUFFER_POOL_H_
@@ -3,8 +3,13 @@
 // found in the LICENSE file.
 
 #include "src/heap/array-buffer-sweeper.h"
+
+#include <array>
+
+#include "src/heap/array-buffer-pool.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
+#include "src/objects/backing-store.h"
 #include "src/objects/js-array-buffer.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tasks/task-utils.h"
@@ -12,6 +17,51 @@
 namespace v8 {
 namespace internal {
 
+// Deletes dead ArrayBufferExtensions and collects the memory of backing stores
+// that were allocated through the isolate's ArrayBuffer::Allocator so that it
+// can be released with a single FreeBatch() call, unless the ArrayBufferPool
+// keeps it for reuse. All other backing stores are released through their
+// destructor right away.
+class BackingStoreFreeBatch final {
+ public:
+  BackingStoreFreeBatch(v8::ArrayBuffer::Allocator* allocator,
+                        ArrayBufferPool* pool)
+      : allocator_(allocator), pool_(pool) {}
+  ~BackingStoreFreeBatch() { Flush(); }
+
+  BackingStoreFreeBatch(const BackingStoreFreeBatch&) = delete;
+  BackingStoreFreeBatch& operator=(const BackingStoreFreeBatch&) = delete;
+
+  void Free(ArrayBufferExtension* extension) {
+    std::shared_ptr<BackingStore> backing_store =
+        extension->RemoveBackingStore();
+    delete extension;
+    // Only the last owner may take over the memory of the backing store.
+    if (!allocator_ || !backing_store || backing_store.use_count() != 1) return;
+    if (!backing_store->ReleaseForBatchFree(allocator_, &data_[count_],
+                                            &lengths_[count_])) {
+      return;
+    }
+    if (pool_ && pool_->Add(data_[count_], lengths_[count_])) return;
+    if (++count_ == kBatchSize) Flush();
+  }
+
+  void Flush() {
+    if (count_ == 0) return;
+    allocator_->FreeBatch(data_.data(), lengths_.data(), count_);
+    count_ = 0;
+  }
+
+ private:
+  static constexpr size_t kBatchSize = 64;
+
+  v8::ArrayBuffer::Allocator* const allocator_;
+  ArrayBufferPool* const pool_;
+  std::array<void*, kBatchSize> data_;
+  std::array<size_t, kBatchSize> lengths_;
+  size_t count_ = 0;
+};
+
 void ArrayBufferList::Append(ArrayBufferExtension* extension) {
   if (head_ == nullptr) {
     DCHECK_NULL(tail_);
@@ -69,40 +119,49 @@ void ArrayBufferSweeper::EnsureFinished() {
   if (!sweeping_in_progress_) return;
   CHECK(V8_ARRAY_BUFFER_EXTENSION_BOOL);
 
+  EnsureListSwept(&job_.young_list);
+  EnsureListSwept(&job_.old_list);
+  Merge();
+
+  DecrementExternalMemoryCounters();
+  sweeping_in_progress_ = false;
+}
+
+void ArrayBufferSweeper::EnsureListSwept(ListSweepingJob* list_job) {
+  if (list_job->id == CancelableTaskManager::kInvalidTaskId) {
+    // The list was swept synchronously or there was nothing to sweep.
+    CHECK_EQ(list_job->state, SweepingState::Swept);
+    return;
+  }
+
   TryAbortResult abort_result =
-      heap_->isolate()->cancelable_task_manager()->TryAbort(job_.id);
+      heap_->isolate()->cancelable_task_manager()->TryAbort(list_job->id);
 
   switch (abort_result) {
     case TryAbortResult::kTaskAborted: {
-      Sweep();
-      Merge();
+      SweepList(list_job);
       break;
     }
 
     case TryAbortResult::kTaskRemoved: {
-      CHECK_NE(job_.state, SweepingState::Uninitialized);
-      if (job_.state == SweepingState::Prepared) Sweep();
-      Merge();
+      CHECK_NE(list_job->state, SweepingState::Uninitialized);
+      if (list_job->state == SweepingState::Prepared) SweepList(list_job);
       break;
     }
 
     case TryAbortResult::kTaskRunning: {
       base::MutexGuard guard(&sweeping_mutex_);
-      CHECK_NE(job_.state, SweepingState::Uninitialized);
+      CHECK_NE(list_job->state, SweepingState::Uninitialized);
       // Wait until task is finished with its work.
-      while (job_.state != SweepingState::Swept) {
+      while (list_job->state != SweepingState::Swept) {
         job_finished_.Wait(&sweeping_mutex_);
       }
-      Merge();
       break;
     }
 
     default:
       UNREACHABLE();
   }
-
-  DecrementExternalMemoryCounters();
-  sweeping_in_progress_ = false;
 }
 
 void ArrayBufferSweeper::DecrementExternalMemoryCounters() {
@@ -140,31 +199,39 @@ void ArrayBufferSweeper::RequestSweep(SweepingScope scope) {
 
   CHECK(V8_ARRAY_BUFFER_EXTENSION_BOOL);
 
+  Prepare(scope);
   if (!heap_->IsTearingDown() && !heap_->ShouldReduceMemory() &&
       FLAG_concurrent_array_buffer_sweeping) {
-    Prepare(scope);
-
-    auto task = MakeCancelableTask(heap_->isolate(), [this] {
-      TRACE_BACKGROUND_GC(
-          heap_->tracer(),
-          GCTracer::BackgroundScope::BACKGROUND_ARRAY_BUFFER_SWEEP);
-      base::MutexGuard guard(&sweeping_mutex_);
-      Sweep();
-      job_finished_.NotifyAll();
-    });
-    job_.id = task->id();
-    V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+    ScheduleListSweeping(&job_.young_list);
+    ScheduleListSweeping(&job_.old_list);
     sweeping_in_progress_ = true;
   } else {
-    Prepare(scope);
-    Sweep();
+    SweepList(&job_.young_list);
+    SweepList(&job_.old_list);
     Merge();
     DecrementExternalMemoryCounters();
   }
 }
 
+void ArrayBufferSweeper::ScheduleListSweeping(ListSweepingJob* list_job) {
+  if (list_job->list.IsEmpty()) {
+    SweepList(list_job);
+    return;
+  }
+
+  auto task = MakeCancelableTask(heap_->isolate(), [this, list_job] {
+    TRACE_BACKGROUND_GC(
+        heap_->tracer(),
+        GCTracer::BackgroundScope::BACKGROUND_ARRAY_BUFFER_SWEEP);
+    SweepList(list_job);
+  });
+  list_job->id = task->id();
+  V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+}
+
 void ArrayBufferSweeper::Prepare(SweepingScope scope) {
-  CHECK_EQ(job_.state, SweepingState::Uninitialized);
+  CHECK_EQ(job_.young_list.state, SweepingState::Uninitialized);
+  CHECK_EQ(job_.old_list.state, SweepingState::Uninitialized);
 
   if (scope == SweepingScope::Young) {
     job_ =
@@ -176,15 +243,21 @@ void ArrayBufferSweeper::Prepare(SweepingScope scope) {
     young_.Reset();
     old_.Reset();
   }
+  // Memory is not pooled when the heap is about to shrink.
+  job_.pool =
+      heap_->ShouldReduceMemory() ? nullptr : heap_->array_buffer_pool();
 }
 
 void ArrayBufferSweeper::Merge() {
-  CHECK_EQ(job_.state, SweepingState::Swept);
-  young_.Append(&job_.young);
-  old_.Append(&job_.old);
+  CHECK_EQ(job_.young_list.state, SweepingState::Swept);
+  CHECK_EQ(job_.old_list.state, SweepingState::Swept);
+  young_.Append(&job_.young_list.young);
+  old_.Append(&job_.young_list.old);
+  old_.Append(&job_.old_list.old);
   young_bytes_ = young_.Bytes();
   old_bytes_ = old_.Bytes();
-  job_.state = SweepingState::Uninitialized;
+  job_.young_list.state = SweepingState::Uninitialized;
+  job_.old_list.state = SweepingState::Uninitialized;
 }
 
 void ArrayBufferSweeper::ReleaseAll() {
@@ -230,43 +303,43 @@ void ArrayBufferSweeper::IncrementExternalMemoryCounters(size_t bytes) {
       ->AdjustAmountOfExternalAllocatedMemory(static_cast<int64_t>(bytes));
 }
 
-ArrayBufferSweeper::SweepingJob::SweepingJob()
-    : state(SweepingState::Uninitialized) {}
+ArrayBufferSweeper::ListSweepingJob::ListSweepingJob()
+    : id(CancelableTaskManager::kInvalidTaskId),
+      state(SweepingState::Uninitialized) {}
 
 ArrayBufferSweeper::SweepingJob ArrayBufferSweeper::SweepingJob::Prepare(
     ArrayBufferList young, ArrayBufferList old, SweepingScope scope) {
   SweepingJob job;
-  job.young = young;
-  job.old = old;
+  job.young_list.list = young;
+  job.young_list.state = SweepingState::Prepared;
+  job.old_list.list = old;
+  job.old_list.state = SweepingState::Prepared;
   job.scope = scope;
-  job.id = 0;
-  job.state = SweepingState::Prepared;
   return job;
 }
 
-void ArrayBufferSweeper::Sweep() {
-  CHECK_EQ(job_.state, SweepingState::Prepared);
+void ArrayBufferSweeper::SweepList(ListSweepingJob* list_job) {
+  CHECK_EQ(list_job->state, SweepingState::Prepared);
 
-  if (job_.scope == SweepingScope::Young) {
-    SweepYoung();
-  } else {
-    CHECK_EQ(job_.scope, SweepingScope::Full);
-    SweepFull();
+  {
+    BackingStoreFreeBatch free_batch(
+        heap_->isolate()->array_buffer_allocator(), job_.pool);
+    if (job_.scope == SweepingScope::Young) {
+      SweepListYoung(list_job, &free_batch);
+    } else {
+      CHECK_EQ(job_.scope, SweepingScope::Full);
+      SweepListFull(list_job, &free_batch);
+    }
   }
-  job_.state = SweepingState::Swept;
+  base::MutexGuard guard(&sweeping_mutex_);
+  list_job->state = SweepingState::Swept;
+  job_finished_.NotifyAll();
 }
 
-void ArrayBufferSweeper::SweepFull() {
+void ArrayBufferSweeper::SweepListFull(ListSweepingJob* list_job,
+                                       BackingStoreFreeBatch* free_batch) {
   CHECK_EQ(job_.scope, SweepingScope::Full);
-  ArrayBufferList promoted = SweepListFull(&job_.young);
-  ArrayBufferList survived = SweepListFull(&job_.old);
-
-  job_.old = promoted;
-  job_.old.Append(&survived);
-}
-
-ArrayBufferList ArrayBufferSweeper::SweepListFull(ArrayBufferList* list) {
-  ArrayBufferExtension* current = list->head_;
+  ArrayBufferExtension* current = list_job->list.head_;
   ArrayBufferList survivor_list;
 
   while (current) {
@@ -274,7 +347,7 @@ ArrayBufferList ArrayBufferSweeper::SweepListFull(ArrayBufferList* list) {
 
     if (!current->IsMarked()) {
       size_t bytes = current->accounting_length();
-      delete current;
+      free_batch->Free(current);
       IncrementFreedBytes(bytes);
     } else {
       current->Unmark();
@@ -284,13 +357,14 @@ ArrayBufferList ArrayBufferSweeper::SweepListFull(ArrayBufferList* list) {
     current = next;
   }
 
-  list->Reset();
-  return survivor_list;
+  list_job->list.Reset();
+  list_job->old = survivor_list;
 }
 
-void ArrayBufferSweeper::SweepYoung() {
+void ArrayBufferSweeper::SweepListYoung(ListSweepingJob* list_job,
+                                        BackingStoreFreeBatch* free_batch) {
   CHECK_EQ(job_.scope, SweepingScope::Young);
-  ArrayBufferExtension* current = job_.young.head_;
+  ArrayBufferExtension* current = list_job->list.head_;
 
   ArrayBufferList new_young;
   ArrayBufferList new_old;
@@ -300,7 +374,7 @@ void ArrayBufferSweeper::SweepYoung() {
 
     if (!current->IsYoungMarked()) {
       size_t bytes = current->accounting_length();
-      delete current;
+      free_batch->Free(current);
       IncrementFreedBytes(bytes);
     } else if (current->IsYoungPromoted()) {
       current->YoungUnmark();
@@ -313,8 +387,9 @@ void ArrayBufferSweeper::SweepYoung() {
     current = next;
   }
 
-  job_.old = new_old;
-  job_.young = new_young;
+  list_job->list.Reset();
+  list_job->old = new_old;
+  list_job->young = new_young;
 }
 
 void ArrayBufferSweeper::IncrementFreedBytes(size_t bytes) {
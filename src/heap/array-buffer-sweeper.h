@@ -13,6 +13,8 @@ namespace v8 {
 namespace internal {
 
 class ArrayBufferExtension;
+class ArrayBufferPool;
+class BackingStoreFreeBatch;
 class Heap;
 
 // Singly linked-list of ArrayBufferExtensions that stores head and tail of the
@@ -44,7 +46,8 @@ struct ArrayBufferList {
 };
 
 // The ArrayBufferSweeper iterates and deletes ArrayBufferExtensions
-// concurrently to the application.
+// concurrently to the application. Memory of dead backing stores is returned
+// to the embedder in batches via ArrayBuffer::Allocator::FreeBatch().
 class ArrayBufferSweeper {
  public:
   explicit ArrayBufferSweeper(Heap* heap)
@@ -72,14 +75,27 @@ class ArrayBufferSweeper {
 
   enum class SweepingState { Uninitialized, Prepared, Swept };
 
-  struct SweepingJob {
+  // The young and the old list are swept independently of each other and may
+  // be processed in parallel by separate tasks.
+  struct ListSweepingJob {
     CancelableTaskManager::Id id;
     SweepingState state;
+    // Extensions that are swept by this job.
+    ArrayBufferList list;
+    // Surviving extensions that remain in the young generation.
     ArrayBufferList young;
+    // Surviving extensions that are in or promoted to the old generation.
     ArrayBufferList old;
-    SweepingScope scope;
 
-    SweepingJob();
+    ListSweepingJob();
+  };
+
+  struct SweepingJob {
+    ListSweepingJob young_list;
+    ListSweepingJob old_list;
+    SweepingScope scope;
+    // Receives the memory of small dead backing stores, if not null.
+    ArrayBufferPool* pool = nullptr;
 
     static SweepingJob Prepare(ArrayBufferList young, ArrayBufferList old,
                                SweepingScope scope);
@@ -94,13 +110,13 @@ class ArrayBufferSweeper {
   void RequestSweep(SweepingScope sweeping_task);
   void Prepare(SweepingScope sweeping_task);
 
-  void Sweep();
-  void SweepYoung();
-  void SweepFull();
-  ArrayBufferList SweepListFull(ArrayBufferList* list);
-
-  ArrayBufferList SweepYoungGen();
-  void SweepOldGen(ArrayBufferExtension* extension);
+  void ScheduleListSweeping(ListSweepingJob* list_job);
+  void EnsureListSwept(ListSweepingJob* list_job);
+  void SweepList(ListSweepingJob* list_job);
+  void SweepListYoung(ListSweepingJob* list_job,
+                      BackingStoreFreeBatch* free_batch);
+  void SweepListFull(ListSweepingJob* list_job,
+                     BackingStoreFreeBatch* free_batch);
 
   void ReleaseAll();
   void ReleaseAll(ArrayBufferList* extension);
@@ -37,6 +37,16 @@ void CodeStatistics::RecordCodeAndMetadataStatistics(HeapObject object,
     } else {
       size += isolate->bytecode_and_metadata_size();
       isolate->set_bytecode_and_metadata_size(size);
+      // Break out the parts of the metadata that are worth shrinking.
+      BytecodeArray bytecode = abstract_code.GetBytecodeArray();
+      isolate->set_bytecode_constant_pool_size(
+          isolate->bytecode_constant_pool_size() +
+          bytecode.constant_pool().Size());
+      if (bytecode.HasSourcePositionTable()) {
+        isolate->set_bytecode_source_position_table_size(
+            isolate->bytecode_source_position_table_size() +
+            bytecode.SourcePositionTable().Size());
+      }
     }
 
 #ifdef DEBUG
@@ -51,6 +61,8 @@ void CodeStatistics::RecordCodeAndMetadataStatistics(HeapObject object,
 void CodeStatistics::ResetCodeAndMetadataStatistics(Isolate* isolate) {
   isolate->set_code_and_metadata_size(0);
   isolate->set_bytecode_and_metadata_size(0);
+  isolate->set_bytecode_constant_pool_size(0);
+  isolate->set_bytecode_source_position_table_size(0);
   isolate->set_external_script_source_size(0);
 #ifdef DEBUG
   ResetCodeStatistics(isolate);
@@ -103,6 +115,10 @@ void CodeStatistics::ReportCodeStatistics(Isolate* isolate) {
   if (isolate->bytecode_and_metadata_size() > 0) {
     PrintF("Bytecode size including metadata: %10d bytes\n",
            isolate->bytecode_and_metadata_size());
+    PrintF("  of which constant pools       : %10d bytes\n",
+           isolate->bytecode_constant_pool_size());
+    PrintF("  of which source positions     : %10d bytes\n",
+           isolate->bytecode_source_position_table_size());
   }
 
   // Report code comment statistics
@@ -389,7 +389,7 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
   MarkingWorklists marking_worklists(task_id, marking_worklists_holder_);
   ConcurrentMarkingVisitor visitor(
       task_id, &marking_worklists, weak_objects_, heap_,
-      task_state->mark_compact_epoch, Heap::GetBytecodeFlushMode(),
+      task_state->mark_compact_epoch, task_state->bytecode_flush_mode,
       heap_->local_embedder_heap_tracer()->InUse(), task_state->is_forced_gc,
       &task_state->memory_chunk_data);
   NativeContextInferrer& native_context_inferrer =
@@ -543,6 +543,7 @@ void ConcurrentMarking::ScheduleTasks() {
       task_state_[i].mark_compact_epoch =
           heap_->mark_compact_collector()->epoch();
       task_state_[i].is_forced_gc = heap_->is_current_gc_forced();
+      task_state_[i].bytecode_flush_mode = heap_->GetBytecodeFlushMode();
       is_pending_[i] = true;
       ++pending_task_count_;
       auto task =
@@ -110,6 +110,7 @@ class V8_EXPORT_PRIVATE ConcurrentMarking {
     size_t marked_bytes = 0;
     unsigned mark_compact_epoch;
     bool is_forced_gc;
+    BytecodeFlushMode bytecode_flush_mode;
     MemoryChunkDataMap memory_chunk_data;
     NativeContextInferrer native_context_inferrer;
     NativeContextStats native_context_stats;
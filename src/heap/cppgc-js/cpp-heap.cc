@@ -67,10 +67,15 @@ class UnifiedHeapMarker final : public cppgc::internal::MarkerBase {
  public:
   explicit UnifiedHeapMarker(Heap& v8_heap, cppgc::internal::HeapBase& heap);
 
-  ~UnifiedHeapMarker() final = default;
+  ~UnifiedHeapMarker() final;
 
   void AddObject(void*);
 
+  bool AdvanceMarkingWithDeadline(v8::base::TimeDelta) final;
+
+  std::unique_ptr<cppgc::Visitor> CreateConcurrentMarkingVisitor(
+      MarkingState&, int task_id) const final;
+
  protected:
   cppgc::Visitor& visitor() final { return marking_visitor_; }
   cppgc::internal::ConservativeTracingVisitor& conservative_visitor() final {
@@ -81,9 +86,12 @@ class UnifiedHeapMarker final : public cppgc::internal::MarkerBase {
   }
 
  private:
+  void MarkDeferredJSMembers();
+
   UnifiedHeapMarkingState unified_heap_mutator_marking_state_;
   UnifiedHeapMarkingVisitor marking_visitor_;
   cppgc::internal::ConservativeMarkingVisitor conservative_marking_visitor_;
+  mutable DeferredJSMemberWorklist deferred_js_members_;
 };
 
 UnifiedHeapMarker::UnifiedHeapMarker(Heap& v8_heap,
@@ -95,11 +103,44 @@ UnifiedHeapMarker::UnifiedHeapMarker(Heap& v8_heap,
       conservative_marking_visitor_(heap, mutator_marking_state_,
                                     marking_visitor_) {}
 
+UnifiedHeapMarker::~UnifiedHeapMarker() {
+  // Marking may have been aborted, e.g. on tear down.
+  deferred_js_members_.Clear();
+}
+
 void UnifiedHeapMarker::AddObject(void* object) {
   mutator_marking_state_.MarkAndPush(
       cppgc::internal::HeapObjectHeader::FromPayload(object));
 }
 
+bool UnifiedHeapMarker::AdvanceMarkingWithDeadline(
+    v8::base::TimeDelta duration) {
+  const bool is_done = MarkerBase::AdvanceMarkingWithDeadline(duration);
+  // Marking JS objects does not add C++ objects to the worklists directly, so
+  // the deferred references can be processed last. V8 reports wrappers found
+  // through them via RegisterV8References().
+  MarkDeferredJSMembers();
+  return is_done;
+}
+
+std::unique_ptr<cppgc::Visitor>
+UnifiedHeapMarker::CreateConcurrentMarkingVisitor(MarkingState& marking_state,
+                                                  int task_id) const {
+  return std::make_unique<ConcurrentUnifiedHeapMarkingVisitor>(
+      heap_, marking_state, deferred_js_members_, task_id);
+}
+
+void UnifiedHeapMarker::MarkDeferredJSMembers() {
+  DeferredJSMemberWorklist::View view(
+      &deferred_js_members_,
+      cppgc::internal::MarkingWorklists::kMutatorThreadId);
+  const JSMemberBase* ref;
+  while (view.Pop(&ref)) {
+    if (ref->IsEmpty()) continue;
+    unified_heap_mutator_marking_state_.MarkAndPush(*ref);
+  }
+}
+
 }  // namespace
 
 CppHeap::CppHeap(v8::Isolate* isolate, size_t custom_spaces)
@@ -109,6 +150,12 @@ CppHeap::CppHeap(v8::Isolate* isolate, size_t custom_spaces)
   CHECK(!FLAG_incremental_marking_wrappers);
 }
 
+CppHeap::~CppHeap() {
+  NoGCScope no_gc(*this);
+  // Finish already running GC if any, but don't finalize live objects.
+  sweeper().Finish();
+}
+
 void CppHeap::RegisterV8References(
     const std::vector<std::pair<void*, void*> >& embedder_fields) {
   DCHECK(marker_);
@@ -121,6 +168,8 @@ void CppHeap::RegisterV8References(
 }
 
 void CppHeap::TracePrologue(TraceFlags flags) {
+  // Sweeping of the previous cycle may still be running concurrently.
+  sweeper().Finish();
   marker_.reset(new UnifiedHeapMarker(*isolate_.heap(), AsBase()));
   const UnifiedHeapMarker::MarkingConfig marking_config{
       UnifiedHeapMarker::MarkingConfig::CollectionType::kMajor,
@@ -128,11 +177,19 @@ void CppHeap::TracePrologue(TraceFlags flags) {
       UnifiedHeapMarker::MarkingConfig::MarkingType::kAtomic};
   marker_->StartMarking(marking_config);
   marking_done_ = false;
+  in_atomic_pause_ = false;
 }
 
 bool CppHeap::AdvanceTracing(double deadline_in_ms) {
-  marking_done_ = marker_->AdvanceMarkingWithDeadline(
-      v8::base::TimeDelta::FromMillisecondsD(deadline_in_ms));
+  if (in_atomic_pause_ && FLAG_parallel_marking) {
+    // The atomic pause traces until the worklists are empty, which allows
+    // concurrent markers to help. JS references they find are deferred to the
+    // mutator thread.
+    marking_done_ = marker_->AdvanceMarkingInParallel();
+  } else {
+    marking_done_ = marker_->AdvanceMarkingWithDeadline(
+        v8::base::TimeDelta::FromMillisecondsD(deadline_in_ms));
+  }
   return marking_done_;
 }
 
@@ -144,11 +201,13 @@ void CppHeap::EnterFinalPause(EmbedderStackState stack_state) {
       cppgc::Heap::StackState::kNoHeapPointers,
       UnifiedHeapMarker::MarkingConfig::MarkingType::kAtomic};
   marker_->EnterAtomicPause(marking_config);
+  in_atomic_pause_ = true;
 }
 
 void CppHeap::TraceEpilogue(TraceSummary* trace_summary) {
   CHECK(marking_done_);
   marker_->LeaveAtomicPause();
+  in_atomic_pause_ = false;
   {
     // Pre finalizers are forbidden from allocating objects
     cppgc::internal::ObjectAllocator::NoAllocationScope no_allocation_scope_(
@@ -163,7 +222,8 @@ void CppHeap::TraceEpilogue(TraceSummary* trace_summary) {
 #endif
   {
     NoGCScope no_gc(*this);
-    sweeper().Start(cppgc::internal::Sweeper::Config::kAtomic);
+    sweeper().Start(
+        cppgc::internal::Sweeper::Config::kIncrementalAndConcurrent);
   }
 }
 
@@ -20,6 +20,7 @@ class V8_EXPORT_PRIVATE CppHeap final : public cppgc::internal::HeapBase,
                                         public v8::EmbedderHeapTracer {
  public:
   CppHeap(v8::Isolate* isolate, size_t custom_spaces);
+  ~CppHeap() final;
 
   HeapBase& AsBase() { return *this; }
   const HeapBase& AsBase() const { return *this; }
@@ -35,6 +36,7 @@ class V8_EXPORT_PRIVATE CppHeap final : public cppgc::internal::HeapBase,
  private:
   Isolate& isolate_;
   bool marking_done_ = false;
+  bool in_atomic_pause_ = false;
 };
 
 }  // namespace internal
@@ -12,47 +12,68 @@
 namespace v8 {
 namespace internal {
 
-UnifiedHeapMarkingVisitor::UnifiedHeapMarkingVisitor(
-    HeapBase& heap, MarkingState& marking_state,
-    UnifiedHeapMarkingState& unified_heap_marking_state)
+UnifiedHeapMarkingVisitorBase::UnifiedHeapMarkingVisitorBase(
+    HeapBase& heap, MarkingState& marking_state)
     : JSVisitor(cppgc::internal::VisitorFactory::CreateKey()),
-      marking_state_(marking_state),
-      unified_heap_marking_state_(unified_heap_marking_state) {}
+      marking_state_(marking_state) {}
 
-void UnifiedHeapMarkingVisitor::Visit(const void* object,
-                                      TraceDescriptor desc) {
+void UnifiedHeapMarkingVisitorBase::Visit(const void* object,
+                                          TraceDescriptor desc) {
   marking_state_.MarkAndPush(object, desc);
 }
 
-void UnifiedHeapMarkingVisitor::VisitWeak(const void* object,
-                                          TraceDescriptor desc,
-                                          WeakCallback weak_callback,
-                                          const void* weak_member) {
+void UnifiedHeapMarkingVisitorBase::VisitWeak(const void* object,
+                                              TraceDescriptor desc,
+                                              WeakCallback weak_callback,
+                                              const void* weak_member) {
   marking_state_.RegisterWeakReferenceIfNeeded(object, desc, weak_callback,
                                                weak_member);
 }
 
-void UnifiedHeapMarkingVisitor::VisitRoot(const void* object,
-                                          TraceDescriptor desc) {
+void UnifiedHeapMarkingVisitorBase::VisitRoot(const void* object,
+                                              TraceDescriptor desc) {
   Visit(object, desc);
 }
 
-void UnifiedHeapMarkingVisitor::VisitWeakRoot(const void* object,
-                                              TraceDescriptor desc,
-                                              WeakCallback weak_callback,
-                                              const void* weak_root) {
+void UnifiedHeapMarkingVisitorBase::VisitWeakRoot(const void* object,
+                                                  TraceDescriptor desc,
+                                                  WeakCallback weak_callback,
+                                                  const void* weak_root) {
   marking_state_.InvokeWeakRootsCallbackIfNeeded(object, desc, weak_callback,
                                                  weak_root);
 }
 
-void UnifiedHeapMarkingVisitor::RegisterWeakCallback(WeakCallback callback,
-                                                     const void* object) {
+void UnifiedHeapMarkingVisitorBase::RegisterWeakCallback(
+    WeakCallback callback, const void* object) {
   marking_state_.RegisterWeakCallback(callback, object);
 }
 
+UnifiedHeapMarkingVisitor::UnifiedHeapMarkingVisitor(
+    HeapBase& heap, MarkingState& marking_state,
+    UnifiedHeapMarkingState& unified_heap_marking_state)
+    : UnifiedHeapMarkingVisitorBase(heap, marking_state),
+      unified_heap_marking_state_(unified_heap_marking_state) {}
+
 void UnifiedHeapMarkingVisitor::Visit(const internal::JSMemberBase& ref) {
   unified_heap_marking_state_.MarkAndPush(ref);
 }
 
+ConcurrentUnifiedHeapMarkingVisitor::ConcurrentUnifiedHeapMarkingVisitor(
+    HeapBase& heap, MarkingState& marking_state,
+    DeferredJSMemberWorklist& deferred_js_members, int task_id)
+    : UnifiedHeapMarkingVisitorBase(heap, marking_state),
+      deferred_js_members_(&deferred_js_members, task_id) {}
+
+ConcurrentUnifiedHeapMarkingVisitor::~ConcurrentUnifiedHeapMarkingVisitor() {
+  deferred_js_members_.FlushToGlobal();
+}
+
+void ConcurrentUnifiedHeapMarkingVisitor::Visit(
+    const internal::JSMemberBase& ref) {
+  // The member lives in a marked object and is thus still valid when the
+  // mutator thread processes it.
+  deferred_js_members_.Push(&ref);
+}
+
 }  // namespace internal
 }  // namespace v8
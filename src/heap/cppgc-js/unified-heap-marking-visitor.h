@@ -10,6 +10,8 @@
 #include "src/base/macros.h"
 #include "src/heap/cppgc-js/unified-heap-marking-state.h"
 #include "src/heap/cppgc/marking-visitor.h"
+#include "src/heap/cppgc/marking-worklists.h"
+#include "src/heap/cppgc/worklist.h"
 
 namespace cppgc {
 namespace internal {
@@ -25,10 +27,16 @@ using cppgc::WeakCallback;
 using cppgc::internal::HeapBase;
 using cppgc::internal::MarkingState;
 
-class V8_EXPORT_PRIVATE UnifiedHeapMarkingVisitor : public JSVisitor {
+// References to JS objects that were found by concurrent markers. They are
+// marked by the mutator thread, which owns V8's marking worklists.
+using DeferredJSMemberWorklist =
+    cppgc::internal::Worklist<const JSMemberBase*, 64 /* local entries */,
+                              cppgc::internal::MarkingWorklists::kNumMarkers>;
+
+class V8_EXPORT_PRIVATE UnifiedHeapMarkingVisitorBase : public JSVisitor {
  public:
-  UnifiedHeapMarkingVisitor(HeapBase&, MarkingState&, UnifiedHeapMarkingState&);
-  ~UnifiedHeapMarkingVisitor() override = default;
+  UnifiedHeapMarkingVisitorBase(HeapBase&, MarkingState&);
+  ~UnifiedHeapMarkingVisitorBase() override = default;
 
  private:
   // C++ handling.
@@ -39,13 +47,39 @@ class V8_EXPORT_PRIVATE UnifiedHeapMarkingVisitor : public JSVisitor {
                      const void*) final;
   void RegisterWeakCallback(WeakCallback, const void*) final;
 
+  MarkingState& marking_state_;
+};
+
+class V8_EXPORT_PRIVATE UnifiedHeapMarkingVisitor final
+    : public UnifiedHeapMarkingVisitorBase {
+ public:
+  UnifiedHeapMarkingVisitor(HeapBase&, MarkingState&, UnifiedHeapMarkingState&);
+  ~UnifiedHeapMarkingVisitor() final = default;
+
+ private:
   // JS handling.
   void Visit(const internal::JSMemberBase& ref) final;
 
-  MarkingState& marking_state_;
   UnifiedHeapMarkingState& unified_heap_marking_state_;
 };
 
+// Visitor for concurrent markers. JS references are pushed to a
+// DeferredJSMemberWorklist instead of being marked right away.
+class V8_EXPORT_PRIVATE ConcurrentUnifiedHeapMarkingVisitor final
+    : public UnifiedHeapMarkingVisitorBase {
+ public:
+  ConcurrentUnifiedHeapMarkingVisitor(HeapBase&, MarkingState&,
+                                      DeferredJSMemberWorklist&, int task_id);
+  // Publishes the deferred references to the mutator thread.
+  ~ConcurrentUnifiedHeapMarkingVisitor() final;
+
+ private:
+  // JS handling.
+  void Visit(const internal::JSMemberBase& ref) final;
+
+  DeferredJSMemberWorklist::View deferred_js_members_;
+};
+
 }  // namespace internal
 }  // namespace v8
 
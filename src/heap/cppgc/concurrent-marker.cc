@@ -0,0 +1,171 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/cppgc/concurrent-marker.h"
+
+#include <algorithm>
+
+#include "include/cppgc/platform.h"
+#include "src/base/bits.h"
+#include "src/heap/cppgc/heap-object-header.h"
+#include "src/heap/cppgc/marker.h"
+#include "src/heap/cppgc/marking-state.h"
+
+namespace cppgc {
+namespace internal {
+
+namespace {
+
+static constexpr size_t kMarkingItemsBetweenYieldChecks = 512;
+
+bool HasWorkForConcurrentMarking(MarkingWorklists& marking_worklists) {
+  return !marking_worklists.marking_worklist()->IsGlobalPoolEmpty();
+}
+
+}  // namespace
+
+class ConcurrentMarker::ConcurrentMarkingTask final : public v8::JobTask {
+ public:
+  explicit ConcurrentMarkingTask(ConcurrentMarker& concurrent_marker)
+      : concurrent_marker_(concurrent_marker) {}
+
+  void Run(JobDelegate* delegate) final {
+    const int task_id = AcquireTaskId();
+    // All worklist views are taken by other markers.
+    if (task_id == kNoTaskId) return;
+    ProcessWorklists(delegate, task_id);
+    ReleaseTaskId(task_id);
+  }
+
+  size_t GetMaxConcurrency() const final {
+    const size_t active_markers =
+        v8::base::bits::CountPopulation(used_task_ids_.load(
+            std::memory_order_relaxed));
+    const size_t pending_segments = concurrent_marker_.marking_worklists_
+                                        .marking_worklist()
+                                        ->GlobalPoolSize();
+    return std::min<size_t>(MarkingWorklists::kNumConcurrentMarkers,
+                            active_markers + pending_segments);
+  }
+
+ private:
+  static constexpr int kNoTaskId = -1;
+
+  // Concurrent markers use the worklist views
+  // [kMutatorThreadId + 1, kMutatorThreadId + kNumConcurrentMarkers].
+  int AcquireTaskId() {
+    uint32_t used = used_task_ids_.load(std::memory_order_relaxed);
+    while (true) {
+      const uint32_t free = ~used & kAllTaskIdsMask;
+      if (!free) return kNoTaskId;
+      const int bit = v8::base::bits::CountTrailingZeros(free);
+      if (used_task_ids_.compare_exchange_weak(used, used | (1u << bit),
+                                               std::memory_order_relaxed)) {
+        return MarkingWorklists::kMutatorThreadId + 1 + bit;
+      }
+    }
+  }
+
+  void ReleaseTaskId(int task_id) {
+    const int bit = task_id - MarkingWorklists::kMutatorThreadId - 1;
+    used_task_ids_.fetch_and(~(1u << bit), std::memory_order_relaxed);
+  }
+
+  void ProcessWorklists(JobDelegate* delegate, int task_id) {
+    MarkingWorklists& marking_worklists =
+        concurrent_marker_.marking_worklists_;
+    MarkingState marking_state(
+        concurrent_marker_.heap_, marking_worklists.marking_worklist(),
+        marking_worklists.not_fully_constructed_worklist(),
+        marking_worklists.weak_callback_worklist(), task_id);
+    std::unique_ptr<cppgc::Visitor> marking_visitor =
+        concurrent_marker_.marker_.CreateConcurrentMarkingVisitor(marking_state,
+                                                                  task_id);
+
+    MarkingWorklists::MarkingWorklist::View marking_worklist(
+        marking_worklists.marking_worklist(), task_id);
+    MarkingWorklists::MarkingItem item;
+    size_t processed_items = 0;
+    while (marking_worklist.Pop(&item)) {
+      const HeapObjectHeader& header =
+          HeapObjectHeader::FromPayload(item.base_object_payload);
+      DCHECK(!header.IsInConstruction<HeapObjectHeader::AccessMode::kAtomic>());
+      item.callback(marking_visitor.get(), item.base_object_payload);
+      marking_state.AccountMarkedBytes(header);
+      if (++processed_items == kMarkingItemsBetweenYieldChecks) {
+        if (delegate->ShouldYield()) break;
+        processed_items = 0;
+      }
+    }
+
+    // Publish everything that was found so that the mutator thread (or other
+    // concurrent markers) can pick it up.
+    marking_worklists.marking_worklist()->FlushToGlobal(task_id);
+    marking_worklists.not_fully_constructed_worklist()->FlushToGlobal(task_id);
+    marking_worklists.weak_callback_worklist()->FlushToGlobal(task_id);
+    concurrent_marker_.concurrently_marked_bytes_.fetch_add(
+        marking_state.marked_bytes(), std::memory_order_relaxed);
+  }
+
+  static constexpr uint32_t kAllTaskIdsMask =
+      (1u << MarkingWorklists::kNumConcurrentMarkers) - 1;
+
+  ConcurrentMarker& concurrent_marker_;
+  std::atomic<uint32_t> used_task_ids_{0};
+};
+
+ConcurrentMarker::ConcurrentMarker(MarkerBase& marker, HeapBase& heap,
+                                   MarkingWorklists& marking_worklists,
+                                   cppgc::Platform* platform)
+    : marker_(marker),
+      heap_(heap),
+      marking_worklists_(marking_worklists),
+      platform_(platform) {}
+
+ConcurrentMarker::~ConcurrentMarker() {
+  // Concurrent markers reference the worklists and the heap, so they must be
+  // stopped before either goes away.
+  Cancel();
+}
+
+bool ConcurrentMarker::Start() {
+  DCHECK(!IsActive());
+  if (!platform_) return false;
+  concurrent_marking_handle_ =
+      platform_->PostJob(v8::TaskPriority::kUserVisible,
+                         std::make_unique<ConcurrentMarkingTask>(*this));
+  return IsActive();
+}
+
+bool ConcurrentMarker::Cancel() {
+  if (!IsActive()) return false;
+  concurrent_marking_handle_->Cancel();
+  concurrent_marking_handle_.reset();
+  return true;
+}
+
+bool ConcurrentMarker::Join() {
+  if (!IsActive()) return false;
+  concurrent_marking_handle_->Join();
+  concurrent_marking_handle_.reset();
+  return true;
+}
+
+bool ConcurrentMarker::IsActive() const {
+  return concurrent_marking_handle_ != nullptr;
+}
+
+void ConcurrentMarker::NotifyIncrementalMutatorStepCompleted() {
+  if (!IsActive()) return;
+  marking_worklists_.marking_worklist()->FlushToGlobal(
+      MarkingWorklists::kMutatorThreadId);
+  if (HasWorkForConcurrentMarking(marking_worklists_)) {
+    // Notifies the scheduler that max concurrency might have increased. This
+    // will adjust the number of markers if necessary.
+    concurrent_marking_handle_->NotifyConcurrencyIncrease();
+  }
+}
+
+}  // namespace internal
+}  // namespace cppgc
@@ -0,0 +1,76 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CPPGC_CONCURRENT_MARKER_H_
+#define V8_HEAP_CPPGC_CONCURRENT_MARKER_H_
+
+#include <atomic>
+#include <memory>
+
+#include "include/cppgc/platform.h"
+#include "src/base/macros.h"
+#include "src/heap/cppgc/marking-worklists.h"
+
+namespace cppgc {
+namespace internal {
+
+class HeapBase;
+class MarkerBase;
+
+// Drains the marking worklist on background threads using the job API of
+// cppgc::Platform. Concurrent markers only ever process
+// MarkingWorklists::marking_worklist(). The write barrier worklist and the
+// previously-not-fully-constructed worklist are processed on the mutator
+// thread by MarkerBase. Items that are found by concurrent markers and cannot
+// be processed concurrently (e.g. objects in construction) are published to
+// the global pools of the respective worklists. The visitors of concurrent
+// markers are provided by MarkerBase::CreateConcurrentMarkingVisitor().
+class V8_EXPORT_PRIVATE ConcurrentMarker final {
+ public:
+  ConcurrentMarker(MarkerBase&, HeapBase&, MarkingWorklists&,
+                   cppgc::Platform*);
+  ~ConcurrentMarker();
+
+  ConcurrentMarker(const ConcurrentMarker&) = delete;
+  ConcurrentMarker& operator=(const ConcurrentMarker&) = delete;
+
+  // Posts the concurrent marking job. Returns false if the platform does not
+  // support background jobs, in which case all marking happens on the mutator
+  // thread.
+  bool Start();
+  // Preempts all concurrent markers and waits for them to publish their local
+  // work. Returns false if concurrent marking was not running.
+  bool Cancel();
+  // Contributes to the concurrent marking job on the calling thread and waits
+  // until all markers ran out of work. Only valid while the mutator does not
+  // modify the heap, e.g. in the atomic pause. Returns false if concurrent
+  // marking was not running.
+  bool Join();
+
+  // Publishes the local marking work of the mutator thread and notifies the
+  // job that more concurrency may be available.
+  void NotifyIncrementalMutatorStepCompleted();
+
+  bool IsActive() const;
+
+  // Bytes marked by all concurrent markers so far.
+  size_t concurrently_marked_bytes() const {
+    return concurrently_marked_bytes_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  class ConcurrentMarkingTask;
+
+  MarkerBase& marker_;
+  HeapBase& heap_;
+  MarkingWorklists& marking_worklists_;
+  cppgc::Platform* const platform_;
+  std::unique_ptr<JobHandle> concurrent_marking_handle_;
+  std::atomic<size_t> concurrently_marked_bytes_{0};
+};
+
+}  // namespace internal
+}  // namespace cppgc
+
+#endif  // V8_HEAP_CPPGC_CONCURRENT_MARKER_H_
@@ -20,6 +20,11 @@ uint32_t BucketIndexForSize(uint32_t size) {
   return v8::base::bits::WhichPowerOfTwo(
       v8::base::bits::RoundDownToPowerOfTwo32(size));
 }
+
+size_t BiggestBucketIndex(uint32_t non_empty_buckets) {
+  DCHECK_NE(0u, non_empty_buckets);
+  return 31 - v8::base::bits::CountLeadingZeros32(non_empty_buckets);
+}
 }  // namespace
 
 class FreeList::Entry : public HeapObjectHeader {
@@ -49,7 +54,7 @@ FreeList::FreeList() { Clear(); }
 FreeList::FreeList(FreeList&& other) V8_NOEXCEPT
     : free_list_heads_(std::move(other.free_list_heads_)),
       free_list_tails_(std::move(other.free_list_tails_)),
-      biggest_free_list_index_(std::move(other.biggest_free_list_index_)) {
+      non_empty_buckets_(other.non_empty_buckets_) {
   other.Clear();
 }
 
@@ -82,7 +87,7 @@ void FreeList::Add(FreeList::Block block) {
   Entry* entry = new (block.address) Entry(size);
   const size_t index = BucketIndexForSize(static_cast<uint32_t>(size));
   entry->Link(&free_list_heads_[index]);
-  biggest_free_list_index_ = std::max(biggest_free_list_index_, index);
+  MarkBucketNonEmpty(index);
   if (!entry->Next()) {
     free_list_tails_[index] = entry;
   }
@@ -107,9 +112,8 @@ void FreeList::Append(FreeList&& other) {
     }
   }
 
-  biggest_free_list_index_ =
-      std::max(biggest_free_list_index_, other.biggest_free_list_index_);
-  other.biggest_free_list_index_ = 0;
+  non_empty_buckets_ |= other.non_empty_buckets_;
+  other.non_empty_buckets_ = 0;
 #if DEBUG
   DCHECK_EQ(expected_size, Size());
 #endif
@@ -122,36 +126,32 @@ FreeList::Block FreeList::Allocate(size_t allocation_size) {
   // off as a large a free block as possible in one go; a block that will
   // service this block and let following allocations be serviced quickly
   // by bump allocation.
-  // bucket_size represents minimal size of entries in a bucket.
-  size_t bucket_size = static_cast<size_t>(1) << biggest_free_list_index_;
-  size_t index = biggest_free_list_index_;
-  for (; index > 0; --index, bucket_size >>= 1) {
-    DCHECK(IsConsistent(index));
-    Entry* entry = free_list_heads_[index];
-    if (allocation_size > bucket_size) {
-      // Final bucket candidate; check initial entry if it is able
-      // to service this allocation. Do not perform a linear scan,
-      // as it is considered too costly.
-      if (!entry || entry->GetSize() < allocation_size) break;
-    }
-    if (entry) {
-      if (!entry->Next()) {
-        DCHECK_EQ(entry, free_list_tails_[index]);
-        free_list_tails_[index] = nullptr;
-      }
-      entry->Unlink(&free_list_heads_[index]);
-      biggest_free_list_index_ = index;
-      return {entry, entry->GetSize()};
-    }
+  if (!non_empty_buckets_) return {nullptr, 0u};
+  const size_t index = BiggestBucketIndex(non_empty_buckets_);
+  DCHECK(IsConsistent(index));
+  Entry* entry = free_list_heads_[index];
+  DCHECK_NOT_NULL(entry);
+  // bucket_size represents minimal size of entries in a bucket. If the
+  // biggest bucket cannot guarantee a fit, check only its initial entry. Do
+  // not perform a linear scan, as it is considered too costly. Smaller
+  // buckets cannot service the allocation at all.
+  const size_t bucket_size = static_cast<size_t>(1) << index;
+  if (allocation_size > bucket_size && entry->GetSize() < allocation_size) {
+    return {nullptr, 0u};
+  }
+  if (!entry->Next()) {
+    DCHECK_EQ(entry, free_list_tails_[index]);
+    free_list_tails_[index] = nullptr;
   }
-  biggest_free_list_index_ = index;
-  return {nullptr, 0u};
+  entry->Unlink(&free_list_heads_[index]);
+  if (!free_list_heads_[index]) MarkBucketEmpty(index);
+  return {entry, entry->GetSize()};
 }
 
 void FreeList::Clear() {
   std::fill(free_list_heads_.begin(), free_list_heads_.end(), nullptr);
   std::fill(free_list_tails_.begin(), free_list_tails_.end(), nullptr);
-  biggest_free_list_index_ = 0;
+  non_empty_buckets_ = 0;
 }
 
 size_t FreeList::Size() const {
@@ -165,10 +165,7 @@ size_t FreeList::Size() const {
   return size;
 }
 
-bool FreeList::IsEmpty() const {
-  return std::all_of(free_list_heads_.cbegin(), free_list_heads_.cend(),
-                     [](const auto* entry) { return !entry; });
-}
+bool FreeList::IsEmpty() const { return non_empty_buckets_ == 0; }
 
 bool FreeList::Contains(Block block) const {
   for (Entry* list : free_list_heads_) {
@@ -182,13 +179,24 @@ bool FreeList::Contains(Block block) const {
   return false;
 }
 
+void FreeList::MarkBucketNonEmpty(size_t index) {
+  non_empty_buckets_ |= uint32_t{1} << index;
+}
+
+void FreeList::MarkBucketEmpty(size_t index) {
+  non_empty_buckets_ &= ~(uint32_t{1} << index);
+}
+
 bool FreeList::IsConsistent(size_t index) const {
   // Check that freelist head and tail pointers are consistent, i.e.
   // - either both are nulls (no entries in the bucket);
   // - or both are non-nulls and the tail points to the end.
-  return (!free_list_heads_[index] && !free_list_tails_[index]) ||
+  // Additionally, the bucket's bit in |non_empty_buckets_| must be in sync.
+  const bool is_marked_non_empty = non_empty_buckets_ & (uint32_t{1} << index);
+  return (!free_list_heads_[index] && !free_list_tails_[index] &&
+          !is_marked_non_empty) ||
          (free_list_heads_[index] && free_list_tails_[index] &&
-          !free_list_tails_[index]->Next());
+          !free_list_tails_[index]->Next() && is_marked_non_empty);
 }
 
 }  // namespace internal
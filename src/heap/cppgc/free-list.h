@@ -6,6 +6,7 @@
 #define V8_HEAP_CPPGC_FREE_LIST_H_
 
 #include <array>
+#include <climits>
 
 #include "src/base/macros.h"
 #include "src/heap/cppgc/globals.h"
@@ -50,10 +51,17 @@ class V8_EXPORT_PRIVATE FreeList {
 
   bool IsConsistent(size_t) const;
 
+  inline void MarkBucketNonEmpty(size_t);
+  inline void MarkBucketEmpty(size_t);
+
   // All |Entry|s in the nth list have size >= 2^n.
   std::array<Entry*, kPageSizeLog2> free_list_heads_;
   std::array<Entry*, kPageSizeLog2> free_list_tails_;
-  size_t biggest_free_list_index_ = 0;
+  // Bit n is set iff the nth list is non-empty. Allows finding the biggest
+  // non-empty bucket in constant time on refill.
+  uint32_t non_empty_buckets_ = 0;
+  static_assert(kPageSizeLog2 <= sizeof(uint32_t) * CHAR_BIT,
+                "Every bucket needs a bit in |non_empty_buckets_|");
 };
 
 }  // namespace internal
@@ -29,28 +29,36 @@ class GCInvoker::GCInvokerImpl final : public GarbageCollector {
    public:
     using Handle = SingleThreadedHandle;
 
-    static Handle Post(GarbageCollector* collector, cppgc::TaskRunner* runner) {
-      auto task = std::make_unique<GCInvoker::GCInvokerImpl::GCTask>(collector);
+    static Handle Post(GarbageCollector* collector, cppgc::TaskRunner* runner,
+                       GarbageCollector::Config::CollectionType type) {
+      auto task =
+          std::make_unique<GCInvoker::GCInvokerImpl::GCTask>(collector, type);
       auto handle = task->GetHandle();
       runner->PostNonNestableTask(std::move(task));
       return handle;
     }
 
-    explicit GCTask(GarbageCollector* collector)
-        : collector_(collector), saved_epoch_(collector->epoch()) {}
+    GCTask(GarbageCollector* collector,
+           GarbageCollector::Config::CollectionType type)
+        : collector_(collector),
+          collection_type_(type),
+          saved_epoch_(collector->epoch()) {}
 
    private:
     void Run() final {
       if (handle_.IsCanceled() || (collector_->epoch() != saved_epoch_)) return;
 
       collector_->CollectGarbage(
-          GarbageCollector::Config::PreciseAtomicConfig());
+          collection_type_ == GarbageCollector::Config::CollectionType::kMinor
+              ? GarbageCollector::Config::MinorPreciseAtomicConfig()
+              : GarbageCollector::Config::PreciseAtomicConfig());
       handle_.Cancel();
     }
 
     Handle GetHandle() { return handle_; }
 
     GarbageCollector* collector_;
+    GarbageCollector::Config::CollectionType collection_type_;
     Handle handle_;
     size_t saved_epoch_;
   };
@@ -75,15 +83,22 @@ GCInvoker::GCInvokerImpl::~GCInvokerImpl() {
 }
 
 void GCInvoker::GCInvokerImpl::CollectGarbage(GarbageCollector::Config config) {
+  // Minor GCs do not support conservative stack scanning and are always
+  // deferred to a non-nestable task if the stack may contain heap pointers.
+  const bool stack_is_supported =
+      (config.collection_type ==
+       GarbageCollector::Config::CollectionType::kMajor) &&
+      (stack_support_ ==
+       cppgc::Heap::StackSupport::kSupportsConservativeStackScan);
   if ((config.stack_state ==
        GarbageCollector::Config::StackState::kNoHeapPointers) ||
-      (stack_support_ ==
-       cppgc::Heap::StackSupport::kSupportsConservativeStackScan)) {
+      stack_is_supported) {
     collector_->CollectGarbage(config);
   } else if (platform_->GetForegroundTaskRunner()->NonNestableTasksEnabled()) {
     if (!gc_task_handle_) {
       gc_task_handle_ =
-          GCTask::Post(collector_, platform_->GetForegroundTaskRunner().get());
+          GCTask::Post(collector_, platform_->GetForegroundTaskRunner().get(),
+                       config.collection_type);
     }
   }
 }
@@ -32,15 +32,18 @@ class HeapGrowing::HeapGrowingImpl final
   void ResetAllocatedObjectSize(size_t) final;
 
   size_t limit() const { return limit_; }
+  size_t minor_limit() const { return minor_limit_; }
 
  private:
   void ConfigureLimit(size_t allocated_object_size);
+  void ConfigureMinorLimit(size_t allocated_object_size);
 
   GarbageCollector* collector_;
   StatsCollector* stats_collector_;
   // Allow 1 MB heap by default;
   size_t initial_heap_size_ = 1 * kMB;
-  size_t limit_ = 0;  // See ConfigureLimit().
+  size_t limit_ = 0;        // See ConfigureLimit().
+  size_t minor_limit_ = 0;  // See ConfigureLimit().
 
   SingleThreadedHandle gc_task_handle_;
 };
@@ -64,14 +67,30 @@ HeapGrowing::HeapGrowingImpl::~HeapGrowingImpl() {
 }
 
 void HeapGrowing::HeapGrowingImpl::AllocatedObjectSizeIncreased(size_t) {
-  if (stats_collector_->allocated_object_size() > limit_) {
+  const size_t allocated_object_size =
+      stats_collector_->allocated_object_size();
+  if (allocated_object_size > limit_) {
     collector_->CollectGarbage(
         GarbageCollector::Config::ConservativeAtomicConfig());
+    return;
   }
+#if defined(CPPGC_YOUNG_GENERATION)
+  if (allocated_object_size > minor_limit_) {
+    collector_->CollectGarbage(
+        GarbageCollector::Config::MinorConservativeAtomicConfig());
+  }
+#endif
 }
 
 void HeapGrowing::HeapGrowingImpl::ResetAllocatedObjectSize(
     size_t allocated_object_size) {
+  if (stats_collector_->collection_type() ==
+      StatsCollector::CollectionType::kMinor) {
+    // Minor GCs only keep the major GC limit. Otherwise promoted objects would
+    // keep pushing it ahead and a major GC would never be triggered.
+    ConfigureMinorLimit(allocated_object_size);
+    return;
+  }
   ConfigureLimit(allocated_object_size);
 }
 
@@ -80,6 +99,18 @@ void HeapGrowing::HeapGrowingImpl::ConfigureLimit(
   const size_t size = std::max(allocated_object_size, initial_heap_size_);
   limit_ = std::max(static_cast<size_t>(size * kGrowingFactor),
                     size + kMinLimitIncrease);
+  ConfigureMinorLimit(allocated_object_size);
+}
+
+void HeapGrowing::HeapGrowingImpl::ConfigureMinorLimit(
+    size_t allocated_object_size) {
+  // Young objects are collected by minor GCs once half of the remaining budget
+  // up to the next major GC has been allocated.
+  const size_t remaining_budget =
+      limit_ > allocated_object_size ? limit_ - allocated_object_size : 0;
+  minor_limit_ = allocated_object_size +
+                 std::max(remaining_budget / 2,
+                          static_cast<size_t>(kMinLimitIncrease));
 }
 
 HeapGrowing::HeapGrowing(GarbageCollector* collector,
@@ -92,6 +123,8 @@ HeapGrowing::~HeapGrowing() = default;
 
 size_t HeapGrowing::limit() const { return impl_->limit(); }
 
+size_t HeapGrowing::minor_limit() const { return impl_->minor_limit(); }
+
 // static
 constexpr double HeapGrowing::kGrowingFactor;
 
@@ -23,7 +23,8 @@ class StatsCollector;
 // on allocation statistics provided by StatsCollector and ResourceConstraints.
 //
 // Implements a fixed-ratio growing strategy with an initial heap size that the
-// GC can ignore to avoid excessive GCs for smaller heaps.
+// GC can ignore to avoid excessive GCs for smaller heaps. With young generation
+// enabled, minor GCs are triggered halfway towards the major GC limit.
 class V8_EXPORT_PRIVATE HeapGrowing final {
  public:
   // Constant growing factor for growing the heap limit.
@@ -41,6 +42,8 @@ class V8_EXPORT_PRIVATE HeapGrowing final {
   HeapGrowing& operator=(const HeapGrowing&) = delete;
 
   size_t limit() const;
+  // Limit for triggering minor GCs. Only used with CPPGC_YOUNG_GENERATION.
+  size_t minor_limit() const;
 
  private:
   class HeapGrowingImpl;
@@ -235,7 +235,7 @@ bool HeapObjectHeader::IsYoung() const {
 
 template <HeapObjectHeader::AccessMode mode>
 bool HeapObjectHeader::IsFree() const {
-  return GetGCInfoIndex() == kFreeListGCInfoIndex;
+  return GetGCInfoIndex<mode>() == kFreeListGCInfoIndex;
 }
 
 bool HeapObjectHeader::IsFinalizable() const {
@@ -92,6 +92,20 @@ void Heap::CollectGarbage(Config config) {
 
   if (in_no_gc_scope()) return;
 
+  if (!marker_) StartIncrementalGarbageCollection(config);
+  FinalizeIncrementalGarbageCollectionIfRunning(config);
+}
+
+void Heap::StartIncrementalGarbageCollection(Config config) {
+  CheckConfig(config);
+  DCHECK(!marker_);
+
+  if (in_no_gc_scope()) return;
+
+  // Sweeping of the previous cycle may still be running concurrently.
+  sweeper_.Finish();
+
+  config_ = config;
   epoch_++;
 
 #if defined(CPPGC_YOUNG_GENERATION)
@@ -104,6 +118,22 @@ void Heap::CollectGarbage(Config config) {
   const Marker::MarkingConfig marking_config{
       config.collection_type, config.stack_state, config.marking_type};
   marker_->StartMarking(marking_config);
+}
+
+void Heap::FinalizeIncrementalGarbageCollectionIfRunning(Config config) {
+  if (!marker_) return;
+  // The collection and marking types are fixed at the start of a GC. Only the
+  // stack state may change for the atomic pause.
+  DCHECK_EQ(config_.collection_type, config.collection_type);
+  config_.stack_state = config.stack_state;
+  config_.sweeping_type = config.sweeping_type;
+  FinalizeGarbageCollection(config.stack_state);
+}
+
+void Heap::FinalizeGarbageCollection(Config::StackState stack_state) {
+  DCHECK(marker_);
+  const Marker::MarkingConfig marking_config{
+      config_.collection_type, stack_state, config_.marking_type};
   marker_->FinishMarking(marking_config);
   // "Sweeping and finalization".
   {
@@ -115,11 +145,11 @@ void Heap::CollectGarbage(Config config) {
   marker_.reset();
   // TODO(chromium:1056170): replace build flag with dedicated flag.
 #if DEBUG
-  VerifyMarking(config.stack_state);
+  VerifyMarking(stack_state);
 #endif
   {
     NoGCScope no_gc(*this);
-    sweeper_.Start(config.sweeping_type);
+    sweeper_.Start(config_.sweeping_type);
   }
 }
 
@@ -34,12 +34,22 @@ class V8_EXPORT_PRIVATE Heap final : public HeapBase,
 
   void CollectGarbage(Config config) final;
 
+  // Starts an incremental (and, depending on |config|, concurrent) garbage
+  // collection. Marking makes progress on background threads and through
+  // marker()->AdvanceMarkingWithDeadline() until the collection is finalized
+  // by FinalizeIncrementalGarbageCollectionIfRunning() or CollectGarbage().
+  void StartIncrementalGarbageCollection(Config config);
+  void FinalizeIncrementalGarbageCollectionIfRunning(Config config);
+
   size_t epoch() const final { return epoch_; }
 
  private:
   GCInvoker gc_invoker_;
   HeapGrowing growing_;
 
+  void FinalizeGarbageCollection(Config::StackState);
+
+  Config config_;
   size_t epoch_ = 0;
 };
 
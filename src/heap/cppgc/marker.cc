@@ -6,6 +6,7 @@
 
 #include <memory>
 
+#include "include/cppgc/internal/pointer-policies.h"
 #include "include/cppgc/internal/process-heap.h"
 #include "src/heap/cppgc/heap-object-header.h"
 #include "src/heap/cppgc/heap-page.h"
@@ -60,10 +61,13 @@ void VisitRememberedSlots(HeapBase& heap, MarkingState& marking_state) {
     // top level (with the guarantee that no objects are currently being in
     // construction). This can be ensured by running young GCs from safe points
     // or by reintroducing nested allocation scopes that avoid finalization.
-    DCHECK(
-        !header.IsInConstruction<HeapObjectHeader::AccessMode::kNonAtomic>());
+    DCHECK(!slot_header
+                .IsInConstruction<HeapObjectHeader::AccessMode::kNonAtomic>());
 
     void* value = *reinterpret_cast<void**>(slot);
+    // The slot may have been overwritten with nullptr or a sentinel after the
+    // generational barrier recorded it.
+    if (!value || value == kSentinelPointer) continue;
     marking_state.DynamicallyMarkAddress(static_cast<Address>(value));
   }
 #endif
@@ -106,9 +110,11 @@ MarkerBase::MarkerBase(HeapBase& heap)
           heap, marking_worklists_.marking_worklist(),
           marking_worklists_.not_fully_constructed_worklist(),
           marking_worklists_.weak_callback_worklist(),
-          MarkingWorklists::kMutatorThreadId) {}
+          MarkingWorklists::kMutatorThreadId),
+      concurrent_marker_(*this, heap, marking_worklists_, heap.platform()) {}
 
 MarkerBase::~MarkerBase() {
+  concurrent_marker_.Cancel();
   // The fixed point iteration may have found not-fully-constructed objects.
   // Such objects should have already been found through the stack scan though
   // and should thus already be marked.
@@ -132,14 +138,28 @@ MarkerBase::~MarkerBase() {
 }
 
 void MarkerBase::StartMarking(MarkingConfig config) {
-  heap().stats_collector()->NotifyMarkingStarted();
+  heap().stats_collector()->NotifyMarkingStarted(
+      config.collection_type == MarkingConfig::CollectionType::kMinor
+          ? StatsCollector::CollectionType::kMinor
+          : StatsCollector::CollectionType::kMajor);
 
   config_ = config;
   VisitRoots();
   EnterIncrementalMarkingIfNeeded(config, heap());
+  if (config.marking_type ==
+      MarkingConfig::MarkingType::kIncrementalAndConcurrent) {
+    // Roots are pushed to the mutator's local worklist view. Publish them so
+    // that concurrent markers have something to start with.
+    marking_worklists_.marking_worklist()->FlushToGlobal(
+        MarkingWorklists::kMutatorThreadId);
+    concurrent_marker_.Start();
+  }
 }
 
 void MarkerBase::EnterAtomicPause(MarkingConfig config) {
+  // Concurrent markers publish all their local work when being cancelled, so
+  // the mutator thread can finish marking on its own afterwards.
+  concurrent_marker_.Cancel();
   ExitIncrementalMarkingIfNeeded(config_, heap());
   config_ = config;
 
@@ -155,7 +175,8 @@ void MarkerBase::EnterAtomicPause(MarkingConfig config) {
 void MarkerBase::LeaveAtomicPause() {
   ResetRememberedSet(heap());
   heap().stats_collector()->NotifyMarkingCompleted(
-      mutator_marking_state_.marked_bytes());
+      mutator_marking_state_.marked_bytes() +
+      concurrent_marker_.concurrently_marked_bytes());
 }
 
 void MarkerBase::FinishMarking(MarkingConfig config) {
@@ -195,8 +216,34 @@ void MarkerBase::VisitRoots() {
 }
 
 bool MarkerBase::AdvanceMarkingWithDeadline(v8::base::TimeDelta duration) {
-  v8::base::TimeTicks deadline = v8::base::TimeTicks::Now() + duration;
+  const bool is_done =
+      ProcessWorklistsWithDeadline(v8::base::TimeTicks::Now() + duration);
+  NotifyIncrementalMutatorStepCompleted();
+  return is_done;
+}
+
+bool MarkerBase::AdvanceMarkingInParallel() {
+  DCHECK(!concurrent_marker_.IsActive());
+  // Publish the work found in the atomic pause so far, so that concurrent
+  // markers have something to start with.
+  marking_worklists_.marking_worklist()->FlushToGlobal(
+      MarkingWorklists::kMutatorThreadId);
+  if (concurrent_marker_.Start()) concurrent_marker_.Join();
+  // Concurrent markers leave the write barrier worklist and objects in
+  // construction to the mutator thread.
+  return AdvanceMarkingWithDeadline(v8::base::TimeDelta::Max());
+}
+
+std::unique_ptr<cppgc::Visitor> MarkerBase::CreateConcurrentMarkingVisitor(
+    MarkingState& marking_state, int task_id) const {
+  return std::make_unique<MarkingVisitor>(heap_, marking_state);
+}
+
+void MarkerBase::NotifyIncrementalMutatorStepCompleted() {
+  concurrent_marker_.NotifyIncrementalMutatorStepCompleted();
+}
 
+bool MarkerBase::ProcessWorklistsWithDeadline(v8::base::TimeTicks deadline) {
   do {
     // Convert |previously_not_fully_constructed_worklist_| to
     // |marking_worklist_|. This merely re-adds items with the proper
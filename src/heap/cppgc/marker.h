@@ -11,6 +11,7 @@
 #include "include/cppgc/visitor.h"
 #include "src/base/macros.h"
 #include "src/base/platform/time.h"
+#include "src/heap/cppgc/concurrent-marker.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/marking-state.h"
 #include "src/heap/cppgc/marking-visitor.h"
@@ -31,6 +32,12 @@ class HeapBase;
 // 5. LeaveAtomicPause()
 //
 // Alternatively, FinishMarking combines steps 3.-5.
+//
+// With MarkingType::kIncrementalAndConcurrent, background markers drain the
+// marking worklist between 1. and 3. The mutator thread is still responsible
+// for the write barrier worklist and for objects that were found in
+// construction. In the atomic pause, AdvanceMarkingInParallel() can be used
+// instead of 4. to let concurrent markers help draining the marking worklist.
 class V8_EXPORT_PRIVATE MarkerBase {
  public:
   struct MarkingConfig {
@@ -70,6 +77,21 @@ class V8_EXPORT_PRIVATE MarkerBase {
   // Makes marking progress.
   virtual bool AdvanceMarkingWithDeadline(v8::base::TimeDelta);
 
+  // Makes marking progress until the worklists are empty, using concurrent
+  // markers as helpers if the platform supports them. Only valid in the atomic
+  // pause.
+  bool AdvanceMarkingInParallel();
+
+  // Creates the visitor used by the concurrent marker with id |task_id|. Called
+  // on the background thread.
+  virtual std::unique_ptr<cppgc::Visitor> CreateConcurrentMarkingVisitor(
+      MarkingState&, int task_id) const;
+
+  // Publishes work that was found on the mutator thread outside of
+  // AdvanceMarkingWithDeadline() (e.g. by embedders pushing objects directly)
+  // to concurrent markers.
+  void NotifyIncrementalMutatorStepCompleted();
+
   // Signals leaving the atomic marking pause. This method expects no more
   // objects to be marked and merely updates marking states if needed.
   void LeaveAtomicPause();
@@ -89,6 +111,7 @@ class V8_EXPORT_PRIVATE MarkerBase {
 
   MarkingWorklists& MarkingWorklistsForTesting() { return marking_worklists_; }
   MarkingState& MarkingStateForTesting() { return mutator_marking_state_; }
+  ConcurrentMarker& ConcurrentMarkerForTesting() { return concurrent_marker_; }
   cppgc::Visitor& VisitorForTesting() { return visitor(); }
   void ClearAllWorklistsForTesting();
 
@@ -101,6 +124,8 @@ class V8_EXPORT_PRIVATE MarkerBase {
 
   void VisitRoots();
 
+  bool ProcessWorklistsWithDeadline(v8::base::TimeTicks);
+
   void MarkNotFullyConstructedObjects();
 
   HeapBase& heap_;
@@ -108,6 +133,9 @@ class V8_EXPORT_PRIVATE MarkerBase {
 
   MarkingWorklists marking_worklists_;
   MarkingState mutator_marking_state_;
+  // Declared after the worklists as it must be stopped before they are
+  // destroyed.
+  ConcurrentMarker concurrent_marker_;
 };
 
 class V8_EXPORT_PRIVATE Marker final : public MarkerBase {
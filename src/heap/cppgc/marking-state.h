@@ -81,7 +81,9 @@ void MarkingState::MarkAndPush(const void* object, TraceDescriptor desc) {
 void MarkingState::MarkAndPush(HeapObjectHeader& header, TraceDescriptor desc) {
   DCHECK_NOT_NULL(desc.callback);
 
-  if (header.IsInConstruction<HeapObjectHeader::AccessMode::kNonAtomic>()) {
+  // Marking states are also used by concurrent markers which race with the
+  // mutator finishing object construction.
+  if (header.IsInConstruction<HeapObjectHeader::AccessMode::kAtomic>()) {
     not_fully_constructed_worklist_.Push(header.Payload());
   } else if (MarkNoPush(header)) {
     marking_worklist_.Push(desc);
@@ -93,7 +95,7 @@ bool MarkingState::MarkNoPush(HeapObjectHeader& header) {
   DCHECK_EQ(&heap_, BasePage::FromPayload(&header)->heap());
   // Never mark free space objects. This would e.g. hint to marking a promptly
   // freed backing store.
-  DCHECK(!header.IsFree());
+  DCHECK(!header.IsFree<HeapObjectHeader::AccessMode::kAtomic>());
   return header.TryMarkAtomic();
 }
 
@@ -115,7 +117,9 @@ void MarkingState::MarkAndPush(HeapObjectHeader& header) {
   MarkAndPush(
       header,
       {header.Payload(),
-       GlobalGCInfoTable::GCInfoFromIndex(header.GetGCInfoIndex()).trace});
+       GlobalGCInfoTable::GCInfoFromIndex(
+           header.GetGCInfoIndex<HeapObjectHeader::AccessMode::kAtomic>())
+           .trace});
 }
 
 void MarkingState::RegisterWeakReferenceIfNeeded(const void* object,
@@ -152,10 +156,10 @@ void MarkingState::RegisterWeakCallback(WeakCallback callback,
 
 void MarkingState::AccountMarkedBytes(const HeapObjectHeader& header) {
   marked_bytes_ +=
-      header.IsLargeObject()
+      header.IsLargeObject<HeapObjectHeader::AccessMode::kAtomic>()
           ? reinterpret_cast<const LargePage*>(BasePage::FromPayload(&header))
                 ->PayloadSize()
-          : header.GetSize();
+          : header.GetSize<HeapObjectHeader::AccessMode::kAtomic>();
 }
 
 }  // namespace internal
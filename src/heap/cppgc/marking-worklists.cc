@@ -8,6 +8,8 @@
 namespace cppgc {
 namespace internal {
 
+constexpr int MarkingWorklists::kNumConcurrentMarkers;
+constexpr int MarkingWorklists::kNumMarkers;
 constexpr int MarkingWorklists::kMutatorThreadId;
 
 void MarkingWorklists::ClearForTesting() {
@@ -19,7 +21,9 @@ void MarkingWorklists::ClearForTesting() {
 }
 
 void MarkingWorklists::FlushNotFullyConstructedObjects() {
-  if (!not_fully_constructed_worklist_.IsLocalViewEmpty(kMutatorThreadId)) {
+  // Concurrent markers publish their not-fully-constructed objects to the
+  // global pool, so checking the mutator's local view is not sufficient.
+  if (!not_fully_constructed_worklist_.IsEmpty()) {
     not_fully_constructed_worklist_.FlushToGlobal(kMutatorThreadId);
     previously_not_fully_constructed_worklist_.MergeGlobalPool(
         &not_fully_constructed_worklist_);
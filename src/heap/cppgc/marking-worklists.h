@@ -14,10 +14,9 @@ namespace internal {
 class HeapObjectHeader;
 
 class MarkingWorklists {
-  static constexpr int kNumConcurrentMarkers = 0;
-  static constexpr int kNumMarkers = 1 + kNumConcurrentMarkers;
-
  public:
+  static constexpr int kNumConcurrentMarkers = 4;
+  static constexpr int kNumMarkers = 1 + kNumConcurrentMarkers;
   static constexpr int kMutatorThreadId = 0;
 
   using MarkingItem = cppgc::TraceDescriptor;
@@ -71,14 +71,20 @@ void StatsCollector::AllocatedObjectSizeSafepointImpl() {
   explicitly_freed_bytes_since_safepoint_ = 0;
 }
 
-void StatsCollector::NotifyMarkingStarted() {
+void StatsCollector::NotifyMarkingStarted(CollectionType collection_type) {
   DCHECK_EQ(GarbageCollectionState::kNotRunning, gc_state_);
   gc_state_ = GarbageCollectionState::kMarking;
+  current_.collection_type = collection_type;
 }
 
 void StatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   DCHECK_EQ(GarbageCollectionState::kMarking, gc_state_);
   gc_state_ = GarbageCollectionState::kSweeping;
+  if (current_.collection_type == CollectionType::kMinor) {
+    // Minor GCs only mark young objects. Old objects are retained without
+    // being visited and are accounted using the previous cycle.
+    marked_bytes += previous_.marked_bytes;
+  }
   current_.marked_bytes = marked_bytes;
   allocated_bytes_since_end_of_marking_ = 0;
   allocated_bytes_since_safepoint_ = 0;
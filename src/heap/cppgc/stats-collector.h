@@ -18,13 +18,17 @@ namespace internal {
 // Sink for various time and memory statistics.
 class V8_EXPORT_PRIVATE StatsCollector final {
  public:
+  enum class CollectionType : uint8_t { kMinor, kMajor };
+
   // POD to hold interesting data accumulated during a garbage collection cycle.
   //
   // The event is always fully populated when looking at previous events but
   // may only be partially populated when looking at the current event.
   struct Event final {
-    // Marked bytes collected during marking.
+    // Marked bytes collected during marking. For minor GCs this includes the
+    // old generation as its objects keep their (sticky) mark bits.
     size_t marked_bytes = 0;
+    CollectionType collection_type = CollectionType::kMajor;
   };
 
   // Observer for allocated object size. May be used to implement heap growing
@@ -67,7 +71,7 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   void NotifySafePointForConservativeCollection();
 
   // Indicates a new garbage collection cycle.
-  void NotifyMarkingStarted();
+  void NotifyMarkingStarted(CollectionType = CollectionType::kMajor);
   // Indicates that marking of the current garbage collection cycle is
   // completed.
   void NotifyMarkingCompleted(size_t marked_bytes);
@@ -79,6 +83,10 @@ class V8_EXPORT_PRIVATE StatsCollector final {
   // bytes and the bytes allocated since last marking.
   size_t allocated_object_size() const;
 
+  // Type of the currently running garbage collection cycle. Only valid between
+  // NotifyMarkingStarted() and NotifySweepingCompleted().
+  CollectionType collection_type() const { return current_.collection_type; }
+
  private:
   enum class GarbageCollectionState : uint8_t {
     kNotRunning,
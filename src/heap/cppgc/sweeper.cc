@@ -4,6 +4,7 @@
 
 #include "src/heap/cppgc/sweeper.h"
 
+#include <algorithm>
 #include <atomic>
 #include <memory>
 #include <vector>
@@ -91,6 +92,11 @@ class ThreadSafeStack {
     return vector_.empty();
   }
 
+  size_t Size() const {
+    v8::base::LockGuard<v8::base::Mutex> lock(&mutex_);
+    return vector_.size();
+  }
+
  private:
   std::vector<T> vector_;
   mutable v8::base::Mutex mutex_;
@@ -384,16 +390,32 @@ class MutatorThreadSweeper final : private HeapVisitor<MutatorThreadSweeper> {
   cppgc::Platform* platform_;
 };
 
+// Sweeping is mostly bound by memory bandwidth, so more workers only add
+// contention on the page stacks.
+constexpr size_t kMaxConcurrentSweepers = 4;
+// Minimum number of unswept pages that justifies an additional worker.
+constexpr size_t kPagesPerConcurrentSweeper = 8;
+
+// Pages are independent of each other, so multiple workers may run this task
+// in parallel. The visitor itself is stateless. Finalizers are never invoked
+// concurrently but deferred to SweepFinalizer on the mutator thread.
 class ConcurrentSweepTask final : public v8::JobTask,
                                   private HeapVisitor<ConcurrentSweepTask> {
   friend class HeapVisitor<ConcurrentSweepTask>;
 
  public:
-  explicit ConcurrentSweepTask(SpaceStates* states) : states_(states) {}
+  explicit ConcurrentSweepTask(SpaceStates* states) : states_(states) {
+    size_t unswept_pages = 0;
+    for (const SpaceState& state : *states_) {
+      unswept_pages += state.unswept_pages.Size();
+    }
+    remaining_pages_estimate_.store(unswept_pages, std::memory_order_relaxed);
+  }
 
   void Run(v8::JobDelegate* delegate) final {
     for (SpaceState& state : *states_) {
       while (auto page = state.unswept_pages.Pop()) {
+        remaining_pages_estimate_.fetch_sub(1, std::memory_order_relaxed);
         Traverse(*page);
         if (delegate->ShouldYield()) return;
       }
@@ -402,7 +424,14 @@ class ConcurrentSweepTask final : public v8::JobTask,
   }
 
   size_t GetMaxConcurrency() const final {
-    return is_completed_.load(std::memory_order_relaxed) ? 0 : 1;
+    if (is_completed_.load(std::memory_order_relaxed)) return 0;
+    // The estimate does not account for pages swept on the mutator thread, in
+    // which case excess workers find no pages and terminate right away.
+    const size_t remaining_pages =
+        remaining_pages_estimate_.load(std::memory_order_relaxed);
+    return std::max<size_t>(
+        1, std::min(kMaxConcurrentSweepers,
+                    remaining_pages / kPagesPerConcurrentSweeper));
   }
 
  private:
@@ -436,6 +465,7 @@ class ConcurrentSweepTask final : public v8::JobTask,
   }
 
   SpaceStates* states_;
+  std::atomic<size_t> remaining_pages_estimate_{0};
   std::atomic_bool is_completed_{false};
 };
 
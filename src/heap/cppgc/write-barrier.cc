@@ -34,12 +34,13 @@ void MarkValue(const BasePage* page, MarkerBase* marker, const void* value) {
 
   DCHECK(marker);
 
+  // The header is accessed atomically as concurrent markers may be processing
+  // the same object.
   if (V8_UNLIKELY(
-          header
-              .IsInConstruction<HeapObjectHeader::AccessMode::kNonAtomic>())) {
+          header.IsInConstruction<HeapObjectHeader::AccessMode::kAtomic>())) {
     // It is assumed that objects on not_fully_constructed_worklist_ are not
     // marked.
-    header.Unmark();
+    header.Unmark<HeapObjectHeader::AccessMode::kAtomic>();
     marker->WriteBarrierForInConstructionObject(header.Payload());
     return;
   }
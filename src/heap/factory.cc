@@ -450,7 +450,7 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector->set_length(length);
   vector->set_invocation_count(0);
   vector->set_profiler_ticks(0);
-  vector->clear_padding();
+  vector->set_deopt_history(0);
   vector->set_closure_feedback_cell_array(*closure_feedback_cell_array);
 
   // TODO(leszeks): Initialize based on the feedback metadata.
@@ -1351,12 +1351,24 @@ Handle<Foreign> Factory::NewForeign(Address addr) {
 Handle<WasmTypeInfo> Factory::NewWasmTypeInfo(Address type_address,
                                               Handle<Map> parent) {
   Handle<ArrayList> subtypes = ArrayList::New(isolate(), 0);
+  Handle<FixedArray> supertypes;
+  if (parent->constructor_or_backpointer().IsWasmTypeInfo()) {
+    Handle<FixedArray> parent_supertypes(
+        WasmTypeInfo::cast(parent->constructor_or_backpointer()).supertypes(),
+        isolate());
+    int depth = parent_supertypes->length();
+    supertypes = CopyFixedArrayAndGrow(parent_supertypes, 1);
+    supertypes->set(depth, *parent);
+  } else {
+    supertypes = empty_fixed_array();
+  }
   Map map = *wasm_type_info_map();
   HeapObject result = AllocateRawWithImmortalMap(map.instance_size(),
                                                  AllocationType::kYoung, map);
   Handle<WasmTypeInfo> info(WasmTypeInfo::cast(result), isolate());
   info->set_foreign_address(isolate(), type_address);
   info->set_parent(*parent);
+  info->set_supertypes(*supertypes);
   info->set_subtypes(*subtypes);
   return info;
 }
@@ -1376,7 +1388,7 @@ Handle<FeedbackCell> Factory::NewNoClosuresCell(Handle<HeapObject> value) {
                                  AllocationType::kOld, *no_closures_cell_map());
   Handle<FeedbackCell> cell(FeedbackCell::cast(result), isolate());
   cell->set_value(*value);
-  cell->SetInitialInterruptBudget();
+  cell->SetInitialInterruptBudget(isolate());
   cell->clear_padding();
   return cell;
 }
@@ -1387,7 +1399,7 @@ Handle<FeedbackCell> Factory::NewOneClosureCell(Handle<HeapObject> value) {
                                  AllocationType::kOld, *one_closure_cell_map());
   Handle<FeedbackCell> cell(FeedbackCell::cast(result), isolate());
   cell->set_value(*value);
-  cell->SetInitialInterruptBudget();
+  cell->SetInitialInterruptBudget(isolate());
   cell->clear_padding();
   return cell;
 }
@@ -1398,7 +1410,7 @@ Handle<FeedbackCell> Factory::NewManyClosuresCell(Handle<HeapObject> value) {
                                                  *many_closures_cell_map());
   Handle<FeedbackCell> cell(FeedbackCell::cast(result), isolate());
   cell->set_value(*value);
-  cell->SetInitialInterruptBudget();
+  cell->SetInitialInterruptBudget(isolate());
   cell->clear_padding();
   return cell;
 }
@@ -2510,8 +2522,23 @@ Handle<SourceTextModule> Factory::NewSourceTextModule(
     Handle<SharedFunctionInfo> code) {
   Handle<SourceTextModuleInfo> module_info(
       code->scope_info().ModuleDescriptorInfo(), isolate());
+  // Make room for all local and indirect export names, which are added to the
+  // table by SourceTextModule::PrepareInstantiate.
+  int export_count = 0;
+  for (int i = 0, n = module_info->RegularExportCount(); i < n; ++i) {
+    export_count += module_info->RegularExportExportNames(i).length();
+  }
+  {
+    DisallowHeapAllocation no_gc;
+    FixedArray special_exports = module_info->special_exports();
+    for (int i = 0, n = special_exports.length(); i < n; ++i) {
+      SourceTextModuleInfoEntry entry =
+          SourceTextModuleInfoEntry::cast(special_exports.get(i));
+      if (!entry.export_name().IsUndefined(isolate())) export_count++;
+    }
+  }
   Handle<ObjectHashTable> exports =
-      ObjectHashTable::New(isolate(), module_info->RegularExportCount());
+      ObjectHashTable::New(isolate(), export_count);
   Handle<FixedArray> regular_exports =
       NewFixedArray(module_info->RegularExportCount());
   Handle<FixedArray> regular_imports =
@@ -3349,9 +3376,12 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   DCHECK(Smi::IsValid(backtrack_limit));
   Handle<FixedArray> store = NewFixedArray(JSRegExp::kIrregexpDataSize);
   Smi uninitialized = Smi::FromInt(JSRegExp::kUninitializedValue);
-  Smi ticks_until_tier_up = FLAG_regexp_tier_up
-                                ? Smi::FromInt(FLAG_regexp_tier_up_ticks)
-                                : uninitialized;
+  Smi ticks_until_tier_up = uninitialized;
+  if (FLAG_regexp_tier_up) {
+    ticks_until_tier_up = Smi::FromInt(FLAG_regexp_tier_up_subject_chars > 0
+                                           ? FLAG_regexp_tier_up_subject_chars
+                                           : FLAG_regexp_tier_up_ticks);
+  }
   store->set(JSRegExp::kTagIndex, Smi::FromInt(type));
   store->set(JSRegExp::kSourceIndex, *source);
   store->set(JSRegExp::kFlagsIndex, Smi::FromInt(flags));
@@ -3615,7 +3645,8 @@ Handle<JSPromise> Factory::NewJSPromiseWithoutHook() {
 
 Handle<JSPromise> Factory::NewJSPromise() {
   Handle<JSPromise> promise = NewJSPromiseWithoutHook();
-  isolate()->RunPromiseHook(PromiseHookType::kInit, promise, undefined_value());
+  isolate()->RunAllPromiseHooks(PromiseHookType::kInit, promise,
+                                undefined_value());
   return promise;
 }
 
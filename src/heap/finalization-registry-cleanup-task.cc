@@ -6,6 +6,7 @@
 
 #include "src/execution/frames.h"
 #include "src/execution/interrupts-scope.h"
+#include "src/execution/microtask-queue.h"
 #include "src/execution/stack-guard.h"
 #include "src/execution/v8threads.h"
 #include "src/heap/heap-inl.h"
@@ -42,6 +43,21 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   TRACE_EVENT_CALL_STATS_SCOPED(isolate, "v8",
                                 "V8.FinalizationRegistryCleanupTask");
 
+  // Posting a task per FinalizationRegistry is expensive when many of them
+  // are dirty, so clean up as many as fit into the time budget.
+  const double deadline_in_ms =
+      heap_->MonotonicallyIncreasingTimeInMs() + kTimeBudgetInMs;
+  while (CleanupOneFinalizationRegistry() &&
+         heap_->MonotonicallyIncreasingTimeInMs() < deadline_in_ms) {
+  }
+
+  // Repost if there are remaining dirty FinalizationRegistries.
+  heap_->set_is_finalization_registry_cleanup_task_posted(false);
+  heap_->PostFinalizationRegistryCleanupTaskIfNeeded();
+}
+
+bool FinalizationRegistryCleanupTask::CleanupOneFinalizationRegistry() {
+  Isolate* isolate = heap_->isolate();
   HandleScope handle_scope(isolate);
   Handle<JSFinalizationRegistry> finalization_registry;
   // There could be no dirty FinalizationRegistries. When a context is disposed
@@ -49,7 +65,7 @@ void FinalizationRegistryCleanupTask::RunInternal() {
   // list.
   if (!heap_->DequeueDirtyJSFinalizationRegistry().ToHandle(
           &finalization_registry)) {
-    return;
+    return false;
   }
   finalization_registry->set_scheduled_for_cleanup(false);
 
@@ -80,9 +96,13 @@ void FinalizationRegistryCleanupTask::RunInternal() {
     heap_->EnqueueDirtyJSFinalizationRegistry(*finalization_registry, nop);
   }
 
-  // Repost if there are remaining dirty FinalizationRegistries.
-  heap_->set_is_finalization_registry_cleanup_task_posted(false);
-  heap_->PostFinalizationRegistryCleanupTaskIfNeeded();
+  if (catcher.HasCaught() || catcher.HasTerminated()) return false;
+  // Only continue with the next FinalizationRegistry in this task if the
+  // microtask checkpoint in between would have nothing to run.
+  MicrotaskQueue* microtask_queue =
+      NativeContext::cast(*context).microtask_queue();
+  return heap_->HasDirtyJSFinalizationRegistries() &&
+         (microtask_queue == nullptr || microtask_queue->size() == 0);
 }
 
 }  // namespace internal
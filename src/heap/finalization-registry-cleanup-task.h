@@ -12,8 +12,11 @@ namespace v8 {
 namespace internal {
 
 // The GC schedules a cleanup task when the dirty FinalizationRegistry list is
-// non-empty. The task processes a single FinalizationRegistry and posts another
-// cleanup task if there are remaining dirty FinalizationRegistries on the list.
+// non-empty. The task processes dirty FinalizationRegistries for up to
+// kTimeBudgetInMs, and posts another cleanup task if there are remaining dirty
+// FinalizationRegistries on the list. It stops after a FinalizationRegistry
+// whose cleanup threw or left microtasks to run, so that the embedder can
+// perform a microtask checkpoint.
 class FinalizationRegistryCleanupTask : public CancelableTask {
  public:
   explicit FinalizationRegistryCleanupTask(Heap* heap);
@@ -23,7 +26,12 @@ class FinalizationRegistryCleanupTask : public CancelableTask {
   void operator=(const FinalizationRegistryCleanupTask&) = delete;
 
  private:
+  static constexpr double kTimeBudgetInMs = 1.0;
+
   void RunInternal() override;
+  // Returns true if the next dirty FinalizationRegistry can be cleaned up in
+  // the same task.
+  bool CleanupOneFinalizationRegistry();
   void SlowAssertNoActiveJavaScript();
 
   Heap* heap_;
@@ -12,6 +12,7 @@
 #include "src/heap/incremental-marking.h"
 #include "src/heap/spaces.h"
 #include "src/logging/counters-inl.h"
+#include "src/logging/metrics.h"
 
 namespace v8 {
 namespace internal {
@@ -374,6 +375,8 @@ void GCTracer::Stop(GarbageCollector collector) {
   FetchBackgroundGeneralCounters();
 
   heap_->UpdateTotalGCTime(duration);
+  ReportPauseBudgetViolation(duration);
+  ReportGarbageCollectionCycle(duration);
 
   if ((current_.type == Event::SCAVENGER ||
        current_.type == Event::MINOR_MARK_COMPACTOR) &&
@@ -971,6 +974,54 @@ void GCTracer::RecordEmbedderSpeed(size_t bytes, double duration) {
   }
 }
 
+void GCTracer::ReportGarbageCollectionCycle(double duration) {
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      heap_->isolate()->metrics_recorder();
+  if (!recorder->HasEmbedderRecorder()) return;
+  auto to_us = [](double ms) { return static_cast<int64_t>(ms * 1000); };
+  v8::metrics::GarbageCollectionCycle event;
+  event.is_full = current_.type == Event::MARK_COMPACTOR ||
+                  current_.type == Event::INCREMENTAL_MARK_COMPACTOR;
+  event.pause_in_us = to_us(duration);
+  if (event.is_full) {
+    event.mark_time_in_us = to_us(current_.scopes[Scope::MC_MARK] +
+                                  current_.scopes[Scope::MC_INCREMENTAL]);
+    event.sweep_time_in_us = to_us(current_.scopes[Scope::MC_SWEEP]);
+    event.evacuate_time_in_us = to_us(current_.scopes[Scope::MC_EVACUATE]);
+  } else {
+    event.evacuate_time_in_us =
+        to_us(current_.scopes[Scope::SCAVENGER_SCAVENGE]);
+  }
+  event.heap_size_before_in_bytes = current_.start_object_size;
+  event.heap_size_after_in_bytes = current_.end_object_size;
+  recorder->AddThreadSafeEvent(event);
+}
+
+void GCTracer::ReportPauseBudgetViolation(double duration) {
+  const double max_pause_ms = heap_->gc_pause_budget_ms();
+  const bool is_full = current_.type == Event::MARK_COMPACTOR ||
+                       current_.type == Event::INCREMENTAL_MARK_COMPACTOR;
+  const bool pause_exceeded = max_pause_ms > 0 && duration > max_pause_ms;
+  const bool utilization_missed =
+      is_full && heap_->IsBelowMutatorUtilizationTarget();
+  if (!pause_exceeded && !utilization_missed) return;
+
+  v8::metrics::GarbageCollectionBudgetExceeded event;
+  event.is_full = is_full;
+  event.pause_in_us = static_cast<int64_t>(duration * 1000);
+  event.max_pause_in_us = static_cast<int64_t>(max_pause_ms * 1000);
+  event.mutator_utilization = CurrentMarkCompactMutatorUtilization();
+  event.mutator_utilization_target = heap_->mutator_utilization_target();
+  heap_->isolate()->metrics_recorder()->AddThreadSafeEvent(event);
+  if (FLAG_trace_gc_verbose) {
+    heap_->isolate()->PrintWithTimestamp(
+        "GC pause budget exceeded by %s: pause %.1f ms (max %.1f ms), "
+        "mutator utilization %.2f (target %.2f)\n",
+        current_.TypeName(false), duration, max_pause_ms,
+        event.mutator_utilization, event.mutator_utilization_target);
+  }
+}
+
 void GCTracer::RecordMutatorUtilization(double mark_compact_end_time,
                                         double mark_compact_duration) {
   if (previous_mark_compact_end_time_ == 0) {
@@ -397,6 +397,12 @@ class V8_EXPORT_PRIVATE GCTracer {
   void ResetForTesting();
   void ResetIncrementalMarkingCounters();
   void RecordIncrementalMarkingSpeed(size_t bytes, double duration);
+  // Reports the current event to the metrics recorder if it exceeded the
+  // embedder's pause budget, see Heap::SetGCPauseBudget.
+  void ReportPauseBudgetViolation(double duration);
+  // Reports the phase times of the current event to the metrics recorder.
+  void ReportGarbageCollectionCycle(double duration);
+
   void RecordMutatorUtilization(double mark_compactor_end_time,
                                 double mark_compactor_duration);
 
@@ -172,6 +172,42 @@ size_t MemoryController<Trait>::CalculateAllocationLimit(
 template class V8_EXPORT_PRIVATE MemoryController<V8HeapTrait>;
 template class V8_EXPORT_PRIVATE MemoryController<GlobalMemoryTrait>;
 
+// The scavenger's pause time is dominated by copying surviving objects, so
+// for a semi-space of capacity C, survival ratio S and scavenge speed V for
+// surviving objects the expected pause P is
+//
+// P = C * S / V,
+//
+// which gives the capacity C = P * V / S for a given target pause P.
+size_t NewSpaceController::CalculateCapacity(
+    Heap* heap, size_t current_capacity, size_t min_capacity,
+    size_t max_capacity, double survival_ratio, double survived_scavenge_speed,
+    double target_pause_ms, double max_step_factor) {
+  DCHECK_LE(min_capacity, max_capacity);
+  DCHECK_LE(1.0, max_step_factor);
+  if (target_pause_ms <= 0 || survived_scavenge_speed <= 0) {
+    return current_capacity;
+  }
+  const double survival = Max(survival_ratio / 100, kMinSurvivalRatio);
+  double capacity = target_pause_ms * survived_scavenge_speed / survival;
+  // Avoid oscillation by limiting how fast the capacity may change.
+  capacity = Min(capacity, current_capacity * max_step_factor);
+  capacity = Max(capacity, current_capacity / max_step_factor);
+  capacity = Max(capacity, static_cast<double>(min_capacity));
+  capacity = Min(capacity, static_cast<double>(max_capacity));
+  const size_t result =
+      Max(min_capacity, ::RoundDown(static_cast<size_t>(capacity),
+                                    static_cast<size_t>(Page::kPageSize)));
+  if (FLAG_trace_gc_verbose) {
+    Isolate::FromHeap(heap)->PrintWithTimestamp(
+        "[NewSpaceController] capacity: %zu KB -> %zu KB based on "
+        "survival=%.1f%%, speed=%.f, target_pause=%.1f ms\n",
+        current_capacity / KB, result / KB, survival_ratio,
+        survived_scavenge_speed, target_pause_ms);
+  }
+  return result;
+}
+
 const char* V8HeapTrait::kName = "HeapController";
 const char* GlobalMemoryTrait::kName = "GlobalMemoryController";
 
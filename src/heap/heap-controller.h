@@ -56,6 +56,26 @@ class V8_EXPORT_PRIVATE MemoryController : public AllStatic {
   FRIEND_TEST(MemoryControllerTest, MaxHeapGrowingFactor);
 };
 
+// Sizes the semi-spaces such that the expected scavenge pause, i.e., the
+// time needed to copy all surviving objects, stays within a target.
+class V8_EXPORT_PRIVATE NewSpaceController : public AllStatic {
+ public:
+  // Survival rates below this ratio are treated as this ratio to avoid
+  // unbounded growth for allocation patterns without survivors.
+  static constexpr double kMinSurvivalRatio = 0.01;
+
+  // Returns the semi-space capacity for the given survival ratio (in percent)
+  // and the speed (in bytes/ms) at which surviving objects are scavenged. The
+  // result is page aligned, within [min_capacity, max_capacity] and differs
+  // from the current capacity by at most |max_step_factor|.
+  static size_t CalculateCapacity(Heap* heap, size_t current_capacity,
+                                  size_t min_capacity, size_t max_capacity,
+                                  double survival_ratio,
+                                  double survived_scavenge_speed,
+                                  double target_pause_ms,
+                                  double max_step_factor);
+};
+
 }  // namespace internal
 }  // namespace v8
 
@@ -81,6 +81,10 @@ int64_t Heap::external_memory() {
   return isolate()->isolate_data()->external_memory_;
 }
 
+int64_t Heap::external_memory_limit() {
+  return isolate()->isolate_data()->external_memory_limit_;
+}
+
 void Heap::update_external_memory(int64_t delta) {
   const int64_t amount = isolate()->isolate_data()->external_memory_ + delta;
   isolate()->isolate_data()->external_memory_ = amount;
@@ -4,6 +4,7 @@
 
 #include "src/heap/heap.h"
 
+#include <algorithm>
 #include <atomic>
 #include <cinttypes>
 #include <iomanip>
@@ -15,6 +16,7 @@
 #include "src/base/bits.h"
 #include "src/base/flags.h"
 #include "src/base/once.h"
+#include "src/base/optional.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/builtins/accessors.h"
@@ -29,6 +31,7 @@
 #include "src/execution/vm-state-inl.h"
 #include "src/handles/global-handles.h"
 #include "src/heap/array-buffer-collector.h"
+#include "src/heap/array-buffer-pool.h"
 #include "src/heap/array-buffer-sweeper.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/barrier.h"
@@ -45,6 +48,7 @@
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/heap/incremental-marking-inl.h"
 #include "src/heap/incremental-marking.h"
+#include "src/heap/item-parallel-job.h"
 #include "src/heap/large-spaces.h"
 #include "src/heap/local-heap.h"
 #include "src/heap/mark-compact-inl.h"
@@ -66,7 +70,9 @@
 #include "src/heap/stress-marking-observer.h"
 #include "src/heap/stress-scavenge-observer.h"
 #include "src/heap/sweeper.h"
+#include "src/heap/worklist.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/isolate-allocator.h"
 #include "src/init/v8.h"
 #include "src/interpreter/interpreter.h"
 #include "src/logging/log.h"
@@ -89,6 +95,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/utils/utils-inl.h"
 #include "src/utils/utils.h"
+#include "src/zone/accounting-allocator.h"
 
 // Has to be the last include (doesn't have include guards):
 #include "src/objects/object-macros.h"
@@ -518,6 +525,17 @@ void Heap::PrintShortHeapStatistics() {
                (this->SizeOfObjects() + ro_space->Size()) / KB,
                (this->Available()) / KB,
                (this->CommittedMemory() + ro_space->CommittedMemory()) / KB);
+  size_t old_to_new_slots, old_to_new_bytes;
+  RememberedSet<OLD_TO_NEW>::CollectStatistics(this, &old_to_new_slots,
+                                               &old_to_new_bytes);
+  size_t old_to_old_slots, old_to_old_bytes;
+  RememberedSet<OLD_TO_OLD>::CollectStatistics(this, &old_to_old_slots,
+                                               &old_to_old_bytes);
+  PrintIsolate(isolate_,
+               "Remembered sets, old-to-new: %zu slots in %6zu KB"
+               ", old-to-old: %zu slots in %6zu KB\n",
+               old_to_new_slots, old_to_new_bytes / KB, old_to_old_slots,
+               old_to_old_bytes / KB);
   PrintIsolate(isolate_,
                "Unmapper buffering %zu chunks of committed: %6zu KB\n",
                memory_allocator()->unmapper()->NumberOfCommittedChunks(),
@@ -1660,6 +1678,8 @@ bool Heap::CollectGarbage(AllocationSpace space,
     tracer()->Stop(collector);
   }
 
+  if (collector == MARK_COMPACTOR) InvokeHeapLimitFractionCallbacks();
+
   if (collector == MARK_COMPACTOR &&
       (gc_callback_flags & (kGCCallbackFlagForced |
                             kGCCallbackFlagCollectAllAvailableGarbage)) != 0) {
@@ -2325,6 +2345,7 @@ void Heap::MarkCompactPrologue() {
   isolate_->descriptor_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  RegExpResultsCache::Clear(regexp_exec_cache());
 
   isolate_->compilation_cache()->MarkCompactPrologue();
 
@@ -2333,8 +2354,15 @@ void Heap::MarkCompactPrologue() {
 
 
 void Heap::CheckNewSpaceExpansionCriteria() {
-  if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
-      survived_since_last_expansion_ > new_space_->TotalCapacity()) {
+  if (UseNewSpaceController()) {
+    // Shrinking is deferred to ReduceNewSpaceSize() after the GC.
+    const size_t new_capacity = NewSpaceControllerCapacity();
+    if (new_capacity > new_space_->TotalCapacity()) {
+      new_space_->Resize(new_capacity);
+      survived_since_last_expansion_ = 0;
+    }
+  } else if (new_space_->TotalCapacity() < new_space_->MaximumCapacity() &&
+             survived_since_last_expansion_ > new_space_->TotalCapacity()) {
     // Grow the size of new space if there is room to grow, and enough data
     // has survived scavenge since the last expansion.
     new_space_->Grow();
@@ -3497,6 +3525,16 @@ void Heap::ReduceNewSpaceSize() {
 
   if (FLAG_predictable) return;
 
+  if (UseNewSpaceController() && !ShouldReduceMemory()) {
+    const size_t new_capacity = NewSpaceControllerCapacity();
+    if (new_capacity < new_space_->TotalCapacity()) {
+      new_space_->Resize(new_capacity);
+      new_lo_space_->SetCapacity(new_space_->Capacity());
+      UncommitFromSpace();
+    }
+    return;
+  }
+
   if (ShouldReduceMemory() ||
       ((allocation_throughput != 0) &&
        (allocation_throughput < kLowAllocationThroughput))) {
@@ -3506,6 +3544,19 @@ void Heap::ReduceNewSpaceSize() {
   }
 }
 
+bool Heap::UseNewSpaceController() {
+  return ScavengeTargetPauseMs() > 0 && tracer()->SurvivalEventsRecorded();
+}
+
+size_t Heap::NewSpaceControllerCapacity() {
+  DCHECK(UseNewSpaceController());
+  return NewSpaceController::CalculateCapacity(
+      this, new_space_->TotalCapacity(), new_space_->InitialTotalCapacity(),
+      new_space_->MaximumCapacity(), tracer()->AverageSurvivalRatio(),
+      tracer()->ScavengeSpeedInBytesPerMillisecond(kForSurvivedObjects),
+      ScavengeTargetPauseMs(), FLAG_semi_space_growth_factor);
+}
+
 void Heap::FinalizeIncrementalMarkingIfComplete(
     GarbageCollectionReason gc_reason) {
   if (incremental_marking()->IsMarking() &&
@@ -3870,6 +3921,9 @@ void Heap::CollectGarbageOnMemoryPressure() {
   const double kMaxMemoryPressurePauseMs = 100;
 
   double start = MonotonicallyIncreasingTimeInMs();
+  if (FLAG_discard_source_positions_on_memory_pressure) {
+    isolate()->DiscardLazySourcePositions();
+  }
   CollectAllGarbage(kReduceMemoryFootprintMask,
                     GarbageCollectionReason::kMemoryPressure,
                     kGCCallbackFlagCollectAllAvailableGarbage);
@@ -3905,6 +3959,14 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                static_cast<int>(level));
   MemoryPressureLevel previous = memory_pressure_level_;
   memory_pressure_level_ = level;
+  if (previous != MemoryPressureLevel::kCritical &&
+      level == MemoryPressureLevel::kCritical) {
+    // Memory kept around for reuse by other heaps is released right away, it
+    // is not owned by this isolate.
+    MemoryAllocator::shared_page_pool()->ReleaseAll();
+    IsolateAllocator::ReleaseCachedReservations();
+    isolate()->allocator()->ReleasePooledSegments();
+  }
   if ((previous != MemoryPressureLevel::kCritical &&
        level == MemoryPressureLevel::kCritical) ||
       (previous == MemoryPressureLevel::kNone &&
@@ -3921,6 +3983,44 @@ void Heap::MemoryPressureNotification(MemoryPressureLevel level,
   }
 }
 
+void Heap::SetGCPauseBudget(double max_pause_ms,
+                            double mutator_utilization_target) {
+  gc_pause_budget_ms_ = Max(0.0, max_pause_ms);
+  mutator_utilization_target_ =
+      Min(1.0, Max(0.0, mutator_utilization_target));
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp(
+        "GC pause budget: max pause %.1f ms, mutator utilization %.2f\n",
+        gc_pause_budget_ms_, mutator_utilization_target_);
+  }
+}
+
+bool Heap::IsBelowMutatorUtilizationTarget() {
+  return mutator_utilization_target_ > 0 &&
+         tracer()->CurrentMarkCompactMutatorUtilization() <
+             mutator_utilization_target_;
+}
+
+namespace {
+
+// Returns the smaller of two limits where 0 means that there is no limit.
+double CombinePauseLimits(double a, double b) {
+  if (a <= 0) return Max(0.0, b);
+  if (b <= 0) return a;
+  return Min(a, b);
+}
+
+}  // namespace
+
+double Heap::ScavengeTargetPauseMs() const {
+  return CombinePauseLimits(gc_pause_budget_ms_, FLAG_scavenge_target_pause_ms);
+}
+
+double Heap::CompactionPauseBudgetMs() const {
+  return CombinePauseLimits(gc_pause_budget_ms_,
+                            FLAG_compaction_pause_budget_ms);
+}
+
 void Heap::EagerlyFreeExternalMemory() {
   if (FLAG_array_buffer_extension) {
     array_buffer_sweeper()->EnsureFinished();
@@ -3936,6 +4036,7 @@ void Heap::EagerlyFreeExternalMemory() {
       }
     }
   }
+  array_buffer_pool()->ReleaseAll();
   memory_allocator()->unmapper()->EnsureUnmappingCompleted();
 }
 
@@ -3963,6 +4064,24 @@ void Heap::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
   UNREACHABLE();
 }
 
+void Heap::AddHeapLimitFractionCallback(v8::HeapLimitFractionCallback callback,
+                                        void* data, double fraction) {
+  CHECK_GT(fraction, 0.0);
+  CHECK_LE(fraction, 1.0);
+  heap_limit_fraction_callbacks_.push_back({callback, data, fraction, false});
+}
+
+void Heap::RemoveHeapLimitFractionCallback(
+    v8::HeapLimitFractionCallback callback, void* data) {
+  heap_limit_fraction_callbacks_.erase(
+      std::remove_if(heap_limit_fraction_callbacks_.begin(),
+                     heap_limit_fraction_callbacks_.end(),
+                     [callback, data](const HeapLimitFractionCallbackData& d) {
+                       return d.callback == callback && d.data == data;
+                     }),
+      heap_limit_fraction_callbacks_.end());
+}
+
 void Heap::AppendArrayBufferExtension(JSArrayBuffer object,
                                       ArrayBufferExtension* extension) {
   array_buffer_sweeper_->Append(object, extension);
@@ -3990,6 +4109,30 @@ bool Heap::InvokeNearHeapLimitCallback() {
   return false;
 }
 
+void Heap::InvokeHeapLimitFractionCallbacks() {
+  if (heap_limit_fraction_callbacks_.empty()) return;
+  // Skip garbage collections triggered from within GC callbacks.
+  GCCallbacksScope scope(this);
+  if (!scope.CheckReenter()) return;
+  const size_t live_size = OldGenerationSizeOfObjects();
+  const size_t heap_limit = max_old_generation_size();
+  // Callbacks may remove themselves, so collect the ones to invoke first.
+  std::vector<HeapLimitFractionCallbackData> to_invoke;
+  for (HeapLimitFractionCallbackData& entry : heap_limit_fraction_callbacks_) {
+    const bool reached = live_size >= entry.fraction * heap_limit;
+    if (reached && !entry.triggered) to_invoke.push_back(entry);
+    entry.triggered = reached;
+  }
+  if (to_invoke.empty()) return;
+  AllowHeapAllocation allow_allocation;
+  AllowJavascriptExecution allow_js(isolate());
+  VMState<EXTERNAL> state(isolate_);
+  HandleScope handle_scope(isolate_);
+  for (const HeapLimitFractionCallbackData& entry : to_invoke) {
+    entry.callback(entry.data, live_size, heap_limit, entry.fraction);
+  }
+}
+
 bool Heap::MeasureMemory(std::unique_ptr<v8::MeasureMemoryDelegate> delegate,
                          v8::MeasureMemoryExecution execution) {
   HandleScope handle_scope(isolate());
@@ -4012,6 +4155,10 @@ std::unique_ptr<v8::MeasureMemoryDelegate> Heap::MeasureMemoryDelegate(
                                                mode);
 }
 
+size_t Heap::ContextMemoryUsage(Handle<NativeContext> context) {
+  return memory_measurement_->GetTrackedContextSize(context);
+}
+
 void Heap::CollectCodeStatistics() {
   TRACE_EVENT0("v8", "Heap::CollectCodeStatistics");
   CodeStatistics::ResetCodeAndMetadataStatistics(isolate());
@@ -5354,6 +5501,8 @@ void Heap::SetUpSpaces() {
 #endif  // ENABLE_MINOR_MC
   array_buffer_collector_.reset(new ArrayBufferCollector(this));
   array_buffer_sweeper_.reset(new ArrayBufferSweeper(this));
+  array_buffer_pool_.reset(new ArrayBufferPool(
+      isolate()->array_buffer_allocator(), FLAG_array_buffer_pool_size));
   gc_idle_time_handler_.reset(new GCIdleTimeHandler());
   memory_measurement_.reset(new MemoryMeasurement(isolate()));
   memory_reducer_.reset(new MemoryReducer(this));
@@ -5598,6 +5747,8 @@ void Heap::TearDown() {
   scavenger_collector_.reset();
   array_buffer_collector_.reset();
   array_buffer_sweeper_.reset();
+  // Frees the pooled memory, after the sweeper can't add any more.
+  array_buffer_pool_.reset();
   incremental_marking_.reset();
   concurrent_marking_.reset();
 
@@ -5948,38 +6099,99 @@ class HeapObjectsFilter {
 class UnreachableObjectsFilter : public HeapObjectsFilter {
  public:
   explicit UnreachableObjectsFilter(Heap* heap) : heap_(heap) {
+    AllocateMarkBits();
     MarkReachableObjects();
   }
 
-  ~UnreachableObjectsFilter() override {
-    for (auto it : reachable_) {
-      delete it.second;
-      it.second = nullptr;
-    }
-  }
-
   bool SkipObject(HeapObject object) override {
     if (object.IsFreeSpaceOrFiller()) return true;
     BasicMemoryChunk* chunk = BasicMemoryChunk::FromHeapObject(object);
-    if (reachable_.count(chunk) == 0) return true;
-    return reachable_[chunk]->count(object) == 0;
+    auto it = reachable_.find(chunk);
+    if (it != reachable_.end()) return !it->second->IsMarked(object);
+    return overflow_.count(object) == 0;
   }
 
  private:
+  static const int kInterruptThreshold = 128;
+  static const int kMaxWaitTimeMs = 2;
+
+  using ReachabilityWorklist = Worklist<HeapObject, 64>;
+
+  // One mark bit per tagged word of a chunk. Bits are set atomically, so that
+  // several marking tasks can share the bitmap.
+  class ChunkMarkBits {
+   public:
+    explicit ChunkMarkBits(BasicMemoryChunk* chunk)
+        : chunk_address_(chunk->address()),
+          cells_(new std::atomic<uint32_t>[CellCount(chunk)]) {
+      for (size_t i = 0; i < CellCount(chunk); i++) {
+        cells_[i].store(0, std::memory_order_relaxed);
+      }
+    }
+
+    // Returns true if the object was not marked before.
+    bool Mark(HeapObject object) {
+      size_t index = IndexOf(object);
+      uint32_t mask = 1u << (index % kBitsPerCell);
+      return (cells_[index / kBitsPerCell].fetch_or(
+                  mask, std::memory_order_relaxed) &
+              mask) == 0;
+    }
+
+    bool IsMarked(HeapObject object) const {
+      size_t index = IndexOf(object);
+      uint32_t mask = 1u << (index % kBitsPerCell);
+      return (cells_[index / kBitsPerCell].load(std::memory_order_relaxed) &
+              mask) != 0;
+    }
+
+   private:
+    static const size_t kBitsPerCell = 32;
+
+    static size_t CellCount(BasicMemoryChunk* chunk) {
+      return (chunk->size() / kTaggedSize + kBitsPerCell - 1) / kBitsPerCell;
+    }
+
+    size_t IndexOf(HeapObject object) const {
+      return (object.address() - chunk_address_) / kTaggedSize;
+    }
+
+    const Address chunk_address_;
+    std::unique_ptr<std::atomic<uint32_t>[]> cells_;
+  };
+
+  // Creates the mark bits for all chunks upfront, so that |reachable_| is
+  // only read while marking tasks are running.
+  void AllocateMarkBits() {
+    auto add = [this](BasicMemoryChunk* chunk) {
+      reachable_.emplace(chunk, std::make_unique<ChunkMarkBits>(chunk));
+    };
+    for (ReadOnlyPage* page : heap_->read_only_space()->pages()) add(page);
+    for (Page* page : *heap_->new_space()) add(page);
+    for (SpaceIterator it(heap_); it.HasNext();) {
+      Space* space = it.Next();
+      if (space->identity() == NEW_SPACE) continue;
+      for (MemoryChunk* chunk = space->first_page(); chunk != nullptr;
+           chunk = chunk->list_node().next()) {
+        add(chunk);
+      }
+    }
+  }
+
   bool MarkAsReachable(HeapObject object) {
     BasicMemoryChunk* chunk = BasicMemoryChunk::FromHeapObject(object);
-    if (reachable_.count(chunk) == 0) {
-      reachable_[chunk] = new std::unordered_set<HeapObject, Object::Hasher>();
-    }
-    if (reachable_[chunk]->count(object)) return false;
-    reachable_[chunk]->insert(object);
-    return true;
+    auto it = reachable_.find(chunk);
+    if (it != reachable_.end()) return it->second->Mark(object);
+    // Objects outside of the heap spaces are tracked separately.
+    base::MutexGuard guard(&overflow_mutex_);
+    return overflow_.insert(object).second;
   }
 
   class MarkingVisitor : public ObjectVisitor, public RootVisitor {
    public:
-    explicit MarkingVisitor(UnreachableObjectsFilter* filter)
-        : filter_(filter) {}
+    MarkingVisitor(UnreachableObjectsFilter* filter,
+                   ReachabilityWorklist* worklist, int task_id)
+        : filter_(filter), marking_worklist_(worklist, task_id) {}
 
     void VisitPointers(HeapObject host, ObjectSlot start,
                        ObjectSlot end) override {
@@ -6004,14 +6216,24 @@ class UnreachableObjectsFilter : public HeapObjectsFilter {
       MarkPointersImpl(start, end);
     }
 
-    void TransitiveClosure() {
-      while (!marking_stack_.empty()) {
-        HeapObject obj = marking_stack_.back();
-        marking_stack_.pop_back();
+    // Processes the marking worklist until it is empty. With a |barrier|,
+    // local work is shared with idle tasks from time to time.
+    void TransitiveClosure(OneshotBarrier* barrier) {
+      HeapObject obj;
+      size_t objects = 0;
+      while (marking_worklist_.Pop(&obj)) {
         obj.Iterate(this);
+        if (barrier != nullptr && ((++objects % kInterruptThreshold) == 0) &&
+            marking_worklist_.IsGlobalPoolEmpty() &&
+            !marking_worklist_.IsLocalEmpty()) {
+          marking_worklist_.FlushToGlobal();
+          barrier->NotifyAll();
+        }
       }
     }
 
+    void FlushToGlobal() { marking_worklist_.FlushToGlobal(); }
+
    private:
     void MarkPointers(MaybeObjectSlot start, MaybeObjectSlot end) {
       MarkPointersImpl(start, end);
@@ -6031,27 +6253,72 @@ class UnreachableObjectsFilter : public HeapObjectsFilter {
 
     V8_INLINE void MarkHeapObject(HeapObject heap_object) {
       if (filter_->MarkAsReachable(heap_object)) {
-        marking_stack_.push_back(heap_object);
+        marking_worklist_.Push(heap_object);
       }
     }
 
     UnreachableObjectsFilter* filter_;
-    std::vector<HeapObject> marking_stack_;
+    ReachabilityWorklist::View marking_worklist_;
+  };
+
+  class MarkingTask : public ItemParallelJob::Task {
+   public:
+    MarkingTask(Isolate* isolate, UnreachableObjectsFilter* filter,
+                ReachabilityWorklist* worklist, int task_id,
+                OneshotBarrier* barrier)
+        : ItemParallelJob::Task(isolate),
+          visitor_(filter, worklist, task_id),
+          barrier_(barrier) {}
+
+    void RunInParallel(Runner runner) override {
+      barrier_->Start();
+      do {
+        visitor_.TransitiveClosure(barrier_);
+      } while (!barrier_->Wait());
+      visitor_.TransitiveClosure(nullptr);
+    }
+
+   private:
+    MarkingVisitor visitor_;
+    OneshotBarrier* const barrier_;
   };
 
   friend class MarkingVisitor;
 
+  int NumberOfMarkingTasks() {
+    if (!FLAG_parallel_heap_object_filtering) return 1;
+    static int num_cores = V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1;
+    return Max(1, Min(ReachabilityWorklist::kMaxNumTasks, num_cores));
+  }
+
   void MarkReachableObjects() {
-    MarkingVisitor visitor(this);
-    heap_->IterateRoots(&visitor, {});
-    visitor.TransitiveClosure();
+    const int num_tasks = NumberOfMarkingTasks();
+    ReachabilityWorklist worklist(num_tasks);
+    MarkingVisitor root_visitor(this, &worklist, 0);
+    heap_->IterateRoots(&root_visitor, {});
+    if (num_tasks > 1) {
+      root_visitor.FlushToGlobal();
+      base::Semaphore pending_tasks(0);
+      OneshotBarrier barrier(base::TimeDelta::FromMilliseconds(kMaxWaitTimeMs));
+      ItemParallelJob job(heap_->isolate()->cancelable_task_manager(),
+                          &pending_tasks);
+      for (int i = 0; i < num_tasks; i++) {
+        job.AddTask(
+            new MarkingTask(heap_->isolate(), this, &worklist, i, &barrier));
+      }
+      job.Run();
+    }
+    // Picks up work that was left behind by tasks that gave up waiting.
+    root_visitor.TransitiveClosure(nullptr);
+    DCHECK(worklist.IsEmpty());
   }
 
   Heap* heap_;
   DisallowHeapAllocation no_allocation_;
-  std::unordered_map<BasicMemoryChunk*,
-                     std::unordered_set<HeapObject, Object::Hasher>*>
+  std::unordered_map<BasicMemoryChunk*, std::unique_ptr<ChunkMarkBits>>
       reachable_;
+  base::Mutex overflow_mutex_;
+  std::unordered_set<HeapObject, Object::Hasher> overflow_;
 };
 
 HeapObjectIterator::HeapObjectIterator(
@@ -6594,6 +6861,10 @@ Code Heap::GcSafeFindCodeForInnerPointer(Address inner_pointer) {
     // starting after the inner pointer.
     Page* page = Page::FromAddress(inner_pointer);
 
+    // The code object registry of the page may be rebuilt by a concurrent
+    // sweeper task, which holds the page lock while doing so.
+    base::Optional<base::MutexGuard> guard;
+    if (!page->SweepingDone()) guard.emplace(page->mutex());
     Address start =
         page->GetCodeObjectRegistry()->GetCodeObjectStartFromInnerAddress(
             inner_pointer);
@@ -63,6 +63,7 @@ class NativeContext;
 using v8::MemoryPressureLevel;
 
 class ArrayBufferCollector;
+class ArrayBufferPool;
 class ArrayBufferSweeper;
 class BasicMemoryChunk;
 class CodeLargeObjectSpace;
@@ -373,11 +374,14 @@ class Heap {
 
   // Helper function to get the bytecode flushing mode based on the flags. This
   // is required because it is not safe to acess flags in concurrent marker.
-  static inline BytecodeFlushMode GetBytecodeFlushMode() {
+  inline BytecodeFlushMode GetBytecodeFlushMode() const {
     if (FLAG_stress_flush_bytecode) {
       return BytecodeFlushMode::kStressFlushBytecode;
     } else if (FLAG_flush_bytecode) {
-      return BytecodeFlushMode::kFlushBytecode;
+      // GCs that are meant to reduce memory, i.e. those triggered by memory
+      // pressure or by the memory reducer on an idle heap, flush more eagerly.
+      return ShouldReduceMemory() ? BytecodeFlushMode::kFlushColdBytecode
+                                  : BytecodeFlushMode::kFlushBytecode;
     }
     return BytecodeFlushMode::kDoNotFlushBytecode;
   }
@@ -618,6 +622,24 @@ class Heap {
                                                     bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  // Implements v8::Isolate::SetGCPauseBudget. A value of 0 disables the
+  // respective limit.
+  V8_EXPORT_PRIVATE void SetGCPauseBudget(double max_pause_ms,
+                                          double mutator_utilization_target);
+  double gc_pause_budget_ms() const { return gc_pause_budget_ms_; }
+  double mutator_utilization_target() const {
+    return mutator_utilization_target_;
+  }
+  // Returns true if the last mark-compact left the mutator less time than
+  // the embedder asked for.
+  bool IsBelowMutatorUtilizationTarget();
+
+  // The pause targets used for sizing the young generation and for limiting
+  // compaction. These combine the embedder's pause budget with
+  // --scavenge-target-pause-ms and --compaction-pause-budget-ms, respectively.
+  double ScavengeTargetPauseMs() const;
+  double CompactionPauseBudgetMs() const;
+
   V8_EXPORT_PRIVATE void AddNearHeapLimitCallback(v8::NearHeapLimitCallback,
                                                   void* data);
   V8_EXPORT_PRIVATE void RemoveNearHeapLimitCallback(
@@ -625,6 +647,11 @@ class Heap {
   V8_EXPORT_PRIVATE void AutomaticallyRestoreInitialHeapLimit(
       double threshold_percent);
 
+  V8_EXPORT_PRIVATE void AddHeapLimitFractionCallback(
+      v8::HeapLimitFractionCallback callback, void* data, double fraction);
+  V8_EXPORT_PRIVATE void RemoveHeapLimitFractionCallback(
+      v8::HeapLimitFractionCallback callback, void* data);
+
   void AppendArrayBufferExtension(JSArrayBuffer object,
                                   ArrayBufferExtension* extension);
 
@@ -641,6 +668,10 @@ class Heap {
       Handle<NativeContext> context, Handle<JSPromise> promise,
       v8::MeasureMemoryMode mode);
 
+  // Returns the size attributed to |context| by the last full GC and keeps
+  // attributing memory to it in following full GCs.
+  size_t ContextMemoryUsage(Handle<NativeContext> context);
+
   // Check new space expansion criteria and expand semispaces if it was hit.
   void CheckNewSpaceExpansionCriteria();
 
@@ -667,6 +698,7 @@ class Heap {
   int64_t external_memory_hard_limit() { return max_old_generation_size_ / 2; }
 
   V8_INLINE int64_t external_memory();
+  V8_INLINE int64_t external_memory_limit();
   V8_INLINE void update_external_memory(int64_t delta);
   V8_INLINE void update_external_memory_concurrently_freed(uintptr_t freed);
   V8_INLINE void account_external_memory_concurrently_freed();
@@ -719,6 +751,14 @@ class Heap {
   void ConfigureHeap(const v8::ResourceConstraints& constraints);
   void ConfigureHeapDefault();
 
+  // The NUMA node that heap pages should be allocated on, or -1 if no
+  // node is preferred. Must be set before the heap is set up.
+  void set_numa_node(int numa_node) {
+    DCHECK(!HasBeenSetUp());
+    numa_node_ = numa_node;
+  }
+  int numa_node() const { return numa_node_; }
+
   // Prepares the heap, setting up for deserialization.
   void SetUp();
 
@@ -796,6 +836,8 @@ class Heap {
     return array_buffer_sweeper_.get();
   }
 
+  ArrayBufferPool* array_buffer_pool() { return array_buffer_pool_.get(); }
+
   const base::AddressRegion& code_range();
 
   // ===========================================================================
@@ -1702,6 +1744,12 @@ class Heap {
 
   void ReduceNewSpaceSize();
 
+  // Returns true if the semi-spaces are sized by the NewSpaceController, see
+  // --scavenge-target-pause-ms.
+  bool UseNewSpaceController();
+  // Returns the semi-space capacity computed by the NewSpaceController.
+  size_t NewSpaceControllerCapacity();
+
   GCIdleTimeHeapState ComputeHeapState();
 
   bool PerformIdleTimeAction(GCIdleTimeAction action,
@@ -1733,6 +1781,10 @@ class Heap {
 
   bool InvokeNearHeapLimitCallback();
 
+  // Invokes the callbacks whose fraction of the heap limit was reached by the
+  // old generation live size after a mark-compact.
+  void InvokeHeapLimitFractionCallbacks();
+
   void ComputeFastPromotionMode();
 
   // Attempt to over-approximate the weak closure by marking object groups and
@@ -2026,6 +2078,16 @@ class Heap {
   std::vector<std::pair<v8::NearHeapLimitCallback, void*> >
       near_heap_limit_callbacks_;
 
+  struct HeapLimitFractionCallbackData {
+    v8::HeapLimitFractionCallback callback;
+    void* data;
+    double fraction;
+    // Set when the callback was invoked and cleared once the live size drops
+    // below the fraction again.
+    bool triggered;
+  };
+  std::vector<HeapLimitFractionCallbackData> heap_limit_fraction_callbacks_;
+
   // For keeping track of context disposals.
   int contexts_disposed_ = 0;
 
@@ -2153,6 +2215,7 @@ class Heap {
   std::unique_ptr<ScavengerCollector> scavenger_collector_;
   std::unique_ptr<ArrayBufferCollector> array_buffer_collector_;
   std::unique_ptr<ArrayBufferSweeper> array_buffer_sweeper_;
+  std::unique_ptr<ArrayBufferPool> array_buffer_pool_;
 
   std::unique_ptr<MemoryAllocator> memory_allocator_;
   std::unique_ptr<IncrementalMarking> incremental_marking_;
@@ -2230,6 +2293,11 @@ class Heap {
 
   bool fast_promotion_mode_ = false;
 
+  int numa_node_ = -1;
+
+  double gc_pause_budget_ms_ = 0.0;
+  double mutator_utilization_target_ = 0.0;
+
   // Used for testing purposes.
   bool force_oom_ = false;
   bool delay_sweeper_tasks_for_testing_ = false;
@@ -1025,6 +1025,10 @@ StepResult IncrementalMarking::Step(double max_step_size_in_ms,
                                     StepOrigin step_origin) {
   double start = heap_->MonotonicallyIncreasingTimeInMs();
 
+  if (heap_->gc_pause_budget_ms() > 0) {
+    max_step_size_in_ms = Min(max_step_size_in_ms, heap_->gc_pause_budget_ms());
+  }
+
   if (state_ == SWEEPING) {
     TRACE_GC(heap_->tracer(), GCTracer::Scope::MC_INCREMENTAL_SWEEPING);
     FinalizeSweeping();
@@ -25,8 +25,7 @@ LocalHeap* LocalHeap::Current() { return current_local_heap; }
 LocalHeap::LocalHeap(Heap* heap,
                      std::unique_ptr<PersistentHandles> persistent_handles)
     : heap_(heap),
-      state_(ThreadState::Running),
-      safepoint_requested_(false),
+      state_(kRunning),
       allocation_failed_(false),
       prev_(nullptr),
       next_(nullptr),
@@ -78,45 +77,42 @@ bool LocalHeap::ContainsLocalHandle(Address* location) {
 
 bool LocalHeap::IsHandleDereferenceAllowed() {
   DCHECK_EQ(LocalHeap::Current(), this);
-  return state_ == ThreadState::Running;
+  return (state_.load() & kParked) == 0;
 }
 #endif
 
 bool LocalHeap::IsParked() {
   DCHECK_EQ(LocalHeap::Current(), this);
-  return state_ == ThreadState::Parked;
+  return state_.load() & kParked;
 }
 
-void LocalHeap::Park() {
-  base::MutexGuard guard(&state_mutex_);
-  CHECK(state_ == ThreadState::Running);
-  state_ = ThreadState::Parked;
-  state_change_.NotifyAll();
+void LocalHeap::ParkSlowPath() {
+  // A safepoint was requested while the thread was running, so the main thread
+  // waits for this thread. Parking counts as stopping.
+  CHECK(state_.load() == (kRunning | kSafepointRequested));
+  state_.store(kParked | kSafepointRequested);
+  heap_->safepoint()->NotifyPark();
 }
 
-void LocalHeap::Unpark() {
-  base::MutexGuard guard(&state_mutex_);
-  CHECK(state_ == ThreadState::Parked);
-  state_ = ThreadState::Running;
+void LocalHeap::UnparkSlowPath() {
+  // Parked threads must not access the heap until the safepoint is over.
+  for (;;) {
+    uint8_t expected = kParked;
+    if (state_.compare_exchange_strong(expected, kRunning)) return;
+    CHECK(expected == (kParked | kSafepointRequested));
+    heap_->safepoint()->WaitInUnpark();
+  }
 }
 
 void LocalHeap::EnsureParkedBeforeDestruction() {
-  base::MutexGuard guard(&state_mutex_);
-  state_ = ThreadState::Parked;
-  state_change_.NotifyAll();
-}
-
-void LocalHeap::RequestSafepoint() {
-  safepoint_requested_.store(true, std::memory_order_relaxed);
-}
-
-void LocalHeap::ClearSafepointRequested() {
-  safepoint_requested_.store(false, std::memory_order_relaxed);
+  if (state_.load() & kParked) return;
+  Park();
 }
 
-void LocalHeap::EnterSafepoint() {
+void LocalHeap::SafepointSlowPath() {
   DCHECK_EQ(LocalHeap::Current(), this);
-  if (state_ == ThreadState::Running) heap_->safepoint()->EnterFromThread(this);
+  CHECK(state_.load() == (kRunning | kSafepointRequested));
+  heap_->safepoint()->WaitInSafepoint();
 }
 
 void LocalHeap::FreeLinearAllocationArea() {
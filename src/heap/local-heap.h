@@ -8,7 +8,6 @@
 #include <atomic>
 #include <memory>
 
-#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/execution/isolate.h"
 #include "src/handles/persistent-handles.h"
@@ -28,17 +27,10 @@ class V8_EXPORT_PRIVATE LocalHeap {
       std::unique_ptr<PersistentHandles> persistent_handles = nullptr);
   ~LocalHeap();
 
-  // Invoked by main thread to signal this thread that it needs to halt in a
-  // safepoint.
-  void RequestSafepoint();
-
   // Frequently invoked by local thread to check whether safepoint was requested
   // from the main thread.
   void Safepoint() {
-    if (IsSafepointRequested()) {
-      ClearSafepointRequested();
-      EnterSafepoint();
-    }
+    if (IsSafepointRequested()) SafepointSlowPath();
   }
 
   LocalHandles* handles() { return handles_.get(); }
@@ -92,15 +84,15 @@ class V8_EXPORT_PRIVATE LocalHeap {
       AllocationAlignment alignment = kWordAligned);
 
  private:
-  enum class ThreadState {
-    // Threads in this state need to be stopped in a safepoint.
-    Running,
-    // Thread was parked, which means that the thread is not allowed to access
-    // or manipulate the heap in any way.
-    Parked,
-    // Thread was stopped in a safepoint.
-    Safepoint
-  };
+  // The state of the thread is a combination of these bits. A thread without
+  // kParked is running and needs to be stopped in a safepoint. A parked thread
+  // is not allowed to access or manipulate the heap in any way, so it doesn't
+  // need to be stopped. The main thread sets kSafepointRequested on all local
+  // heaps for the duration of a safepoint. Running threads then stop in
+  // Safepoint() or report when they park, while parked threads can't unpark.
+  static constexpr uint8_t kRunning = 0;
+  static constexpr uint8_t kParked = 1 << 0;
+  static constexpr uint8_t kSafepointRequested = 1 << 1;
 
   // Slow path of allocation that performs GC and then retries allocation in
   // loop.
@@ -109,26 +101,28 @@ class V8_EXPORT_PRIVATE LocalHeap {
                                             AllocationOrigin origin,
                                             AllocationAlignment alignment);
 
-  void Park();
-  void Unpark();
+  void Park() {
+    uint8_t expected = kRunning;
+    if (!state_.compare_exchange_strong(expected, kParked)) ParkSlowPath();
+  }
+  void Unpark() {
+    uint8_t expected = kParked;
+    if (!state_.compare_exchange_strong(expected, kRunning)) UnparkSlowPath();
+  }
+  void ParkSlowPath();
+  void UnparkSlowPath();
   void EnsureParkedBeforeDestruction();
 
   void EnsurePersistentHandles();
 
   V8_INLINE bool IsSafepointRequested() {
-    return safepoint_requested_.load(std::memory_order_relaxed);
+    return state_.load(std::memory_order_relaxed) & kSafepointRequested;
   }
-  void ClearSafepointRequested();
-
-  void EnterSafepoint();
+  void SafepointSlowPath();
 
   Heap* heap_;
 
-  base::Mutex state_mutex_;
-  base::ConditionVariable state_change_;
-  ThreadState state_;
-
-  std::atomic<bool> safepoint_requested_;
+  std::atomic<uint8_t> state_;
 
   bool allocation_failed_;
 
@@ -41,8 +41,9 @@ void MarkCompactCollector::MarkRootObject(Root root, HeapObject obj) {
 #ifdef ENABLE_MINOR_MC
 
 void MinorMarkCompactCollector::MarkRootObject(HeapObject obj) {
-  if (Heap::InYoungGeneration(obj) &&
-      non_atomic_marking_state_.WhiteToGrey(obj)) {
+  // Roots are marked while background tasks are already processing the
+  // old-to-new remembered set, so the marking bits have to be set atomically.
+  if (Heap::InYoungGeneration(obj) && marking_state_.WhiteToGrey(obj)) {
     worklist_->Push(kMainThreadTask, obj);
   }
 }
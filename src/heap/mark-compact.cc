@@ -436,6 +436,7 @@ MarkCompactCollector::MarkCompactCollector(Heap* heap)
       was_marked_incrementally_(false),
       evacuation_(false),
       compacting_(false),
+      evacuation_budget_bytes_(0),
       black_allocation_(false),
       have_code_to_deoptimize_(false),
       sweeper_(new Sweeper(heap, non_atomic_marking_state())) {
@@ -488,6 +489,8 @@ bool MarkCompactCollector::StartCompaction() {
     if (FLAG_gc_experiment_less_compaction && !heap_->ShouldReduceMemory())
       return false;
 
+    evacuation_budget_bytes_ = ComputeEvacuationBudget();
+
     CollectEvacuationCandidates(heap()->old_space());
 
     if (FLAG_compact_code_space) {
@@ -525,7 +528,7 @@ void MarkCompactCollector::StartMarking() {
       kMainThreadTask, marking_worklists_holder());
   marking_visitor_ = std::make_unique<MarkingVisitor>(
       marking_state(), marking_worklists(), weak_objects(), heap_, epoch(),
-      Heap::GetBytecodeFlushMode(),
+      heap_->GetBytecodeFlushMode(),
       heap_->local_embedder_heap_tracer()->InUse(),
       heap_->is_current_gc_forced());
 // Marking bits are cleared by the sweeper.
@@ -678,9 +681,30 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (heap()->CompactionPauseBudgetMs() > 0 &&
+        estimated_compaction_speed != 0) {
+      // With a pause budget the remaining budget replaces the fixed quota.
+      // Fragmented pages that do not fit are left for subsequent GCs.
+      *max_evacuated_bytes = evacuation_budget_bytes_;
+    }
   }
 }
 
+size_t MarkCompactCollector::ComputeEvacuationBudget() {
+  const double budget_ms = heap()->CompactionPauseBudgetMs();
+  if (budget_ms <= 0) return 0;
+  const double estimated_compaction_speed =
+      heap()->tracer()->CompactionSpeedInBytesPerMillisecond();
+  const size_t budget =
+      static_cast<size_t>(budget_ms * estimated_compaction_speed);
+  if (FLAG_trace_evacuation_candidates) {
+    PrintIsolate(isolate(),
+                 "Evacuation budget: %zu KB for %.1f ms at %.f bytes/ms.\n",
+                 budget / KB, budget_ms, estimated_compaction_speed);
+  }
+  return budget;
+}
+
 void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
   DCHECK(space->identity() == OLD_SPACE || space->identity() == CODE_SPACE);
 
@@ -794,6 +818,7 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
               [](const LiveBytesPagePair& a, const LiveBytesPagePair& b) {
                 return a.first < b.first;
               });
+    int deferred_count = 0;
     for (size_t i = 0; i < pages.size(); i++) {
       size_t live_bytes = pages[i].first;
       DCHECK_GE(area_size, live_bytes);
@@ -801,6 +826,8 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
           ((total_live_bytes + live_bytes) <= max_evacuated_bytes)) {
         candidate_count++;
         total_live_bytes += live_bytes;
+      } else {
+        deferred_count++;
       }
       if (FLAG_trace_fragmentation_verbose) {
         PrintIsolate(isolate(),
@@ -826,6 +853,17 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     for (int i = 0; i < candidate_count; i++) {
       AddEvacuationCandidate(pages[i].second);
     }
+    if (heap()->CompactionPauseBudgetMs() > 0) {
+      const size_t selected_bytes = candidate_count > 0 ? total_live_bytes : 0;
+      evacuation_budget_bytes_ -= Min(evacuation_budget_bytes_, selected_bytes);
+      if (FLAG_trace_evacuation_candidates) {
+        PrintIsolate(isolate(),
+                     "Evacuation budget: space=%s selected=%d "
+                     "selected_live_kb=%zu deferred=%d remaining_kb=%zu\n",
+                     space->name(), candidate_count, selected_bytes / KB,
+                     deferred_count, evacuation_budget_bytes_ / KB);
+      }
+    }
   }
 
   if (FLAG_trace_fragmentation) {
@@ -1748,6 +1786,13 @@ void MarkCompactCollector::ProcessEphemeronsLinear() {
   DCHECK(weak_objects_.current_ephemerons.IsEmpty());
   weak_objects_.current_ephemerons.Swap(weak_objects_.next_ephemerons);
 
+  // This algorithm is only used when there are many pending ephemerons. Size
+  // the map for them up front instead of rehashing it while it is filled.
+  size_t ephemeron_count = 0;
+  weak_objects_.current_ephemerons.Iterate(
+      [&ephemeron_count](Ephemeron) { ephemeron_count++; });
+  key_to_values.reserve(ephemeron_count);
+
   while (weak_objects_.current_ephemerons.Pop(kMainThreadTask, &ephemeron)) {
     ProcessEphemeron(ephemeron.key, ephemeron.value);
 
@@ -2287,7 +2332,8 @@ void MarkCompactCollector::ClearOldBytecodeCandidates() {
 }
 
 void MarkCompactCollector::ClearFlushedJsFunctions() {
-  DCHECK(FLAG_flush_bytecode || weak_objects_.flushed_js_functions.IsEmpty());
+  DCHECK(FLAG_flush_bytecode || FLAG_flush_feedback_vectors ||
+         weak_objects_.flushed_js_functions.IsEmpty());
   JSFunction flushed_js_function;
   while (weak_objects_.flushed_js_functions.Pop(kMainThreadTask,
                                                 &flushed_js_function)) {
@@ -2296,6 +2342,7 @@ void MarkCompactCollector::ClearFlushedJsFunctions() {
       RecordSlot(object, slot, HeapObject::cast(target));
     };
     flushed_js_function.ResetIfBytecodeFlushed(gc_notify_updated_slot);
+    flushed_js_function.ResetIfFeedbackVectorCold(gc_notify_updated_slot);
   }
 }
 
@@ -2356,10 +2403,11 @@ bool MarkCompactCollector::CompactTransitionArray(Map map,
       transition_index++;
     }
   }
-  // If there are no transitions to be cleared, return.
+  // If there are no transitions to be cleared, keep the slack for future
+  // insertions unless the GC is trying to reduce memory.
   if (transition_index == num_transitions) {
     DCHECK(!descriptors_owner_died);
-    return false;
+    if (!heap_->ShouldReduceMemory()) return false;
   }
   // Note that we never eliminate a transition array, though we might right-trim
   // such that number_of_transitions() == 0. If this assumption changes,
@@ -4797,9 +4845,11 @@ class YoungGenerationMarkingTask : public ItemParallelJob::Task {
  public:
   YoungGenerationMarkingTask(
       Isolate* isolate, MinorMarkCompactCollector* collector,
-      MinorMarkCompactCollector::MarkingWorklist* global_worklist, int task_id)
+      MinorMarkCompactCollector::MarkingWorklist* global_worklist, int task_id,
+      MinorMarkCompactCollector::RootMarkingVisitor* root_visitor = nullptr)
       : ItemParallelJob::Task(isolate),
         collector_(collector),
+        root_visitor_(root_visitor),
         marking_worklist_(global_worklist, task_id),
         marking_state_(collector->marking_state()),
         visitor_(marking_state_, global_worklist, task_id) {
@@ -4811,6 +4861,13 @@ class YoungGenerationMarkingTask : public ItemParallelJob::Task {
     if (runner == Runner::kForeground) {
       TRACE_GC(collector_->heap()->tracer(),
                GCTracer::Scope::MINOR_MC_MARK_PARALLEL);
+      if (root_visitor_ != nullptr) {
+        // Background tasks are already processing the old-to-new remembered
+        // set while the main thread seeds the roots.
+        TRACE_GC(collector_->heap()->tracer(),
+                 GCTracer::Scope::MINOR_MC_MARK_SEED);
+        collector_->MarkRootSet(root_visitor_);
+      }
       ProcessItems();
     } else {
       TRACE_BACKGROUND_GC(
@@ -4876,6 +4933,7 @@ class YoungGenerationMarkingTask : public ItemParallelJob::Task {
   }
 
   MinorMarkCompactCollector* collector_;
+  MinorMarkCompactCollector::RootMarkingVisitor* root_visitor_;
   MinorMarkCompactCollector::MarkingWorklist::View marking_worklist_;
   MinorMarkCompactCollector::MarkingState* marking_state_;
   YoungGenerationMarkingVisitor visitor_;
@@ -4956,6 +5014,18 @@ class PageMarkingItem : public MarkingItem {
   int slots_;
 };
 
+void MinorMarkCompactCollector::MarkRootSet(RootMarkingVisitor* root_visitor) {
+  // MinorMC treats all weak roots except for global handles as strong.
+  // That is why we don't set skip_weak = true here and instead visit
+  // global handles separately.
+  heap()->IterateRoots(
+      root_visitor, base::EnumSet<SkipRoot>{SkipRoot::kExternalStringTable,
+                                            SkipRoot::kGlobalHandles,
+                                            SkipRoot::kOldGeneration});
+  isolate()->global_handles()->IterateYoungStrongAndDependentRoots(
+      root_visitor);
+}
+
 void MinorMarkCompactCollector::MarkRootSetInParallel(
     RootMarkingVisitor* root_visitor) {
   std::atomic<int> slots;
@@ -4963,21 +5033,12 @@ void MinorMarkCompactCollector::MarkRootSetInParallel(
     ItemParallelJob job(isolate()->cancelable_task_manager(),
                         &page_parallel_job_semaphore_);
 
-    // Seed the root set (roots + old->new set).
+    // Create items for each page of the old->new set. The roots are seeded by
+    // the main thread task once the background tasks are already running.
     {
       TRACE_GC(heap()->tracer(), GCTracer::Scope::MINOR_MC_MARK_SEED);
       isolate()->global_handles()->IdentifyWeakUnmodifiedObjects(
           &JSObject::IsUnmodifiedApiObject);
-      // MinorMC treats all weak roots except for global handles as strong.
-      // That is why we don't set skip_weak = true here and instead visit
-      // global handles separately.
-      heap()->IterateRoots(
-          root_visitor, base::EnumSet<SkipRoot>{SkipRoot::kExternalStringTable,
-                                                SkipRoot::kGlobalHandles,
-                                                SkipRoot::kOldGeneration});
-      isolate()->global_handles()->IterateYoungStrongAndDependentRoots(
-          root_visitor);
-      // Create items for each page.
       RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
           heap(), [&job, &slots](MemoryChunk* chunk) {
             job.AddItem(new PageMarkingItem(chunk, &slots));
@@ -4990,7 +5051,11 @@ void MinorMarkCompactCollector::MarkRootSetInParallel(
       const int new_space_pages =
           static_cast<int>(heap()->new_space()->Capacity()) / Page::kPageSize;
       const int num_tasks = NumberOfParallelMarkingTasks(new_space_pages);
-      for (int i = 0; i < num_tasks; i++) {
+      // The first task runs on the main thread and is responsible for the
+      // roots.
+      job.AddTask(new YoungGenerationMarkingTask(isolate(), this, worklist(),
+                                                 kMainMarker, root_visitor));
+      for (int i = 1; i < num_tasks; i++) {
         job.AddTask(
             new YoungGenerationMarkingTask(isolate(), this, worklist(), i));
       }
@@ -598,6 +598,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
                                    int* target_fragmentation_percent,
                                    size_t* max_evacuated_bytes);
 
+  // Returns the number of bytes that can be evacuated within
+  // --compaction-pause-budget-ms, or 0 if there is no budget.
+  size_t ComputeEvacuationBudget();
+
   void RecordObjectStats();
 
   // Finishes GC, performs heap verification if enabled.
@@ -758,6 +762,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // candidates.
   bool compacting_;
 
+  // Bytes that may still be selected for evacuation in the current GC when
+  // running with a compaction pause budget. Shared by all compacted spaces.
+  size_t evacuation_budget_bytes_;
+
   bool black_allocation_;
 
   bool have_code_to_deoptimize_;
@@ -847,6 +855,7 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
   }
 
   void MarkLiveObjects() override;
+  void MarkRootSet(RootMarkingVisitor* root_visitor);
   void MarkRootSetInParallel(RootMarkingVisitor* root_visitor);
   V8_INLINE void MarkRootObject(HeapObject obj);
   void DrainMarkingWorklist() override;
@@ -128,9 +128,12 @@ template <typename ConcreteVisitor, typename MarkingState>
 int MarkingVisitorBase<ConcreteVisitor, MarkingState>::VisitJSFunction(
     Map map, JSFunction object) {
   int size = concrete_visitor()->VisitJSObjectSubclass(map, object);
-  // Check if the JSFunction needs reset due to bytecode being flushed.
-  if (bytecode_flush_mode_ != BytecodeFlushMode::kDoNotFlushBytecode &&
-      object.NeedsResetDueToFlushedBytecode()) {
+  // Check if the JSFunction needs reset due to bytecode being flushed, or
+  // because its feedback vector has gone cold.
+  if ((bytecode_flush_mode_ != BytecodeFlushMode::kDoNotFlushBytecode &&
+       object.NeedsResetDueToFlushedBytecode()) ||
+      (FLAG_flush_feedback_vectors &&
+       object.NeedsResetDueToColdFeedbackVector())) {
     weak_objects_->flushed_js_functions.Push(task_id_, object);
   }
   return size;
@@ -170,12 +173,37 @@ int MarkingVisitorBase<ConcreteVisitor, MarkingState>::
   concrete_visitor()->marking_state()->GreyToBlack(object);
   int size = FixedArray::BodyDescriptor::SizeOf(map, object);
   size_t current_progress_bar = chunk->ProgressBar();
-  int start = static_cast<int>(current_progress_bar);
+  int start;
+  int end;
+  if (FLAG_parallel_marking_progress_bar) {
+    // Claim the next chunk of the array before scanning it, so that other
+    // markers can pick up the following chunks in parallel.
+    while (true) {
+      start = static_cast<int>(current_progress_bar);
+      if (start == 0) start = FixedArray::BodyDescriptor::kStartOffset;
+      end = Min(size, start + kProgressBarScanningChunk);
+      if (start >= end) return 0;
+      if (chunk->TrySetProgressBar(current_progress_bar, end)) break;
+      current_progress_bar = chunk->ProgressBar();
+    }
+    if (end < size) {
+      // The object can be pushed back onto the marking worklist only after
+      // progress bar was updated.
+      marking_worklists_->Push(object);
+      marking_worklists_->ShareWorkIfGlobalPoolIsEmpty();
+    }
+    if (start == FixedArray::BodyDescriptor::kStartOffset) {
+      this->VisitMapPointer(object);
+    }
+    VisitPointers(object, object.RawField(start), object.RawField(end));
+    return end - start;
+  }
+  start = static_cast<int>(current_progress_bar);
   if (start == 0) {
     this->VisitMapPointer(object);
     start = FixedArray::BodyDescriptor::kStartOffset;
   }
-  int end = Min(size, start + kProgressBarScanningChunk);
+  end = Min(size, start + kProgressBarScanningChunk);
   if (start < end) {
     VisitPointers(object, object.RawField(start), object.RawField(end));
     bool success = chunk->TrySetProgressBar(current_progress_bar, end);
@@ -40,6 +40,44 @@ void CodeRangeAddressHint::NotifyFreedCodeRange(Address code_range_start,
   recently_freed_[code_range_size].push_back(code_range_start);
 }
 
+// -----------------------------------------------------------------------------
+// SharedPagePool
+//
+
+static base::LazyInstance<SharedPagePool>::type process_wide_page_pool =
+    LAZY_INSTANCE_INITIALIZER;
+
+bool SharedPagePool::TryAdd(Address page) {
+  DCHECK(IsAligned(page, MemoryChunk::kAlignment));
+  base::MutexGuard guard(&mutex_);
+  if (pages_.size() >= FLAG_shared_page_pool_size) return false;
+  pages_.push_back(page);
+  return true;
+}
+
+Address SharedPagePool::TryGet() {
+  base::MutexGuard guard(&mutex_);
+  if (pages_.empty()) return kNullAddress;
+  Address page = pages_.back();
+  pages_.pop_back();
+  return page;
+}
+
+void SharedPagePool::ReleaseAll() {
+  base::MutexGuard guard(&mutex_);
+  v8::PageAllocator* page_allocator = GetPlatformPageAllocator();
+  for (Address page : pages_) {
+    CHECK(FreePages(page_allocator, reinterpret_cast<void*>(page),
+                    MemoryChunk::kPageSize));
+  }
+  pages_.clear();
+}
+
+size_t SharedPagePool::NumberOfPages() {
+  base::MutexGuard guard(&mutex_);
+  return pages_.size();
+}
+
 // -----------------------------------------------------------------------------
 // MemoryAllocator
 //
@@ -87,6 +125,17 @@ void MemoryAllocator::InitializeCodePageAllocator(
   Address hint =
       RoundDown(code_range_address_hint.Pointer()->GetAddressHint(requested),
                 page_allocator->AllocatePageSize());
+#if V8_TARGET_ARCH_X64
+  if (FLAG_short_builtin_calls) {
+    // Ask for the addresses right below the embedded blob, so that the whole
+    // code range can reach the builtins with rel32 calls. Whether the OS
+    // honoured the hint is checked once the isolate is set up.
+    Address blob = reinterpret_cast<Address>(isolate_->embedded_blob_code());
+    if (blob > requested) {
+      hint = RoundDown(blob - requested, page_allocator->AllocatePageSize());
+    }
+  }
+#endif  // V8_TARGET_ARCH_X64
   VirtualMemory reservation(
       page_allocator, requested, reinterpret_cast<void*>(hint),
       Max(kMinExpectedOSPageSize, page_allocator->AllocatePageSize()));
@@ -123,6 +172,14 @@ void MemoryAllocator::InitializeCodePageAllocator(
       NewEvent("CodeRange", reinterpret_cast<void*>(reservation.address()),
                requested));
 
+  if (FLAG_huge_code_pages) {
+    // Code pages are allocated next to each other in the code range, so whole
+    // huge pages of it can fill up. This is only a hint and failures are
+    // ignored.
+    USE(page_allocator->AdviseHugePages(reinterpret_cast<void*>(aligned_base),
+                                        size));
+  }
+
   code_reservation_ = std::move(reservation);
   code_page_allocator_instance_ = std::make_unique<base::BoundedPageAllocator>(
       page_allocator, aligned_base, size,
@@ -349,6 +406,15 @@ Address MemoryAllocator::AllocateAlignedMemory(
   Address base = reservation.address();
   size_ += reservation.size();
 
+  const int numa_node = isolate_->heap()->numa_node();
+  if (numa_node >= 0) {
+    // Bind before committing so that pages are faulted in on the given node.
+    // Pooled pages keep this binding when they are reused. This is only a
+    // hint and failures are ignored.
+    USE(page_allocator->BindToNumaNode(reinterpret_cast<void*>(base),
+                                       reservation.size(), numa_node));
+  }
+
   if (executable == EXECUTABLE) {
     if (!CommitExecutableMemory(&reservation, base, commit_size,
                                 reserve_size)) {
@@ -603,6 +669,18 @@ void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
   VirtualMemory* reservation = chunk->reserved_memory();
   if (chunk->IsFlagSet(MemoryChunk::POOLED)) {
     UncommitMemory(reservation);
+  } else if (chunk->size() == static_cast<size_t>(MemoryChunk::kPageSize) &&
+             chunk->executable() == NOT_EXECUTABLE && !chunk->IsLargePage() &&
+             UseSharedPagePool()) {
+    DCHECK(reservation->IsReserved());
+    // The reservation is embedded in the chunk and must not be accessed
+    // after uncommitting it.
+    const Address address = chunk->address();
+    if (!UncommitMemory(reservation) ||
+        !shared_page_pool()->TryAdd(address)) {
+      FreeMemory(data_page_allocator(), address,
+                 static_cast<size_t>(MemoryChunk::kPageSize));
+    }
   } else {
     DCHECK(reservation->IsReserved());
     reservation->Free();
@@ -619,8 +697,11 @@ void MemoryAllocator::Free(MemoryChunk* chunk) {
     case kAlreadyPooled:
       // Pooled pages cannot be touched anymore as their memory is uncommitted.
       // Pooled pages are not-executable.
-      FreeMemory(data_page_allocator(), chunk->address(),
-                 static_cast<size_t>(MemoryChunk::kPageSize));
+      if (!UseSharedPagePool() ||
+          !shared_page_pool()->TryAdd(chunk->address())) {
+        FreeMemory(data_page_allocator(), chunk->address(),
+                   static_cast<size_t>(MemoryChunk::kPageSize));
+      }
       break;
     case kPooledAndQueue:
       DCHECK_EQ(chunk->size(), static_cast<size_t>(MemoryChunk::kPageSize));
@@ -657,6 +738,12 @@ Page* MemoryAllocator::AllocatePage(size_t size, SpaceType* owner,
                             owner->identity())));
     DCHECK_EQ(executable, NOT_EXECUTABLE);
     chunk = AllocatePagePooled(owner);
+  } else if (executable == NOT_EXECUTABLE &&
+             owner->identity() != CODE_SPACE && UseSharedPagePool() &&
+             size == MemoryChunkLayout::AllocatableMemoryInMemoryChunk(
+                         owner->identity())) {
+    // Regular data pages can be taken from pages that other heaps pooled.
+    chunk = AllocatePagePooled(owner);
   }
   if (chunk == nullptr) {
     chunk = AllocateChunk(size, size, executable, owner);
@@ -696,6 +783,12 @@ LargePage* MemoryAllocator::AllocateLargePage(size_t size,
                                               Executability executable) {
   MemoryChunk* chunk = AllocateChunk(size, size, executable, owner);
   if (chunk == nullptr) return nullptr;
+  if (FLAG_huge_large_object_pages) {
+    VirtualMemory* reservation = chunk->reserved_memory();
+    USE(page_allocator(executable)
+            ->AdviseHugePages(reinterpret_cast<void*>(reservation->address()),
+                              reservation->size()));
+  }
   return LargePage::Initialize(isolate_->heap(), chunk, executable);
 }
 
@@ -732,6 +825,18 @@ void MemoryAllocator::ZapBlock(Address start, size_t size,
                size >> kTaggedSizeLog2);
 }
 
+// static
+SharedPagePool* MemoryAllocator::shared_page_pool() {
+  return process_wide_page_pool.Pointer();
+}
+
+bool MemoryAllocator::UseSharedPagePool() {
+  // Pages bound to a NUMA node are not shared with other heaps.
+  return FLAG_shared_page_pool_size > 0 &&
+         data_page_allocator_ == GetPlatformPageAllocator() &&
+         isolate_->heap()->numa_node() < 0;
+}
+
 intptr_t MemoryAllocator::GetCommitPageSize() {
   if (FLAG_v8_os_page_size != 0) {
     DCHECK(base::bits::IsPowerOfTwo(FLAG_v8_os_page_size));
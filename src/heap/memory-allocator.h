@@ -51,6 +51,31 @@ class CodeRangeAddressHint {
   std::unordered_map<size_t, std::vector<Address>> recently_freed_;
 };
 
+// The process-wide pool of uncommitted pages of MemoryChunk::kPageSize that
+// were freed by one heap and can be reused by any heap in the process, e.g.,
+// when short-lived isolates are created and disposed at high rates. Only pages
+// that are allocated by the platform page allocator are pooled. Heaps inside
+// of a pointer-compression cage instead reuse whole cage reservations, see
+// IsolateAllocator. The size of the pool is bounded by
+// --shared-page-pool-size.
+class SharedPagePool {
+ public:
+  // Adds an uncommitted page. Returns false if the pool is full.
+  V8_EXPORT_PRIVATE bool TryAdd(Address page);
+
+  // Returns an uncommitted page or kNullAddress if the pool is empty.
+  V8_EXPORT_PRIVATE Address TryGet();
+
+  // Frees all pooled pages.
+  V8_EXPORT_PRIVATE void ReleaseAll();
+
+  V8_EXPORT_PRIVATE size_t NumberOfPages();
+
+ private:
+  base::Mutex mutex_;
+  std::vector<Address> pages_;
+};
+
 // ----------------------------------------------------------------------------
 // A space acquires chunks of memory from the operating system. The memory
 // allocator allocates and deallocates pages for the paged heap spaces and large
@@ -87,6 +112,7 @@ class MemoryAllocator {
       // been uncommitted.
       // (2) Try to steal any memory chunk of kPageSize that would've been
       // unmapped.
+      // (3) Try to get an uncommitted chunk from the process-wide pool.
       MemoryChunk* chunk = GetMemoryChunkSafe<kPooled>();
       if (chunk == nullptr) {
         chunk = GetMemoryChunkSafe<kRegular>();
@@ -95,6 +121,10 @@ class MemoryAllocator {
           chunk->ReleaseAllAllocatedMemory();
         }
       }
+      if (chunk == nullptr && allocator_->UseSharedPagePool()) {
+        chunk = reinterpret_cast<MemoryChunk*>(
+            MemoryAllocator::shared_page_pool()->TryGet());
+      }
       return chunk;
     }
 
@@ -172,6 +202,8 @@ class MemoryAllocator {
 
   V8_EXPORT_PRIVATE static intptr_t GetCommitPageSize();
 
+  V8_EXPORT_PRIVATE static SharedPagePool* shared_page_pool();
+
   // Computes the memory area of discardable memory within a given memory area
   // [addr, addr+size) and returns the result as base::AddressRegion. If the
   // memory is not discardable base::AddressRegion is an empty region.
@@ -183,6 +215,10 @@ class MemoryAllocator {
 
   V8_EXPORT_PRIVATE void TearDown();
 
+  // Returns true if freed regular pages are handed over to the process-wide
+  // SharedPagePool and pages are also allocated from there.
+  bool UseSharedPagePool();
+
   // Allocates a Page from the allocator. AllocationMode is used to indicate
   // whether pooled allocation, which only works for MemoryChunk::kPageSize,
   // should be tried first.
@@ -24,6 +24,7 @@ namespace internal {
 class CodeObjectRegistry;
 class FreeListCategory;
 class LocalArrayBufferTracker;
+class ObjectStartBitmap;
 
 // MemoryChunk represents a memory region owned by a specific space.
 // It is divided into the header and the body. Chunk start is always
@@ -161,6 +162,13 @@ class MemoryChunk : public BasicMemoryChunk {
   void AllocateYoungGenerationBitmap();
   void ReleaseYoungGenerationBitmap();
 
+  void AllocateObjectStartBitmap();
+  void ReleaseObjectStartBitmap();
+  // Only present on pages of paged spaces with --object-start-bitmap.
+  ObjectStartBitmap* object_start_bitmap() const {
+    return reinterpret_cast<ObjectStartBitmap*>(object_start_bitmap_);
+  }
+
   int FreeListsLength();
 
   // Approximate amount of physical memory committed for this chunk.
@@ -306,6 +314,8 @@ class MemoryChunk : public BasicMemoryChunk {
 
   PossiblyEmptyBuckets possibly_empty_buckets_;
 
+  Bitmap* object_start_bitmap_;
+
  private:
   friend class ConcurrentMarkingState;
   friend class MajorMarkingState;
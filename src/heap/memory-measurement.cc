@@ -196,8 +196,19 @@ bool MemoryMeasurement::EnqueueRequest(
 }
 
 std::vector<Address> MemoryMeasurement::StartProcessing() {
-  if (received_.empty()) return {};
   std::unordered_set<Address> unique_contexts;
+  if (!tracked_contexts_.is_null()) {
+    for (int i = 0; i < tracked_contexts_->length(); i++) {
+      HeapObject context;
+      if (tracked_contexts_->Get(i).GetHeapObjectIfWeak(&context)) {
+        unique_contexts.insert(context.ptr());
+      }
+    }
+  }
+  if (received_.empty()) {
+    return std::vector<Address>(unique_contexts.begin(),
+                                unique_contexts.end());
+  }
   DCHECK(processing_.empty());
   processing_ = std::move(received_);
   for (const auto& request : processing_) {
@@ -213,6 +224,13 @@ std::vector<Address> MemoryMeasurement::StartProcessing() {
 }
 
 void MemoryMeasurement::FinishProcessing(const NativeContextStats& stats) {
+  if (!tracked_contexts_.is_null()) {
+    for (int i = 0; i < tracked_contexts_->length(); i++) {
+      HeapObject context;
+      bool alive = tracked_contexts_->Get(i).GetHeapObjectIfWeak(&context);
+      tracked_sizes_[i] = alive ? stats.Get(context.ptr()) : 0;
+    }
+  }
   if (processing_.empty()) return;
 
   while (!processing_.empty()) {
@@ -231,6 +249,36 @@ void MemoryMeasurement::FinishProcessing(const NativeContextStats& stats) {
   ScheduleReportingTask();
 }
 
+size_t MemoryMeasurement::GetTrackedContextSize(
+    Handle<NativeContext> context) {
+  int free_slot = -1;
+  int length = tracked_contexts_.is_null() ? 0 : tracked_contexts_->length();
+  for (int i = 0; i < length; i++) {
+    HeapObject current;
+    if (!tracked_contexts_->Get(i).GetHeapObjectIfWeak(&current)) {
+      if (free_slot == -1) free_slot = i;
+    } else if (current == *context) {
+      return tracked_sizes_[i];
+    }
+  }
+  if (free_slot == -1) {
+    Handle<WeakFixedArray> contexts =
+        isolate_->factory()->NewWeakFixedArray(Max(4, 2 * length));
+    for (int i = 0; i < length; i++) {
+      contexts->Set(i, tracked_contexts_->Get(i));
+    }
+    if (!tracked_contexts_.is_null()) {
+      GlobalHandles::Destroy(tracked_contexts_.location());
+    }
+    tracked_contexts_ = isolate_->global_handles()->Create(*contexts);
+    tracked_sizes_.resize(contexts->length(), 0);
+    free_slot = length;
+  }
+  tracked_contexts_->Set(free_slot, HeapObjectReference::Weak(*context));
+  tracked_sizes_[free_slot] = 0;
+  return 0;
+}
+
 void MemoryMeasurement::ScheduleReportingTask() {
   if (reporting_task_pending_) return;
   reporting_task_pending_ = true;
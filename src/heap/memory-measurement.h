@@ -31,6 +31,11 @@ class MemoryMeasurement {
   std::vector<Address> StartProcessing();
   void FinishProcessing(const NativeContextStats& stats);
 
+  // Starts attributing memory to the given context in every full GC, if that
+  // is not done yet. Returns the size attributed to the context by the last
+  // full GC since tracking started, or 0.
+  size_t GetTrackedContextSize(Handle<NativeContext> context);
+
   static std::unique_ptr<v8::MeasureMemoryDelegate> DefaultDelegate(
       Isolate* isolate, Handle<NativeContext> context,
       Handle<JSPromise> promise, v8::MeasureMemoryMode mode);
@@ -55,6 +60,10 @@ class MemoryMeasurement {
   std::list<Request> received_;
   std::list<Request> processing_;
   std::list<Request> done_;
+  // Contexts passed to GetTrackedContextSize() and their sizes as of the last
+  // full GC. Cleared slots are reused for new contexts.
+  Handle<WeakFixedArray> tracked_contexts_;
+  std::vector<size_t> tracked_sizes_;
   Isolate* isolate_;
   bool reporting_task_pending_ = false;
   bool delayed_gc_task_pending_ = false;
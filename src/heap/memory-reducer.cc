@@ -54,8 +54,11 @@ void MemoryReducer::TimerTask::RunInternal() {
   // The memory reducer will start incremental markig if
   // 1) mutator is likely idle: js call rate is low and allocation rate is low.
   // 2) mutator is in background: optimize for memory flag is set.
+  // The GC is postponed while the last mark-compact already missed the
+  // embedder's mutator utilization target.
   event.should_start_incremental_gc =
-      low_allocation_rate || optimize_for_memory;
+      (low_allocation_rate || optimize_for_memory) &&
+      !heap->IsBelowMutatorUtilizationTarget();
   event.can_start_incremental_gc =
       heap->incremental_marking()->IsStopped() &&
       (heap->incremental_marking()->CanBeActivated() || optimize_for_memory);
@@ -85,8 +88,11 @@ void MemoryReducer::NotifyTimer(const Event& event) {
       // higher priority than latency. This is important for background tabs
       // that do not send idle notifications.
       const int kIncrementalMarkingDelayMs = 500;
-      double deadline = heap()->MonotonicallyIncreasingTimeInMs() +
-                        kIncrementalMarkingDelayMs;
+      double delay_ms = kIncrementalMarkingDelayMs;
+      if (heap()->gc_pause_budget_ms() > 0) {
+        delay_ms = Min(delay_ms, heap()->gc_pause_budget_ms());
+      }
+      double deadline = heap()->MonotonicallyIncreasingTimeInMs() + delay_ms;
       heap()->incremental_marking()->AdvanceWithDeadline(
           deadline, IncrementalMarking::NO_GC_VIA_STACK_GUARD,
           StepOrigin::kTask);
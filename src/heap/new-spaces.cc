@@ -423,6 +423,33 @@ void NewSpace::Grow() {
   size_t new_capacity =
       Min(MaximumCapacity(),
           static_cast<size_t>(FLAG_semi_space_growth_factor) * TotalCapacity());
+  GrowTo(new_capacity);
+}
+
+void NewSpace::Shrink() {
+  size_t new_capacity = Max(InitialTotalCapacity(), 2 * Size());
+  size_t rounded_new_capacity = ::RoundUp(new_capacity, Page::kPageSize);
+  if (rounded_new_capacity < TotalCapacity()) {
+    ShrinkTo(rounded_new_capacity);
+  }
+}
+
+void NewSpace::Resize(size_t new_capacity) {
+  DCHECK_EQ(new_capacity & kPageAlignmentMask, 0u);
+  DCHECK_GE(new_capacity, InitialTotalCapacity());
+  DCHECK_LE(new_capacity, MaximumCapacity());
+  if (new_capacity > TotalCapacity()) {
+    GrowTo(new_capacity);
+  } else if (new_capacity < TotalCapacity()) {
+    // Never shrink below what is needed to hold the currently live objects.
+    const size_t min_capacity =
+        ::RoundUp(Max(InitialTotalCapacity(), 2 * Size()), Page::kPageSize);
+    if (new_capacity < min_capacity) new_capacity = min_capacity;
+    if (new_capacity < TotalCapacity()) ShrinkTo(new_capacity);
+  }
+}
+
+void NewSpace::GrowTo(size_t new_capacity) {
   if (to_space_.GrowTo(new_capacity)) {
     // Only grow from space if we managed to grow to-space.
     if (!from_space_.GrowTo(new_capacity)) {
@@ -438,14 +465,11 @@ void NewSpace::Grow() {
   DCHECK_SEMISPACE_ALLOCATION_INFO(allocation_info_, to_space_);
 }
 
-void NewSpace::Shrink() {
-  size_t new_capacity = Max(InitialTotalCapacity(), 2 * Size());
-  size_t rounded_new_capacity = ::RoundUp(new_capacity, Page::kPageSize);
-  if (rounded_new_capacity < TotalCapacity() &&
-      to_space_.ShrinkTo(rounded_new_capacity)) {
+void NewSpace::ShrinkTo(size_t new_capacity) {
+  if (to_space_.ShrinkTo(new_capacity)) {
     // Only shrink from-space if we managed to shrink to-space.
     from_space_.Reset();
-    if (!from_space_.ShrinkTo(rounded_new_capacity)) {
+    if (!from_space_.ShrinkTo(new_capacity)) {
       // If we managed to shrink to-space but couldn't shrink from
       // space, attempt to grow to-space again.
       if (!to_space_.GrowTo(from_space_.current_capacity())) {
@@ -258,6 +258,10 @@ class V8_EXPORT_PRIVATE NewSpace
   // Shrink the capacity of the semispaces.
   void Shrink();
 
+  // Grow or shrink the capacity of the semispaces to |new_capacity|. Shrinking
+  // never goes below what is needed for the currently allocated objects.
+  void Resize(size_t new_capacity);
+
   // Return the allocated bytes in the active semispace.
   size_t Size() final {
     DCHECK_GE(top(), to_space_.page_low());
@@ -463,6 +467,11 @@ class V8_EXPORT_PRIVATE NewSpace
   // Update linear allocation area to match the current to-space page.
   void UpdateLinearAllocationArea();
 
+  // Change the capacity of both semispaces to the page aligned
+  // |new_capacity|.
+  void GrowTo(size_t new_capacity);
+  void ShrinkTo(size_t new_capacity);
+
   base::Mutex mutex_;
 
   // The top and the limit at the time of setting the linear allocation area.
@@ -0,0 +1,73 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_OBJECT_START_BITMAP_H_
+#define V8_HEAP_OBJECT_START_BITMAP_H_
+
+#include "src/base/bits.h"
+#include "src/heap/basic-memory-chunk.h"
+#include "src/heap/marking.h"
+
+namespace v8 {
+namespace internal {
+
+// Bitmap recording object start addresses on a page of a paged space, with one
+// bit per tagged word like the marking bitmap. The bitmap is only a hint: every
+// set bit is the start of an object or filler, but not every object start is
+// recorded. Objects allocated in a linear allocation area are only found by
+// walking forward from the start of that area, which is always recorded.
+//
+// The bitmap is rebuilt by the sweeper and updated by the allocator when a
+// free-list block is handed out as a linear allocation area. All updates are
+// atomic as background threads may allocate on the same page.
+class ObjectStartBitmap : public ConcurrentBitmap<AccessMode::ATOMIC> {
+ public:
+  void SetObjectStart(const BasicMemoryChunk* chunk, Address address) {
+    const uint32_t index = chunk->AddressToMarkbitIndex(address);
+    SetBitsInCell(IndexToCell(index), 1u << IndexInCell(index));
+  }
+
+  // Forgets all object starts in [start, end).
+  void ClearObjectStarts(const BasicMemoryChunk* chunk, Address start,
+                         Address end) {
+    ClearRange(chunk->AddressToMarkbitIndex(start),
+               chunk->AddressToMarkbitIndex(end));
+  }
+
+  bool IsObjectStart(const BasicMemoryChunk* chunk, Address address) {
+    const uint32_t index = chunk->AddressToMarkbitIndex(address);
+    return (base::AsAtomic32::Acquire_Load(cells() + IndexToCell(index)) &
+            (1u << IndexInCell(index))) != 0;
+  }
+
+  // Returns the closest recorded object start at or below {address}, or
+  // kNullAddress if there is none.
+  inline Address FindPreviousObjectStart(const BasicMemoryChunk* chunk,
+                                         Address address);
+};
+
+Address ObjectStartBitmap::FindPreviousObjectStart(
+    const BasicMemoryChunk* chunk, Address address) {
+  const uint32_t index = chunk->AddressToMarkbitIndex(address);
+  uint32_t cell_index = IndexToCell(index);
+  const uint32_t bit = IndexInCell(index);
+  // Keep the bits up to and including {bit}.
+  const MarkBit::CellType mask =
+      bit == kBitIndexMask ? ~0u : (1u << (bit + 1)) - 1;
+  MarkBit::CellType cell =
+      base::AsAtomic32::Acquire_Load(cells() + cell_index) & mask;
+  while (cell == 0) {
+    if (cell_index == 0) return kNullAddress;
+    cell = base::AsAtomic32::Acquire_Load(cells() + --cell_index);
+  }
+  const uint32_t highest_bit =
+      kBitIndexMask - base::bits::CountLeadingZeros32(cell);
+  return chunk->MarkbitIndexToAddress((cell_index << kBitsPerCellLog2) +
+                                      highest_bit);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_OBJECT_START_BITMAP_H_
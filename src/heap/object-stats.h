@@ -66,6 +66,7 @@
   V(PROTOTYPE_PROPERTY_ARRAY_TYPE)               \
   V(PROTOTYPE_PROPERTY_DICTIONARY_TYPE)          \
   V(PROTOTYPE_USERS_TYPE)                        \
+  V(REGEXP_EXEC_CACHE_TYPE)                      \
   V(REGEXP_MULTIPLE_CACHE_TYPE)                  \
   V(RELOC_INFO_TYPE)                             \
   V(RETAINED_MAPS_TYPE)                          \
@@ -10,6 +10,7 @@
 #include "src/heap/paged-spaces-inl.h"
 #include "src/heap/spaces-inl.h"
 #include "src/objects/objects-body-descriptors-inl.h"
+#include "src/objects/string-table.h"
 #include "src/roots/roots.h"
 #include "src/snapshot/references.h"
 
@@ -156,6 +157,9 @@ void OffThreadHeap::Publish(Heap* heap) {
   // one go (DeferredHandles maybe?).
   std::vector<std::pair<Handle<HeapObject>, Handle<Map>>> heap_object_handles;
   std::vector<Handle<Script>> script_handles;
+  // Number of distinct strings to internalize. Several slots can point to the
+  // same string, which is only still internalized for the first of them.
+  int string_count = 0;
   {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
                  "V8.OffThreadFinalization.Publish.CollectHandles");
@@ -170,6 +174,8 @@ void OffThreadHeap::Publish(Heap* heap) {
       // De-internalize the string so that we can re-internalize it later.
       String string =
           String::cast(RELAXED_READ_FIELD(obj, relative_slot.slot_offset));
+      if (!string.IsInternalizedString()) continue;
+      string_count++;
       bool one_byte = string.IsOneByteRepresentation();
       Map map = one_byte ? roots.one_byte_string_map() : roots.string_map();
       string.set_map_no_write_barrier(map);
@@ -197,6 +203,15 @@ void OffThreadHeap::Publish(Heap* heap) {
                          GarbageCollectionReason::kAllocationFailure);
   }
 
+  // Grow the string table once up front rather than repeatedly while
+  // internalizing, so that the loop below only does lookups and in-place
+  // insertions.
+  {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.OffThreadFinalization.Publish.EnsureStringTableCapacity");
+    StringTable::EnsureCapacityForBulkInsert(isolate, string_count);
+  }
+
   // Iterate the string slots, as an offset from the holders we have handles to.
   {
     TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
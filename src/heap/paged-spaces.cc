@@ -14,6 +14,7 @@
 #include "src/heap/incremental-marking.h"
 #include "src/heap/memory-allocator.h"
 #include "src/heap/memory-chunk-inl.h"
+#include "src/heap/object-start-bitmap.h"
 #include "src/heap/paged-spaces-inl.h"
 #include "src/heap/read-only-heap.h"
 #include "src/logging/counters.h"
@@ -23,6 +24,20 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Memory handed out for allocation may still contain object starts of objects
+// that died. Forget them and record the start of the new linear allocation
+// area, from which the objects allocated in it can be found.
+void ResetObjectStartsForAllocation(Page* page, Address start, Address end) {
+  ObjectStartBitmap* object_starts = page->object_start_bitmap();
+  if (object_starts == nullptr) return;
+  object_starts->ClearObjectStarts(page, start, end);
+  object_starts->SetObjectStart(page, start);
+}
+
+}  // namespace
+
 // ----------------------------------------------------------------------------
 // PagedSpaceObjectIterator
 
@@ -85,6 +100,9 @@ Page* PagedSpace::InitializePage(MemoryChunk* chunk) {
                                   heap()->incremental_marking()->IsMarking());
   page->AllocateFreeListCategories();
   page->InitializeFreeListCategories();
+  if (FLAG_object_start_bitmap && page->object_start_bitmap() == nullptr) {
+    page->AllocateObjectStartBitmap();
+  }
   page->list_node().Initialize();
   page->InitializationMemoryFence();
   return page;
@@ -121,6 +139,12 @@ void PagedSpace::RefillFreeList() {
   MarkCompactCollector* collector = heap()->mark_compact_collector();
   size_t added = 0;
 
+  // Code pages swept by background tasks only become available once the main
+  // thread has freed their memory.
+  if (identity() == CODE_SPACE && !is_local_space()) {
+    collector->sweeper()->FinalizeSweptCodePages();
+  }
+
   {
     Page* p = nullptr;
     while ((p = collector->sweeper()->GetSweptPageSafe(this)) != nullptr) {
@@ -243,6 +267,40 @@ size_t PagedSpace::CommittedPhysicalMemory() {
   return size;
 }
 
+HeapObject PagedSpace::FindObjectContaining(Address address) {
+  DCHECK(Contains(address));
+  Page* page = Page::FromAddress(address);
+  if (address < page->area_start() || address >= page->area_end()) {
+    return HeapObject();
+  }
+
+  // A concurrent sweeper task holds the page lock while sweeping the page and
+  // rebuilding its object start bitmap.
+  base::Optional<base::MutexGuard> guard;
+  if (!page->SweepingDone()) guard.emplace(page->mutex());
+
+  Address current = kNullAddress;
+  if (ObjectStartBitmap* object_starts = page->object_start_bitmap()) {
+    current = object_starts->FindPreviousObjectStart(page, address);
+  }
+  if (current == kNullAddress) current = page->area_start();
+  DCHECK_LE(current, address);
+
+  while (current < page->area_end()) {
+    // The unused part of the linear allocation area is not iterable.
+    if (current == top() && current != limit()) {
+      if (address < limit()) return HeapObject();
+      current = limit();
+      continue;
+    }
+    HeapObject object = HeapObject::FromAddress(current);
+    const Address next = current + object.Size();
+    if (address < next) return object;
+    current = next;
+  }
+  UNREACHABLE();
+}
+
 bool PagedSpace::ContainsSlow(Address addr) const {
   Page* p = Page::FromAddress(addr);
   for (const Page* page : *this) {
@@ -556,6 +614,7 @@ bool PagedSpace::TryAllocationFromFreeListMain(size_t size_in_bytes,
   DCHECK_EQ(allocation_info_.start(), allocation_info_.top());
   Address start = new_node.address();
   Address end = new_node.address() + new_node_size;
+  ResetObjectStartsForAllocation(page, start, end);
   Address limit = ComputeLimit(start, end, size_in_bytes);
   DCHECK_LE(limit, end);
   DCHECK_LE(size_in_bytes, limit - start);
@@ -677,6 +736,7 @@ PagedSpace::TryAllocationFromFreeListBackground(LocalHeap* local_heap,
 
   Address start = new_node.address();
   Address end = new_node.address() + new_node_size;
+  ResetObjectStartsForAllocation(page, start, end);
   Address limit = new_node.address() + used_size_in_bytes;
   DCHECK_LE(limit, end);
   DCHECK_LE(min_size_in_bytes, limit - start);
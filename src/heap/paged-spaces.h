@@ -86,6 +86,13 @@ class V8_EXPORT_PRIVATE PagedSpace
   inline bool Contains(Object o) const;
   bool ContainsSlow(Address addr) const;
 
+  // Returns the object (or filler) that contains {address}, or an empty object
+  // if {address} points into the page header or the unused part of the linear
+  // allocation area. Uses the page's object start bitmap if present and walks
+  // the page from its beginning otherwise. Linear allocation areas of
+  // background threads have to be made iterable by the caller.
+  V8_EXPORT_PRIVATE HeapObject FindObjectContaining(Address address);
+
   // Does the space need executable memory?
   Executability executable() { return executable_; }
 
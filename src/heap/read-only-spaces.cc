@@ -387,6 +387,18 @@ void ReadOnlySpace::Seal(SealMode ro_mode) {
   }
 
   SetPermissionsForPages(memory_allocator, PageAllocator::kRead);
+
+  if (FLAG_mergeable_read_only_space) {
+    // Processes deserializing the same snapshot end up with largely identical
+    // read-only pages, which the kernel can then back by a single copy. This
+    // is only a hint and failures are ignored.
+    v8::PageAllocator* page_allocator =
+        memory_allocator->page_allocator(NOT_EXECUTABLE);
+    for (BasicMemoryChunk* chunk : pages_) {
+      USE(page_allocator->MarkMergeable(
+          reinterpret_cast<void*>(chunk->address()), chunk->size()));
+    }
+  }
 }
 
 void ReadOnlySpace::Unseal() {
@@ -195,6 +195,19 @@ class RememberedSet : public AllStatic {
     return slots;
   }
 
+  // Sums up the number of untyped slots and the memory used for storing them
+  // over all old generation chunks.
+  static void CollectStatistics(Heap* heap, size_t* slots, size_t* bytes) {
+    *slots = 0;
+    *bytes = 0;
+    IterateMemoryChunks(heap, [slots, bytes](MemoryChunk* chunk) {
+      SlotSet* slot_set = chunk->slot_set<type>();
+      if (slot_set == nullptr) return;
+      *slots += slot_set->CountSlots(chunk->buckets());
+      *bytes += slot_set->MemoryUsage(chunk->buckets());
+    });
+  }
+
   static void FreeEmptyBuckets(MemoryChunk* chunk) {
     DCHECK(type == OLD_TO_NEW);
     SlotSet* slot_set = chunk->slot_set<type>();
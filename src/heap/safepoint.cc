@@ -33,25 +33,21 @@ void GlobalSafepoint::EnterSafepointScope() {
 
   barrier_.Arm();
 
+  // Only threads that are running need to stop, parked threads can't unpark
+  // while a safepoint is requested.
+  int running = 0;
   for (LocalHeap* current = local_heaps_head_; current;
        current = current->next_) {
     if (current == local_heap_of_this_thread_) {
       continue;
     }
-    current->RequestSafepoint();
+    uint8_t old_state =
+        current->state_.fetch_or(LocalHeap::kSafepointRequested);
+    DCHECK_EQ(0, old_state & LocalHeap::kSafepointRequested);
+    if ((old_state & LocalHeap::kParked) == 0) running++;
   }
 
-  for (LocalHeap* current = local_heaps_head_; current;
-       current = current->next_) {
-    if (current == local_heap_of_this_thread_) {
-      continue;
-    }
-    current->state_mutex_.Lock();
-
-    while (current->state_ == LocalHeap::ThreadState::Running) {
-      current->state_change_.Wait(&current->state_mutex_);
-    }
-  }
+  barrier_.WaitUntilRunningThreadsInSafepoint(running);
 }
 
 void GlobalSafepoint::LeaveSafepointScope() {
@@ -67,7 +63,8 @@ void GlobalSafepoint::LeaveSafepointScope() {
     if (current == local_heap_of_this_thread_) {
       continue;
     }
-    current->state_mutex_.Unlock();
+    current->state_.fetch_and(
+        static_cast<uint8_t>(~LocalHeap::kSafepointRequested));
   }
 
   barrier_.Disarm();
@@ -76,39 +73,54 @@ void GlobalSafepoint::LeaveSafepointScope() {
   local_heaps_mutex_.Unlock();
 }
 
-void GlobalSafepoint::EnterFromThread(LocalHeap* local_heap) {
-  {
-    base::MutexGuard guard(&local_heap->state_mutex_);
-    DCHECK_EQ(local_heap->state_, LocalHeap::ThreadState::Running);
-    local_heap->state_ = LocalHeap::ThreadState::Safepoint;
-    local_heap->state_change_.NotifyAll();
-  }
-
-  barrier_.Wait();
-
-  {
-    base::MutexGuard guard(&local_heap->state_mutex_);
-    local_heap->state_ = LocalHeap::ThreadState::Running;
-  }
-}
-
 void GlobalSafepoint::Barrier::Arm() {
   base::MutexGuard guard(&mutex_);
   CHECK(!armed_);
   armed_ = true;
+  stopped_ = 0;
 }
 
 void GlobalSafepoint::Barrier::Disarm() {
   base::MutexGuard guard(&mutex_);
   CHECK(armed_);
   armed_ = false;
-  cond_.NotifyAll();
+  stopped_ = 0;
+  epoch_++;
+  cv_resume_.NotifyAll();
+}
+
+void GlobalSafepoint::Barrier::WaitUntilRunningThreadsInSafepoint(
+    int running) {
+  base::MutexGuard guard(&mutex_);
+  CHECK(armed_);
+  while (stopped_ < running) {
+    cv_stopped_.Wait(&mutex_);
+  }
+  DCHECK_EQ(stopped_, running);
+}
+
+void GlobalSafepoint::Barrier::WaitInSafepoint() {
+  base::MutexGuard guard(&mutex_);
+  CHECK(armed_);
+  const uint64_t epoch = epoch_;
+  stopped_++;
+  cv_stopped_.NotifyOne();
+  while (epoch_ == epoch) {
+    cv_resume_.Wait(&mutex_);
+  }
+}
+
+void GlobalSafepoint::Barrier::NotifyPark() {
+  base::MutexGuard guard(&mutex_);
+  CHECK(armed_);
+  stopped_++;
+  cv_stopped_.NotifyOne();
 }
 
-void GlobalSafepoint::Barrier::Wait() {
+void GlobalSafepoint::Barrier::WaitInUnpark() {
   base::MutexGuard guard(&mutex_);
   while (armed_) {
-    cond_.Wait(&mutex_);
+    cv_resume_.Wait(&mutex_);
   }
 }
 
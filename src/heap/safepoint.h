@@ -24,9 +24,6 @@ class GlobalSafepoint {
  public:
   explicit GlobalSafepoint(Heap* heap);
 
-  // Enter the safepoint from a thread
-  void EnterFromThread(LocalHeap* local_heap);
-
   V8_EXPORT_PRIVATE bool ContainsLocalHeap(LocalHeap* local_heap);
   V8_EXPORT_PRIVATE bool ContainsAnyLocalHeap();
 
@@ -50,19 +47,38 @@ class GlobalSafepoint {
   bool IsActive() { return active_safepoint_scopes_ > 0; }
 
  private:
+  // Counts the running threads that stopped while the barrier is armed, and
+  // blocks them until it is disarmed. Every disarm starts a new epoch, so that
+  // a stopped thread resumes even if the barrier is armed again before it
+  // wakes up.
   class Barrier {
     base::Mutex mutex_;
-    base::ConditionVariable cond_;
+    base::ConditionVariable cv_resume_;
+    base::ConditionVariable cv_stopped_;
     bool armed_;
+    int stopped_;
+    uint64_t epoch_;
 
    public:
-    Barrier() : armed_(false) {}
+    Barrier() : armed_(false), stopped_(0), epoch_(0) {}
 
     void Arm();
     void Disarm();
-    void Wait();
+    // Waits on the main thread until |running| threads have stopped.
+    void WaitUntilRunningThreadsInSafepoint(int running);
+    // Stops a running thread until the barrier is disarmed.
+    void WaitInSafepoint();
+    // Counts a running thread that parked as stopped.
+    void NotifyPark();
+    // Blocks a parked thread that wants to unpark until the barrier is
+    // disarmed.
+    void WaitInUnpark();
   };
 
+  void WaitInSafepoint() { barrier_.WaitInSafepoint(); }
+  void NotifyPark() { barrier_.NotifyPark(); }
+  void WaitInUnpark() { barrier_.WaitInUnpark(); }
+
   void EnterSafepointScope();
   void LeaveSafepointScope();
 
@@ -7,6 +7,7 @@
 #include "src/base/platform/time.h"
 #include "src/execution/isolate.h"
 #include "src/execution/vm-state-inl.h"
+#include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
 #include "src/init/v8.h"
@@ -30,7 +31,21 @@ class ScavengeJob::Task : public CancelableTask {
 };
 
 size_t ScavengeJob::YoungGenerationTaskTriggerSize(Heap* heap) {
-  return heap->new_space()->Capacity() * FLAG_scavenge_task_trigger / 100;
+  size_t trigger =
+      heap->new_space()->Capacity() * FLAG_scavenge_task_trigger / 100;
+  const double budget_ms = heap->gc_pause_budget_ms();
+  if (budget_ms > 0 && heap->tracer()->SurvivalEventsRecorded()) {
+    // Scavenge from a task before the young generation holds more surviving
+    // objects than can be copied within the embedder's pause budget.
+    const double survival_ratio = heap->tracer()->AverageSurvivalRatio() / 100;
+    const double speed =
+        heap->tracer()->ScavengeSpeedInBytesPerMillisecond(kForSurvivedObjects);
+    if (survival_ratio > 0 && speed > 0) {
+      const double budget_bytes = budget_ms * speed / survival_ratio;
+      if (budget_bytes < trigger) trigger = static_cast<size_t>(budget_bytes);
+    }
+  }
+  return trigger;
 }
 
 bool ScavengeJob::YoungGenerationSizeTaskTriggerReached(Heap* heap) {
@@ -46,6 +46,10 @@ bool Scavenger::PromotionList::View::ShouldEagerlyProcessPromotionList() {
   return promotion_list_->ShouldEagerlyProcessPromotionList(task_id_);
 }
 
+size_t Scavenger::PromotionList::View::StealCount() {
+  return promotion_list_->StealCount(task_id_);
+}
+
 void Scavenger::PromotionList::PushRegularObject(int task_id, HeapObject object,
                                                  int size) {
   regular_object_promotion_list_.Push(task_id, ObjectAndSize(object, size));
@@ -83,6 +87,11 @@ bool Scavenger::PromotionList::IsGlobalPoolEmpty() {
          large_object_promotion_list_.IsGlobalPoolEmpty();
 }
 
+size_t Scavenger::PromotionList::StealCount(int task_id) {
+  return regular_object_promotion_list_.StealCount(task_id) +
+         large_object_promotion_list_.StealCount(task_id);
+}
+
 bool Scavenger::PromotionList::ShouldEagerlyProcessPromotionList(int task_id) {
   // Threshold when to prioritize processing of the promotion list. Right
   // now we only look into the regular object list.
@@ -75,9 +75,11 @@ class ScavengingTask final : public ItemParallelJob::Task {
     }
     if (FLAG_trace_parallel_scavenge) {
       PrintIsolate(heap_->isolate(),
-                   "scavenge[%p]: time=%.2f copied=%zu promoted=%zu\n",
+                   "scavenge[%p]: time=%.2f copied=%zu promoted=%zu "
+                   "stolen_segments=%zu\n",
                    static_cast<void*>(this), scavenging_time,
-                   scavenger_->bytes_copied(), scavenger_->bytes_promoted());
+                   scavenger_->bytes_copied(), scavenger_->bytes_promoted(),
+                   scavenger_->segments_stolen());
     }
   }
   Heap* const heap_;
@@ -88,6 +88,7 @@ class Scavenger {
       inline bool Pop(struct PromotionListEntry* entry);
       inline bool IsGlobalPoolEmpty();
       inline bool ShouldEagerlyProcessPromotionList();
+      inline size_t StealCount();
 
      private:
       PromotionList* promotion_list_;
@@ -106,6 +107,7 @@ class Scavenger {
     inline bool Pop(int task_id, struct PromotionListEntry* entry);
     inline bool IsGlobalPoolEmpty();
     inline bool ShouldEagerlyProcessPromotionList(int task_id);
+    inline size_t StealCount(int task_id);
 
    private:
     static const int kRegularObjectPromotionListSegmentSize = 256;
@@ -143,6 +145,10 @@ class Scavenger {
 
   size_t bytes_copied() const { return copied_size_; }
   size_t bytes_promoted() const { return promoted_size_; }
+  // Number of worklist segments this scavenger stole from other tasks.
+  size_t segments_stolen() {
+    return copied_list_.StealCount() + promotion_list_.StealCount();
+  }
 
  private:
   // Number of objects to process before interrupting for potentially waking
@@ -633,6 +633,7 @@ bool Heap::CreateInitialMaps() {
                                  SKIP_WRITE_BARRIER);                       \
     WasmTypeInfo type_info = WasmTypeInfo::cast(obj);                       \
     type_info.set_subtypes(subtypes);                                       \
+    type_info.set_supertypes(roots.empty_fixed_array());                    \
     type_info.set_parent(roots.null_map());                                 \
     type_info.clear_foreign_address(isolate());                             \
     wasm_rttcanon_##which##_map().set_wasm_type_info(type_info);            \
@@ -813,11 +814,13 @@ void Heap::CreateInitialObjects() {
 
   set_basic_block_profiling_data(ArrayList::cast(roots.empty_fixed_array()));
 
-  // Allocate cache for string split and regexp-multiple.
+  // Allocate cache for string split, regexp-multiple and regexp-exec.
   set_string_split_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
+  set_regexp_exec_cache(*factory->NewFixedArray(
+      RegExpResultsCache::kRegExpResultsCacheSize, AllocationType::kOld));
 
   // Allocate FeedbackCell for builtins.
   Handle<FeedbackCell> many_closures_cell =
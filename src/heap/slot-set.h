@@ -405,6 +405,29 @@ class SlotSet {
     return empty;
   }
 
+  // Returns the number of slots in the set. Only a snapshot if slots are
+  // inserted concurrently.
+  size_t CountSlots(size_t buckets) {
+    size_t slots = 0;
+    for (size_t bucket_index = 0; bucket_index < buckets; bucket_index++) {
+      Bucket* bucket = LoadBucket(bucket_index);
+      if (bucket == nullptr) continue;
+      for (int i = 0; i < kCellsPerBucket; i++) {
+        slots += base::bits::CountPopulation(bucket->LoadCell(i));
+      }
+    }
+    return slots;
+  }
+
+  // Returns the number of bytes allocated for the set including its buckets.
+  size_t MemoryUsage(size_t buckets) {
+    size_t bytes = kInitialBucketsSize + buckets * sizeof(Bucket*);
+    for (size_t bucket_index = 0; bucket_index < buckets; bucket_index++) {
+      if (LoadBucket(bucket_index) != nullptr) bytes += sizeof(Bucket);
+    }
+    return bytes;
+  }
+
   static const int kCellsPerBucket = 32;
   static const int kCellsPerBucketLog2 = 5;
   static const int kCellSizeBytesLog2 = 2;
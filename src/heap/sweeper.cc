@@ -11,6 +11,7 @@
 #include "src/heap/gc-tracer.h"
 #include "src/heap/invalidated-slots-inl.h"
 #include "src/heap/mark-compact-inl.h"
+#include "src/heap/object-start-bitmap.h"
 #include "src/heap/remembered-set.h"
 #include "src/objects/objects-inl.h"
 
@@ -104,8 +105,9 @@ class Sweeper::SweeperTask final : public CancelableTask {
       const AllocationSpace space_id = static_cast<AllocationSpace>(
           FIRST_GROWABLE_PAGED_SPACE +
           ((i + offset) % kNumberOfSweepingSpaces));
-      // Do not sweep code space concurrently.
-      if (space_id == CODE_SPACE) continue;
+      if (space_id == CODE_SPACE && !FLAG_concurrent_code_space_sweeping) {
+        continue;
+      }
       DCHECK(IsValidSweepingSpace(space_id));
       sweeper_->SweepSpaceFromTask(space_id);
     }
@@ -137,7 +139,9 @@ class Sweeper::IncrementalSweeperTask final : public CancelableTask {
     sweeper_->incremental_sweeper_pending_ = false;
 
     if (sweeper_->sweeping_in_progress()) {
-      if (!sweeper_->SweepSpaceIncrementallyFromTask(CODE_SPACE)) {
+      bool done = sweeper_->SweepSpaceIncrementallyFromTask(CODE_SPACE);
+      sweeper_->FinalizeSweptCodePages();
+      if (!done) {
         sweeper_->ScheduleIncrementalSweepingTask();
       }
     }
@@ -240,6 +244,7 @@ void Sweeper::EnsureCompleted() {
       [this](AllocationSpace space) { ParallelSweepSpace(space, 0); });
 
   AbortAndWaitForTasks();
+  FinalizeSweptCodePages();
 
   ForAllSweepingSpaces([this](AllocationSpace space) {
     CHECK(sweeping_list_[GetSweepSpaceIndex(space)].empty());
@@ -346,6 +351,15 @@ int Sweeper::RawSweep(
     FreeSpaceTreatmentMode free_space_mode,
     FreeSpaceMayContainInvalidatedSlots invalidated_slots_in_free_space,
     const base::MutexGuard& page_guard) {
+  return RawSweepImpl(p, free_list_mode, free_space_mode,
+                      invalidated_slots_in_free_space, nullptr);
+}
+
+int Sweeper::RawSweepImpl(
+    Page* p, FreeListRebuildingMode free_list_mode,
+    FreeSpaceTreatmentMode free_space_mode,
+    FreeSpaceMayContainInvalidatedSlots invalidated_slots_in_free_space,
+    SweptCodePage* swept_code_page) {
   Space* space = p->owner();
   DCHECK_NOT_NULL(space);
   DCHECK(free_list_mode == IGNORE_FREE_LIST || space->identity() == OLD_SPACE ||
@@ -366,6 +380,11 @@ int Sweeper::RawSweep(
   CodeObjectRegistry* code_object_registry = p->GetCodeObjectRegistry();
   if (code_object_registry) code_object_registry->Clear();
 
+  // The object start bitmap is rebuilt from the live objects and the fillers
+  // created for the free ranges in between.
+  ObjectStartBitmap* object_starts = p->object_start_bitmap();
+  if (object_starts) object_starts->Clear();
+
   // Phase 2: Free the non-live memory and clean-up the regular remembered set
   // entires.
 
@@ -399,14 +418,20 @@ int Sweeper::RawSweep(
     HeapObject const object = object_and_size.first;
     if (code_object_registry)
       code_object_registry->RegisterAlreadyExistingCodeObject(object.address());
+    if (object_starts) object_starts->SetObjectStart(p, object.address());
     DCHECK(marking_state_->IsBlack(object));
     Address free_end = object.address();
     if (free_end != free_start) {
-      max_freed_bytes =
-          Max(max_freed_bytes,
-              FreeAndProcessFreedMemory(free_start, free_end, p, space,
-                                        non_empty_typed_slots, free_list_mode,
-                                        free_space_mode));
+      if (swept_code_page) {
+        swept_code_page->free_ranges.emplace_back(free_start, free_end);
+      } else {
+        if (object_starts) object_starts->SetObjectStart(p, free_start);
+        max_freed_bytes =
+            Max(max_freed_bytes,
+                FreeAndProcessFreedMemory(free_start, free_end, p, space,
+                                          non_empty_typed_slots,
+                                          free_list_mode, free_space_mode));
+      }
       CleanupRememberedSetEntriesForFreedMemory(
           free_start, free_end, p, non_empty_typed_slots, &free_ranges_map,
           &old_to_new_cleanup);
@@ -420,17 +445,32 @@ int Sweeper::RawSweep(
   // If there is free memory after the last live object also free that.
   Address free_end = p->area_end();
   if (free_end != free_start) {
-    max_freed_bytes =
-        Max(max_freed_bytes,
-            FreeAndProcessFreedMemory(free_start, free_end, p, space,
-                                      non_empty_typed_slots, free_list_mode,
-                                      free_space_mode));
+    if (swept_code_page) {
+      swept_code_page->free_ranges.emplace_back(free_start, free_end);
+    } else {
+      if (object_starts) object_starts->SetObjectStart(p, free_start);
+      max_freed_bytes =
+          Max(max_freed_bytes,
+              FreeAndProcessFreedMemory(free_start, free_end, p, space,
+                                        non_empty_typed_slots, free_list_mode,
+                                        free_space_mode));
+    }
     CleanupRememberedSetEntriesForFreedMemory(
         free_start, free_end, p, non_empty_typed_slots, &free_ranges_map,
         &old_to_new_cleanup);
   }
 
   // Phase 3: Post process the page.
+  if (swept_code_page) {
+    // Typed slots may be recorded concurrently by the main thread and are
+    // only filtered when the page is finalized.
+    DCHECK_EQ(REBUILD_FREE_LIST, free_list_mode);
+    marking_state_->bitmap(p)->Clear();
+    if (code_object_registry) code_object_registry->Finalize();
+    swept_code_page->typed_slot_free_ranges = std::move(free_ranges_map);
+    swept_code_page->live_bytes = live_bytes;
+    return 0;
+  }
   CleanupInvalidTypedSlotsOfFreeRanges(p, free_ranges_map);
   ClearMarkBitsAndHandleLivenessStatistics(p, live_bytes, free_list_mode);
 
@@ -446,14 +486,69 @@ void Sweeper::SweepSpaceFromTask(AllocationSpace identity) {
   Page* page = nullptr;
   while (!stop_sweeper_tasks_ &&
          ((page = GetSweepingPageSafe(identity)) != nullptr)) {
-    // Typed slot sets are only recorded on code pages. Code pages
-    // are not swept concurrently to the application to ensure W^X.
+    if (identity == CODE_SPACE) {
+      SweepCodePageFromTask(page);
+      continue;
+    }
+    // Typed slot sets are only recorded on code pages.
     DCHECK(!page->typed_slot_set<OLD_TO_NEW>() &&
            !page->typed_slot_set<OLD_TO_OLD>());
     ParallelSweepPage(page, identity);
   }
 }
 
+void Sweeper::SweepCodePageFromTask(Page* page) {
+  DCHECK_EQ(CODE_SPACE, page->owner_identity());
+  SweptCodePage swept_code_page(page);
+  {
+    base::MutexGuard guard(page->mutex());
+    DCHECK_EQ(Page::ConcurrentSweepingState::kPending,
+              page->concurrent_sweeping_state());
+    // The page stays in progress until it is finalized on the main thread.
+    page->set_concurrent_sweeping_state(
+        Page::ConcurrentSweepingState::kInProgress);
+    RawSweepImpl(page, REBUILD_FREE_LIST, IGNORE_FREE_SPACE,
+                 FreeSpaceMayContainInvalidatedSlots::kNo, &swept_code_page);
+  }
+
+  base::MutexGuard guard(&mutex_);
+  swept_code_pages_.push_back(std::move(swept_code_page));
+}
+
+void Sweeper::FinalizeSweptCodePages() {
+  std::vector<SweptCodePage> swept_code_pages;
+  {
+    base::MutexGuard guard(&mutex_);
+    swept_code_pages.swap(swept_code_pages_);
+  }
+  if (swept_code_pages.empty()) return;
+
+  Space* space = heap_->code_space();
+  const FreeSpaceTreatmentMode free_space_mode =
+      Heap::ShouldZapGarbage() ? ZAP_FREE_SPACE : IGNORE_FREE_SPACE;
+  for (SweptCodePage& swept_code_page : swept_code_pages) {
+    Page* page = swept_code_page.page;
+    {
+      base::MutexGuard guard(page->mutex());
+      // A single permission change covers all free ranges of the page.
+      CodePageMemoryModificationScope code_page_scope(page);
+      DCHECK_EQ(Page::ConcurrentSweepingState::kInProgress,
+                page->concurrent_sweeping_state());
+      for (const auto& range : swept_code_page.free_ranges) {
+        FreeAndProcessFreedMemory(range.first, range.second, page, space,
+                                  false, REBUILD_FREE_LIST, free_space_mode);
+      }
+      CleanupInvalidTypedSlotsOfFreeRanges(
+          page, swept_code_page.typed_slot_free_ranges);
+      DCHECK_EQ(swept_code_page.live_bytes, page->allocated_bytes());
+      page->set_concurrent_sweeping_state(
+          Page::ConcurrentSweepingState::kDone);
+    }
+    base::MutexGuard guard(&mutex_);
+    swept_list_[GetSweepSpaceIndex(CODE_SPACE)].push_back(page);
+  }
+}
+
 bool Sweeper::SweepSpaceIncrementallyFromTask(AllocationSpace identity) {
   if (Page* page = GetSweepingPageSafe(identity)) {
     ParallelSweepPage(page, identity);
@@ -7,6 +7,7 @@
 
 #include <deque>
 #include <map>
+#include <utility>
 #include <vector>
 
 #include "src/base/platform/semaphore.h"
@@ -100,6 +101,11 @@ class Sweeper {
       FreeSpaceMayContainInvalidatedSlots invalidated_slots_in_free_space,
       const base::MutexGuard& page_guard);
 
+  // Frees the memory recorded for code pages that were swept by background
+  // tasks and makes the pages available to the code space. Must be called on
+  // the main thread.
+  void FinalizeSweptCodePages();
+
   // After calling this function sweeping is considered to be in progress
   // and the main thread can sweep lazily, but the background sweeper tasks
   // are not running yet.
@@ -125,6 +131,20 @@ class Sweeper {
   class IterabilityTask;
   class SweeperTask;
 
+  // A code page that was swept by a background task. Background tasks do not
+  // write to code pages as that would require making pages writable while
+  // their code may run on the main thread. The free ranges are instead
+  // recorded and processed by FinalizeSweptCodePages(), which flips the page
+  // permissions once per page.
+  struct SweptCodePage {
+    explicit SweptCodePage(Page* page) : page(page), live_bytes(0) {}
+
+    Page* page;
+    std::vector<std::pair<Address, Address>> free_ranges;
+    FreeRangesMap typed_slot_free_ranges;
+    size_t live_bytes;
+  };
+
   static const int kNumberOfSweepingSpaces =
       LAST_GROWABLE_PAGED_SPACE - FIRST_GROWABLE_PAGED_SPACE + 1;
   static const int kMaxSweeperTasks = 3;
@@ -174,6 +194,18 @@ class Sweeper {
 
   void SweepSpaceFromTask(AllocationSpace identity);
 
+  // Sweeps the given code page from a background task without writing to the
+  // page. See SweptCodePage.
+  void SweepCodePageFromTask(Page* page);
+
+  // Shared implementation of RawSweep(). Free memory is only recorded in
+  // |swept_code_page| if one is provided.
+  int RawSweepImpl(
+      Page* p, FreeListRebuildingMode free_list_mode,
+      FreeSpaceTreatmentMode free_space_mode,
+      FreeSpaceMayContainInvalidatedSlots invalidated_slots_in_free_space,
+      SweptCodePage* swept_code_page);
+
   // Sweeps incrementally one page from the given space. Returns true if
   // there are no more pages to sweep in the given space.
   bool SweepSpaceIncrementallyFromTask(AllocationSpace identity);
@@ -208,6 +240,9 @@ class Sweeper {
   base::Mutex mutex_;
   SweptList swept_list_[kNumberOfSweepingSpaces];
   SweepingList sweeping_list_[kNumberOfSweepingSpaces];
+  // Code pages swept by background tasks that still need to be finalized on
+  // the main thread. Protected by |mutex_|.
+  std::vector<SweptCodePage> swept_code_pages_;
   bool incremental_sweeper_pending_;
   // Main thread can finalize sweeping, while background threads allocation slow
   // path checks this flag to see whether it could support concurrent sweeping.
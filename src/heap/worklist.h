@@ -5,13 +5,14 @@
 #ifndef V8_HEAP_WORKLIST_H_
 #define V8_HEAP_WORKLIST_H_
 
+#include <atomic>
 #include <cstddef>
 #include <utility>
 
 #include "src/base/atomic-utils.h"
+#include "src/base/bits.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
-#include "src/base/platform/mutex.h"
 #include "testing/gtest/include/gtest/gtest_prod.h"  // nogncheck
 
 namespace v8 {
@@ -22,6 +23,11 @@ namespace internal {
 // corresponding push segments. Full push segments are published to a global
 // pool of segments and replaced with empty segments.
 //
+// The global pool consists of one lock-free Chase-Lev deque of segments per
+// task. A task publishes segments to the bottom of its own deque and takes
+// them back from there in LIFO order. When its own deque is empty, it steals
+// the oldest segment from the top of the deque of another task.
+//
 // Work stealing is best effort, i.e., there is no way to inform other tasks
 // of the need of items.
 template <typename EntryType, int SEGMENT_SIZE>
@@ -53,6 +59,8 @@ class Worklist {
 
     void FlushToGlobal() { worklist_->FlushToGlobal(task_id_); }
 
+    size_t StealCount() const { return worklist_->StealCount(task_id_); }
+
    private:
     Worklist<EntryType, SEGMENT_SIZE>* worklist_;
     int task_id_;
@@ -68,6 +76,7 @@ class Worklist {
     for (int i = 0; i < num_tasks_; i++) {
       private_push_segment(i) = NewSegment();
       private_pop_segment(i) = NewSegment();
+      private_segments_[i].steals = 0;
     }
   }
 
@@ -151,6 +160,14 @@ class Worklist {
   // Thread-safe but may return an outdated result.
   size_t GlobalPoolSize() const { return global_pool_.Size(); }
 
+  // Returns the number of segments the given task has stolen from the
+  // deques of other tasks. Only the task itself may call this while it is
+  // running.
+  size_t StealCount(int task_id) const {
+    DCHECK_LT(task_id, num_tasks_);
+    return private_segments_[task_id].steals;
+  }
+
   // Clears all segments. Frees the global segment pool.
   //
   // Assumes that no other tasks are running.
@@ -203,6 +220,8 @@ class Worklist {
     PublishPopSegmentToGlobal(task_id);
   }
 
+  // Moves the global pool of |other| into the deque of task 0. Must be called
+  // by task 0 and without concurrent access to |other|.
   void MergeGlobalPool(Worklist* other) {
     global_pool_.Merge(&other->global_pool_);
   }
@@ -272,136 +291,290 @@ class Worklist {
   struct PrivateSegmentHolder {
     Segment* private_push_segment;
     Segment* private_pop_segment;
+    // Number of segments stolen from other tasks. Only accessed by the owning
+    // task.
+    size_t steals;
     char cache_line_padding[64];
   };
 
+  // A Chase-Lev work-stealing deque of segments, following "Correct and
+  // Efficient Work-Stealing for Weak Memory Models" (Le et al., PPoPP 2013).
+  // Push() and Pop() may only be called by the owning task, Steal() by any
+  // task. The remaining operations assume that no other tasks are running.
+  class SegmentDeque {
+   public:
+    SegmentDeque() : buffer_(new Buffer(kInitialCapacity, nullptr)) {}
+
+    ~SegmentDeque() {
+      Clear();
+      delete buffer_.load(std::memory_order_relaxed);
+    }
+
+    void Push(Segment* segment) {
+      intptr_t bottom = bottom_.load(std::memory_order_relaxed);
+      intptr_t top = top_.load(std::memory_order_acquire);
+      Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+      if (bottom - top >= static_cast<intptr_t>(buffer->capacity())) {
+        buffer = Grow(buffer, top, bottom);
+      }
+      buffer->Put(bottom, segment);
+      // Publishes the segment contents to thieves.
+      bottom_.store(bottom + 1, std::memory_order_release);
+    }
+
+    bool Pop(Segment** segment) {
+      intptr_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+      Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+      bottom_.store(bottom, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      intptr_t top = top_.load(std::memory_order_relaxed);
+      if (top > bottom) {
+        // The deque was empty.
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return false;
+      }
+      *segment = buffer->Get(bottom);
+      if (top == bottom) {
+        // Last segment: race against concurrent Steal() calls.
+        bool success = top_.compare_exchange_strong(
+            top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+        return success;
+      }
+      return true;
+    }
+
+    bool Steal(Segment** segment) {
+      intptr_t top = top_.load(std::memory_order_acquire);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      intptr_t bottom = bottom_.load(std::memory_order_acquire);
+      while (top < bottom) {
+        Buffer* buffer = buffer_.load(std::memory_order_acquire);
+        Segment* result = buffer->Get(top);
+        if (top_.compare_exchange_strong(top, top + 1,
+                                         std::memory_order_seq_cst,
+                                         std::memory_order_acquire)) {
+          *segment = result;
+          return true;
+        }
+        // Lost the race against the owner or another thief; |top| has been
+        // reloaded by the failed CAS.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        bottom = bottom_.load(std::memory_order_acquire);
+      }
+      return false;
+    }
+
+    // Thread-safe but may return an outdated result.
+    size_t Size() const {
+      intptr_t size = bottom_.load(std::memory_order_relaxed) -
+                      top_.load(std::memory_order_relaxed);
+      return size > 0 ? static_cast<size_t>(size) : 0;
+    }
+
+    bool IsEmpty() const { return Size() == 0; }
+
+    void Clear() {
+      Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+      for (intptr_t i = top(); i < bottom(); i++) delete buffer->Get(i);
+      Reset();
+    }
+
+    // See Worklist::Update.
+    template <typename Callback>
+    void Update(Callback callback) {
+      Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+      intptr_t new_bottom = top();
+      for (intptr_t i = top(); i < bottom(); i++) {
+        Segment* segment = buffer->Get(i);
+        segment->Update(callback);
+        if (segment->IsEmpty()) {
+          delete segment;
+        } else {
+          buffer->Put(new_bottom++, segment);
+        }
+      }
+      bottom_.store(new_bottom, std::memory_order_relaxed);
+    }
+
+    // See Worklist::Iterate.
+    template <typename Callback>
+    void Iterate(Callback callback) const {
+      Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+      for (intptr_t i = top(); i < bottom(); i++) {
+        buffer->Get(i)->Iterate(callback);
+      }
+    }
+
+    void Swap(SegmentDeque& other) {
+      intptr_t other_top = other.top();
+      intptr_t other_bottom = other.bottom();
+      Buffer* other_buffer = other.buffer_.load(std::memory_order_relaxed);
+      other.top_.store(top(), std::memory_order_relaxed);
+      other.bottom_.store(bottom(), std::memory_order_relaxed);
+      other.buffer_.store(buffer_.load(std::memory_order_relaxed),
+                          std::memory_order_relaxed);
+      top_.store(other_top, std::memory_order_relaxed);
+      bottom_.store(other_bottom, std::memory_order_relaxed);
+      buffer_.store(other_buffer, std::memory_order_relaxed);
+    }
+
+    // Moves all segments to the bottom of |target|, which must be owned by
+    // the calling task.
+    void MoveTo(SegmentDeque* target) {
+      Buffer* buffer = buffer_.load(std::memory_order_relaxed);
+      for (intptr_t i = top(); i < bottom(); i++) {
+        target->Push(buffer->Get(i));
+      }
+      Reset();
+    }
+
+   private:
+    static const size_t kInitialCapacity = 16;
+
+    // A circular array of segments. Buffers that have been replaced by a
+    // larger one may still be read by concurrent Steal() calls and are kept
+    // alive in the |retired| chain until the deque is reset.
+    class Buffer {
+     public:
+      Buffer(size_t capacity, Buffer* retired)
+          : capacity_(capacity),
+            retired_(retired),
+            slots_(new std::atomic<Segment*>[capacity]) {
+        DCHECK(base::bits::IsPowerOfTwo(capacity));
+      }
+
+      ~Buffer() {
+        delete retired_;
+        delete[] slots_;
+      }
+
+      size_t capacity() const { return capacity_; }
+
+      Segment* Get(intptr_t index) const {
+        return slots_[index & (capacity_ - 1)].load(std::memory_order_relaxed);
+      }
+
+      void Put(intptr_t index, Segment* segment) {
+        slots_[index & (capacity_ - 1)].store(segment,
+                                              std::memory_order_relaxed);
+      }
+
+      void ReleaseRetired() {
+        delete retired_;
+        retired_ = nullptr;
+      }
+
+     private:
+      const size_t capacity_;
+      Buffer* retired_;
+      std::atomic<Segment*>* const slots_;
+    };
+
+    Buffer* Grow(Buffer* buffer, intptr_t top, intptr_t bottom) {
+      Buffer* new_buffer = new Buffer(buffer->capacity() * 2, buffer);
+      for (intptr_t i = top; i < bottom; i++) {
+        new_buffer->Put(i, buffer->Get(i));
+      }
+      buffer_.store(new_buffer, std::memory_order_release);
+      return new_buffer;
+    }
+
+    void Reset() {
+      top_.store(0, std::memory_order_relaxed);
+      bottom_.store(0, std::memory_order_relaxed);
+      buffer_.load(std::memory_order_relaxed)->ReleaseRetired();
+    }
+
+    intptr_t top() const { return top_.load(std::memory_order_relaxed); }
+    intptr_t bottom() const { return bottom_.load(std::memory_order_relaxed); }
+
+    std::atomic<intptr_t> top_{0};
+    std::atomic<intptr_t> bottom_{0};
+    std::atomic<Buffer*> buffer_;
+  };
+
   class GlobalPool {
    public:
-    GlobalPool() : top_(nullptr) {}
+    GlobalPool() = default;
 
     // Swaps contents, not thread safe.
     void Swap(GlobalPool& other) {
-      Segment* temp = top_;
-      set_top(other.top_);
-      other.set_top(temp);
-      size_t other_size = other.size_.exchange(
-          size_.load(std::memory_order_relaxed), std::memory_order_relaxed);
-      size_.store(other_size, std::memory_order_relaxed);
-    }
-
-    V8_INLINE void Push(Segment* segment) {
-      base::MutexGuard guard(&lock_);
-      segment->set_next(top_);
-      set_top(segment);
-      size_.fetch_add(1, std::memory_order_relaxed);
-    }
-
-    V8_INLINE bool Pop(Segment** segment) {
-      base::MutexGuard guard(&lock_);
-      if (top_ != nullptr) {
-        DCHECK_LT(0U, size_);
-        size_.fetch_sub(1, std::memory_order_relaxed);
-        *segment = top_;
-        set_top(top_->next());
+      for (int i = 0; i < kMaxNumTasks; i++) {
+        deque(i)->Swap(*other.deque(i));
+      }
+    }
+
+    V8_INLINE void Push(int task_id, Segment* segment) {
+      deque(task_id)->Push(segment);
+    }
+
+    // Pops a segment from the deque of |task_id| or, if that is empty, steals
+    // one from another task. |stolen| is set accordingly.
+    V8_INLINE bool Pop(int task_id, Segment** segment, bool* stolen) {
+      if (deque(task_id)->Pop(segment)) {
+        *stolen = false;
         return true;
       }
+      for (int i = 1; i < kMaxNumTasks; i++) {
+        int victim = (task_id + i) % kMaxNumTasks;
+        if (deque(victim)->Steal(segment)) {
+          *stolen = true;
+          return true;
+        }
+      }
       return false;
     }
 
-    V8_INLINE bool IsEmpty() {
-      return base::AsAtomicPointer::Relaxed_Load(&top_) == nullptr;
+    V8_INLINE bool IsEmpty() const {
+      for (int i = 0; i < kMaxNumTasks; i++) {
+        if (!deque(i)->IsEmpty()) return false;
+      }
+      return true;
     }
 
     V8_INLINE size_t Size() const {
-      // It is safe to read |size_| without a lock since this variable is
-      // atomic, keeping in mind that threads may not immediately see the new
-      // value when it is updated.
-      return size_.load(std::memory_order_relaxed);
+      // The deque sizes are read without synchronization, keeping in mind
+      // that threads may not immediately see the new values.
+      size_t size = 0;
+      for (int i = 0; i < kMaxNumTasks; i++) size += deque(i)->Size();
+      return size;
     }
 
     void Clear() {
-      base::MutexGuard guard(&lock_);
-      size_.store(0, std::memory_order_relaxed);
-      Segment* current = top_;
-      while (current != nullptr) {
-        Segment* tmp = current;
-        current = current->next();
-        delete tmp;
-      }
-      set_top(nullptr);
+      for (int i = 0; i < kMaxNumTasks; i++) deque(i)->Clear();
     }
 
     // See Worklist::Update.
     template <typename Callback>
     void Update(Callback callback) {
-      base::MutexGuard guard(&lock_);
-      Segment* prev = nullptr;
-      Segment* current = top_;
-      size_t num_deleted = 0;
-      while (current != nullptr) {
-        current->Update(callback);
-        if (current->IsEmpty()) {
-          DCHECK_LT(0U, size_);
-          ++num_deleted;
-          if (prev == nullptr) {
-            top_ = current->next();
-          } else {
-            prev->set_next(current->next());
-          }
-          Segment* tmp = current;
-          current = current->next();
-          delete tmp;
-        } else {
-          prev = current;
-          current = current->next();
-        }
-      }
-      size_.fetch_sub(num_deleted, std::memory_order_relaxed);
+      for (int i = 0; i < kMaxNumTasks; i++) deque(i)->Update(callback);
     }
 
     // See Worklist::Iterate.
     template <typename Callback>
     void Iterate(Callback callback) {
-      base::MutexGuard guard(&lock_);
-      for (Segment* current = top_; current != nullptr;
-           current = current->next()) {
-        current->Iterate(callback);
-      }
+      for (int i = 0; i < kMaxNumTasks; i++) deque(i)->Iterate(callback);
     }
 
     void Merge(GlobalPool* other) {
-      Segment* top = nullptr;
-      size_t other_size = 0;
-      {
-        base::MutexGuard guard(&other->lock_);
-        if (!other->top_) return;
-        top = other->top_;
-        other_size = other->size_.load(std::memory_order_relaxed);
-        other->size_.store(0, std::memory_order_relaxed);
-        other->set_top(nullptr);
-      }
-
-      // It's safe to iterate through these segments because the top was
-      // extracted from |other|.
-      Segment* end = top;
-      while (end->next()) end = end->next();
-
-      {
-        base::MutexGuard guard(&lock_);
-        size_.fetch_add(other_size, std::memory_order_relaxed);
-        end->set_next(top_);
-        set_top(top);
+      for (int i = 0; i < kMaxNumTasks; i++) {
+        other->deque(i)->MoveTo(deque(0));
       }
     }
 
    private:
-    void set_top(Segment* segment) {
-      base::AsAtomicPointer::Relaxed_Store(&top_, segment);
+    struct DequeHolder {
+      SegmentDeque deque;
+      char cache_line_padding[64];
+    };
+
+    SegmentDeque* deque(int task_id) { return &deques_[task_id].deque; }
+    const SegmentDeque* deque(int task_id) const {
+      return &deques_[task_id].deque;
     }
 
-    base::Mutex lock_;
-    Segment* top_;
-    std::atomic<size_t> size_{0};
+    DequeHolder deques_[kMaxNumTasks];
   };
 
   V8_INLINE Segment*& private_push_segment(int task_id) {
@@ -414,14 +587,14 @@ class Worklist {
 
   V8_INLINE void PublishPushSegmentToGlobal(int task_id) {
     if (!private_push_segment(task_id)->IsEmpty()) {
-      global_pool_.Push(private_push_segment(task_id));
+      global_pool_.Push(task_id, private_push_segment(task_id));
       private_push_segment(task_id) = NewSegment();
     }
   }
 
   V8_INLINE void PublishPopSegmentToGlobal(int task_id) {
     if (!private_pop_segment(task_id)->IsEmpty()) {
-      global_pool_.Push(private_pop_segment(task_id));
+      global_pool_.Push(task_id, private_pop_segment(task_id));
       private_pop_segment(task_id) = NewSegment();
     }
   }
@@ -429,9 +602,11 @@ class Worklist {
   V8_INLINE bool StealPopSegmentFromGlobal(int task_id) {
     if (global_pool_.IsEmpty()) return false;
     Segment* new_segment = nullptr;
-    if (global_pool_.Pop(&new_segment)) {
+    bool stolen = false;
+    if (global_pool_.Pop(task_id, &new_segment, &stolen)) {
       delete private_pop_segment(task_id);
       private_pop_segment(task_id) = new_segment;
+      if (stolen) private_segments_[task_id].steals++;
       return true;
     }
     return false;
@@ -5,6 +5,7 @@
 #include "src/ic/accessor-assembler.h"
 
 #include "src/ast/ast.h"
+#include "src/base/bits.h"
 #include "src/base/optional.h"
 #include "src/codegen/code-factory.h"
 #include "src/ic/handler-configuration.h"
@@ -15,6 +16,7 @@
 #include "src/objects/cell.h"
 #include "src/objects/foreign.h"
 #include "src/objects/heap-number.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/module.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/property-details.h"
@@ -2378,10 +2380,14 @@ void AccessorAssembler::GenericPropertyLoad(TNode<HeapObject> receiver,
   // for a handler in the stub cache.
   TNode<DescriptorArray> descriptors = LoadMapDescriptors(receiver_map);
 
-  Label if_descriptor_found(this), try_stub_cache(this);
+  Label if_descriptor_found(this), try_stub_cache(this),
+      descriptor_lookup(this);
   TVARIABLE(IntPtrT, var_name_index);
   Label* notfound = use_stub_cache == kUseStubCache ? &try_stub_cache
                                                     : &lookup_prototype_chain;
+  TryProbeDescriptorLookupCache(receiver_map, name, &if_descriptor_found,
+                                &var_name_index, &descriptor_lookup);
+  BIND(&descriptor_lookup);
   DescriptorLookup(name, descriptors, bitfield3, &if_descriptor_found,
                    &var_name_index, notfound);
 
@@ -2529,7 +2535,8 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
+TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                         TNode<Name> name,
                                                          TNode<Map> map) {
   // Compute the hash of the name (use entire hash field).
   TNode<Uint32T> hash_field = LoadNameHashField(name);
@@ -2547,25 +2554,27 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
       WordXor(map_word, WordShr(map_word, StubCache::kMapKeyShift))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  SCTableReference mask_reference =
+      stub_cache->mask_reference(StubCache::kPrimary);
+  TNode<Uint32T> mask = Load<Uint32T>(
+      ExternalConstant(ExternalReference::Create(mask_reference)));
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
 TNode<IntPtrT> AccessorAssembler::StubCacheSecondaryOffset(
-    TNode<Name> name, TNode<IntPtrT> seed) {
+    StubCache* stub_cache, TNode<Name> name, TNode<IntPtrT> seed) {
   // See v8::internal::StubCache::SecondaryOffset().
 
   // Use the seed from the primary cache in the secondary cache.
   TNode<Int32T> name32 = TruncateIntPtrToInt32(BitcastTaggedToWord(name));
   TNode<Int32T> hash = Int32Sub(TruncateIntPtrToInt32(seed), name32);
   hash = Int32Add(hash, Int32Constant(StubCache::kSecondaryMagic));
-  int32_t mask = (StubCache::kSecondaryTableSize - 1)
-                 << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  SCTableReference mask_reference =
+      stub_cache->mask_reference(StubCache::kSecondary);
+  TNode<Uint32T> mask = Load<Uint32T>(
+      ExternalConstant(ExternalReference::Create(mask_reference)));
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
@@ -2601,10 +2610,30 @@ void AccessorAssembler::TryProbeStubCacheTable(
                      IntPtrConstant(offsetof(StubCache::Entry, value)))));
 
   // We found the handler.
+  IncrementStubCacheStat(stub_cache,
+                         table == StubCache::kPrimary
+                             ? offsetof(StubCache::Stats, primary_hits)
+                             : offsetof(StubCache::Stats, secondary_hits));
   *var_handler = handler;
   Goto(if_handler);
 }
 
+void AccessorAssembler::IncrementStubCacheStat(StubCache* stub_cache,
+                                               int counter_offset) {
+  Label done(this);
+  TNode<Uint32T> ic_stats = Load<Uint32T>(
+      ExternalConstant(ExternalReference::address_of_ic_stats_flag()));
+  GotoIf(Word32Equal(ic_stats, Int32Constant(0)), &done);
+  TNode<ExternalReference> stats = ExternalConstant(
+      ExternalReference::Create(stub_cache->stats_reference()));
+  TNode<Uint32T> count = Load<Uint32T>(stats, IntPtrConstant(counter_offset));
+  StoreNoWriteBarrier(MachineRepresentation::kWord32, stats,
+                      IntPtrConstant(counter_offset),
+                      Int32Add(count, Int32Constant(1)));
+  Goto(&done);
+  BIND(&done);
+}
+
 void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
                                           TNode<Object> receiver,
                                           TNode<Name> name, Label* if_handler,
@@ -2621,7 +2650,8 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   TNode<Map> receiver_map = LoadMap(CAST(receiver));
 
   // Probe the primary table.
-  TNode<IntPtrT> primary_offset = StubCachePrimaryOffset(name, receiver_map);
+  TNode<IntPtrT> primary_offset =
+      StubCachePrimaryOffset(stub_cache, name, receiver_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
                          receiver_map, if_handler, var_handler, &try_secondary);
 
@@ -2629,7 +2659,7 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   {
     // Probe the secondary table.
     TNode<IntPtrT> secondary_offset =
-        StubCacheSecondaryOffset(name, primary_offset);
+        StubCacheSecondaryOffset(stub_cache, name, primary_offset);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
                            receiver_map, if_handler, var_handler, &miss);
   }
@@ -2637,10 +2667,49 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   BIND(&miss);
   {
     IncrementCounter(counters->megamorphic_stub_cache_misses(), 1);
+    IncrementStubCacheStat(stub_cache, offsetof(StubCache::Stats, misses));
     Goto(if_miss);
   }
 }
 
+void AccessorAssembler::TryProbeDescriptorLookupCache(
+    TNode<Map> map, TNode<Name> name, Label* if_found,
+    TVariable<IntPtrT>* var_name_index, Label* if_miss) {
+  // See DescriptorLookupCache::Hash().
+  STATIC_ASSERT(base::bits::IsPowerOfTwo(DescriptorLookupCache::kLength));
+  TNode<Uint32T> hash_field = LoadNameHashField(name);
+  TNode<Word32T> map_hash =
+      Word32Shr(TruncateIntPtrToInt32(BitcastTaggedToWord(map)),
+                Int32Constant(kTaggedSizeLog2));
+  TNode<IntPtrT> index = Signed(ChangeUint32ToWord(
+      Word32And(Word32Xor(map_hash, hash_field),
+                Int32Constant(DescriptorLookupCache::kLength - 1))));
+
+  // The keys are full, uncompressed pointers.
+  TNode<ExternalReference> keys = ExternalConstant(
+      ExternalReference::descriptor_lookup_cache_keys(isolate()));
+  TNode<IntPtrT> key_offset =
+      IntPtrMul(index, IntPtrConstant(sizeof(DescriptorLookupCache::Key)));
+  TNode<UintPtrT> cached_map = Load<UintPtrT>(
+      keys, IntPtrAdd(key_offset, IntPtrConstant(offsetof(
+                                      DescriptorLookupCache::Key, source))));
+  GotoIf(WordNotEqual(cached_map, BitcastTaggedToWord(map)), if_miss);
+  TNode<UintPtrT> cached_name = Load<UintPtrT>(
+      keys, IntPtrAdd(key_offset, IntPtrConstant(offsetof(
+                                      DescriptorLookupCache::Key, name))));
+  GotoIf(WordNotEqual(cached_name, BitcastTaggedToWord(name)), if_miss);
+
+  // Both DescriptorLookupCache::kAbsent and DescriptorArray::kNotFound are
+  // negative; leave those to the full search.
+  TNode<ExternalReference> results = ExternalConstant(
+      ExternalReference::descriptor_lookup_cache_results(isolate()));
+  TNode<Int32T> result = Load<Int32T>(
+      results, IntPtrMul(index, IntPtrConstant(sizeof(int))));
+  GotoIf(Int32LessThan(result, Int32Constant(0)), if_miss);
+  *var_name_index = ToKeyIndex<DescriptorArray>(Unsigned(result));
+  Goto(if_found);
+}
+
 //////////////////// Entry points into private implementation (one per stub).
 
 void AccessorAssembler::LoadIC_BytecodeHandler(const LazyLoadICParameters* p,
@@ -3169,14 +3238,10 @@ void AccessorAssembler::KeyedLoadICGeneric(const LoadICParameters* p) {
     BIND(&if_notunique);
     {
       if (FLAG_internalize_on_the_fly) {
-        // Ideally we could return undefined directly here if the name is not
-        // found in the string table, i.e. it was never internalized, but that
-        // invariant doesn't hold with named property interceptors (at this
-        // point), so we take the {if_runtime} path instead.
-        Label if_in_string_table(this);
+        Label if_in_string_table(this), if_not_in_string_table(this);
         TryInternalizeString(CAST(var_name.value()), &if_index, &var_index,
-                             &if_in_string_table, &var_unique, &if_runtime,
-                             &if_runtime);
+                             &if_in_string_table, &var_unique,
+                             &if_not_in_string_table, &if_runtime);
 
         BIND(&if_in_string_table);
         {
@@ -3191,6 +3256,29 @@ void AccessorAssembler::KeyedLoadICGeneric(const LoadICParameters* p) {
           GenericPropertyLoad(CAST(receiver), receiver_map, instance_type, &pp,
                               &if_runtime, kDontUseStubCache);
         }
+
+        BIND(&if_not_in_string_table);
+        {
+          // A name that is not in the string table was never internalized,
+          // so no ordinary object has a property with that name. Special
+          // receivers (primitives, proxies, named interceptors, ...) can
+          // still produce one, so we take the {if_runtime} path if there is
+          // any on the prototype chain.
+          TVARIABLE(Map, var_holder_map, LoadMap(CAST(receiver)));
+          Label loop(this, &var_holder_map), return_undefined(this);
+          Goto(&loop);
+          BIND(&loop);
+          {
+            GotoIf(IsSpecialReceiverMap(var_holder_map.value()), &if_runtime);
+            TNode<HeapObject> proto = LoadMapPrototype(var_holder_map.value());
+            GotoIf(IsNull(proto), &return_undefined);
+            var_holder_map = LoadMap(proto);
+            Goto(&loop);
+          }
+
+          BIND(&return_undefined);
+          Return(UndefinedConstant());
+        }
       } else {
         Goto(&if_runtime);
       }
@@ -3260,7 +3348,8 @@ void AccessorAssembler::KeyedLoadICPolymorphicName(const LoadICParameters* p,
   }
 }
 
-void AccessorAssembler::StoreIC(const StoreICParameters* p) {
+void AccessorAssembler::StoreIC(const StoreICParameters* p,
+                                StoreICMode mode) {
   TVARIABLE(MaybeObject, var_handler,
             ReinterpretCast<MaybeObject>(SmiConstant(0)));
 
@@ -3301,14 +3390,25 @@ void AccessorAssembler::StoreIC(const StoreICParameters* p) {
     // Check megamorphic case.
     GotoIfNot(TaggedEqual(strong_feedback, MegamorphicSymbolConstant()), &miss);
 
-    TryProbeStubCache(isolate()->store_stub_cache(), p->receiver(),
-                      CAST(p->name()), &if_handler, &var_handler, &miss);
+    if (mode == StoreICMode::kStoreOwn) {
+      // The stub cache is shared with StoreICs, whose handlers may call
+      // setters. Megamorphic StoreOwnICs define the property in the runtime.
+      Goto(&no_feedback);
+    } else {
+      TryProbeStubCache(isolate()->store_stub_cache(), p->receiver(),
+                        CAST(p->name()), &if_handler, &var_handler, &miss);
+    }
   }
 
   BIND(&no_feedback);
   {
-    TailCallBuiltin(Builtins::kStoreIC_NoFeedback, p->context(), p->receiver(),
-                    p->name(), p->value(), p->slot());
+    if (mode == StoreICMode::kStoreOwn) {
+      TailCallRuntime(Runtime::kCreateDataProperty, p->context(),
+                      p->receiver(), p->name(), p->value());
+    } else {
+      TailCallBuiltin(Builtins::kStoreIC_NoFeedback, p->context(),
+                      p->receiver(), p->name(), p->value(), p->slot());
+    }
   }
 
   BIND(&miss);
@@ -3882,7 +3982,7 @@ void AccessorAssembler::GenerateStoreIC() {
   TNode<Context> context = CAST(Parameter(Descriptor::kContext));
 
   StoreICParameters p(context, receiver, name, value, slot, vector);
-  StoreIC(&p);
+  StoreIC(&p, StoreICMode::kDefault);
 }
 
 void AccessorAssembler::GenerateStoreICTrampoline() {
@@ -3899,6 +3999,34 @@ void AccessorAssembler::GenerateStoreICTrampoline() {
                   vector);
 }
 
+void AccessorAssembler::GenerateStoreOwnIC() {
+  using Descriptor = StoreWithVectorDescriptor;
+
+  TNode<Object> receiver = CAST(Parameter(Descriptor::kReceiver));
+  TNode<Object> name = CAST(Parameter(Descriptor::kName));
+  TNode<Object> value = CAST(Parameter(Descriptor::kValue));
+  TNode<TaggedIndex> slot = CAST(Parameter(Descriptor::kSlot));
+  TNode<HeapObject> vector = CAST(Parameter(Descriptor::kVector));
+  TNode<Context> context = CAST(Parameter(Descriptor::kContext));
+
+  StoreICParameters p(context, receiver, name, value, slot, vector);
+  StoreIC(&p, StoreICMode::kStoreOwn);
+}
+
+void AccessorAssembler::GenerateStoreOwnICTrampoline() {
+  using Descriptor = StoreDescriptor;
+
+  TNode<Object> receiver = CAST(Parameter(Descriptor::kReceiver));
+  TNode<Object> name = CAST(Parameter(Descriptor::kName));
+  TNode<Object> value = CAST(Parameter(Descriptor::kValue));
+  TNode<TaggedIndex> slot = CAST(Parameter(Descriptor::kSlot));
+  TNode<Context> context = CAST(Parameter(Descriptor::kContext));
+  TNode<FeedbackVector> vector = LoadFeedbackVectorForStub();
+
+  TailCallBuiltin(Builtins::kStoreOwnIC, context, receiver, name, value, slot,
+                  vector);
+}
+
 void AccessorAssembler::GenerateKeyedStoreIC() {
   using Descriptor = StoreWithVectorDescriptor;
 
@@ -3977,11 +4105,30 @@ void AccessorAssembler::GenerateCloneObjectIC_Slow() {
   ReturnIf(IsNullOrUndefined(source), result);
   source = ToObject_Inline(context, source);
 
-  Label call_runtime(this, Label::kDeferred), done(this);
+  Label call_runtime(this, Label::kDeferred), copy_properties(this),
+      done(this);
 
   TNode<Map> source_map = LoadMap(CAST(source));
   GotoIfNot(IsJSObjectMap(source_map), &call_runtime);
-  GotoIfNot(IsEmptyFixedArray(LoadElements(CAST(source))), &call_runtime);
+  {
+    // Integer-indexed properties come first in enumeration order, and
+    // copying them can't run any user code. So elements that fit the
+    // HOLEY_ELEMENTS {result} are cloned up front.
+    TNode<FixedArrayBase> source_elements = LoadElements(CAST(source));
+    GotoIf(IsEmptyFixedArray(source_elements), &copy_properties);
+    TNode<Int32T> source_elements_kind = LoadMapElementsKind(source_map);
+    GotoIf(IsDoubleElementsKind(source_elements_kind), &call_runtime);
+    GotoIfNot(IsFastOrNonExtensibleOrSealedElementsKind(source_elements_kind),
+              &call_runtime);
+    ExtractFixedArrayFlags flags;
+    flags |= ExtractFixedArrayFlag::kFixedArrays;
+    flags |= ExtractFixedArrayFlag::kDontCopyCOW;
+    StoreObjectField(result, JSObject::kElementsOffset,
+                     CloneFixedArray(source_elements, flags));
+    Goto(&copy_properties);
+  }
+
+  BIND(&copy_properties);
 
   ForEachEnumerableOwnProperty(
       context, source_map, CAST(source), kPropertyAdditionOrder,
@@ -4028,7 +4175,7 @@ void AccessorAssembler::GenerateCloneObjectIC() {
     // a result object.
     TNode<Map> result_map = CAST(var_handler.value());
     TVARIABLE(HeapObject, var_properties, EmptyFixedArrayConstant());
-    TVARIABLE(FixedArray, var_elements, EmptyFixedArrayConstant());
+    TVARIABLE(FixedArrayBase, var_elements, EmptyFixedArrayConstant());
 
     Label allocate_object(this);
     GotoIf(IsNullOrUndefined(source), &allocate_object);
@@ -4036,11 +4183,12 @@ void AccessorAssembler::GenerateCloneObjectIC() {
     CSA_SLOW_ASSERT(this, IsJSObjectMap(result_map));
 
     // The IC fast case should only be taken if the result map a compatible
-    // elements kind with the source object.
+    // elements kind with the source object. Double elements are cloned into
+    // a FixedDoubleArray, all other kinds into a FixedArray.
     TNode<FixedArrayBase> source_elements = LoadElements(CAST(source));
 
     auto flags = ExtractFixedArrayFlag::kAllFixedArraysDontCopyCOW;
-    var_elements = CAST(CloneFixedArray(source_elements, flags));
+    var_elements = CloneFixedArray(source_elements, flags);
 
     // Copy the PropertyArray backing store. The source PropertyArray must be
     // either an Smi, or a PropertyArray.
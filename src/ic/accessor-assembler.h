@@ -39,6 +39,8 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   void GenerateKeyedLoadICTrampoline_Megamorphic();
   void GenerateStoreIC();
   void GenerateStoreICTrampoline();
+  void GenerateStoreOwnIC();
+  void GenerateStoreOwnICTrampoline();
   void GenerateStoreGlobalIC();
   void GenerateStoreGlobalICTrampoline();
   void GenerateCloneObjectIC();
@@ -59,13 +61,15 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
                          TNode<Name> name, Label* if_handler,
                          TVariable<MaybeObject>* var_handler, Label* if_miss);
 
-  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(TNode<Name> name,
+  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(StubCache* stub_cache,
+                                                  TNode<Name> name,
                                                   TNode<Map> map) {
-    return StubCachePrimaryOffset(name, map);
+    return StubCachePrimaryOffset(stub_cache, name, map);
   }
-  TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(TNode<Name> name,
+  TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(StubCache* stub_cache,
+                                                    TNode<Name> name,
                                                     TNode<IntPtrT> seed) {
-    return StubCacheSecondaryOffset(name, seed);
+    return StubCacheSecondaryOffset(stub_cache, name, seed);
   }
 
   struct LoadICParameters {
@@ -173,6 +177,7 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   };
 
   enum class LoadAccessMode { kLoad, kHas };
+  enum class StoreICMode { kDefault, kStoreOwn };
   enum class ICMode { kNonGlobalIC, kGlobalIC };
   enum ElementSupport { kOnlyProperties, kSupportElements };
   void HandleStoreICHandlerCase(
@@ -231,7 +236,7 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   void KeyedLoadICGeneric(const LoadICParameters* p);
   void KeyedLoadICPolymorphicName(const LoadICParameters* p,
                                   LoadAccessMode access_mode);
-  void StoreIC(const StoreICParameters* p);
+  void StoreIC(const StoreICParameters* p, StoreICMode mode);
   void StoreGlobalIC(const StoreICParameters* p);
   void StoreGlobalIC_PropertyCellCase(TNode<PropertyCell> property_cell,
                                       TNode<Object> value,
@@ -414,8 +419,10 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   // including stub cache header.
   enum StubCacheTable : int;
 
-  TNode<IntPtrT> StubCachePrimaryOffset(TNode<Name> name, TNode<Map> map);
-  TNode<IntPtrT> StubCacheSecondaryOffset(TNode<Name> name,
+  TNode<IntPtrT> StubCachePrimaryOffset(StubCache* stub_cache,
+                                        TNode<Name> name, TNode<Map> map);
+  TNode<IntPtrT> StubCacheSecondaryOffset(StubCache* stub_cache,
+                                          TNode<Name> name,
                                           TNode<IntPtrT> seed);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
@@ -424,6 +431,19 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
                               TVariable<MaybeObject>* var_handler,
                               Label* if_miss);
 
+  // Bumps the StubCache::Stats counter at {counter_offset} of {stub_cache}
+  // while IC statistics are enabled.
+  void IncrementStubCacheStat(StubCache* stub_cache, int counter_offset);
+
+  // Looks up the descriptor of {name} in {map} in the isolate's
+  // DescriptorLookupCache, which the runtime fills on its descriptor searches.
+  // Jumps to {if_miss} unless the cache has an entry for a descriptor that
+  // was found.
+  void TryProbeDescriptorLookupCache(TNode<Map> map, TNode<Name> name,
+                                     Label* if_found,
+                                     TVariable<IntPtrT>* var_name_index,
+                                     Label* if_miss);
+
   void BranchIfPrototypesHaveNoElements(TNode<Map> receiver_map,
                                         Label* definitely_no_elements,
                                         Label* possibly_elements);
@@ -749,7 +749,9 @@ StubCache* IC::stub_cache() {
 
 void IC::UpdateMegamorphicCache(Handle<Map> map, Handle<Name> name,
                                 const MaybeObjectHandle& handler) {
-  if (!IsAnyHas()) {
+  // StoreOwnIC handlers don't go into the stub cache shared with StoreICs,
+  // since they don't look at the prototype chain.
+  if (!IsAnyHas() && !IsStoreOwnIC()) {
     stub_cache()->Set(*name, *map, *handler);
   }
 }
@@ -912,6 +914,14 @@ Handle<Object> LoadIC::ComputeHandler(LookupIterator* lookup) {
                                               smi_handler);
       }
 
+      // Accessors that read an internal field of the receiver are plain
+      // field loads.
+      if (receiver_is_holder &&
+          Accessors::IsInternalFieldAccessor(map, accessors, &index)) {
+        TRACE_HANDLER_STATS(isolate(), LoadIC_LoadFieldDH);
+        return LoadHandler::LoadField(isolate(), index);
+      }
+
       Handle<AccessorInfo> info = Handle<AccessorInfo>::cast(accessors);
 
       if (v8::ToCData<Address>(info->getter()) == kNullAddress ||
@@ -1365,8 +1375,54 @@ MaybeHandle<Object> KeyedLoadIC::Load(Handle<Object> object,
   return RuntimeLoad(object, key);
 }
 
+namespace {
+
+// StoreOwnICs initialize object literals and class fields, so they define an
+// own data property instead of doing a [[Set]].
+Maybe<bool> DefineOwnDataProperty(Isolate* isolate, Handle<Object> object,
+                                  Handle<Name> name, Handle<Object> value) {
+  LookupIterator::Key key(isolate, name);
+  LookupIterator it(isolate, object, key, LookupIterator::OWN);
+  return JSReceiver::CreateDataProperty(&it, value, Just(kThrowOnError));
+}
+
+}  // namespace
+
+bool StoreIC::LookupForDefine(LookupIterator* it, Handle<Object> value,
+                              StoreOrigin store_origin) {
+  // Only cache handlers where defining the property has the same effect as
+  // storing it: the receiver either gets a new property through a map
+  // transition, or already has a plain writable, enumerable and configurable
+  // data property. Everything else is left to the runtime.
+  Handle<Object> object = it->GetReceiver();
+  if (!object->IsJSObject() || object->IsJSGlobalProxy() ||
+      object->IsJSGlobalObject()) {
+    return false;
+  }
+  Handle<JSObject> receiver = Handle<JSObject>::cast(object);
+  DCHECK(!receiver->map().is_deprecated());
+
+  switch (it->state()) {
+    case LookupIterator::NOT_FOUND:
+      if (it->ExtendingNonExtensible(receiver)) return false;
+      it->PrepareTransitionToDataProperty(receiver, value, NONE, store_origin);
+      return it->IsCacheableTransition();
+    case LookupIterator::DATA:
+      if (it->property_attributes() != NONE) return false;
+      it->PrepareForDataProperty(value);
+      // The previous receiver map might just have been deprecated, so reload
+      // it.
+      update_receiver_map(receiver);
+      return true;
+    default:
+      return false;
+  }
+}
+
 bool StoreIC::LookupForWrite(LookupIterator* it, Handle<Object> value,
                              StoreOrigin store_origin) {
+  if (IsStoreOwnIC()) return LookupForDefine(it, value, store_origin);
+
   // Disable ICs for non-JSObjects for now.
   Handle<Object> object = it->GetReceiver();
   if (object->IsJSProxy()) return true;
@@ -1516,6 +1572,10 @@ MaybeHandle<Object> StoreIC::Store(Handle<Object> object, Handle<Name> name,
   // TODO(verwaest): Let SetProperty do the migration, since storing a property
   // might deprecate the current map again, if value does not fit.
   if (MigrateDeprecated(isolate(), object)) {
+    if (IsStoreOwnIC()) {
+      MAYBE_RETURN_NULL(DefineOwnDataProperty(isolate(), object, name, value));
+      return value;
+    }
     LookupIterator::Key key(isolate(), name);
     LookupIterator it(isolate(), object, key);
     MAYBE_RETURN_NULL(Object::SetProperty(&it, value, StoreOrigin::kNamed));
@@ -1538,7 +1598,9 @@ MaybeHandle<Object> StoreIC::Store(Handle<Object> object, Handle<Name> name,
 
   JSObject::MakePrototypesFast(object, kStartAtPrototype, isolate());
   LookupIterator::Key key(isolate(), name);
-  LookupIterator it(isolate(), object, key);
+  LookupIterator it(
+      isolate(), object, key,
+      IsStoreOwnIC() ? LookupIterator::OWN : LookupIterator::DEFAULT);
 
   if (name->IsPrivate()) {
     if (name->IsPrivateName() && !it.IsFound()) {
@@ -1562,6 +1624,11 @@ MaybeHandle<Object> StoreIC::Store(Handle<Object> object, Handle<Name> name,
                       : TraceIC("StoreIC", name);
   }
 
+  if (IsStoreOwnIC()) {
+    // {it} may have been advanced to a transition by UpdateCaches.
+    MAYBE_RETURN_NULL(DefineOwnDataProperty(isolate(), object, name, value));
+    return value;
+  }
   MAYBE_RETURN_NULL(Object::SetProperty(&it, value, store_origin));
   return value;
 }
@@ -1581,6 +1648,13 @@ void StoreIC::UpdateCaches(LookupIterator* lookup, Handle<Object> value,
       }
     }
     handler = ComputeHandler(lookup);
+  } else if (IsStoreOwnIC()) {
+    // The slow handler does a [[Set]], so StoreOwnICs go megamorphic
+    // instead, which defines the property in the runtime.
+    set_slow_stub_reason("LookupForDefine said 'false'");
+    ConfigureVectorState(MEGAMORPHIC, lookup->GetName());
+    TraceIC("StoreIC", lookup->GetName());
+    return;
   } else {
     set_slow_stub_reason("LookupForWrite said 'false'");
     handler = MaybeObjectHandle(StoreHandler::StoreSlow(isolate()));
@@ -2634,8 +2708,13 @@ RUNTIME_FUNCTION(Runtime_ElementsTransitionAndStoreIC_Miss) {
 static bool CanFastCloneObject(Handle<Map> map) {
   DisallowHeapAllocation no_gc;
   if (map->IsNullOrUndefinedMap()) return true;
+  // The elements backing store is copied as is, so any fast elements kind
+  // works. Non-extensible, sealed and frozen elements are stored in a plain
+  // FixedArray and end up as HOLEY_ELEMENTS in the clone.
+  ElementsKind elements_kind = map->elements_kind();
   if (!map->IsJSObjectMap() ||
-      !IsSmiOrObjectElementsKind(map->elements_kind()) ||
+      !(IsFastElementsKind(elements_kind) ||
+        IsAnyNonextensibleElementsKind(elements_kind)) ||
       !map->OnlyHasSimpleProperties()) {
     return false;
   }
@@ -2673,6 +2752,14 @@ static Handle<Map> FastCloneObjectMap(Isolate* isolate, Handle<Map> source_map,
                               unused);
   }
 
+  if (source_map->IsJSObjectMap() &&
+      IsDoubleElementsKind(source_map->elements_kind())) {
+    if (map.is_identical_to(initial_map)) {
+      map = Map::Copy(isolate, map, "ObjectWithDoubleElements");
+    }
+    map->set_elements_kind(source_map->elements_kind());
+  }
+
   if (flags & ObjectLiteral::kHasNullPrototype) {
     if (map.is_identical_to(initial_map)) {
       map = Map::Copy(isolate, map, "ObjectWithNullProto");
@@ -2698,6 +2785,7 @@ static Handle<Map> FastCloneObjectMap(Isolate* isolate, Handle<Map> source_map,
   Handle<LayoutDescriptor> layout =
       LayoutDescriptor::New(isolate, map, descriptors, size);
   map->InitializeDescriptors(isolate, *descriptors, *layout);
+  Map::InheritEnumCache(isolate, source_map, map);
   map->CopyUnusedPropertyFieldsAdjustedForInstanceSize(*source_map);
 
   // Update bitfields
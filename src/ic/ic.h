@@ -266,6 +266,9 @@ class StoreIC : public IC {
                     StoreOrigin store_origin);
 
  private:
+  // Variant of LookupForWrite for StoreOwnICs, which define the property.
+  bool LookupForDefine(LookupIterator* it, Handle<Object> value,
+                       StoreOrigin store_origin);
   MaybeObjectHandle ComputeHandler(LookupIterator* lookup);
 
   friend class IC;
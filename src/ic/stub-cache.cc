@@ -4,6 +4,8 @@
 
 #include "src/ic/stub-cache.h"
 
+#include <algorithm>
+
 #include "src/ast/ast.h"
 #include "src/base/bits.h"
 #include "src/heap/heap-inl.h"  // For InYoungGeneration().
@@ -14,15 +16,32 @@
 namespace v8 {
 namespace internal {
 
-StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
+namespace {
+
+int TableSize(int table_bits) {
+  return 1 << std::max(1, std::min(table_bits, StubCache::kMaxTableBits));
+}
+
+}  // namespace
+
+StubCache::StubCache(Isolate* isolate, int primary_table_bits,
+                     int secondary_table_bits)
+    : primary_table_size_(TableSize(primary_table_bits)),
+      secondary_table_size_(TableSize(secondary_table_bits)),
+      primary_mask_((primary_table_size_ - 1) << kCacheIndexShift),
+      secondary_mask_((secondary_table_size_ - 1) << kCacheIndexShift),
+      primary_(new Entry[primary_table_size_]),
+      secondary_(new Entry[secondary_table_size_]),
+      stats_(),
+      isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(MaybeObject()));
 }
 
 void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo(primary_table_size_));
+  DCHECK(base::bits::IsPowerOfTwo(secondary_table_size_));
   Clear();
 }
 
@@ -40,7 +59,7 @@ int StubCache::PrimaryOffset(Name name, Map map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kMapKeyShift));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -50,7 +69,7 @@ int StubCache::SecondaryOffset(Name name, int seed) {
   // Use the seed from the primary cache in the secondary cache.
   uint32_t name_low32bits = static_cast<uint32_t>(name.ptr());
   uint32_t key = (seed - name_low32bits) + kSecondaryMagic;
-  return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+  return key & secondary_mask_;
 }
 
 int StubCache::PrimaryOffsetForTesting(Name name, Map map) {
@@ -84,7 +103,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
 
   // Compute the primary entry.
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = entry(primary_.get(), primary_offset);
   MaybeObject old_handler(
       TaggedValue::ToMaybeObject(isolate(), primary->value));
   // If the primary entry has useful data in it, we retire it to the
@@ -99,7 +118,7 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
         old_map);
     int secondary_offset = SecondaryOffset(
         Name::cast(StrongTaggedValue::ToObject(isolate(), primary->key)), seed);
-    Entry* secondary = entry(secondary_, secondary_offset);
+    Entry* secondary = entry(secondary_.get(), secondary_offset);
     *secondary = *primary;
   }
 
@@ -113,12 +132,12 @@ void StubCache::Set(Name name, Map map, MaybeObject handler) {
 MaybeObject StubCache::Get(Name name, Map map) {
   DCHECK(CommonStubCacheChecks(this, name, map, MaybeObject()));
   int primary_offset = PrimaryOffset(name, map);
-  Entry* primary = entry(primary_, primary_offset);
+  Entry* primary = entry(primary_.get(), primary_offset);
   if (primary->key == name && primary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), primary->value);
   }
   int secondary_offset = SecondaryOffset(name, primary_offset);
-  Entry* secondary = entry(secondary_, secondary_offset);
+  Entry* secondary = entry(secondary_.get(), secondary_offset);
   if (secondary->key == name && secondary->map == map) {
     return TaggedValue::ToMaybeObject(isolate(), secondary->value);
   }
@@ -129,17 +148,30 @@ void StubCache::Clear() {
   MaybeObject empty = MaybeObject::FromObject(
       isolate_->builtins()->builtin(Builtins::kIllegal));
   Name empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_table_size_; i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_table_size_; j++) {
     secondary_[j].key = StrongTaggedValue(empty_string);
     secondary_[j].map = StrongTaggedValue(Smi::zero());
     secondary_[j].value = TaggedValue(empty);
   }
 }
 
+void StubCache::PrintStats(const char* name) {
+  uint32_t hits = stats_.primary_hits + stats_.secondary_hits;
+  uint32_t probes = hits + stats_.misses;
+  PrintF("=== %s stub cache (%d + %d entries) ===\n", name,
+         primary_table_size_, secondary_table_size_);
+  PrintF("  probes: %u, primary hits: %u, secondary hits: %u, misses: %u",
+         probes, stats_.primary_hits, stats_.secondary_hits, stats_.misses);
+  if (probes > 0) {
+    PrintF(" (hit rate %.1f%%)", 100.0 * hits / probes);
+  }
+  PrintF("\n");
+}
+
 }  // namespace internal
 }  // namespace v8
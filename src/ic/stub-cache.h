@@ -5,6 +5,8 @@
 #ifndef V8_IC_STUB_CACHE_H_
 #define V8_IC_STUB_CACHE_H_
 
+#include <memory>
+
 #include "src/objects/name.h"
 #include "src/objects/tagged-value.h"
 
@@ -15,6 +17,11 @@ namespace internal {
 // It maps (map, name, type) to property access handlers. The cache does not
 // need explicit invalidation when a prototype chain is modified, since the
 // handlers verify the chain.
+//
+// The sizes of the tables are chosen per isolate when the cache is created
+// (see --stub-cache-primary-table-bits and --stub-cache-secondary-table-bits).
+// Generated code loads the table masks from the cache instead of embedding
+// them, so that the embedded builtins work with any table size.
 
 
 class SCTableReference {
@@ -42,6 +49,14 @@ class V8_EXPORT_PRIVATE StubCache {
     StrongTaggedValue map;
   };
 
+  // Hit and miss counts of the probes done by generated code. These are only
+  // updated while IC statistics are enabled (see TracingFlags::ic_stats).
+  struct Stats {
+    uint32_t primary_hits;
+    uint32_t secondary_hits;
+    uint32_t misses;
+  };
+
   void Initialize();
   // Access cache for entry hash(name, map).
   void Set(Name name, Map map, MaybeObject handler);
@@ -66,16 +81,35 @@ class V8_EXPORT_PRIVATE StubCache {
         reinterpret_cast<Address>(&first_entry(table)->value));
   }
 
+  // The mask that turns a hash into an offset into {table}, i.e. the table
+  // size minus one, scaled by 1 << kCacheIndexShift.
+  SCTableReference mask_reference(StubCache::Table table) {
+    return SCTableReference(reinterpret_cast<Address>(
+        table == kPrimary ? &primary_mask_ : &secondary_mask_));
+  }
+
+  SCTableReference stats_reference() {
+    return SCTableReference(reinterpret_cast<Address>(&stats_));
+  }
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
-        return StubCache::primary_;
+        return StubCache::primary_.get();
       case StubCache::kSecondary:
-        return StubCache::secondary_;
+        return StubCache::secondary_.get();
     }
     UNREACHABLE();
   }
 
+  int primary_table_size() const { return primary_table_size_; }
+  int secondary_table_size() const { return secondary_table_size_; }
+
+  const Stats& stats() const { return stats_; }
+  void ResetStats() { stats_ = Stats(); }
+  // Prints the statistics gathered for this cache, prefixed by {name}.
+  void PrintStats(const char* name);
+
   Isolate* isolate() { return isolate_; }
 
   // Setting kCacheIndexShift to Name::kHashShift is convenient because it
@@ -85,23 +119,25 @@ class V8_EXPORT_PRIVATE StubCache {
   // the STATIC_ASSERT below, in {entry(...)}).
   static const int kCacheIndexShift = Name::kHashShift;
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  static const int kDefaultPrimaryTableBits = 11;
+  static const int kDefaultSecondaryTableBits = 9;
+  // Keeps the scaled offsets within 32 bits.
+  static const int kMaxTableBits = 16;
 
   // We compute the hash code for a map as follows:
   //   <code> = <address> ^ (<address> >> kMapKeyShift)
-  static const int kMapKeyShift = kPrimaryTableBits + kCacheIndexShift;
+  static const int kMapKeyShift = kDefaultPrimaryTableBits + kCacheIndexShift;
 
   // Some magic number used in the secondary hash computation.
   static const int kSecondaryMagic = 0xb16ca6e5;
 
-  static int PrimaryOffsetForTesting(Name name, Map map);
-  static int SecondaryOffsetForTesting(Name name, int seed);
+  int PrimaryOffsetForTesting(Name name, Map map);
+  int SecondaryOffsetForTesting(Name name, int seed);
 
   // The constructor is made public only for the purposes of testing.
-  explicit StubCache(Isolate* isolate);
+  explicit StubCache(Isolate* isolate,
+                     int primary_table_bits = kDefaultPrimaryTableBits,
+                     int secondary_table_bits = kDefaultSecondaryTableBits);
 
  private:
   // The stub cache has a primary and secondary level.  The two levels have
@@ -114,12 +150,12 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name name, Map map);
+  int PrimaryOffset(Name name, Map map);
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name name, int seed);
+  int SecondaryOffset(Name name, int seed);
 
   // Compute the entry for a given offset in exactly the same way as
   // we do in generated code.  We generate an hash code that already
@@ -136,8 +172,14 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  const int primary_table_size_;
+  const int secondary_table_size_;
+  // The masks are read by generated code, see mask_reference().
+  uint32_t primary_mask_;
+  uint32_t secondary_mask_;
+  std::unique_ptr<Entry[]> primary_;
+  std::unique_ptr<Entry[]> secondary_;
+  Stats stats_;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -3,15 +3,61 @@
 // found in the LICENSE file.
 
 #include "src/init/isolate-allocator.h"
+
+#include <vector>
+
 #include "src/base/bounded-page-allocator.h"
+#include "src/base/lazy-instance.h"
+#include "src/base/platform/mutex.h"
 #include "src/common/ptr-compr.h"
 #include "src/execution/isolate.h"
+#include "src/flags/flags.h"
 #include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
 namespace internal {
 
+#if V8_TARGET_ARCH_64_BIT
+namespace {
+
+// Process-wide cache of pointer-compression cage reservations of disposed
+// isolates. Reusing a reservation avoids the costly reservation of a properly
+// aligned region in InitReservation() for isolates that are created and
+// disposed at high rates.
+class ReservationCache {
+ public:
+  // Takes ownership of |reservation| unless the cache is full.
+  void TryAdd(VirtualMemory* reservation) {
+    base::MutexGuard guard(&mutex_);
+    if (reservations_.size() >= FLAG_isolate_reservation_cache_size) return;
+    reservations_.push_back(std::move(*reservation));
+  }
+
+  bool TryGet(VirtualMemory* reservation) {
+    base::MutexGuard guard(&mutex_);
+    if (reservations_.empty()) return false;
+    *reservation = std::move(reservations_.back());
+    reservations_.pop_back();
+    return true;
+  }
+
+  void Clear() {
+    base::MutexGuard guard(&mutex_);
+    // Destroying the VirtualMemory objects frees the reservations.
+    reservations_.clear();
+  }
+
+ private:
+  base::Mutex mutex_;
+  std::vector<VirtualMemory> reservations_;
+};
+
+DEFINE_LAZY_LEAKY_OBJECT_GETTER(ReservationCache, GetReservationCache)
+
+}  // namespace
+#endif  // V8_TARGET_ARCH_64_BIT
+
 IsolateAllocator::IsolateAllocator(IsolateAllocationMode mode) {
 #if V8_TARGET_ARCH_64_BIT
   if (mode == IsolateAllocationMode::kInV8Heap) {
@@ -30,7 +76,19 @@ IsolateAllocator::IsolateAllocator(IsolateAllocationMode mode) {
 
 IsolateAllocator::~IsolateAllocator() {
   if (reservation_.IsReserved()) {
-    // The actual memory will be freed when the |reservation_| will die.
+#if V8_TARGET_ARCH_64_BIT
+    // All heap pages have been returned to the bounded page allocator at this
+    // point, so the whole reservation can be handed to another isolate once
+    // the Isolate object's pages are uncommitted.
+    if (FLAG_isolate_reservation_cache_size > 0 &&
+        reservation_.SetPermissions(reservation_.address(),
+                                    reservation_.size(),
+                                    PageAllocator::kNoAccess)) {
+      GetReservationCache()->TryAdd(&reservation_);
+    }
+#endif  // V8_TARGET_ARCH_64_BIT
+    // Otherwise, the actual memory will be freed when the |reservation_| will
+    // die.
     return;
   }
 
@@ -66,6 +124,17 @@ Address IsolateAllocator::InitReservation() {
       kPtrComprHeapReservationSize + kIsolateRootBiasPageSize;
   const size_t base_alignment = kPtrComprIsolateRootAlignment;
 
+  // Cached reservations may be overreserved and are handled like the
+  // overreserved case below.
+  if (GetReservationCache()->TryGet(&reservation_)) {
+    Address address =
+        RoundUp(reservation_.address() + kIsolateRootBiasPageSize,
+                base_alignment) -
+        kIsolateRootBiasPageSize;
+    CHECK(reservation_.InVM(address, reservation_size));
+    return address;
+  }
+
   const int kMaxAttempts = 4;
   for (int attempt = 0; attempt < kMaxAttempts; ++attempt) {
     Address hint = RoundDown(reinterpret_cast<Address>(
@@ -194,5 +263,12 @@ void IsolateAllocator::CommitPagesForIsolate(Address heap_reservation_address) {
 }
 #endif  // V8_TARGET_ARCH_64_BIT
 
+// static
+void IsolateAllocator::ReleaseCachedReservations() {
+#if V8_TARGET_ARCH_64_BIT
+  GetReservationCache()->Clear();
+#endif  // V8_TARGET_ARCH_64_BIT
+}
+
 }  // namespace internal
 }  // namespace v8
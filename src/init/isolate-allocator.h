@@ -46,6 +46,10 @@ class V8_EXPORT_PRIVATE IsolateAllocator final {
                                      : IsolateAllocationMode::kInCppHeap;
   }
 
+  // Frees the reservations of disposed isolates that are kept for reuse, see
+  // --isolate-reservation-cache-size.
+  static void ReleaseCachedReservations();
+
  private:
   Address InitReservation();
   void CommitPagesForIsolate(Address heap_reservation_address);
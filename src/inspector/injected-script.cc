@@ -341,22 +341,40 @@ InjectedScript::~InjectedScript() { discardEvaluateCallbacks(); }
 namespace {
 class PropertyAccumulator : public ValueMirror::PropertyAccumulator {
  public:
-  explicit PropertyAccumulator(std::vector<PropertyMirror>* mirrors)
-      : m_mirrors(mirrors) {}
+  PropertyAccumulator(std::vector<PropertyMirror>* mirrors, size_t skipCount,
+                      size_t pageSize, bool* hasMore)
+      : m_mirrors(mirrors),
+        m_skipCount(skipCount),
+        m_pageSize(pageSize),
+        m_hasMore(hasMore) {}
+  bool Skip() override {
+    if (m_skipCount == 0) return false;
+    --m_skipCount;
+    return true;
+  }
   bool Add(PropertyMirror mirror) override {
+    if (Skip()) return true;
+    if (m_mirrors->size() == m_pageSize) {
+      *m_hasMore = true;
+      return false;
+    }
     m_mirrors->push_back(std::move(mirror));
     return true;
   }
 
  private:
   std::vector<PropertyMirror>* m_mirrors;
+  size_t m_skipCount;
+  size_t m_pageSize;
+  bool* m_hasMore;
 };
 }  // anonymous namespace
 
 Response InjectedScript::getProperties(
     v8::Local<v8::Object> object, const String16& groupName, bool ownProperties,
-    bool accessorPropertiesOnly, WrapMode wrapMode,
-    std::unique_ptr<Array<PropertyDescriptor>>* properties,
+    bool accessorPropertiesOnly, size_t skipCount, size_t pageSize,
+    WrapMode wrapMode, std::unique_ptr<Array<PropertyDescriptor>>* properties,
+    bool* hasMore,
     Maybe<protocol::Runtime::ExceptionDetails>* exceptionDetails) {
   v8::HandleScope handles(m_context->isolate());
   v8::Local<v8::Context> context = m_context->context();
@@ -366,7 +384,7 @@ Response InjectedScript::getProperties(
 
   *properties = std::make_unique<Array<PropertyDescriptor>>();
   std::vector<PropertyMirror> mirrors;
-  PropertyAccumulator accumulator(&mirrors);
+  PropertyAccumulator accumulator(&mirrors, skipCount, pageSize, hasMore);
   if (!ValueMirror::getProperties(context, object, ownProperties,
                                   accessorPropertiesOnly, &accumulator)) {
     return createExceptionDetails(tryCatch, groupName, exceptionDetails);
@@ -32,6 +32,8 @@
 
 #include <inttypes.h>
 
+#include <limits>
+
 #include "../../third_party/inspector_protocol/crdtp/json.h"
 #include "src/debug/debug-interface.h"
 #include "src/inspector/injected-script.h"
@@ -401,16 +403,28 @@ void V8RuntimeAgentImpl::callFunctionOn(
 Response V8RuntimeAgentImpl::getProperties(
     const String16& objectId, Maybe<bool> ownProperties,
     Maybe<bool> accessorPropertiesOnly, Maybe<bool> generatePreview,
+    Maybe<int> skipCount, Maybe<int> pageSize,
     std::unique_ptr<protocol::Array<protocol::Runtime::PropertyDescriptor>>*
         result,
     Maybe<protocol::Array<protocol::Runtime::InternalPropertyDescriptor>>*
         internalProperties,
     Maybe<protocol::Array<protocol::Runtime::PrivatePropertyDescriptor>>*
         privateProperties,
-    Maybe<protocol::Runtime::ExceptionDetails>* exceptionDetails) {
+    Maybe<protocol::Runtime::ExceptionDetails>* exceptionDetails,
+    Maybe<bool>* hasMore) {
   using protocol::Runtime::InternalPropertyDescriptor;
   using protocol::Runtime::PrivatePropertyDescriptor;
 
+  if (skipCount.fromMaybe(0) < 0)
+    return Response::ServerError("skipCount must be non-negative");
+  if (pageSize.isJust() && pageSize.fromJust() <= 0)
+    return Response::ServerError("pageSize must be positive");
+  if ((skipCount.isJust() || pageSize.isJust()) &&
+      accessorPropertiesOnly.fromMaybe(false)) {
+    return Response::ServerError(
+        "Paging is not supported with accessorPropertiesOnly");
+  }
+
   InjectedScript::ObjectScope scope(m_session, objectId);
   Response response = scope.initialize();
   if (!response.IsSuccess()) return response;
@@ -422,14 +436,19 @@ Response V8RuntimeAgentImpl::getProperties(
     return Response::ServerError("Value with given id is not an object");
 
   v8::Local<v8::Object> object = scope.object().As<v8::Object>();
+  bool more = false;
   response = scope.injectedScript()->getProperties(
       object, scope.objectGroupName(), ownProperties.fromMaybe(false),
-      accessorPropertiesOnly.fromMaybe(false),
+      accessorPropertiesOnly.fromMaybe(false), skipCount.fromMaybe(0),
+      pageSize.isJust() ? static_cast<size_t>(pageSize.fromJust())
+                        : std::numeric_limits<size_t>::max(),
       generatePreview.fromMaybe(false) ? WrapMode::kWithPreview
                                        : WrapMode::kNoPreview,
-      result, exceptionDetails);
+      result, &more, exceptionDetails);
   if (!response.IsSuccess()) return response;
-  if (exceptionDetails->isJust() || accessorPropertiesOnly.fromMaybe(false))
+  if (pageSize.isJust()) *hasMore = more;
+  if (exceptionDetails->isJust() || accessorPropertiesOnly.fromMaybe(false) ||
+      skipCount.fromMaybe(0) > 0)
     return Response::Success();
   std::unique_ptr<protocol::Array<InternalPropertyDescriptor>>
       internalPropertiesProtocolArray;
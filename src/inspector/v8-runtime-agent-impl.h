@@ -85,13 +85,15 @@ class V8RuntimeAgentImpl : public protocol::Runtime::Backend {
   Response getProperties(
       const String16& objectId, Maybe<bool> ownProperties,
       Maybe<bool> accessorPropertiesOnly, Maybe<bool> generatePreview,
+      Maybe<int> skipCount, Maybe<int> pageSize,
       std::unique_ptr<protocol::Array<protocol::Runtime::PropertyDescriptor>>*
           result,
       Maybe<protocol::Array<protocol::Runtime::InternalPropertyDescriptor>>*
           internalProperties,
       Maybe<protocol::Array<protocol::Runtime::PrivatePropertyDescriptor>>*
           privateProperties,
-      Maybe<protocol::Runtime::ExceptionDetails>*) override;
+      Maybe<protocol::Runtime::ExceptionDetails>*,
+      Maybe<bool>* hasMore) override;
   Response releaseObjectGroup(const String16& objectGroup) override;
   Response runIfWaitingForDebugger() override;
   Response setCustomObjectFormatterEnabled(bool) override;
@@ -255,6 +255,7 @@ String16 descriptionForRegExp(v8::Isolate* isolate,
   v8::RegExp::Flags flags = value->GetFlags();
   if (flags & v8::RegExp::Flags::kGlobal) description.append('g');
   if (flags & v8::RegExp::Flags::kIgnoreCase) description.append('i');
+  if (flags & v8::RegExp::Flags::kLinear) description.append('l');
   if (flags & v8::RegExp::Flags::kMultiline) description.append('m');
   if (flags & v8::RegExp::Flags::kDotAll) description.append('s');
   if (flags & v8::RegExp::Flags::kUnicode) description.append('u');
@@ -1420,6 +1421,7 @@ bool ValueMirror::getProperties(v8::Local<v8::Context> context,
     if (result.IsNothing()) return false;
     if (result.FromJust()) continue;
     if (!set->Add(context, v8Name).ToLocal(&set)) return false;
+    if (accumulator->Skip()) continue;
 
     String16 name;
     std::unique_ptr<ValueMirror> symbolMirror;
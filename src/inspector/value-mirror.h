@@ -70,6 +70,9 @@ class ValueMirror {
   class PropertyAccumulator {
    public:
     virtual ~PropertyAccumulator() = default;
+    // Called before the value of a property is looked up. Returning true
+    // drops the property without the cost of creating its mirrors.
+    virtual bool Skip() { return false; }
     virtual bool Add(PropertyMirror mirror) = 0;
   };
   static bool getProperties(v8::Local<v8::Context> context,
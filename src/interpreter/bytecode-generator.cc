@@ -2441,6 +2441,23 @@ void BytecodeGenerator::VisitInitializeClassMembersStatement(
     DCHECK_IMPLIES(property->is_private(),
                    property->kind() == ClassLiteral::Property::FIELD);
 
+    if (property->kind() == ClassLiteral::Property::FIELD &&
+        !property->is_private() && !property->is_computed_name() &&
+        property->key()->AsLiteral()->IsPropertyName()) {
+      // Public fields with a literal name are defined by the StoreOwnIC, which
+      // caches the instance's map transition.
+      builder()->SetExpressionAsStatementPosition(property->value());
+      VisitForRegisterValue(property->value(), value);
+      VisitSetHomeObject(value, constructor, property);
+      FeedbackSlot slot = feedback_spec()->AddStoreOwnICSlot();
+      builder()
+          ->LoadAccumulatorWithRegister(value)
+          .StoreNamedOwnProperty(
+              constructor, property->key()->AsLiteral()->AsRawPropertyName(),
+              feedback_index(slot));
+      continue;
+    }
+
     if (property->is_computed_name()) {
       DCHECK_EQ(property->kind(), ClassLiteral::Property::FIELD);
       DCHECK(!property->is_private());
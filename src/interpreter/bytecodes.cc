@@ -270,11 +270,15 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kLdaTheHole:
       case Bytecode::kLdaConstant:
       case Bytecode::kLdaUndefined:
+      case Bytecode::kLdaTrue:
+      case Bytecode::kLdaFalse:
       case Bytecode::kLdaGlobal:
       case Bytecode::kLdaNamedProperty:
       case Bytecode::kLdaKeyedProperty:
       case Bytecode::kLdaContextSlot:
       case Bytecode::kLdaCurrentContextSlot:
+      case Bytecode::kLdaImmutableContextSlot:
+      case Bytecode::kLdaImmutableCurrentContextSlot:
       case Bytecode::kAdd:
       case Bytecode::kSub:
       case Bytecode::kMul:
@@ -295,6 +299,12 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kCallUndefinedReceiver2:
       case Bytecode::kConstruct:
       case Bytecode::kConstructWithSpread:
+      case Bytecode::kCallRuntime:
+      case Bytecode::kCreateClosure:
+      case Bytecode::kCreateArrayLiteral:
+      case Bytecode::kCreateEmptyArrayLiteral:
+      case Bytecode::kCreateObjectLiteral:
+      case Bytecode::kCreateEmptyObjectLiteral:
         return true;
       default:
         return false;
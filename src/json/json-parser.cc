@@ -4,6 +4,7 @@
 
 #include "src/json/json-parser.h"
 
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/debug/debug.h"
 #include "src/numbers/conversions.h"
@@ -115,6 +116,82 @@ static const constexpr uint8_t character_json_scan_flags[256] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Helpers for checking a machine word of characters at once, see
+// JsonParser::ScanJsonString. They may report characters that are not there,
+// but never miss one that is. Same technique as NonAsciiStart.
+template <typename Char>
+struct JsonCharWord {
+  static constexpr int kCharsPerWord = sizeof(uintptr_t) / sizeof(Char);
+  static constexpr uintptr_t kOneInEveryChar =
+      kUintptrAllBitsSet / std::numeric_limits<Char>::max();
+  static constexpr uintptr_t kHighBitInEveryChar =
+      kOneInEveryChar << (kBitsPerByte * sizeof(Char) - 1);
+
+  static uintptr_t Read(const Char* chars) {
+    return base::ReadUnalignedValue<uintptr_t>(
+        reinterpret_cast<Address>(chars));
+  }
+  // Returns true if a character in |word| is less than |limit|. Requires all
+  // characters of |word| to be one-byte.
+  static bool HasCharLessThan(uintptr_t word, uint8_t limit) {
+    return (word - kOneInEveryChar * limit) & ~word & kHighBitInEveryChar;
+  }
+  static bool HasChar(uintptr_t word, uint8_t c) {
+    return HasCharLessThan(word ^ (kOneInEveryChar * c), 1);
+  }
+  // Returns true if |word| may contain a character for which
+  // MayTerminateJsonString holds, or a two-byte character.
+  static bool MayTerminateString(uintptr_t word) {
+    if (sizeof(Char) == 2 && (word & (kOneInEveryChar * 0xFF00)) != 0) {
+      return true;
+    }
+    return HasCharLessThan(word, 0x20) || HasChar(word, '"') ||
+           HasChar(word, '\\');
+  }
+};
+
+// Computes the value of a JSON number without exponent and with at most 15
+// digits. Both the digits as an integer and the power of ten to divide them
+// by are then exact doubles, so a single IEEE division rounds correctly.
+// Returns false for all other numbers.
+template <typename Char>
+bool TryParseShortJsonDecimal(Vector<const Char> chars, double* result) {
+#if (V8_TARGET_ARCH_IA32 || defined(USE_SIMULATOR)) && !defined(_MSC_VER)
+  // Double rounding on the x87 stack makes the division inexact, see
+  // DoubleStrtod.
+  return false;
+#else
+  static constexpr int kMaxExactDoubleDigits = 15;
+  static constexpr double kExactPowersOfTen[] = {
+      1e0, 1e1, 1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+      1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15};
+  STATIC_ASSERT(arraysize(kExactPowersOfTen) == kMaxExactDoubleDigits + 1);
+
+  int i = 0;
+  bool negative = chars[0] == '-';
+  if (negative) i++;
+  uint64_t digits = 0;
+  int digit_count = 0;
+  int fraction_start = -1;
+  for (; i < chars.length(); i++) {
+    Char c = chars[i];
+    if (c == '.') {
+      fraction_start = digit_count;
+      continue;
+    }
+    // Exponents take the slow path.
+    if (!IsDecimalDigit(c)) return false;
+    if (++digit_count > kMaxExactDoubleDigits) return false;
+    digits = digits * 10 + (c - '0');
+  }
+  int fraction_digits = fraction_start < 0 ? 0 : digit_count - fraction_start;
+  double value =
+      static_cast<double>(digits) / kExactPowersOfTen[fraction_digits];
+  *result = negative ? -value : value;
+  return true;
+#endif
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -399,6 +476,32 @@ Handle<Map> ParentOfDescriptorOwner(Isolate* isolate, Handle<Map> maybe_root,
 }
 }  // namespace
 
+template <typename Char>
+Handle<Map> JsonParser<Char>::FindObjectFeedback(
+    int named_length, const std::vector<Handle<Object>>& element_stack,
+    size_t first_element) {
+  DCHECK_LT(first_element, element_stack.size());
+  // Prefer the previous sibling's map. If it has a different number of
+  // properties, arrays of records with optional properties often still share
+  // the first element's shape.
+  Handle<Map> feedback;
+  for (size_t index : {element_stack.size() - 1, first_element}) {
+    Object element = *element_stack[index];
+    if (!element.IsJSObject()) continue;
+    Map map = JSObject::cast(element).map();
+    // Don't consume feedback from objects with a map that's detached
+    // from the transition tree.
+    if (map.IsDetached(isolate_)) continue;
+    bool same_size = map.NumberOfOwnDescriptors() == named_length;
+    if (feedback.is_null() || same_size) feedback = handle(map, isolate_);
+    if (same_size) break;
+  }
+  if (!feedback.is_null() && feedback->is_deprecated()) {
+    feedback = Map::Update(isolate_, feedback);
+  }
+  return feedback;
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonObject(
     const JsonContinuation& cont,
@@ -833,17 +936,12 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue() {
           Handle<Map> feedback;
           if (cont_stack.size() > 0 &&
               cont_stack.back().type() == JsonContinuation::kArrayElement &&
-              cont_stack.back().index < element_stack.size() &&
-              element_stack.back()->IsJSObject()) {
-            Map maybe_feedback = JSObject::cast(*element_stack.back()).map();
-            // Don't consume feedback from objects with a map that's detached
-            // from the transition tree.
-            if (!maybe_feedback.IsDetached(isolate_)) {
-              feedback = handle(maybe_feedback, isolate_);
-              if (feedback->is_deprecated()) {
-                feedback = Map::Update(isolate_, feedback);
-              }
-            }
+              cont_stack.back().index < element_stack.size()) {
+            int named_length = static_cast<int>(property_stack.size() -
+                                                cont.index) -
+                               cont.elements;
+            feedback = FindObjectFeedback(named_length, element_stack,
+                                          cont_stack.back().index);
           }
           value = BuildJsonObject(cont, property_stack, feedback);
           property_stack.resize(cont.index);
@@ -969,9 +1067,11 @@ Handle<Object> JsonParser<Char>::ParseJsonNumber() {
     }
 
     Vector<const Char> chars(start, cursor_ - start);
-    number = StringToDouble(chars,
-                            NO_FLAGS,  // Hex, octal or trailing junk.
-                            std::numeric_limits<double>::quiet_NaN());
+    if (!TryParseShortJsonDecimal(chars, &number)) {
+      number = StringToDouble(chars,
+                              NO_FLAGS,  // Hex, octal or trailing junk.
+                              std::numeric_limits<double>::quiet_NaN());
+    }
 
     DCHECK(!std::isnan(number));
   }
@@ -1126,14 +1226,29 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   bool has_escape = false;
   uc32 bits = 0;
 
+  auto may_terminate = [&bits](Char c) {
+    if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
+      bits |= c;
+      return false;
+    }
+    return MayTerminateJsonString(character_json_scan_flags[c]);
+  };
+
   while (true) {
-    cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
-      if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
-        bits |= c;
-        return false;
+    // Skip whole words of characters that can't terminate the string, then
+    // check the characters of the next word one at a time.
+    using Word = JsonCharWord<Char>;
+    while (true) {
+      while (end_ - cursor_ >= Word::kCharsPerWord &&
+             !Word::MayTerminateString(Word::Read(cursor_))) {
+        cursor_ += Word::kCharsPerWord;
       }
-      return MayTerminateJsonString(character_json_scan_flags[c]);
-    });
+      const Char* word_end = end_ - cursor_ > Word::kCharsPerWord
+                                 ? cursor_ + Word::kCharsPerWord
+                                 : end_;
+      cursor_ = std::find_if(cursor_, word_end, may_terminate);
+      if (cursor_ != word_end || word_end == end_) break;
+    }
 
     if (V8_UNLIKELY(is_at_end())) {
       AllowHeapAllocation allow_before_exception;
@@ -285,6 +285,13 @@ class JsonParser final {
   // one of "true", "false", or "null", or an object or array literal.
   MaybeHandle<Object> ParseJsonValue();
 
+  // Returns the map of a sibling of an object with |named_length| named
+  // properties that is being parsed as an array element, to use as feedback
+  // for BuildJsonObject. |first_element| is the index of the array's first
+  // element on the element stack.
+  Handle<Map> FindObjectFeedback(
+      int named_length, const std::vector<Handle<Object>>& element_stack,
+      size_t first_element);
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const std::vector<JsonProperty>& property_stack, Handle<Map> feedback);
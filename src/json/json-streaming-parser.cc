@@ -0,0 +1,242 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-streaming-parser.h"
+
+#include "src/api/api-inl.h"
+#include "src/execution/isolate.h"
+#include "src/handles/global-handles.h"
+#include "src/heap/factory.h"
+#include "src/json/json-parser.h"
+#include "src/objects/fixed-array-inl.h"
+#include "src/strings/unicode.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+bool IsJsonWhitespace(uint8_t c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+}  // namespace
+
+JsonStreamingParser::JsonStreamingParser(
+    Isolate* isolate, v8::JSON::StreamingParser::Client* client)
+    : isolate_(isolate), client_(client) {
+  if (client_ == nullptr) {
+    elements_ = isolate_->global_handles()->Create(
+        ReadOnlyRoots(isolate_).empty_fixed_array());
+  }
+}
+
+JsonStreamingParser::~JsonStreamingParser() {
+  if (!elements_.is_null()) GlobalHandles::Destroy(elements_.location());
+}
+
+Maybe<bool> JsonStreamingParser::Feed(Vector<const uint8_t> chunk) {
+  DCHECK(state_ != State::kFinished && state_ != State::kFailed);
+  const uint8_t* cursor = chunk.begin();
+  while (cursor != chunk.end()) {
+    switch (state_) {
+      case State::kStart:
+        if (IsJsonWhitespace(*cursor)) {
+          ++cursor;
+        } else if (*cursor == '[') {
+          state_ = State::kArray;
+          ++cursor;
+        } else {
+          state_ = State::kValue;
+        }
+        break;
+      case State::kArray:
+        cursor = ScanArray(chunk, cursor);
+        if (cursor == nullptr) {
+          state_ = State::kFailed;
+          return Nothing<bool>();
+        }
+        break;
+      case State::kAfterArray:
+        if (!IsJsonWhitespace(*cursor)) {
+          ReportUnexpectedByte(*cursor, position_ + (cursor - chunk.begin()));
+          state_ = State::kFailed;
+          return Nothing<bool>();
+        }
+        ++cursor;
+        break;
+      case State::kValue:
+        buffer_.insert(buffer_.end(), cursor, chunk.end());
+        cursor = chunk.end();
+        break;
+      case State::kFinished:
+      case State::kFailed:
+        UNREACHABLE();
+    }
+  }
+  position_ += chunk.size();
+  return Just(true);
+}
+
+const uint8_t* JsonStreamingParser::ScanArray(Vector<const uint8_t> chunk,
+                                              const uint8_t* cursor) {
+  const uint8_t* element_start = cursor;
+  for (; cursor != chunk.end(); ++cursor) {
+    uint8_t c = *cursor;
+    if (in_string_) {
+      if (escaped_) {
+        escaped_ = false;
+      } else if (c == '\\') {
+        escaped_ = true;
+      } else if (c == '"') {
+        in_string_ = false;
+      }
+      continue;
+    }
+    switch (c) {
+      case '"':
+        in_string_ = true;
+        break;
+      case '[':
+      case '{':
+        depth_++;
+        break;
+      case '}':
+        if (depth_ == 0) {
+          ReportUnexpectedByte(c, position_ + (cursor - chunk.begin()));
+          return nullptr;
+        }
+        depth_--;
+        break;
+      case ']':
+      case ',':
+        if (depth_ > 0) {
+          if (c == ']') depth_--;
+          break;
+        }
+        buffer_.insert(buffer_.end(), element_start, cursor);
+        element_start = cursor + 1;
+        if (c == ']' && !seen_comma_ && BufferIsWhitespace()) {
+          // The array is empty.
+          buffer_.clear();
+        } else if (EndElement().IsNothing()) {
+          return nullptr;
+        }
+        if (c == ']') {
+          state_ = State::kAfterArray;
+          return cursor + 1;
+        }
+        seen_comma_ = true;
+        break;
+      default:
+        break;
+    }
+  }
+  buffer_.insert(buffer_.end(), element_start, chunk.end());
+  return chunk.end();
+}
+
+Maybe<bool> JsonStreamingParser::EndElement() {
+  DCHECK_EQ(depth_, 0);
+  DCHECK(!in_string_);
+  HandleScope scope(isolate_);
+  Handle<Object> element;
+  if (!ParseBuffer().ToHandle(&element)) return Nothing<bool>();
+
+  if (client_ != nullptr) {
+    Maybe<bool> result = client_->OnArrayElement(
+        Utils::ToLocal(Handle<Context>::cast(isolate_->native_context())),
+        Utils::ToLocal(element));
+    RETURN_VALUE_IF_SCHEDULED_EXCEPTION(isolate_, Nothing<bool>());
+    if (result.IsNothing()) {
+      DCHECK(isolate_->has_pending_exception());
+      return Nothing<bool>();
+    }
+    return Just(true);
+  }
+
+  Handle<FixedArray> new_array =
+      FixedArray::SetAndGrow(isolate_, elements_, element_count_++, element);
+  // If the array was reallocated, update the global handle.
+  if (!new_array.is_identical_to(elements_)) {
+    GlobalHandles::Destroy(elements_.location());
+    elements_ = isolate_->global_handles()->Create(*new_array);
+  }
+  return Just(true);
+}
+
+MaybeHandle<Object> JsonStreamingParser::ParseBuffer() {
+  if (buffer_.size() > static_cast<size_t>(String::kMaxLength)) {
+    THROW_NEW_ERROR(isolate_, NewInvalidStringLengthError(), Object);
+  }
+  Handle<String> source;
+  ASSIGN_RETURN_ON_EXCEPTION(
+      isolate_, source,
+      isolate_->factory()->NewStringFromUtf8(Vector<const char>(
+          reinterpret_cast<const char*>(buffer_.data()),
+          static_cast<int>(buffer_.size()))),
+      Object);
+  // Keep the capacity, the next element is likely of similar size.
+  buffer_.clear();
+  source = String::Flatten(isolate_, source);
+  Handle<Object> undefined = isolate_->factory()->undefined_value();
+  return source->IsOneByteRepresentation()
+             ? JsonParser<uint8_t>::Parse(isolate_, source, undefined)
+             : JsonParser<uint16_t>::Parse(isolate_, source, undefined);
+}
+
+bool JsonStreamingParser::BufferIsWhitespace() const {
+  for (uint8_t c : buffer_) {
+    if (!IsJsonWhitespace(c)) return false;
+  }
+  return true;
+}
+
+MaybeHandle<Object> JsonStreamingParser::Finish() {
+  DCHECK(state_ != State::kFinished && state_ != State::kFailed);
+  State state = state_;
+  state_ = State::kFailed;
+  switch (state) {
+    case State::kStart:
+    case State::kArray:
+      ReportUnexpectedEnd();
+      return MaybeHandle<Object>();
+    case State::kAfterArray:
+      state_ = State::kFinished;
+      if (client_ != nullptr) return isolate_->factory()->undefined_value();
+      return isolate_->factory()->NewJSArrayWithElements(
+          isolate_->factory()->CopyFixedArrayUpTo(elements_, element_count_),
+          PACKED_ELEMENTS, element_count_);
+    case State::kValue: {
+      Handle<Object> result;
+      ASSIGN_RETURN_ON_EXCEPTION(isolate_, result, ParseBuffer(), Object);
+      state_ = State::kFinished;
+      return result;
+    }
+    case State::kFinished:
+    case State::kFailed:
+      break;
+  }
+  UNREACHABLE();
+}
+
+void JsonStreamingParser::ReportUnexpectedByte(uint8_t c, size_t position) {
+  Factory* factory = isolate_->factory();
+  // Only ASCII bytes are reported as characters, the others are part of a
+  // multi-byte sequence that hasn't been decoded.
+  uc32 code = c <= unibrow::Utf8::kMaxOneByteChar ? c
+                                                   : unibrow::Utf8::kBadChar;
+  isolate_->Throw(*factory->NewSyntaxError(
+      MessageTemplate::kJsonParseUnexpectedToken,
+      factory->LookupSingleCharacterStringFromCode(code),
+      factory->NewNumberFromSize(position)));
+}
+
+void JsonStreamingParser::ReportUnexpectedEnd() {
+  isolate_->Throw(*isolate_->factory()->NewSyntaxError(
+      MessageTemplate::kJsonParseUnexpectedEOS));
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,86 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_STREAMING_PARSER_H_
+#define V8_JSON_JSON_STREAMING_PARSER_H_
+
+#include <vector>
+
+#include "include/v8.h"
+#include "src/base/macros.h"
+#include "src/handles/maybe-handles.h"
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+class FixedArray;
+class Isolate;
+
+// Parses JSON text that arrives in chunks of UTF-8 encoded bytes. The bytes
+// are only scanned for the structure of a top-level array: each element's
+// text is cut out at its top-level ',' or ']' and handed to JsonParser, so at
+// most one element is buffered. All structural characters are ASCII, which
+// makes it safe to scan the bytes without decoding them. Any other top-level
+// value is buffered whole and parsed by Finish.
+class V8_EXPORT_PRIVATE JsonStreamingParser final {
+ public:
+  JsonStreamingParser(Isolate* isolate,
+                      v8::JSON::StreamingParser::Client* client);
+  ~JsonStreamingParser();
+
+  V8_WARN_UNUSED_RESULT Maybe<bool> Feed(Vector<const uint8_t> chunk);
+  V8_WARN_UNUSED_RESULT MaybeHandle<Object> Finish();
+
+ private:
+  enum class State {
+    // Whitespace before the top-level value.
+    kStart,
+    // Inside a top-level array, before its closing ']'.
+    kArray,
+    // After the closing ']' of a top-level array.
+    kAfterArray,
+    // Inside a top-level value that is not an array.
+    kValue,
+    kFinished,
+    kFailed,
+  };
+
+  // Scans the elements of the top-level array from |cursor| on. Returns the
+  // position after the closing ']', the end of |chunk|, or nullptr if an
+  // element failed to parse.
+  const uint8_t* ScanArray(Vector<const uint8_t> chunk, const uint8_t* cursor);
+  Maybe<bool> EndElement();
+  MaybeHandle<Object> ParseBuffer();
+  bool BufferIsWhitespace() const;
+  void ReportUnexpectedByte(uint8_t c, size_t position);
+  void ReportUnexpectedEnd();
+
+  Isolate* const isolate_;
+  v8::JSON::StreamingParser::Client* const client_;
+  State state_ = State::kStart;
+  // Number of bytes fed so far.
+  size_t position_ = 0;
+
+  // The text of the current array element, or of a non-array value.
+  std::vector<uint8_t> buffer_;
+
+  // Scanner state of the current array element.
+  int depth_ = 0;
+  bool in_string_ = false;
+  bool escaped_ = false;
+  bool seen_comma_ = false;
+
+  // Collected array elements if there is no client. Global handle, since the
+  // parser lives across API calls.
+  Handle<FixedArray> elements_;
+  int element_count_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(JsonStreamingParser);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_STREAMING_PARSER_H_
@@ -4,6 +4,10 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <memory>
+
+#include "include/v8-profiler.h"
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/heap-number-inl.h"
@@ -14,6 +18,7 @@
 #include "src/objects/ordered-hash-table.h"
 #include "src/objects/smi.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
@@ -100,6 +105,11 @@ class JsonStringifier {
   template <typename Char>
   V8_INLINE static bool DoNotEscape(Char c);
 
+  // Returns the number of characters from |start| on that are copied
+  // unchanged.
+  V8_INLINE static int UnescapedLength(Vector<const uint8_t> src, int start);
+  V8_INLINE static int UnescapedLength(Vector<const uint16_t> src, int start);
+
   V8_INLINE void NewLine();
   V8_INLINE void Indent() { indent_++; }
   V8_INLINE void Unindent() { indent_--; }
@@ -143,6 +153,41 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+bool WriteUtf8ToStream(Isolate* isolate, Handle<String> string,
+                       v8::OutputStream* stream) {
+  static const int kMaxEncodedSize = unibrow::Utf8::kMaxEncodedSize;
+  // Every character has to fit into a chunk.
+  int chunk_size = std::max(stream->GetChunkSize(), kMaxEncodedSize);
+  std::unique_ptr<char[]> chunk(new char[chunk_size]);
+  int used = 0;
+  // The reader survives GCs caused by the stream.
+  FlatStringReader reader(isolate, String::Flatten(isolate, string));
+  for (int i = 0; i < reader.length(); i++) {
+    uc32 c = reader.Get(i);
+    if (unibrow::Utf16::IsLeadSurrogate(c) && i + 1 < reader.length() &&
+        unibrow::Utf16::IsTrailSurrogate(reader.Get(i + 1))) {
+      c = unibrow::Utf16::CombineSurrogatePair(c, reader.Get(++i));
+    }
+    char encoded[kMaxEncodedSize];
+    int length = unibrow::Utf8::Encode(
+        encoded, c, unibrow::Utf16::kNoPreviousCharacter, true);
+    if (used + length > chunk_size) {
+      if (stream->WriteAsciiChunk(chunk.get(), used) ==
+          v8::OutputStream::kAbort) {
+        return false;
+      }
+      used = 0;
+    }
+    for (int j = 0; j < length; j++) chunk[used++] = encoded[j];
+  }
+  if (used > 0 && stream->WriteAsciiChunk(chunk.get(), used) ==
+                      v8::OutputStream::kAbort) {
+    return false;
+  }
+  stream->EndOfStream();
+  return true;
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -879,6 +924,12 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   for (int i = 0; i < src.length(); i++) {
+    int unescaped = UnescapedLength(src, i);
+    if (unescaped > 0) {
+      dest->AppendChars(src.begin() + i, unescaped);
+      i += unescaped;
+      if (i == src.length()) break;
+    }
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
       dest->Append(c);
@@ -1004,6 +1055,42 @@ bool JsonStringifier::DoNotEscape(uint16_t c) {
   return c >= 0x23 && c != 0x5C && c != 0x7F && (c < 0xD800 || c > 0xDFFF);
 }
 
+int JsonStringifier::UnescapedLength(Vector<const uint8_t> src, int start) {
+  // Only control characters, '"' and '\\' are escaped in one-byte strings,
+  // so whole words can be tested at once: for n <= 0x80,
+  // (w - 0x0101..01 * n) & ~w & 0x8080..80 is non-zero iff a byte of w is
+  // below n.
+  using Word = uintptr_t;
+  static constexpr Word kOnes = ~Word{0} / 0xFF;
+  static constexpr Word kHighBits = kOnes * 0x80;
+  auto has_less_than = [](Word w, uint8_t n) {
+    return ((w - kOnes * n) & ~w & kHighBits) != 0;
+  };
+  auto has_byte = [&](Word w, uint8_t b) {
+    return has_less_than(w ^ (kOnes * b), 1);
+  };
+  static constexpr int kCharsPerWord = sizeof(Word);
+  int i = start;
+  for (; i + kCharsPerWord <= src.length(); i += kCharsPerWord) {
+    Word w = base::ReadUnalignedValue<Word>(
+        reinterpret_cast<Address>(src.begin() + i));
+    if (has_less_than(w, 0x20) || has_byte(w, '"') || has_byte(w, '\\')) {
+      break;
+    }
+  }
+  for (; i < src.length(); i++) {
+    uint8_t c = src[i];
+    if (c < 0x20 || c == '"' || c == '\\') break;
+  }
+  return i - start;
+}
+
+int JsonStringifier::UnescapedLength(Vector<const uint16_t> src, int start) {
+  int i = start;
+  while (i < src.length() && DoNotEscape(src[i])) i++;
+  return i - start;
+}
+
 void JsonStringifier::NewLine() {
   if (gap_ == nullptr) return;
   builder_.AppendCharacter('\n');
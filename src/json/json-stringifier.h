@@ -8,12 +8,21 @@
 #include "src/objects/objects.h"
 
 namespace v8 {
+
+class OutputStream;
+
 namespace internal {
 
 V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
                                                         Handle<Object> object,
                                                         Handle<Object> replacer,
                                                         Handle<Object> gap);
+
+// Writes the UTF-8 encoding of |string| to |stream|, in chunks of the
+// stream's preferred size. Returns false if the stream aborted.
+V8_WARN_UNUSED_RESULT bool WriteUtf8ToStream(Isolate* isolate,
+                                             Handle<String> string,
+                                             v8::OutputStream* stream);
 }  // namespace internal
 }  // namespace v8
 
@@ -58,6 +58,12 @@ void DefaultJobState::CancelAndWait() {
   }
 }
 
+void DefaultJobState::CancelAndDetach() {
+  // Don't take {mutex_}: this can be called from {JobTask::GetMaxConcurrency}
+  // if it releases the last reference to the state the job operates on.
+  is_canceled_.store(true, std::memory_order_relaxed);
+}
+
 bool DefaultJobState::CanRunFirstTask() {
   base::MutexGuard guard(&mutex_);
   --pending_tasks_;
@@ -146,5 +152,10 @@ void DefaultJobHandle::Cancel() {
   state_ = nullptr;
 }
 
+void DefaultJobHandle::CancelAndDetach() {
+  state_->CancelAndDetach();
+  state_ = nullptr;
+}
+
 }  // namespace platform
 }  // namespace v8
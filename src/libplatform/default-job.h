@@ -36,6 +36,7 @@ class V8_PLATFORM_EXPORT DefaultJobState
 
   void Join();
   void CancelAndWait();
+  void CancelAndDetach();
 
   // Must be called before running |job_task_| for the first time. If it returns
   // true, then the worker thread must contribute and must call DidRunTask(), or
@@ -88,6 +89,7 @@ class V8_PLATFORM_EXPORT DefaultJobHandle : public JobHandle {
 
   void Join() override;
   void Cancel() override;
+  void CancelAndDetach() override;
   bool IsRunning() override { return state_ != nullptr; }
 
  private:
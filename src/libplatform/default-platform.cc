@@ -81,7 +81,7 @@ constexpr int kMaxThreadPoolSize = 16;
 int GetActualThreadPoolSize(int thread_pool_size) {
   DCHECK_GE(thread_pool_size, 0);
   if (thread_pool_size < 1) {
-    thread_pool_size = base::SysInfo::NumberOfProcessors() - 1;
+    thread_pool_size = base::SysInfo::NumberOfProcessorsAvailable() - 1;
   }
   return std::max(std::min(thread_pool_size, kMaxThreadPoolSize), 1);
 }
@@ -197,7 +197,22 @@ std::shared_ptr<TaskRunner> DefaultPlatform::GetForegroundTaskRunner(
 
 void DefaultPlatform::CallOnWorkerThread(std::unique_ptr<Task> task) {
   EnsureBackgroundTaskRunnerInitialized();
-  worker_threads_task_runner_->PostTask(std::move(task));
+  worker_threads_task_runner_->PostTask(std::move(task),
+                                        TaskPriority::kUserVisible);
+}
+
+void DefaultPlatform::CallBlockingTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTask(std::move(task),
+                                        TaskPriority::kUserBlocking);
+}
+
+void DefaultPlatform::CallLowPriorityTaskOnWorkerThread(
+    std::unique_ptr<Task> task) {
+  EnsureBackgroundTaskRunnerInitialized();
+  worker_threads_task_runner_->PostTask(std::move(task),
+                                        TaskPriority::kBestEffort);
 }
 
 void DefaultPlatform::CallDelayedOnWorkerThread(std::unique_ptr<Task> task,
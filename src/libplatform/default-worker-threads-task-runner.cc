@@ -4,16 +4,26 @@
 
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
-#include "src/libplatform/delayed-task-queue.h"
+#include <algorithm>
+
+#include "src/base/logging.h"
+#include "src/base/platform/time.h"
 
 namespace v8 {
 namespace platform {
 
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
     uint32_t thread_pool_size, TimeFunction time_function)
-    : queue_(time_function), time_function_(time_function) {
+    : time_function_(time_function) {
+  // Post to a single queue if there are no workers, so that the tasks are
+  // still owned by the runner.
+  uint32_t num_queues = std::max(thread_pool_size, 1u);
+  for (uint32_t i = 0; i < num_queues; ++i) {
+    queues_.push_back(std::make_unique<WorkerQueue>());
+  }
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(std::make_unique<WorkerThread>(this));
+    thread_pool_.push_back(
+        std::make_unique<WorkerThread>(this, static_cast<int>(i)));
   }
 }
 
@@ -24,24 +34,37 @@ double DefaultWorkerThreadsTaskRunner::MonotonicallyIncreasingTime() {
 }
 
 void DefaultWorkerThreadsTaskRunner::Terminate() {
-  base::MutexGuard guard(&lock_);
-  terminated_ = true;
-  queue_.Terminate();
-  // Clearing the thread pool lets all worker threads join.
+  {
+    base::MutexGuard guard(&lock_);
+    terminated_ = true;
+    idle_condition_var_.NotifyAll();
+  }
+  // Clearing the thread pool lets all worker threads join. The workers need
+  // |lock_| to notice the termination, so it must not be held here.
   thread_pool_.clear();
 }
 
+void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task,
+                                              TaskPriority priority) {
+  if (terminated_.load(std::memory_order_relaxed)) return;
+  uint32_t index = next_queue_.fetch_add(1, std::memory_order_relaxed) %
+                   static_cast<uint32_t>(queues_.size());
+  Push(static_cast<int>(index), std::move(task), priority);
+  NotifyIdleWorker();
+}
+
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
-  queue_.Append(std::move(task));
+  PostTask(std::move(task), TaskPriority::kUserVisible);
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                      double delay_in_seconds) {
+  DCHECK_GE(delay_in_seconds, 0.0);
+  double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
-  queue_.AppendDelayed(std::move(task), delay_in_seconds);
+  delayed_task_queue_.emplace(deadline, std::move(task));
+  idle_condition_var_.NotifyOne();
 }
 
 void DefaultWorkerThreadsTaskRunner::PostIdleTask(
@@ -55,21 +78,106 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
-std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext() {
-  return queue_.GetNext();
+void DefaultWorkerThreadsTaskRunner::Push(int worker_index,
+                                          std::unique_ptr<Task> task,
+                                          TaskPriority priority) {
+  WorkerQueue* queue = queues_[worker_index].get();
+  base::MutexGuard guard(&queue->lock);
+  queue->tasks[static_cast<int>(priority)].push_back(std::move(task));
+  pending_tasks_.fetch_add(1);
+}
+
+void DefaultWorkerThreadsTaskRunner::NotifyIdleWorker() {
+  // Pairs with the increment of |idle_workers_| in GetNext(): either the
+  // worker sees the pending task, or the task's poster sees the idle worker.
+  if (idle_workers_.load() == 0) return;
+  base::MutexGuard guard(&lock_);
+  idle_condition_var_.NotifyOne();
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::TryPop(
+    int worker_index, TaskPriority priority) {
+  int num_queues = static_cast<int>(queues_.size());
+  for (int i = 0; i < num_queues; ++i) {
+    WorkerQueue* queue = queues_[(worker_index + i) % num_queues].get();
+    base::MutexGuard guard(&queue->lock);
+    auto& tasks = queue->tasks[static_cast<int>(priority)];
+    if (tasks.empty()) continue;
+    std::unique_ptr<Task> task = std::move(tasks.front());
+    tasks.pop_front();
+    pending_tasks_.fetch_sub(1);
+    return task;
+  }
+  return nullptr;
+}
+
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext(
+    int worker_index) {
+  for (;;) {
+    if (pending_tasks_.load() > 0) {
+      for (int priority = kNumPriorities - 1; priority >= 0; --priority) {
+        std::unique_ptr<Task> task =
+            TryPop(worker_index, static_cast<TaskPriority>(priority));
+        if (task) return task;
+      }
+    }
+
+    base::MutexGuard guard(&lock_);
+    // Run a delayed task that has hit its deadline, and move the others that
+    // have to the worker's own queue.
+    double now = MonotonicallyIncreasingTime();
+    std::unique_ptr<Task> result;
+    while (!delayed_task_queue_.empty() &&
+           delayed_task_queue_.begin()->first <= now) {
+      auto it = delayed_task_queue_.begin();
+      if (result) {
+        Push(worker_index, std::move(it->second), TaskPriority::kUserVisible);
+      } else {
+        result = std::move(it->second);
+      }
+      delayed_task_queue_.erase(it);
+    }
+    if (result) return result;
+
+    idle_workers_.fetch_add(1);
+    if (pending_tasks_.load() > 0) {
+      idle_workers_.fetch_sub(1);
+      continue;
+    }
+    if (terminated_) {
+      idle_workers_.fetch_sub(1);
+      return nullptr;
+    }
+    if (!delayed_task_queue_.empty()) {
+      // Wait for the next delayed task or a newly posted task.
+      double wait_in_seconds = delayed_task_queue_.begin()->first - now;
+      base::TimeDelta wait_delta = base::TimeDelta::FromMicroseconds(
+          base::TimeConstants::kMicrosecondsPerSecond * wait_in_seconds);
+
+      // WaitFor unfortunately doesn't care about our fake time and will wait
+      // the 'real' amount of time, based on whatever clock the system call
+      // uses.
+      bool notified = idle_condition_var_.WaitFor(&lock_, wait_delta);
+      USE(notified);
+    } else {
+      idle_condition_var_.Wait(&lock_);
+    }
+    idle_workers_.fetch_sub(1);
+  }
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
-    DefaultWorkerThreadsTaskRunner* runner)
+    DefaultWorkerThreadsTaskRunner* runner, int index)
     : Thread(Options("V8 DefaultWorkerThreadsTaskRunner WorkerThread")),
-      runner_(runner) {
+      runner_(runner),
+      index_(index) {
   CHECK(Start());
 }
 
 DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() { Join(); }
 
 void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
-  while (std::unique_ptr<Task> task = runner_->GetNext()) {
+  while (std::unique_ptr<Task> task = runner_->GetNext(index_)) {
     task->Run();
   }
 }
@@ -5,18 +5,28 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <atomic>
+#include <deque>
+#include <map>
 #include <memory>
 #include <vector>
 
 #include "include/libplatform/libplatform-export.h"
 #include "include/v8-platform.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
-#include "src/libplatform/delayed-task-queue.h"
 
 namespace v8 {
 namespace platform {
 
+// Runs tasks on a pool of worker threads. Every worker owns a queue per task
+// priority, each protected by its own lock, so that posting and running tasks
+// on many threads doesn't contend on a single lock. Immediate tasks are
+// distributed round-robin over the workers' queues. A worker runs the oldest
+// task of the highest priority it finds, looking at its own queues first and
+// stealing from the other workers' queues otherwise. Delayed tasks are kept in
+// a shared queue until their deadline has passed.
 class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     : public NON_EXPORTED_BASE(TaskRunner) {
  public:
@@ -31,7 +41,11 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
   double MonotonicallyIncreasingTime();
 
-  // v8::TaskRunner implementation.
+  // Posts an immediate task with the given priority. Thread-safe.
+  void PostTask(std::unique_ptr<Task> task, TaskPriority priority);
+
+  // v8::TaskRunner implementation. Immediate tasks posted through it have
+  // TaskPriority::kUserVisible.
   void PostTask(std::unique_ptr<Task> task) override;
 
   void PostDelayedTask(std::unique_ptr<Task> task,
@@ -42,9 +56,12 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   bool IdleTasksEnabled() override;
 
  private:
+  static constexpr int kNumPriorities =
+      static_cast<int>(TaskPriority::kUserBlocking) + 1;
+
   class WorkerThread : public base::Thread {
    public:
-    explicit WorkerThread(DefaultWorkerThreadsTaskRunner* runner);
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner, int index);
     ~WorkerThread() override;
 
     // This thread attempts to get tasks in a loop from |runner_| and run them.
@@ -52,17 +69,47 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
 
    private:
     DefaultWorkerThreadsTaskRunner* runner_;
+    const int index_;
 
     DISALLOW_COPY_AND_ASSIGN(WorkerThread);
   };
 
-  // Called by the WorkerThread. Gets the next take (delayed or immediate) to be
-  // executed. Blocks if no task is available.
-  std::unique_ptr<Task> GetNext();
+  // The immediate tasks owned by one worker, one FIFO queue per priority.
+  struct WorkerQueue {
+    base::Mutex lock;
+    std::deque<std::unique_ptr<Task>> tasks[kNumPriorities];
+  };
+
+  // Called by the WorkerThread with the given index. Gets the next task
+  // (delayed or immediate) to be executed. Blocks if no task is available.
+  // Returns nullptr once the runner is terminated and no task is left.
+  std::unique_ptr<Task> GetNext(int worker_index);
+
+  // Pops the oldest task with |priority| from the queues, starting with the
+  // queue of the worker with the given index.
+  std::unique_ptr<Task> TryPop(int worker_index, TaskPriority priority);
 
-  bool terminated_ = false;
+  void Push(int worker_index, std::unique_ptr<Task> task,
+            TaskPriority priority);
+
+  // Wakes up an idle worker, if there is one.
+  void NotifyIdleWorker();
+
+  std::vector<std::unique_ptr<WorkerQueue>> queues_;
+  // Number of tasks in |queues_|.
+  std::atomic<size_t> pending_tasks_{0};
+  // Index of the queue the next immediate task is posted to.
+  std::atomic<uint32_t> next_queue_{0};
+  // Number of workers waiting on |idle_condition_var_|.
+  std::atomic<int> idle_workers_{0};
+
+  // Protects |delayed_task_queue_| and waiting for tasks. |terminated_| is
+  // only set with the lock held, but may be read without it.
   base::Mutex lock_;
-  DelayedTaskQueue queue_;
+  base::ConditionVariable idle_condition_var_;
+  std::atomic<bool> terminated_{false};
+  std::multimap<double, std::unique_ptr<Task>> delayed_task_queue_;
+
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
   TimeFunction time_function_;
 };
@@ -12,12 +12,13 @@ namespace v8 {
 namespace internal {
 
 void RuntimeCallTimer::Start(RuntimeCallCounter* counter,
-                             RuntimeCallTimer* parent) {
+                             RuntimeCallTimer* parent, bool measure) {
   DCHECK(!IsStarted());
   counter_ = counter;
   parent_.SetValue(parent);
-  if (TracingFlags::runtime_stats.load(std::memory_order_relaxed) ==
-      v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING) {
+  if (!measure ||
+      TracingFlags::runtime_stats.load(std::memory_order_relaxed) ==
+          v8::tracing::TracingCategoryObserver::ENABLED_BY_SAMPLING) {
     return;
   }
   base::TimeTicks now = RuntimeCallTimer::Now();
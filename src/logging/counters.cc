@@ -4,6 +4,7 @@
 
 #include "src/logging/counters.h"
 
+#include <algorithm>
 #include <iomanip>
 
 #include "src/base/platform/platform.h"
@@ -414,6 +415,8 @@ void RuntimeCallCounter::Add(RuntimeCallCounter* other) {
 }
 
 void RuntimeCallTimer::Snapshot() {
+  // Timers that don't measure have nothing to commit.
+  if (!IsStarted()) return;
   base::TimeTicks now = Now();
   // Pause only / topmost timer in the timer stack.
   Pause(now);
@@ -498,11 +501,28 @@ void RuntimeCallStats::Enter(RuntimeCallTimer* timer,
   DCHECK(IsCalledOnTheSameThread());
   RuntimeCallCounter* counter = GetCounter(counter_id);
   DCHECK_NOT_NULL(counter->name());
-  timer->Start(counter, current_timer());
+  RuntimeCallTimer* parent = current_timer();
+  timer->Start(counter, parent, ShouldMeasure(parent));
   current_timer_.SetValue(timer);
   current_counter_.SetValue(counter);
 }
 
+// static
+int RuntimeCallStats::SamplingInterval() {
+  return std::max(FLAG_rcs_sampling_interval, 1);
+}
+
+bool RuntimeCallStats::ShouldMeasure(RuntimeCallTimer* parent) {
+  if (V8_LIKELY(FLAG_rcs_sampling_interval <= 1)) return true;
+  // Only whole stacks of scopes are sampled, so that the own time of each
+  // measured scope excludes the time of the scopes nested in it. The
+  // innermost timer of a measured stack is always running.
+  if (parent != nullptr) return parent->IsStarted();
+  if (--sampling_countdown_ > 0) return false;
+  sampling_countdown_ = FLAG_rcs_sampling_interval;
+  return true;
+}
+
 void RuntimeCallStats::Leave(RuntimeCallTimer* timer) {
   DCHECK(IsCalledOnTheSameThread());
   RuntimeCallTimer* stack_top = current_timer();
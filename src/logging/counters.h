@@ -681,7 +681,10 @@ class RuntimeCallTimer final {
 
   inline bool IsStarted();
 
-  inline void Start(RuntimeCallCounter* counter, RuntimeCallTimer* parent);
+  // Pushes the timer on top of |parent|. The timer only measures time if
+  // |measure| is true, otherwise it just keeps track of the current counter.
+  inline void Start(RuntimeCallCounter* counter, RuntimeCallTimer* parent,
+                    bool measure = true);
   void Snapshot();
   inline RuntimeCallTimer* Stop();
 
@@ -712,6 +715,7 @@ class RuntimeCallTimer final {
   V(ArrayBuffer_Detach)                                    \
   V(ArrayBuffer_New)                                       \
   V(ArrayBuffer_NewBackingStore)                           \
+  V(ArrayBuffer_NewResizableBackingStore)                  \
   V(ArrayBuffer_BackingStore_Reallocate)                   \
   V(Array_CloneElementAt)                                  \
   V(Array_New)                                             \
@@ -748,7 +752,10 @@ class RuntimeCallTimer final {
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSMemberBase_New)                                      \
   V(JSON_Parse)                                            \
+  V(JSON_StreamingParser_Feed)                             \
+  V(JSON_StreamingParser_Finish)                           \
   V(JSON_Stringify)                                        \
+  V(JSON_StringifyToUtf8)                                  \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
   V(Map_Delete)                                            \
@@ -776,6 +783,7 @@ class RuntimeCallTimer final {
   V(Object_Get)                                            \
   V(Object_GetOwnPropertyDescriptor)                       \
   V(Object_GetOwnPropertyNames)                            \
+  V(Object_GetProperties)                                  \
   V(Object_GetPropertyAttributes)                          \
   V(Object_GetPropertyNames)                               \
   V(Object_GetRealNamedProperty)                           \
@@ -793,6 +801,7 @@ class RuntimeCallTimer final {
   V(Object_SetAccessor)                                    \
   V(Object_SetIntegrityLevel)                              \
   V(Object_SetPrivate)                                     \
+  V(Object_SetProperties)                                  \
   V(Object_SetPrototype)                                   \
   V(ObjectTemplate_New)                                    \
   V(ObjectTemplate_NewInstance)                            \
@@ -835,6 +844,7 @@ class RuntimeCallTimer final {
   V(SharedArrayBuffer_NewBackingStore)                     \
   V(String_Concat)                                         \
   V(String_NewExternalOneByte)                             \
+  V(String_NewExternalUtf8)                                \
   V(String_NewExternalTwoByte)                             \
   V(String_NewFromOneByte)                                 \
   V(String_NewFromTwoByte)                                 \
@@ -923,6 +933,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LocateSpillSlots)                \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoopExitElimination)             \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoopPeeling)                     \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, LoopUnrolling)                   \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, MachineOperatorOptimization)     \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, MeetRegisterConstraints)         \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, MemoryOptimization)              \
@@ -944,6 +955,7 @@ class RuntimeCallTimer final {
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, TypedLowering)                   \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, Typer)                           \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, Untyper)                         \
+  ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, VectorizationAnalysis)           \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, VerifyGraph)                     \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmBaseOptimization)            \
   ADD_THREAD_SPECIFIC_COUNTER(V, Optimize, WasmFullOptimization)            \
@@ -1152,6 +1164,10 @@ class RuntimeCallStats final {
   bool InUse() { return in_use_; }
   bool IsCalledOnTheSameThread();
 
+  // Returns the number of scope entries each measured scope stands for, see
+  // --rcs-sampling-interval.
+  static int SamplingInterval();
+
   V8_EXPORT_PRIVATE bool IsBackgroundThreadSpecificVariant(
       RuntimeCallCounterId id);
   V8_EXPORT_PRIVATE bool HasThreadSpecificCounterVariants(
@@ -1188,6 +1204,9 @@ class RuntimeCallStats final {
   }
 
  private:
+  // Decides whether a scope entered on top of |parent| is measured.
+  bool ShouldMeasure(RuntimeCallTimer* parent);
+
   // Top of a stack of active timers.
   base::AtomicValue<RuntimeCallTimer*> current_timer_;
   // Active counter object associated with current timer.
@@ -1196,6 +1215,9 @@ class RuntimeCallStats final {
   bool in_use_;
   ThreadType thread_type_;
   ThreadId thread_id_;
+  // Number of outermost scopes to skip until the next one is measured. Each
+  // thread has its own table, so no synchronization is needed.
+  int sampling_countdown_ = 0;
   RuntimeCallCounter counters_[kNumberOfCounters];
 };
 
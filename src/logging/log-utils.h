@@ -38,7 +38,7 @@ class Log {
            FLAG_perf_prof || FLAG_log_source_code || FLAG_gdbjit ||
            FLAG_log_internal_timer_events || FLAG_prof_cpp || FLAG_trace_ic ||
            FLAG_log_function_events || FLAG_trace_zone_stats ||
-           FLAG_turbo_profiling_log_builtins;
+           FLAG_turbo_profiling_log_builtins || FLAG_turbo_profiling_log_js;
   }
 
   // Frees all resources acquired in Initialize and Open... functions.
@@ -7,6 +7,7 @@
 #include <cstdarg>
 #include <memory>
 #include <sstream>
+#include <vector>
 
 #include "src/api/api-inl.h"
 #include "src/base/platform/platform.h"
@@ -1074,7 +1075,10 @@ void Logger::TimerEvent(Logger::StartEnd se, const char* name) {
 
 void Logger::BasicBlockCounterEvent(const char* name, int block_id,
                                     uint32_t count) {
-  if (!log_->IsEnabled() || !FLAG_turbo_profiling_log_builtins) return;
+  if (!log_->IsEnabled() ||
+      !(FLAG_turbo_profiling_log_builtins || FLAG_turbo_profiling_log_js)) {
+    return;
+  }
   Log::MessageBuilder msg(log_.get());
   msg << ProfileDataFromFileConstants::kBlockCounterMarker << kNext << name
       << kNext << block_id << kNext << count;
@@ -1082,7 +1086,10 @@ void Logger::BasicBlockCounterEvent(const char* name, int block_id,
 }
 
 void Logger::BuiltinHashEvent(const char* name, int hash) {
-  if (!log_->IsEnabled() || !FLAG_turbo_profiling_log_builtins) return;
+  if (!log_->IsEnabled() ||
+      !(FLAG_turbo_profiling_log_builtins || FLAG_turbo_profiling_log_js)) {
+    return;
+  }
   Log::MessageBuilder msg(log_.get());
   msg << ProfileDataFromFileConstants::kBuiltinHashMarker << kNext << name
       << kNext << hash;
@@ -1749,23 +1756,16 @@ void Logger::MapDetails(Map map) {
   msg.WriteToLogFile();
 }
 
-static void AddFunctionAndCode(SharedFunctionInfo sfi, AbstractCode code_object,
-                               Handle<SharedFunctionInfo>* sfis,
-                               Handle<AbstractCode>* code_objects, int offset) {
-  if (sfis != nullptr) {
-    sfis[offset] = Handle<SharedFunctionInfo>(sfi, sfi.GetIsolate());
-  }
-  if (code_objects != nullptr) {
-    code_objects[offset] = Handle<AbstractCode>(code_object, sfi.GetIsolate());
-  }
-}
-
-static int EnumerateCompiledFunctions(Heap* heap,
-                                      Handle<SharedFunctionInfo>* sfis,
-                                      Handle<AbstractCode>* code_objects) {
+// Collects the compiled functions and the wasm module objects in a single
+// heap walk. On large heaps the walk dominates the cost of attaching a code
+// event listener, so it should not be repeated for counting.
+static void EnumerateCompiledFunctionsAndWasmModules(
+    Heap* heap, std::vector<Handle<SharedFunctionInfo>>* sfis,
+    std::vector<Handle<AbstractCode>>* code_objects,
+    std::vector<Handle<WasmModuleObject>>* module_objects) {
+  Isolate* isolate = Isolate::FromHeap(heap);
   HeapObjectIterator iterator(heap);
   DisallowHeapAllocation no_gc;
-  int compiled_funcs_count = 0;
 
   // Iterate the heap to find shared function info objects and record
   // the unoptimized code for them.
@@ -1775,10 +1775,13 @@ static int EnumerateCompiledFunctions(Heap* heap,
       SharedFunctionInfo sfi = SharedFunctionInfo::cast(obj);
       if (sfi.is_compiled() && (!sfi.script().IsScript() ||
                                 Script::cast(sfi.script()).HasValidSource())) {
-        AddFunctionAndCode(sfi, AbstractCode::cast(sfi.abstract_code()), sfis,
-                           code_objects, compiled_funcs_count);
-        ++compiled_funcs_count;
+        sfis->push_back(handle(sfi, isolate));
+        code_objects->push_back(
+            handle(AbstractCode::cast(sfi.abstract_code()), isolate));
       }
+    } else if (obj.IsWasmModuleObject()) {
+      module_objects->push_back(
+          handle(WasmModuleObject::cast(obj), isolate));
     } else if (obj.IsJSFunction()) {
       // Given that we no longer iterate over all optimized JSFunctions, we need
       // to take care of this here.
@@ -1793,33 +1796,12 @@ static int EnumerateCompiledFunctions(Heap* heap,
       // stack. Also note that we will not log optimized code objects that are
       // only on a type feedback vector. We should make this mroe precise.
       if (function.IsOptimized()) {
-        AddFunctionAndCode(sfi, AbstractCode::cast(function.code()), sfis,
-                           code_objects, compiled_funcs_count);
-        ++compiled_funcs_count;
-      }
-    }
-  }
-  return compiled_funcs_count;
-}
-
-static int EnumerateWasmModuleObjects(
-    Heap* heap, Handle<WasmModuleObject>* module_objects) {
-  HeapObjectIterator iterator(heap);
-  DisallowHeapAllocation no_gc;
-  int module_objects_count = 0;
-
-  for (HeapObject obj = iterator.Next(); !obj.is_null();
-       obj = iterator.Next()) {
-    if (obj.IsWasmModuleObject()) {
-      WasmModuleObject module = WasmModuleObject::cast(obj);
-      if (module_objects != nullptr) {
-        module_objects[module_objects_count] =
-            handle(module, Isolate::FromHeap(heap));
+        sfis->push_back(handle(sfi, isolate));
+        code_objects->push_back(
+            handle(AbstractCode::cast(function.code()), isolate));
       }
-      module_objects_count++;
     }
   }
-  return module_objects_count;
 }
 
 void Logger::LogCodeObject(Object object) {
@@ -2123,15 +2105,15 @@ void ExistingCodeLogger::LogCodeObjects() {
 void ExistingCodeLogger::LogCompiledFunctions() {
   Heap* heap = isolate_->heap();
   HandleScope scope(isolate_);
-  const int compiled_funcs_count =
-      EnumerateCompiledFunctions(heap, nullptr, nullptr);
-  ScopedVector<Handle<SharedFunctionInfo>> sfis(compiled_funcs_count);
-  ScopedVector<Handle<AbstractCode>> code_objects(compiled_funcs_count);
-  EnumerateCompiledFunctions(heap, sfis.begin(), code_objects.begin());
+  std::vector<Handle<SharedFunctionInfo>> sfis;
+  std::vector<Handle<AbstractCode>> code_objects;
+  std::vector<Handle<WasmModuleObject>> module_objects;
+  EnumerateCompiledFunctionsAndWasmModules(heap, &sfis, &code_objects,
+                                           &module_objects);
 
   // During iteration, there can be heap allocation due to
   // GetScriptLineNumber call.
-  for (int i = 0; i < compiled_funcs_count; ++i) {
+  for (size_t i = 0; i < sfis.size(); ++i) {
     SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate_, sfis[i]);
     if (sfis[i]->function_data().IsInterpreterData()) {
       LogExistingFunction(
@@ -2145,13 +2127,8 @@ void ExistingCodeLogger::LogCompiledFunctions() {
     LogExistingFunction(sfis[i], code_objects[i]);
   }
 
-  const int wasm_module_objects_count =
-      EnumerateWasmModuleObjects(heap, nullptr);
-  ScopedVector<Handle<WasmModuleObject>> module_objects(
-      wasm_module_objects_count);
-  EnumerateWasmModuleObjects(heap, module_objects.begin());
-  for (int i = 0; i < wasm_module_objects_count; ++i) {
-    module_objects[i]->native_module()->LogWasmCodes(isolate_);
+  for (Handle<WasmModuleObject> module_object : module_objects) {
+    module_object->native_module()->LogWasmCodes(isolate_);
   }
 }
 
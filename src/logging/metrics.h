@@ -29,6 +29,9 @@ class Recorder : public std::enable_shared_from_this<Recorder> {
 
   V8_EXPORT_PRIVATE void NotifyIsolateDisposal();
 
+  // Callers can skip collecting an event if nobody will receive it.
+  bool HasEmbedderRecorder() const { return embedder_recorder_ != nullptr; }
+
   template <class T>
   void AddMainThreadEvent(const T& event,
                           v8::metrics::Recorder::ContextId id) {
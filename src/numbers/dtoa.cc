@@ -13,6 +13,7 @@
 #include "src/numbers/double.h"
 #include "src/numbers/fast-dtoa.h"
 #include "src/numbers/fixed-dtoa.h"
+#include "src/numbers/ryu-dtoa.h"
 
 namespace v8 {
 namespace internal {
@@ -56,11 +57,15 @@ void DoubleToAscii(double v, DtoaMode mode, int requested_digits,
     return;
   }
 
+  // Ryu computes the same shortest representation as FastDtoa with the
+  // BignumDtoa fallback, but never needs a fallback.
+  if (mode == DTOA_SHORTEST) {
+    RyuDtoa(v, buffer, length, point);
+    return;
+  }
+
   bool fast_worked;
   switch (mode) {
-    case DTOA_SHORTEST:
-      fast_worked = FastDtoa(v, FAST_DTOA_SHORTEST, 0, buffer, length, point);
-      break;
     case DTOA_FIXED:
       fast_worked = FastFixedDtoa(v, requested_digits, buffer, length, point);
       break;
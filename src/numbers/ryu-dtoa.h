@@ -0,0 +1,35 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_NUMBERS_RYU_DTOA_H_
+#define V8_NUMBERS_RYU_DTOA_H_
+
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+// RyuDtoa will produce at most kRyuDtoaMaximalLength digits. This does not
+// include the terminating '\0' character.
+const int kRyuDtoaMaximalLength = 17;
+
+// Computes the shortest representation of the given double 'v' with the Ryu
+// algorithm (Ulf Adams, "Ryu: Fast Float-to-String Conversion", PLDI 2018).
+// The result should be interpreted as buffer * 10^(point - length), and the
+// buffer will be null-terminated.
+//
+// The input v must be > 0 and different from NaN, and Infinity.
+//
+// The digits are the same as those of BignumDtoa in BIGNUM_DTOA_SHORTEST
+// mode: the shortest representation that reads back as 'v', and among those
+// the one closest to 'v', rounding to even if two are at the same distance.
+// Unlike FastDtoa, RyuDtoa never fails, and unlike BignumDtoa, it only uses
+// fixed-width integer arithmetic.
+V8_EXPORT_PRIVATE void RyuDtoa(double v, Vector<char> buffer, int* length,
+                               int* point);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_NUMBERS_RYU_DTOA_H_
@@ -8,6 +8,7 @@
 
 #include "src/execution/isolate.h"
 #include "src/handles/global-handles.h"
+#include "src/heap/array-buffer-pool.h"
 #include "src/logging/counters.h"
 #include "src/wasm/wasm-constants.h"
 #include "src/wasm/wasm-engine.h"
@@ -170,19 +171,20 @@ BackingStore::~BackingStore() {
     return;
   }
 
-  if (is_wasm_memory_) {
+  if (is_wasm_memory_ || is_resizable_) {
     DCHECK(free_on_destruct_);
     DCHECK(!custom_deleter_);
     TRACE_BS("BSw:free  bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
              buffer_start_, byte_length(), byte_capacity_);
-    if (is_shared_) {
+    if (is_wasm_memory_ && is_shared_) {
       // Deallocate the list of attached memory objects.
       SharedWasmMemoryData* shared_data = get_shared_wasm_memory_data();
       delete shared_data;
       type_specific_data_.shared_wasm_memory_data = nullptr;
     }
 
-    // Wasm memories are always allocated through the page allocator.
+    // Wasm memories and resizable backing stores are always allocated through
+    // the page allocator.
     auto region = GetRegion(has_guard_regions_, buffer_start_, byte_length_,
                             byte_capacity_);
 
@@ -215,6 +217,24 @@ BackingStore::~BackingStore() {
   Clear();
 }
 
+bool BackingStore::ReleaseForBatchFree(v8::ArrayBuffer::Allocator* allocator,
+                                       void** buffer_start,
+                                       size_t* byte_length) {
+  if (buffer_start_ == nullptr || is_wasm_memory_ || is_resizable_ ||
+      is_shared_ || globally_registered_ || custom_deleter_ ||
+      !free_on_destruct_) {
+    return false;
+  }
+  if (get_v8_api_array_buffer_allocator() != allocator) return false;
+  TRACE_BS("BS:batch  bs=%p mem=%p (length=%zu, capacity=%zu)\n", this,
+           buffer_start_, byte_length(), byte_capacity_);
+  *buffer_start = buffer_start_;
+  *byte_length = byte_length_;
+  // The destructor now only clears the fields.
+  free_on_destruct_ = false;
+  return true;
+}
+
 // Allocate a backing store using the array buffer allocator from the embedder.
 std::unique_ptr<BackingStore> BackingStore::Allocate(
     Isolate* isolate, size_t byte_length, SharedFlag shared,
@@ -231,7 +251,15 @@ std::unique_ptr<BackingStore> BackingStore::Allocate(
     if (shared == SharedFlag::kShared) {
       counters->shared_array_allocations()->AddSample(mb_length);
     }
-    auto allocate_buffer = [allocator, initialized](size_t byte_length) {
+    ArrayBufferPool* pool = isolate->heap()->array_buffer_pool();
+    auto allocate_buffer = [allocator, pool, initialized](size_t byte_length) {
+      if (void* pooled = pool->Take(byte_length)) {
+        // The memory still holds the contents of a dead buffer.
+        if (initialized == InitializedFlag::kZeroInitialized) {
+          memset(pooled, 0, byte_length);
+        }
+        return pooled;
+      }
       if (initialized == InitializedFlag::kUninitialized) {
         return allocator->AllocateUninitialized(byte_length);
       }
@@ -304,7 +332,30 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateWasmMemory(
 
   TRACE_BS("BSw:try   %zu pages, %zu max\n", initial_pages, maximum_pages);
 
-  bool guards = kUseGuardRegions;
+  // Compute size of reserved memory.
+
+  size_t engine_max_pages = wasm::max_maximum_mem_pages();
+  maximum_pages = std::min(engine_max_pages, maximum_pages);
+  // If the platform doesn't support so many pages, attempting to allocate
+  // is guaranteed to fail, so we don't even try.
+  if (maximum_pages > kPlatformMaxPages) return {};
+  CHECK_LE(maximum_pages,
+           std::numeric_limits<size_t>::max() / wasm::kWasmPageSize);
+  size_t byte_capacity = maximum_pages * wasm::kWasmPageSize;
+  size_t byte_length = initial_pages * wasm::kWasmPageSize;
+
+  return TryAllocateAndPartiallyCommitMemory(
+      isolate, byte_length, byte_capacity, wasm::kWasmPageSize,
+      kUseGuardRegions, true, shared);
+}
+
+// Reserve {byte_capacity} bytes of address space through the page allocator,
+// plus guard regions if requested, and commit the first {byte_length} bytes.
+std::unique_ptr<BackingStore> BackingStore::TryAllocateAndPartiallyCommitMemory(
+    Isolate* isolate, size_t byte_length, size_t byte_capacity,
+    size_t alignment, bool guards, bool is_wasm_memory, SharedFlag shared) {
+  DCHECK_LE(byte_length, byte_capacity);
+  DCHECK_EQ(0, byte_capacity % AllocatePageSize());
 
   // For accounting purposes, whether a GC was necessary.
   bool did_retry = false;
@@ -323,16 +374,6 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateWasmMemory(
     return false;
   };
 
-  // Compute size of reserved memory.
-
-  size_t engine_max_pages = wasm::max_maximum_mem_pages();
-  maximum_pages = std::min(engine_max_pages, maximum_pages);
-  // If the platform doesn't support so many pages, attempting to allocate
-  // is guaranteed to fail, so we don't even try.
-  if (maximum_pages > kPlatformMaxPages) return {};
-  CHECK_LE(maximum_pages,
-           std::numeric_limits<size_t>::max() / wasm::kWasmPageSize);
-  size_t byte_capacity = maximum_pages * wasm::kWasmPageSize;
   size_t reservation_size = GetReservationSize(guards, byte_capacity);
 
   //--------------------------------------------------------------------------
@@ -347,7 +388,10 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateWasmMemory(
     if (FLAG_correctness_fuzzer_suppressions) {
       FATAL("could not allocate wasm memory backing store");
     }
-    RecordStatus(isolate, AllocationStatus::kAddressSpaceLimitReachedFailure);
+    if (is_wasm_memory) {
+      RecordStatus(isolate,
+                   AllocationStatus::kAddressSpaceLimitReachedFailure);
+    }
     TRACE_BS("BSw:try   failed to reserve address space\n");
     return {};
   }
@@ -359,13 +403,13 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateWasmMemory(
   auto allocate_pages = [&] {
     allocation_base =
         AllocatePages(GetPlatformPageAllocator(), nullptr, reservation_size,
-                      wasm::kWasmPageSize, PageAllocator::kNoAccess);
+                      alignment, PageAllocator::kNoAccess);
     return allocation_base != nullptr;
   };
   if (!gc_retry(allocate_pages)) {
     // Page allocator could not reserve enough pages.
     BackingStore::ReleaseReservation(reservation_size);
-    RecordStatus(isolate, AllocationStatus::kOtherFailure);
+    if (is_wasm_memory) RecordStatus(isolate, AllocationStatus::kOtherFailure);
     TRACE_BS("BSw:try   failed to allocate pages\n");
     return {};
   }
@@ -378,38 +422,44 @@ std::unique_ptr<BackingStore> BackingStore::TryAllocateWasmMemory(
   //--------------------------------------------------------------------------
   // 3. Commit the initial pages (allow read/write).
   //--------------------------------------------------------------------------
-  size_t byte_length = initial_pages * wasm::kWasmPageSize;
+  size_t committed_length = RoundUp(byte_length, CommitPageSize());
   auto commit_memory = [&] {
-    return byte_length == 0 ||
-           SetPermissions(GetPlatformPageAllocator(), buffer_start, byte_length,
-                          PageAllocator::kReadWrite);
+    return committed_length == 0 ||
+           SetPermissions(GetPlatformPageAllocator(), buffer_start,
+                          committed_length, PageAllocator::kReadWrite);
   };
   if (!gc_retry(commit_memory)) {
     // SetPermissions put us over the process memory limit.
-    V8::FatalProcessOutOfMemory(nullptr, "BackingStore::AllocateWasmMemory()");
+    V8::FatalProcessOutOfMemory(nullptr,
+                                is_wasm_memory
+                                    ? "BackingStore::AllocateWasmMemory()"
+                                    : "BackingStore::AllocateResizable()");
     TRACE_BS("BSw:try   failed to set permissions\n");
   }
 
   DebugCheckZero(buffer_start, byte_length);  // touch the bytes.
 
-  RecordStatus(isolate, did_retry ? AllocationStatus::kSuccessAfterRetry
-                                  : AllocationStatus::kSuccess);
+  if (is_wasm_memory) {
+    RecordStatus(isolate, did_retry ? AllocationStatus::kSuccessAfterRetry
+                                    : AllocationStatus::kSuccess);
+  }
 
-  auto result = new BackingStore(buffer_start,   // start
-                                 byte_length,    // length
-                                 byte_capacity,  // capacity
-                                 shared,         // shared
-                                 true,           // is_wasm_memory
-                                 true,           // free_on_destruct
-                                 guards,         // has_guard_regions
-                                 false,          // custom_deleter
-                                 false);         // empty_deleter
+  auto result = new BackingStore(buffer_start,    // start
+                                 byte_length,     // length
+                                 byte_capacity,   // capacity
+                                 shared,          // shared
+                                 is_wasm_memory,  // is_wasm_memory
+                                 true,            // free_on_destruct
+                                 guards,          // has_guard_regions
+                                 false,           // custom_deleter
+                                 false);          // empty_deleter
+  result->is_resizable_ = !is_wasm_memory;
 
   TRACE_BS("BSw:alloc bs=%p mem=%p (length=%zu, capacity=%zu)\n", result,
            result->buffer_start(), byte_length, byte_capacity);
 
   // Shared Wasm memories need an anchor for the memory object list.
-  if (shared == SharedFlag::kShared) {
+  if (is_wasm_memory && shared == SharedFlag::kShared) {
     result->type_specific_data_.shared_wasm_memory_data =
         new SharedWasmMemoryData();
   }
@@ -449,6 +499,22 @@ std::unique_ptr<BackingStore> BackingStore::AllocateWasmMemory(
   return backing_store;
 }
 
+// Allocate a resizable array buffer backing store. Like Wasm memories, it
+// reserves its maximum up front so that it can grow in place, but it has no
+// guard regions.
+std::unique_ptr<BackingStore> BackingStore::AllocateResizable(
+    Isolate* isolate, size_t byte_length, size_t max_byte_length) {
+  DCHECK_LE(byte_length, max_byte_length);
+  // Cannot reserve 0 pages on some OSes.
+  size_t byte_capacity =
+      RoundUp(std::max(max_byte_length, size_t{1}), AllocatePageSize());
+  if (byte_capacity < max_byte_length) return {};  // overflow.
+  TRACE_BS("BSr:try   %zu bytes, %zu max\n", byte_length, max_byte_length);
+  return TryAllocateAndPartiallyCommitMemory(
+      isolate, byte_length, byte_capacity, AllocatePageSize(), false, false,
+      SharedFlag::kNotShared);
+}
+
 std::unique_ptr<BackingStore> BackingStore::CopyWasmMemory(Isolate* isolate,
                                                            size_t new_pages) {
   // Note that we could allocate uninitialized to save initialization cost here,
@@ -548,6 +614,40 @@ base::Optional<size_t> BackingStore::GrowWasmMemoryInPlace(Isolate* isolate,
   return {old_length / wasm::kWasmPageSize};
 }
 
+bool BackingStore::ResizeInPlace(Isolate* isolate, size_t new_byte_length) {
+  DCHECK(is_resizable_);
+  DCHECK(!is_shared_);
+  if (new_byte_length > byte_capacity_) return false;
+  size_t old_length = byte_length();
+  if (new_byte_length > old_length) {
+    // Pages are only ever committed, never decommitted, so array buffers that
+    // were created with an earlier, larger length stay accessible.
+    size_t commit_length = RoundUp(new_byte_length, CommitPageSize());
+    if (!i::SetPermissions(GetPlatformPageAllocator(), buffer_start_,
+                           commit_length, PageAllocator::kReadWrite)) {
+      return false;
+    }
+  } else if (new_byte_length < old_length) {
+    // Growing again must expose zeros. Let the OS drop the whole pages.
+    byte* start = reinterpret_cast<byte*>(buffer_start_);
+    memset(start + new_byte_length, 0, old_length - new_byte_length);
+    size_t discard_start = RoundUp(new_byte_length, CommitPageSize());
+    size_t discard_end = RoundDown(old_length, CommitPageSize());
+    if (discard_start < discard_end) {
+      GetPlatformPageAllocator()->DiscardSystemPages(
+          start + discard_start, discard_end - discard_start);
+    }
+  }
+  byte_length_.store(new_byte_length, std::memory_order_relaxed);
+  TRACE_BS("BSr:resize bs=%p mem=%p (length=%zu -> %zu)\n", this,
+           buffer_start_, old_length, new_byte_length);
+  reinterpret_cast<v8::Isolate*>(isolate)
+      ->AdjustAmountOfExternalAllocatedMemory(
+          static_cast<int64_t>(new_byte_length) -
+          static_cast<int64_t>(old_length));
+  return true;
+}
+
 void BackingStore::AttachSharedWasmMemoryObject(
     Isolate* isolate, Handle<WasmMemoryObject> memory_object) {
   DCHECK(is_wasm_memory_);
@@ -625,8 +725,8 @@ std::unique_ptr<BackingStore> BackingStore::EmptyBackingStore(
 }
 
 bool BackingStore::Reallocate(Isolate* isolate, size_t new_byte_length) {
-  CHECK(!is_wasm_memory_ && !custom_deleter_ && !globally_registered_ &&
-        free_on_destruct_);
+  CHECK(!is_wasm_memory_ && !is_resizable_ && !custom_deleter_ &&
+        !globally_registered_ && free_on_destruct_);
   auto allocator = get_v8_api_array_buffer_allocator();
   CHECK_EQ(isolate->array_buffer_allocator(), allocator);
   CHECK_EQ(byte_length_, byte_capacity_);
@@ -640,7 +740,7 @@ bool BackingStore::Reallocate(Isolate* isolate, size_t new_byte_length) {
 }
 
 v8::ArrayBuffer::Allocator* BackingStore::get_v8_api_array_buffer_allocator() {
-  CHECK(!is_wasm_memory_);
+  CHECK(!is_wasm_memory_ && !is_resizable_);
   auto array_buffer_allocator =
       holds_shared_ptr_to_allocator_
           ? type_specific_data_.v8_api_array_buffer_allocator_shared.get()
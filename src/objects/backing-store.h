@@ -54,6 +54,13 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
                                                           size_t maximum_pages,
                                                           SharedFlag shared);
 
+  // Allocate a non-shared backing store of {byte_length} bytes that can later
+  // be resized in place up to {max_byte_length}, rounded up to the page size.
+  // The address space for the maximum is reserved up front through the page
+  // allocator, and pages are committed as the backing store grows.
+  static std::unique_ptr<BackingStore> AllocateResizable(
+      Isolate* isolate, size_t byte_length, size_t max_byte_length);
+
   // Create a backing store that wraps existing allocated memory.
   // If {free_on_destruct} is {true}, the memory will be freed using the
   // ArrayBufferAllocator::Free() callback when this backing store is
@@ -81,6 +88,7 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   size_t byte_capacity() const { return byte_capacity_; }
   bool is_shared() const { return is_shared_; }
   bool is_wasm_memory() const { return is_wasm_memory_; }
+  bool is_resizable() const { return is_resizable_; }
   bool has_guard_regions() const { return has_guard_regions_; }
   bool free_on_destruct() const { return free_on_destruct_; }
 
@@ -89,9 +97,23 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
                                                size_t delta_pages,
                                                size_t max_pages);
 
+  // Resize a backing store allocated by {AllocateResizable} in place. Fails if
+  // {new_byte_length} exceeds the capacity or pages can't be committed.
+  // Shrinking zeroes the released bytes but keeps them accessible, since
+  // array buffers created with the old length may still refer to them.
+  bool ResizeInPlace(Isolate* isolate, size_t new_byte_length);
+
   // Wrapper around ArrayBuffer::Allocator::Reallocate.
   bool Reallocate(Isolate* isolate, size_t new_byte_length);
 
+  // Hands the memory of this backing store over to the caller if it is owned
+  // by a plain array buffer allocated through {allocator}. The caller becomes
+  // responsible for calling ArrayBuffer::Allocator::Free() on {*buffer_start}
+  // with {*byte_length}. Returns false and keeps the memory otherwise. Must only
+  // be called by the last owner of this backing store.
+  bool ReleaseForBatchFree(v8::ArrayBuffer::Allocator* allocator,
+                           void** buffer_start, size_t* byte_length);
+
   // Allocate a new, larger, backing store for this Wasm memory and copy the
   // contents of this backing store into it.
   std::unique_ptr<BackingStore> CopyWasmMemory(Isolate* isolate,
@@ -151,6 +173,7 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
         byte_capacity_(byte_capacity),
         is_shared_(shared == SharedFlag::kShared),
         is_wasm_memory_(is_wasm_memory),
+        is_resizable_(false),
         holds_shared_ptr_to_allocator_(false),
         free_on_destruct_(free_on_destruct),
         has_guard_regions_(has_guard_regions),
@@ -194,6 +217,7 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
 
   bool is_shared_ : 1;
   bool is_wasm_memory_ : 1;
+  bool is_resizable_ : 1;
   bool holds_shared_ptr_to_allocator_ : 1;
   bool free_on_destruct_ : 1;
   bool has_guard_regions_ : 1;
@@ -209,6 +233,9 @@ class V8_EXPORT_PRIVATE BackingStore : public BackingStoreBase {
   static std::unique_ptr<BackingStore> TryAllocateWasmMemory(
       Isolate* isolate, size_t initial_pages, size_t maximum_pages,
       SharedFlag shared);
+  static std::unique_ptr<BackingStore> TryAllocateAndPartiallyCommitMemory(
+      Isolate* isolate, size_t byte_length, size_t byte_capacity,
+      size_t alignment, bool guards, bool is_wasm_memory, SharedFlag shared);
 
   DISALLOW_COPY_AND_ASSIGN(BackingStore);
 };
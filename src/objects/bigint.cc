@@ -19,6 +19,9 @@
 
 #include "src/objects/bigint.h"
 
+#include <algorithm>
+#include <vector>
+
 #include "src/execution/isolate-inl.h"
 #include "src/execution/off-thread-isolate.h"
 #include "src/heap/factory.h"
@@ -148,6 +151,24 @@ class MutableBigInt : public FreshlyAllocatedBigInt {
                                   digit_t summand, int n, MutableBigInt result);
   void InplaceMultiplyAdd(uintptr_t factor, uintptr_t summand);
 
+  // Specialized helpers for Multiply with long operands. These work on
+  // off-heap digit arrays, so that interrupts can be handled in between.
+  // Return false if handling an interrupt threw an exception.
+  static const int kKaratsubaThreshold = 34;
+  static bool KaratsubaMultiply(Isolate* isolate, Handle<BigIntBase> x,
+                                Handle<BigIntBase> y,
+                                Handle<MutableBigInt> result);
+  static bool MultiplyDigits(Isolate* isolate, uintptr_t* work_estimate,
+                             digit_t* z, const digit_t* x, int x_length,
+                             const digit_t* y, int y_length);
+  static void MultiplyDigitsSchoolbook(digit_t* z, const digit_t* x,
+                                       int x_length, const digit_t* y,
+                                       int y_length);
+  static void AddDigitsInPlace(digit_t* z, int z_length, const digit_t* x,
+                               int x_length);
+  static void SubtractDigitsInPlace(digit_t* z, int z_length,
+                                    const digit_t* x, int x_length);
+
   // Specialized helpers for Divide/Remainder.
   static void AbsoluteDivSmall(Isolate* isolate, Handle<BigIntBase> x,
                                digit_t divisor, Handle<MutableBigInt>* quotient,
@@ -527,6 +548,14 @@ MaybeHandle<BigInt> BigInt::Multiply(Isolate* isolate, Handle<BigInt> x,
     return MaybeHandle<BigInt>();
   }
   result->InitializeDigits(result_length);
+  if (x->length() >= MutableBigInt::kKaratsubaThreshold &&
+      y->length() >= MutableBigInt::kKaratsubaThreshold) {
+    if (!MutableBigInt::KaratsubaMultiply(isolate, x, y, result)) {
+      return MaybeHandle<BigInt>();
+    }
+    result->set_sign(x->sign() != y->sign());
+    return MutableBigInt::MakeImmutable(result);
+  }
   uintptr_t work_estimate = 0;
   for (int i = 0; i < x->length(); i++) {
     MutableBigInt::MultiplyAccumulate(y, x->digit(i), result, i);
@@ -1484,6 +1513,168 @@ void MutableBigInt::MultiplyAccumulate(Handle<BigIntBase> multiplicand,
   }
 }
 
+bool MutableBigInt::KaratsubaMultiply(Isolate* isolate, Handle<BigIntBase> x,
+                                      Handle<BigIntBase> y,
+                                      Handle<MutableBigInt> result) {
+  int x_length = x->length();
+  int y_length = y->length();
+  DCHECK_EQ(result->length(), x_length + y_length);
+  std::vector<digit_t> x_digits(x_length);
+  std::vector<digit_t> y_digits(y_length);
+  std::vector<digit_t> z_digits(x_length + y_length);
+  for (int i = 0; i < x_length; i++) x_digits[i] = x->digit(i);
+  for (int i = 0; i < y_length; i++) y_digits[i] = y->digit(i);
+  uintptr_t work_estimate = 0;
+  if (!MultiplyDigits(isolate, &work_estimate, z_digits.data(),
+                      x_digits.data(), x_length, y_digits.data(), y_length)) {
+    return false;
+  }
+  for (int i = 0; i < x_length + y_length; i++) {
+    result->set_digit(i, z_digits[i]);
+  }
+  return true;
+}
+
+// Stores the product of {x} and {y} in {z}, which must have room for
+// {x_length + y_length} digits. Operands of at least kKaratsubaThreshold
+// digits are split in halves, and the product is assembled from the three
+// half-size products x0*y0, x1*y1 and (x0+x1)*(y0+y1).
+bool MutableBigInt::MultiplyDigits(Isolate* isolate, uintptr_t* work_estimate,
+                                   digit_t* z, const digit_t* x, int x_length,
+                                   const digit_t* y, int y_length) {
+  if (x_length < y_length) {
+    std::swap(x, y);
+    std::swap(x_length, y_length);
+  }
+  if (y_length < kKaratsubaThreshold) {
+    MultiplyDigitsSchoolbook(z, x, x_length, y, y_length);
+    // Same interrupt check as in BigInt::Multiply.
+    *work_estimate += static_cast<uintptr_t>(x_length) * y_length;
+    if (*work_estimate > 5000000) {
+      *work_estimate = 0;
+      StackLimitCheck interrupt_check(isolate);
+      if (interrupt_check.InterruptRequested() &&
+          isolate->stack_guard()->HandleInterrupts().IsException(isolate)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // If {x} is much longer than {y}, multiply {y} with {y_length}-sized
+  // chunks of {x}, so that the halves below are balanced.
+  if (x_length >= 2 * y_length) {
+    std::fill(z, z + x_length + y_length, 0);
+    std::vector<digit_t> part(2 * y_length);
+    for (int i = 0; i < x_length; i += y_length) {
+      int chunk_length = std::min(y_length, x_length - i);
+      if (!MultiplyDigits(isolate, work_estimate, part.data(), x + i,
+                          chunk_length, y, y_length)) {
+        return false;
+      }
+      AddDigitsInPlace(z + i, x_length + y_length - i, part.data(),
+                       chunk_length + y_length);
+    }
+    return true;
+  }
+
+  // x = x1 * B^k + x0, y = y1 * B^k + y0, with y_length > k.
+  int k = x_length / 2;
+  int x1_length = x_length - k;
+  int y1_length = y_length - k;
+  DCHECK_LT(0, y1_length);
+  // z0 = x0 * y0 and z2 = x1 * y1 go straight into their final place.
+  if (!MultiplyDigits(isolate, work_estimate, z, x, k, y, k) ||
+      !MultiplyDigits(isolate, work_estimate, z + 2 * k, x + k, x1_length,
+                      y + k, y1_length)) {
+    return false;
+  }
+  // z1 = (x0 + x1) * (y0 + y1) - z0 - z2 = x0 * y1 + x1 * y0.
+  int x_sum_length = x1_length + 1;
+  int y_sum_length = std::max(k, y1_length) + 1;
+  std::vector<digit_t> x_sum(x_sum_length);
+  std::vector<digit_t> y_sum(y_sum_length);
+  std::copy(x + k, x + x_length, x_sum.begin());
+  AddDigitsInPlace(x_sum.data(), x_sum_length, x, k);
+  std::copy(y, y + k, y_sum.begin());
+  AddDigitsInPlace(y_sum.data(), y_sum_length, y + k, y1_length);
+  int z1_length = x_sum_length + y_sum_length;
+  std::vector<digit_t> z1(z1_length);
+  if (!MultiplyDigits(isolate, work_estimate, z1.data(), x_sum.data(),
+                      x_sum_length, y_sum.data(), y_sum_length)) {
+    return false;
+  }
+  SubtractDigitsInPlace(z1.data(), z1_length, z, 2 * k);
+  SubtractDigitsInPlace(z1.data(), z1_length, z + 2 * k,
+                        x1_length + y1_length);
+  AddDigitsInPlace(z + k, x_length + y_length - k, z1.data(), z1_length);
+  return true;
+}
+
+void MutableBigInt::MultiplyDigitsSchoolbook(digit_t* z, const digit_t* x,
+                                             int x_length, const digit_t* y,
+                                             int y_length) {
+  std::fill(z, z + x_length + y_length, 0);
+  for (int i = 0; i < y_length; i++) {
+    digit_t multiplier = y[i];
+    if (multiplier == 0) continue;
+    digit_t carry = 0;
+    digit_t high = 0;
+    for (int j = 0; j < x_length; j++) {
+      digit_t new_carry = 0;
+      digit_t acc = digit_add(z[i + j], high, &new_carry);
+      acc = digit_add(acc, carry, &new_carry);
+      digit_t low = digit_mul(multiplier, x[j], &high);
+      acc = digit_add(acc, low, &new_carry);
+      z[i + j] = acc;
+      carry = new_carry;
+    }
+    // z[i + x_length] hasn't been written yet, and the product fits.
+    z[i + x_length] = carry + high;
+  }
+}
+
+// Adds {x} to {z}. The sum must fit into {z_length} digits; digits of {x}
+// beyond that must be zero.
+void MutableBigInt::AddDigitsInPlace(digit_t* z, int z_length,
+                                     const digit_t* x, int x_length) {
+  for (; x_length > z_length; x_length--) DCHECK_EQ(0, x[x_length - 1]);
+  digit_t carry = 0;
+  int i = 0;
+  for (; i < x_length; i++) {
+    digit_t new_carry = 0;
+    digit_t sum = digit_add(z[i], x[i], &new_carry);
+    z[i] = digit_add(sum, carry, &new_carry);
+    carry = new_carry;
+  }
+  for (; carry != 0; i++) {
+    DCHECK_LT(i, z_length);
+    digit_t new_carry = 0;
+    z[i] = digit_add(z[i], carry, &new_carry);
+    carry = new_carry;
+  }
+}
+
+// Subtracts {x} from {z}, which must not be smaller than {x}.
+void MutableBigInt::SubtractDigitsInPlace(digit_t* z, int z_length,
+                                          const digit_t* x, int x_length) {
+  for (; x_length > z_length; x_length--) DCHECK_EQ(0, x[x_length - 1]);
+  digit_t borrow = 0;
+  int i = 0;
+  for (; i < x_length; i++) {
+    digit_t new_borrow = 0;
+    digit_t difference = digit_sub(z[i], x[i], &new_borrow);
+    z[i] = digit_sub(difference, borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  for (; borrow != 0; i++) {
+    DCHECK_LT(i, z_length);
+    digit_t new_borrow = 0;
+    z[i] = digit_sub(z[i], borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+}
+
 // Multiplies {source} with {factor} and adds {summand} to the result.
 // {result} and {source} may be the same BigInt for inplace modification.
 void MutableBigInt::InternalMultiplyAdd(BigIntBase source, digit_t factor,
@@ -923,9 +923,18 @@ void BytecodeArray::MakeOlder() {
 }
 
 bool BytecodeArray::IsOld() const {
+  // Flushing small bytecode frees little memory, but the function still has
+  // to be reparsed and recompiled if it runs again. Keep it around longer.
+  if (length() < FLAG_flush_bytecode_min_size) {
+    return bytecode_age() >= kLastBytecodeAge;
+  }
   return bytecode_age() >= kIsOldBytecodeAge;
 }
 
+bool BytecodeArray::IsCold() const {
+  return bytecode_age() >= kIsColdBytecodeAge;
+}
+
 DependentCode DependentCode::GetDependentCode(Handle<HeapObject> object) {
   if (object->IsMap()) {
     return Handle<Map>::cast(object)->dependent_code();
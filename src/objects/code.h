@@ -753,6 +753,7 @@ class BytecodeArray : public FixedArrayBase {
     kFirstBytecodeAge = kNoAgeBytecodeAge,
     kLastBytecodeAge = kAfterLastBytecodeAge - 1,
     kBytecodeAgeCount = kAfterLastBytecodeAge - kFirstBytecodeAge - 1,
+    kIsColdBytecodeAge = kQuinquagenarianBytecodeAge,
     kIsOldBytecodeAge = kSexagenarianBytecodeAge
   };
 
@@ -844,6 +845,9 @@ class BytecodeArray : public FixedArrayBase {
 
   // Bytecode aging
   V8_EXPORT_PRIVATE bool IsOld() const;
+  // Cold bytecode has not run for long enough that its feedback vector can be
+  // dropped, but not yet long enough for the bytecode itself to be flushed.
+  V8_EXPORT_PRIVATE bool IsCold() const;
   V8_EXPORT_PRIVATE void MakeOlder();
 
   // Clear uninitialized padding space. This ensures that the snapshot content
@@ -37,7 +37,7 @@ class CompilationCacheShape : public BaseShape<HashTableKey*> {
   static inline uint32_t HashForObject(ReadOnlyRoots roots, Object object);
 
   static const int kPrefixSize = 0;
-  static const int kEntrySize = 3;
+  static const int kEntrySize = 4;
   static const bool kMatchNeedsHoleCheck = true;
 };
 
@@ -90,30 +90,37 @@ EXTERN_DECLARE_HASH_TABLE(CompilationCacheTable, CompilationCacheShape)
 // either the recompilation stub, or to "old" code. This avoids memory
 // leaks due to premature caching of scripts and eval strings that are
 // never needed later.
+//
+// Script and eval entries additionally record when they were last used, so
+// that their caches can evict the least recently used entries once the sources
+// they keep alive exceed --compilation-cache-script-max-size and
+// --compilation-cache-eval-max-size respectively.
 class CompilationCacheTable
     : public HashTable<CompilationCacheTable, CompilationCacheShape> {
  public:
   NEVER_READ_ONLY_SPACE
   static MaybeHandle<SharedFunctionInfo> LookupScript(
       Handle<CompilationCacheTable> table, Handle<String> src,
-      Handle<Context> native_context, LanguageMode language_mode);
+      Handle<Context> native_context, LanguageMode language_mode,
+      int last_use);
   static InfoCellPair LookupEval(Handle<CompilationCacheTable> table,
                                  Handle<String> src,
                                  Handle<SharedFunctionInfo> shared,
                                  Handle<Context> native_context,
-                                 LanguageMode language_mode, int position);
+                                 LanguageMode language_mode, int position,
+                                 int last_use);
   Handle<Object> LookupRegExp(Handle<String> source, JSRegExp::Flags flags);
   MaybeHandle<Code> LookupCode(Handle<SharedFunctionInfo> key);
 
   static Handle<CompilationCacheTable> PutScript(
       Handle<CompilationCacheTable> cache, Handle<String> src,
       Handle<Context> native_context, LanguageMode language_mode,
-      Handle<SharedFunctionInfo> value);
+      Handle<SharedFunctionInfo> value, int last_use);
   static Handle<CompilationCacheTable> PutEval(
       Handle<CompilationCacheTable> cache, Handle<String> src,
       Handle<SharedFunctionInfo> outer_info, Handle<SharedFunctionInfo> value,
       Handle<Context> native_context, Handle<FeedbackCell> feedback_cell,
-      int position);
+      int position, int last_use);
   static Handle<CompilationCacheTable> PutRegExp(
       Isolate* isolate, Handle<CompilationCacheTable> cache, Handle<String> src,
       JSRegExp::Flags flags, Handle<FixedArray> value);
@@ -122,8 +129,18 @@ class CompilationCacheTable
       Handle<SharedFunctionInfo> key, Handle<Code> value);
   void Remove(Object value);
   void Age();
+
+  // The number of source bytes kept alive by script and eval entries.
+  size_t SourceSize();
+  // Removes the least recently used script or eval entry and returns the
+  // number of source bytes it kept alive, or 0 if there are no such entries.
+  size_t RemoveLeastRecentlyUsed();
+
   static const int kHashGenerations = 10;
 
+  // Offset within an entry of the last use of script and eval entries.
+  static const int kEntryLastUseIndex = 3;
+
   DECL_CAST(CompilationCacheTable)
 
  private:
@@ -4,6 +4,7 @@
 
 #include "src/objects/elements.h"
 
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments.h"
 #include "src/execution/frames.h"
@@ -4773,6 +4774,60 @@ void CopyTypedArrayElementsSlice(Address raw_source, Address raw_destination,
       source, destination, start, end);
 }
 
+namespace {
+
+// Compares a whole block of elements before branching on the result, so the
+// C++ compiler can vectorize the comparisons.
+template <typename T>
+intptr_t SearchElements(Address data, uintptr_t length, uintptr_t index,
+                        T search) {
+  static constexpr uintptr_t kBlockSize = 8;
+  for (; index + kBlockSize <= length; index += kBlockSize) {
+    bool found = false;
+    for (uintptr_t i = 0; i < kBlockSize; i++) {
+      found |= base::ReadUnalignedValue<T>(data + (index + i) * sizeof(T)) ==
+               search;
+    }
+    if (found) break;
+  }
+  for (; index < length; index++) {
+    if (base::ReadUnalignedValue<T>(data + index * sizeof(T)) == search) {
+      return static_cast<intptr_t>(index);
+    }
+  }
+  return -1;
+}
+
+}  // namespace
+
+intptr_t ArrayIndexOfIncludesSmiOrObject(Address raw_elements,
+                                         uintptr_t length,
+                                         uintptr_t from_index,
+                                         Address raw_search_element) {
+  DisallowHeapAllocation no_gc;
+  FixedArray elements = FixedArray::cast(Object(raw_elements));
+  DCHECK_LE(length, elements.length());
+  // Slots hold compressed values with pointer compression, which are the
+  // lower bits of the full pointer.
+  return SearchElements<Tagged_t>(elements.RawFieldOfElementAt(0).address(),
+                                  length, from_index,
+                                  static_cast<Tagged_t>(raw_search_element));
+}
+
+intptr_t ArrayIndexOfIncludesDouble(Address raw_elements, uintptr_t length,
+                                    uintptr_t from_index,
+                                    Address raw_search_element) {
+  DisallowHeapAllocation no_gc;
+  FixedDoubleArray elements = FixedDoubleArray::cast(Object(raw_elements));
+  DCHECK_LE(length, elements.length());
+  double search = Object(raw_search_element).Number();
+  // The hole is a NaN and never equal to {search}.
+  DCHECK(!std::isnan(search));
+  return SearchElements<double>(
+      elements.address() + FixedDoubleArray::OffsetOfElementAt(0), length,
+      from_index, search);
+}
+
 void ElementsAccessor::InitializeOncePerProcess() {
   static ElementsAccessor* accessor_array[] = {
 #define ACCESSOR_ARRAY(Class, Kind, Store) new Class(),
@@ -225,6 +225,19 @@ void CopyTypedArrayElementsToTypedArray(Address raw_source,
 // {raw_source}, {raw_destination}: JSTypedArray pointers.
 void CopyTypedArrayElementsSlice(Address raw_source, Address raw_destination,
                                  uintptr_t start, uintptr_t end);
+// Called directly from CSA for Array.prototype.indexOf and includes.
+// Return the index of the first element in [from_index, length) that matches
+// {raw_search_element}, or -1.
+// {raw_elements}: FixedArray pointer; matches identical objects.
+intptr_t ArrayIndexOfIncludesSmiOrObject(Address raw_elements,
+                                         uintptr_t length,
+                                         uintptr_t from_index,
+                                         Address raw_search_element);
+// {raw_elements}: FixedDoubleArray pointer; {raw_search_element} is a
+// non-NaN Number and matches equal doubles.
+intptr_t ArrayIndexOfIncludesDouble(Address raw_elements, uintptr_t length,
+                                    uintptr_t from_index,
+                                    Address raw_search_element);
 
 }  // namespace internal
 }  // namespace v8
@@ -7,6 +7,8 @@
 
 #include "src/objects/feedback-cell.h"
 
+#include "src/execution/isolate-utils-inl.h"
+#include "src/execution/isolate.h"
 #include "src/heap/heap-write-barrier-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/struct-inl.h"
@@ -30,7 +32,7 @@ void FeedbackCell::reset_feedback_vector(
     base::Optional<std::function<void(HeapObject object, ObjectSlot slot,
                                       HeapObject target)>>
         gc_notify_updated_slot) {
-  SetInitialInterruptBudget();
+  SetInitialInterruptBudget(GetIsolateFromWritableObject(*this));
   if (value().IsUndefined() || value().IsClosureFeedbackCellArray()) return;
 
   CHECK(value().IsFeedbackVector());
@@ -43,16 +45,16 @@ void FeedbackCell::reset_feedback_vector(
   }
 }
 
-void FeedbackCell::SetInitialInterruptBudget() {
+void FeedbackCell::SetInitialInterruptBudget(Isolate* isolate) {
   if (FLAG_lazy_feedback_allocation) {
-    set_interrupt_budget(FLAG_budget_for_feedback_vector_allocation);
+    set_interrupt_budget(isolate->budget_for_feedback_vector_allocation());
   } else {
-    set_interrupt_budget(FLAG_interrupt_budget);
+    set_interrupt_budget(isolate->interrupt_budget());
   }
 }
 
-void FeedbackCell::SetInterruptBudget() {
-  set_interrupt_budget(FLAG_interrupt_budget);
+void FeedbackCell::SetInterruptBudget(Isolate* isolate) {
+  set_interrupt_budget(isolate->interrupt_budget());
 }
 
 }  // namespace internal
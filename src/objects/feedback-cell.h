@@ -31,8 +31,8 @@ class FeedbackCell : public TorqueGeneratedFeedbackCell<FeedbackCell, Struct> {
       base::Optional<std::function<void(HeapObject object, ObjectSlot slot,
                                         HeapObject target)>>
           gc_notify_updated_slot = base::nullopt);
-  inline void SetInitialInterruptBudget();
-  inline void SetInterruptBudget();
+  inline void SetInitialInterruptBudget(Isolate* isolate);
+  inline void SetInterruptBudget(Isolate* isolate);
 
   using BodyDescriptor =
       FixedBodyDescriptor<kValueOffset, kInterruptBudgetOffset, kAlignedSize>;
@@ -109,11 +109,12 @@ INT32_ACCESSORS(FeedbackVector, length, kLengthOffset)
 INT32_ACCESSORS(FeedbackVector, invocation_count, kInvocationCountOffset)
 INT32_ACCESSORS(FeedbackVector, profiler_ticks, kProfilerTicksOffset)
 
-void FeedbackVector::clear_padding() {
-  if (FIELD_SIZE(kPaddingOffset) == 0) return;
-  DCHECK_EQ(4, FIELD_SIZE(kPaddingOffset));
-  memset(reinterpret_cast<void*>(address() + kPaddingOffset), 0,
-         FIELD_SIZE(kPaddingOffset));
+uint32_t FeedbackVector::deopt_history() const {
+  return ReadField<uint32_t>(kDeoptHistoryOffset);
+}
+
+void FeedbackVector::set_deopt_history(uint32_t value) {
+  WriteField<uint32_t>(kDeoptHistoryOffset, value);
 }
 
 bool FeedbackVector::is_empty() const { return length() == 0; }
@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include "src/objects/feedback-vector.h"
+#include "src/base/functional.h"
 #include "src/diagnostics/code-tracer.h"
 #include "src/heap/off-thread-factory-inl.h"
 #include "src/ic/handler-configuration-inl.h"
@@ -317,7 +318,7 @@ Handle<FeedbackVector> FeedbackVector::New(
   }
 
   Handle<FeedbackVector> result = Handle<FeedbackVector>::cast(vector);
-  if (!isolate->is_best_effort_code_coverage() ||
+  if (isolate->needs_feedback_vectors_for_code_coverage() ||
       isolate->is_collecting_type_profile()) {
     AddToVectorsForProfilingTools(isolate, result);
   }
@@ -364,7 +365,7 @@ Handle<FeedbackVector> FeedbackVector::NewWithOneCompareSlotForTesting(
 // static
 void FeedbackVector::AddToVectorsForProfilingTools(
     Isolate* isolate, Handle<FeedbackVector> vector) {
-  DCHECK(!isolate->is_best_effort_code_coverage() ||
+  DCHECK(isolate->needs_feedback_vectors_for_code_coverage() ||
          isolate->is_collecting_type_profile());
   if (!vector->shared_function_info().IsSubjectToDebugging()) return;
   Handle<ArrayList> list = Handle<ArrayList>::cast(
@@ -423,6 +424,24 @@ void FeedbackVector::EvictOptimizedCodeMarkedForDeoptimization(
   }
 }
 
+bool FeedbackVector::RecordDeoptimization(DeoptimizeReason reason,
+                                          SourcePosition position) {
+  uint32_t position_hash = static_cast<uint32_t>(
+      base::hash_value(position.raw()) & DeoptPositionHashBits::kMax);
+  uint32_t history = deopt_history();
+  int count = 1;
+  if (DeoptCountBits::decode(history) > 0 &&
+      DeoptReasonBits::decode(history) == reason &&
+      DeoptPositionHashBits::decode(history) == position_hash) {
+    count = std::min(DeoptCountBits::decode(history) + 1,
+                     static_cast<int>(DeoptCountBits::kMax));
+  }
+  set_deopt_history(DeoptReasonBits::encode(reason) |
+                    DeoptCountBits::encode(count) |
+                    DeoptPositionHashBits::encode(position_hash));
+  return FLAG_deopt_loop_threshold > 0 && count >= FLAG_deopt_loop_threshold;
+}
+
 bool FeedbackVector::ClearSlots(Isolate* isolate) {
   if (!shared_function_info().HasFeedbackMetadata()) return false;
   MaybeObject uninitialized_sentinel = MaybeObject::FromObject(
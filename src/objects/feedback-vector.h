@@ -10,7 +10,9 @@
 #include "src/base/bit-field.h"
 #include "src/base/logging.h"
 #include "src/base/macros.h"
+#include "src/codegen/source-position.h"
 #include "src/common/globals.h"
+#include "src/deoptimizer/deoptimize-reason.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/map.h"
 #include "src/objects/name.h"
@@ -212,8 +214,15 @@ class FeedbackVector : public HeapObject {
   // runtime profiler.
   DECL_INT32_ACCESSORS(profiler_ticks)
 
-  // Initialize the padding if necessary.
-  inline void clear_padding();
+  // [deopt_history]: The reason and position of the last eager or soft
+  // deoptimization of optimized code for this function, and the number of
+  // times in a row that optimized code deoptimized there.
+  DECL_PRIMITIVE_ACCESSORS(deopt_history, uint32_t)
+
+  // Records an eager or soft deoptimization for {reason} at {position}.
+  // Returns true if optimized code for this function keeps deoptimizing at the
+  // same place for the same reason, i.e. re-optimizing it is not worthwhile.
+  bool RecordDeoptimization(DeoptimizeReason reason, SourcePosition position);
 
   inline void clear_invocation_count();
 
@@ -327,6 +336,16 @@ class FeedbackVector : public HeapObject {
                 "Header must be padded for alignment");
   static const int kFeedbackSlotsOffset = kHeaderSize;
 
+  // Bit positions in the deopt history. The position is only kept as a hash,
+  // which is good enough to tell apart deoptimizations in the same function.
+#define DEOPT_HISTORY_BIT_FIELDS(V, _)      \
+  V(DeoptReasonBits, DeoptimizeReason, 8, _) \
+  V(DeoptCountBits, int, 4, _)               \
+  V(DeoptPositionHashBits, uint32_t, 20, _)
+
+  DEFINE_BIT_FIELDS(DEOPT_HISTORY_BIT_FIELDS)
+#undef DEOPT_HISTORY_BIT_FIELDS
+
   class BodyDescriptor;
 
   static constexpr int OffsetOfElementAt(int index) {
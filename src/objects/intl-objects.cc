@@ -1013,16 +1013,16 @@ MaybeHandle<String> Intl::StringLocaleConvertCase(Isolate* isolate,
 MaybeHandle<Object> Intl::StringLocaleCompare(
     Isolate* isolate, Handle<String> string1, Handle<String> string2,
     Handle<Object> locales, Handle<Object> options, const char* method) {
-  // We only cache the instance when both locales and options are undefined,
-  // as that is the only case when the specified side-effects of examining
-  // those arguments are unobservable.
+  // We only cache the instance when locales is undefined or a string and
+  // options is undefined, as that is the only case when the specified
+  // side-effects of examining those arguments are unobservable.
   bool can_cache =
-      locales->IsUndefined(isolate) && options->IsUndefined(isolate);
+      (locales->IsUndefined(isolate) || locales->IsString()) &&
+      options->IsUndefined(isolate);
   if (can_cache) {
-    // Both locales and options are undefined, check the cache.
     icu::Collator* cached_icu_collator =
         static_cast<icu::Collator*>(isolate->get_cached_icu_object(
-            Isolate::ICUObjectCacheType::kDefaultCollator));
+            Isolate::ICUObjectCacheType::kDefaultCollator, locales));
     // We may use the cached icu::Collator for a fast path.
     if (cached_icu_collator != nullptr) {
       return Intl::CompareStrings(isolate, *cached_icu_collator, string1,
@@ -1041,7 +1041,7 @@ MaybeHandle<Object> Intl::StringLocaleCompare(
       New<JSCollator>(isolate, constructor, locales, options, method), Object);
   if (can_cache) {
     isolate->set_icu_object_in_cache(
-        Isolate::ICUObjectCacheType::kDefaultCollator,
+        Isolate::ICUObjectCacheType::kDefaultCollator, locales,
         std::static_pointer_cast<icu::UMemory>(collator->icu_collator().get()));
   }
   icu::Collator* icu_collator = collator->icu_collator().raw();
@@ -1103,16 +1103,17 @@ MaybeHandle<String> Intl::NumberToLocaleString(Isolate* isolate,
   ASSIGN_RETURN_ON_EXCEPTION(isolate, numeric_obj,
                              Object::ToNumeric(isolate, num), String);
 
-  // We only cache the instance when both locales and options are undefined,
-  // as that is the only case when the specified side-effects of examining
-  // those arguments are unobservable.
+  // We only cache the instance when locales is undefined or a string and
+  // options is undefined, as that is the only case when the specified
+  // side-effects of examining those arguments are unobservable.
   bool can_cache =
-      locales->IsUndefined(isolate) && options->IsUndefined(isolate);
+      (locales->IsUndefined(isolate) || locales->IsString()) &&
+      options->IsUndefined(isolate);
   if (can_cache) {
     icu::number::LocalizedNumberFormatter* cached_number_format =
         static_cast<icu::number::LocalizedNumberFormatter*>(
             isolate->get_cached_icu_object(
-                Isolate::ICUObjectCacheType::kDefaultNumberFormat));
+                Isolate::ICUObjectCacheType::kDefaultNumberFormat, locales));
     // We may use the cached icu::NumberFormat for a fast path.
     if (cached_number_format != nullptr) {
       return JSNumberFormat::FormatNumeric(isolate, *cached_number_format,
@@ -1133,7 +1134,7 @@ MaybeHandle<String> Intl::NumberToLocaleString(Isolate* isolate,
 
   if (can_cache) {
     isolate->set_icu_object_in_cache(
-        Isolate::ICUObjectCacheType::kDefaultNumberFormat,
+        Isolate::ICUObjectCacheType::kDefaultNumberFormat, locales,
         std::static_pointer_cast<icu::UMemory>(
             number_format->icu_number_formatter().get()));
   }
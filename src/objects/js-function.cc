@@ -285,6 +285,52 @@ void JSFunction::ResetIfBytecodeFlushed(
   }
 }
 
+bool JSFunction::NeedsResetDueToColdFeedbackVector() {
+  // Like NeedsResetDueToFlushedBytecode, this may be called on a concurrent
+  // thread, so only do raw reads and be conservative.
+  Object maybe_shared = ACQUIRE_READ_FIELD(*this, kSharedFunctionInfoOffset);
+  Object maybe_code = RELAXED_READ_FIELD(*this, kCodeOffset);
+  Object maybe_cell = RELAXED_READ_FIELD(*this, kFeedbackCellOffset);
+
+  if (!maybe_shared.IsSharedFunctionInfo() || !maybe_code.IsCode() ||
+      !maybe_cell.IsFeedbackCell()) {
+    return false;
+  }
+
+  // Only plain interpreted functions can go back to running without a
+  // feedback vector; optimized code and pending optimizations rely on it.
+  if (Code::cast(maybe_code).builtin_index() !=
+      Builtins::kInterpreterEntryTrampoline) {
+    return false;
+  }
+  Object maybe_vector = FeedbackCell::cast(maybe_cell).value();
+  if (!maybe_vector.IsFeedbackVector()) return false;
+  FeedbackVector vector = FeedbackVector::cast(maybe_vector);
+  if (vector.has_optimized_code() || vector.has_optimization_marker()) {
+    return false;
+  }
+
+  Object data = SharedFunctionInfo::cast(maybe_shared).function_data();
+  return data.IsBytecodeArray() && BytecodeArray::cast(data).IsCold();
+}
+
+void JSFunction::ResetIfFeedbackVectorCold(
+    base::Optional<std::function<void(HeapObject object, ObjectSlot slot,
+                                      HeapObject target)>>
+        gc_notify_updated_slot) {
+  if (!FLAG_flush_feedback_vectors || !NeedsResetDueToColdFeedbackVector()) {
+    return;
+  }
+  // Coverage and type profiling keep their own list of feedback vectors and
+  // read counts out of them.
+  Isolate* isolate = GetIsolate();
+  if (isolate->needs_feedback_vectors_for_code_coverage() ||
+      isolate->is_collecting_type_profile()) {
+    return;
+  }
+  raw_feedback_cell().reset_feedback_vector(gc_notify_updated_slot);
+}
+
 // static
 MaybeHandle<NativeContext> JSBoundFunction::GetFunctionRealm(
     Handle<JSBoundFunction> function) {
@@ -455,7 +501,7 @@ void JSFunction::EnsureFeedbackVector(Handle<JSFunction> function,
   DCHECK(function->raw_feedback_cell() !=
          isolate->heap()->many_closures_cell());
   function->raw_feedback_cell().set_value(*feedback_vector);
-  function->raw_feedback_cell().SetInterruptBudget();
+  function->raw_feedback_cell().SetInterruptBudget(isolate);
 }
 
 // static
@@ -474,7 +520,8 @@ void JSFunction::InitializeFeedbackCell(Handle<JSFunction> function,
       function->shared().may_have_cached_code() ||
       // We also need a feedback vector for certain log events, collecting type
       // profile and more precise code coverage.
-      FLAG_log_function_events || !isolate->is_best_effort_code_coverage() ||
+      FLAG_log_function_events ||
+      isolate->needs_feedback_vectors_for_code_coverage() ||
       isolate->is_collecting_type_profile();
 
   if (needs_feedback_vector) {
@@ -181,6 +181,14 @@ class JSFunction : public JSFunctionOrBoundFunction {
                                         HeapObject target)>>
           gc_notify_updated_slot = base::nullopt);
 
+  // Drops the feedback vector of an interpreted function whose bytecode has
+  // not run for a while, leaving it to be reallocated lazily.
+  bool NeedsResetDueToColdFeedbackVector();
+  void ResetIfFeedbackVectorCold(
+      base::Optional<std::function<void(HeapObject object, ObjectSlot slot,
+                                        HeapObject target)>>
+          gc_notify_updated_slot = base::nullopt);
+
   DECL_GETTER_NONINLINE(has_prototype_slot, bool)
 
   // The initial map for an object created by this constructor.
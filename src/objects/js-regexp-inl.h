@@ -38,6 +38,7 @@ int JSRegExp::CaptureCount() const {
   switch (TypeTag()) {
     case ATOM:
       return 0;
+    case EXPERIMENTAL:
     case IRREGEXP:
       return Smi::ToInt(DataAt(kIrregexpCaptureCountIndex));
     default:
@@ -66,7 +67,7 @@ String JSRegExp::Pattern() {
 
 Object JSRegExp::CaptureNameMap() {
   DCHECK(this->data().IsFixedArray());
-  DCHECK_EQ(TypeTag(), IRREGEXP);
+  DCHECK(TypeTag() == IRREGEXP || TypeTag() == EXPERIMENTAL);
   Object value = DataAt(kIrregexpCaptureNameMapIndex);
   DCHECK_NE(value, Smi::FromInt(JSRegExp::kUninitializedValue));
   return value;
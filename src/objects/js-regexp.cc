@@ -171,12 +171,12 @@ uint32_t JSRegExp::BacktrackLimit() const {
 // static
 JSRegExp::Flags JSRegExp::FlagsFromString(Isolate* isolate,
                                           Handle<String> flags, bool* success) {
-  STATIC_ASSERT(*JSRegExp::FlagFromChar('g') == JSRegExp::kGlobal);
-  STATIC_ASSERT(*JSRegExp::FlagFromChar('i') == JSRegExp::kIgnoreCase);
-  STATIC_ASSERT(*JSRegExp::FlagFromChar('m') == JSRegExp::kMultiline);
-  STATIC_ASSERT(*JSRegExp::FlagFromChar('s') == JSRegExp::kDotAll);
-  STATIC_ASSERT(*JSRegExp::FlagFromChar('u') == JSRegExp::kUnicode);
-  STATIC_ASSERT(*JSRegExp::FlagFromChar('y') == JSRegExp::kSticky);
+  DCHECK(*JSRegExp::FlagFromChar('g') == JSRegExp::kGlobal);
+  DCHECK(*JSRegExp::FlagFromChar('i') == JSRegExp::kIgnoreCase);
+  DCHECK(*JSRegExp::FlagFromChar('m') == JSRegExp::kMultiline);
+  DCHECK(*JSRegExp::FlagFromChar('s') == JSRegExp::kDotAll);
+  DCHECK(*JSRegExp::FlagFromChar('u') == JSRegExp::kUnicode);
+  DCHECK(*JSRegExp::FlagFromChar('y') == JSRegExp::kSticky);
 
   int length = flags->length();
   if (length == 0) {
@@ -252,7 +252,7 @@ bool JSRegExp::ShouldProduceBytecode() {
 // tier-up ticks value is not set.
 bool JSRegExp::MarkedForTierUp() {
   DCHECK(data().IsFixedArray());
-  if (TypeTag() == JSRegExp::ATOM || !FLAG_regexp_tier_up) {
+  if (TypeTag() != JSRegExp::IRREGEXP || !FLAG_regexp_tier_up) {
     return false;
   }
   return Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex)) == 0;
@@ -266,15 +266,20 @@ void JSRegExp::ResetLastTierUpTick() {
                                Smi::FromInt(tier_up_ticks));
 }
 
-void JSRegExp::TierUpTick() {
+void JSRegExp::TierUpTick(int subject_chars) {
   DCHECK(FLAG_regexp_tier_up);
   DCHECK_EQ(TypeTag(), JSRegExp::IRREGEXP);
   int tier_up_ticks = Smi::ToInt(DataAt(kIrregexpTicksUntilTierUpIndex));
   if (tier_up_ticks == 0) {
     return;
   }
-  FixedArray::cast(data()).set(JSRegExp::kIrregexpTicksUntilTierUpIndex,
-                               Smi::FromInt(tier_up_ticks - 1));
+  // With a subject character budget, every execution costs at least one tick
+  // so that executions on empty subjects eventually tier-up as well.
+  int cost =
+      FLAG_regexp_tier_up_subject_chars > 0 ? std::max(subject_chars, 1) : 1;
+  FixedArray::cast(data()).set(
+      JSRegExp::kIrregexpTicksUntilTierUpIndex,
+      Smi::FromInt(std::max(tier_up_ticks - cost, 0)));
 }
 
 void JSRegExp::MarkTierUpForNextExec() {
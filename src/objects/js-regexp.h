@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_JS_REGEXP_H_
 #define V8_OBJECTS_JS_REGEXP_H_
 
+#include "src/flags/flags.h"
 #include "src/objects/js-array.h"
 #include "torque-generated/bit-fields-tq.h"
 
@@ -36,11 +37,15 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   // NOT_COMPILED: Initial value. No data has been stored in the JSRegExp yet.
   // ATOM: A simple string to match against using an indexOf operation.
   // IRREGEXP: Compiled with Irregexp.
-  enum Type { NOT_COMPILED, ATOM, IRREGEXP };
+  // EXPERIMENTAL: Compiled to bytecode for the linear-time experimental
+  //   engine.
+  enum Type { NOT_COMPILED, ATOM, IRREGEXP, EXPERIMENTAL };
   DEFINE_TORQUE_GENERATED_JS_REG_EXP_FLAGS()
 
-  static constexpr base::Optional<Flag> FlagFromChar(char c) {
-    STATIC_ASSERT(kFlagCount == 6);
+  // The 'l' flag is only recognized with
+  // --enable-experimental-regexp-engine.
+  static base::Optional<Flag> FlagFromChar(char c) {
+    STATIC_ASSERT(kFlagCount == 7);
     // clang-format off
     return c == 'g' ? base::Optional<Flag>(kGlobal)
          : c == 'i' ? base::Optional<Flag>(kIgnoreCase)
@@ -48,6 +53,8 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
          : c == 'y' ? base::Optional<Flag>(kSticky)
          : c == 'u' ? base::Optional<Flag>(kUnicode)
          : c == 's' ? base::Optional<Flag>(kDotAll)
+         : (FLAG_enable_experimental_regexp_engine && c == 'l')
+           ? base::Optional<Flag>(kLinear)
          : base::Optional<Flag>();
     // clang-format on
   }
@@ -59,6 +66,7 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   STATIC_ASSERT(static_cast<int>(kSticky) == v8::RegExp::kSticky);
   STATIC_ASSERT(static_cast<int>(kUnicode) == v8::RegExp::kUnicode);
   STATIC_ASSERT(static_cast<int>(kDotAll) == v8::RegExp::kDotAll);
+  STATIC_ASSERT(static_cast<int>(kLinear) == v8::RegExp::kLinear);
   STATIC_ASSERT(kFlagCount == v8::RegExp::kFlagCount);
 
   DECL_ACCESSORS(last_index, Object)
@@ -83,7 +91,9 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
 
   bool MarkedForTierUp();
   void ResetLastTierUpTick();
-  void TierUpTick();
+  // Accounts for one interpreter execution that scans `subject_chars`
+  // characters.
+  void TierUpTick(int subject_chars);
   void MarkTierUpForNextExec();
 
   inline Type TypeTag() const;
@@ -178,7 +188,8 @@ class JSRegExp : public TorqueGeneratedJSRegExp<JSRegExp, JSObject> {
   static const int kIrregexpCaptureNameMapIndex = kDataIndex + 6;
   // Tier-up ticks are set to the value of the tier-up ticks flag. The value is
   // decremented on each execution of the bytecode, so that the tier-up
-  // happens once the ticks reach zero.
+  // happens once the ticks reach zero. With --regexp-tier-up-subject-chars,
+  // the ticks count subject characters instead of executions.
   // This value is ignored if the regexp-tier-up flag isn't turned on.
   static const int kIrregexpTicksUntilTierUpIndex = kDataIndex + 7;
   // A smi containing either the backtracking limit or kNoBacktrackLimit.
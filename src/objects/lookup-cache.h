@@ -30,6 +30,17 @@ class DescriptorLookupCache {
 
   static const int kAbsent = -2;
 
+  static const int kLength = 64;
+  struct Key {
+    Map source;
+    Name name;
+  };
+
+  // Generated code probes the cache directly, see
+  // CodeStubAssembler::TryProbeDescriptorLookupCache().
+  Address keys_address() { return reinterpret_cast<Address>(keys_); }
+  Address results_address() { return reinterpret_cast<Address>(results_); }
+
  private:
   DescriptorLookupCache() {
     for (int i = 0; i < kLength; ++i) {
@@ -41,12 +52,6 @@ class DescriptorLookupCache {
 
   static inline int Hash(Map source, Name name);
 
-  static const int kLength = 64;
-  struct Key {
-    Map source;
-    Name name;
-  };
-
   Key keys_[kLength];
   int results_[kLength];
 
@@ -4,6 +4,7 @@
 
 #include "src/objects/map.h"
 
+#include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/frames.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
@@ -608,19 +609,38 @@ bool Map::HasOutOfObjectProperties() const {
 void Map::DeprecateTransitionTree(Isolate* isolate) {
   if (is_deprecated()) return;
   DisallowHeapAllocation no_gc;
-  TransitionsAccessor transitions(isolate, *this, &no_gc);
+  // Deoptimizing walks the optimized code of all contexts and the stacks of
+  // all threads, so do it once for the whole tree instead of once per map.
+  if (MarkTransitionTreeDeprecated(isolate, &no_gc)) {
+    DCHECK(AllowCodeDependencyChange::IsAllowed());
+    Deoptimizer::DeoptimizeMarkedCode(isolate);
+  }
+}
+
+bool Map::MarkTransitionTreeDeprecated(Isolate* isolate,
+                                       DisallowHeapAllocation* no_gc) {
+  if (is_deprecated()) return false;
+  bool marked = false;
+  TransitionsAccessor transitions(isolate, *this, no_gc);
   int num_transitions = transitions.NumberOfTransitions();
   for (int i = 0; i < num_transitions; ++i) {
-    transitions.GetTarget(i).DeprecateTransitionTree(isolate);
+    marked |=
+        transitions.GetTarget(i).MarkTransitionTreeDeprecated(isolate, no_gc);
   }
   DCHECK(!constructor_or_backpointer().IsFunctionTemplateInfo());
   set_is_deprecated(true);
   if (FLAG_trace_maps) {
     LOG(isolate, MapEvent("Deprecate", handle(*this, isolate), Handle<Map>()));
   }
-  dependent_code().DeoptimizeDependentCodeGroup(
+  marked |= dependent_code().MarkCodeForDeoptimization(
       DependentCode::kTransitionGroup);
-  NotifyLeafMapLayoutChange(isolate);
+  // Same as NotifyLeafMapLayoutChange, minus the deoptimization.
+  if (is_stable()) {
+    mark_unstable();
+    marked |= dependent_code().MarkCodeForDeoptimization(
+        DependentCode::kPrototypeCheckGroup);
+  }
+  return marked;
 }
 
 // Installs |new_descriptors| over the current instance_descriptors to ensure
@@ -800,21 +820,28 @@ void Map::GeneralizeField(Isolate* isolate, Handle<Map> map,
   field_owner->UpdateFieldType(isolate, modify_index, name, new_constness,
                                new_representation, wrapped_type);
 
+  // Mark the code of all affected groups first and deoptimize it in one go.
+  bool marked = false;
   if (new_constness != old_constness) {
-    field_owner->dependent_code().DeoptimizeDependentCodeGroup(
+    marked |= field_owner->dependent_code().MarkCodeForDeoptimization(
         DependentCode::kFieldConstGroup);
   }
 
   if (!new_field_type->Equals(*old_field_type)) {
-    field_owner->dependent_code().DeoptimizeDependentCodeGroup(
+    marked |= field_owner->dependent_code().MarkCodeForDeoptimization(
         DependentCode::kFieldTypeGroup);
   }
 
   if (!new_representation.Equals(old_representation)) {
-    field_owner->dependent_code().DeoptimizeDependentCodeGroup(
+    marked |= field_owner->dependent_code().MarkCodeForDeoptimization(
         DependentCode::kFieldRepresentationGroup);
   }
 
+  if (marked) {
+    DCHECK(AllowCodeDependencyChange::IsAllowed());
+    Deoptimizer::DeoptimizeMarkedCode(isolate);
+  }
+
   if (FLAG_trace_generalization) {
     map->PrintGeneralization(
         isolate, stdout, "field type generalization", modify_index,
@@ -1988,9 +2015,58 @@ Handle<Map> Map::Copy(Isolate* isolate, Handle<Map> map, const char* reason) {
       isolate, descriptors, number_of_own_descriptors);
   Handle<LayoutDescriptor> new_layout_descriptor(map->GetLayoutDescriptor(),
                                                  isolate);
-  return CopyReplaceDescriptors(
+  Handle<Map> new_map = CopyReplaceDescriptors(
       isolate, map, new_descriptors, new_layout_descriptor, OMIT_TRANSITION,
       MaybeHandle<Name>(), reason, SPECIAL_TRANSITION);
+  InheritEnumCache(isolate, map, new_map);
+  return new_map;
+}
+
+// static
+void Map::InheritEnumCache(Isolate* isolate, Handle<Map> map,
+                           Handle<Map> new_map) {
+  int enum_length = map->EnumLength();
+  if (enum_length == kInvalidEnumCacheSentinel || enum_length == 0) return;
+  DCHECK_EQ(map->NumberOfOwnDescriptors(), new_map->NumberOfOwnDescriptors());
+  DCHECK_EQ(enum_length, new_map->NumberOfEnumerableProperties());
+  EnumCache enum_cache = map->instance_descriptors().enum_cache();
+  // A longer cache also holds keys of descriptors that |map| shares with its
+  // transitions but that |new_map| doesn't have.
+  if (enum_cache.keys().length() != enum_length) return;
+  Handle<FixedArray> keys(enum_cache.keys(), isolate);
+  Handle<FixedArray> indices(enum_cache.indices(), isolate);
+
+  // The indices encode where a field lives and whether it holds a mutable
+  // double box, so they are only valid for |new_map| if it stores its fields
+  // the same way.
+  if (indices->length() > 0 &&
+      (!new_map->IsJSObjectMap() ||
+       map->GetInObjectProperties() != new_map->GetInObjectProperties())) {
+    indices = isolate->factory()->empty_fixed_array();
+  }
+  if (indices->length() > 0) {
+    DisallowHeapAllocation no_gc;
+    DescriptorArray descriptors = map->instance_descriptors();
+    DescriptorArray new_descriptors = new_map->instance_descriptors();
+    for (InternalIndex i : map->IterateOwnDescriptors()) {
+      PropertyDetails details = descriptors.GetDetails(i);
+      PropertyDetails new_details = new_descriptors.GetDetails(i);
+      DCHECK_EQ(descriptors.GetKey(i), new_descriptors.GetKey(i));
+      if (details.location() != new_details.location() ||
+          (details.location() == kField &&
+           (details.field_index() != new_details.field_index() ||
+            details.representation().IsDouble() !=
+                new_details.representation().IsDouble()))) {
+        indices = isolate->factory()->empty_fixed_array();
+        break;
+      }
+    }
+  }
+
+  Handle<DescriptorArray> new_descriptors(new_map->instance_descriptors(),
+                                          isolate);
+  DescriptorArray::InitializeOrChangeEnumCache(new_descriptors, isolate, keys,
+                                               indices);
 }
 
 Handle<Map> Map::Create(Isolate* isolate, int inobject_properties) {
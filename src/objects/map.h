@@ -769,6 +769,13 @@ class Map : public HeapObject {
   // instance descriptors.
   static Handle<Map> Copy(Isolate* isolate, Handle<Map> map,
                           const char* reason);
+  // Reuses the enum cache keys (and, if the field layouts agree, indices) of
+  // |map| for |new_map|, which must have the same own descriptor keys in the
+  // same order and with the same enumerability, e.g. a copy of |map| or a
+  // clone map of it. Does nothing unless |map| has a valid enum cache that
+  // does not extend past its own descriptors.
+  static void InheritEnumCache(Isolate* isolate, Handle<Map> map,
+                               Handle<Map> new_map);
   V8_EXPORT_PRIVATE static Handle<Map> Create(Isolate* isolate,
                                               int inobject_properties);
 
@@ -951,6 +958,11 @@ class Map : public HeapObject {
                                     PropertyNormalizationMode mode);
 
   void DeprecateTransitionTree(Isolate* isolate);
+  // Deprecates the maps of the transition tree without deoptimizing the code
+  // depending on them, which is only marked. Returns true if any code was
+  // marked for deoptimization.
+  bool MarkTransitionTreeDeprecated(Isolate* isolate,
+                                    DisallowHeapAllocation* no_gc);
 
   void ReplaceDescriptors(Isolate* isolate, DescriptorArray new_descriptors,
                           LayoutDescriptor new_layout_descriptor);
@@ -18,6 +18,7 @@
 #include "src/base/bits.h"
 #include "src/base/debug/stack_trace.h"
 #include "src/base/overflowing-math.h"
+#include "src/base/small-vector.h"
 #include "src/base/utils/random-number-generator.h"
 #include "src/builtins/accessors.h"
 #include "src/builtins/builtins.h"
@@ -5342,8 +5343,8 @@ Handle<Object> JSPromise::Reject(Handle<JSPromise> promise,
   if (isolate->debug()->is_active()) MoveMessageToPromise(isolate, promise);
 
   if (debug_event) isolate->debug()->OnPromiseReject(promise, reason);
-  isolate->RunPromiseHook(PromiseHookType::kResolve, promise,
-                          isolate->factory()->undefined_value());
+  isolate->RunAllPromiseHooks(PromiseHookType::kResolve, promise,
+                              isolate->factory()->undefined_value());
 
   // 1. Assert: The value of promise.[[PromiseState]] is "pending".
   CHECK_EQ(Promise::kPending, promise->status());
@@ -5376,8 +5377,8 @@ MaybeHandle<Object> JSPromise::Resolve(Handle<JSPromise> promise,
                                        Handle<Object> resolution) {
   Isolate* const isolate = promise->GetIsolate();
 
-  isolate->RunPromiseHook(PromiseHookType::kResolve, promise,
-                          isolate->factory()->undefined_value());
+  isolate->RunAllPromiseHooks(PromiseHookType::kResolve, promise,
+                              isolate->factory()->undefined_value());
 
   // 7. If SameValue(resolution, promise) is true, then
   if (promise.is_identical_to(resolution)) {
@@ -5937,13 +5938,36 @@ InternalIndex HashTable<Derived, Shape>::FindEntryOrInsertionEntry(
     if (Shape::IsMatch(key, element)) return entry;
   }
 }
-void StringTable::EnsureCapacityForDeserialization(Isolate* isolate,
-                                                   int expected) {
-  // TODO(crbug.com/v8/10729): Add concurrent string table support.
-  Handle<StringTable> table = isolate->factory()->string_table();
-  // We need a key instance for the virtual hash function.
-  table = EnsureCapacity(isolate, table, expected);
-  isolate->heap()->SetRootStringTable(*table);
+void StringTable::EnsureCapacityForBulkInsert(Isolate* isolate,
+                                              int expected) {
+  FullObjectSlot string_table_slot =
+      isolate->roots_table().slot(RootIndex::kStringTable);
+  while (true) {
+    Handle<StringTable> table =
+        handle(StringTable::cast(string_table_slot.Acquire_Load()), isolate);
+    if (table->HasSufficientCapacityToAdd(expected)) return;
+
+    // As in LookupKey, allocate outside of the lock and only copy the contents
+    // once the lock is held.
+    int new_capacity = ComputeCapacity(table->NumberOfElements() + expected);
+    bool pretenure = (new_capacity > kMinCapacityForPretenure) &&
+                     !Heap::InYoungGeneration(*table);
+    Handle<StringTable> new_table = HashTable::New(
+        isolate, new_capacity,
+        pretenure ? AllocationType::kOld : AllocationType::kYoung,
+        USE_CUSTOM_MINIMUM_CAPACITY);
+
+    base::MutexGuard table_write_guard(isolate->string_table_mutex());
+    // Someone else resized the table in the meantime, start over.
+    if (*isolate->factory()->string_table() != *table) continue;
+    if (!HasSufficientCapacityToAdd(new_table->Capacity(), 0, 0,
+                                    table->NumberOfElements() + expected)) {
+      continue;
+    }
+    table->Rehash(isolate, *new_table);
+    string_table_slot.Release_Store(*new_table);
+    return;
+  }
 }
 
 // static
@@ -6187,14 +6211,16 @@ Address LookupString(Isolate* isolate, String string, String source,
 
   int length = string.length();
 
-  std::unique_ptr<Char[]> buffer;
+  // Property keys are usually short, so flatten them into an inline buffer
+  // instead of allocating one on every lookup.
+  base::SmallVector<Char, 64> buffer;
   const Char* chars;
 
   if (source.IsConsString()) {
     DCHECK(!source.IsFlat());
-    buffer.reset(new Char[length]);
-    String::WriteToFlat(source, buffer.get(), 0, length);
-    chars = buffer.get();
+    buffer.resize_no_init(length);
+    String::WriteToFlat(source, buffer.data(), 0, length);
+    chars = buffer.data();
   } else {
     chars = source.GetChars<Char>(no_gc) + start;
   }
@@ -6417,7 +6443,7 @@ FeedbackCell SearchLiteralsMap(CompilationCacheTable cache, int cache_entry,
 
 MaybeHandle<SharedFunctionInfo> CompilationCacheTable::LookupScript(
     Handle<CompilationCacheTable> table, Handle<String> src,
-    Handle<Context> native_context, LanguageMode language_mode) {
+    Handle<Context> native_context, LanguageMode language_mode, int last_use) {
   // We use the empty function SFI as part of the key. Although the
   // empty_function is native context dependent, the SFI is de-duped on
   // snapshot builds by the StartupObjectCache, and so this does not prevent
@@ -6435,6 +6461,7 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheTable::LookupScript(
   }
   Object obj = table->get(index + 1);
   if (obj.IsSharedFunctionInfo()) {
+    table->set(index + kEntryLastUseIndex, Smi::FromInt(last_use));
     return handle(SharedFunctionInfo::cast(obj), native_context->GetIsolate());
   }
   return MaybeHandle<SharedFunctionInfo>();
@@ -6443,7 +6470,7 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheTable::LookupScript(
 InfoCellPair CompilationCacheTable::LookupEval(
     Handle<CompilationCacheTable> table, Handle<String> src,
     Handle<SharedFunctionInfo> outer_info, Handle<Context> native_context,
-    LanguageMode language_mode, int position) {
+    LanguageMode language_mode, int position, int last_use) {
   InfoCellPair empty_result;
   Isolate* isolate = native_context->GetIsolate();
   src = String::Flatten(isolate, src);
@@ -6456,6 +6483,7 @@ InfoCellPair CompilationCacheTable::LookupEval(
   if (obj.IsSharedFunctionInfo()) {
     FeedbackCell feedback_cell =
         SearchLiteralsMap(*table, index + 2, *native_context);
+    table->set(index + kEntryLastUseIndex, Smi::FromInt(last_use));
     return InfoCellPair(isolate, SharedFunctionInfo::cast(obj), feedback_cell);
   }
   return empty_result;
@@ -6484,7 +6512,7 @@ MaybeHandle<Code> CompilationCacheTable::LookupCode(
 Handle<CompilationCacheTable> CompilationCacheTable::PutScript(
     Handle<CompilationCacheTable> cache, Handle<String> src,
     Handle<Context> native_context, LanguageMode language_mode,
-    Handle<SharedFunctionInfo> value) {
+    Handle<SharedFunctionInfo> value, int last_use) {
   Isolate* isolate = native_context->GetIsolate();
   // We use the empty function SFI as part of the key. Although the
   // empty_function is native context dependent, the SFI is de-duped on
@@ -6499,6 +6527,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutScript(
   InternalIndex entry = cache->FindInsertionEntry(isolate, key.Hash());
   cache->set(EntryToIndex(entry), *k);
   cache->set(EntryToIndex(entry) + 1, *value);
+  cache->set(EntryToIndex(entry) + kEntryLastUseIndex, Smi::FromInt(last_use));
   cache->ElementAdded();
   return cache;
 }
@@ -6507,7 +6536,7 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
     Handle<CompilationCacheTable> cache, Handle<String> src,
     Handle<SharedFunctionInfo> outer_info, Handle<SharedFunctionInfo> value,
     Handle<Context> native_context, Handle<FeedbackCell> feedback_cell,
-    int position) {
+    int position, int last_use) {
   Isolate* isolate = native_context->GetIsolate();
   src = String::Flatten(isolate, src);
   StringSharedKey key(src, outer_info, value->language_mode(), position);
@@ -6522,6 +6551,8 @@ Handle<CompilationCacheTable> CompilationCacheTable::PutEval(
       // and entry remains correct.
       AddToFeedbackCellsMap(cache, EntryToIndex(entry) + 2, native_context,
                             feedback_cell);
+      cache->set(EntryToIndex(entry) + kEntryLastUseIndex,
+                 Smi::FromInt(last_use));
       // Add hash again even on cache hit to avoid unnecessary cache delay in
       // case of hash collisions.
     }
@@ -6592,6 +6623,57 @@ void CompilationCacheTable::Age() {
   }
 }
 
+namespace {
+
+// The number of source bytes a script or eval entry keeps alive, or 0 if the
+// entry at {entry_index} is neither.
+size_t EntrySourceSize(CompilationCacheTable table, int entry_index) {
+  Object key = table.get(entry_index);
+  if (!key.IsFixedArray() ||
+      !table.get(entry_index + CompilationCacheTable::kEntryLastUseIndex)
+           .IsSmi()) {
+    return 0;
+  }
+  String source = String::cast(FixedArray::cast(key).get(1));
+  return static_cast<size_t>(source.length()) *
+         (source.IsOneByteRepresentation() ? kCharSize : kUC16Size);
+}
+
+}  // namespace
+
+size_t CompilationCacheTable::SourceSize() {
+  DisallowHeapAllocation no_allocation;
+  size_t size = 0;
+  for (InternalIndex entry : IterateEntries()) {
+    size += EntrySourceSize(*this, EntryToIndex(entry));
+  }
+  return size;
+}
+
+size_t CompilationCacheTable::RemoveLeastRecentlyUsed() {
+  DisallowHeapAllocation no_allocation;
+  int lru_index = -1;
+  int lru_last_use = 0;
+  for (InternalIndex entry : IterateEntries()) {
+    int entry_index = EntryToIndex(entry);
+    if (EntrySourceSize(*this, entry_index) == 0) continue;
+    int last_use = Smi::ToInt(get(entry_index + kEntryLastUseIndex));
+    if (lru_index == -1 || last_use < lru_last_use) {
+      lru_index = entry_index;
+      lru_last_use = last_use;
+    }
+  }
+  if (lru_index == -1) return 0;
+
+  size_t size = EntrySourceSize(*this, lru_index);
+  Object the_hole_value = GetReadOnlyRoots().the_hole_value();
+  for (int i = 0; i < kEntrySize; i++) {
+    NoWriteBarrierSet(*this, lru_index + i, the_hole_value);
+  }
+  ElementRemoved();
+  return size;
+}
+
 void CompilationCacheTable::Remove(Object value) {
   DisallowHeapAllocation no_allocation;
   Object the_hole_value = GetReadOnlyRoots().the_hole_value();
@@ -6660,7 +6742,16 @@ Handle<Derived> Dictionary<Derived, Shape>::DeleteEntry(
          dictionary->DetailsAt(entry).IsConfigurable());
   dictionary->ClearEntry(entry);
   dictionary->ElementRemoved();
-  return Shrink(isolate, dictionary);
+  Handle<Derived> result = Shrink(isolate, dictionary);
+  // Deleted entries don't terminate probe sequences, so lookups that miss get
+  // slower as they accumulate. If the table wasn't reallocated, wipe them by
+  // rehashing in place once they take up a quarter of the capacity; this
+  // needs at least that many deletions in between, so the cost is amortized.
+  if (result.is_identical_to(dictionary) &&
+      dictionary->NumberOfDeletedElements() >= dictionary->Capacity() / 4) {
+    dictionary->Rehash(isolate);
+  }
+  return result;
 }
 
 template <typename Derived, typename Shape>
@@ -2,7 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "src/execution/isolate-inl.h"
+#include "src/interpreter/bytecode-array-accessor.h"
 #include "src/objects/code.h"
 #include "src/objects/maybe-object.h"
 #include "src/objects/shared-function-info.h"
@@ -27,9 +30,12 @@ void OSROptimizedCodeCache::AddOptimizedCode(
   Handle<OSROptimizedCodeCache> osr_cache(
       native_context->GetOSROptimizedCodeCache(), isolate);
 
-  DCHECK_EQ(osr_cache->FindEntry(shared, osr_offset), -1);
-  int entry = -1;
-  for (int index = 0; index < osr_cache->length(); index += kEntryLength) {
+  // Concurrent jobs for closures with different feedback vectors may race to
+  // compile the same loop, in which case the last one wins.
+  int entry = osr_cache->FindEntry(shared, osr_offset);
+  DCHECK_IMPLIES(!FLAG_concurrent_osr, entry == -1);
+  for (int index = 0; entry == -1 && index < osr_cache->length();
+       index += kEntryLength) {
     if (osr_cache->Get(index + kSharedOffset)->IsCleared() ||
         osr_cache->Get(index + kCachedCodeOffset)->IsCleared()) {
       entry = index;
@@ -50,6 +56,21 @@ void OSROptimizedCodeCache::AddOptimizedCode(
   osr_cache->InitializeEntry(entry, *shared, *code, osr_offset);
 }
 
+void OSROptimizedCodeCache::ArmBackEdges(Isolate* isolate,
+                                         Handle<SharedFunctionInfo> shared,
+                                         BailoutId osr_offset) {
+  if (!shared->HasBytecodeArray()) return;
+  Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(), isolate);
+  interpreter::BytecodeArrayAccessor accessor(bytecode, osr_offset.ToInt());
+  if (accessor.current_bytecode() != interpreter::Bytecode::kJumpLoop) return;
+  // Back edges at loop depths below the OSR nesting level are armed.
+  int level = std::min(accessor.GetImmediateOperand(1) + 1,
+                       static_cast<int>(AbstractCode::kMaxLoopNestingMarker));
+  if (bytecode->osr_loop_nesting_level() < level) {
+    bytecode->set_osr_loop_nesting_level(level);
+  }
+}
+
 void OSROptimizedCodeCache::Clear(NativeContext native_context) {
   native_context.set_osr_code_cache(
       *native_context.GetIsolate()->factory()->empty_weak_fixed_array());
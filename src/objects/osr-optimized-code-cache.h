@@ -33,6 +33,11 @@ class V8_EXPORT OSROptimizedCodeCache : public WeakFixedArray {
   static void AddOptimizedCode(Handle<NativeContext> context,
                                Handle<SharedFunctionInfo> shared,
                                Handle<Code> code, BailoutId osr_offset);
+  // Arms the back edges of |shared| up to the loop at |osr_offset|, so that
+  // interpreted frames of all its closures request on-stack replacement at
+  // their next iteration of the loop and pick up the cached code.
+  static void ArmBackEdges(Isolate* isolate, Handle<SharedFunctionInfo> shared,
+                           BailoutId osr_offset);
   // Reduces the size of the OSR code cache if the number of valid entries are
   // less than the current capacity of the cache.
   static void Compact(Handle<NativeContext> context);
@@ -189,6 +189,9 @@ BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2,
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, may_have_cached_code,
                     SharedFunctionInfo::MayHaveCachedCodeBit)
 
+BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags2, optimize_from_code_cache,
+                    SharedFunctionInfo::OptimizeFromCodeCacheBit)
+
 BIT_FIELD_ACCESSORS(SharedFunctionInfo, flags, syntax_kind,
                     SharedFunctionInfo::FunctionSyntaxKindBits)
 
@@ -508,6 +511,7 @@ bool SharedFunctionInfo::ShouldFlushBytecode(BytecodeFlushMode mode) {
 
   BytecodeArray bytecode = BytecodeArray::cast(data);
 
+  if (mode == BytecodeFlushMode::kFlushColdBytecode) return bytecode.IsCold();
   return bytecode.IsOld();
 }
 
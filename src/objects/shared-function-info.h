@@ -416,6 +416,11 @@ class SharedFunctionInfo : public HeapObject {
   // hence the 'may'.
   DECL_BOOLEAN_ACCESSORS(may_have_cached_code)
 
+  // True if this SFI was deserialized from a code cache that was produced
+  // after native context independent code had been generated for it. The
+  // first closure created for it is marked for optimization right away.
+  DECL_BOOLEAN_ACCESSORS(optimize_from_code_cache)
+
   // Returns the cached Code object for this SFI if it exists, an empty handle
   // otherwise.
   MaybeHandle<Code> TryGetCachedCode(Isolate* isolate);
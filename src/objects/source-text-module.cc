@@ -469,6 +469,16 @@ bool SourceTextModule::FinishInstantiate(
     Handle<SourceTextModuleInfoEntry> entry(
         SourceTextModuleInfoEntry::cast(regular_imports->get(i)), isolate);
     Handle<String> name(String::cast(entry->import_name()), isolate);
+    // Imports of local or already resolved exports are found directly in the
+    // export table of the requested module, without setting up a ResolveSet.
+    Module requested_module =
+        Module::cast(requested_modules->get(entry->module_request()));
+    Object resolved = requested_module.exports().Lookup(name);
+    if (resolved.IsCell()) {
+      module->regular_imports().set(ImportIndex(entry->cell_index()),
+                                    resolved);
+      continue;
+    }
     MessageLocation loc(script, entry->beg_pos(), entry->end_pos());
     ResolveSet resolve_set(zone);
     Handle<Cell> cell;
@@ -92,14 +92,6 @@ class StackTraceFrame
   TQ_OBJECT_CONSTRUCTORS(StackTraceFrame)
 };
 
-// Small helper that retrieves the FrameArray from a stack-trace
-// consisting of a FixedArray of StackTraceFrame objects.
-// This helper is only temporary until all FrameArray use-sites have
-// been converted to use StackTraceFrame and StackFrameInfo objects.
-V8_EXPORT_PRIVATE
-Handle<FrameArray> GetFrameArrayFromStackTrace(Isolate* isolate,
-                                               Handle<FixedArray> stack_trace);
-
 class IncrementalStringBuilder;
 void SerializeStackTraceFrame(Isolate* isolate, Handle<StackTraceFrame> frame,
                               IncrementalStringBuilder* builder);
@@ -13,12 +13,13 @@
 namespace v8 {
 namespace internal {
 
-// Compares the contents of two strings by reading and comparing
-// int-sized blocks of characters.
+// Compares the contents of two strings of the same character width for
+// equality. Byte order doesn't matter for that, so memcmp, which is
+// vectorized by the C library, works for two-byte strings as well.
 template <typename Char>
 static inline bool CompareRawStringContents(const Char* const a,
                                             const Char* const b, int length) {
-  return CompareChars(a, b, length) == 0;
+  return memcmp(a, b, length * sizeof(Char)) == 0;
 }
 
 template <typename Chars1, typename Chars2>
@@ -86,7 +86,10 @@ class V8_EXPORT_PRIVATE StringTable
   static Address LookupStringIfExists_NoAllocate(Isolate* isolate,
                                                  Address raw_string);
 
-  static void EnsureCapacityForDeserialization(Isolate* isolate, int expected);
+  // Grows the isolate's string table so that |expected| more strings can be
+  // added without a resize. Follows the same protocol as LookupKey, so it is
+  // safe against concurrent lookups and insertions.
+  static void EnsureCapacityForBulkInsert(Isolate* isolate, int expected);
 
   DECL_CAST(StringTable)
 
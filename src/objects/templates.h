@@ -18,7 +18,12 @@ class TemplateInfo : public TorqueGeneratedTemplateInfo<TemplateInfo, Struct> {
  public:
   NEVER_READ_ONLY_SPACE
 
+  // Initial and maximum length of the per-context array that caches
+  // instantiations by serial number. The array grows on demand and costs one
+  // word per template, far less than the templates themselves, so it can
+  // cover embedders with thousands of templates.
   static const int kFastTemplateInstantiationsCacheSize = 1 * KB;
+  static const int kMaxFastTemplateInstantiationsCacheSize = 16 * KB;
 
   // While we could grow the slow cache until we run out of memory, we put
   // a limit on it anyway to not crash for embedders that re-create templates
@@ -262,23 +262,39 @@ void ValueSerializer::WriteTag(SerializationTag tag) {
   WriteRawBytes(&raw_tag, sizeof(raw_tag));
 }
 
+namespace {
+
+// Maximum number of bytes of a varint of type T.
 template <typename T>
-void ValueSerializer::WriteVarint(T value) {
-  // Writes an unsigned integer as a base-128 varint.
-  // The number is written, 7 bits at a time, from the least significant to the
-  // most significant 7 bits. Each byte, except the last, has the MSB set.
-  // See also https://developers.google.com/protocol-buffers/docs/encoding
+constexpr size_t MaxVarintSize() {
+  return sizeof(T) * 8 / 7 + 1;
+}
+
+// Writes an unsigned integer as a base-128 varint to |dest|, which must have
+// room for MaxVarintSize<T>() bytes, and returns the position after it.
+// The number is written, 7 bits at a time, from the least significant to the
+// most significant 7 bits. Each byte, except the last, has the MSB set.
+// See also https://developers.google.com/protocol-buffers/docs/encoding
+template <typename T>
+uint8_t* EncodeVarint(T value, uint8_t* dest) {
   static_assert(std::is_integral<T>::value && std::is_unsigned<T>::value,
                 "Only unsigned integer types can be written as varints.");
-  uint8_t stack_buffer[sizeof(T) * 8 / 7 + 1];
-  uint8_t* next_byte = &stack_buffer[0];
   do {
-    *next_byte = (value & 0x7F) | 0x80;
-    next_byte++;
+    *dest = (value & 0x7F) | 0x80;
+    dest++;
     value >>= 7;
   } while (value);
-  *(next_byte - 1) &= 0x7F;
-  WriteRawBytes(stack_buffer, next_byte - stack_buffer);
+  *(dest - 1) &= 0x7F;
+  return dest;
+}
+
+}  // namespace
+
+template <typename T>
+void ValueSerializer::WriteVarint(T value) {
+  uint8_t stack_buffer[MaxVarintSize<T>()];
+  uint8_t* end = EncodeVarint(value, stack_buffer);
+  WriteRawBytes(stack_buffer, end - stack_buffer);
 }
 
 template <typename T>
@@ -657,23 +673,44 @@ Maybe<bool> ValueSerializer::WriteJSArray(Handle<JSArray> array) {
     uint32_t i = 0;
 
     // Fast paths. Note that PACKED_ELEMENTS in particular can bail due to the
-    // structure of the elements changing.
+    // structure of the elements changing. Numbers are encoded as WriteSmi
+    // and WriteHeapNumber would, but into buffer space reserved for all
+    // elements at once.
     switch (array->GetElementsKind()) {
       case PACKED_SMI_ELEMENTS: {
-        Handle<FixedArray> elements(FixedArray::cast(array->elements()),
-                                    isolate_);
-        for (; i < length; i++) WriteSmi(Smi::cast(elements->get(i)));
+        // Reserve the worst case, and give back what isn't used.
+        static_assert(kSmiValueSize <= 32, "Expected SMI <= 32 bits.");
+        const size_t max_size = length * (1 + MaxVarintSize<uint32_t>());
+        uint8_t* start;
+        if (!ReserveRawBytes(max_size).To(&start)) return ThrowIfOutOfMemory();
+        uint8_t* dest = start;
+        FixedArray elements = FixedArray::cast(array->elements());
+        for (; i < length; i++) {
+          *dest++ = static_cast<uint8_t>(SerializationTag::kInt32);
+          int32_t value = Smi::ToInt(elements.get(i));
+          // ZigZag encoding, see WriteZigZag.
+          dest = EncodeVarint<uint32_t>((static_cast<uint32_t>(value) << 1) ^
+                                            (value >> 31),
+                                        dest);
+        }
+        buffer_size_ -= max_size - static_cast<size_t>(dest - start);
         break;
       }
       case PACKED_DOUBLE_ELEMENTS: {
         // Elements are empty_fixed_array, not a FixedDoubleArray, if the array
         // is empty. No elements to encode in this case anyhow.
         if (length == 0) break;
-        Handle<FixedDoubleArray> elements(
-            FixedDoubleArray::cast(array->elements()), isolate_);
+        uint8_t* dest;
+        if (!ReserveRawBytes(length * (1 + sizeof(double))).To(&dest)) {
+          return ThrowIfOutOfMemory();
+        }
+        FixedDoubleArray elements = FixedDoubleArray::cast(array->elements());
         for (; i < length; i++) {
-          WriteTag(SerializationTag::kDouble);
-          WriteDouble(elements->get_scalar(i));
+          *dest++ = static_cast<uint8_t>(SerializationTag::kDouble);
+          // Warning: this uses host endianness, like WriteDouble.
+          double value = elements.get_scalar(i);
+          memcpy(dest, &value, sizeof(value));
+          dest += sizeof(value);
         }
         break;
       }
@@ -1526,32 +1563,39 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
 
   uint32_t id = next_id_++;
   HandleScope scope(isolate_);
-  Handle<JSArray> array = isolate_->factory()->NewJSArray(
-      HOLEY_ELEMENTS, length, length, INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE);
-  AddObjectWithID(id, array);
+  Handle<JSArray> array;
+  // Numbers can't refer to the array, so it can be created after reading
+  // elements that are all numbers.
+  if (TryReadPackedNumberArray(length).ToHandle(&array)) {
+    AddObjectWithID(id, array);
+  } else {
+    array = isolate_->factory()->NewJSArray(
+        HOLEY_ELEMENTS, length, length, INITIALIZE_ARRAY_ELEMENTS_WITH_HOLE);
+    AddObjectWithID(id, array);
 
-  Handle<FixedArray> elements(FixedArray::cast(array->elements()), isolate_);
-  for (uint32_t i = 0; i < length; i++) {
-    SerializationTag tag;
-    if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
-      ConsumeTag(SerializationTag::kTheHole);
-      continue;
-    }
+    Handle<FixedArray> elements(FixedArray::cast(array->elements()), isolate_);
+    for (uint32_t i = 0; i < length; i++) {
+      SerializationTag tag;
+      if (PeekTag().To(&tag) && tag == SerializationTag::kTheHole) {
+        ConsumeTag(SerializationTag::kTheHole);
+        continue;
+      }
 
-    Handle<Object> element;
-    if (!ReadObject().ToHandle(&element)) return MaybeHandle<JSArray>();
+      Handle<Object> element;
+      if (!ReadObject().ToHandle(&element)) return MaybeHandle<JSArray>();
 
-    // Serialization versions less than 11 encode the hole the same as
-    // undefined. For consistency with previous behavior, store these as the
-    // hole. Past version 11, undefined means undefined.
-    if (version_ < 11 && element->IsUndefined(isolate_)) continue;
+      // Serialization versions less than 11 encode the hole the same as
+      // undefined. For consistency with previous behavior, store these as the
+      // hole. Past version 11, undefined means undefined.
+      if (version_ < 11 && element->IsUndefined(isolate_)) continue;
 
-    // Safety check.
-    if (i >= static_cast<uint32_t>(elements->length())) {
-      return MaybeHandle<JSArray>();
-    }
+      // Safety check.
+      if (i >= static_cast<uint32_t>(elements->length())) {
+        return MaybeHandle<JSArray>();
+      }
 
-    elements->set(i, *element);
+      elements->set(i, *element);
+    }
   }
 
   uint32_t num_properties;
@@ -1569,6 +1613,54 @@ MaybeHandle<JSArray> ValueDeserializer::ReadDenseJSArray() {
   return scope.CloseAndEscape(array);
 }
 
+MaybeHandle<JSArray> ValueDeserializer::TryReadPackedNumberArray(
+    uint32_t length) {
+  SerializationTag tag;
+  if (length == 0 ||
+      length > static_cast<uint32_t>(FixedDoubleArray::kMaxLength) ||
+      !PeekTag().To(&tag) ||
+      (tag != SerializationTag::kInt32 && tag != SerializationTag::kDouble)) {
+    return MaybeHandle<JSArray>();
+  }
+
+  const uint8_t* start = position_;
+  Factory* factory = isolate_->factory();
+  Handle<FixedDoubleArray> doubles =
+      Handle<FixedDoubleArray>::cast(factory->NewFixedDoubleArray(length));
+  bool all_smis = true;
+  for (uint32_t i = 0; i < length; i++) {
+    double value;
+    bool ok = ReadTag().To(&tag);
+    if (ok && tag == SerializationTag::kInt32) {
+      int32_t number;
+      ok = ReadZigZag<int32_t>().To(&number);
+      all_smis &= Smi::IsValid(number);
+      value = number;
+    } else if (ok && tag == SerializationTag::kDouble) {
+      ok = ReadDouble().To(&value);
+      all_smis = false;
+    } else {
+      ok = false;
+    }
+    if (!ok) {
+      // Leave any other elements, and malformed data, to the generic path.
+      position_ = start;
+      return MaybeHandle<JSArray>();
+    }
+    doubles->set(i, value);
+  }
+
+  if (!all_smis) {
+    return factory->NewJSArrayWithElements(doubles, PACKED_DOUBLE_ELEMENTS,
+                                           length);
+  }
+  Handle<FixedArray> smis = factory->NewFixedArray(length);
+  for (uint32_t i = 0; i < length; i++) {
+    smis->set(i, Smi::FromInt(static_cast<int>(doubles->get_scalar(i))));
+  }
+  return factory->NewJSArrayWithElements(smis, PACKED_SMI_ELEMENTS, length);
+}
+
 MaybeHandle<JSDate> ValueDeserializer::ReadJSDate() {
   double value;
   if (!ReadDouble().To(&value)) return MaybeHandle<JSDate>();
@@ -259,6 +259,11 @@ class ValueDeserializer {
   MaybeHandle<JSObject> ReadJSObject() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadSparseJSArray() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArray> ReadDenseJSArray() V8_WARN_UNUSED_RESULT;
+  // Reads |length| elements of a dense array if they are all numbers, and
+  // returns a packed SMI or double array. Otherwise, consumes nothing and
+  // returns an empty handle.
+  MaybeHandle<JSArray> TryReadPackedNumberArray(uint32_t length)
+      V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSDate> ReadJSDate() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSPrimitiveWrapper> ReadJSPrimitiveWrapper(SerializationTag tag)
       V8_WARN_UNUSED_RESULT;
@@ -3021,6 +3021,8 @@ Expression* Parser::RewriteClassLiteral(ClassScope* block_scope,
 
   if (class_info->requires_brand) {
     class_info->constructor->set_class_scope_has_private_brand(true);
+    // The brand is stored as a property of the instance.
+    class_info->constructor->add_expected_properties(1);
   }
   if (class_info->has_static_private_methods) {
     class_info->constructor->set_has_static_private_methods_or_accessors(true);
@@ -152,40 +152,40 @@ class ChunkedStream {
   explicit ChunkedStream(ScriptCompiler::ExternalSourceStream* source)
       : source_(source) {}
 
-  ChunkedStream(const ChunkedStream&) V8_NOEXCEPT {
-    // TODO(rmcilroy): Implement cloning for chunked streams.
-    UNREACHABLE();
-  }
+  // A clone shares the chunks that have arrived so far, but never pulls more
+  // data from the source stream. Clones are made for functions that the
+  // original stream has already scanned past, so that is all they need.
+  ChunkedStream(const ChunkedStream& other) V8_NOEXCEPT
+      : source_(nullptr), chunks_(other.chunks_) {}
 
   // The no_gc argument is only here because of the templated way this class
   // is used along with other implementations that require V8 heap access.
   Range<Char> GetDataAt(size_t pos, RuntimeCallStats* stats,
                         DisallowHeapAllocation* no_gc = nullptr) {
-    Chunk chunk = FindChunk(pos, stats);
+    const Chunk& chunk = FindChunk(pos, stats);
     size_t buffer_end = chunk.length;
     size_t buffer_pos = Min(buffer_end, pos - chunk.position);
-    return {&chunk.data[buffer_pos], &chunk.data[buffer_end]};
-  }
-
-  ~ChunkedStream() {
-    for (Chunk& chunk : chunks_) delete[] chunk.data;
+    return {chunk.data.get() + buffer_pos, chunk.data.get() + buffer_end};
   }
 
-  static const bool kCanBeCloned = false;
+  static const bool kCanBeCloned = true;
   static const bool kCanAccessHeap = false;
 
  private:
   struct Chunk {
     Chunk(const Char* const data, size_t position, size_t length)
-        : data(data), position(position), length(length) {}
-    const Char* const data;
+        : data(data, std::default_delete<const Char[]>()),
+          position(position),
+          length(length) {}
+    // Owned jointly by the stream and its clones.
+    const std::shared_ptr<const Char> data;
     // The logical position of data.
     const size_t position;
     const size_t length;
     size_t end_position() const { return position + length; }
   };
 
-  Chunk FindChunk(size_t position, RuntimeCallStats* stats) {
+  const Chunk& FindChunk(size_t position, RuntimeCallStats* stats) {
     while (V8_UNLIKELY(chunks_.empty())) FetchChunk(size_t{0}, stats);
 
     // Walk forwards while the position is in front of the current chunk.
@@ -213,8 +213,9 @@ class ChunkedStream {
 
   void FetchChunk(size_t position, RuntimeCallStats* stats) {
     const uint8_t* data = nullptr;
-    size_t length;
-    {
+    size_t length = 0;
+    // Clones have no source; running out of chunks is the end of the stream.
+    if (source_ != nullptr) {
       RuntimeCallTimerScope scope(stats,
                                   RuntimeCallCounterId::kGetMoreDataCallback);
       length = source_->GetMoreData(&data);
@@ -520,10 +521,18 @@ bool Utf8ExternalStreamingStream::SkipToPosition(size_t position) {
   while (cursor < end && chars < position) {
     unibrow::uchar t =
         unibrow::Utf8::ValueOfIncremental(&cursor, &state, &incomplete_char);
-    if (t != unibrow::Utf8::kIncomplete) {
-      chars++;
-      if (t > unibrow::Utf16::kMaxNonSurrogateCharCode) chars++;
-    }
+    if (t == unibrow::Utf8::kIncomplete) continue;
+    chars++;
+    if (t > unibrow::Utf16::kMaxNonSurrogateCharCode) chars++;
+
+    // Fast path for ascii sequences, which have one char per byte.
+    if (chars >= position) break;
+    DCHECK_EQ(state, unibrow::Utf8::State::kAccept);
+    int max_length = static_cast<int>(
+        Min(static_cast<size_t>(end - cursor), position - chars));
+    int ascii_length = NonAsciiStart(cursor, max_length);
+    cursor += ascii_length;
+    chars += ascii_length;
   }
 
   current_.pos.bytes = chunk.start.bytes + (cursor - chunk.data);
@@ -5,6 +5,7 @@
 #ifndef V8_PARSING_SCANNER_INL_H_
 #define V8_PARSING_SCANNER_INL_H_
 
+#include "src/base/memory.h"
 #include "src/parsing/keywords-gen.h"
 #include "src/parsing/scanner.h"
 #include "src/strings/char-predicates-inl.h"
@@ -251,6 +252,36 @@ static constexpr const uint8_t character_scan_flags[128] = {
 #undef CALL_GET_SCAN_FLAGS
 };
 
+// Helpers for checking a machine word of UTF-16 code units at once, see
+// Utf16CharacterStream::AdvanceUntil. They may report code units that are not
+// there, but never miss one that is.
+constexpr uintptr_t kOneInEveryCodeUnit = kUintptrAllBitsSet / 0xFFFF;
+constexpr uintptr_t kHighBitInEveryCodeUnit = kOneInEveryCodeUnit * 0x8000;
+
+inline uintptr_t ReadCodeUnitWord(const uint16_t* chars) {
+  return base::ReadUnalignedValue<uintptr_t>(reinterpret_cast<Address>(chars));
+}
+// Returns true if a code unit in |word| is outside the one-byte range.
+inline bool WordHasNonOneByteChar(uintptr_t word) {
+  return word & (kOneInEveryCodeUnit * 0xFF00);
+}
+// Returns true if a code unit in |word| is less than |limit|. Requires all
+// code units of |word| to be one-byte.
+inline bool WordHasCharLessThan(uintptr_t word, uint8_t limit) {
+  return (word - kOneInEveryCodeUnit * limit) & kHighBitInEveryCodeUnit;
+}
+// Returns true if a code unit in |word| is |c|.
+inline bool WordHasChar(uintptr_t word, uint8_t c) {
+  uintptr_t diff = word ^ (kOneInEveryCodeUnit * c);
+  return (diff - kOneInEveryCodeUnit) & ~diff & kHighBitInEveryCodeUnit;
+}
+// Returns true if |word| may contain a line terminator. All ASCII line
+// terminators are less than or equal to '\r'.
+inline bool WordMayHaveLineTerminator(uintptr_t word) {
+  STATIC_ASSERT('\n' < '\r');
+  return WordHasNonOneByteChar(word) || WordHasCharLessThan(word, '\r' + 1);
+}
+
 inline bool CharCanBeKeyword(uc32 c) {
   return static_cast<uint32_t>(c) < arraysize(character_scan_flags) &&
          CanBeKeyword(character_scan_flags[c]);
@@ -208,7 +208,11 @@ Token::Value Scanner::SkipSingleLineComment() {
   // separately by the lexical grammar and becomes part of the
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
-  AdvanceUntil([](uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
+  AdvanceUntil(
+      [](const uint16_t* chars) {
+        return WordMayHaveLineTerminator(ReadCodeUnitWord(chars));
+      },
+      [](uc32 c0_) { return unibrow::IsLineTerminator(c0_); });
 
   return Token::WHITESPACE;
 }
@@ -280,13 +284,18 @@ Token::Value Scanner::SkipMultiLineComment() {
   // Until we see the first newline, check for * and newline characters.
   if (!next().after_line_terminator) {
     do {
-      AdvanceUntil([](uc32 c0) {
-        if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-          return unibrow::IsLineTerminator(c0);
-        }
-        uint8_t char_flags = character_scan_flags[c0];
-        return MultilineCommentCharacterNeedsSlowPath(char_flags);
-      });
+      AdvanceUntil(
+          [](const uint16_t* chars) {
+            uintptr_t word = ReadCodeUnitWord(chars);
+            return WordMayHaveLineTerminator(word) || WordHasChar(word, '*');
+          },
+          [](uc32 c0) {
+            if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+              return unibrow::IsLineTerminator(c0);
+            }
+            uint8_t char_flags = character_scan_flags[c0];
+            return MultilineCommentCharacterNeedsSlowPath(char_flags);
+          });
 
       while (c0_ == '*') {
         Advance();
@@ -305,7 +314,11 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   // After we've seen newline, simply try to find '*/'.
   while (c0_ != kEndOfInput) {
-    AdvanceUntil([](uc32 c0) { return c0 == '*'; });
+    AdvanceUntil(
+        [](const uint16_t* chars) {
+          return WordHasChar(ReadCodeUnitWord(chars), '*');
+        },
+        [](uc32 c0) { return c0 == '*'; });
 
     while (c0_ == '*') {
       Advance();
@@ -459,19 +472,31 @@ Token::Value Scanner::ScanString() {
 
   next().literal_chars.Start();
   while (true) {
-    AdvanceUntil([this](uc32 c0) {
-      if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
-        if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
-          return true;
-        }
-        AddLiteralChar(c0);
-        return false;
-      }
-      uint8_t char_flags = character_scan_flags[c0];
-      if (MayTerminateString(char_flags)) return true;
-      AddLiteralChar(c0);
-      return false;
-    });
+    AdvanceUntil(
+        [this](const uint16_t* chars) {
+          uintptr_t word = ReadCodeUnitWord(chars);
+          if (WordMayHaveLineTerminator(word) || WordHasChar(word, '\'') ||
+              WordHasChar(word, '"') || WordHasChar(word, '\\')) {
+            return true;
+          }
+          for (int i = 0; i < Utf16CharacterStream::kCharsPerWord; i++) {
+            AddLiteralChar(static_cast<uc32>(chars[i]));
+          }
+          return false;
+        },
+        [this](uc32 c0) {
+          if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
+            if (V8_UNLIKELY(unibrow::IsStringLiteralLineTerminator(c0))) {
+              return true;
+            }
+            AddLiteralChar(c0);
+            return false;
+          }
+          uint8_t char_flags = character_scan_flags[c0];
+          if (MayTerminateString(char_flags)) return true;
+          AddLiteralChar(c0);
+          return false;
+        });
 
     while (c0_ == '\\') {
       Advance();
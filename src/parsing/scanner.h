@@ -93,6 +93,44 @@ class Utf16CharacterStream {
     }
   }
 
+  // Number of UTF-16 code units that fit into a machine word.
+  static constexpr int kCharsPerWord = sizeof(uintptr_t) / sizeof(uint16_t);
+
+  // Like AdvanceUntil above, but skips over the buffered code units a word at
+  // a time as long as |word_check| returns false for the kCharsPerWord code
+  // units it is passed, and only calls |check| on the code units of the
+  // remaining words. |word_check| must therefore only return false if none of
+  // the code units can satisfy |check|.
+  template <typename WordFunctionType, typename FunctionType>
+  V8_INLINE uc32 AdvanceUntil(WordFunctionType word_check,
+                              FunctionType check) {
+    while (true) {
+      while (buffer_end_ - buffer_cursor_ >= kCharsPerWord &&
+             !word_check(buffer_cursor_)) {
+        buffer_cursor_ += kCharsPerWord;
+      }
+
+      const uint16_t* word_end = buffer_end_ - buffer_cursor_ > kCharsPerWord
+                                     ? buffer_cursor_ + kCharsPerWord
+                                     : buffer_end_;
+      auto next_cursor_pos =
+          std::find_if(buffer_cursor_, word_end, [&check](uint16_t raw_c0_) {
+            uc32 c0_ = static_cast<uc32>(raw_c0_);
+            return check(c0_);
+          });
+
+      if (next_cursor_pos != word_end) {
+        buffer_cursor_ = next_cursor_pos + 1;
+        return static_cast<uc32>(*next_cursor_pos);
+      }
+      buffer_cursor_ = word_end;
+      if (buffer_cursor_ == buffer_end_ && !ReadBlockChecked()) {
+        buffer_cursor_++;
+        return kEndOfInput;
+      }
+    }
+  }
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -125,7 +163,7 @@ class Utf16CharacterStream {
   }
 
   // Returns true if the stream can be cloned with Clone.
-  // TODO(rmcilroy): Remove this once ChunkedStreams can be cloned.
+  // TODO(rmcilroy): Remove this once utf-8 streaming streams can be cloned.
   virtual bool can_be_cloned() const = 0;
 
   // Clones the character stream to enable another independent scanner to access
@@ -529,6 +567,11 @@ class V8_EXPORT_PRIVATE Scanner {
     c0_ = source_->AdvanceUntil(check);
   }
 
+  template <typename WordFunctionType, typename FunctionType>
+  V8_INLINE void AdvanceUntil(WordFunctionType word_check, FunctionType check) {
+    c0_ = source_->AdvanceUntil(word_check, check);
+  }
+
   bool CombineSurrogatePair() {
     DCHECK(!unibrow::Utf16::IsLeadSurrogate(kEndOfInput));
     if (unibrow::Utf16::IsLeadSurrogate(c0_)) {
@@ -4,6 +4,7 @@
 
 #include "src/profiler/cpu-profiler.h"
 
+#include <algorithm>
 #include <unordered_map>
 #include <utility>
 
@@ -33,6 +34,7 @@ class CpuSampler : public sampler::Sampler {
   void SampleStack(const v8::RegisterState& regs) override {
     TickSample* sample = processor_->StartTickSample();
     if (sample == nullptr) return;
+    base::TimeTicks start = base::TimeTicks::HighResolutionNow();
     Isolate* isolate = reinterpret_cast<Isolate*>(this->isolate());
     sample->Init(isolate, regs, TickSample::kIncludeCEntryFrame,
                  /* update_stats */ true,
@@ -42,6 +44,8 @@ class CpuSampler : public sampler::Sampler {
       if (sample->state == EXTERNAL) ++external_sample_count_;
     }
     processor_->FinishTickSample();
+    processor_->RecordSamplingTime(base::TimeTicks::HighResolutionNow() -
+                                   start);
   }
 
  private:
@@ -204,8 +208,8 @@ void ProfilerEventsProcessor::CodeEventHandler(
 ProfilerEventsProcessor::SampleProcessingResult
 SamplingEventsProcessor::ProcessOneSample() {
   TickSampleEventRecord record1;
-  if (ticks_from_vm_buffer_.Peek(&record1) &&
-      (record1.order == last_processed_code_event_id_)) {
+  bool has_vm_sample = ticks_from_vm_buffer_.Peek(&record1);
+  if (has_vm_sample && (record1.order == last_processed_code_event_id_)) {
     TickSampleEventRecord record;
     ticks_from_vm_buffer_.Dequeue(&record);
     generator_->SymbolizeTickSample(record.sample);
@@ -214,10 +218,13 @@ SamplingEventsProcessor::ProcessOneSample() {
 
   const TickSampleEventRecord* record = ticks_buffer_.Peek();
   if (record == nullptr) {
-    if (ticks_from_vm_buffer_.IsEmpty()) return NoSamplesInQueue;
+    if (!has_vm_sample) return NoSamplesInQueue;
+    next_sample_order_ = record1.order;
     return FoundSampleForNextCodeEvent;
   }
   if (record->order != last_processed_code_event_id_) {
+    next_sample_order_ = has_vm_sample ? std::min(record->order, record1.order)
+                                       : record->order;
     return FoundSampleForNextCodeEvent;
   }
   generator_->SymbolizeTickSample(record->sample);
@@ -225,6 +232,16 @@ SamplingEventsProcessor::ProcessOneSample() {
   return OneSampleProcessed;
 }
 
+void SamplingEventsProcessor::ProcessCodeEventsUpTo(unsigned order) {
+  // Samples record the id of the last code event enqueued before them, so
+  // all events up to that id can be applied without checking the sample
+  // queues in between. This matters when many code events arrive at once,
+  // e.g. when logging the existing code objects on profiler start.
+  do {
+    if (!ProcessCodeEvent()) return;
+  } while (last_processed_code_event_id_ < order);
+}
+
 void SamplingEventsProcessor::Run() {
   base::MutexGuard guard(&running_mutex_);
   while (running_.load(std::memory_order_relaxed)) {
@@ -238,11 +255,12 @@ void SamplingEventsProcessor::Run() {
       result = ProcessOneSample();
       if (result == FoundSampleForNextCodeEvent) {
         // All ticks of the current last_processed_code_event_id_ are
-        // processed, proceed to the next code event.
-        ProcessCodeEvent();
+        // processed, proceed to the code events of the next sample.
+        ProcessCodeEventsUpTo(next_sample_order_);
       }
       now = base::TimeTicks::HighResolutionNow();
     } while (result != NoSamplesInQueue && now < nextSampleTime);
+    processing_time_ += now - (nextSampleTime - period_);
 
     if (nextSampleTime > now) {
 #if V8_OS_WIN
@@ -561,6 +579,15 @@ CpuProfile* CpuProfiler::StopProfiling(String title) {
   return StopProfiling(profiles_->GetName(title));
 }
 
+CpuProfile* CpuProfiler::RestartProfiling(const char* title) {
+  if (!is_profiling_) return nullptr;
+  return profiles_->RestartProfiling(title);
+}
+
+CpuProfile* CpuProfiler::RestartProfiling(String title) {
+  return RestartProfiling(profiles_->GetName(title));
+}
+
 void CpuProfiler::StopProcessorIfLastProfile(const char* title) {
   if (!profiles_->IsLastProfile(title)) return;
   StopProcessor();
@@ -569,6 +596,16 @@ void CpuProfiler::StopProcessorIfLastProfile(const char* title) {
 void CpuProfiler::StopProcessor() {
   is_profiling_ = false;
   processor_->StopSynchronously();
+  if (FLAG_trace_cpu_profiler_overhead) {
+    int samples = processor_->samples_taken();
+    double sampling_ms = processor_->sampling_time().InMillisecondsF();
+    double us_per_sample = samples > 0 ? sampling_ms * 1000 / samples : 0;
+    PrintIsolate(isolate_,
+                 "cpu profiler: %d samples, sampling %.3f ms (%.1f us per "
+                 "sample), processing %.3f ms\n",
+                 samples, sampling_ms, us_per_sample,
+                 processor_->processing_time().InMillisecondsF());
+  }
   processor_.reset();
 
   DCHECK(profiling_scope_);
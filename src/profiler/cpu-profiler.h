@@ -174,6 +174,23 @@ class V8_EXPORT_PRIVATE ProfilerEventsProcessor : public base::Thread,
 
   virtual void SetSamplingInterval(base::TimeDelta) {}
 
+  // Overhead accounting. The sampling time is the time the sampled thread
+  // spent interrupted, the processing time is the time the processor thread
+  // spent symbolizing ticks and applying code events.
+  void RecordSamplingTime(base::TimeDelta time) {
+    samples_taken_.fetch_add(1, std::memory_order_relaxed);
+    sampling_time_us_.fetch_add(time.InMicroseconds(),
+                                std::memory_order_relaxed);
+  }
+  int samples_taken() const {
+    return samples_taken_.load(std::memory_order_relaxed);
+  }
+  base::TimeDelta sampling_time() const {
+    return base::TimeDelta::FromMicroseconds(
+        sampling_time_us_.load(std::memory_order_relaxed));
+  }
+  base::TimeDelta processing_time() const { return processing_time_; }
+
  protected:
   ProfilerEventsProcessor(Isolate* isolate, ProfileGenerator* generator,
                           ProfilerCodeObserver* code_observer);
@@ -198,6 +215,10 @@ class V8_EXPORT_PRIVATE ProfilerEventsProcessor : public base::Thread,
   std::atomic<unsigned> last_code_event_id_;
   unsigned last_processed_code_event_id_;
   Isolate* isolate_;
+  std::atomic<int> samples_taken_{0};
+  std::atomic<int64_t> sampling_time_us_{0};
+  // Only written by the processor thread.
+  base::TimeDelta processing_time_;
 };
 
 class V8_EXPORT_PRIVATE SamplingEventsProcessor
@@ -232,12 +253,18 @@ class V8_EXPORT_PRIVATE SamplingEventsProcessor
  private:
   SampleProcessingResult ProcessOneSample() override;
 
+  // Applies the pending code events up to |order| in one go.
+  void ProcessCodeEventsUpTo(unsigned order);
+
   static const size_t kTickSampleBufferSize = 512 * KB;
   static const size_t kTickSampleQueueLength =
       kTickSampleBufferSize / sizeof(TickSampleEventRecord);
   SamplingCircularQueue<TickSampleEventRecord,
                         kTickSampleQueueLength> ticks_buffer_;
   std::unique_ptr<sampler::Sampler> sampler_;
+  // Order of the oldest sample waiting for code events, valid after
+  // ProcessOneSample() returned FoundSampleForNextCodeEvent.
+  unsigned next_sample_order_ = 0;
   base::TimeDelta period_;           // Samples & code events processing period.
   const bool use_precise_sampling_;  // Whether or not busy-waiting is used for
                                      // low sampling intervals on Windows.
@@ -324,6 +351,8 @@ class V8_EXPORT_PRIVATE CpuProfiler {
 
   CpuProfile* StopProfiling(const char* title);
   CpuProfile* StopProfiling(String title);
+  CpuProfile* RestartProfiling(const char* title);
+  CpuProfile* RestartProfiling(String title);
   int GetProfilesCount();
   CpuProfile* GetProfile(int index);
   void DeleteAllProfiles();
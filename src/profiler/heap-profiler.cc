@@ -85,6 +85,32 @@ HeapSnapshot* HeapProfiler::TakeSnapshot(
   return result;
 }
 
+bool HeapProfiler::TakeSnapshotToStream(
+    v8::OutputStream* stream, v8::ActivityControl* control,
+    v8::HeapProfiler::ObjectNameResolver* resolver,
+    bool treat_global_objects_as_roots) {
+  bool success;
+  {
+    std::unique_ptr<HeapSnapshot> snapshot =
+        std::make_unique<HeapSnapshot>(this, treat_global_objects_as_roots);
+    HeapSnapshotGenerator generator(snapshot.get(), control, resolver, heap());
+    success = generator.GenerateSnapshot();
+    if (success) {
+      HeapSnapshotJSONSerializer serializer(snapshot.get(), true);
+      serializer.Serialize(stream);
+    }
+  }
+  ids_->RemoveDeadEntries();
+  is_tracking_object_moves_ = true;
+  // The names of a transient snapshot are not needed after serialization.
+  MaybeClearStringsStorage();
+
+  heap()->isolate()->debug()->feature_tracker()->Track(
+      DebugFeatureTracker::kHeapSnapshot);
+
+  return success;
+}
+
 bool HeapProfiler::StartSamplingHeapProfiler(
     uint64_t sample_interval, int stack_depth,
     v8::HeapProfiler::SamplingFlags flags) {
@@ -32,6 +32,11 @@ class HeapProfiler : public HeapObjectAllocationTracker {
   HeapSnapshot* TakeSnapshot(v8::ActivityControl* control,
                              v8::HeapProfiler::ObjectNameResolver* resolver,
                              bool treat_global_objects_as_roots);
+  // Takes a snapshot and serializes it to |stream| without retaining it.
+  bool TakeSnapshotToStream(v8::OutputStream* stream,
+                            v8::ActivityControl* control,
+                            v8::HeapProfiler::ObjectNameResolver* resolver,
+                            bool treat_global_objects_as_roots);
 
   bool StartSamplingHeapProfiler(uint64_t sample_interval, int stack_depth,
                                  v8::HeapProfiler::SamplingFlags);
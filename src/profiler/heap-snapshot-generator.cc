@@ -263,6 +263,17 @@ void HeapSnapshot::FillChildren() {
   }
 }
 
+void HeapSnapshot::ReleaseGraph() {
+  root_entry_ = nullptr;
+  gc_roots_entry_ = nullptr;
+  std::fill(std::begin(gc_subroot_entries_), std::end(gc_subroot_entries_),
+            nullptr);
+  entries_by_id_cache_.clear();
+  std::vector<HeapGraphEdge*>().swap(children_);
+  std::deque<HeapGraphEdge>().swap(edges_);
+  std::deque<HeapEntry>().swap(entries_);
+}
+
 HeapEntry* HeapSnapshot::GetEntryById(SnapshotObjectId id) {
   if (entries_by_id_cache_.empty()) {
     CHECK(is_complete());
@@ -684,7 +695,9 @@ const char* V8HeapExplorer::GetSystemEntryName(HeapObject object) {
 }
 
 int V8HeapExplorer::EstimateObjectsCount() {
-  CombinedHeapObjectIterator it(heap_, HeapObjectIterator::kFilterUnreachable);
+  // The count is only used for progress reporting, so it does not need to
+  // pay for a separate reachability pass over the heap.
+  CombinedHeapObjectIterator it(heap_);
   int objects_count = 0;
   while (!it.Next().is_null()) ++objects_count;
   return objects_count;
@@ -2228,6 +2241,8 @@ void HeapSnapshotJSONSerializer::SerializeImpl() {
   SerializeEdges();
   if (writer_->aborted()) return;
   writer_->AddString("],\n");
+  // The remaining sections only refer to nodes by index.
+  if (release_graph_) snapshot_->ReleaseGraph();
 
   writer_->AddString("\"trace_function_infos\":[");
   SerializeTraceNodeInfos();
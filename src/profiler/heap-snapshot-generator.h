@@ -207,6 +207,9 @@ class HeapSnapshot {
   void AddSyntheticRootEntries();
   HeapEntry* GetEntryById(SnapshotObjectId id);
   void FillChildren();
+  // Frees the nodes and edges of the graph. Only used by serialization of
+  // transient snapshots; the snapshot can only be destroyed afterwards.
+  void ReleaseGraph();
 
   void Print(int max_depth);
 
@@ -525,12 +528,17 @@ class OutputStreamWriter;
 
 class HeapSnapshotJSONSerializer {
  public:
-  explicit HeapSnapshotJSONSerializer(HeapSnapshot* snapshot)
+  // If |release_graph| is set, the graph of |snapshot| is released as soon as
+  // nodes and edges have been written, which bounds the peak memory use of
+  // snapshots that are serialized right after they were taken.
+  explicit HeapSnapshotJSONSerializer(HeapSnapshot* snapshot,
+                                      bool release_graph = false)
       : snapshot_(snapshot),
         strings_(StringsMatch),
         next_node_id_(1),
         next_string_id_(1),
-        writer_(nullptr) {}
+        writer_(nullptr),
+        release_graph_(release_graph) {}
   void Serialize(v8::OutputStream* stream);
 
  private:
@@ -567,6 +575,7 @@ class HeapSnapshotJSONSerializer {
   int next_node_id_;
   int next_string_id_;
   OutputStreamWriter* writer_;
+  const bool release_graph_;
 
   friend class HeapSnapshotJSONSerializerEnumerator;
   friend class HeapSnapshotJSONSerializerIterator;
@@ -793,6 +793,34 @@ CpuProfile* CpuProfilesCollection::StopProfiling(const char* title) {
   return profile;
 }
 
+CpuProfile* CpuProfilesCollection::RestartProfiling(const char* title) {
+  const bool empty_title = (title[0] == '\0');
+  CpuProfile* profile = nullptr;
+  current_profiles_semaphore_.Wait();
+
+  auto it = std::find_if(current_profiles_.rbegin(), current_profiles_.rend(),
+                         [&](const std::unique_ptr<CpuProfile>& p) {
+                           return empty_title || strcmp(p->title(), title) == 0;
+                         });
+
+  if (it != current_profiles_.rend()) {
+    (*it)->FinishProfile();
+    profile = it->get();
+    std::unique_ptr<CpuProfile> next(
+        new CpuProfile(profiler_, profile->title(), profile->options()));
+    // The filter context may have moved since the profile was started.
+    if (ContextFilter* filter = profile->context_filter()) {
+      next->context_filter()->set_native_context_address(
+          filter->native_context_address());
+    }
+    finished_profiles_.push_back(std::move(*it));
+    *it = std::move(next);
+  }
+
+  current_profiles_semaphore_.Signal();
+  return profile;
+}
+
 
 bool CpuProfilesCollection::IsLastProfile(const char* title) {
   // Called from VM thread, and only it can mutate the list,
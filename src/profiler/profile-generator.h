@@ -404,6 +404,7 @@ class CpuProfile {
   int64_t sampling_interval_us() const {
     return options_.sampling_interval_us();
   }
+  const CpuProfilingOptions& options() const { return options_; }
 
   base::TimeTicks start_time() const { return start_time_; }
   base::TimeTicks end_time() const { return end_time_; }
@@ -480,6 +481,10 @@ class V8_EXPORT_PRIVATE CpuProfilesCollection {
   bool StartProfiling(const char* title, CpuProfilingOptions options = {});
 
   CpuProfile* StopProfiling(const char* title);
+  // Finishes the profile like StopProfiling, and replaces it with a new one
+  // with the same title and options in the same step, so that no samples are
+  // lost in between.
+  CpuProfile* RestartProfiling(const char* title);
   std::vector<std::unique_ptr<CpuProfile>>* profiles() {
     return &finished_profiles_;
   }
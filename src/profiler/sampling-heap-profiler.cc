@@ -190,13 +190,25 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
   // the first element in the list.
   for (auto it = stack.rbegin(); it != stack.rend(); ++it) {
     SharedFunctionInfo shared = *it;
-    const char* name = this->names()->GetName(shared.DebugName());
     int script_id = v8::UnboundScript::kNoScriptId;
     if (shared.script().IsScript()) {
       Script script = Script::cast(shared.script());
       script_id = script.id();
     }
-    node = FindOrAddChildNode(node, name, script_id, shared.StartPosition());
+    int start_position = shared.StartPosition();
+    // Functions with a script are identified by their position, so their name
+    // is only looked up in the strings storage when their node is created.
+    // Most samples hit existing nodes all the way down.
+    if (script_id != v8::UnboundScript::kNoScriptId) {
+      AllocationNode* child = node->FindChildNode(
+          AllocationNode::function_id(script_id, start_position, nullptr));
+      if (child) {
+        node = child;
+        continue;
+      }
+    }
+    const char* name = this->names()->GetName(shared.DebugName());
+    node = FindOrAddChildNode(node, name, script_id, start_position);
   }
 
   if (found_arguments_marker_frames) {
@@ -0,0 +1,139 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BYTECODE_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BYTECODE_H_
+
+#include <ostream>
+
+#include "src/base/logging.h"
+#include "src/common/globals.h"
+#include "src/regexp/regexp-ast.h"
+#include "src/utils/vector.h"
+
+// ----------------------------------------------------------------------------
+// Definition and semantics of the bytecode of the experimental regexp engine.
+//
+// The engine does not backtrack. Instead, it simulates a set of threads that
+// all advance through the subject string in lockstep, one character at a time
+// (a "Pike VM"). Each thread has a program counter and its own set of capture
+// registers. Threads are ordered by priority, and the match found by the
+// highest priority thread is the one that a backtracking engine would find
+// first, so the results are the same as those of irregexp.
+//
+// Opcodes and their meaning for a thread at input position `cp`:
+// - CONSUME_RANGE: If the character at `cp` is in the (inclusive) range
+//   `[consume_range.min, consume_range.max]`, continue at the next
+//   instruction with input position `cp + 1`. Otherwise the thread dies.
+// - ASSERTION: Continue at the next instruction if the assertion holds at
+//   `cp`, otherwise the thread dies.
+// - FORK: Continue at the next instruction and additionally spawn a thread
+//   with a copy of the registers that starts at instruction `pc`. The new
+//   thread has lower priority than the current one, but higher priority than
+//   all other threads of lower priority than the current one.
+// - JMP: Continue at instruction `pc`.
+// - SET_REGISTER_TO_CP: Set register `register_index` to `cp`, continue at
+//   the next instruction.
+// - CLEAR_REGISTER: Set register `register_index` to -1, continue at the next
+//   instruction.
+// - ACCEPT: The thread has found a match. All threads of lower priority are
+//   discarded.
+//
+// No thread ever executes the same instruction twice at the same input
+// position; threads arriving at an instruction that a thread of higher
+// priority already executed at the current position are discarded. The
+// number of threads is thus bounded by the length of the program, and so is
+// the work per input character.
+// ----------------------------------------------------------------------------
+
+namespace v8 {
+namespace internal {
+
+struct RegExpInstruction {
+  enum Opcode : int32_t {
+    ACCEPT,
+    ASSERTION,
+    CLEAR_REGISTER,
+    CONSUME_RANGE,
+    FORK,
+    JMP,
+    SET_REGISTER_TO_CP,
+  };
+
+  struct Uc16Range {
+    uc16 min;  // Inclusive.
+    uc16 max;  // Inclusive.
+  };
+
+  static RegExpInstruction ConsumeRange(Uc16Range consume_range) {
+    RegExpInstruction result;
+    result.opcode = CONSUME_RANGE;
+    result.payload.consume_range = consume_range;
+    return result;
+  }
+
+  static RegExpInstruction Fork(int32_t alt_index) {
+    RegExpInstruction result;
+    result.opcode = FORK;
+    result.payload.pc = alt_index;
+    return result;
+  }
+
+  static RegExpInstruction Jmp(int32_t alt_index) {
+    RegExpInstruction result;
+    result.opcode = JMP;
+    result.payload.pc = alt_index;
+    return result;
+  }
+
+  static RegExpInstruction Accept() {
+    RegExpInstruction result;
+    result.opcode = ACCEPT;
+    return result;
+  }
+
+  static RegExpInstruction SetRegisterToCp(int32_t register_index) {
+    RegExpInstruction result;
+    result.opcode = SET_REGISTER_TO_CP;
+    result.payload.register_index = register_index;
+    return result;
+  }
+
+  static RegExpInstruction ClearRegister(int32_t register_index) {
+    RegExpInstruction result;
+    result.opcode = CLEAR_REGISTER;
+    result.payload.register_index = register_index;
+    return result;
+  }
+
+  static RegExpInstruction Assertion(RegExpAssertion::AssertionType t) {
+    RegExpInstruction result;
+    result.opcode = ASSERTION;
+    result.payload.assertion_type = t;
+    return result;
+  }
+
+  Opcode opcode;
+  union {
+    // Payload of CONSUME_RANGE:
+    Uc16Range consume_range;
+    // Payload of FORK and JMP, the next/forked program counter (pc):
+    int32_t pc;
+    // Payload of SET_REGISTER_TO_CP and CLEAR_REGISTER:
+    int32_t register_index;
+    // Payload of ASSERTION:
+    RegExpAssertion::AssertionType assertion_type;
+  } payload;
+  STATIC_ASSERT(sizeof(payload) == 4);
+};
+STATIC_ASSERT(sizeof(RegExpInstruction) == 8);
+
+std::ostream& operator<<(std::ostream& os, const RegExpInstruction& inst);
+std::ostream& operator<<(std::ostream& os,
+                         Vector<const RegExpInstruction> insts);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_BYTECODE_H_
@@ -0,0 +1,606 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-compiler.h"
+
+#include <algorithm>
+#include <limits>
+
+#include "src/zone/zone-list-inl.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// The experimental engine works on UTF-16 code units and doesn't support the
+// unicode flag, so no code point above this is ever consumed.
+constexpr uc32 kMaxSupportedCodepoint = 0xFFFFu;
+
+class CanBeHandledVisitor final : private RegExpVisitor {
+  // Visitor to implement `ExperimentalRegExpCompiler::CanBeHandled`.
+ public:
+  static bool Check(RegExpTree* tree, JSRegExp::Flags flags,
+                    int capture_count) {
+    if (!AreSuitableFlags(flags)) return false;
+    CanBeHandledVisitor visitor;
+    tree->Accept(&visitor, nullptr);
+    return visitor.result_;
+  }
+
+ private:
+  CanBeHandledVisitor() = default;
+
+  static bool AreSuitableFlags(JSRegExp::Flags flags) {
+    // Case-insensitive matching and unicode mode are not supported (yet).
+    static constexpr JSRegExp::Flags kAllowedFlags =
+        JSRegExp::kGlobal | JSRegExp::kSticky | JSRegExp::kMultiline |
+        JSRegExp::kDotAll | JSRegExp::kLinear;
+    return (flags & ~kAllowedFlags) == 0;
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    for (RegExpTree* alt : *node->alternatives()) {
+      alt->Accept(this, nullptr);
+      if (!result_) return nullptr;
+    }
+    return nullptr;
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    for (RegExpTree* child : *node->nodes()) {
+      child->Accept(this, nullptr);
+      if (!result_) return nullptr;
+    }
+    return nullptr;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* node, void*) override {
+    result_ = result_ && AreSuitableFlags(node->flags());
+    return nullptr;
+  }
+
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    result_ = result_ && AreSuitableFlags(node->flags());
+    return nullptr;
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    result_ = result_ && AreSuitableFlags(node->flags());
+    return nullptr;
+  }
+
+  void* VisitText(RegExpText* node, void*) override {
+    for (TextElement& el : *node->elements()) {
+      el.tree()->Accept(this, nullptr);
+      if (!result_) return nullptr;
+    }
+    return nullptr;
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    // Finite but large values of `min()` and `max()` are bad for the
+    // breadth-first engine because finite (optional) repetition is dealt with
+    // by replicating the bytecode of the body of the quantifier.  The number
+    // of replications grows exponentially in how deeply quantifiers are nested.
+    // `replication_factor_` keeps track of how often the current node will
+    // have to be replicated in the generated bytecode, and we don't allow this
+    // to exceed some small value.
+    static constexpr int kMaxReplicationFactor = 16;
+
+    // First we rule out values for min and max that are too big even before
+    // taking into account the ambient replication_factor_.  This also guards
+    // against overflows in `local_replication` or `replication_factor_`.
+    if (node->min() > kMaxReplicationFactor ||
+        (node->max() != RegExpTree::kInfinity &&
+         node->max() > kMaxReplicationFactor)) {
+      result_ = false;
+      return nullptr;
+    }
+
+    // Save the current replication factor so that it can be restored if we
+    // return with `result_ == true`.
+    int before_replication_factor = replication_factor_;
+
+    int local_replication;
+    if (node->max() == RegExpTree::kInfinity) {
+      local_replication = node->min() + 1;
+    } else {
+      local_replication = node->max();
+    }
+
+    replication_factor_ *= local_replication;
+    if (replication_factor_ > kMaxReplicationFactor) {
+      result_ = false;
+      return nullptr;
+    }
+
+    // Possessive quantifiers are never produced for JavaScript regexps, and
+    // the breadth-first engine has no notion of them.
+    if (node->is_possessive()) {
+      replication_factor_ = before_replication_factor;
+      result_ = false;
+      return nullptr;
+    }
+
+    node->body()->Accept(this, nullptr);
+    replication_factor_ = before_replication_factor;
+    return nullptr;
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    // Lookarounds would need a thread per lookaround position.
+    result_ = false;
+    return nullptr;
+  }
+
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    // This can't be implemented without backtracking.
+    result_ = false;
+    return nullptr;
+  }
+
+  void* VisitEmpty(RegExpEmpty* node, void*) override { return nullptr; }
+
+ private:
+  // See comment in `VisitQuantifier`:
+  int replication_factor_ = 1;
+
+  bool result_ = true;
+};
+
+}  // namespace
+
+bool ExperimentalRegExpCompiler::CanBeHandled(RegExpTree* tree,
+                                              JSRegExp::Flags flags,
+                                              int capture_count) {
+  return CanBeHandledVisitor::Check(tree, flags, capture_count);
+}
+
+namespace {
+
+// A label in bytecode which starts with no known address. The address *must*
+// be bound with `Bind` before the label goes out of scope.
+// Implemented as a linked list through the `payload.pc` of FORK and JMP
+// instructions.
+class BytecodeLabel {
+ public:
+  BytecodeLabel() = default;
+  ~BytecodeLabel() {
+    DCHECK_EQ(state_, BOUND);
+    DCHECK_GE(bound_index_, 0);
+  }
+
+  // Don't copy, don't move.  Moving could be implemented, but it's not
+  // needed anywhere.
+  BytecodeLabel(const BytecodeLabel&) = delete;
+  BytecodeLabel& operator=(const BytecodeLabel&) = delete;
+
+ private:
+  friend class BytecodeAssembler;
+
+  // UNBOUND implies unbound_patch_list_begin_.
+  // BOUND implies bound_index_.
+  enum { UNBOUND, BOUND } state_ = UNBOUND;
+  union {
+    int unbound_patch_list_begin_ = -1;
+    int bound_index_;
+  };
+};
+
+class BytecodeAssembler {
+ public:
+  explicit BytecodeAssembler(Zone* zone) : zone_(zone), code_(0, zone) {}
+
+  ZoneList<RegExpInstruction> IntoCode() && { return std::move(code_); }
+
+  void Accept() { code_.Add(RegExpInstruction::Accept(), zone_); }
+
+  void Assertion(RegExpAssertion::AssertionType t) {
+    code_.Add(RegExpInstruction::Assertion(t), zone_);
+  }
+
+  void ClearRegister(int32_t register_index) {
+    code_.Add(RegExpInstruction::ClearRegister(register_index), zone_);
+  }
+
+  void ConsumeRange(uc16 from, uc16 to) {
+    code_.Add(RegExpInstruction::ConsumeRange({from, to}), zone_);
+  }
+
+  void ConsumeAnyChar() {
+    code_.Add(RegExpInstruction::ConsumeRange({0x0000, 0xFFFF}), zone_);
+  }
+
+  void Fork(BytecodeLabel& target) {
+    LabelledInstrImpl(RegExpInstruction::Opcode::FORK, target);
+  }
+
+  void Jmp(BytecodeLabel& target) {
+    LabelledInstrImpl(RegExpInstruction::Opcode::JMP, target);
+  }
+
+  void SetRegisterToCp(int32_t register_index) {
+    code_.Add(RegExpInstruction::SetRegisterToCp(register_index), zone_);
+  }
+
+  void Bind(BytecodeLabel& target) {
+    DCHECK_EQ(target.state_, BytecodeLabel::UNBOUND);
+
+    int index = code_.length();
+
+    while (target.unbound_patch_list_begin_ != -1) {
+      RegExpInstruction& inst = code_[target.unbound_patch_list_begin_];
+      DCHECK(inst.opcode == RegExpInstruction::FORK ||
+             inst.opcode == RegExpInstruction::JMP);
+
+      target.unbound_patch_list_begin_ = inst.payload.pc;
+      inst.payload.pc = index;
+    }
+
+    target.state_ = BytecodeLabel::BOUND;
+    target.bound_index_ = index;
+  }
+
+  // Consumes from an empty range, which no thread ever gets past.
+  void Fail() {
+    code_.Add(RegExpInstruction::ConsumeRange({0xFFFF, 0x0000}), zone_);
+  }
+
+ private:
+  void LabelledInstrImpl(RegExpInstruction::Opcode op, BytecodeLabel& target) {
+    RegExpInstruction result;
+    result.opcode = op;
+
+    if (target.state_ == BytecodeLabel::BOUND) {
+      result.payload.pc = target.bound_index_;
+    } else {
+      DCHECK_EQ(target.state_, BytecodeLabel::UNBOUND);
+      int new_list_begin = code_.length();
+      DCHECK_GE(new_list_begin, 0);
+
+      result.payload.pc = target.unbound_patch_list_begin_;
+
+      target.unbound_patch_list_begin_ = new_list_begin;
+    }
+
+    code_.Add(result, zone_);
+  }
+
+  Zone* zone_;
+  ZoneList<RegExpInstruction> code_;
+};
+
+class CompileVisitor : private RegExpVisitor {
+ public:
+  static ZoneList<RegExpInstruction> Compile(RegExpTree* tree,
+                                             JSRegExp::Flags flags,
+                                             Zone* zone) {
+    CompileVisitor compiler(zone);
+
+    if ((flags & JSRegExp::kSticky) == 0 && !tree->IsAnchoredAtStart()) {
+      // The match is not anchored, i.e. may start at any input position, so
+      // we emit a preamble corresponding to /.*?/.  This skips an arbitrary
+      // prefix in the input non-greedily.
+      compiler.CompileNonGreedyStar(
+          [&]() { compiler.assembler_.ConsumeAnyChar(); });
+    }
+
+    compiler.assembler_.SetRegisterToCp(0);
+    tree->Accept(&compiler, nullptr);
+    compiler.assembler_.SetRegisterToCp(1);
+    compiler.assembler_.Accept();
+
+    return std::move(compiler.assembler_).IntoCode();
+  }
+
+ private:
+  explicit CompileVisitor(Zone* zone) : zone_(zone), assembler_(zone) {}
+
+  // Generate a disjunction of code fragments compiled by a function `alt_gen`.
+  // `alt_gen` is called repeatedly with argument `int i = 0, 1, ..., alt_num -
+  // 1` and should build code corresponding to the ith alternative.
+  template <class F>
+  void CompileDisjunction(int alt_num, F&& gen_alt) {
+    // An alternative a1 | ... | an is compiled into
+    //
+    //     FORK tail1
+    //     <a1>
+    //     JMP end
+    //   tail1:
+    //     FORK tail2
+    //     <a2>
+    //     JMP end
+    //   tail2:
+    //     ...
+    //     ...
+    //   tail{n -1}:
+    //     <an>
+    //   end:
+    //
+    // By the semantics of the FORK instruction (see above at definition and
+    // semantics), a forked thread has lower priority than the thread that
+    // spawned it.  This means that with the code we're generating here, the
+    // thread matching the alternative a1 has indeed highest priority, followed
+    // by the thread for a2 and so on.
+
+    if (alt_num == 0) {
+      // The empty disjunction.  This can never match.
+      assembler_.Fail();
+      return;
+    }
+
+    BytecodeLabel end;
+
+    for (int i = 0; i != alt_num - 1; ++i) {
+      BytecodeLabel tail;
+      assembler_.Fork(tail);
+      gen_alt(i);
+      assembler_.Jmp(end);
+      assembler_.Bind(tail);
+    }
+
+    gen_alt(alt_num - 1);
+
+    assembler_.Bind(end);
+  }
+
+  void* VisitDisjunction(RegExpDisjunction* node, void*) override {
+    ZoneList<RegExpTree*>& alts = *node->alternatives();
+    CompileDisjunction(alts.length(),
+                       [&](int i) { alts[i]->Accept(this, nullptr); });
+    return nullptr;
+  }
+
+  void* VisitAlternative(RegExpAlternative* node, void*) override {
+    for (RegExpTree* child : *node->nodes()) {
+      child->Accept(this, nullptr);
+    }
+    return nullptr;
+  }
+
+  void* VisitAssertion(RegExpAssertion* node, void*) override {
+    assembler_.Assertion(node->assertion_type());
+    return nullptr;
+  }
+
+  void* VisitCharacterClass(RegExpCharacterClass* node, void*) override {
+    // A character class is compiled as Disjunction over its `CharacterRange`s.
+    ZoneList<CharacterRange>* ranges = node->ranges(zone_);
+    CharacterRange::Canonicalize(ranges);
+    if (node->is_negated()) {
+      // The complement of a disjoint, non-adjacent (i.e. `Canonicalize`d)
+      // union of k intervals is a union of at most k + 1 intervals.
+      ZoneList<CharacterRange>* negated =
+          zone_->New<ZoneList<CharacterRange>>(ranges->length() + 1, zone_);
+      CharacterRange::Negate(ranges, negated, zone_);
+      DCHECK_LE(negated->length(), ranges->length() + 1);
+      ranges = negated;
+    }
+
+    // Only code units can be consumed, so ranges are cut off at
+    // kMaxSupportedCodepoint.  Ranges are sorted, so all ranges that lie
+    // beyond it come last.
+    STATIC_ASSERT(kMaxSupportedCodepoint <= std::numeric_limits<uc16>::max());
+    int range_count = ranges->length();
+    while (range_count > 0 &&
+           (*ranges)[range_count - 1].from() > kMaxSupportedCodepoint) {
+      --range_count;
+    }
+
+    CompileDisjunction(range_count, [&](int i) {
+      uc16 from = static_cast<uc16>((*ranges)[i].from());
+      uc16 to = static_cast<uc16>(
+          std::min((*ranges)[i].to(), kMaxSupportedCodepoint));
+      assembler_.ConsumeRange(from, to);
+    });
+    return nullptr;
+  }
+
+  void* VisitAtom(RegExpAtom* node, void*) override {
+    for (uc16 c : node->data()) {
+      assembler_.ConsumeRange(c, c);
+    }
+    return nullptr;
+  }
+
+  void ClearRegisters(Interval indices) {
+    if (indices.is_empty()) return;
+    for (int i = indices.from(); i <= indices.to(); ++i) {
+      assembler_.ClearRegister(i);
+    }
+  }
+
+  // Emit bytecode corresponding to /<emit_body>*/.
+  template <class F>
+  void CompileGreedyStar(F&& emit_body) {
+    // This is compiled into
+    //
+    //   begin:
+    //     FORK end
+    //     <body>
+    //     JMP begin
+    //   end:
+    //     ...
+    //
+    // This is greedy because a forked thread has lower priority than the
+    // thread that spawned it.
+    BytecodeLabel begin;
+    BytecodeLabel end;
+
+    assembler_.Bind(begin);
+    assembler_.Fork(end);
+    emit_body();
+    assembler_.Jmp(begin);
+
+    assembler_.Bind(end);
+  }
+
+  // Emit bytecode corresponding to /<emit_body>*?/.
+  template <class F>
+  void CompileNonGreedyStar(F&& emit_body) {
+    // This is compiled into
+    //
+    //     FORK body
+    //     JMP end
+    //   body:
+    //     <body>
+    //     FORK body
+    //   end:
+    //     ...
+
+    BytecodeLabel body;
+    BytecodeLabel end;
+
+    assembler_.Fork(body);
+    assembler_.Jmp(end);
+
+    assembler_.Bind(body);
+    emit_body();
+    assembler_.Fork(body);
+
+    assembler_.Bind(end);
+  }
+
+  // Emit bytecode corresponding to /<emit_body>{0, max_repetition_num}/.
+  template <class F>
+  void CompileGreedyRepetition(F&& emit_body, int max_repetition_num) {
+    // This is compiled into
+    //
+    //     FORK end
+    //     <body>
+    //     FORK end
+    //     <body>
+    //     ...
+    //     ...
+    //     FORK end
+    //     <body>
+    //   end:
+    //     ...
+
+    BytecodeLabel end;
+    for (int i = 0; i != max_repetition_num; ++i) {
+      assembler_.Fork(end);
+      emit_body();
+    }
+    assembler_.Bind(end);
+  }
+
+  // Emit bytecode corresponding to /<emit_body>{0, max_repetition_num}?/.
+  template <class F>
+  void CompileNonGreedyRepetition(F&& emit_body, int max_repetition_num) {
+    // This is compiled into
+    //
+    //     FORK body0
+    //     JMP end
+    //   body0:
+    //     <body>
+    //     FORK body1
+    //     JMP end
+    //   body1:
+    //     <body>
+    //     ...
+    //     ...
+    //   body{max_repetition_num - 1}:
+    //     <body>
+    //   end:
+    //     ...
+
+    BytecodeLabel end;
+    for (int i = 0; i != max_repetition_num; ++i) {
+      BytecodeLabel body;
+      assembler_.Fork(body);
+      assembler_.Jmp(end);
+
+      assembler_.Bind(body);
+      emit_body();
+    }
+    assembler_.Bind(end);
+  }
+
+  void* VisitQuantifier(RegExpQuantifier* node, void*) override {
+    // Emit the body, but clear registers occuring in body first, so that
+    // captures of earlier iterations don't leak into the current one.
+    auto emit_body = [&]() {
+      ClearRegisters(node->body()->CaptureRegisters());
+      node->body()->Accept(this, nullptr);
+    };
+
+    // First repeat the body `min()` times.
+    for (int i = 0; i != node->min(); ++i) emit_body();
+
+    DCHECK(!node->is_possessive());
+    if (node->is_greedy()) {
+      if (node->max() == RegExpTree::kInfinity) {
+        CompileGreedyStar(emit_body);
+      } else {
+        CompileGreedyRepetition(emit_body, node->max() - node->min());
+      }
+    } else {
+      DCHECK(node->is_non_greedy());
+      if (node->max() == RegExpTree::kInfinity) {
+        CompileNonGreedyStar(emit_body);
+      } else {
+        CompileNonGreedyRepetition(emit_body, node->max() - node->min());
+      }
+    }
+    return nullptr;
+  }
+
+  void* VisitCapture(RegExpCapture* node, void*) override {
+    int index = node->index();
+    int start_register = RegExpCapture::StartRegister(index);
+    int end_register = RegExpCapture::EndRegister(index);
+    assembler_.SetRegisterToCp(start_register);
+    node->body()->Accept(this, nullptr);
+    assembler_.SetRegisterToCp(end_register);
+    return nullptr;
+  }
+
+  void* VisitGroup(RegExpGroup* node, void*) override {
+    node->body()->Accept(this, nullptr);
+    return nullptr;
+  }
+
+  void* VisitLookaround(RegExpLookaround* node, void*) override {
+    UNREACHABLE();
+  }
+
+  void* VisitBackReference(RegExpBackReference* node, void*) override {
+    UNREACHABLE();
+  }
+
+  void* VisitEmpty(RegExpEmpty* node, void*) override { return nullptr; }
+
+  void* VisitText(RegExpText* node, void*) override {
+    for (TextElement& text_el : *node->elements()) {
+      text_el.tree()->Accept(this, nullptr);
+    }
+    return nullptr;
+  }
+
+ private:
+  Zone* zone_;
+  BytecodeAssembler assembler_;
+};
+
+}  // namespace
+
+ZoneList<RegExpInstruction> ExperimentalRegExpCompiler::Compile(
+    RegExpTree* tree, JSRegExp::Flags flags, Zone* allocator) {
+  return CompileVisitor::Compile(tree, flags, allocator);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,356 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental-interpreter.h"
+
+#include <algorithm>
+
+#include "src/strings/char-predicates-inl.h"
+#include "src/strings/unicode.h"
+#include "src/zone/zone-list-inl.h"
+#include "src/zone/zone.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+template <class Character>
+bool SatisfiesAssertion(RegExpAssertion::AssertionType type,
+                        Vector<const Character> context, int position) {
+  DCHECK_LE(position, context.length());
+  DCHECK_GE(position, 0);
+
+  switch (type) {
+    case RegExpAssertion::START_OF_INPUT:
+      return position == 0;
+    case RegExpAssertion::END_OF_INPUT:
+      return position == context.length();
+    case RegExpAssertion::START_OF_LINE:
+      if (position == 0) return true;
+      return unibrow::IsLineTerminator(context[position - 1]);
+    case RegExpAssertion::END_OF_LINE:
+      if (position == context.length()) return true;
+      return unibrow::IsLineTerminator(context[position]);
+    case RegExpAssertion::BOUNDARY:
+    case RegExpAssertion::NON_BOUNDARY: {
+      bool word_before = position > 0 && IsRegExpWord(context[position - 1]);
+      bool word_after =
+          position < context.length() && IsRegExpWord(context[position]);
+      bool is_boundary = word_before != word_after;
+      return is_boundary == (type == RegExpAssertion::BOUNDARY);
+    }
+  }
+  UNREACHABLE();
+}
+
+template <class Character>
+class NfaInterpreter {
+  // Executes a bytecode program in breadth-first mode, without backtracking.
+  // `Character` can be instantiated with `uint8_t` or `uc16` for one byte or
+  // two byte input strings.
+  //
+  // In contrast to the backtracking implementation, this has linear time
+  // complexity in the length of the input string. Breadth-first mode means
+  // that threads are executed in lockstep with respect to their input
+  // position, i.e. the threads share a common input index. This is similar
+  // to breadth-first simulation of a non-deterministic finite automaton (nfa),
+  // hence the name of the class.
+  //
+  // To follow the semantics of a backtracking VM implementation, we have to be
+  // careful about whether we stop execution when a thread executes ACCEPT.
+  // For example, consider execution of the bytecode generated by the regexp
+  //
+  //   r = /abc|..|[a-c]{10,}/
+  //
+  // on input "abcccccccccccccc".  Clearly the three alternatives
+  // - /abc/
+  // - /../
+  // - /[a-c]{10,}/
+  // all match this input.  A backtracking implementation will report "abc" as
+  // match, because it explores the first alternative before the others.
+  //
+  // However, if we execute breadth first, then we execute the 3 threads
+  // - t1, which tries to match /abc/
+  // - t2, which tries to match /../
+  // - t3, which tries to match /[a-c]{10,}/
+  // in lockstep i.e. by iterating over the input and feeding all threads one
+  // character at a time.  t2 will execute an ACCEPT after two characters,
+  // while t1 will only execute ACCEPT after three characters. Thus we find a
+  // match for the second alternative before a match of the first alternative.
+  //
+  // This shows that we cannot always stop searching as soon as some thread t
+  // executes ACCEPT:  If there is a thread u with higher priority than t, then
+  // it must be finished first.  If u produces a match, then we can discard the
+  // match of t because matches produced by threads with higher priority are
+  // preferred over matches of threads with lower priority.  On the other hand,
+  // we are allowed to abort all threads with lower priority than t if t
+  // produces a match: Such threads can only produce worse matches.  In the
+  // example above, we can abort t3 after two characters because of t2's match.
+  //
+  // Thus the interpreter keeps track of a priority-ordered list of threads.
+  // If a thread ACCEPTs, all threads with lower priority are discarded, and
+  // the search continues with the threads with higher priority.  If no
+  // threads with high priority are left, we return the match that was
+  // produced by the ACCEPTing thread with highest priority.
+ public:
+  NfaInterpreter(Vector<const RegExpInstruction> bytecode,
+                 int register_count_per_match, Vector<const Character> input,
+                 int32_t input_index, Zone* zone)
+      : bytecode_(bytecode),
+        register_count_per_match_(register_count_per_match),
+        input_(input),
+        input_index_(input_index),
+        pc_last_input_index_(zone->NewArray<int>(bytecode.length()),
+                             bytecode.length()),
+        active_threads_(0, zone),
+        blocked_threads_(0, zone),
+        free_register_arrays_(0, zone),
+        best_match_registers_(nullptr),
+        zone_(zone) {
+    DCHECK(!bytecode_.empty());
+    DCHECK_GE(input_index_, 0);
+    DCHECK_LE(input_index_, input_.length());
+
+    std::fill(pc_last_input_index_.begin(), pc_last_input_index_.end(), -1);
+  }
+
+  // Finds the leftmost match starting at the input index the interpreter was
+  // created with, and writes its registers to `output_registers`.  Returns 1
+  // if a match was found, and 0 otherwise.
+  int FindMatch(Vector<int> output_registers) {
+    DCHECK_GE(output_registers.length(), register_count_per_match_);
+
+    // The initial thread starts at the first instruction with all registers
+    // cleared.
+    InterpreterThread initial_thread = NewEmptyThread(0);
+    active_threads_.Add(initial_thread, zone_);
+
+    RunActiveThreads();
+
+    // Feed one character at a time to the blocked threads until no thread of
+    // higher priority than the best match so far is left.
+    while (!blocked_threads_.is_empty() &&
+           input_index_ != input_.length()) {
+      Character input_char = input_[input_index_];
+      ++input_index_;
+
+      // We unblock all blocked_threads_ by feeding them the input char.
+      FlushBlockedThreads(input_char);
+
+      // Run all threads until they block or accept.
+      RunActiveThreads();
+    }
+
+    // Threads that are still blocked at the end of the input can't make
+    // progress anymore.
+    for (InterpreterThread t : blocked_threads_) {
+      DestroyThread(t);
+    }
+    blocked_threads_.Rewind(0);
+
+    if (best_match_registers_ == nullptr) return 0;
+
+    std::copy(best_match_registers_,
+              best_match_registers_ + register_count_per_match_,
+              output_registers.begin());
+    FreeRegisterArray(best_match_registers_);
+    best_match_registers_ = nullptr;
+    return 1;
+  }
+
+ private:
+  // The state of a "thread" executing experimental regexp bytecode.  (Not to
+  // be confused with an OS thread.)
+  struct InterpreterThread {
+    // This thread's program counter, i.e. the index within `bytecode_` of the
+    // next instruction to be executed.
+    int pc;
+    // Pointer to the array of registers, which is always size
+    // `register_count_per_match_`.  Should be deallocated with
+    // `FreeRegisterArray`.
+    int* register_array_begin;
+  };
+
+  // Handles instructions of a thread until it blocks on a CONSUME_RANGE
+  // instruction, executes ACCEPT or dies.
+  void RunActiveThread(InterpreterThread t) {
+    while (true) {
+      if (IsPcProcessed(t.pc)) {
+        // A thread of higher priority already executed this instruction at
+        // the current input position, so this thread can only produce the
+        // same matches with lower priority.
+        DestroyThread(t);
+        return;
+      }
+      MarkPcProcessed(t.pc);
+
+      RegExpInstruction inst = bytecode_[t.pc];
+      switch (inst.opcode) {
+        case RegExpInstruction::CONSUME_RANGE: {
+          blocked_threads_.Add(t, zone_);
+          return;
+        }
+        case RegExpInstruction::ASSERTION:
+          if (!SatisfiesAssertion(inst.payload.assertion_type, input_,
+                                  input_index_)) {
+            DestroyThread(t);
+            return;
+          }
+          ++t.pc;
+          break;
+        case RegExpInstruction::FORK: {
+          InterpreterThread fork = NewUninitializedThread(inst.payload.pc);
+          std::copy(t.register_array_begin,
+                    t.register_array_begin + register_count_per_match_,
+                    fork.register_array_begin);
+          active_threads_.Add(fork, zone_);
+          ++t.pc;
+          break;
+        }
+        case RegExpInstruction::JMP:
+          t.pc = inst.payload.pc;
+          break;
+        case RegExpInstruction::ACCEPT:
+          if (best_match_registers_ != nullptr) {
+            FreeRegisterArray(best_match_registers_);
+          }
+          best_match_registers_ = t.register_array_begin;
+
+          // All remaining active threads have lower priority than `t`.
+          for (InterpreterThread s : active_threads_) {
+            DestroyThread(s);
+          }
+          active_threads_.Rewind(0);
+          return;
+        case RegExpInstruction::SET_REGISTER_TO_CP:
+          t.register_array_begin[inst.payload.register_index] = input_index_;
+          ++t.pc;
+          break;
+        case RegExpInstruction::CLEAR_REGISTER:
+          t.register_array_begin[inst.payload.register_index] = -1;
+          ++t.pc;
+          break;
+      }
+    }
+  }
+
+  // Runs each active thread until it can't continue without further input.
+  // `active_threads_` is empty afterwards.  `blocked_threads_` are sorted from
+  // high to low priority.
+  void RunActiveThreads() {
+    while (!active_threads_.is_empty()) {
+      RunActiveThread(active_threads_.RemoveLast());
+    }
+  }
+
+  // Unblocks all blocked_threads_ by feeding them an `input_char`.  Should
+  // only be called with `input_index_` pointing to the character *after*
+  // `input_char` so that `pc_last_input_index_` is updated correctly.
+  void FlushBlockedThreads(Character input_char) {
+    // The threads in blocked_threads_ are sorted from high to low priority,
+    // but active_threads_ needs to be sorted from low to high priority, so we
+    // need to activate blocked threads in reverse order.
+    for (int i = blocked_threads_.length() - 1; i >= 0; --i) {
+      InterpreterThread t = blocked_threads_[i];
+      RegExpInstruction inst = bytecode_[t.pc];
+      DCHECK_EQ(inst.opcode, RegExpInstruction::CONSUME_RANGE);
+      RegExpInstruction::Uc16Range range = inst.payload.consume_range;
+      if (input_char >= range.min && input_char <= range.max) {
+        ++t.pc;
+        active_threads_.Add(t, zone_);
+      } else {
+        DestroyThread(t);
+      }
+    }
+    blocked_threads_.Rewind(0);
+  }
+
+  bool IsPcProcessed(int pc) {
+    return pc_last_input_index_[pc] == input_index_;
+  }
+
+  void MarkPcProcessed(int pc) { pc_last_input_index_[pc] = input_index_; }
+
+  int* NewRegisterArrayUninitialized() {
+    if (!free_register_arrays_.is_empty()) {
+      return free_register_arrays_.RemoveLast();
+    }
+    return zone_->NewArray<int>(register_count_per_match_);
+  }
+
+  void FreeRegisterArray(int* register_array_begin) {
+    free_register_arrays_.Add(register_array_begin, zone_);
+  }
+
+  InterpreterThread NewUninitializedThread(int pc) {
+    return InterpreterThread{pc, NewRegisterArrayUninitialized()};
+  }
+
+  InterpreterThread NewEmptyThread(int pc) {
+    InterpreterThread t = NewUninitializedThread(pc);
+    std::fill(t.register_array_begin,
+              t.register_array_begin + register_count_per_match_, -1);
+    return t;
+  }
+
+  void DestroyThread(InterpreterThread t) {
+    FreeRegisterArray(t.register_array_begin);
+  }
+
+  Vector<const RegExpInstruction> bytecode_;
+
+  // Number of registers used per thread.
+  const int register_count_per_match_;
+
+  Vector<const Character> input_;
+  int input_index_;
+
+  // pc_last_input_index_[k] records the value of input_index_ the last
+  // time a thread t such that t.pc == k was activated, i.e. put on
+  // active_threads_.  Thus pc_last_input_index.size() == bytecode.size().  See
+  // also `RunActiveThread`.
+  Vector<int> pc_last_input_index_;
+
+  // Active threads can potentially (but not necessarily) continue without
+  // input.  Sorted from low to high priority.
+  ZoneList<InterpreterThread> active_threads_;
+
+  // The pc of a blocked thread points to an instruction that consumes a
+  // character. Sorted from high to low priority (so the opposite of
+  // `active_threads_`).
+  ZoneList<InterpreterThread> blocked_threads_;
+
+  // Register arrays of destroyed threads, for reuse by new threads.
+  ZoneList<int*> free_register_arrays_;
+
+  // The register array of the best match found so far, or nullptr if no
+  // match has been found yet.
+  int* best_match_registers_;
+
+  Zone* zone_;
+};
+
+}  // namespace
+
+int ExperimentalRegExpInterpreter::FindMatch(
+    Vector<const RegExpInstruction> bytecode, int register_count_per_match,
+    Vector<const uint8_t> input, int input_index,
+    Vector<int> output_registers, Zone* zone) {
+  NfaInterpreter<uint8_t> interpreter(bytecode, register_count_per_match,
+                                      input, input_index, zone);
+  return interpreter.FindMatch(output_registers);
+}
+
+int ExperimentalRegExpInterpreter::FindMatch(
+    Vector<const RegExpInstruction> bytecode, int register_count_per_match,
+    Vector<const uc16> input, int input_index, Vector<int> output_registers,
+    Zone* zone) {
+  NfaInterpreter<uc16> interpreter(bytecode, register_count_per_match, input,
+                                   input_index, zone);
+  return interpreter.FindMatch(output_registers);
+}
+
+}  // namespace internal
+}  // namespace v8
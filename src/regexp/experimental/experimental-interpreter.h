@@ -0,0 +1,36 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
+
+#include "src/regexp/experimental/experimental-bytecode.h"
+#include "src/utils/vector.h"
+
+namespace v8 {
+namespace internal {
+
+class Zone;
+
+class ExperimentalRegExpInterpreter final : public AllStatic {
+ public:
+  // Executes a bytecode program in breadth-first NFA mode, without
+  // backtracking, to find the leftmost match in `input` starting at
+  // `input_index`.  Returns 1 and stores the registers of the match in
+  // `output_registers` if a match is found, and returns 0 otherwise.  The
+  // running time is O(input.length() * bytecode.length()).
+  static int FindMatch(Vector<const RegExpInstruction> bytecode,
+                       int register_count_per_match,
+                       Vector<const uint8_t> input, int input_index,
+                       Vector<int> output_registers, Zone* zone);
+  static int FindMatch(Vector<const RegExpInstruction> bytecode,
+                       int register_count_per_match,
+                       Vector<const uc16> input, int input_index,
+                       Vector<int> output_registers, Zone* zone);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_INTERPRETER_H_
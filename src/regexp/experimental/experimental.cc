@@ -0,0 +1,222 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/regexp/experimental/experimental.h"
+
+#include <memory>
+#include <type_traits>
+
+#include "src/objects/js-regexp-inl.h"
+#include "src/regexp/experimental/experimental-compiler.h"
+#include "src/regexp/experimental/experimental-interpreter.h"
+#include "src/regexp/regexp-parser.h"
+#include "src/utils/ostreams.h"
+
+namespace v8 {
+namespace internal {
+
+bool ExperimentalRegExp::CanBeHandled(RegExpTree* tree, JSRegExp::Flags flags,
+                                      int capture_count) {
+  return ExperimentalRegExpCompiler::CanBeHandled(tree, flags, capture_count);
+}
+
+namespace {
+
+Handle<ByteArray> VectorToByteArray(Isolate* isolate,
+                                    Vector<RegExpInstruction> instructions) {
+  STATIC_ASSERT(std::is_trivially_copyable<RegExpInstruction>::value);
+
+  int byte_length = sizeof(RegExpInstruction) * instructions.length();
+  Handle<ByteArray> byte_array = isolate->factory()->NewByteArray(byte_length);
+  MemCopy(byte_array->GetDataStartAddress(), instructions.begin(),
+          byte_length);
+  return byte_array;
+}
+
+Vector<const RegExpInstruction> AsInstructionSequence(ByteArray raw_bytes) {
+  RegExpInstruction* inst_begin =
+      reinterpret_cast<RegExpInstruction*>(raw_bytes.GetDataStartAddress());
+  int inst_num = raw_bytes.length() / sizeof(RegExpInstruction);
+  DCHECK_EQ(sizeof(RegExpInstruction) * inst_num, raw_bytes.length());
+  return Vector<const RegExpInstruction>(inst_begin, inst_num);
+}
+
+void TraceCompilation(Handle<String> pattern,
+                      Vector<const RegExpInstruction> bytecode) {
+  StdoutStream os;
+  os << "Compiling experimental regexp " << pattern->ToCString().get()
+     << " to bytecode:" << std::endl
+     << bytecode;
+}
+
+int32_t ExecRawImpl(Isolate* isolate, Vector<const RegExpInstruction> bytecode,
+                    String subject, int capture_count,
+                    int32_t* output_registers, int32_t output_register_count,
+                    int32_t subject_index) {
+  DisallowHeapAllocation no_gc;
+
+  int register_count_per_match =
+      JSRegExp::RegistersForCaptureCount(capture_count);
+  DCHECK_GE(output_register_count, register_count_per_match);
+  USE(output_register_count);
+  Vector<int> output(output_registers, register_count_per_match);
+
+  // The interpreter only allocates in the zone, never on the JS heap.
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  String::FlatContent content = subject.GetFlatContent(no_gc);
+  DCHECK(content.IsFlat());
+  if (content.IsOneByte()) {
+    return ExperimentalRegExpInterpreter::FindMatch(
+        bytecode, register_count_per_match, content.ToOneByteVector(),
+        subject_index, output, &zone);
+  } else {
+    return ExperimentalRegExpInterpreter::FindMatch(
+        bytecode, register_count_per_match, content.ToUC16Vector(),
+        subject_index, output, &zone);
+  }
+}
+
+// Executes `exec_raw` with a sufficiently large register array and turns its
+// result into a match info or null.
+template <typename ExecRawFunction>
+MaybeHandle<Object> ExecWithRegisters(Isolate* isolate, Handle<String> subject,
+                                      int capture_count,
+                                      Handle<RegExpMatchInfo> last_match_info,
+                                      ExecRawFunction exec_raw) {
+  int output_register_count = JSRegExp::RegistersForCaptureCount(capture_count);
+  int32_t* output_registers = nullptr;
+  if (output_register_count > Isolate::kJSRegexpStaticOffsetsVectorSize) {
+    output_registers = NewArray<int32_t>(output_register_count);
+  }
+  std::unique_ptr<int32_t[]> auto_release(output_registers);
+  if (output_registers == nullptr) {
+    output_registers = isolate->jsregexp_static_offsets_vector();
+  }
+
+  int32_t result = exec_raw(output_registers, output_register_count);
+  if (result == RegExp::kInternalRegExpSuccess) {
+    return RegExp::SetLastMatchInfo(isolate, last_match_info, subject,
+                                    capture_count, output_registers);
+  }
+  if (result == RegExp::kInternalRegExpException) {
+    DCHECK(isolate->has_pending_exception());
+    return MaybeHandle<Object>();
+  }
+  DCHECK_EQ(result, RegExp::kInternalRegExpFailure);
+  return isolate->factory()->null_value();
+}
+
+}  // namespace
+
+void ExperimentalRegExp::Initialize(Isolate* isolate, Handle<JSRegExp> re,
+                                    Handle<String> pattern,
+                                    JSRegExp::Flags flags,
+                                    RegExpCompileData* parse_result) {
+  DCHECK(CanBeHandled(parse_result->tree, flags, parse_result->capture_count));
+
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  ZoneList<RegExpInstruction> bytecode =
+      ExperimentalRegExpCompiler::Compile(parse_result->tree, flags, &zone);
+  if (FLAG_trace_experimental_regexp_engine) {
+    TraceCompilation(pattern, bytecode.ToConstVector());
+  }
+
+  // The bytecode doesn't depend on the subject representation, so the same
+  // array is stored in both bytecode slots.  The code slots stay
+  // uninitialized.
+  Handle<ByteArray> bytecode_array =
+      VectorToByteArray(isolate, bytecode.ToVector());
+  isolate->factory()->SetRegExpIrregexpData(
+      re, JSRegExp::EXPERIMENTAL, pattern, flags, parse_result->capture_count,
+      JSRegExp::kNoBacktrackLimit);
+  re->SetDataAt(JSRegExp::kIrregexpLatin1BytecodeIndex, *bytecode_array);
+  re->SetDataAt(JSRegExp::kIrregexpUC16BytecodeIndex, *bytecode_array);
+  if (parse_result->capture_name_map.is_null()) {
+    re->SetDataAt(JSRegExp::kIrregexpCaptureNameMapIndex, Smi::zero());
+  } else {
+    re->SetDataAt(JSRegExp::kIrregexpCaptureNameMapIndex,
+                  *parse_result->capture_name_map);
+  }
+}
+
+int32_t ExperimentalRegExp::ExecRaw(Isolate* isolate, JSRegExp regexp,
+                                    String subject, int32_t* output_registers,
+                                    int32_t output_register_count,
+                                    int32_t subject_index) {
+  DCHECK_EQ(regexp.TypeTag(), JSRegExp::EXPERIMENTAL);
+  DisallowHeapAllocation no_gc;
+
+  ByteArray bytecode =
+      ByteArray::cast(regexp.DataAt(JSRegExp::kIrregexpLatin1BytecodeIndex));
+  return ExecRawImpl(isolate, AsInstructionSequence(bytecode), subject,
+                     regexp.CaptureCount(), output_registers,
+                     output_register_count, subject_index);
+}
+
+MaybeHandle<Object> ExperimentalRegExp::Exec(
+    Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+    int index, Handle<RegExpMatchInfo> last_match_info) {
+  DCHECK_EQ(regexp->TypeTag(), JSRegExp::EXPERIMENTAL);
+
+  subject = String::Flatten(isolate, subject);
+  return ExecWithRegisters(
+      isolate, subject, regexp->CaptureCount(), last_match_info,
+      [&](int32_t* output_registers, int32_t output_register_count) {
+        return ExecRaw(isolate, *regexp, *subject, output_registers,
+                       output_register_count, index);
+      });
+}
+
+int32_t ExperimentalRegExp::OneshotExecRaw(Isolate* isolate,
+                                           Handle<JSRegExp> regexp,
+                                           Handle<String> subject,
+                                           int32_t* output_registers,
+                                           int32_t output_register_count,
+                                           int32_t subject_index) {
+  DCHECK(FLAG_enable_experimental_regexp_engine_on_excessive_backtracks);
+  DCHECK(subject->IsFlat());
+
+  Zone zone(isolate->allocator(), ZONE_NAME);
+  Handle<String> pattern(regexp->Pattern(), isolate);
+  JSRegExp::Flags flags = regexp->GetFlags();
+
+  RegExpCompileData parse_result;
+  FlatStringReader reader(isolate, pattern);
+  DCHECK(!isolate->has_pending_exception());
+  if (!RegExpParser::ParseRegExp(isolate, &zone, &reader, flags,
+                                 &parse_result)) {
+    // The pattern was already parsed successfully when the regexp was
+    // created, so this can only fail because of a stack overflow.
+    DCHECK_EQ(parse_result.error, RegExpError::kStackOverflow);
+    USE(RegExp::ThrowRegExpException(isolate, regexp, pattern,
+                                     parse_result.error));
+    return RegExp::kInternalRegExpException;
+  }
+  DCHECK(CanBeHandled(parse_result.tree, flags, parse_result.capture_count));
+
+  ZoneList<RegExpInstruction> bytecode =
+      ExperimentalRegExpCompiler::Compile(parse_result.tree, flags, &zone);
+  if (FLAG_trace_experimental_regexp_engine) {
+    TraceCompilation(pattern, bytecode.ToConstVector());
+  }
+
+  return ExecRawImpl(isolate, bytecode.ToConstVector(), *subject,
+                     parse_result.capture_count, output_registers,
+                     output_register_count, subject_index);
+}
+
+MaybeHandle<Object> ExperimentalRegExp::OneshotExec(
+    Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+    int index, Handle<RegExpMatchInfo> last_match_info) {
+  subject = String::Flatten(isolate, subject);
+  return ExecWithRegisters(
+      isolate, subject, regexp->CaptureCount(), last_match_info,
+      [&](int32_t* output_registers, int32_t output_register_count) {
+        return OneshotExecRaw(isolate, regexp, subject, output_registers,
+                              output_register_count, index);
+      });
+}
+
+}  // namespace internal
+}  // namespace v8
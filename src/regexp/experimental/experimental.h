@@ -0,0 +1,65 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
+#define V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
+
+#include "src/regexp/regexp-ast.h"
+#include "src/regexp/regexp.h"
+
+namespace v8 {
+namespace internal {
+
+// Entry points of the linear-time experimental regexp engine.  Regexps run on
+// this engine if they carry the 'l' flag, if
+// --default-to-experimental-regexp-engine is set, or (one execution at a
+// time) if irregexp exceeds --regexp-backtracks-before-fallback with
+// --enable-experimental-regexp-engine-on-excessive-backtracks.
+class ExperimentalRegExp final : public AllStatic {
+ public:
+  // Initialization & Compilation
+  // -------------------------------------------------------------------------
+  // Checks whether a parsed regexp pattern can be compiled and executed by
+  // the experimental engine.
+  static bool CanBeHandled(RegExpTree* tree, JSRegExp::Flags flags,
+                           int capture_count);
+  // Compiles the parsed pattern to bytecode and stores it in `re`, which is
+  // tagged EXPERIMENTAL afterwards.
+  static void Initialize(Isolate* isolate, Handle<JSRegExp> re,
+                         Handle<String> pattern, JSRegExp::Flags flags,
+                         RegExpCompileData* parse_result);
+
+  // Execution:
+  // Returns RegExp::kInternalRegExpSuccess and writes the capture registers
+  // of the leftmost match at or after `subject_index` to `output_registers`,
+  // or returns RegExp::kInternalRegExpFailure.  `subject` must be flat.
+  static int32_t ExecRaw(Isolate* isolate, JSRegExp regexp, String subject,
+                         int32_t* output_registers,
+                         int32_t output_register_count, int32_t subject_index);
+  // As above, but sets the last match info and returns the match info or
+  // null.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> Exec(
+      Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+      int index, Handle<RegExpMatchInfo> last_match_info);
+
+  // Compile and execute a regexp with the experimental engine, regardless of
+  // its type tag.  The regexp itself is not changed and the bytecode is
+  // discarded afterwards.  This is used after an irregexp execution gave up
+  // because of excessive backtracking.  Returns
+  // RegExp::kInternalRegExpException if reparsing the pattern overflowed the
+  // stack.
+  static int32_t OneshotExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
+                                Handle<String> subject,
+                                int32_t* output_registers,
+                                int32_t output_register_count,
+                                int32_t subject_index);
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> OneshotExec(
+      Isolate* isolate, Handle<JSRegExp> regexp, Handle<String> subject,
+      int index, Handle<RegExpMatchInfo> last_match_info);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_REGEXP_EXPERIMENTAL_EXPERIMENTAL_H_
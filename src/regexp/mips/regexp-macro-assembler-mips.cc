@@ -128,6 +128,7 @@ RegExpMacroAssemblerMIPS::~RegExpMacroAssemblerMIPS() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_label_.Unuse();
   internal_failure_label_.Unuse();
 }
 
@@ -165,8 +166,12 @@ void RegExpMacroAssemblerMIPS::Backtrack() {
     __ Sw(a0, MemOperand(frame_pointer(), kBacktrackCount));
     __ Branch(&next, ne, a0, Operand(backtrack_limit()));
 
-    // Exceeded limits are treated as a failed match.
-    Fail();
+    if (can_fallback()) {
+      __ jmp(&fallback_label_);
+    } else {
+      // Exceeded limits are treated as a failed match.
+      Fail();
+    }
 
     __ bind(&next);
   }
@@ -910,6 +915,12 @@ Handle<HeapObject> RegExpMacroAssemblerMIPS::GetCode(Handle<String> source) {
       __ li(v0, Operand(EXCEPTION));
       __ jmp(&return_v0);
     }
+
+    if (fallback_label_.is_linked()) {
+      __ bind(&fallback_label_);
+      __ li(v0, Operand(FALLBACK_TO_EXPERIMENTAL));
+      __ jmp(&return_v0);
+    }
   }
 
   CodeDesc code_desc;
@@ -215,6 +215,7 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerMIPS
   Label exit_label_;
   Label check_preempt_label_;
   Label stack_overflow_label_;
+  Label fallback_label_;
   Label internal_failure_label_;
 };
 
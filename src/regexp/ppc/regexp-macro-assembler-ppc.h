@@ -196,6 +196,7 @@ class V8_EXPORT_PRIVATE RegExpMacroAssemblerPPC
   Label exit_label_;
   Label check_preempt_label_;
   Label stack_overflow_label_;
+  Label fallback_label_;
   Label internal_failure_label_;
 };
 
@@ -2843,6 +2843,7 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   // contains precisely one character.
   bool found_single_character = false;
   int single_character = 0;
+  int single_character_offset = 0;
   for (int i = max_lookahead; i >= min_lookahead; i--) {
     BoyerMoorePositionInfo* map = bitmaps_->at(i);
     if (map->map_count() == 0) continue;
@@ -2857,6 +2858,7 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
 
     found_single_character = true;
     single_character = BitsetFirstSetBit(map->raw_bitset());
+    single_character_offset = i;
 
     DCHECK_NE(single_character, -1);
   }
@@ -2869,6 +2871,16 @@ void BoyerMooreLookahead::EmitSkipInstructions(RegExpMacroAssembler* masm) {
   }
 
   if (found_single_character) {
+    // If the single character is the last one in the lookahead, every match
+    // has to have it there, so any position where it is not can be skipped.
+    // That lets the assembler scan for it in bulk.
+    unsigned mask = max_char_ > kSize ? RegExpMacroAssembler::kTableMask
+                                      : String::kMaxUtf16CodeUnit;
+    if (single_character_offset == max_lookahead &&
+        masm->SkipUntilCharacterAfterAnd(max_lookahead, single_character,
+                                         mask)) {
+      return;
+    }
     Label cont, again;
     masm->Bind(&again);
     masm->LoadCurrentCharacter(max_lookahead, &cont, true);
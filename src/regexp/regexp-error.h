@@ -41,7 +41,8 @@ namespace internal {
   T(InvalidClassPropertyName, "Invalid property name in character class") \
   T(InvalidCharacterClass, "Invalid character class")                     \
   T(UnterminatedCharacterClass, "Unterminated character class")           \
-  T(OutOfOrderCharacterClass, "Range out of order in character class")
+  T(OutOfOrderCharacterClass, "Range out of order in character class")    \
+  T(NotLinear, "Cannot be executed in linear time")
 
 enum class RegExpError : uint32_t {
 #define TEMPLATE(NAME, STRING) k##NAME,
@@ -319,6 +319,25 @@ bool IndexIsInBounds(int index, int length) {
   return static_cast<uintptr_t>(index) < static_cast<uintptr_t>(length);
 }
 
+// Returns the index of the first occurrence of c in subject at or after from,
+// or the subject length if there is none.
+int FindCharacter(Vector<const uint8_t> subject, int from, uint32_t c) {
+  DCHECK(IndexIsInBounds(from, subject.length()));
+  if (c > String::kMaxOneByteCharCode) return subject.length();
+  const void* found = memchr(subject.begin() + from, static_cast<int>(c),
+                             subject.length() - from);
+  if (found == nullptr) return subject.length();
+  return static_cast<int>(static_cast<const uint8_t*>(found) - subject.begin());
+}
+
+int FindCharacter(Vector<const uc16> subject, int from, uint32_t c) {
+  DCHECK(IndexIsInBounds(from, subject.length()));
+  for (int i = from; i < subject.length(); i++) {
+    if (subject[i] == c) return i;
+  }
+  return subject.length();
+}
+
 // If computed gotos are supported by the compiler, we can get addresses to
 // labels directly in C/C++. Every bytecode handler has its own label and we
 // store the addresses in a dispatch table indexed by bytecode. To execute the
@@ -524,6 +543,12 @@ IrregexpInterpreter::Result RawMatch(
         // Exceeded limits are treated as a failed match.
         return IrregexpInterpreter::FAILURE;
       }
+      if (backtrack_count == FLAG_regexp_backtracks_before_fallback) {
+        int return_code = LoadPacked24Signed(insn);
+        if (return_code == RegExp::kInternalRegExpFallbackToExperimental) {
+          return IrregexpInterpreter::FALLBACK_TO_EXPERIMENTAL;
+        }
+      }
 
       IrregexpInterpreter::Result return_code =
           HandleInterrupts(isolate, call_origin, &code_array, &subject_string,
@@ -919,6 +944,20 @@ IrregexpInterpreter::Result RawMatch(
       int32_t load_offset = LoadPacked24Signed(insn);
       int32_t advance = Load16AlignedSigned(pc + 4);
       uint32_t c = Load16Aligned(pc + 6);
+      if (advance == 1 &&
+          IndexIsInBounds(current + load_offset, subject.length())) {
+        // Scanning one character at a time can use the library search, which
+        // is vectorized for one-byte subjects.
+        int index = FindCharacter(subject, current + load_offset, c);
+        SET_CURRENT_POSITION(index - load_offset);
+        if (index < subject.length()) {
+          current_char = c;
+          SET_PC_FROM_OFFSET(Load32Aligned(pc + 8));
+          DISPATCH();
+        }
+        SET_PC_FROM_OFFSET(Load32Aligned(pc + 12));
+        DISPATCH();
+      }
       while (IndexIsInBounds(current + load_offset, subject.length())) {
         current_char = subject[current + load_offset];
         if (c == current_char) {
@@ -1054,7 +1093,9 @@ IrregexpInterpreter::Result IrregexpInterpreter::Match(
     Isolate* isolate, JSRegExp regexp, String subject_string,
     int* output_registers, int output_register_count, int start_position,
     RegExp::CallOrigin call_origin) {
-  if (FLAG_regexp_tier_up) regexp.TierUpTick();
+  if (FLAG_regexp_tier_up) {
+    regexp.TierUpTick(subject_string.length() - start_position);
+  }
 
   bool is_one_byte = String::IsOneByteRepresentationUnderneath(subject_string);
   ByteArray code_array = ByteArray::cast(regexp.Bytecode(is_one_byte));
@@ -380,6 +380,17 @@ bool RegExpMacroAssemblerTracer::CheckSpecialCharacterClass(
   return supported;
 }
 
+bool RegExpMacroAssemblerTracer::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                            unsigned c,
+                                                            unsigned mask) {
+  bool supported = assembler_->SkipUntilCharacterAfterAnd(cp_offset, c, mask);
+  PrintF(
+      " SkipUntilCharacterAfterAnd(cp_offset=%d, c=0x%04x, mask=0x%04x): "
+      "%s;\n",
+      cp_offset, c, mask, supported ? "true" : "false");
+  return supported;
+}
+
 
 void RegExpMacroAssemblerTracer::IfRegisterLT(int register_index,
                                               int comparand, Label* if_lt) {
@@ -46,6 +46,8 @@ class RegExpMacroAssemblerTracer: public RegExpMacroAssembler {
   void CheckBitInTable(Handle<ByteArray> table, Label* on_bit_set) override;
   void CheckPosition(int cp_offset, Label* on_outside_input) override;
   bool CheckSpecialCharacterClass(uc16 type, Label* on_no_match) override;
+  bool SkipUntilCharacterAfterAnd(int cp_offset, unsigned c,
+                                  unsigned mask) override;
   void Fail() override;
   Handle<HeapObject> GetCode(Handle<String> source) override;
   void GoTo(Label* label) override;
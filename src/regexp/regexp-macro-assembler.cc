@@ -134,6 +134,12 @@ bool RegExpMacroAssembler::CheckSpecialCharacterClass(uc16 type,
   return false;
 }
 
+bool RegExpMacroAssembler::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                      unsigned c,
+                                                      unsigned mask) {
+  return false;
+}
+
 NativeRegExpMacroAssembler::NativeRegExpMacroAssembler(Isolate* isolate,
                                                        Zone* zone)
     : RegExpMacroAssembler(isolate, zone) {}
@@ -123,6 +123,14 @@ class RegExpMacroAssembler {
   // not have custom support.
   // May clobber the current loaded character.
   virtual bool CheckSpecialCharacterClass(uc16 type, Label* on_no_match);
+  // Advances the current position to the first position at or after it where
+  // the character at {cp_offset}, and'ed with {mask}, is {c}, or to where
+  // {cp_offset} is at the end of the input if there is no such position.
+  // Returns false, without emitting anything, if there is no custom support
+  // for scanning for characters in bulk.
+  // May clobber the current loaded character.
+  virtual bool SkipUntilCharacterAfterAnd(int cp_offset, unsigned c,
+                                          unsigned mask);
 
   // Control-flow integrity:
   // Define a jump target and bind a label.
@@ -187,6 +195,10 @@ class RegExpMacroAssembler {
     backtrack_limit_ = backtrack_limit;
   }
 
+  // Set whether or not exceeding the backtrack limit makes the generated code
+  // return FALLBACK_TO_EXPERIMENTAL instead of failing the match.
+  void set_can_fallback(bool val) { can_fallback_ = val; }
+
   enum GlobalMode {
     NOT_GLOBAL,
     GLOBAL_NO_ZERO_LENGTH_CHECK,
@@ -211,9 +223,12 @@ class RegExpMacroAssembler {
   }
   uint32_t backtrack_limit() const { return backtrack_limit_; }
 
+  bool can_fallback() const { return can_fallback_; }
+
  private:
   bool slow_safe_compiler_;
   uint32_t backtrack_limit_ = JSRegExp::kNoBacktrackLimit;
+  bool can_fallback_ = false;
   GlobalMode global_mode_;
   Isolate* isolate_;
   Zone* zone_;
@@ -233,11 +248,14 @@ class NativeRegExpMacroAssembler: public RegExpMacroAssembler {
   // FAILURE: Matching failed.
   // SUCCESS: Matching succeeded, and the output array has been filled with
   //        capture positions.
+  // FALLBACK_TO_EXPERIMENTAL: Execution exceeded the backtrack limit and the
+  //        match should be computed by the experimental engine instead.
   enum Result {
     FAILURE = RegExp::kInternalRegExpFailure,
     SUCCESS = RegExp::kInternalRegExpSuccess,
     EXCEPTION = RegExp::kInternalRegExpException,
     RETRY = RegExp::kInternalRegExpRetry,
+    FALLBACK_TO_EXPERIMENTAL = RegExp::kInternalRegExpFallbackToExperimental,
   };
 
   NativeRegExpMacroAssembler(Isolate* isolate, Zone* zone);
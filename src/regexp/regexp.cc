@@ -8,6 +8,7 @@
 #include "src/diagnostics/code-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/objects/js-regexp-inl.h"
+#include "src/regexp/experimental/experimental.h"
 #include "src/regexp/regexp-bytecode-generator.h"
 #include "src/regexp/regexp-bytecodes.h"
 #include "src/regexp/regexp-compiler.h"
@@ -89,11 +90,11 @@ class RegExpImpl final : public AllStatic {
   static Code IrregexpNativeCode(FixedArray re, bool is_one_byte);
 };
 
-V8_WARN_UNUSED_RESULT
-static inline MaybeHandle<Object> ThrowRegExpException(Isolate* isolate,
-                                                       Handle<JSRegExp> re,
-                                                       Handle<String> pattern,
-                                                       RegExpError error) {
+// static
+MaybeHandle<Object> RegExp::ThrowRegExpException(Isolate* isolate,
+                                                 Handle<JSRegExp> re,
+                                                 Handle<String> pattern,
+                                                 RegExpError error) {
   Vector<const char> error_data = CStrVector(RegExpErrorString(error));
   Handle<String> error_text =
       isolate->factory()
@@ -107,8 +108,8 @@ static inline MaybeHandle<Object> ThrowRegExpException(Isolate* isolate,
 
 inline void ThrowRegExpException(Isolate* isolate, Handle<JSRegExp> re,
                                  RegExpError error_text) {
-  USE(ThrowRegExpException(isolate, re, Handle<String>(re->Pattern(), isolate),
-                           error_text));
+  USE(RegExp::ThrowRegExpException(
+      isolate, re, Handle<String>(re->Pattern(), isolate), error_text));
 }
 
 // Identifies the sort of regexps where the regexp engine is faster
@@ -173,7 +174,22 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
 
   bool has_been_compiled = false;
 
-  if (parse_result.simple && !IgnoreCase(flags) && !IsSticky(flags) &&
+  if (flags & JSRegExp::kLinear) {
+    // Regexps with the 'l' flag are guaranteed to run in linear time, so
+    // patterns the experimental engine can't handle are rejected.
+    if (!ExperimentalRegExp::CanBeHandled(parse_result.tree, flags,
+                                          parse_result.capture_count)) {
+      return ThrowRegExpException(isolate, re, pattern,
+                                  RegExpError::kNotLinear);
+    }
+    ExperimentalRegExp::Initialize(isolate, re, pattern, flags, &parse_result);
+    has_been_compiled = true;
+  } else if (FLAG_default_to_experimental_regexp_engine &&
+             ExperimentalRegExp::CanBeHandled(parse_result.tree, flags,
+                                              parse_result.capture_count)) {
+    ExperimentalRegExp::Initialize(isolate, re, pattern, flags, &parse_result);
+    has_been_compiled = true;
+  } else if (parse_result.simple && !IgnoreCase(flags) && !IsSticky(flags) &&
       !HasFewDifferentCharacters(pattern)) {
     // Parse-tree is a single atom that is equal to the pattern.
     RegExpImpl::AtomCompile(isolate, re, pattern, flags, pattern);
@@ -207,7 +223,9 @@ MaybeHandle<Object> RegExp::Compile(Isolate* isolate, Handle<JSRegExp> re,
 }
 
 // static
-MaybeHandle<Object> RegExp::Exec(Isolate* isolate, Handle<JSRegExp> regexp,
+namespace {
+
+MaybeHandle<Object> ExecUncached(Isolate* isolate, Handle<JSRegExp> regexp,
                                  Handle<String> subject, int index,
                                  Handle<RegExpMatchInfo> last_match_info) {
   switch (regexp->TypeTag()) {
@@ -218,11 +236,88 @@ MaybeHandle<Object> RegExp::Exec(Isolate* isolate, Handle<JSRegExp> regexp,
       return RegExpImpl::IrregexpExec(isolate, regexp, subject, index,
                                       last_match_info);
     }
+    case JSRegExp::EXPERIMENTAL: {
+      return ExperimentalRegExp::Exec(isolate, regexp, subject, index,
+                                      last_match_info);
+    }
     default:
       UNREACHABLE();
   }
 }
 
+// An execution starting at index 0 only depends on the regexp data and the
+// subject, so its outcome can be reused for repeated executions on the same
+// internalized subject.  Atom regexps are cheap enough to not bother.
+// Regexps marked for tier-up enter the runtime to be recompiled, which a
+// cache hit would skip.
+bool CanUseExecCache(JSRegExp regexp, String subject, int index) {
+  return index == 0 && subject.IsInternalizedString() &&
+         (regexp.TypeTag() == JSRegExp::IRREGEXP ||
+          regexp.TypeTag() == JSRegExp::EXPERIMENTAL) &&
+         !regexp.MarkedForTierUp();
+}
+
+MaybeHandle<Object> LookupExecCache(Isolate* isolate, Handle<JSRegExp> regexp,
+                                    Handle<String> subject,
+                                    Handle<RegExpMatchInfo> last_match_info) {
+  FixedArray unused;
+  Object cached = RegExpResultsCache::Lookup(
+      isolate->heap(), *subject, regexp->data(), &unused,
+      RegExpResultsCache::REGEXP_EXEC_REGISTERS);
+  if (!cached.IsFixedArray()) return MaybeHandle<Object>();
+
+  Handle<FixedArray> registers(FixedArray::cast(cached), isolate);
+  if (registers->length() == 0) return isolate->factory()->null_value();
+  DCHECK_EQ(registers->length(),
+            JSRegExp::RegistersForCaptureCount(regexp->CaptureCount()));
+  Handle<RegExpMatchInfo> result = RegExp::SetLastMatchInfo(
+      isolate, last_match_info, subject, regexp->CaptureCount(), nullptr);
+  for (int i = 0; i < registers->length(); i++) {
+    result->SetCapture(i, Smi::ToInt(registers->get(i)));
+  }
+  return result;
+}
+
+void EnterExecCache(Isolate* isolate, Handle<JSRegExp> regexp,
+                    Handle<String> subject, Handle<Object> result) {
+  Factory* factory = isolate->factory();
+  Handle<FixedArray> registers = factory->empty_fixed_array();
+  if (!result->IsNull(isolate)) {
+    Handle<RegExpMatchInfo> match_info = Handle<RegExpMatchInfo>::cast(result);
+    int register_count =
+        JSRegExp::RegistersForCaptureCount(regexp->CaptureCount());
+    registers = factory->NewFixedArray(register_count);
+    for (int i = 0; i < register_count; i++) {
+      registers->set(i, Smi::FromInt(match_info->Capture(i)));
+    }
+  }
+  RegExpResultsCache::Enter(isolate, subject, handle(regexp->data(), isolate),
+                            registers, factory->empty_fixed_array(),
+                            RegExpResultsCache::REGEXP_EXEC_REGISTERS);
+}
+
+}  // namespace
+
+MaybeHandle<Object> RegExp::Exec(Isolate* isolate, Handle<JSRegExp> regexp,
+                                 Handle<String> subject, int index,
+                                 Handle<RegExpMatchInfo> last_match_info) {
+  if (CanUseExecCache(*regexp, *subject, index)) {
+    Handle<Object> cached;
+    if (LookupExecCache(isolate, regexp, subject, last_match_info)
+            .ToHandle(&cached)) {
+      return cached;
+    }
+    Handle<Object> result;
+    ASSIGN_RETURN_ON_EXCEPTION(
+        isolate, result,
+        ExecUncached(isolate, regexp, subject, index, last_match_info),
+        Object);
+    EnterExecCache(isolate, regexp, subject, result);
+    return result;
+  }
+  return ExecUncached(isolate, regexp, subject, index, last_match_info);
+}
+
 // RegExp Atom implementation: Simple string search using indexOf.
 
 void RegExpImpl::AtomCompile(Isolate* isolate, Handle<JSRegExp> re,
@@ -397,7 +492,8 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                  &compile_data)) {
     // Throw an exception if we fail to parse the pattern.
     // THIS SHOULD NOT HAPPEN. We already pre-parsed it successfully once.
-    USE(ThrowRegExpException(isolate, re, pattern, compile_data.error));
+    USE(RegExp::ThrowRegExpException(isolate, re, pattern,
+                                     compile_data.error));
     return false;
   }
   // The compilation target is a kBytecode if we're interpreting all regexp
@@ -537,6 +633,10 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
                       RegExp::RE_FAILURE);
         STATIC_ASSERT(static_cast<int>(NativeRegExpMacroAssembler::EXCEPTION) ==
                       RegExp::RE_EXCEPTION);
+        STATIC_ASSERT(
+            static_cast<int>(
+                NativeRegExpMacroAssembler::FALLBACK_TO_EXPERIMENTAL) ==
+            RegExp::RE_FALLBACK_TO_EXPERIMENTAL);
         return res;
       }
       // If result is RETRY, the string has changed representation, and we
@@ -562,6 +662,7 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
         case IrregexpInterpreter::SUCCESS:
         case IrregexpInterpreter::EXCEPTION:
         case IrregexpInterpreter::FAILURE:
+        case IrregexpInterpreter::FALLBACK_TO_EXPERIMENTAL:
           return result;
         case IrregexpInterpreter::RETRY:
           // The string has changed representation, and we must restart the
@@ -632,6 +733,10 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
     return RegExp::SetLastMatchInfo(isolate, last_match_info, subject,
                                     capture_count, output_registers);
   }
+  if (res == RegExp::RE_FALLBACK_TO_EXPERIMENTAL) {
+    return ExperimentalRegExp::OneshotExec(isolate, regexp, subject,
+                                           previous_index, last_match_info);
+  }
   if (res == RegExp::RE_EXCEPTION) {
     DCHECK(isolate->has_pending_exception());
     return MaybeHandle<Object>();
@@ -791,6 +896,20 @@ bool RegExpImpl::Compile(Isolate* isolate, Zone* zone, RegExpCompileData* data,
   }
 
   macro_assembler->set_slow_safe(TooMuchRegExpCode(isolate, pattern));
+  if (FLAG_enable_experimental_regexp_engine_on_excessive_backtracks &&
+      ExperimentalRegExp::CanBeHandled(data->tree, flags,
+                                       data->capture_count)) {
+    if (backtrack_limit == JSRegExp::kNoBacktrackLimit) {
+      backtrack_limit = FLAG_regexp_backtracks_before_fallback;
+    } else {
+      backtrack_limit =
+          Min(backtrack_limit, FLAG_regexp_backtracks_before_fallback);
+    }
+    // A user-specified limit below the fallback threshold keeps its
+    // semantics of failing the match.
+    macro_assembler->set_can_fallback(backtrack_limit ==
+                                      FLAG_regexp_backtracks_before_fallback);
+  }
   macro_assembler->set_backtrack_limit(backtrack_limit);
 
   // Inserted here, instead of in Assembler, because it depends on information
@@ -876,6 +995,12 @@ RegExpGlobalCache::RegExpGlobalCache(Handle<JSRegExp> regexp,
     registers_per_match_ = kAtomRegistersPerMatch;
     // There is no distinction between interpreted and native for atom regexps.
     interpreted = false;
+  } else if (regexp_->TypeTag() == JSRegExp::EXPERIMENTAL) {
+    // The experimental engine finds one match per call, like the
+    // interpreter.
+    registers_per_match_ =
+        JSRegExp::RegistersForCaptureCount(regexp_->CaptureCount());
+    interpreted = true;
   } else {
     registers_per_match_ = RegExp::IrregexpPrepare(isolate_, regexp_, subject_);
     if (registers_per_match_ < 0) {
@@ -961,9 +1086,20 @@ int32_t* RegExpGlobalCache::FetchNext() {
         num_matches_ = 0;  // Signal failed match.
         return nullptr;
       }
-      num_matches_ = RegExpImpl::IrregexpExecRaw(
-          isolate_, regexp_, subject_, last_end_index, register_array_,
-          register_array_size_);
+      if (regexp_->TypeTag() == JSRegExp::EXPERIMENTAL) {
+        num_matches_ = ExperimentalRegExp::ExecRaw(
+            isolate_, *regexp_, *subject_, register_array_,
+            register_array_size_, last_end_index);
+      } else {
+        num_matches_ = RegExpImpl::IrregexpExecRaw(
+            isolate_, regexp_, subject_, last_end_index, register_array_,
+            register_array_size_);
+        if (num_matches_ == RegExp::RE_FALLBACK_TO_EXPERIMENTAL) {
+          num_matches_ = ExperimentalRegExp::OneshotExecRaw(
+              isolate_, regexp_, subject_, register_array_,
+              register_array_size_, last_end_index);
+        }
+      }
     }
 
     if (num_matches_ <= 0) return nullptr;
@@ -993,6 +1129,9 @@ Object RegExpResultsCache::Lookup(Heap* heap, String key_string,
     DCHECK(key_pattern.IsString());
     if (!key_pattern.IsInternalizedString()) return Smi::zero();
     cache = heap->string_split_cache();
+  } else if (type == REGEXP_EXEC_REGISTERS) {
+    DCHECK(key_pattern.IsFixedArray());
+    cache = heap->regexp_exec_cache();
   } else {
     DCHECK(type == REGEXP_MULTIPLE_INDICES);
     DCHECK(key_pattern.IsFixedArray());
@@ -1028,6 +1167,9 @@ void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
     DCHECK(key_pattern->IsString());
     if (!key_pattern->IsInternalizedString()) return;
     cache = factory->string_split_cache();
+  } else if (type == REGEXP_EXEC_REGISTERS) {
+    DCHECK(key_pattern->IsFixedArray());
+    cache = factory->regexp_exec_cache();
   } else {
     DCHECK(type == REGEXP_MULTIPLE_INDICES);
     DCHECK(key_pattern->IsFixedArray());
@@ -1070,6 +1212,9 @@ void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
       value_array->set(i, *internalized_str);
     }
   }
+  // Cached registers never leave the cache, and may be the read-only empty
+  // array.
+  if (type == REGEXP_EXEC_REGISTERS) return;
   // Convert backing store to a copy-on-write array.
   value_array->set_map_no_write_barrier(
       ReadOnlyRoots(isolate).fixed_cow_array_map());
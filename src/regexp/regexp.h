@@ -90,11 +90,13 @@ class RegExp final : public AllStatic {
   static constexpr int kInternalRegExpSuccess = 1;
   static constexpr int kInternalRegExpException = -1;
   static constexpr int kInternalRegExpRetry = -2;
+  static constexpr int kInternalRegExpFallbackToExperimental = -3;
 
   enum IrregexpResult : int32_t {
     RE_FAILURE = kInternalRegExpFailure,
     RE_SUCCESS = kInternalRegExpSuccess,
     RE_EXCEPTION = kInternalRegExpException,
+    RE_FALLBACK_TO_EXPERIMENTAL = kInternalRegExpFallbackToExperimental,
   };
 
   // Prepare a RegExp for being executed one or more times (using
@@ -113,6 +115,11 @@ class RegExp final : public AllStatic {
       Isolate* isolate, Handle<RegExpMatchInfo> last_match_info,
       Handle<String> subject, int capture_count, int32_t* match);
 
+  // Throws a SyntaxError describing `error` for `pattern`.
+  V8_WARN_UNUSED_RESULT static MaybeHandle<Object> ThrowRegExpException(
+      Isolate* isolate, Handle<JSRegExp> re, Handle<String> pattern,
+      RegExpError error);
+
   V8_EXPORT_PRIVATE static bool CompileForTesting(Isolate* isolate, Zone* zone,
                                                   RegExpCompileData* input,
                                                   JSRegExp::Flags flags,
@@ -163,13 +170,20 @@ class RegExpGlobalCache final {
 
 // Caches results for specific regexp queries on the isolate. At the time of
 // writing, this is used during global calls to RegExp.prototype.exec and
-// @@split.
+// @@split, and for executions from index 0 that go through RegExp::Exec.
 class RegExpResultsCache final : public AllStatic {
  public:
-  enum ResultsCacheType { REGEXP_MULTIPLE_INDICES, STRING_SPLIT_SUBSTRINGS };
+  enum ResultsCacheType {
+    REGEXP_MULTIPLE_INDICES,
+    STRING_SPLIT_SUBSTRINGS,
+    // The capture registers of a single execution from index 0, or an empty
+    // array if there was no match.  Keyed by the regexp data.
+    REGEXP_EXEC_REGISTERS
+  };
 
   // Attempt to retrieve a cached result.  On failure, 0 is returned as a Smi.
-  // On success, the returned result is guaranteed to be a COW-array.
+  // On success, the returned result is guaranteed to be a COW-array, unless
+  // the type is REGEXP_EXEC_REGISTERS.
   static Object Lookup(Heap* heap, String key_string, Object key_pattern,
                        FixedArray* last_match_out, ResultsCacheType type);
   // Attempt to add value_array to the cache specified by type.  On success,
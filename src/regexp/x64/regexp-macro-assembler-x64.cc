@@ -125,6 +125,7 @@ RegExpMacroAssemblerX64::~RegExpMacroAssemblerX64() {
   exit_label_.Unuse();
   check_preempt_label_.Unuse();
   stack_overflow_label_.Unuse();
+  fallback_label_.Unuse();
 }
 
 
@@ -157,8 +158,12 @@ void RegExpMacroAssemblerX64::Backtrack() {
     __ cmpq(Operand(rbp, kBacktrackCount), Immediate(backtrack_limit()));
     __ j(not_equal, &next);
 
-    // Exceeded limits are treated as a failed match.
-    Fail();
+    if (can_fallback()) {
+      __ jmp(&fallback_label_);
+    } else {
+      // Exceeded limits are treated as a failed match.
+      Fail();
+    }
 
     __ bind(&next);
   }
@@ -663,6 +668,70 @@ bool RegExpMacroAssemblerX64::CheckSpecialCharacterClass(uc16 type,
 }
 
 
+bool RegExpMacroAssemblerX64::SkipUntilCharacterAfterAnd(int cp_offset,
+                                                         unsigned c,
+                                                         unsigned mask) {
+  // Only one-byte subjects are scanned in bulk, a vector of characters at a
+  // time.
+  if (mode_ != LATIN1) return false;
+  bool needs_mask = (mask & String::kMaxOneByteCharCode) !=
+                    String::kMaxOneByteCharCode;
+  c &= mask & String::kMaxOneByteCharCode;
+
+  // rax: Address of the character to check for the current position.
+  __ leaq(rax, Operand(rsi, rdi, times_1, cp_offset));
+  // Broadcast {c} into all bytes of xmm0, and {mask} into xmm1.
+  __ movl(rbx, Immediate(c));
+  __ movd(xmm0, rbx);
+  __ punpcklbw(xmm0, xmm0);
+  __ pshuflw(xmm0, xmm0, 0);
+  __ pshufd(xmm0, xmm0, 0);
+  if (needs_mask) {
+    __ movl(rbx, Immediate(mask & String::kMaxOneByteCharCode));
+    __ movd(xmm1, rbx);
+    __ punpcklbw(xmm1, xmm1);
+    __ pshuflw(xmm1, xmm1, 0);
+    __ pshufd(xmm1, xmm1, 0);
+  }
+
+  Label vector_loop, found_in_vector, scalar_loop, done;
+  __ bind(&vector_loop);
+  __ leaq(rbx, Operand(rax, kSimd128Size));
+  __ cmpq(rbx, rsi);
+  __ j(above, &scalar_loop);
+  __ movdqu(xmm2, Operand(rax, 0));
+  if (needs_mask) __ pand(xmm2, xmm1);
+  __ pcmpeqb(xmm2, xmm0);
+  __ pmovmskb(rbx, xmm2);
+  __ testl(rbx, rbx);
+  __ j(not_zero, &found_in_vector);
+  __ addq(rax, Immediate(kSimd128Size));
+  __ jmp(&vector_loop);
+
+  __ bind(&found_in_vector);
+  __ bsfl(rbx, rbx);
+  __ addq(rax, rbx);
+  __ jmp(&done);
+
+  // Check the last few characters one at a time.
+  __ bind(&scalar_loop);
+  __ cmpq(rax, rsi);
+  __ j(above_equal, &done);
+  __ movzxbl(rbx, Operand(rax, 0));
+  if (needs_mask) __ andl(rbx, Immediate(mask));
+  __ cmpl(rbx, Immediate(c));
+  __ j(equal, &done);
+  __ incq(rax);
+  __ jmp(&scalar_loop);
+
+  // rax is now either at a matching character or at the end of the input.
+  __ bind(&done);
+  __ subq(rax, rsi);
+  __ leaq(rdi, Operand(rax, -cp_offset));
+  return true;
+}
+
+
 void RegExpMacroAssemblerX64::Fail() {
   STATIC_ASSERT(FAILURE == 0);  // Return value for failure is zero.
   if (!global()) {
@@ -1000,6 +1069,12 @@ Handle<HeapObject> RegExpMacroAssemblerX64::GetCode(Handle<String> source) {
     __ jmp(&return_rax);
   }
 
+  if (fallback_label_.is_linked()) {
+    __ bind(&fallback_label_);
+    __ Set(rax, FALLBACK_TO_EXPERIMENTAL);
+    __ jmp(&return_rax);
+  }
+
   FixupCodeRelativePositions();
 
   CodeDesc code_desc;
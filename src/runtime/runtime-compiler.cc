@@ -8,13 +8,16 @@
 #include "src/common/message-template.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/deoptimizer/deoptimizer.h"
+#include "src/diagnostics/code-tracer.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
 #include "src/execution/isolate-inl.h"
 #include "src/execution/v8threads.h"
 #include "src/execution/vm-state-inl.h"
+#include "src/logging/metrics.h"
 #include "src/objects/js-array-buffer-inl.h"
 #include "src/objects/js-array-inl.h"
+#include "src/objects/osr-optimized-code-cache.h"
 #include "src/runtime/runtime-utils.h"
 
 namespace v8 {
@@ -44,14 +47,8 @@ RUNTIME_FUNCTION(Runtime_CompileLazy) {
                          &is_compiled_scope)) {
     return ReadOnlyRoots(isolate).exception();
   }
-  if (sfi->may_have_cached_code()) {
-    Handle<Code> code;
-    if (sfi->TryGetCachedCode(isolate).ToHandle(&code)) {
-      function->set_code(*code);
-      JSFunction::EnsureFeedbackVector(function, &is_compiled_scope);
-      if (FLAG_trace_turbo_nci) CompilationCacheCode::TraceHit(sfi, code);
-      return *code;
-    }
+  if (Compiler::InstallCachedCode(function, &is_compiled_scope)) {
+    return function->code();
   }
   DCHECK(function->is_compiled());
   return function->code();
@@ -177,6 +174,18 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   Handle<Code> optimized_code = deoptimizer->compiled_code();
   DeoptimizeKind type = deoptimizer->deopt_kind();
   bool should_reuse_code = deoptimizer->should_reuse_code();
+  Address from = deoptimizer->from();
+
+  const std::shared_ptr<metrics::Recorder>& recorder =
+      isolate->metrics_recorder();
+  if (recorder->HasEmbedderRecorder()) {
+    v8::metrics::Deoptimization event;
+    event.lazy = type == DeoptimizeKind::kLazy;
+    event.soft = type == DeoptimizeKind::kSoft;
+    recorder->DelayMainThreadEvent(
+        event, isolate->GetOrRegisterRecorderContextId(
+                   handle(function->native_context(), isolate)));
+  }
 
   // TODO(turbofan): We currently need the native context to materialize
   // the arguments object, but only to get to its map.
@@ -199,6 +208,26 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   // Invalidate the underlying optimized code on eager and soft deopts.
   if (type == DeoptimizeKind::kEager || type == DeoptimizeKind::kSoft) {
     Deoptimizer::DeoptimizeFunction(*function, *optimized_code);
+    // Stop re-optimizing functions whose optimized code keeps deoptimizing
+    // for the same reason at the same position; the feedback evidently does
+    // not settle, and each optimization is wasted.
+    Deoptimizer::DeoptInfo info =
+        Deoptimizer::GetDeoptInfo(*optimized_code, from);
+    if (function->has_feedback_vector() &&
+        function->feedback_vector().RecordDeoptimization(info.deopt_reason,
+                                                         info.position) &&
+        !function->shared().optimization_disabled()) {
+      isolate->CountUsage(v8::Isolate::kDeoptimizationLoopDetected);
+      if (FLAG_trace_deopt) {
+        CodeTracer::Scope scope(isolate->GetCodeTracer());
+        PrintF(scope.file(), "[deoptimization loop detected in ");
+        function->ShortPrint(scope.file());
+        PrintF(scope.file(), ", reason: %s]\n",
+               DeoptimizeReasonToString(info.deopt_reason));
+      }
+      function->shared().DisableOptimization(
+          BailoutReason::kDeoptimizationLoop);
+    }
   }
 
   return ReadOnlyRoots(isolate).undefined_value();
@@ -298,8 +327,14 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
       }
 
       DCHECK(result->is_turbofanned());
+      if (FLAG_share_osr_code) {
+        // Let the loops of other closures enter the cached code, too.
+        OSROptimizedCodeCache::ArmBackEdges(
+            isolate, handle(function->shared(), isolate), ast_id);
+      }
       if (function->feedback_vector().invocation_count() <= 1 &&
-          function->HasOptimizationMarker()) {
+          function->HasOptimizationMarker() &&
+          !function->IsInOptimizationQueue()) {
         // With lazy feedback allocation we may not have feedback for the
         // initial part of the function that was executed before we allocated a
         // feedback vector. Reset any optimization markers for such functions.
@@ -309,7 +344,6 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
         // feedback. We cannot do this currently since we OSR only after we mark
         // a function for optimization. We should instead change it to be based
         // based on number of ticks.
-        DCHECK(!function->IsInOptimizationQueue());
         function->ClearOptimizationMarker();
       }
       // TODO(mythria): Once we have OSR code cache we may not need to mark
@@ -317,26 +351,36 @@ RUNTIME_FUNCTION(Runtime_CompileForOnStackReplacement) {
       // early so the second execution uses the already compiled OSR code and
       // the optimization occurs concurrently off main thread.
       if (!function->HasOptimizedCode() &&
+          !function->IsInOptimizationQueue() &&
           function->feedback_vector().invocation_count() > 1) {
         // If we're not already optimized, set to optimize non-concurrently on
         // the next call, otherwise we'd run unoptimized once more and
-        // potentially compile for OSR again.
+        // potentially compile for OSR again. With --concurrent-osr, further
+        // loops wait for their OSR code in the interpreter anyway, so the
+        // function is optimized concurrently, too.
+        const char* type =
+            FLAG_concurrent_osr ? "concurrent" : "non-concurrent";
         if (FLAG_trace_osr) {
           CodeTracer::Scope scope(isolate->GetCodeTracer());
           PrintF(scope.file(), "[OSR - Re-marking ");
           function->PrintName(scope.file());
-          PrintF(scope.file(), " for non-concurrent optimization]\n");
+          PrintF(scope.file(), " for %s optimization]\n", type);
         }
-        function->SetOptimizationMarker(OptimizationMarker::kCompileOptimized);
+        function->SetOptimizationMarker(
+            FLAG_concurrent_osr
+                ? OptimizationMarker::kCompileOptimizedConcurrent
+                : OptimizationMarker::kCompileOptimized);
       }
       return *result;
     }
   }
 
-  // Failed.
+  // Failed, or the code is still being compiled concurrently.
   if (FLAG_trace_osr) {
     CodeTracer::Scope scope(isolate->GetCodeTracer());
-    PrintF(scope.file(), "[OSR - Failed: ");
+    PrintF(scope.file(), function->IsInOptimizationQueue()
+                             ? "[OSR - Queued: "
+                             : "[OSR - Failed: ");
     function->PrintName(scope.file());
     PrintF(scope.file(), " at AST id %d]\n", ast_id.ToInt());
   }
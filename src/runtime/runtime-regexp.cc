@@ -322,7 +322,8 @@ bool CompiledReplacement::Compile(Isolate* isolate, Handle<JSRegExp> regexp,
 
     FixedArray capture_name_map;
     if (capture_count > 0) {
-      DCHECK_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
+      DCHECK(regexp->TypeTag() == JSRegExp::IRREGEXP ||
+             regexp->TypeTag() == JSRegExp::EXPERIMENTAL);
       Object maybe_capture_name_map = regexp->CaptureNameMap();
       if (maybe_capture_name_map.IsFixedArray()) {
         capture_name_map = FixedArray::cast(maybe_capture_name_map);
@@ -891,7 +892,8 @@ class MatchInfoBackedMatch : public String::Match {
       : isolate_(isolate), match_info_(match_info) {
     subject_ = String::Flatten(isolate, subject);
 
-    if (regexp->TypeTag() == JSRegExp::IRREGEXP) {
+    if (regexp->TypeTag() == JSRegExp::IRREGEXP ||
+        regexp->TypeTag() == JSRegExp::EXPERIMENTAL) {
       Object o = regexp->CaptureNameMap();
       has_named_captures_ = o.IsFixedArray();
       if (has_named_captures_) {
@@ -1460,8 +1462,9 @@ RUNTIME_FUNCTION(Runtime_StringReplaceNonGlobalRegExpWithFunction) {
   bool has_named_captures = false;
   Handle<FixedArray> capture_map;
   if (m > 1) {
-    // The existence of capture groups implies IRREGEXP kind.
-    DCHECK_EQ(regexp->TypeTag(), JSRegExp::IRREGEXP);
+    // The existence of capture groups implies IRREGEXP or EXPERIMENTAL kind.
+    DCHECK(regexp->TypeTag() == JSRegExp::IRREGEXP ||
+           regexp->TypeTag() == JSRegExp::EXPERIMENTAL);
 
     Object maybe_capture_map = regexp->CaptureNameMap();
     if (maybe_capture_map.IsFixedArray()) {
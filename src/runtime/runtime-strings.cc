@@ -251,6 +251,30 @@ RUNTIME_FUNCTION(Runtime_InternalizeString) {
   return *isolate->factory()->InternalizeString(string);
 }
 
+namespace {
+
+// Maximum number of steps down the right side of a cons string to read a
+// character without flattening.
+constexpr int kMaxConsDepthForAppendedRead = 4;
+
+// Returns the character at |index| of |cons| if it lies in a recently
+// appended part, i.e. at most kMaxConsDepthForAppendedRead steps down the
+// right side of the tree, and -1 otherwise.
+int32_t TryGetAppendedChar(ConsString cons, uint32_t index) {
+  DisallowHeapAllocation no_gc;
+  for (int depth = 0; depth < kMaxConsDepthForAppendedRead; depth++) {
+    uint32_t first_length = static_cast<uint32_t>(cons.first().length());
+    if (index < first_length) return -1;
+    index -= first_length;
+    String second = cons.second();
+    if (!second.IsConsString()) return second.Get(index);
+    cons = ConsString::cast(second);
+  }
+  return -1;
+}
+
+}  // namespace
+
 RUNTIME_FUNCTION(Runtime_StringCharCodeAt) {
   HandleScope handle_scope(isolate);
   DCHECK_EQ(2, args.length());
@@ -258,6 +282,15 @@ RUNTIME_FUNCTION(Runtime_StringCharCodeAt) {
   CONVERT_ARG_HANDLE_CHECKED(String, subject, 0);
   CONVERT_NUMBER_CHECKED(uint32_t, i, Uint32, args[1]);
 
+  // Reading from the end of a string that is being built with += is common,
+  // and flattening it for that would copy the whole string after every
+  // append. Characters in the appended parts are read in place instead.
+  if (subject->IsConsString() && !subject->IsFlat() &&
+      i < static_cast<uint32_t>(subject->length())) {
+    int32_t c = TryGetAppendedChar(ConsString::cast(*subject), i);
+    if (c >= 0) return Smi::FromInt(c);
+  }
+
   // Flatten the string.  If someone wants to get a char at an index
   // in a cons string, it is likely that more indices will be
   // accessed.
@@ -2,6 +2,10 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <cmath>
+#include <vector>
+
+#include "src/base/memory.h"
 #include "src/common/message-template.h"
 #include "src/execution/arguments-inl.h"
 #include "src/heap/factory.h"
@@ -31,6 +35,54 @@ RUNTIME_FUNCTION(Runtime_ArrayBufferDetach) {
   return ReadOnlyRoots(isolate).undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_CreateTypedArrayAllocationSites) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(0, args.length());
+  DCHECK(FLAG_typed_array_pretenuring);
+  Handle<NativeContext> native_context(isolate->context().native_context(),
+                                       isolate);
+  if (native_context->typed_array_allocation_sites().IsFixedArray()) {
+    return native_context->typed_array_allocation_sites();
+  }
+  // One allocation site per typed array constructor, indexed by elements kind.
+  const int kNumberOfSites = LAST_FIXED_TYPED_ARRAY_ELEMENTS_KIND -
+                             FIRST_FIXED_TYPED_ARRAY_ELEMENTS_KIND + 1;
+  Handle<FixedArray> sites =
+      isolate->factory()->NewFixedArray(kNumberOfSites, AllocationType::kOld);
+  for (int i = 0; i < kNumberOfSites; i++) {
+    Handle<AllocationSite> site = isolate->factory()->NewAllocationSite(true);
+    sites->set(i, *site);
+  }
+  native_context->set_typed_array_allocation_sites(*sites);
+  return *sites;
+}
+
+RUNTIME_FUNCTION(Runtime_TypedArrayAllocatePretenuredBuffer) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(2, args.length());
+  CONVERT_NUMBER_ARG_HANDLE_CHECKED(length_obj, 0);
+  CONVERT_BOOLEAN_ARG_CHECKED(initialize, 1);
+
+  size_t byte_length;
+  if (!TryNumberToSize(*length_obj, &byte_length) ||
+      byte_length > JSArrayBuffer::kMaxByteLength) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewRangeError(MessageTemplate::kInvalidArrayBufferLength));
+  }
+  Handle<JSArrayBuffer> buffer;
+  if (!isolate->factory()
+           ->NewJSArrayBufferAndBackingStore(
+               byte_length,
+               initialize ? InitializedFlag::kZeroInitialized
+                          : InitializedFlag::kUninitialized,
+               AllocationType::kOld)
+           .ToHandle(&buffer)) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewRangeError(MessageTemplate::kArrayBufferAllocationFailed));
+  }
+  return *buffer;
+}
+
 RUNTIME_FUNCTION(Runtime_TypedArrayCopyElements) {
   HandleScope scope(isolate);
   DCHECK_EQ(3, args.length());
@@ -74,6 +126,112 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Typed arrays with at least this many elements are sorted with a radix sort
+// rather than std::sort when no comparator is given.
+constexpr size_t kMinRadixSortLength = 1024;
+
+template <size_t kSize>
+struct UnsignedOfSize;
+template <>
+struct UnsignedOfSize<1> {
+  using type = uint8_t;
+};
+template <>
+struct UnsignedOfSize<2> {
+  using type = uint16_t;
+};
+template <>
+struct UnsignedOfSize<4> {
+  using type = uint32_t;
+};
+template <>
+struct UnsignedOfSize<8> {
+  using type = uint64_t;
+};
+
+// Maps {value} to an unsigned key with the same order as CompareNum, which
+// puts -0 before +0. NaNs have no such key and are handled separately.
+template <typename T, typename Key = typename UnsignedOfSize<sizeof(T)>::type>
+Key ToRadixKey(T value) {
+  constexpr Key kSignBit = static_cast<Key>(Key{1} << (8 * sizeof(Key) - 1));
+  Key bits = bit_cast<Key>(value);
+  if (std::is_floating_point<T>::value) {
+    // Negative numbers order by descending magnitude.
+    return (bits & kSignBit) ? static_cast<Key>(~bits)
+                             : static_cast<Key>(bits | kSignBit);
+  }
+  return std::is_signed<T>::value ? static_cast<Key>(bits ^ kSignBit) : bits;
+}
+
+template <typename T, typename Key = typename UnsignedOfSize<sizeof(T)>::type>
+T FromRadixKey(Key key) {
+  constexpr Key kSignBit = static_cast<Key>(Key{1} << (8 * sizeof(Key) - 1));
+  Key bits = key;
+  if (std::is_floating_point<T>::value) {
+    bits = (key & kSignBit) ? static_cast<Key>(key ^ kSignBit)
+                            : static_cast<Key>(~key);
+  } else if (std::is_signed<T>::value) {
+    bits = static_cast<Key>(key ^ kSignBit);
+  }
+  return bit_cast<T>(bits);
+}
+
+template <typename T>
+bool IsNaN(T value) {
+  return std::is_floating_point<T>::value &&
+         std::isnan(static_cast<double>(value));
+}
+
+// Least significant digit radix sort over bytes. Unlike std::sort this takes
+// a fixed number of linear passes, and passes over bytes that all keys share
+// (such as the high bytes of small integers) are skipped. {data} may be
+// unaligned.
+template <typename T>
+void RadixSort(T* data, size_t length) {
+  using Key = typename UnsignedOfSize<sizeof(T)>::type;
+  std::vector<Key> keys;
+  keys.reserve(length);
+  std::vector<T> nans;
+  for (size_t i = 0; i < length; i++) {
+    T value = base::ReadUnalignedValue<T>(reinterpret_cast<Address>(data + i));
+    if (IsNaN(value)) {
+      nans.push_back(value);
+    } else {
+      keys.push_back(ToRadixKey(value));
+    }
+  }
+
+  const size_t count = keys.size();
+  std::vector<Key> buffer(count);
+  Key* from = keys.data();
+  Key* to = buffer.data();
+  for (size_t shift = 0; count > 0 && shift < 8 * sizeof(Key); shift += 8) {
+    size_t offsets[256] = {0};
+    for (size_t i = 0; i < count; i++) offsets[(from[i] >> shift) & 0xFF]++;
+    if (offsets[(from[0] >> shift) & 0xFF] == count) continue;
+    size_t offset = 0;
+    for (size_t& bucket : offsets) {
+      size_t bucket_size = bucket;
+      bucket = offset;
+      offset += bucket_size;
+    }
+    for (size_t i = 0; i < count; i++) {
+      to[offsets[(from[i] >> shift) & 0xFF]++] = from[i];
+    }
+    std::swap(from, to);
+  }
+
+  for (size_t i = 0; i < count; i++) {
+    base::WriteUnalignedValue<T>(reinterpret_cast<Address>(data + i),
+                                 FromRadixKey<T>(from[i]));
+  }
+  // NaNs go last, as with CompareNum.
+  for (size_t i = 0; i < nans.size(); i++) {
+    base::WriteUnalignedValue<T>(reinterpret_cast<Address>(data + count + i),
+                                 nans[i]);
+  }
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -118,8 +276,10 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
   case kExternal##Type##Array: {                                           \
     ctype* data = copy_data ? reinterpret_cast<ctype*>(data_copy_ptr)      \
                             : static_cast<ctype*>(array->DataPtr());       \
-    if (kExternal##Type##Array == kExternalFloat64Array ||                 \
-        kExternal##Type##Array == kExternalFloat32Array) {                 \
+    if (length >= kMinRadixSortLength) {                                   \
+      RadixSort(data, length);                                             \
+    } else if (kExternal##Type##Array == kExternalFloat64Array ||          \
+               kExternal##Type##Array == kExternalFloat32Array) {          \
       if (COMPRESS_POINTERS_BOOL && alignof(ctype) > kTaggedSize) {        \
         /* TODO(ishell, v8:8875): See UnalignedSlot<T> for details. */     \
         std::sort(UnalignedSlot<ctype>(data),                              \
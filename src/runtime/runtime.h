@@ -517,6 +517,7 @@ namespace internal {
   F(IsWasmTrapHandlerEnabled, 0, 1)           \
   F(RegexpHasBytecode, 2, 1)                  \
   F(RegexpHasNativeCode, 2, 1)                \
+  F(RegexpTypeTag, 1, 1)                      \
   F(MapIteratorProtector, 0, 1)               \
   F(NeverOptimizeFunction, 1, 1)              \
   F(NotifyContextDisposed, 0, 1)              \
@@ -552,11 +553,13 @@ namespace internal {
   F(WasmTraceMemory, 1, 1)                    \
   I(DeoptimizeNow, 0, 1)
 
-#define FOR_EACH_INTRINSIC_TYPEDARRAY(F, I) \
-  F(ArrayBufferDetach, 1, 1)                \
-  F(TypedArrayCopyElements, 3, 1)           \
-  F(TypedArrayGetBuffer, 1, 1)              \
-  F(TypedArraySet, 2, 1)                    \
+#define FOR_EACH_INTRINSIC_TYPEDARRAY(F, I)   \
+  F(ArrayBufferDetach, 1, 1)                  \
+  F(CreateTypedArrayAllocationSites, 0, 1)    \
+  F(TypedArrayAllocatePretenuredBuffer, 2, 1) \
+  F(TypedArrayCopyElements, 3, 1)             \
+  F(TypedArrayGetBuffer, 1, 1)                \
+  F(TypedArraySet, 2, 1)                      \
   F(TypedArraySortFast, 1, 1)
 
 #define FOR_EACH_INTRINSIC_WASM(F, I) \
@@ -4,6 +4,8 @@
 
 #include "src/snapshot/code-serializer.h"
 
+#include <vector>
+
 #include "src/base/platform/platform.h"
 #include "src/codegen/macro-assembler.h"
 #include "src/common/globals.h"
@@ -40,6 +42,63 @@ CodeSerializer::CodeSerializer(Isolate* isolate, uint32_t source_hash)
   allocator()->UseCustomChunkSize(FLAG_serialization_chunk_size);
 }
 
+namespace {
+
+// AsmWasmData is context dependent and thus cannot be serialized. Instead,
+// asm.js module functions are serialized as if they had never been compiled,
+// and are translated again when they are first called after deserialization.
+// The rest of the script stays cacheable.
+class DecompileAsmModulesScope {
+ public:
+  DecompileAsmModulesScope(Isolate* isolate, Handle<Script> script) {
+    if (!script->ContainsAsmModule()) return;
+    {
+      SharedFunctionInfo::ScriptIterator iter(isolate, *script);
+      for (SharedFunctionInfo info = iter.Next(); !info.is_null();
+           info = iter.Next()) {
+        if (!info.HasAsmWasmData()) continue;
+        entries_.push_back({handle(info, isolate),
+                            handle(info.function_data(), isolate),
+                            Handle<UncompiledData>()});
+      }
+    }
+    for (Entry& entry : entries_) {
+      Handle<SharedFunctionInfo> shared = entry.shared;
+      entry.uncompiled_data =
+          isolate->factory()->NewUncompiledDataWithoutPreparseData(
+              handle(shared->inferred_name(), isolate),
+              shared->StartPosition(), shared->EndPosition());
+    }
+    DisallowHeapAllocation no_gc;
+    for (Entry& entry : entries_) {
+      // Use the raw function data setter to avoid validity checks, as in
+      // SharedFunctionInfo::DiscardCompiled.
+      entry.shared->DiscardCompiledMetadata(isolate);
+      entry.shared->set_function_data(*entry.uncompiled_data);
+    }
+  }
+
+  ~DecompileAsmModulesScope() {
+    for (Entry& entry : entries_) {
+      entry.shared->set_function_data(*entry.asm_wasm_data);
+      entry.shared->set_feedback_metadata(
+          ReadOnlyRoots(entry.shared->GetIsolate()).empty_feedback_metadata());
+    }
+  }
+
+ private:
+  struct Entry {
+    Handle<SharedFunctionInfo> shared;
+    Handle<Object> asm_wasm_data;
+    Handle<UncompiledData> uncompiled_data;
+  };
+  std::vector<Entry> entries_;
+
+  DISALLOW_COPY_AND_ASSIGN(DecompileAsmModulesScope);
+};
+
+}  // namespace
+
 // static
 ScriptCompiler::CachedData* CodeSerializer::Serialize(
     Handle<SharedFunctionInfo> info) {
@@ -58,9 +117,9 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
     script->name().ShortPrint();
     PrintF("]\n");
   }
-  // TODO(7110): Enable serialization of Asm modules once the AsmWasmData is
-  // context independent.
-  if (script->ContainsAsmModule()) return nullptr;
+  // TODO(7110): Serialize asm.js modules once the AsmWasmData is context
+  // independent.
+  DecompileAsmModulesScope decompile_asm_modules(isolate, script);
 
   // Serialize code object.
   Handle<String> source(String::cast(script->source()), isolate);
@@ -161,8 +220,7 @@ void CodeSerializer::SerializeObject(HeapObject obj) {
 
   if (obj.IsSharedFunctionInfo()) {
     SharedFunctionInfo sfi = SharedFunctionInfo::cast(obj);
-    // TODO(7110): Enable serializing of Asm modules once the AsmWasmData
-    // is context independent.
+    // AsmWasmData has been replaced by DecompileAsmModulesScope.
     DCHECK(!sfi.IsApiFunction() && !sfi.HasAsmWasmData());
 
     DebugInfo debug_info;
@@ -178,8 +236,24 @@ void CodeSerializer::SerializeObject(HeapObject obj) {
     }
     DCHECK(!sfi.HasDebugInfo());
 
+    // Optimized code is not part of the code cache, so the consuming isolate
+    // must not look for it in its compilation cache. Instead, remember that
+    // the function got hot enough to be optimized here.
+    const bool may_have_cached_code = sfi.may_have_cached_code();
+    const bool optimize_from_code_cache = sfi.optimize_from_code_cache();
+    if (may_have_cached_code) {
+      sfi.set_may_have_cached_code(false);
+      sfi.set_optimize_from_code_cache(true);
+    }
+
+    // Uncompiled functions keep their preparse data, so lazily compiling them
+    // after deserialization can skip over their inner functions just like the
+    // first compile in this isolate would.
     SerializeGeneric(obj);
 
+    sfi.set_may_have_cached_code(may_have_cached_code);
+    sfi.set_optimize_from_code_cache(optimize_from_code_cache);
+
     // Restore debug info
     if (!debug_info.is_null()) {
       sfi.set_script_or_debug_info(debug_info);
@@ -477,7 +551,13 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
       POINTER_SIZE_ALIGN(kHeaderSize +
                          GetHeaderValue(kNumReservationsOffset) * kInt32Size);
   if (payload_length > max_payload_length) return LENGTH_MISMATCH;
-  if (Checksum(ChecksummedContent()) != c) return CHECKSUM_MISMATCH;
+  // Computing the checksum reads the whole cache up front, before the
+  // deserializer reads it again. Embedders that verify the integrity of their
+  // caches themselves can skip it.
+  if (FLAG_verify_code_cache_checksum &&
+      Checksum(ChecksummedContent()) != c) {
+    return CHECKSUM_MISMATCH;
+  }
   return CHECK_SUCCESS;
 }
 
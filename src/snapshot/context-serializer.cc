@@ -165,7 +165,7 @@ void ContextSerializer::SerializeObject(HeapObject obj) {
 
   // Clear InterruptBudget when serializing FeedbackCell.
   if (obj.IsFeedbackCell()) {
-    FeedbackCell::cast(obj).SetInitialInterruptBudget();
+    FeedbackCell::cast(obj).SetInitialInterruptBudget(isolate());
   }
 
   if (SerializeJSObjectWithEmbedderFields(obj)) {
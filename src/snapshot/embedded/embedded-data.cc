@@ -4,6 +4,9 @@
 
 #include "src/snapshot/embedded/embedded-data.h"
 
+#include <numeric>
+
+#include "src/builtins/profile-data-reader.h"
 #include "src/codegen/assembler-inl.h"
 #include "src/codegen/callable.h"
 #include "src/objects/objects-inl.h"
@@ -25,7 +28,9 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   if (!PcIsOffHeap(isolate, address)) return Code();
 
   EmbeddedData d = EmbeddedData::FromBlob();
-  if (address < d.InstructionStartOfBuiltin(0)) return Code();
+  if (address < d.InstructionStartOfBuiltin(d.BuiltinAtLayoutPosition(0))) {
+    return Code();
+  }
 
   // Note: Addresses within the padding section between builtins (i.e. within
   // start + size <= address < start + padded_size) are interpreted as belonging
@@ -34,15 +39,16 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   int l = 0, r = Builtins::builtin_count;
   while (l < r) {
     const int mid = (l + r) / 2;
-    Address start = d.InstructionStartOfBuiltin(mid);
-    Address end = start + d.PaddedInstructionSizeOfBuiltin(mid);
+    const int builtin = d.BuiltinAtLayoutPosition(mid);
+    Address start = d.InstructionStartOfBuiltin(builtin);
+    Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin);
 
     if (address < start) {
       r = mid;
     } else if (address >= end) {
       l = mid + 1;
     } else {
-      return isolate->builtins()->builtin(mid);
+      return isolate->builtins()->builtin(builtin);
     }
   }
 
@@ -198,6 +204,32 @@ void FinalizeEmbeddedCodeTargets(Isolate* isolate, EmbeddedData* blob) {
   }
 }
 
+// Returns the builtins in the order in which their instruction streams are
+// laid out in the blob. Without --reorder-builtins that is builtin index
+// order. Otherwise builtins are sorted by how often their entry block ran in
+// the profile given by --turbo-profiling-log-file, so that hot builtins share
+// as few pages as possible and never-executed ones end up at the back.
+// Bytecode handlers keep their index order at the end of the blob since the
+// frame iterator expects them to be contiguous.
+std::vector<uint32_t> BuiltinLayoutOrder() {
+  std::vector<uint32_t> order(Builtins::builtin_count);
+  std::iota(order.begin(), order.end(), 0);
+  if (!FLAG_reorder_builtins) return order;
+
+  std::vector<uint32_t> entry_counts(Builtins::kFirstBytecodeHandler, 0);
+  for (int i = 0; i < Builtins::kFirstBytecodeHandler; i++) {
+    const ProfileDataFromFile* profile_data =
+        ProfileDataFromFile::TryRead(Builtins::name(i));
+    if (profile_data != nullptr) entry_counts[i] = profile_data->GetCounter(0);
+  }
+  std::stable_sort(order.begin(),
+                   order.begin() + Builtins::kFirstBytecodeHandler,
+                   [&entry_counts](uint32_t a, uint32_t b) {
+                     return entry_counts[a] > entry_counts[b];
+                   });
+  return order;
+}
+
 }  // namespace
 
 // static
@@ -206,10 +238,12 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
 
   // Store instruction stream lengths and offsets.
   std::vector<struct Metadata> metadata(kTableSize);
+  const std::vector<uint32_t> layout_order = BuiltinLayoutOrder();
 
   bool saw_unsafe_builtin = false;
   uint32_t raw_code_size = 0;
-  for (int i = 0; i < Builtins::builtin_count; i++) {
+  for (const uint32_t builtin : layout_order) {
+    const int i = static_cast<int>(builtin);
     Code code = builtins->builtin(i);
 
     if (Builtins::IsIsolateIndependent(i)) {
@@ -247,7 +281,7 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   uint8_t* const blob_code = new uint8_t[blob_code_size];
   uint8_t* const raw_code_start = blob_code + RawCodeOffset();
   const uint32_t blob_metadata_size =
-      MetadataTableOffset() + MetadataTableSize();
+      LayoutOrderTableOffset() + LayoutOrderTableSize();
   uint8_t* const blob_metadata = new uint8_t[blob_metadata_size];
 
   // Initially zap the entire blob, effectively padding the alignment area
@@ -265,6 +299,10 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   DCHECK_EQ(MetadataTableSize(), sizeof(metadata[0]) * metadata.size());
   std::memcpy(blob_metadata + MetadataTableOffset(), metadata.data(),
               MetadataTableSize());
+  DCHECK_EQ(LayoutOrderTableSize(),
+            sizeof(layout_order[0]) * layout_order.size());
+  std::memcpy(blob_metadata + LayoutOrderTableOffset(), layout_order.data(),
+              LayoutOrderTableSize());
 
   // Write the raw data section.
   for (int i = 0; i < Builtins::builtin_count; i++) {
@@ -72,6 +72,16 @@ class EmbeddedData final {
   Address InstructionStartOfBuiltin(int i) const;
   uint32_t InstructionSizeOfBuiltin(int i) const;
 
+  // Returns the builtin whose instruction stream is the {position}th one in
+  // the blob. Instruction streams are in builtin index order unless the blob
+  // was created with --reorder-builtins.
+  int BuiltinAtLayoutPosition(int position) const {
+    DCHECK(Builtins::IsBuiltinId(position));
+    const uint32_t* layout_order = reinterpret_cast<const uint32_t*>(
+        metadata_ + LayoutOrderTableOffset());
+    return static_cast<int>(layout_order[position]);
+  }
+
   Address InstructionStartOfBytecodeHandlers() const;
   Address InstructionEndOfBytecodeHandlers() const;
 
@@ -115,9 +125,11 @@ class EmbeddedData final {
   // [1] hash of embedded-blob-relevant heap objects
   // [2] metadata of instruction stream 0
   // ... metadata
+  // [3] builtin index of the first instruction stream in the code section
+  // ... builtin indices in layout order
   //
   // code:
-  // [0] instruction streams 0
+  // [0] instruction streams in layout order
   // ... instruction streams
 
   static constexpr uint32_t kTableSize = Builtins::builtin_count;
@@ -133,6 +145,12 @@ class EmbeddedData final {
   static constexpr uint32_t MetadataTableSize() {
     return sizeof(struct Metadata) * kTableSize;
   }
+  static constexpr uint32_t LayoutOrderTableOffset() {
+    return MetadataTableOffset() + MetadataTableSize();
+  }
+  static constexpr uint32_t LayoutOrderTableSize() {
+    return kUInt32Size * kTableSize;
+  }
   static constexpr uint32_t RawCodeOffset() { return 0; }
 
  private:
@@ -180,7 +180,9 @@ class EmbeddedFileWriter : public EmbeddedFileWriterInterface {
     w->AlignToCodeAlignment();
     w->DeclareLabel(EmbeddedBlobCodeDataSymbol().c_str());
 
-    for (int i = 0; i < i::Builtins::builtin_count; i++) {
+    for (int position = 0; position < i::Builtins::builtin_count;
+         position++) {
+      const int i = blob->BuiltinAtLayoutPosition(position);
       if (!blob->ContainsBuiltin(i)) continue;
 
       WriteBuiltin(w, blob, i);
@@ -110,7 +110,10 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   w->StartPdataSection();
   {
     Address prev_builtin_end_offset = 0;
-    for (int i = 0; i < Builtins::builtin_count; i++) {
+    // PDATA entries must be sorted by address, so visit builtins in the order
+    // they are laid out in the blob.
+    for (int position = 0; position < Builtins::builtin_count; position++) {
+      const int i = blob->BuiltinAtLayoutPosition(position);
       // Some builtins are leaf functions from the point of view of Win64 stack
       // walking: they do not move the stack pointer and do not require a PDATA
       // entry because the return address can be retrieved from [rsp].
@@ -193,7 +196,10 @@ void EmitUnwindData(PlatformEmbeddedFileWriterWin* w,
   std::vector<int> code_chunks;
   std::vector<win64_unwindinfo::FrameOffsets> fp_adjustments;
 
-  for (int i = 0; i < Builtins::builtin_count; i++) {
+  // PDATA entries must be sorted by address, so visit builtins in the order
+  // they are laid out in the blob.
+  for (int position = 0; position < Builtins::builtin_count; position++) {
+    const int i = blob->BuiltinAtLayoutPosition(position);
     if (!blob->ContainsBuiltin(i)) continue;
     if (unwind_infos[i].is_leaf_function()) continue;
 
@@ -81,7 +81,7 @@ void ObjectDeserializer::CommitPostProcessedObjects() {
   if (is_main_thread()) {
     // TODO(crbug.com/v8/10729): Add concurrent string table support.
     CHECK_LE(new_internalized_strings().size(), kMaxInt);
-    StringTable::EnsureCapacityForDeserialization(
+    StringTable::EnsureCapacityForBulkInsert(
         isolate(), static_cast<int>(new_internalized_strings().size()));
     for (Handle<String> string : new_internalized_strings()) {
       DisallowHeapAllocation no_gc;
@@ -6,10 +6,17 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include <memory>
+
+#include "include/v8-platform.h"
+#include "src/base/platform/mutex.h"
 #include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
 #include "src/execution/isolate-inl.h"
 #include "src/init/bootstrapper.h"
+#include "src/init/v8.h"
 #include "src/logging/counters.h"
+#include "src/numbers/hash-seed-inl.h"
 #include "src/objects/js-regexp-inl.h"
 #include "src/snapshot/context-deserializer.h"
 #include "src/snapshot/context-serializer.h"
@@ -36,9 +43,10 @@ class SnapshotImpl : public AllStatic {
       const SnapshotData* startup_snapshot_in,
       const SnapshotData* read_only_snapshot_in,
       const std::vector<SnapshotData*>& context_snapshots_in,
-      bool can_be_rehashed);
+      bool can_be_rehashed, uint64_t hash_seed);
 
   static uint32_t ExtractNumContexts(const v8::StartupData* data);
+  static uint64_t ExtractHashSeed(const v8::StartupData* data);
   static uint32_t ExtractContextOffset(const v8::StartupData* data,
                                        uint32_t index);
   static Vector<const byte> ExtractStartupData(const v8::StartupData* data);
@@ -60,11 +68,12 @@ class SnapshotImpl : public AllStatic {
   // Snapshot blob layout:
   // [0] number of contexts N
   // [1] rehashability
-  // [2] checksum
-  // [3] (128 bytes) version string
-  // [4] offset to readonly
-  // [5] offset to context 0
-  // [6] offset to context 1
+  // [2] (8 bytes) hash seed
+  // [3] checksum
+  // [4] (128 bytes) version string
+  // [5] offset to readonly
+  // [6] offset to context 0
+  // [7] offset to context 1
   // ...
   // ... offset to context N - 1
   // ... startup snapshot data
@@ -76,7 +85,10 @@ class SnapshotImpl : public AllStatic {
   // TODO(yangguo): generalize rehashing, and remove this flag.
   static const uint32_t kRehashabilityOffset =
       kNumberOfContextsOffset + kUInt32Size;
-  static const uint32_t kChecksumOffset = kRehashabilityOffset + kUInt32Size;
+  // The hash seed the snapshot was created with, so that deserialization can
+  // skip rehashing when the isolate ends up with the same seed.
+  static const uint32_t kHashSeedOffset = kRehashabilityOffset + kUInt32Size;
+  static const uint32_t kChecksumOffset = kHashSeedOffset + kInt64Size;
   static const uint32_t kVersionStringOffset = kChecksumOffset + kUInt32Size;
   static const uint32_t kVersionStringLength = 64;
   static const uint32_t kReadOnlyOffsetOffset =
@@ -112,6 +124,32 @@ SnapshotData MaybeDecompress(const Vector<const byte>& snapshot_data) {
 #endif
 }
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+namespace {
+
+// Decompresses a section of the snapshot blob on a worker thread, so that the
+// read-only and startup sections are decompressed in parallel.
+class DecompressTask final : public v8::Task {
+ public:
+  DecompressTask(Vector<const byte> compressed_data,
+                 std::unique_ptr<SnapshotData>* result, base::Semaphore* done)
+      : compressed_data_(compressed_data), result_(result), done_(done) {}
+
+  void Run() override {
+    *result_ = std::make_unique<SnapshotData>(
+        SnapshotCompression::Decompress(compressed_data_));
+    done_->Signal();
+  }
+
+ private:
+  Vector<const byte> compressed_data_;
+  std::unique_ptr<SnapshotData>* result_;
+  base::Semaphore* done_;
+};
+
+}  // namespace
+#endif  // V8_SNAPSHOT_COMPRESSION
+
 #ifdef DEBUG
 bool Snapshot::SnapshotIsValid(const v8::StartupData* snapshot_blob) {
   return SnapshotImpl::ExtractNumContexts(snapshot_blob) > 0;
@@ -139,6 +177,29 @@ bool Snapshot::VersionIsValid(const v8::StartupData* data) {
                  SnapshotImpl::kVersionStringLength) == 0;
 }
 
+namespace {
+
+base::LazyMutex verified_snapshot_blob_mutex = LAZY_MUTEX_INITIALIZER;
+const char* verified_snapshot_blob_data = nullptr;
+int verified_snapshot_blob_size = 0;
+
+// Verifies the checksum of {blob} unless it was already verified when an
+// earlier isolate was created from it. Hosts that create many isolates from
+// the same blob would otherwise checksum the whole blob for each of them.
+bool VerifyChecksumOnce(const v8::StartupData* blob) {
+  base::MutexGuard guard(verified_snapshot_blob_mutex.Pointer());
+  if (blob->data == verified_snapshot_blob_data &&
+      blob->raw_size == verified_snapshot_blob_size) {
+    return true;
+  }
+  if (!Snapshot::VerifyChecksum(blob)) return false;
+  verified_snapshot_blob_data = blob->data;
+  verified_snapshot_blob_size = blob->raw_size;
+  return true;
+}
+
+}  // namespace
+
 bool Snapshot::Initialize(Isolate* isolate) {
   if (!isolate->snapshot_available()) return false;
   RuntimeCallTimerScope rcs_timer(isolate,
@@ -148,17 +209,41 @@ bool Snapshot::Initialize(Isolate* isolate) {
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   SnapshotImpl::CheckVersion(blob);
-  CHECK(VerifyChecksum(blob));
+  if (FLAG_verify_snapshot_checksum) CHECK(VerifyChecksumOnce(blob));
   Vector<const byte> startup_data = SnapshotImpl::ExtractStartupData(blob);
   Vector<const byte> read_only_data = SnapshotImpl::ExtractReadOnlyData(blob);
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+  std::unique_ptr<SnapshotData> decompressed_read_only_data;
+  base::Semaphore read_only_data_done(0);
+  const bool decompress_in_parallel = !FLAG_single_threaded;
+  if (decompress_in_parallel) {
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        std::make_unique<DecompressTask>(
+            read_only_data, &decompressed_read_only_data,
+            &read_only_data_done));
+  } else {
+    decompressed_read_only_data =
+        std::make_unique<SnapshotData>(MaybeDecompress(read_only_data));
+  }
+  SnapshotData startup_snapshot_data(MaybeDecompress(startup_data));
+  if (decompress_in_parallel) read_only_data_done.Wait();
+  SnapshotData read_only_snapshot_data(std::move(*decompressed_read_only_data));
+#else
   SnapshotData startup_snapshot_data(MaybeDecompress(startup_data));
   SnapshotData read_only_snapshot_data(MaybeDecompress(read_only_data));
-
+#endif  // V8_SNAPSHOT_COMPRESSION
+
+  // A fixed --hash-seed that matches the snapshot's seed makes rehashing
+  // unnecessary, which saves clearing and recomputing the hashes of all
+  // deserialized strings and hash tables.
+  bool can_rehash = ExtractRehashability(blob) &&
+                    (FLAG_hash_seed == 0 ||
+                     FLAG_hash_seed != SnapshotImpl::ExtractHashSeed(blob));
   StartupDeserializer startup_deserializer(&startup_snapshot_data);
   ReadOnlyDeserializer read_only_deserializer(&read_only_snapshot_data);
-  startup_deserializer.SetRehashability(ExtractRehashability(blob));
-  read_only_deserializer.SetRehashability(ExtractRehashability(blob));
+  startup_deserializer.SetRehashability(can_rehash);
+  read_only_deserializer.SetRehashability(can_rehash);
   bool success =
       isolate->InitWithSnapshot(&read_only_deserializer, &startup_deserializer);
   if (FLAG_profile_deserialization) {
@@ -179,7 +264,11 @@ MaybeHandle<Context> Snapshot::NewContextFromSnapshot(
   if (FLAG_profile_deserialization) timer.Start();
 
   const v8::StartupData* blob = isolate->snapshot_blob();
-  bool can_rehash = ExtractRehashability(blob);
+  // Contexts only need rehashing if the isolate's hash seed differs from the
+  // one the snapshot was created with. Skipping it keeps the cost of
+  // deserializing a context with large hash tables down.
+  bool can_rehash = ExtractRehashability(blob) &&
+                    HashSeed(isolate) != SnapshotImpl::ExtractHashSeed(blob);
   Vector<const byte> context_data = SnapshotImpl::ExtractContextData(
       blob, static_cast<uint32_t>(context_index));
   SnapshotData snapshot_data(MaybeDecompress(context_data));
@@ -389,7 +478,8 @@ v8::StartupData Snapshot::Create(
   SnapshotData startup_snapshot(&startup_serializer);
   v8::StartupData result =
       SnapshotImpl::CreateSnapshotBlob(&startup_snapshot, &read_only_snapshot,
-                                       context_snapshots, can_be_rehashed);
+                                       context_snapshots, can_be_rehashed,
+                                       HashSeed(isolate));
 
   for (const SnapshotData* ptr : context_snapshots) delete ptr;
 
@@ -410,7 +500,7 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
     const SnapshotData* startup_snapshot_in,
     const SnapshotData* read_only_snapshot_in,
     const std::vector<SnapshotData*>& context_snapshots_in,
-    bool can_be_rehashed) {
+    bool can_be_rehashed, uint64_t hash_seed) {
   // Have these separate from snapshot_in for compression, since we need to
   // access the compressed data as well as the uncompressed reservations.
   const SnapshotData* startup_snapshot;
@@ -460,6 +550,9 @@ v8::StartupData SnapshotImpl::CreateSnapshotBlob(
                                num_contexts);
   SnapshotImpl::SetHeaderValue(data, SnapshotImpl::kRehashabilityOffset,
                                can_be_rehashed ? 1 : 0);
+  base::WriteLittleEndianValue(
+      reinterpret_cast<Address>(data) + SnapshotImpl::kHashSeedOffset,
+      hash_seed);
 
   // Write version string into snapshot data.
   memset(data + SnapshotImpl::kVersionStringOffset, 0,
@@ -561,6 +654,13 @@ bool Snapshot::ExtractRehashability(const v8::StartupData* data) {
   return rehashability != 0;
 }
 
+uint64_t SnapshotImpl::ExtractHashSeed(const v8::StartupData* data) {
+  CHECK_LT(kHashSeedOffset + kInt64Size,
+           static_cast<uint32_t>(data->raw_size));
+  return base::ReadLittleEndianValue<uint64_t>(
+      reinterpret_cast<Address>(data->data) + kHashSeedOffset);
+}
+
 namespace {
 Vector<const byte> ExtractData(const v8::StartupData* snapshot,
                                uint32_t start_offset, uint32_t end_offset) {
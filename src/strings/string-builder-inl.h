@@ -12,6 +12,7 @@
 #include "src/objects/fixed-array.h"
 #include "src/objects/objects.h"
 #include "src/objects/string-inl.h"
+#include "src/utils/memcopy.h"
 #include "src/utils/utils.h"
 
 namespace v8 {
@@ -208,6 +209,11 @@ class IncrementalStringBuilder {
       const uint8_t* u = reinterpret_cast<const uint8_t*>(s);
       while (*u != '\0') Append(*(u++));
     }
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(const SrcChar* chars, int count) {
+      CopyChars(cursor_, chars, count);
+      cursor_ += count;
+    }
 
     int written() { return static_cast<int>(cursor_ - start_); }
 
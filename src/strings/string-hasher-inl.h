@@ -9,6 +9,7 @@
 
 #include <type_traits>
 
+#include "src/base/memory.h"
 #include "src/objects/objects.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -44,6 +45,48 @@ uint32_t StringHasher::GetTrivialHash(int length) {
   return (hash << String::kHashShift) | String::kIsNotIntegerIndexMask;
 }
 
+// Packs the low bytes of kBlockSize characters into a little-endian word. For
+// one-byte strings this is a single load.
+template <typename uchar>
+uint64_t StringHasher::ReadBlock(const uchar* chars) {
+  STATIC_ASSERT(kBlockSize == sizeof(uint64_t));
+  if (sizeof(uchar) == 1) {
+    uint64_t block = base::ReadUnalignedValue<uint64_t>(
+        reinterpret_cast<Address>(chars));
+#if V8_TARGET_BIG_ENDIAN
+    block = ByteReverse(block);
+#endif
+    return block;
+  }
+  // Characters beyond Latin-1 spill into the next lane. Such strings are
+  // never equal to a one-byte string, so this only has to be deterministic.
+  uint64_t block = 0;
+  for (int i = 0; i < kBlockSize; i++) {
+    block += static_cast<uint64_t>(chars[i]) << (8 * i);
+  }
+  return block;
+}
+
+template <typename uchar>
+uint32_t StringHasher::HashBlocks(const uchar* chars, int length,
+                                  uint64_t seed) {
+  // Multiply-xorshift over 64-bit blocks. The full 64-bit seed and the length
+  // go into the initial state, so that neither the seed nor the number of
+  // trailing zero characters can be factored out.
+  const uint64_t kMultiplier = uint64_t{0x9E3779B97F4A7C15};
+  uint64_t state = (seed ^ static_cast<uint64_t>(length)) * kMultiplier;
+  const uchar* end = chars + length;
+  for (; end - chars >= kBlockSize; chars += kBlockSize) {
+    state = (state ^ ReadBlock(chars)) * kMultiplier;
+    state ^= state >> 29;
+  }
+  uint32_t running_hash = static_cast<uint32_t>(state ^ (state >> 32));
+  while (chars != end) {
+    running_hash = AddCharacterCore(running_hash, *chars++);
+  }
+  return running_hash;
+}
+
 template <typename char_t>
 uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
                                             uint64_t seed) {
@@ -109,11 +152,18 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
     }
   }
 
-  // Non-index hash.
-  uint32_t running_hash = static_cast<uint32_t>(seed);
-  const uchar* end = &chars[length];
-  while (chars != end) {
-    running_hash = AddCharacterCore(running_hash, *chars++);
+  // Non-index hash. Array and integer indices are shorter than
+  // kMinBlockHashLength, so the paths above are not affected by this.
+  STATIC_ASSERT(String::kMaxIntegerIndexSize < kMinBlockHashLength);
+  uint32_t running_hash;
+  if (length >= kMinBlockHashLength) {
+    running_hash = HashBlocks(chars, length, seed);
+  } else {
+    running_hash = static_cast<uint32_t>(seed);
+    const uchar* end = &chars[length];
+    while (chars != end) {
+      running_hash = AddCharacterCore(running_hash, *chars++);
+    }
   }
 
   return (GetHashCore(running_hash) << String::kHashShift) |
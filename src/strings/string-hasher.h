@@ -35,6 +35,22 @@ class V8_EXPORT_PRIVATE StringHasher final {
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
 
   static inline uint32_t GetTrivialHash(int length);
+
+  // Strings of at least this length are hashed a word at a time rather than
+  // character by character.
+  static const int kMinBlockHashLength = 32;
+
+ private:
+  // Returns the running hash for the non-index hash of |chars|, consuming
+  // kBlockSize characters per step. The result only depends on the character
+  // values, so one- and two-byte strings with equal contents hash equally.
+  template <typename uchar>
+  V8_INLINE static uint32_t HashBlocks(const uchar* chars, int length,
+                                       uint64_t seed);
+  template <typename uchar>
+  V8_INLINE static uint64_t ReadBlock(const uchar* chars);
+
+  static const int kBlockSize = 8;
 };
 
 // Useful for std containers that require something ()'able.
@@ -190,12 +190,52 @@ inline uint8_t GetHighestValueByte(uc16 character) {
 
 inline uint8_t GetHighestValueByte(uint8_t character) { return character; }
 
+inline bool ExceedsOneByte(uint8_t character) { return false; }
+
+inline bool ExceedsOneByte(uc16 character) {
+  return character > String::kMaxOneByteCharCodeU;
+}
+
+// Returns the first position of |character| in |subject| from |index| on and
+// before |limit|, or -1. Tests a word of characters at a time: for 16-bit
+// lanes, (w - 0x0001..0001) & ~w & 0x8000..8000 is non-zero iff a lane of w
+// is zero.
+inline int FindTwoByteCharacter(Vector<const uc16> subject, int index,
+                                int limit, uc16 character) {
+  using Word = uintptr_t;
+  static constexpr int kCharsPerWord = sizeof(Word) / sizeof(uc16);
+  static constexpr Word kOneInEveryChar = ~Word{0} / 0xFFFF;
+  static constexpr Word kHighBitInEveryChar = kOneInEveryChar << 15;
+  const Word pattern = kOneInEveryChar * character;
+  int pos = index;
+  for (; pos + kCharsPerWord <= limit; pos += kCharsPerWord) {
+    Word w;
+    memcpy(&w, subject.begin() + pos, sizeof(w));
+    w ^= pattern;
+    if (((w - kOneInEveryChar) & ~w & kHighBitInEveryChar) != 0) break;
+  }
+  for (; pos < limit; pos++) {
+    if (subject[pos] == character) return pos;
+  }
+  return -1;
+}
+
 template <typename PatternChar, typename SubjectChar>
 inline int FindFirstCharacter(Vector<const PatternChar> pattern,
                               Vector<const SubjectChar> subject, int index) {
   const PatternChar pattern_first_char = pattern[0];
   const int max_n = (subject.length() - pattern.length() + 1);
 
+  // Characters beyond Latin-1 usually share their highest byte with most of
+  // the surrounding text, which would make memchr stop at nearly every
+  // character. Compare whole characters instead.
+  if (sizeof(SubjectChar) == 2 && ExceedsOneByte(pattern_first_char)) {
+    return FindTwoByteCharacter(
+        Vector<const uc16>(reinterpret_cast<const uc16*>(subject.begin()),
+                           subject.length()),
+        index, max_n, static_cast<uc16>(pattern_first_char));
+  }
+
   const uint8_t search_byte = GetHighestValueByte(pattern_first_char);
   const SubjectChar search_char = static_cast<SubjectChar>(pattern_first_char);
   int pos = index;
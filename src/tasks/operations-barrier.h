@@ -0,0 +1,91 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_TASKS_OPERATIONS_BARRIER_H_
+#define V8_TASKS_OPERATIONS_BARRIER_H_
+
+#include <cstdint>
+
+#include "src/base/macros.h"
+#include "src/base/platform/condition-variable.h"
+#include "src/base/platform/mutex.h"
+
+namespace v8 {
+namespace internal {
+
+// A thread-safe barrier to manage the lifetime of multi-threaded operations
+// that cannot be tracked by a {CancelableTaskManager}, e.g. the workers of a
+// {v8::JobTask}.
+//
+// Each operation acquires a {Token} via {TryLock} before it starts and holds
+// it while it runs. {CancelAndWait} waits until all outstanding operations
+// released their tokens, and makes all subsequent {TryLock} calls fail:
+//
+//   void Run(JobDelegate* delegate) override {
+//     OperationsBarrier::Token token = barrier_->TryLock();
+//     if (!token) return;
+//     ...
+//   }
+class V8_EXPORT_PRIVATE OperationsBarrier {
+ public:
+  class Token {
+   public:
+    Token() = default;
+    ~Token() {
+      if (outer_) outer_->Release();
+    }
+    Token(Token&& other) V8_NOEXCEPT : outer_(other.outer_) {
+      other.outer_ = nullptr;
+    }
+    Token& operator=(Token&& other) V8_NOEXCEPT {
+      DCHECK_NE(this, &other);
+      if (outer_) outer_->Release();
+      outer_ = other.outer_;
+      other.outer_ = nullptr;
+      return *this;
+    }
+
+    operator bool() const { return !!outer_; }
+
+   private:
+    friend class OperationsBarrier;
+    explicit Token(OperationsBarrier* outer) : outer_(outer) {
+      DCHECK_NOT_NULL(outer_);
+    }
+    OperationsBarrier* outer_ = nullptr;
+
+    DISALLOW_COPY_AND_ASSIGN(Token);
+  };
+
+  OperationsBarrier() = default;
+  // {CancelAndWait} must be called before destruction.
+  ~OperationsBarrier();
+
+  // Returns a valid token if the barrier was not cancelled yet.
+  Token TryLock();
+
+  // Prevents further {TryLock} calls from succeeding and waits for all
+  // outstanding tokens to be released.
+  void CancelAndWait();
+
+  bool cancelled() const {
+    base::MutexGuard guard(&mutex_);
+    return cancelled_;
+  }
+
+ private:
+  void Release();
+
+  mutable base::Mutex mutex_;
+  base::ConditionVariable release_condition_;
+  bool cancelled_ = false;
+  size_t operations_count_ = 0;
+
+  DISALLOW_COPY_AND_ASSIGN(OperationsBarrier);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TASKS_OPERATIONS_BARRIER_H_
@@ -301,6 +301,16 @@ inline int CompareCharsUnsigned(const lchar* lhs, const rchar* rhs,
     // strings on little-endian systems.
     return memcmp(lhs, rhs, chars);
   }
+  if (sizeof(*lhs) == sizeof(*rhs)) {
+    // Skip the common prefix a word at a time. memcmp is only used for
+    // equality here, and compiles to a single load and compare per word.
+    static constexpr size_t kCharsPerWord = sizeof(uintptr_t) / sizeof(*lhs);
+    while (static_cast<size_t>(limit - lhs) >= kCharsPerWord &&
+           memcmp(lhs, rhs, sizeof(uintptr_t)) == 0) {
+      lhs += kCharsPerWord;
+      rhs += kCharsPerWord;
+    }
+  }
   while (lhs < limit) {
     int r = static_cast<int>(*lhs) - static_cast<int>(*rhs);
     if (r != 0) return r;
@@ -1474,6 +1474,13 @@ void LiftoffAssembler::LoadTransform(LiftoffRegister dst, Register src_addr,
       Ldr(dst.fp().D(), src_op);
       Uxtl(dst.fp().V2D(), dst.fp().V2S());
     }
+  } else if (transform == LoadTransformationKind::kZeroExtend) {
+    if (memtype == MachineType::Int32()) {
+      Ldr(dst.fp().S(), src_op);
+    } else {
+      DCHECK_EQ(MachineType::Int64(), memtype);
+      Ldr(dst.fp().D(), src_op);
+    }
   } else {
     // ld1r only allows no offset or post-index, so emit an add.
     DCHECK_EQ(LoadTransformationKind::kSplat, transform);
@@ -1543,6 +1550,30 @@ void LiftoffAssembler::emit_f64x2_sqrt(LiftoffRegister dst,
   Fsqrt(dst.fp().V2D(), src.fp().V2D());
 }
 
+bool LiftoffAssembler::emit_f64x2_ceil(LiftoffRegister dst,
+                                       LiftoffRegister src) {
+  Frintp(dst.fp().V2D(), src.fp().V2D());
+  return true;
+}
+
+bool LiftoffAssembler::emit_f64x2_floor(LiftoffRegister dst,
+                                        LiftoffRegister src) {
+  Frintm(dst.fp().V2D(), src.fp().V2D());
+  return true;
+}
+
+bool LiftoffAssembler::emit_f64x2_trunc(LiftoffRegister dst,
+                                        LiftoffRegister src) {
+  Frintz(dst.fp().V2D(), src.fp().V2D());
+  return true;
+}
+
+bool LiftoffAssembler::emit_f64x2_nearest_int(LiftoffRegister dst,
+                                              LiftoffRegister src) {
+  Frintn(dst.fp().V2D(), src.fp().V2D());
+  return true;
+}
+
 void LiftoffAssembler::emit_f64x2_add(LiftoffRegister dst, LiftoffRegister lhs,
                                       LiftoffRegister rhs) {
   Fadd(dst.fp().V2D(), lhs.fp().V2D(), rhs.fp().V2D());
@@ -1573,6 +1604,28 @@ void LiftoffAssembler::emit_f64x2_max(LiftoffRegister dst, LiftoffRegister lhs,
   Fmax(dst.fp().V2D(), lhs.fp().V2D(), rhs.fp().V2D());
 }
 
+void LiftoffAssembler::emit_f64x2_pmin(LiftoffRegister dst, LiftoffRegister lhs,
+                                       LiftoffRegister rhs) {
+  // pmin(lhs, rhs) = bitselect(rhs, lhs, gt(lhs, rhs))
+  UseScratchRegisterScope temps(this);
+  VRegister tmp = dst.fp().V2D();
+  if (dst == lhs || dst == rhs) tmp = temps.AcquireV(kFormat2D);
+  Fcmgt(tmp, lhs.fp().V2D(), rhs.fp().V2D());
+  Bsl(tmp.V16B(), rhs.fp().V16B(), lhs.fp().V16B());
+  if (tmp != dst.fp().V2D()) Mov(dst.fp().V16B(), tmp.V16B());
+}
+
+void LiftoffAssembler::emit_f64x2_pmax(LiftoffRegister dst, LiftoffRegister lhs,
+                                       LiftoffRegister rhs) {
+  // pmax(lhs, rhs) = bitselect(rhs, lhs, gt(rhs, lhs))
+  UseScratchRegisterScope temps(this);
+  VRegister tmp = dst.fp().V2D();
+  if (dst == lhs || dst == rhs) tmp = temps.AcquireV(kFormat2D);
+  Fcmgt(tmp, rhs.fp().V2D(), lhs.fp().V2D());
+  Bsl(tmp.V16B(), rhs.fp().V16B(), lhs.fp().V16B());
+  if (tmp != dst.fp().V2D()) Mov(dst.fp().V16B(), tmp.V16B());
+}
+
 void LiftoffAssembler::emit_f32x4_splat(LiftoffRegister dst,
                                         LiftoffRegister src) {
   Dup(dst.fp().V4S(), src.fp().S(), 0);
@@ -1609,6 +1662,30 @@ void LiftoffAssembler::emit_f32x4_sqrt(LiftoffRegister dst,
   Fsqrt(dst.fp().V4S(), src.fp().V4S());
 }
 
+bool LiftoffAssembler::emit_f32x4_ceil(LiftoffRegister dst,
+                                       LiftoffRegister src) {
+  Frintp(dst.fp().V4S(), src.fp().V4S());
+  return true;
+}
+
+bool LiftoffAssembler::emit_f32x4_floor(LiftoffRegister dst,
+                                        LiftoffRegister src) {
+  Frintm(dst.fp().V4S(), src.fp().V4S());
+  return true;
+}
+
+bool LiftoffAssembler::emit_f32x4_trunc(LiftoffRegister dst,
+                                        LiftoffRegister src) {
+  Frintz(dst.fp().V4S(), src.fp().V4S());
+  return true;
+}
+
+bool LiftoffAssembler::emit_f32x4_nearest_int(LiftoffRegister dst,
+                                              LiftoffRegister src) {
+  Frintn(dst.fp().V4S(), src.fp().V4S());
+  return true;
+}
+
 void LiftoffAssembler::emit_f32x4_add(LiftoffRegister dst, LiftoffRegister lhs,
                                       LiftoffRegister rhs) {
   Fadd(dst.fp().V4S(), lhs.fp().V4S(), rhs.fp().V4S());
@@ -1639,6 +1716,28 @@ void LiftoffAssembler::emit_f32x4_max(LiftoffRegister dst, LiftoffRegister lhs,
   Fmax(dst.fp().V4S(), lhs.fp().V4S(), rhs.fp().V4S());
 }
 
+void LiftoffAssembler::emit_f32x4_pmin(LiftoffRegister dst, LiftoffRegister lhs,
+                                       LiftoffRegister rhs) {
+  // pmin(lhs, rhs) = bitselect(rhs, lhs, gt(lhs, rhs))
+  UseScratchRegisterScope temps(this);
+  VRegister tmp = dst.fp().V4S();
+  if (dst == lhs || dst == rhs) tmp = temps.AcquireV(kFormat4S);
+  Fcmgt(tmp, lhs.fp().V4S(), rhs.fp().V4S());
+  Bsl(tmp.V16B(), rhs.fp().V16B(), lhs.fp().V16B());
+  if (tmp != dst.fp().V4S()) Mov(dst.fp().V16B(), tmp.V16B());
+}
+
+void LiftoffAssembler::emit_f32x4_pmax(LiftoffRegister dst, LiftoffRegister lhs,
+                                       LiftoffRegister rhs) {
+  // pmax(lhs, rhs) = bitselect(rhs, lhs, gt(rhs, lhs))
+  UseScratchRegisterScope temps(this);
+  VRegister tmp = dst.fp().V4S();
+  if (dst == lhs || dst == rhs) tmp = temps.AcquireV(kFormat4S);
+  Fcmgt(tmp, rhs.fp().V4S(), lhs.fp().V4S());
+  Bsl(tmp.V16B(), rhs.fp().V16B(), lhs.fp().V16B());
+  if (tmp != dst.fp().V4S()) Mov(dst.fp().V16B(), tmp.V16B());
+}
+
 void LiftoffAssembler::emit_i64x2_splat(LiftoffRegister dst,
                                         LiftoffRegister src) {
   Dup(dst.fp().V2D(), src.gp().X());
@@ -1866,6 +1965,17 @@ void LiftoffAssembler::emit_i32x4_max_u(LiftoffRegister dst,
   Umax(dst.fp().V4S(), lhs.fp().V4S(), rhs.fp().V4S());
 }
 
+void LiftoffAssembler::emit_i32x4_dot_i16x8_s(LiftoffRegister dst,
+                                              LiftoffRegister lhs,
+                                              LiftoffRegister rhs) {
+  UseScratchRegisterScope scope(this);
+  VRegister tmp1 = scope.AcquireV(kFormat4S);
+  VRegister tmp2 = scope.AcquireV(kFormat4S);
+  Smull(tmp1, lhs.fp().V4H(), rhs.fp().V4H());
+  Smull2(tmp2, lhs.fp().V8H(), rhs.fp().V8H());
+  Addp(dst.fp().V4S(), tmp1, tmp2);
+}
+
 void LiftoffAssembler::emit_i16x8_splat(LiftoffRegister dst,
                                         LiftoffRegister src) {
   Dup(dst.fp().V8H(), src.gp().W());
@@ -2321,6 +2431,11 @@ void LiftoffAssembler::emit_i32x4_ge_u(LiftoffRegister dst, LiftoffRegister lhs,
   Cmhs(dst.fp().V4S(), lhs.fp().V4S(), rhs.fp().V4S());
 }
 
+void LiftoffAssembler::emit_i64x2_eq(LiftoffRegister dst, LiftoffRegister lhs,
+                                     LiftoffRegister rhs) {
+  Cmeq(dst.fp().V2D(), lhs.fp().V2D(), rhs.fp().V2D());
+}
+
 void LiftoffAssembler::emit_f32x4_eq(LiftoffRegister dst, LiftoffRegister lhs,
                                      LiftoffRegister rhs) {
   Fcmeq(dst.fp().V4S(), lhs.fp().V4S(), rhs.fp().V4S());
@@ -578,6 +578,61 @@ void LiftoffAssembler::PrepareLoopArgs(int num) {
   }
 }
 
+namespace {
+
+// Locals kept in registers across a loop back edge may occupy at most half of
+// the cache registers of their class, the rest is left to the loop body.
+bool HasLoopLocalRegisterBudget(LiftoffRegList local_regs, RegClass rc) {
+  LiftoffRegList cache_regs = rc == kGpReg || rc == kGpRegPair
+                                  ? kGpCacheRegList
+                                  : kFpCacheRegList;
+  unsigned needed = rc == kGpRegPair || rc == kFpRegPair ? 2 : 1;
+  return (local_regs & cache_regs).GetNumRegsSet() + needed <=
+         cache_regs.GetNumRegsSet() / 2;
+}
+
+}  // namespace
+
+void LiftoffAssembler::PrepareLoopLocals() {
+  // First keep the locals which already have a register of their own, since
+  // that does not cost any code.
+  LiftoffRegList local_regs;
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    VarState& slot = cache_state_.stack_state[i];
+    if (!slot.is_reg() || cache_state_.get_use_count(slot.reg()) > 1) continue;
+    if (!HasLoopLocalRegisterBudget(local_regs, reg_class_for(slot.type()))) {
+      continue;
+    }
+    local_regs.set(slot.reg());
+  }
+
+  // Then give the constants and locals sharing a register with other stack
+  // slots a register of their own, if one is free. A shared register cannot
+  // be used for the merge, because the back edge might write a different
+  // value to each of the slots.
+  for (uint32_t i = 0; i < num_locals_; ++i) {
+    VarState& slot = cache_state_.stack_state[i];
+    if (slot.is_stack()) continue;
+    if (slot.is_reg() && local_regs.has(slot.reg())) continue;
+    RegClass rc = reg_class_for(slot.type());
+    if (!HasLoopLocalRegisterBudget(local_regs, rc) ||
+        !cache_state_.has_unused_register(rc)) {
+      Spill(&slot);
+      continue;
+    }
+    LiftoffRegister reg = cache_state_.unused_register(rc);
+    if (slot.is_reg()) {
+      Move(reg, slot.reg(), slot.type());
+      cache_state_.dec_used(slot.reg());
+    } else {
+      LoadConstant(reg, slot.constant());
+    }
+    cache_state_.inc_used(reg);
+    slot.MakeRegister(reg);
+    local_regs.set(reg);
+  }
+}
+
 void LiftoffAssembler::MergeFullStackWith(const CacheState& target,
                                           const CacheState& source) {
   DCHECK_EQ(source.stack_height(), target.stack_height());
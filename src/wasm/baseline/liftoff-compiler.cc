@@ -536,6 +536,48 @@ class LiftoffCompiler {
     safepoint_table_builder_.DefineSafepoint(&asm_, Safepoint::kNoLazyDeopt);
   }
 
+  bool dynamic_tiering() const {
+    return env_->dynamic_tiering == kDynamicTiering && !for_debugging_;
+  }
+
+  // Counts one call or loop iteration of the current function, and requests
+  // tier-up when the function exhausted its budget.
+  void TierUpCheck(FullDecoder* decoder) {
+    DCHECK(dynamic_tiering());
+    // TODO(arobin): Avoid spilling registers unconditionally.
+    __ SpillAllRegisters();
+    DEBUG_CODE_COMMENT("dynamic tiering");
+    LiftoffRegList pinned;
+
+    // Get the number of calls array address.
+    LiftoffRegister array_address =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    LOAD_INSTANCE_FIELD(array_address.gp(), NumLiftoffFunctionCallsArray,
+                        kSystemPointerSize);
+
+    // Compute the correct offset in the array.
+    uint32_t offset =
+        kInt32Size * declared_function_index(env_->module, func_index_);
+
+    // Get the number of calls and update it.
+    LiftoffRegister number_of_calls =
+        pinned.set(__ GetUnusedRegister(kGpReg, pinned));
+    __ Load(number_of_calls, array_address.gp(), no_reg, offset,
+            LoadType::kI32Load, pinned);
+    __ emit_i32_addi(number_of_calls.gp(), number_of_calls.gp(), 1);
+    __ Store(array_address.gp(), no_reg, offset, number_of_calls,
+             StoreType::kI32Store, pinned);
+
+    // Emit the runtime call if necessary.
+    Label no_tierup;
+    __ emit_i32_addi(number_of_calls.gp(), number_of_calls.gp(),
+                     -FLAG_wasm_tiering_budget);
+    // Unary "unequal" means "different from zero".
+    __ emit_cond_jump(kUnequal, &no_tierup, kWasmI32, number_of_calls.gp());
+    TierUpFunction(decoder);
+    __ bind(&no_tierup);
+  }
+
   void TraceFunctionEntry(FullDecoder* decoder) {
     DEBUG_CODE_COMMENT("trace function entry");
     __ SpillAllRegisters();
@@ -619,41 +661,7 @@ class LiftoffCompiler {
     // is never a position of any instruction in the function.
     StackCheck(0);
 
-    if (FLAG_wasm_dynamic_tiering) {
-      // TODO(arobin): Avoid spilling registers unconditionally.
-      __ SpillAllRegisters();
-      DEBUG_CODE_COMMENT("dynamic tiering");
-      LiftoffRegList pinned;
-
-      // Get the number of calls array address.
-      LiftoffRegister array_address =
-          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      LOAD_INSTANCE_FIELD(array_address.gp(), NumLiftoffFunctionCallsArray,
-                          kSystemPointerSize);
-
-      // Compute the correct offset in the array.
-      uint32_t offset =
-          kInt32Size * declared_function_index(env_->module, func_index_);
-
-      // Get the number of calls and update it.
-      LiftoffRegister number_of_calls =
-          pinned.set(__ GetUnusedRegister(kGpReg, pinned));
-      __ Load(number_of_calls, array_address.gp(), no_reg, offset,
-              LoadType::kI32Load, pinned);
-      __ emit_i32_addi(number_of_calls.gp(), number_of_calls.gp(), 1);
-      __ Store(array_address.gp(), no_reg, offset, number_of_calls,
-               StoreType::kI32Store, pinned);
-
-      // Emit the runtime call if necessary.
-      Label no_tierup;
-      constexpr int kTierUpLimit = 5;
-      __ emit_i32_addi(number_of_calls.gp(), number_of_calls.gp(),
-                       -kTierUpLimit);
-      // Unary "unequal" means "different from zero".
-      __ emit_cond_jump(kUnequal, &no_tierup, kWasmI32, number_of_calls.gp());
-      TierUpFunction(decoder);
-      __ bind(&no_tierup);
-    }
+    if (dynamic_tiering()) TierUpCheck(decoder);
 
     if (FLAG_trace_wasm) TraceFunctionEntry(decoder);
 
@@ -814,12 +822,15 @@ class LiftoffCompiler {
   void Block(FullDecoder* decoder, Control* block) {}
 
   void Loop(FullDecoder* decoder, Control* loop) {
-    // Before entering a loop, spill all locals to the stack, in order to free
-    // the cache registers, and to avoid unnecessarily reloading stack values
-    // into registers at branches.
-    // TODO(clemensb): Come up with a better strategy here, involving
-    // pre-analysis of the function.
-    __ SpillLocals();
+    // Before entering a loop, keep locals in registers where possible, so that
+    // loop-carried locals are merged into their registers on the back edge
+    // instead of being spilled and refilled in each iteration. Debug code
+    // spills all locals, to keep them at a fixed location.
+    if (V8_UNLIKELY(for_debugging_)) {
+      __ SpillLocals();
+    } else {
+      __ PrepareLoopLocals();
+    }
 
     __ PrepareLoopArgs(loop->start_merge.arity);
 
@@ -831,6 +842,10 @@ class LiftoffCompiler {
 
     // Execute a stack check in the loop header.
     StackCheck(decoder->position());
+
+    // Loop iterations count towards the tiering budget, so that functions
+    // with hot loops get tiered up even if they are called rarely.
+    if (dynamic_tiering()) TierUpCheck(decoder);
   }
 
   void Try(FullDecoder* decoder, Control* block) {
@@ -2169,11 +2184,6 @@ class LiftoffCompiler {
       return;
     }
 
-    if (transform == LoadTransformationKind::kZeroExtend) {
-      unsupported(decoder, kSimd, "prototyping s128 load zero extend");
-      return;
-    }
-
     LiftoffRegList pinned;
     Register index = pinned.set(__ PopToRegister()).gp();
     // For load splats, LoadType is the size of the load, and for load
@@ -2368,6 +2378,21 @@ class LiftoffCompiler {
     }
   }
 
+  void EmitSimdFloatRoundingOpWithCFallback(
+      bool (LiftoffAssembler::*emit_fn)(LiftoffRegister, LiftoffRegister),
+      ExternalReference (*ext_ref)()) {
+    static constexpr RegClass rc = reg_class_for(kS128);
+    LiftoffRegister src = __ PopToRegister();
+    LiftoffRegister dst = __ GetUnusedRegister(rc, {src}, {});
+    if (!(asm_.*emit_fn)(dst, src)) {
+      // Return v128 via stack for ARM.
+      ValueType sig_v_s_reps[] = {kWasmS128};
+      FunctionSig sig_v_s(0, 1, sig_v_s_reps);
+      GenerateCCall(&dst, &sig_v_s, kWasmS128, &src, ext_ref());
+    }
+    __ PushRegister(kWasmS128, dst);
+  }
+
   void SimdOp(FullDecoder* decoder, WasmOpcode opcode, Vector<Value> args,
               Value* result) {
     if (!CpuFeatures::SupportsWasmSimd128()) {
@@ -2726,6 +2751,51 @@ class LiftoffCompiler {
         return EmitUnOp<kS128, kS128>(&LiftoffAssembler::emit_i16x8_abs);
       case wasm::kExprI32x4Abs:
         return EmitUnOp<kS128, kS128>(&LiftoffAssembler::emit_i32x4_abs);
+      case wasm::kExprI32x4DotI16x8S:
+        return EmitBinOp<kS128, kS128>(
+            &LiftoffAssembler::emit_i32x4_dot_i16x8_s);
+      case wasm::kExprI64x2Eq:
+        return EmitBinOp<kS128, kS128>(&LiftoffAssembler::emit_i64x2_eq);
+      case wasm::kExprF32x4Pmin:
+        return EmitBinOp<kS128, kS128>(&LiftoffAssembler::emit_f32x4_pmin);
+      case wasm::kExprF32x4Pmax:
+        return EmitBinOp<kS128, kS128>(&LiftoffAssembler::emit_f32x4_pmax);
+      case wasm::kExprF64x2Pmin:
+        return EmitBinOp<kS128, kS128>(&LiftoffAssembler::emit_f64x2_pmin);
+      case wasm::kExprF64x2Pmax:
+        return EmitBinOp<kS128, kS128>(&LiftoffAssembler::emit_f64x2_pmax);
+      case wasm::kExprF32x4Ceil:
+        return EmitSimdFloatRoundingOpWithCFallback(
+            &LiftoffAssembler::emit_f32x4_ceil,
+            &ExternalReference::wasm_f32x4_ceil);
+      case wasm::kExprF32x4Floor:
+        return EmitSimdFloatRoundingOpWithCFallback(
+            &LiftoffAssembler::emit_f32x4_floor,
+            &ExternalReference::wasm_f32x4_floor);
+      case wasm::kExprF32x4Trunc:
+        return EmitSimdFloatRoundingOpWithCFallback(
+            &LiftoffAssembler::emit_f32x4_trunc,
+            &ExternalReference::wasm_f32x4_trunc);
+      case wasm::kExprF32x4NearestInt:
+        return EmitSimdFloatRoundingOpWithCFallback(
+            &LiftoffAssembler::emit_f32x4_nearest_int,
+            &ExternalReference::wasm_f32x4_nearest_int);
+      case wasm::kExprF64x2Ceil:
+        return EmitSimdFloatRoundingOpWithCFallback(
+            &LiftoffAssembler::emit_f64x2_ceil,
+            &ExternalReference::wasm_f64x2_ceil);
+      case wasm::kExprF64x2Floor:
+        return EmitSimdFloatRoundingOpWithCFallback(
+            &LiftoffAssembler::emit_f64x2_floor,
+            &ExternalReference::wasm_f64x2_floor);
+      case wasm::kExprF64x2Trunc:
+        return EmitSimdFloatRoundingOpWithCFallback(
+            &LiftoffAssembler::emit_f64x2_trunc,
+            &ExternalReference::wasm_f64x2_trunc);
+      case wasm::kExprF64x2NearestInt:
+        return EmitSimdFloatRoundingOpWithCFallback(
+            &LiftoffAssembler::emit_f64x2_nearest_int,
+            &ExternalReference::wasm_f64x2_nearest_int);
       default:
         unsupported(decoder, kSimd, "simd");
     }
@@ -3743,8 +3813,15 @@ class LiftoffCompiler {
     DCHECK_GE(kMaxInt, canonical_sig_num);
 
     // Compare against table size stored in
-    // {instance->indirect_function_table_size}.
-    LOAD_INSTANCE_FIELD(tmp_const, IndirectFunctionTableSize, kUInt32Size);
+    // {instance->indirect_function_table_size}, or against the constant size
+    // of a table that cannot grow.
+    const WasmTable& table = env_->module->tables[0];
+    if (table.has_fixed_size()) {
+      __ LoadConstant(LiftoffRegister(tmp_const),
+                      WasmValue(static_cast<int32_t>(table.initial_size)));
+    } else {
+      LOAD_INSTANCE_FIELD(tmp_const, IndirectFunctionTableSize, kUInt32Size);
+    }
     __ emit_cond_jump(kUnsignedGreaterEqual, invalid_func_label, kWasmI32,
                       index, tmp_const);
 
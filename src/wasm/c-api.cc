@@ -1377,10 +1377,19 @@ i::Address CallTargetFromCache(i::Object cached_call_target) {
 }
 
 void PrepareFunctionData(i::Isolate* isolate,
-                         i::Handle<i::WasmExportedFunctionData> function_data,
-                         const i::wasm::FunctionSig* sig) {
+                         i::Handle<i::WasmExportedFunctionData> function_data) {
   // If the data is already populated, return immediately.
   if (!function_data->c_wrapper_code().IsSmi()) return;
+  // Cache the signature, so that later calls don't have to look it up in the
+  // module.
+  const i::wasm::FunctionSig* sig =
+      function_data->instance()
+          .module()
+          ->functions[function_data->function_index()]
+          .sig;
+  i::Handle<i::Foreign> signature =
+      isolate->factory()->NewForeign(reinterpret_cast<i::Address>(sig));
+  function_data->set_signature(*signature);
   // Compile wrapper code.
   i::Handle<i::Code> wrapper_code =
       i::compiler::CompileCWasmEntry(isolate, sig);
@@ -1521,10 +1530,10 @@ auto Func::call(const Val args[], Val results[]) const -> own<Trap> {
       i::WasmExportedFunctionData::cast(raw_function_data), isolate);
   i::Handle<i::WasmInstanceObject> instance(function_data->instance(), isolate);
   int function_index = function_data->function_index();
-  // Caching {sig} would give a ~10% reduction in overhead.
+  PrepareFunctionData(isolate, function_data);
   const i::wasm::FunctionSig* sig =
-      instance->module()->functions[function_index].sig;
-  PrepareFunctionData(isolate, function_data, sig);
+      reinterpret_cast<const i::wasm::FunctionSig*>(
+          i::Foreign::cast(function_data->signature()).foreign_address());
   i::Handle<i::Code> wrapper_code = i::Handle<i::Code>(
       i::Code::cast(function_data->c_wrapper_code()), isolate);
   i::Address call_target =
@@ -32,6 +32,11 @@ enum UseTrapHandler : bool { kUseTrapHandler = true, kNoTrapHandler = false };
 
 enum LowerSimd : bool { kLowerSimd = true, kNoLowerSimd = false };
 
+enum DynamicTiering : bool {
+  kDynamicTiering = true,
+  kNoDynamicTiering = false
+};
+
 // The {CompilationEnv} encapsulates the module data that is used during
 // compilation. CompilationEnvs are shareable across multiple compilations.
 struct CompilationEnv {
@@ -60,11 +65,16 @@ struct CompilationEnv {
 
   const LowerSimd lower_simd;
 
+  // If enabled, Liftoff code counts calls and loop iterations and requests
+  // tier-up to TurboFan once a function exhausts its tiering budget.
+  const DynamicTiering dynamic_tiering;
+
   constexpr CompilationEnv(const WasmModule* module,
                            UseTrapHandler use_trap_handler,
                            RuntimeExceptionSupport runtime_exception_support,
                            const WasmFeatures& enabled_features,
-                           LowerSimd lower_simd = kNoLowerSimd)
+                           LowerSimd lower_simd = kNoLowerSimd,
+                           DynamicTiering dynamic_tiering = kNoDynamicTiering)
       : module(module),
         use_trap_handler(use_trap_handler),
         runtime_exception_support(runtime_exception_support),
@@ -75,7 +85,8 @@ struct CompilationEnv {
                              : max_initial_mem_pages()) *
                         uint64_t{kWasmPageSize}),
         enabled_features(enabled_features),
-        lower_simd(lower_simd) {}
+        lower_simd(lower_simd),
+        dynamic_tiering(dynamic_tiering) {}
 };
 
 // The wire bytes are either owned by the StreamingDecoder, or (after streaming)
@@ -89,11 +100,15 @@ class WireBytesStorage {
 // Callbacks will receive either {kFailedCompilation} or both
 // {kFinishedBaselineCompilation} and {kFinishedTopTierCompilation}, in that
 // order. If tier up is off, both events are delivered right after each other.
+// With dynamic tiering, {kFinishedCompilationChunk} is delivered afterwards
+// whenever another {--wasm-caching-threshold} bytes of top tier code have been
+// generated for hot functions.
 enum class CompilationEvent : uint8_t {
   kFinishedBaselineCompilation,
   kFinishedTopTierCompilation,
   kFailedCompilation,
-  kFinishedRecompilation
+  kFinishedRecompilation,
+  kFinishedCompilationChunk
 };
 
 // The implementation of {CompilationState} lives in module-compiler.cc.
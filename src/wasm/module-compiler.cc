@@ -23,6 +23,7 @@
 #include "src/tracing/trace-event.h"
 #include "src/trap-handler/trap-handler.h"
 #include "src/utils/identity-map.h"
+#include "src/wasm/function-body-decoder.h"
 #include "src/wasm/module-decoder.h"
 #include "src/wasm/streaming-decoder.h"
 #include "src/wasm/wasm-code-manager.h"
@@ -256,6 +257,17 @@ class CompilationUnitQueues {
     }
   }
 
+  // Add a top tier unit that was triggered by dynamic tiering. These are
+  // compiled before all other top tier units, in the order of their
+  // {priority}: lower values first.
+  void AddTopTierPriorityUnit(WasmCompilationUnit unit, size_t priority) {
+    base::MutexGuard guard(&top_tier_priority_units_queue_.mutex);
+    num_units_[kTopTier].fetch_add(1, std::memory_order_relaxed);
+    top_tier_priority_units_queue_.has_units.store(true,
+                                                   std::memory_order_relaxed);
+    top_tier_priority_units_queue_.units.emplace(priority, unit);
+  }
+
   // Get the current total number of units in all queues. This is only a
   // momentary snapshot, it's not guaranteed that {GetNextUnit} returns a unit
   // if this method returns non-zero.
@@ -312,8 +324,33 @@ class CompilationUnitQueues {
     std::priority_queue<BigUnit> units[kNumTiers];
   };
 
+  struct TopTierPriorityUnit {
+    TopTierPriorityUnit(size_t priority, WasmCompilationUnit unit)
+        : priority(priority), unit(unit) {}
+
+    size_t priority;
+    WasmCompilationUnit unit;
+
+    // {std::priority_queue} returns the largest element first, but lower
+    // {priority} values should be compiled first.
+    bool operator<(const TopTierPriorityUnit& other) const {
+      return priority > other.priority;
+    }
+  };
+
+  struct TopTierPriorityUnitsQueue {
+    base::Mutex mutex;
+
+    // Can be read concurrently to check whether any elements are in the queue.
+    std::atomic<bool> has_units{false};
+
+    // Protected by {mutex}:
+    std::priority_queue<TopTierPriorityUnit> units;
+  };
+
   std::vector<Queue> queues_;
   BigUnitsQueue big_units_queue_;
+  TopTierPriorityUnitsQueue top_tier_priority_units_queue_;
 
   std::atomic<size_t> num_units_[kNumTiers];
   std::atomic<int> next_queue_to_add{0};
@@ -335,6 +372,12 @@ class CompilationUnitQueues {
     // First check whether there is a big unit of that tier. Execute that first.
     if (auto unit = GetBigUnitOfTier(tier)) return unit;
 
+    // Then check for top tier units requested by dynamic tiering, which are
+    // known to be hot.
+    if (tier == kTopTier) {
+      if (auto unit = GetTopTierPriorityUnit()) return unit;
+    }
+
     // Then check whether our own queue has a unit of the wanted tier. If
     // so, return it, otherwise get the task id to steal from.
     int steal_task_id;
@@ -378,6 +421,23 @@ class CompilationUnitQueues {
     return unit;
   }
 
+  base::Optional<WasmCompilationUnit> GetTopTierPriorityUnit() {
+    // Fast-path without locking.
+    if (!top_tier_priority_units_queue_.has_units.load(
+            std::memory_order_relaxed)) {
+      return {};
+    }
+    base::MutexGuard guard(&top_tier_priority_units_queue_.mutex);
+    if (top_tier_priority_units_queue_.units.empty()) return {};
+    WasmCompilationUnit unit = top_tier_priority_units_queue_.units.top().unit;
+    top_tier_priority_units_queue_.units.pop();
+    if (top_tier_priority_units_queue_.units.empty()) {
+      top_tier_priority_units_queue_.has_units.store(false,
+                                                     std::memory_order_relaxed);
+    }
+    return unit;
+  }
+
   // Steal units of {wanted_tier} from {steal_from_task_id} to {task_id}. Return
   // first stolen unit (rest put in queue of {task_id}), or {nullopt} if
   // {steal_from_task_id} had no units of {wanted_tier}.
@@ -415,6 +475,7 @@ class CompilationStateImpl {
  public:
   CompilationStateImpl(const std::shared_ptr<NativeModule>& native_module,
                        std::shared_ptr<Counters> async_counters);
+  ~CompilationStateImpl();
 
   // Cancel all background compilation and wait for all tasks to finish. Call
   // this before destructing this object.
@@ -445,6 +506,11 @@ class CompilationStateImpl {
       Vector<std::shared_ptr<JSToWasmWrapperCompilationUnit>>
           js_to_wasm_wrapper_units);
   void AddTopTierCompilationUnit(WasmCompilationUnit);
+  // Queues a top tier unit for a function that exhausted its tiering budget.
+  // Functions exhaust their budget in the order of their hotness, so these
+  // units are compiled in the order they are added, before any other top tier
+  // units.
+  void AddTopTierPriorityCompilationUnit(WasmCompilationUnit);
   base::Optional<WasmCompilationUnit> GetNextCompilationUnit(
       int task_id, CompileBaselineOnly baseline_only);
 
@@ -456,10 +522,18 @@ class CompilationStateImpl {
   void OnFinishedUnits(Vector<WasmCode*>);
   void OnFinishedJSToWasmWrapperUnits(int num);
 
+  // Background workers of the compile job use task ids to identify their
+  // queue in {compilation_unit_queues_}.
+  int GetUnusedTaskId();
   void OnBackgroundTaskStopped(int task_id, const WasmFeatures& detected);
   void UpdateDetectedFeatures(const WasmFeatures& detected);
   void PublishDetectedFeatures(Isolate*);
-  void RestartBackgroundTasks();
+  // Posts the background compile job, or notifies the running job that more
+  // units are available.
+  void ScheduleCompileJobForNewUnits();
+  // Number of background workers that could currently take part in
+  // compilation. Called without holding any lock.
+  size_t GetMaxCompileConcurrency() const;
 
   void SetError();
 
@@ -533,8 +607,13 @@ class CompilationStateImpl {
   void TriggerCallbacks(base::EnumSet<CompilationEvent> additional_events = {});
 
   NativeModule* const native_module_;
+  const std::weak_ptr<NativeModule> native_module_weak_;
   const std::shared_ptr<BackgroundCompileToken> background_compile_token_;
   const CompileMode compile_mode_;
+  // With dynamic tiering, hot functions keep getting tiered up after initial
+  // compilation finished, and callbacks stay installed to receive
+  // {kFinishedCompilationChunk} events.
+  const bool dynamic_tiering_;
   const std::shared_ptr<Counters> async_counters_;
 
   // Compilation error, atomically updated. This flag can be updated and read
@@ -552,6 +631,16 @@ class CompilationStateImpl {
   // tasks a fair chance to utilize the worker threads on a regular basis.
   std::atomic<double> next_compilation_deadline_{0};
 
+  // Priority of the next unit added by {AddTopTierPriorityCompilationUnit}.
+  std::atomic<size_t> next_top_tier_priority_{0};
+
+  // Protects {current_compile_job_} and {background_compile_job_cancelled_}.
+  // The job's tasks never take this mutex, hence it can be held while posting
+  // the job or notifying it.
+  base::Mutex compile_job_mutex_;
+  std::unique_ptr<JobHandle> current_compile_job_;
+  bool background_compile_job_cancelled_ = false;
+
   // Index of the next wrapper to compile in {js_to_wasm_wrapper_units_}.
   std::atomic<int> js_to_wasm_wrapper_id_{0};
   // Wrapper compilation units are stored in shared_ptrs so that they are kept
@@ -602,6 +691,10 @@ class CompilationStateImpl {
   int outstanding_recompilation_functions_ = 0;
   TieringState tiering_state_ = kTieredUp;
 
+  // Size of the top tier code generated since the last
+  // {kFinishedCompilationChunk} event.
+  size_t bytes_since_last_chunk_ = 0;
+
   // End of fields protected by {callbacks_mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
@@ -766,8 +859,11 @@ ExecutionTierPair GetRequestedExecutionTiers(
 
     case CompileMode::kTiering:
 
-      // Default tiering behaviour.
-      result.top_tier = ExecutionTier::kTurbofan;
+      // Default tiering behaviour. With dynamic tiering, functions only get
+      // recompiled with TurboFan once Liftoff code found them to be hot (see
+      // {TriggerTierUp}).
+      result.top_tier = FLAG_wasm_dynamic_tiering ? result.baseline_tier
+                                                  : ExecutionTier::kTurbofan;
 
       // Check if compilation hints override default tiering behaviour.
       if (enabled_features.has_compilation_hints()) {
@@ -1019,7 +1115,7 @@ void TriggerTierUp(Isolate* isolate, NativeModule* native_module,
       Impl(native_module->compilation_state());
   WasmCompilationUnit tiering_unit{func_index, ExecutionTier::kTurbofan,
                                    kNoDebugging};
-  compilation_state->AddTopTierCompilationUnit(tiering_unit);
+  compilation_state->AddTopTierPriorityCompilationUnit(tiering_unit);
 }
 
 namespace {
@@ -1029,7 +1125,8 @@ void RecordStats(const Code code, Counters* counters) {
   counters->wasm_reloc_size()->Increment(code.relocation_info().length());
 }
 
-constexpr int kMainThreadTaskId = -1;
+// The main thread takes part in compilation without a {JobDelegate}.
+constexpr JobDelegate* kMainThreadDelegate = nullptr;
 
 bool ExecuteJSToWasmWrapperCompilationUnits(
     const std::shared_ptr<BackgroundCompileToken>& token) {
@@ -1058,12 +1155,11 @@ bool ExecuteJSToWasmWrapperCompilationUnits(
   return true;
 }
 
-// Run by the main thread and background tasks to take part in compilation.
-// Returns whether any units were executed.
+// Run by the main thread and the workers of the background compile job to take
+// part in compilation. Returns whether any units were executed.
 bool ExecuteCompilationUnits(
     const std::shared_ptr<BackgroundCompileToken>& token, Counters* counters,
-    int task_id, CompileBaselineOnly baseline_only) {
-  TRACE_COMPILE("Compiling (task %d)...\n", task_id);
+    JobDelegate* delegate, CompileBaselineOnly baseline_only) {
   TRACE_EVENT0("v8.wasm", "wasm.ExecuteCompilationUnits");
 
   // Execute JS to Wasm wrapper units first, so that they are ready to be
@@ -1073,11 +1169,11 @@ bool ExecuteCompilationUnits(
     return false;
   }
 
-  const bool is_foreground = task_id == kMainThreadTaskId;
+  const bool is_foreground = delegate == kMainThreadDelegate;
   // The main thread uses task id 0, which might collide with one of the
-  // background tasks. This is fine, as it will only cause some contention on
+  // background workers. This is fine, as it will only cause some contention on
   // the one queue, but work otherwise.
-  if (is_foreground) task_id = 0;
+  int task_id = 0;
 
   Platform* platform = V8::GetCurrentPlatform();
   double compilation_start = platform->MonotonicallyIncreasingTime();
@@ -1092,7 +1188,7 @@ bool ExecuteCompilationUnits(
   base::Optional<WasmCompilationUnit> unit;
   WasmFeatures detected_features = WasmFeatures::None();
 
-  auto stop = [is_foreground, task_id,
+  auto stop = [is_foreground, &task_id,
                &detected_features](BackgroundCompileScope& compile_scope) {
     if (is_foreground) {
       compile_scope.compilation_state()->UpdateDetectedFeatures(
@@ -1109,7 +1205,12 @@ bool ExecuteCompilationUnits(
     BackgroundCompileScope compile_scope(token);
     if (compile_scope.cancelled()) return false;
     auto* compilation_state = compile_scope.compilation_state();
-    deadline = compilation_state->GetCompilationDeadline(compilation_start);
+    if (is_foreground) {
+      deadline = compilation_state->GetCompilationDeadline(compilation_start);
+    } else {
+      task_id = compilation_state->GetUnusedTaskId();
+    }
+    TRACE_COMPILE("Compiling (task %d)...\n", task_id);
     env.emplace(compile_scope.native_module()->CreateCompilationEnv());
     wire_bytes = compilation_state->GetWireBytesStorage();
     module = compile_scope.native_module()->shared_module();
@@ -1179,9 +1280,12 @@ bool ExecuteCompilationUnits(
         break;
       }
 
-      // Get next unit.
-      if (FLAG_predictable ||
-          deadline < platform->MonotonicallyIncreasingTime()) {
+      // Get next unit. Background workers yield when the job scheduler asks
+      // them to, the main thread gives up after its deadline.
+      bool yield = is_foreground
+                       ? deadline < platform->MonotonicallyIncreasingTime()
+                       : delegate->ShouldYield();
+      if (FLAG_predictable || yield) {
         unit = {};
       } else {
         unit = compile_scope.compilation_state()->GetNextCompilationUnit(
@@ -1257,6 +1361,67 @@ int AddImportWrapperUnits(NativeModule* native_module,
   return static_cast<int>(keys.size());
 }
 
+// Adds compilation units for the functions of a lazy module that are likely to
+// be called right after instantiation: the start function and the functions it
+// calls directly, and all exported functions. They are compiled in the
+// background and published before their first call, which then does not need
+// to stall in {WasmCompileLazy}. Other functions stay lazy.
+void AddPrefetchUnits(NativeModule* native_module,
+                      CompilationUnitBuilder* builder) {
+  const WasmModule* module = native_module->module();
+  DCHECK(IsLazyModule(module));
+  // Function bodies are only validated ahead of time without lazy validation;
+  // we must not compile invalid functions eagerly.
+  if (!FLAG_wasm_lazy_compilation_prefetch || FLAG_wasm_lazy_validation) {
+    return;
+  }
+  if (native_module->IsTieredDown()) return;
+  ModuleWireBytes wire_bytes(native_module->wire_bytes());
+  uint32_t start = module->num_imported_functions;
+  uint32_t end = start + module->num_declared_functions;
+  auto is_declared = [=](uint32_t func_index) {
+    return func_index >= start && func_index < end;
+  };
+
+  std::vector<uint32_t> functions;
+  for (const WasmExport& exp : module->export_table) {
+    if (exp.kind == kExternalFunction && is_declared(exp.index)) {
+      functions.push_back(exp.index);
+    }
+  }
+  if (module->start_function_index >= 0 &&
+      is_declared(module->start_function_index)) {
+    const WasmFunction& start_function =
+        module->functions[module->start_function_index];
+    functions.push_back(start_function.func_index);
+    AccountingAllocator allocator;
+    Zone zone(&allocator, ZONE_NAME);
+    BodyLocalDecls locals(&zone);
+    Vector<const uint8_t> code = wire_bytes.GetFunctionBytes(&start_function);
+    for (BytecodeIterator it(code.begin(), code.end(), &locals); it.has_next();
+         it.next()) {
+      WasmOpcode opcode = it.current();
+      if (opcode != kExprCallFunction && opcode != kExprReturnCall) continue;
+      uint32_t length;
+      uint32_t callee =
+          it.read_u32v<Decoder::kNoValidate>(it.pc() + 1, &length);
+      if (is_declared(callee)) functions.push_back(callee);
+    }
+  }
+
+  std::sort(functions.begin(), functions.end());
+  functions.erase(std::unique(functions.begin(), functions.end()),
+                  functions.end());
+  for (uint32_t func_index : functions) {
+    // Functions with compilation hints are handled by their strategy already.
+    if (GetCompileStrategy(module, native_module->enabled_features(),
+                           func_index, true) != CompileStrategy::kLazy) {
+      continue;
+    }
+    builder->AddUnits(func_index);
+  }
+}
+
 void InitializeCompilationUnits(Isolate* isolate, NativeModule* native_module) {
   CompilationStateImpl* compilation_state =
       Impl(native_module->compilation_state());
@@ -1285,6 +1450,7 @@ void InitializeCompilationUnits(Isolate* isolate, NativeModule* native_module) {
       builder.AddUnits(func_index);
     }
   }
+  if (lazy_module) AddPrefetchUnits(native_module, &builder);
   int num_import_wrappers = AddImportWrapperUnits(native_module, &builder);
   int num_export_wrappers =
       AddExportWrapperUnits(isolate, isolate->wasm_engine(), native_module,
@@ -1393,7 +1559,7 @@ void CompileNativeModule(Isolate* isolate, ErrorThrower* thrower,
   auto baseline_only = is_tiering ? kBaselineOnly : kBaselineOrTopTier;
   // The main threads contributes to the compilation.
   while (ExecuteCompilationUnits(compilation_state->background_compile_token(),
-                                 isolate->counters(), kMainThreadTaskId,
+                                 isolate->counters(), kMainThreadDelegate,
                                  baseline_only)) {
     // Continue executing compilation units.
   }
@@ -1411,27 +1577,43 @@ void CompileNativeModule(Isolate* isolate, ErrorThrower* thrower,
   }
 }
 
-// The runnable task that performs compilations in the background.
-class BackgroundCompileTask : public CancelableTask {
+// The job that performs compilations in the background. The number of workers
+// follows the number of queued units, so that compilation scales with units
+// arriving e.g. from streaming instead of a fixed number of tasks.
+class BackgroundCompileJob final : public JobTask {
  public:
-  explicit BackgroundCompileTask(CancelableTaskManager* manager,
-                                 std::shared_ptr<BackgroundCompileToken> token,
-                                 std::shared_ptr<Counters> async_counters,
-                                 int task_id)
-      : CancelableTask(manager),
+  BackgroundCompileJob(std::weak_ptr<NativeModule> native_module,
+                       std::shared_ptr<BackgroundCompileToken> token,
+                       std::shared_ptr<OperationsBarrier> engine_barrier,
+                       std::shared_ptr<Counters> async_counters)
+      : native_module_(std::move(native_module)),
         token_(std::move(token)),
-        async_counters_(std::move(async_counters)),
-        task_id_(task_id) {}
+        engine_barrier_(std::move(engine_barrier)),
+        async_counters_(std::move(async_counters)) {}
 
-  void RunInternal() override {
-    ExecuteCompilationUnits(token_, async_counters_.get(), task_id_,
+  void Run(JobDelegate* delegate) override {
+    // Workers are not tracked by the engine otherwise; keep it alive while
+    // compiling.
+    OperationsBarrier::Token barrier_token = engine_barrier_->TryLock();
+    if (!barrier_token) return;
+    ExecuteCompilationUnits(token_, async_counters_.get(), delegate,
                             kBaselineOrTopTier);
   }
 
+  size_t GetMaxConcurrency() const override {
+    // This is called by the job scheduler while holding its own lock, hence do
+    // not enter a {BackgroundCompileScope} here.
+    std::shared_ptr<NativeModule> native_module = native_module_.lock();
+    if (!native_module) return 0;
+    return Impl(native_module->compilation_state())
+        ->GetMaxCompileConcurrency();
+  }
+
  private:
+  const std::weak_ptr<NativeModule> native_module_;
   const std::shared_ptr<BackgroundCompileToken> token_;
+  const std::shared_ptr<OperationsBarrier> engine_barrier_;
   const std::shared_ptr<Counters> async_counters_;
-  const int task_id_;
 };
 
 }  // namespace
@@ -1510,7 +1692,7 @@ void RecompileNativeModule(NativeModule* native_module,
   // The main thread contributes to the compilation.
   constexpr Counters* kNoCounters = nullptr;
   while (ExecuteCompilationUnits(compilation_state->background_compile_token(),
-                                 kNoCounters, kMainThreadTaskId,
+                                 kNoCounters, kMainThreadDelegate,
                                  kBaselineOnly)) {
     // Continue executing compilation units.
   }
@@ -1811,6 +1993,10 @@ class AsyncCompileJob::CompilationStateCallback {
         // {kFinishedTopTierCompilation}, hence don't remember this in
         // {last_event_}.
         return;
+      case CompilationEvent::kFinishedCompilationChunk:
+        // This event happens after {kFinishedTopTierCompilation}, when the job
+        // is already gone.
+        return;
     }
 #ifdef DEBUG
     last_event_ = event;
@@ -2113,18 +2299,21 @@ class SampleTopTierCodeSizeCallback {
  public:
   explicit SampleTopTierCodeSizeCallback(
       std::weak_ptr<NativeModule> native_module)
-      : native_module_(std::move(native_module)) {}
+      : native_module_(std::move(native_module)),
+        start_time_(base::TimeTicks::Now()) {}
 
   void operator()(CompilationEvent event) {
     if (event != CompilationEvent::kFinishedTopTierCompilation) return;
     if (std::shared_ptr<NativeModule> native_module = native_module_.lock()) {
+      base::TimeDelta tier_up_time = base::TimeTicks::Now() - start_time_;
       native_module->engine()->SampleTopTierCodeSizeInAllIsolates(
-          native_module);
+          native_module, tier_up_time);
     }
   }
 
  private:
   std::weak_ptr<NativeModule> native_module_;
+  base::TimeTicks start_time_;
 };
 }  // namespace
 
@@ -2433,6 +2622,13 @@ void AsyncStreamingProcessor::OnFinishedStream(OwnedVector<uint8_t> bytes) {
     job_->native_module_->SetWireBytes(
         {std::move(job_->bytes_copy_), job_->wire_bytes_.length()});
     job_->native_module_->LogWasmCodes(job_->isolate_);
+    // Functions to prefetch can only be determined once all function bodies
+    // have arrived.
+    if (IsLazyModule(job_->native_module_->module())) {
+      CompilationUnitBuilder builder(job_->native_module_.get());
+      AddPrefetchUnits(job_->native_module_.get(), &builder);
+      builder.Commit();
+    }
   }
   const bool needs_finish = job_->DecrementAndCheckFinisherCount();
   DCHECK_IMPLIES(!has_code_section, needs_finish);
@@ -2498,12 +2694,15 @@ CompilationStateImpl::CompilationStateImpl(
     const std::shared_ptr<NativeModule>& native_module,
     std::shared_ptr<Counters> async_counters)
     : native_module_(native_module.get()),
+      native_module_weak_(native_module),
       background_compile_token_(
           std::make_shared<BackgroundCompileToken>(native_module)),
       compile_mode_(FLAG_wasm_tier_up &&
                             native_module->module()->origin == kWasmOrigin
                         ? CompileMode::kTiering
                         : CompileMode::kRegular),
+      dynamic_tiering_(compile_mode_ == CompileMode::kTiering &&
+                       FLAG_wasm_dynamic_tiering),
       async_counters_(std::move(async_counters)),
       max_background_tasks_(std::max(GetMaxBackgroundTasks(), 1)),
       compilation_unit_queues_(max_background_tasks_),
@@ -2515,8 +2714,23 @@ CompilationStateImpl::CompilationStateImpl(
   }
 }
 
+CompilationStateImpl::~CompilationStateImpl() {
+  // Do not wait for workers of the compile job here; this can run on one of
+  // them. They bail out once they see the cancelled token.
+  if (current_compile_job_ && current_compile_job_->IsRunning()) {
+    current_compile_job_->CancelAndDetach();
+  }
+}
+
 void CompilationStateImpl::AbortCompilation() {
   background_compile_token_->Cancel();
+  {
+    base::MutexGuard guard(&compile_job_mutex_);
+    background_compile_job_cancelled_ = true;
+    if (current_compile_job_ && current_compile_job_->IsRunning()) {
+      current_compile_job_->CancelAndDetach();
+    }
+  }
   // No more callbacks after abort.
   base::MutexGuard callbacks_guard(&callbacks_mutex_);
   callbacks_.clear();
@@ -2592,7 +2806,7 @@ void CompilationStateImpl::InitializeCompilationProgress(bool lazy_module,
         callback(CompilationEvent::kFinishedTopTierCompilation);
       }
       // Clear the callbacks because no more events will be delivered.
-      callbacks_.clear();
+      if (!dynamic_tiering_) callbacks_.clear();
     }
   }
 }
@@ -2669,10 +2883,12 @@ void CompilationStateImpl::AddCallback(CompilationState::callback_t callback) {
       callback(event);
     }
   }
-  constexpr base::EnumSet<CompilationEvent> kFinalEvents{
-      CompilationEvent::kFinishedTopTierCompilation,
+  base::EnumSet<CompilationEvent> final_events{
       CompilationEvent::kFailedCompilation};
-  if (!finished_events_.contains_any(kFinalEvents)) {
+  if (!dynamic_tiering_) {
+    final_events.Add(CompilationEvent::kFinishedTopTierCompilation);
+  }
+  if (!finished_events_.contains_any(final_events)) {
     callbacks_.emplace_back(std::move(callback));
   }
 }
@@ -2690,13 +2906,21 @@ void CompilationStateImpl::AddCompilationUnits(
                                    js_to_wasm_wrapper_units.begin(),
                                    js_to_wasm_wrapper_units.end());
 
-  RestartBackgroundTasks();
+  ScheduleCompileJobForNewUnits();
 }
 
 void CompilationStateImpl::AddTopTierCompilationUnit(WasmCompilationUnit unit) {
   AddCompilationUnits({}, {&unit, 1}, {});
 }
 
+void CompilationStateImpl::AddTopTierPriorityCompilationUnit(
+    WasmCompilationUnit unit) {
+  size_t priority =
+      next_top_tier_priority_.fetch_add(1, std::memory_order_relaxed);
+  compilation_unit_queues_.AddTopTierPriorityUnit(unit, priority);
+  ScheduleCompileJobForNewUnits();
+}
+
 std::shared_ptr<JSToWasmWrapperCompilationUnit>
 CompilationStateImpl::GetNextJSToWasmWrapperCompilationUnit() {
   int wrapper_id =
@@ -2740,12 +2964,27 @@ void CompilationStateImpl::OnFinishedUnits(Vector<WasmCode*> code_vector) {
 
   base::MutexGuard guard(&callbacks_mutex_);
 
+  base::EnumSet<CompilationEvent> triggered_events;
+
+  if (dynamic_tiering_) {
+    for (WasmCode* code : code_vector) {
+      if (code->tier() != ExecutionTier::kTurbofan) continue;
+      bytes_since_last_chunk_ += code->instructions().size();
+    }
+    if (bytes_since_last_chunk_ >=
+        static_cast<size_t>(FLAG_wasm_caching_threshold)) {
+      bytes_since_last_chunk_ = 0;
+      triggered_events.Add(CompilationEvent::kFinishedCompilationChunk);
+    }
+  }
+
   // In case of no outstanding compilation units we can return early.
   // This is especially important for lazy modules that were deserialized.
   // Compilation progress was not set up in these cases.
   if (outstanding_baseline_units_ == 0 &&
       outstanding_top_tier_functions_ == 0 &&
       outstanding_recompilation_functions_ == 0) {
+    if (!triggered_events.empty()) TriggerCallbacks(triggered_events);
     return;
   }
 
@@ -2759,8 +2998,6 @@ void CompilationStateImpl::OnFinishedUnits(Vector<WasmCode*> code_vector) {
   DCHECK_EQ(compilation_progress_.size(),
             native_module_->module()->num_declared_functions);
 
-  base::EnumSet<CompilationEvent> triggered_events;
-
   for (size_t i = 0; i < code_vector.size(); i++) {
     WasmCode* code = code_vector[i];
     DCHECK_NOT_NULL(code);
@@ -2859,9 +3096,11 @@ void CompilationStateImpl::TriggerCallbacks(
 
   // Don't trigger past events again.
   triggered_events -= finished_events_;
-  // Recompilation can happen multiple times, thus do not store this.
-  finished_events_ |=
-      triggered_events - CompilationEvent::kFinishedRecompilation;
+  // Recompilation and compilation chunks can happen multiple times, thus do
+  // not store these.
+  finished_events_ |= triggered_events -
+                      CompilationEvent::kFinishedRecompilation -
+                      CompilationEvent::kFinishedCompilationChunk;
 
   for (auto event :
        {std::make_pair(CompilationEvent::kFailedCompilation,
@@ -2871,7 +3110,9 @@ void CompilationStateImpl::TriggerCallbacks(
         std::make_pair(CompilationEvent::kFinishedTopTierCompilation,
                        "wasm.TopTierFinished"),
         std::make_pair(CompilationEvent::kFinishedRecompilation,
-                       "wasm.RecompilationFinished")}) {
+                       "wasm.RecompilationFinished"),
+        std::make_pair(CompilationEvent::kFinishedCompilationChunk,
+                       "wasm.CompilationChunkFinished")}) {
     if (!triggered_events.contains(event.first)) continue;
     TRACE_EVENT0("v8.wasm", event.second);
     for (auto& callback : callbacks_) {
@@ -2881,27 +3122,32 @@ void CompilationStateImpl::TriggerCallbacks(
 
   if (outstanding_baseline_units_ == 0 &&
       outstanding_top_tier_functions_ == 0 &&
-      outstanding_recompilation_functions_ == 0) {
+      outstanding_recompilation_functions_ == 0 && !dynamic_tiering_) {
     // Clear the callbacks because no more events will be delivered.
     callbacks_.clear();
   }
 }
 
+int CompilationStateImpl::GetUnusedTaskId() {
+  base::MutexGuard guard(&mutex_);
+  // The compile job never runs more than {max_background_tasks_} workers
+  // concurrently (see {GetMaxCompileConcurrency}).
+  DCHECK(!available_task_ids_.empty());
+  int task_id = available_task_ids_.back();
+  available_task_ids_.pop_back();
+  return task_id;
+}
+
 void CompilationStateImpl::OnBackgroundTaskStopped(
     int task_id, const WasmFeatures& detected) {
-  {
-    base::MutexGuard guard(&mutex_);
-    DCHECK_EQ(0, std::count(available_task_ids_.begin(),
-                            available_task_ids_.end(), task_id));
-    DCHECK_GT(max_background_tasks_, available_task_ids_.size());
-    available_task_ids_.push_back(task_id);
-    detected_features_.Add(detected);
-  }
-
-  // The background task could have stopped while we were adding new units, or
-  // because it reached its deadline. In both cases we need to restart tasks to
-  // avoid a potential deadlock.
-  RestartBackgroundTasks();
+  // The job scheduler restarts workers as long as units are available, so no
+  // rescheduling is needed here.
+  base::MutexGuard guard(&mutex_);
+  DCHECK_EQ(0, std::count(available_task_ids_.begin(),
+                          available_task_ids_.end(), task_id));
+  DCHECK_GT(max_background_tasks_, available_task_ids_.size());
+  available_task_ids_.push_back(task_id);
+  detected_features_.Add(detected);
 }
 
 void CompilationStateImpl::UpdateDetectedFeatures(
@@ -2918,43 +3164,33 @@ void CompilationStateImpl::PublishDetectedFeatures(Isolate* isolate) {
   UpdateFeatureUseCounts(isolate, detected_features_);
 }
 
-void CompilationStateImpl::RestartBackgroundTasks() {
-  // Create new tasks, but only spawn them after releasing the mutex, because
-  // some platforms (e.g. the predictable platform) might execute tasks right
-  // away.
-  std::vector<std::unique_ptr<Task>> new_tasks;
-  {
-    base::MutexGuard guard(&mutex_);
-    // Explicit fast path (quite common): If no more task ids are available
-    // (i.e. {max_background_tasks_} tasks are already running), spawn nothing.
-    if (available_task_ids_.empty()) return;
-    // No need to restart tasks if compilation already failed.
-    if (failed()) return;
-
-    size_t max_num_restart = compilation_unit_queues_.GetTotalSize();
-    if (js_to_wasm_wrapper_id_ <
-        static_cast<int>(js_to_wasm_wrapper_units_.size())) {
-      max_num_restart +=
-          js_to_wasm_wrapper_units_.size() - js_to_wasm_wrapper_id_;
-    }
-
-    while (!available_task_ids_.empty() && max_num_restart-- > 0) {
-      int task_id = available_task_ids_.back();
-      available_task_ids_.pop_back();
-      new_tasks.emplace_back(
-          native_module_->engine()
-              ->NewBackgroundCompileTask<BackgroundCompileTask>(
-                  background_compile_token_, async_counters_, task_id));
-    }
-  }
-
-  // Spawn all tasts with default priority (avoid
-  // {CallLowPriorityTaskOnWorkerThread}) even for tier up, because low priority
-  // tasks will be severely delayed even if background threads are idle (see
-  // https://crbug.com/1094928).
-  for (auto& task : new_tasks) {
-    V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
+void CompilationStateImpl::ScheduleCompileJobForNewUnits() {
+  if (failed()) return;
+
+  base::MutexGuard guard(&compile_job_mutex_);
+  if (background_compile_job_cancelled_) return;
+  if (current_compile_job_ && current_compile_job_->IsRunning()) {
+    current_compile_job_->NotifyConcurrencyIncrease();
+    return;
   }
+  // Post the job with default priority (avoid {TaskPriority::kBestEffort})
+  // even for tier up, because low priority tasks will be severely delayed even
+  // if background threads are idle (see https://crbug.com/1094928).
+  current_compile_job_ = V8::GetCurrentPlatform()->PostJob(
+      TaskPriority::kUserVisible,
+      std::make_unique<BackgroundCompileJob>(
+          native_module_weak_, background_compile_token_,
+          native_module_->engine()->operations_barrier(), async_counters_));
+}
+
+size_t CompilationStateImpl::GetMaxCompileConcurrency() const {
+  if (failed()) return 0;
+  size_t num_units = compilation_unit_queues_.GetTotalSize();
+  int num_wrapper_units =
+      static_cast<int>(js_to_wasm_wrapper_units_.size()) -
+      js_to_wasm_wrapper_id_.load(std::memory_order_relaxed);
+  if (num_wrapper_units > 0) num_units += num_wrapper_units;
+  return std::min(num_units, static_cast<size_t>(max_background_tasks_));
 }
 
 void CompilationStateImpl::SetError() {
@@ -314,14 +314,20 @@ class TopTierCompiledCallback {
         callback_(std::move(callback)) {}
 
   void operator()(CompilationEvent event) const {
-    if (event != CompilationEvent::kFinishedTopTierCompilation) return;
+    // With dynamic tiering, the module is offered again after each chunk of
+    // top tier code, so that caches also contain the code of hot functions.
+    if (event != CompilationEvent::kFinishedTopTierCompilation &&
+        event != CompilationEvent::kFinishedCompilationChunk) {
+      return;
+    }
     // If the native module is still alive, get back a shared ptr and call the
     // callback.
     if (std::shared_ptr<NativeModule> native_module = native_module_.lock()) {
       callback_(native_module);
     }
 #ifdef DEBUG
-    DCHECK(!called_);
+    DCHECK_IMPLIES(event == CompilationEvent::kFinishedTopTierCompilation,
+                   !called_);
     called_ = true;
 #endif
   }
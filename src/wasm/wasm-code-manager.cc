@@ -102,6 +102,14 @@ base::AddressRegion DisjointAllocationPool::Merge(
   return new_region;
 }
 
+bool DisjointAllocationPool::Contains(base::AddressRegion region) const {
+  // Find the last region starting at or below {region}.
+  auto it = regions_.upper_bound(region);
+  if (it == regions_.begin()) return false;
+  --it;
+  return it->contains(region);
+}
+
 base::AddressRegion DisjointAllocationPool::Allocate(size_t size) {
   return AllocateInRegion(size,
                           {kNullAddress, std::numeric_limits<size_t>::max()});
@@ -620,9 +628,48 @@ Vector<byte> WasmCodeAllocator::AllocateForCodeInRegion(
   DCHECK_EQ(code_manager_, native_module->engine()->code_manager());
   DCHECK_LT(0, size);
   v8::PageAllocator* page_allocator = GetPlatformPageAllocator();
+  const Address commit_page_size = page_allocator->CommitPageSize();
   size = RoundUp<kCodeAlignment>(size);
+  // Reuse code space freed by code GC first. This keeps live code dense after
+  // tier-up instead of spreading it over ever more pages and reservations.
+  // Freed space lies within the region of the jump tables it was allocated
+  // for, so {region} restrictions still hold.
   base::AddressRegion code_space =
-      free_code_space_.AllocateInRegion(size, region);
+      freed_code_space_.AllocateInRegion(size, region);
+  if (!code_space.is_empty()) {
+    // {FreeCode} discarded exactly the pages that were completely free, so
+    // recommit the pages this allocation touches that were completely free
+    // before. Those in between are covered by the allocation itself.
+    auto was_discarded = [&](Address page_start) {
+      Address page_end = page_start + commit_page_size;
+      if (page_start < code_space.begin() &&
+          !freed_code_space_.Contains(
+              {page_start, code_space.begin() - page_start})) {
+        return false;
+      }
+      return code_space.end() >= page_end ||
+             freed_code_space_.Contains(
+                 {code_space.end(), page_end - code_space.end()});
+    };
+    Address commit_start = RoundDown(code_space.begin(), commit_page_size);
+    if (!was_discarded(commit_start)) commit_start += commit_page_size;
+    Address commit_end = RoundUp(code_space.end(), commit_page_size);
+    if (commit_start < commit_end &&
+        !was_discarded(commit_end - commit_page_size)) {
+      commit_end -= commit_page_size;
+    }
+    if (commit_start < commit_end) {
+      Commit(commit_start, commit_end);
+    }
+    // Freed code space was never removed from {allocated_code_space_}.
+    generated_code_size_.fetch_add(code_space.size(),
+                                   std::memory_order_relaxed);
+    TRACE_HEAP("Code alloc for %p (reused): 0x%" PRIxPTR ",+%zu\n", this,
+               code_space.begin(), size);
+    return {reinterpret_cast<byte*>(code_space.begin()), code_space.size()};
+  }
+
+  code_space = free_code_space_.AllocateInRegion(size, region);
   if (V8_UNLIKELY(code_space.is_empty())) {
     // Only allocations without a specific region are allowed to fail. Otherwise
     // the region must have been allocated big enough to hold all initial
@@ -654,7 +701,6 @@ Vector<byte> WasmCodeAllocator::AllocateForCodeInRegion(
     async_counters_->wasm_module_num_code_spaces()->AddSample(
         static_cast<int>(owned_code_space_.size()));
   }
-  const Address commit_page_size = page_allocator->CommitPageSize();
   Address commit_start = RoundUp(code_space.begin(), commit_page_size);
   Address commit_end = RoundUp(code_space.end(), commit_page_size);
   // {commit_start} will be either code_space.start or the start of the next
@@ -666,16 +712,7 @@ Vector<byte> WasmCodeAllocator::AllocateForCodeInRegion(
   // start is already committed (or we start at the beginning of a page).
   // The end needs to be committed all through the end of the page.
   if (commit_start < commit_end) {
-    committed_code_space_.fetch_add(commit_end - commit_start);
-    // Committed code cannot grow bigger than maximum code space size.
-    DCHECK_LE(committed_code_space_.load(), kMaxWasmCodeMemory);
-    for (base::AddressRegion split_range : SplitRangeByReservationsIfNeeded(
-             {commit_start, commit_end - commit_start}, owned_code_space_)) {
-      if (!code_manager_->Commit(split_range)) {
-        V8::FatalProcessOutOfMemory(nullptr, "wasm code commit");
-        UNREACHABLE();
-      }
-    }
+    Commit(commit_start, commit_end);
   }
   DCHECK(IsAligned(code_space.begin(), kCodeAlignment));
   allocated_code_space_.Merge(code_space);
@@ -686,6 +723,19 @@ Vector<byte> WasmCodeAllocator::AllocateForCodeInRegion(
   return {reinterpret_cast<byte*>(code_space.begin()), code_space.size()};
 }
 
+void WasmCodeAllocator::Commit(Address start, Address end) {
+  committed_code_space_.fetch_add(end - start);
+  // Committed code cannot grow bigger than maximum code space size.
+  DCHECK_LE(committed_code_space_.load(), kMaxWasmCodeMemory);
+  for (base::AddressRegion split_range : SplitRangeByReservationsIfNeeded(
+           {start, end - start}, owned_code_space_)) {
+    if (!code_manager_->Commit(split_range)) {
+      V8::FatalProcessOutOfMemory(nullptr, "wasm code commit");
+      UNREACHABLE();
+    }
+  }
+}
+
 bool WasmCodeAllocator::SetExecutable(bool executable) {
   base::MutexGuard lock(&mutex_);
   if (is_executable_ == executable) return true;
@@ -845,8 +895,15 @@ void NativeModule::LogWasmCodes(Isolate* isolate) {
 }
 
 CompilationEnv NativeModule::CreateCompilationEnv() const {
-  return {module(), use_trap_handler_, kRuntimeExceptionSupport,
-          enabled_features_, kNoLowerSimd};
+  // Dynamic tiering only applies to modules that tier up at all.
+  const bool dynamic_tiering = FLAG_wasm_dynamic_tiering && FLAG_wasm_tier_up &&
+                               module()->origin == kWasmOrigin;
+  return {module(),
+          use_trap_handler_,
+          kRuntimeExceptionSupport,
+          enabled_features_,
+          kNoLowerSimd,
+          dynamic_tiering ? kDynamicTiering : kNoDynamicTiering};
 }
 
 WasmCode* NativeModule::AddCodeForTesting(Handle<Code> code) {
@@ -106,6 +106,9 @@ class V8_EXPORT_PRIVATE DisjointAllocationPool final {
   // empty pool on failure.
   base::AddressRegion AllocateInRegion(size_t size, base::AddressRegion);
 
+  // Check whether {region} is completely contained in this pool.
+  bool Contains(base::AddressRegion) const;
+
   bool IsEmpty() const { return regions_.empty(); }
 
   const auto& regions() const { return regions_; }
@@ -427,6 +430,10 @@ class WasmCodeAllocator {
   static constexpr base::AddressRegion kUnrestrictedRegion{
       kNullAddress, std::numeric_limits<size_t>::max()};
 
+  // Commit the pages in [start, end), which must be page aligned. Fails with
+  // OOM (crash) if that is not possible. Must be called with {mutex_} held.
+  void Commit(Address start, Address end);
+
   // The engine-wide wasm code manager.
   WasmCodeManager* const code_manager_;
 
@@ -441,7 +448,8 @@ class WasmCodeAllocator {
   // Code space that was allocated for code (subset of {owned_code_space_}).
   DisjointAllocationPool allocated_code_space_;
   // Code space that was allocated before but is dead now. Full pages within
-  // this region are discarded. It's still a subset of {owned_code_space_}.
+  // this region are discarded. It's still a subset of {owned_code_space_} and
+  // of {allocated_code_space_}, and is reused before any new code space.
   DisjointAllocationPool freed_code_space_;
   std::vector<VirtualMemory> owned_code_space_;
 
@@ -581,6 +589,10 @@ class V8_EXPORT_PRIVATE NativeModule final {
   size_t committed_code_space() const {
     return code_allocator_.committed_code_space();
   }
+  size_t generated_code_size() const {
+    return code_allocator_.generated_code_size();
+  }
+  size_t freed_code_size() const { return code_allocator_.freed_code_size(); }
   WasmEngine* engine() const { return engine_; }
 
   bool HasWireBytes() const {
@@ -12,6 +12,7 @@
 #include "src/execution/frames.h"
 #include "src/execution/v8threads.h"
 #include "src/logging/counters.h"
+#include "src/logging/metrics.h"
 #include "src/objects/heap-number.h"
 #include "src/objects/js-promise.h"
 #include "src/objects/objects-inl.h"
@@ -164,9 +165,11 @@ class WeakScriptHandle {
 std::shared_ptr<NativeModule> NativeModuleCache::MaybeGetNativeModule(
     ModuleOrigin origin, Vector<const uint8_t> wire_bytes) {
   if (origin != kWasmOrigin) return nullptr;
-  base::MutexGuard lock(&mutex_);
+  // Hash outside of the lock, which is shared by all isolates.
   size_t prefix_hash = PrefixHash(wire_bytes);
-  NativeModuleCache::Key key{prefix_hash, wire_bytes};
+  NativeModuleCache::Key key{prefix_hash, WireBytesHash(wire_bytes),
+                             wire_bytes};
+  base::MutexGuard lock(&mutex_);
   while (true) {
     auto it = map_.find(key);
     if (it == map_.end()) {
@@ -196,13 +199,13 @@ std::shared_ptr<NativeModule> NativeModuleCache::MaybeGetNativeModule(
 
 bool NativeModuleCache::GetStreamingCompilationOwnership(size_t prefix_hash) {
   base::MutexGuard lock(&mutex_);
-  auto it = map_.lower_bound(Key{prefix_hash, {}});
+  auto it = map_.lower_bound(Key{prefix_hash, 0, {}});
   if (it != map_.end() && it->first.prefix_hash == prefix_hash) {
     DCHECK_IMPLIES(!it->first.bytes.empty(),
                    PrefixHash(it->first.bytes) == prefix_hash);
     return false;
   }
-  Key key{prefix_hash, {}};
+  Key key{prefix_hash, 0, {}};
   DCHECK_EQ(0, map_.count(key));
   map_.emplace(key, base::nullopt);
   return true;
@@ -210,7 +213,7 @@ bool NativeModuleCache::GetStreamingCompilationOwnership(size_t prefix_hash) {
 
 void NativeModuleCache::StreamingCompilationFailed(size_t prefix_hash) {
   base::MutexGuard lock(&mutex_);
-  Key key{prefix_hash, {}};
+  Key key{prefix_hash, 0, {}};
   DCHECK_EQ(1, map_.count(key));
   map_.erase(key);
   cache_cv_.NotifyAll();
@@ -223,9 +226,10 @@ std::shared_ptr<NativeModule> NativeModuleCache::Update(
   Vector<const uint8_t> wire_bytes = native_module->wire_bytes();
   DCHECK(!wire_bytes.empty());
   size_t prefix_hash = PrefixHash(native_module->wire_bytes());
+  size_t bytes_hash = WireBytesHash(wire_bytes);
   base::MutexGuard lock(&mutex_);
-  map_.erase(Key{prefix_hash, {}});
-  const Key key{prefix_hash, wire_bytes};
+  map_.erase(Key{prefix_hash, 0, {}});
+  const Key key{prefix_hash, bytes_hash, wire_bytes};
   auto it = map_.find(key);
   if (it != map_.end()) {
     if (it->second.has_value()) {
@@ -254,9 +258,10 @@ void NativeModuleCache::Erase(NativeModule* native_module) {
   if (native_module->module()->origin != kWasmOrigin) return;
   // Happens in some tests where bytes are set directly.
   if (native_module->wire_bytes().empty()) return;
-  base::MutexGuard lock(&mutex_);
   size_t prefix_hash = PrefixHash(native_module->wire_bytes());
-  map_.erase(Key{prefix_hash, native_module->wire_bytes()});
+  size_t bytes_hash = WireBytesHash(native_module->wire_bytes());
+  base::MutexGuard lock(&mutex_);
+  map_.erase(Key{prefix_hash, bytes_hash, native_module->wire_bytes()});
   cache_cv_.NotifyAll();
 }
 
@@ -401,8 +406,8 @@ WasmEngine::~WasmEngine() {
   gdb_server_.reset();
 #endif  // V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
 
-  // Synchronize on all background compile tasks.
-  background_compile_task_manager_.CancelAndWait();
+  // Synchronize on all background compile jobs.
+  operations_barrier_->CancelAndWait();
   // All AsyncCompileJobs have been canceled.
   DCHECK(async_compile_jobs_.empty());
   // All Isolates have been deregistered.
@@ -1155,33 +1160,46 @@ namespace {
 class SampleTopTierCodeSizeTask : public CancelableTask {
  public:
   SampleTopTierCodeSizeTask(Isolate* isolate,
-                            std::weak_ptr<NativeModule> native_module)
+                            std::weak_ptr<NativeModule> native_module,
+                            base::TimeDelta tier_up_time)
       : CancelableTask(isolate),
         isolate_(isolate),
-        native_module_(std::move(native_module)) {}
+        native_module_(std::move(native_module)),
+        tier_up_time_(tier_up_time) {}
 
   void RunInternal() override {
     if (std::shared_ptr<NativeModule> native_module = native_module_.lock()) {
       native_module->SampleCodeSize(isolate_->counters(),
                                     NativeModule::kAfterTopTier);
+      v8::metrics::WasmModuleTieredUp event;
+      event.code_size_in_bytes = native_module->generated_code_size();
+      event.committed_code_size_in_bytes =
+          native_module->committed_code_space();
+      event.freed_code_size_in_bytes = native_module->freed_code_size();
+      event.wall_clock_time_in_us = tier_up_time_.InMicroseconds();
+      isolate_->metrics_recorder()->AddMainThreadEvent(
+          event, v8::metrics::Recorder::ContextId::Empty());
     }
   }
 
  private:
   Isolate* const isolate_;
   const std::weak_ptr<NativeModule> native_module_;
+  const base::TimeDelta tier_up_time_;
 };
 }  // namespace
 
 void WasmEngine::SampleTopTierCodeSizeInAllIsolates(
-    const std::shared_ptr<NativeModule>& native_module) {
+    const std::shared_ptr<NativeModule>& native_module,
+    base::TimeDelta tier_up_time) {
   base::MutexGuard lock(&mutex_);
   DCHECK_EQ(1, native_modules_.count(native_module.get()));
   for (Isolate* isolate : native_modules_[native_module.get()]->isolates) {
     DCHECK_EQ(1, isolates_.count(isolate));
     IsolateInfo* info = isolates_[isolate].get();
     info->foreground_task_runner->PostTask(
-        std::make_unique<SampleTopTierCodeSizeTask>(isolate, native_module));
+        std::make_unique<SampleTopTierCodeSizeTask>(isolate, native_module,
+                                                    tier_up_time));
   }
 }
 
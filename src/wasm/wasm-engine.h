@@ -13,7 +13,9 @@
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/tasks/cancelable-task.h"
+#include "src/tasks/operations-barrier.h"
 #include "src/wasm/wasm-code-manager.h"
 #include "src/wasm/wasm-tier.h"
 #include "src/zone/accounting-allocator.h"
@@ -63,11 +65,15 @@ class NativeModuleCache {
     // Store the prefix hash as part of the key for faster lookup, and to
     // quickly check existing prefixes for streaming compilation.
     size_t prefix_hash;
+    // Hash of the full wire bytes, so that modules with the same prefix are
+    // only compared byte by byte on a hash collision.
+    size_t bytes_hash;
     Vector<const uint8_t> bytes;
 
     bool operator==(const Key& other) const {
       bool eq = bytes == other.bytes;
       DCHECK_IMPLIES(eq, prefix_hash == other.prefix_hash);
+      DCHECK_IMPLIES(eq, bytes_hash == other.bytes_hash);
       return eq;
     }
 
@@ -77,9 +83,15 @@ class NativeModuleCache {
                        bytes != other.bytes);
         return prefix_hash < other.prefix_hash;
       }
+      // Compare sizes before the full hash, so that the streaming entry with
+      // empty bytes comes first among all entries with the same prefix.
       if (bytes.size() != other.bytes.size()) {
         return bytes.size() < other.bytes.size();
       }
+      if (bytes_hash != other.bytes_hash) {
+        DCHECK_NE(bytes, other.bytes);
+        return bytes_hash < other.bytes_hash;
+      }
       // Fast path when the base pointers are the same.
       // Also handles the {nullptr} case which would be UB for memcmp.
       if (bytes.begin() == other.bytes.begin()) {
@@ -243,10 +255,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
   void AddIsolate(Isolate* isolate);
   void RemoveIsolate(Isolate* isolate);
 
-  template <typename T, typename... Args>
-  std::unique_ptr<T> NewBackgroundCompileTask(Args&&... args) {
-    return std::make_unique<T>(&background_compile_task_manager_,
-                               std::forward<Args>(args)...);
+  // Background compile jobs hold a token of this barrier while they run, so
+  // that the engine outlives them.
+  const std::shared_ptr<OperationsBarrier>& operations_barrier() const {
+    return operations_barrier_;
   }
 
   // Trigger code logging for the given code objects in all Isolates which have
@@ -312,9 +324,12 @@ class V8_EXPORT_PRIVATE WasmEngine {
   void FreeNativeModule(NativeModule*);
 
   // Sample the code size of the given {NativeModule} in all isolates that have
-  // access to it. Call this after top-tier compilation finished.
+  // access to it, and report a {WasmModuleTieredUp} event to their metrics
+  // recorders. Call this after top-tier compilation finished, which took
+  // {tier_up_time} since baseline compilation finished.
   // This will spawn foreground tasks that do *not* keep the NativeModule alive.
-  void SampleTopTierCodeSizeInAllIsolates(const std::shared_ptr<NativeModule>&);
+  void SampleTopTierCodeSizeInAllIsolates(const std::shared_ptr<NativeModule>&,
+                                          base::TimeDelta tier_up_time);
 
   // Called by each Isolate to report its live code for a GC cycle. First
   // version reports an externally determined set of live code (might be empty),
@@ -372,9 +387,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
   WasmCodeManager code_manager_;
   AccountingAllocator allocator_;
 
-  // Task manager managing all background compile jobs. Before shut down of the
-  // engine, they must all be finished because they access the allocator.
-  CancelableTaskManager background_compile_task_manager_;
+  // Barrier for all background compile jobs. Before shut down of the engine,
+  // they must all be finished because they access the allocator.
+  std::shared_ptr<OperationsBarrier> operations_barrier_{
+      std::make_shared<OperationsBarrier>()};
 
 #ifdef V8_ENABLE_WASM_GDB_REMOTE_DEBUGGING
   // Implements a GDB-remote stub for WebAssembly debugging.
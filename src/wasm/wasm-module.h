@@ -110,6 +110,12 @@ struct WasmTable {
   bool has_maximum_size = false;  // true if there is a maximum size.
   bool imported = false;        // true if imported.
   bool exported = false;        // true if exported.
+
+  // A table whose maximum size is its initial size can never grow, also if
+  // it is imported, so its size and backing arrays are fixed per instance.
+  bool has_fixed_size() const {
+    return has_maximum_size && maximum_size == initial_size;
+  }
 };
 
 // Static representation of wasm element segment (table initializer).
@@ -300,6 +300,7 @@ NativeModuleSerializer::NativeModuleSerializer(
 
 size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
   if (code == nullptr) return sizeof(bool);
+  DCHECK(!code->for_debugging());
   DCHECK_EQ(WasmCode::kFunction, code->kind());
   return kCodeHeaderSize + code->instructions().size() +
          code->reloc_info().size() + code->source_positions().size() +
@@ -327,6 +328,7 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
     writer->Write(false);
     return;
   }
+  DCHECK(!code->for_debugging());
   writer->Write(true);
   DCHECK_EQ(WasmCode::kFunction, code->kind());
   // Write the size of the entire code section, followed by the code header.
@@ -431,7 +433,15 @@ bool NativeModuleSerializer::Write(Writer* writer) {
 
 WasmSerializer::WasmSerializer(NativeModule* native_module)
     : native_module_(native_module),
-      code_table_(native_module->SnapshotCodeTable()) {}
+      code_table_(native_module->SnapshotCodeTable()) {
+  // The code table can mix Liftoff and TurboFan code while the module is being
+  // tiered up. Code compiled for debugging is not worth caching; those
+  // functions are serialized like functions that were never compiled, and get
+  // compiled lazily after deserialization.
+  for (WasmCode*& code : code_table_) {
+    if (code != nullptr && code->for_debugging()) code = nullptr;
+  }
+}
 
 size_t WasmSerializer::GetSerializedNativeModuleSize() const {
   NativeModuleSerializer serializer(native_module_, VectorOf(code_table_));
@@ -495,8 +505,8 @@ bool NativeModuleDeserializer::ReadHeader(Reader* reader) {
 bool NativeModuleDeserializer::ReadCode(int fn_index, Reader* reader) {
   bool has_code = reader->Read<bool>();
   if (!has_code) {
-    DCHECK(FLAG_wasm_lazy_compilation ||
-           native_module_->enabled_features().has_compilation_hints());
+    // The function was not compiled yet when the module was serialized, e.g.
+    // because of lazy compilation. Compile it on its first call.
     native_module_->UseLazyStub(fn_index);
     return true;
   }
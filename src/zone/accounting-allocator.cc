@@ -74,28 +74,40 @@ AccountingAllocator::AccountingAllocator() {
   }
 }
 
-AccountingAllocator::~AccountingAllocator() = default;
+AccountingAllocator::~AccountingAllocator() { ReleasePooledSegments(); }
 
 Segment* AccountingAllocator::AllocateSegment(size_t bytes,
                                               bool supports_compression) {
-  void* memory;
-  if (COMPRESS_ZONES_BOOL && supports_compression) {
+  const bool compressed = COMPRESS_ZONES_BOOL && supports_compression;
+  size_t bucket = kNoBucket;
+  if (compressed) {
     bytes = RoundUp(bytes, kZonePageSize);
+    if (bytes == kZonePageSize) bucket = kCompressedBucket;
+  } else if (BucketIndex(bytes) < kNumberBuckets) {
+    bucket = BucketIndex(bytes);
+    bytes = size_t{1} << (kMinSegmentSizePower + bucket);
+  }
+  if (bucket != kNoBucket) {
+    Segment* segment = GetSegmentFromPool(bucket);
+    if (segment != nullptr) {
+      DCHECK_EQ(bytes, segment->total_size());
+      segment_pool_hits_.fetch_add(1, std::memory_order_relaxed);
+      UpdateMemoryUsage(bytes);
+      return new (segment) Segment(bytes);
+    }
+    segment_pool_misses_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void* memory;
+  if (compressed) {
     memory = AllocatePages(bounded_page_allocator_.get(), nullptr, bytes,
                            kZonePageSize, PageAllocator::kReadWrite);
-
   } else {
     memory = AllocWithRetry(bytes);
   }
   if (memory == nullptr) return nullptr;
 
-  size_t current =
-      current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
-  size_t max = max_memory_usage_.load(std::memory_order_relaxed);
-  while (current > max && !max_memory_usage_.compare_exchange_weak(
-                              max, current, std::memory_order_relaxed)) {
-    // {max} was updated by {compare_exchange_weak}; retry.
-  }
+  UpdateMemoryUsage(bytes);
   DCHECK_LE(sizeof(Segment), bytes);
   return new (memory) Segment(bytes);
 }
@@ -105,14 +117,95 @@ void AccountingAllocator::ReturnSegment(Segment* segment,
   segment->ZapContents();
   size_t segment_size = segment->total_size();
   current_memory_usage_.fetch_sub(segment_size, std::memory_order_relaxed);
-  segment->ZapHeader();
   if (COMPRESS_ZONES_BOOL && supports_compression) {
-    CHECK(FreePages(bounded_page_allocator_.get(), segment, segment_size));
+    if (segment_size == kZonePageSize &&
+        AddSegmentToPool(segment, kCompressedBucket)) {
+      return;
+    }
+    FreeSegment(segment, true);
+    return;
+  }
+  size_t bucket = BucketIndex(segment_size);
+  if (bucket < kNumberBuckets &&
+      segment_size == size_t{1} << (kMinSegmentSizePower + bucket) &&
+      AddSegmentToPool(segment, bucket)) {
+    return;
+  }
+  FreeSegment(segment, false);
+}
+
+void AccountingAllocator::ReleasePooledSegments() {
+  Segment* heads[kNumberBuckets + 1];
+  {
+    base::MutexGuard guard(&pool_mutex_);
+    for (size_t i = 0; i <= kNumberBuckets; i++) {
+      heads[i] = unused_segments_heads_[i];
+      unused_segments_heads_[i] = nullptr;
+      unused_segments_sizes_[i] = 0;
+    }
+    current_pool_size_.store(0, std::memory_order_relaxed);
+  }
+  for (size_t i = 0; i <= kNumberBuckets; i++) {
+    Segment* segment = heads[i];
+    while (segment != nullptr) {
+      Segment* next = segment->next();
+      FreeSegment(segment, i == kCompressedBucket);
+      segment = next;
+    }
+  }
+}
 
+void AccountingAllocator::FreeSegment(Segment* segment, bool compressed) {
+  size_t segment_size = segment->total_size();
+  segment->ZapHeader();
+  if (compressed) {
+    CHECK(FreePages(bounded_page_allocator_.get(), segment, segment_size));
   } else {
     free(segment);
   }
 }
 
+// static
+size_t AccountingAllocator::BucketIndex(size_t bytes) {
+  size_t power = kMinSegmentSizePower;
+  while (power <= kMaxSegmentSizePower && (size_t{1} << power) < bytes) {
+    power++;
+  }
+  return power - kMinSegmentSizePower;
+}
+
+Segment* AccountingAllocator::GetSegmentFromPool(size_t bucket) {
+  base::MutexGuard guard(&pool_mutex_);
+  Segment* segment = unused_segments_heads_[bucket];
+  if (segment == nullptr) return nullptr;
+  unused_segments_heads_[bucket] = segment->next();
+  unused_segments_sizes_[bucket]--;
+  current_pool_size_.fetch_sub(segment->total_size(),
+                               std::memory_order_relaxed);
+  return segment;
+}
+
+bool AccountingAllocator::AddSegmentToPool(Segment* segment, size_t bucket) {
+  base::MutexGuard guard(&pool_mutex_);
+  if (unused_segments_sizes_[bucket] >= kMaxSegmentsPerBucket) return false;
+  segment->set_zone(nullptr);
+  segment->set_next(unused_segments_heads_[bucket]);
+  unused_segments_heads_[bucket] = segment;
+  unused_segments_sizes_[bucket]++;
+  current_pool_size_.fetch_add(segment->total_size(),
+                               std::memory_order_relaxed);
+  return true;
+}
+
+void AccountingAllocator::UpdateMemoryUsage(size_t bytes) {
+  size_t current =
+      current_memory_usage_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  size_t max = max_memory_usage_.load(std::memory_order_relaxed);
+  while (current > max && !max_memory_usage_.compare_exchange_weak(
+                              max, current, std::memory_order_relaxed)) {
+    // {max} was updated by {compare_exchange_weak}; retry.
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
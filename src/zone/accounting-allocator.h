@@ -9,6 +9,7 @@
 #include <memory>
 
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 #include "src/logging/tracing-flags.h"
 
 namespace v8 {
@@ -43,6 +44,22 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
     return max_memory_usage_.load(std::memory_order_relaxed);
   }
 
+  // Bytes held by returned segments that are kept for reuse.
+  size_t GetCurrentPoolSize() const {
+    return current_pool_size_.load(std::memory_order_relaxed);
+  }
+
+  // Number of segment allocations that were (not) served from the pool.
+  size_t GetSegmentPoolHits() const {
+    return segment_pool_hits_.load(std::memory_order_relaxed);
+  }
+  size_t GetSegmentPoolMisses() const {
+    return segment_pool_misses_.load(std::memory_order_relaxed);
+  }
+
+  // Frees all pooled segments, e.g. on memory pressure.
+  void ReleasePooledSegments();
+
   void TraceZoneCreation(const Zone* zone) {
     if (V8_LIKELY(!TracingFlags::is_zone_stats_enabled())) return;
     TraceZoneCreationImpl(zone);
@@ -64,9 +81,38 @@ class V8_EXPORT_PRIVATE AccountingAllocator {
   virtual void TraceAllocateSegmentImpl(Segment* segment) {}
 
  private:
+  // Segments of up to 2^kMaxSegmentSizePower bytes are rounded up to the next
+  // power of two and recycled by size class instead of going back to malloc.
+  // This covers every segment a zone allocates unless a single allocation
+  // exceeds Zone::kMaximumSegmentSize.
+  static const size_t kMinSegmentSizePower = 13;
+  static const size_t kMaxSegmentSizePower = 15;
+  static const size_t kNumberBuckets =
+      1 + kMaxSegmentSizePower - kMinSegmentSizePower;
+  static const size_t kMaxSegmentsPerBucket = 8;
+  // Single-page segments from the compressed zone reservation are recycled
+  // in an extra bucket, saving the page allocator round trip.
+  static const size_t kCompressedBucket = kNumberBuckets;
+  static const size_t kNoBucket = kNumberBuckets + 1;
+
+  static size_t BucketIndex(size_t bytes);
+
+  Segment* GetSegmentFromPool(size_t bucket);
+  bool AddSegmentToPool(Segment* segment, size_t bucket);
+  void FreeSegment(Segment* segment, bool compressed);
+  void UpdateMemoryUsage(size_t bytes);
+
   std::atomic<size_t> current_memory_usage_{0};
   std::atomic<size_t> max_memory_usage_{0};
 
+  std::atomic<size_t> current_pool_size_{0};
+  std::atomic<size_t> segment_pool_hits_{0};
+  std::atomic<size_t> segment_pool_misses_{0};
+
+  base::Mutex pool_mutex_;
+  Segment* unused_segments_heads_[kNumberBuckets + 1] = {};
+  size_t unused_segments_sizes_[kNumberBuckets + 1] = {};
+
   std::unique_ptr<VirtualMemory> reserved_area_;
   std::unique_ptr<base::BoundedPageAllocator> bounded_page_allocator_;
 
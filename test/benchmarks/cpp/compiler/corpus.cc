@@ -0,0 +1,124 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/benchmarks/cpp/compiler/corpus.h"
+
+#include <sstream>
+
+namespace v8 {
+namespace internal {
+namespace testing {
+
+std::string FrameworkReducerSource(int size) {
+  std::ostringstream os;
+  os << "function f(state, action) {\n"
+     << "  switch (action.type) {\n";
+  for (int i = 0; i < size; ++i) {
+    int field = i % 8;
+    os << "    case 'ACTION_" << i << "':\n"
+       << "      return Object.assign({}, state, {\n"
+       << "        field" << field << ": state.field" << field
+       << " + action.payload.value,\n"
+       << "        items: action.payload.keep ? state.items :\n"
+       << "            state.items.concat([action.payload]),\n"
+       << "        last: '" << i << "'\n"
+       << "      });\n";
+  }
+  os << "    default:\n"
+     << "      return state;\n"
+     << "  }\n"
+     << "}\n"
+     << "var state = {field0: 0, field1: 0, field2: 0, field3: 0, field4: 0,\n"
+     << "             field5: 0, field6: 0, field7: 0, items: [], last: ''};\n"
+     << "for (var r = 0; r < 3; ++r) {\n"
+     << "  for (var i = 0; i < " << size << "; ++i) {\n"
+     << "    state = f(state, {type: 'ACTION_' + i,\n"
+     << "                      payload: {value: i, keep: i % 2 == 0}});\n"
+     << "  }\n"
+     << "  f(state, {type: 'UNKNOWN'});\n"
+     << "}\n"
+     << "f;\n";
+  return os.str();
+}
+
+std::string MinifiedBundleSource(int size) {
+  std::ostringstream os;
+  os << "function f(a,b){var c=0,d=a.length,e,g,t;"
+     << "for(e=0;e<d;e++){g=a[e];";
+  for (int i = 0; i < size; ++i) {
+    int p = i % 4;
+    os << "t=g.p" << p << "!==void 0?g.p" << p << "*" << i << "+c:c-" << i
+       << ",c=(t>>>0)%65521,g.q&&(c^=g.q.length+" << i << "),!b||(c+=b.k);";
+  }
+  os << "}return c}\n"
+     << "var a=[];for(var i=0;i<16;i++)a.push({p0:i,p1:i+1,p2:i+2,p3:i+3,"
+     << "q:i%2?'xx':''});\n"
+     << "for(var r=0;r<10;r++)f(a,{k:r}),f(a,null);\n"
+     << "f;\n";
+  return os.str();
+}
+
+std::string GeneratedIntegerCodeSource(int size) {
+  std::ostringstream os;
+  os << "function f(heap, n) {\n"
+     << "  n = n | 0;\n"
+     << "  var i = 0, a = 0, b = 0, c = 0, d = 0;\n"
+     << "  for (i = 0; (i | 0) < (n | 0); i = (i + 1) | 0) {\n";
+  const char* vars[] = {"a", "b", "c", "d"};
+  for (int i = 0; i < size; ++i) {
+    const char* x = vars[i % 4];
+    const char* y = vars[(i + 1) % 4];
+    const char* z = vars[(i + 2) % 4];
+    os << "    " << x << " = heap[((" << y << " + " << i
+       << ") & 1023)] | 0;\n"
+       << "    " << z << " = (Math.imul(" << x << ", 31) + " << z << ") | 0;\n"
+       << "    heap[((" << z << " ^ i) & 1023)] = (" << x << " >>> 3) ^ " << y
+       << ";\n";
+  }
+  os << "  }\n"
+     << "  return (a + b + c + d) | 0;\n"
+     << "}\n"
+     << "var heap = new Int32Array(1024);\n"
+     << "for (var i = 0; i < 1024; ++i) heap[i] = i * 2654435761;\n"
+     << "for (var r = 0; r < 10; ++r) f(heap, 16);\n"
+     << "f;\n";
+  return os.str();
+}
+
+std::string StateMachineSource(int size) {
+  std::ostringstream os;
+  os << "function f(ctx) {\n"
+     << "  while (1) {\n"
+     << "    switch (ctx.prev = ctx.next) {\n";
+  for (int i = 0; i < size; ++i) {
+    int t = i % 4;
+    os << "      case " << i << ":\n"
+       << "        ctx.t" << t << " = ctx.sent * " << i << " + ctx.value;\n"
+       << "        if (ctx.t" << t << " > " << 1000 * (i + 1) << ") {\n"
+       << "          ctx.sent = ctx.t" << t << " % 1000;\n"
+       << "        } else {\n"
+       << "          ctx.sent = ctx.t" << (t + 1) % 4 << " | 0;\n"
+       << "        }\n"
+       << "        ctx.next = " << i + 1 << ";\n"
+       << "        break;\n";
+  }
+  os << "      case " << size << ":\n"
+     << "      case 'end':\n"
+     << "        return ctx.stop();\n"
+     << "    }\n"
+     << "  }\n"
+     << "}\n"
+     << "function Context(value) {\n"
+     << "  this.prev = 0; this.next = 0; this.value = value; this.sent = 1;\n"
+     << "  this.t0 = 0; this.t1 = 0; this.t2 = 0; this.t3 = 0;\n"
+     << "}\n"
+     << "Context.prototype.stop = function() { return this.sent; };\n"
+     << "for (var r = 0; r < 10; ++r) f(new Context(r));\n"
+     << "f;\n";
+  return os.str();
+}
+
+}  // namespace testing
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,39 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TEST_BENCHMARK_CPP_COMPILER_CORPUS_H_
+#define TEST_BENCHMARK_CPP_COMPILER_CORPUS_H_
+
+#include <string>
+
+namespace v8 {
+namespace internal {
+namespace testing {
+
+// Sources of large functions in the shapes that dominate compile time in real
+// applications. Each source defines a function |f|, calls it enough to
+// collect type feedback for all of its code, and evaluates to |f|. |size|
+// scales the function body linearly.
+
+// A state reducer as written for UI frameworks: a switch over string action
+// types whose cases build new state objects from property loads.
+std::string FrameworkReducerSource(int size);
+
+// A loop as emitted by minifiers: single-letter names, comma expressions,
+// conditional expressions and short-circuit assignments.
+std::string MinifiedBundleSource(int size);
+
+// Integer code as emitted by compilers targeting asm.js-style JavaScript:
+// typed array loads and stores interleaved with |0 coercions.
+std::string GeneratedIntegerCodeSource(int size);
+
+// A transpiled generator: a switch-based state machine in a loop, with the
+// state kept in a context object.
+std::string StateMachineSource(int size);
+
+}  // namespace testing
+}  // namespace internal
+}  // namespace v8
+
+#endif  // TEST_BENCHMARK_CPP_COMPILER_CORPUS_H_
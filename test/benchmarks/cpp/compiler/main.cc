@@ -0,0 +1,31 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+// The per-phase counters are taken from the TurboFan statistics, so they are
+// enabled before any flags given on the command line. Results, including the
+// counters, can be written with --benchmark_out=<file>
+// --benchmark_out_format=json.
+int main(int argc, char** argv) {
+  v8::V8::SetFlagsFromString("--turbo-stats");
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::V8::Initialize();
+
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  v8::V8::Dispose();
+  v8::V8::ShutdownPlatform();
+  return 0;
+}
@@ -0,0 +1,144 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "include/v8.h"
+#include "src/api/api-inl.h"
+#include "src/codegen/compiler.h"
+#include "src/codegen/optimized-compilation-info.h"
+#include "src/compiler/pipeline.h"
+#include "src/diagnostics/compilation-statistics.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/objects/js-function-inl.h"
+#include "src/zone/zone.h"
+#include "test/benchmarks/cpp/compiler/corpus.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+class TurboFan : public benchmark::Fixture {
+ public:
+  void SetUp(const ::benchmark::State& state) override {
+    array_buffer_allocator_.reset(
+        v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = array_buffer_allocator_.get();
+    v8_isolate_ = v8::Isolate::New(create_params);
+    v8_isolate_->Enter();
+    v8::HandleScope handle_scope(v8_isolate_);
+    context_.Reset(v8_isolate_, v8::Context::New(v8_isolate_));
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    context_.Reset();
+    // Drop the statistics, the isolate would print them on disposal.
+    delete isolate()->turbo_statistics();
+    isolate()->set_turbo_statistics(nullptr);
+    v8_isolate_->Exit();
+    v8_isolate_->Dispose();
+    v8_isolate_ = nullptr;
+  }
+
+ protected:
+  Isolate* isolate() const { return reinterpret_cast<Isolate*>(v8_isolate_); }
+
+  // Runs |source|, which evaluates to a function with type feedback, and then
+  // compiles that function with TurboFan in every iteration. The wall time and
+  // the zone memory of each phase, averaged over the iterations, are reported
+  // as counters.
+  void CompileFunction(benchmark::State& state, const std::string& source);
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_;
+  v8::Isolate* v8_isolate_ = nullptr;
+  v8::Global<v8::Context> context_;
+};
+
+void TurboFan::CompileFunction(benchmark::State& state,
+                               const std::string& source) {
+  v8::HandleScope handle_scope(v8_isolate_);
+  v8::Local<v8::Context> context = context_.Get(v8_isolate_);
+  v8::Context::Scope context_scope(context);
+  v8::Local<v8::Value> result =
+      v8::Script::Compile(
+          context,
+          v8::String::NewFromUtf8(v8_isolate_, source.c_str()).ToLocalChecked())
+          .ToLocalChecked()
+          ->Run(context)
+          .ToLocalChecked();
+  Handle<JSFunction> function =
+      Handle<JSFunction>::cast(Utils::OpenHandle(*result));
+  Handle<SharedFunctionInfo> shared(function->shared(), isolate());
+  IsCompiledScope is_compiled_scope(shared->is_compiled_scope(isolate()));
+  CHECK(is_compiled_scope.is_compiled());
+  JSFunction::EnsureFeedbackVector(function, &is_compiled_scope);
+
+  // Only the compilations in the loop below are accounted.
+  delete isolate()->turbo_statistics();
+  isolate()->set_turbo_statistics(nullptr);
+
+  for (auto _ : state) {
+    HandleScope scope(isolate());
+    Zone zone(isolate()->allocator(), ZONE_NAME);
+    OptimizedCompilationInfo info(&zone, isolate(), shared, function, false);
+    if (FLAG_turbo_inlining) info.set_inlining();
+    CHECK(!compiler::Pipeline::GenerateCodeForTesting(&info, isolate())
+               .is_null());
+  }
+
+  int64_t bytecode_length = shared->GetBytecodeArray().length();
+  state.SetBytesProcessed(state.iterations() * bytecode_length);
+
+  // Without --turbo-stats there is nothing to report per phase.
+  if (isolate()->turbo_statistics() == nullptr) return;
+  for (const auto& phase : isolate()->GetTurboStatistics()->GetPhaseStats()) {
+    const CompilationStatistics::BasicStats& stats = phase.second;
+    state.counters[phase.first + ":ms"] = benchmark::Counter(
+        stats.delta_.InMillisecondsF(), benchmark::Counter::kAvgIterations);
+    state.counters[phase.first + ":zone_peak_bytes"] =
+        static_cast<double>(stats.absolute_max_allocated_bytes_);
+  }
+}
+
+BENCHMARK_DEFINE_F(TurboFan, FrameworkReducer)(benchmark::State& st) {
+  CompileFunction(st, testing::FrameworkReducerSource(st.range(0)));
+}
+
+BENCHMARK_DEFINE_F(TurboFan, MinifiedBundle)(benchmark::State& st) {
+  CompileFunction(st, testing::MinifiedBundleSource(st.range(0)));
+}
+
+BENCHMARK_DEFINE_F(TurboFan, GeneratedIntegerCode)(benchmark::State& st) {
+  CompileFunction(st, testing::GeneratedIntegerCodeSource(st.range(0)));
+}
+
+BENCHMARK_DEFINE_F(TurboFan, StateMachine)(benchmark::State& st) {
+  CompileFunction(st, testing::StateMachineSource(st.range(0)));
+}
+
+BENCHMARK_REGISTER_F(TurboFan, FrameworkReducer)
+    ->Arg(32)
+    ->Arg(128)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(TurboFan, MinifiedBundle)
+    ->Arg(32)
+    ->Arg(128)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(TurboFan, GeneratedIntegerCode)
+    ->Arg(32)
+    ->Arg(128)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(TurboFan, StateMachine)
+    ->Arg(32)
+    ->Arg(128)
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
@@ -2,8 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <memory>
+
 #include "include/cppgc/allocation.h"
 #include "include/cppgc/garbage-collected.h"
+#include "include/cppgc/heap.h"
 #include "src/heap/cppgc/globals.h"
 #include "src/heap/cppgc/heap.h"
 #include "test/benchmarks/cpp/cppgc/utils.h"
@@ -44,6 +47,37 @@ BENCHMARK_F(Allocate, Large)(benchmark::State& st) {
   st.SetBytesProcessed(st.iterations() * sizeof(LargeObject));
 }
 
+// cppgc heaps are owned by a single thread. Multi-threaded allocation
+// therefore uses a heap (and thus linear allocation buffers) per thread. The
+// benchmark measures how allocation scales when threads only share
+// process-wide state such as the GCInfo table and the page allocator.
+std::shared_ptr<testing::TestPlatform> GetSharedPlatform() {
+  static std::shared_ptr<testing::TestPlatform> platform = [] {
+    auto platform = std::make_shared<testing::TestPlatform>();
+    cppgc::InitializeProcess(platform->GetPageAllocator());
+    return platform;
+  }();
+  return platform;
+}
+
+template <typename T>
+void AllocateOnThreadLocalHeap(benchmark::State& st) {
+  std::unique_ptr<cppgc::Heap> heap = cppgc::Heap::Create(GetSharedPlatform());
+  {
+    Heap::NoGCScope no_gc(*Heap::From(heap.get()));
+    for (auto _ : st) {
+      benchmark::DoNotOptimize(
+          cppgc::MakeGarbageCollected<T>(heap->GetAllocationHandle()));
+    }
+  }
+  st.SetBytesProcessed(st.iterations() * sizeof(T));
+}
+
+void AllocateTinyMultiThreaded(benchmark::State& st) {
+  AllocateOnThreadLocalHeap<TinyObject>(st);
+}
+BENCHMARK(AllocateTinyMultiThreaded)->ThreadRange(1, 8)->UseRealTime();
+
 }  // namespace
 }  // namespace internal
 }  // namespace cppgc
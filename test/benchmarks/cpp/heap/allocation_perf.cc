@@ -0,0 +1,32 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/common/globals.h"
+#include "test/benchmarks/cpp/heap/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using Allocate = testing::BenchmarkWithIsolate;
+
+// Allocates arrays of the byte size given by the benchmark argument in large
+// object space. Garbage collections triggered by the allocations are included.
+BENCHMARK_DEFINE_F(Allocate, LargeObject)(benchmark::State& st) {
+  const int length = static_cast<int>(st.range(0) / kTaggedSize);
+  for (auto _ : st) {
+    HandleScope scope(isolate());
+    benchmark::DoNotOptimize(*factory()->NewFixedArray(length));
+  }
+  st.SetBytesProcessed(st.iterations() * FixedArray::SizeFor(length));
+}
+BENCHMARK_REGISTER_F(Allocate, LargeObject)
+    ->Arg(kMaxRegularHeapObjectSize + kTaggedSize)
+    ->Arg(1 * MB)
+    ->Arg(8 * MB);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
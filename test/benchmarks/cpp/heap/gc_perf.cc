@@ -0,0 +1,103 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/heap.h"
+#include "src/heap/incremental-marking.h"
+#include "test/benchmarks/cpp/heap/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using GC = testing::BenchmarkWithIsolate;
+
+constexpr int kScavengeObjects = 8 * 1024;
+
+// Measures a scavenge of the young generation in which the percentage of
+// objects given by the benchmark argument survives.
+BENCHMARK_DEFINE_F(GC, Scavenge)(benchmark::State& st) {
+  const int survival_percent = static_cast<int>(st.range(0));
+  for (auto _ : st) {
+    st.PauseTiming();
+    HandleScope scope(isolate());
+    heap()->CollectAllGarbage(Heap::kNoGCFlags,
+                              GarbageCollectionReason::kTesting);
+    Handle<FixedArray> survivors =
+        factory()->NewFixedArray(kScavengeObjects, AllocationType::kOld);
+    for (int i = 0; i < kScavengeObjects; ++i) {
+      FixedArray object = *factory()->NewFixedArray(kSmallArrayLength);
+      if (i % 100 < survival_percent) survivors->set(i, object);
+    }
+    st.ResumeTiming();
+    heap()->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+  }
+  st.SetItemsProcessed(st.iterations() * kScavengeObjects);
+}
+BENCHMARK_REGISTER_F(GC, Scavenge)
+    ->Arg(0)
+    ->Arg(10)
+    ->Arg(50)
+    ->Arg(100)
+    ->Unit(benchmark::kMicrosecond);
+
+// Measures the atomic pause of a full mark-compact for a live heap of the
+// size in MB given by the benchmark argument.
+BENCHMARK_DEFINE_F(GC, MarkCompact)(benchmark::State& st) {
+  const size_t live_bytes = static_cast<size_t>(st.range(0)) * MB;
+  HandleScope scope(isolate());
+  Handle<FixedArray> root = CreateLiveGraph(live_bytes);
+  for (auto _ : st) {
+    heap()->CollectAllGarbage(Heap::kNoGCFlags,
+                              GarbageCollectionReason::kTesting);
+  }
+  benchmark::DoNotOptimize(*root);
+  st.counters["live_bytes"] = static_cast<double>(live_bytes);
+}
+BENCHMARK_REGISTER_F(GC, MarkCompact)
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(64)
+    ->Unit(benchmark::kMillisecond);
+
+// Measures mutator allocation throughput while a live heap of 16MB is marked
+// incrementally and concurrently (argument 1), compared to no marking
+// (argument 0). The ratio of the two approximates mutator utilization.
+BENCHMARK_DEFINE_F(GC, AllocationDuringMarking)(benchmark::State& st) {
+  const bool marking = st.range(0) != 0;
+  constexpr int kAllocationsPerIteration = 1024;
+  HandleScope scope(isolate());
+  Handle<FixedArray> root = CreateLiveGraph(16 * MB);
+  IncrementalMarking* incremental_marking = heap()->incremental_marking();
+  for (auto _ : st) {
+    if (marking && !incremental_marking->IsMarkingIncomplete()) {
+      st.PauseTiming();
+      if (incremental_marking->IsComplete()) {
+        heap()->FinalizeIncrementalMarkingAtomically(
+            GarbageCollectionReason::kTesting);
+      }
+      if (incremental_marking->IsStopped()) {
+        heap()->StartIncrementalMarking(Heap::kNoGCFlags,
+                                        GarbageCollectionReason::kTesting);
+      }
+      st.ResumeTiming();
+    }
+    HandleScope inner_scope(isolate());
+    for (int i = 0; i < kAllocationsPerIteration; ++i) {
+      benchmark::DoNotOptimize(*factory()->NewFixedArray(kSmallArrayLength));
+    }
+  }
+  if (incremental_marking->IsMarking()) {
+    heap()->FinalizeIncrementalMarkingAtomically(
+        GarbageCollectionReason::kTesting);
+  }
+  benchmark::DoNotOptimize(*root);
+  st.SetBytesProcessed(st.iterations() * kAllocationsPerIteration *
+                       FixedArray::SizeFor(kSmallArrayLength));
+}
+BENCHMARK_REGISTER_F(GC, AllocationDuringMarking)->Arg(0)->Arg(1);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,68 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef TEST_BENCHMARK_CPP_HEAP_UTILS_H_
+#define TEST_BENCHMARK_CPP_HEAP_UTILS_H_
+
+#include "include/v8.h"
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap.h"
+#include "src/objects/fixed-array-inl.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace testing {
+
+class BenchmarkWithIsolate : public benchmark::Fixture {
+ protected:
+  void SetUp(const ::benchmark::State& state) override {
+    array_buffer_allocator_.reset(
+        v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = array_buffer_allocator_.get();
+    v8_isolate_ = v8::Isolate::New(create_params);
+    v8_isolate_->Enter();
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    v8_isolate_->Exit();
+    v8_isolate_->Dispose();
+    v8_isolate_ = nullptr;
+  }
+
+  Isolate* isolate() const { return reinterpret_cast<Isolate*>(v8_isolate_); }
+  Heap* heap() const { return isolate()->heap(); }
+  Factory* factory() const { return isolate()->factory(); }
+
+  // Creates a graph of |live_bytes| worth of small arrays that are reachable
+  // from the returned array, and moves it to the old generation.
+  Handle<FixedArray> CreateLiveGraph(size_t live_bytes) {
+    const int count =
+        static_cast<int>(live_bytes / FixedArray::SizeFor(kSmallArrayLength));
+    Handle<FixedArray> root =
+        factory()->NewFixedArray(count, AllocationType::kOld);
+    for (int i = 0; i < count; ++i) {
+      root->set(i, *factory()->NewFixedArray(kSmallArrayLength,
+                                             AllocationType::kOld));
+    }
+    heap()->CollectAllGarbage(Heap::kNoGCFlags,
+                              GarbageCollectionReason::kTesting);
+    return root;
+  }
+
+  static constexpr int kSmallArrayLength = 8;
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_;
+  v8::Isolate* v8_isolate_ = nullptr;
+};
+
+}  // namespace testing
+}  // namespace internal
+}  // namespace v8
+
+#endif  // TEST_BENCHMARK_CPP_HEAP_UTILS_H_
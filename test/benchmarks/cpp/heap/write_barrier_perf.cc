@@ -0,0 +1,55 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/heap.h"
+#include "test/benchmarks/cpp/heap/utils.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+using WriteBarrier = testing::BenchmarkWithIsolate;
+
+constexpr int kHostLength = 1024;
+
+// Stores a young object into an old array, which takes the generational
+// barrier and, while marking (argument 1), the marking barrier.
+BENCHMARK_DEFINE_F(WriteBarrier, OldToNew)(benchmark::State& st) {
+  const bool marking = st.range(0) != 0;
+  HandleScope scope(isolate());
+  Handle<FixedArray> host =
+      factory()->NewFixedArray(kHostLength, AllocationType::kOld);
+  Handle<FixedArray> value = factory()->NewFixedArray(kSmallArrayLength);
+  if (marking) {
+    heap()->StartIncrementalMarking(Heap::kNoGCFlags,
+                                    GarbageCollectionReason::kTesting);
+  }
+  for (auto _ : st) {
+    for (int i = 0; i < kHostLength; ++i) host->set(i, *value);
+  }
+  if (marking) {
+    heap()->FinalizeIncrementalMarkingAtomically(
+        GarbageCollectionReason::kTesting);
+  }
+  st.SetItemsProcessed(st.iterations() * kHostLength);
+}
+BENCHMARK_REGISTER_F(WriteBarrier, OldToNew)->Arg(0)->Arg(1);
+
+// Stores Smis, which skip the barrier after the Smi check. Serves as the
+// baseline for OldToNew.
+BENCHMARK_DEFINE_F(WriteBarrier, Smi)(benchmark::State& st) {
+  HandleScope scope(isolate());
+  Handle<FixedArray> host =
+      factory()->NewFixedArray(kHostLength, AllocationType::kOld);
+  for (auto _ : st) {
+    for (int i = 0; i < kHostLength; ++i) host->set(i, Smi::FromInt(i));
+  }
+  st.SetItemsProcessed(st.iterations() * kHostLength);
+}
+BENCHMARK_REGISTER_F(WriteBarrier, Smi);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
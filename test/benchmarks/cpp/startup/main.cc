@@ -0,0 +1,45 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+
+#include "include/libplatform/libplatform.h"
+#include "include/v8.h"
+#include "src/base/platform/time.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+// V8::Initialize can only run once per process, so it is timed here and
+// reported as a benchmark with a single iteration. Pass
+// --runtime-call-stats to add the relevant runtime call counters of the other
+// benchmarks to their results, which can be written with
+// --benchmark_out=<file> --benchmark_out_format=json.
+int main(int argc, char** argv) {
+  v8::V8::SetFlagsFromCommandLine(&argc, argv, true);
+  v8::V8::InitializeICUDefaultLocation(argv[0]);
+  v8::V8::InitializeExternalStartupData(argv[0]);
+  std::unique_ptr<v8::Platform> platform = v8::platform::NewDefaultPlatform();
+  v8::V8::InitializePlatform(platform.get());
+  v8::base::TimeTicks start = v8::base::TimeTicks::Now();
+  v8::V8::Initialize();
+  double initialize_seconds =
+      (v8::base::TimeTicks::Now() - start).InSecondsF();
+
+  ::benchmark::RegisterBenchmark("Startup/V8Initialize",
+                                 [=](::benchmark::State& state) {
+                                   for (auto _ : state) {
+                                     state.SetIterationTime(initialize_seconds);
+                                   }
+                                 })
+      ->Iterations(1)
+      ->UseManualTime()
+      ->Unit(::benchmark::kMicrosecond);
+
+  ::benchmark::Initialize(&argc, argv);
+  if (::benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
+  ::benchmark::RunSpecifiedBenchmarks();
+
+  v8::V8::Dispose();
+  v8::V8::ShutdownPlatform();
+  return 0;
+}
@@ -0,0 +1,339 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/v8.h"
+#include "src/execution/isolate.h"
+#include "src/logging/counters.h"
+#include "src/logging/tracing-flags.h"
+#include "third_party/google_benchmark/src/include/benchmark/benchmark.h"
+
+namespace v8 {
+namespace internal {
+namespace {
+
+// Top-level code of an application bundle: many function declarations, a
+// few of which run right away.
+std::string BundleSource() {
+  static constexpr int kFunctions = 256;
+  std::ostringstream os;
+  for (int i = 0; i < kFunctions; ++i) {
+    os << "function f" << i << "(a, b) {\n"
+       << "  var x = a + " << i << ";\n"
+       << "  if (b) return [x, b, 'f" << i << "'];\n"
+       << "  return {value: x, name: 'f" << i << "'};\n"
+       << "}\n";
+  }
+  os << "var modules = {};\n";
+  for (int i = 0; i < kFunctions; i += 8) {
+    os << "modules.m" << i << " = (function() { return f" << i
+       << "(1, true); })();\n";
+  }
+  return os.str();
+}
+
+// A module exporting add(i32, i32).
+constexpr char kWasmModuleSource[] =
+    "new Uint8Array([0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,"
+    "                0x01, 0x07, 0x01, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f,"
+    "                0x03, 0x02, 0x01, 0x00,"
+    "                0x07, 0x07, 0x01, 0x03, 0x61, 0x64, 0x64, 0x00, 0x00,"
+    "                0x0a, 0x09, 0x01, 0x07, 0x00, 0x20, 0x00, 0x20, 0x01,"
+    "                0x6a, 0x0b])";
+
+// Sums runtime call counters over the isolates of a benchmark, so that each
+// startup phase can be broken down further. Only active with
+// --runtime-call-stats.
+class RuntimeCallCounters {
+ public:
+  explicit RuntimeCallCounters(std::vector<RuntimeCallCounterId> ids)
+      : ids_(std::move(ids)), times_(ids_.size()) {}
+
+  // Adds the counters of |isolate| and resets them. Called before the isolate
+  // is disposed.
+  void Collect(v8::Isolate* isolate) {
+    if (!TracingFlags::is_runtime_stats_enabled()) return;
+    RuntimeCallStats* stats = reinterpret_cast<Isolate*>(isolate)
+                                  ->counters()
+                                  ->runtime_call_stats();
+    names_.resize(ids_.size());
+    for (size_t i = 0; i < ids_.size(); ++i) {
+      RuntimeCallCounter* counter = stats->GetCounter(ids_[i]);
+      names_[i] = counter->name();
+      times_[i] += counter->time();
+    }
+    stats->Reset();
+  }
+
+  // Reports each counter as "rcs:<name>:ms", averaged over the iterations.
+  void Report(benchmark::State& state) const {
+    for (size_t i = 0; i < names_.size(); ++i) {
+      state.counters["rcs:" + names_[i] + ":ms"] =
+          benchmark::Counter(times_[i].InMillisecondsF(),
+                             benchmark::Counter::kAvgIterations);
+    }
+  }
+
+ private:
+  const std::vector<RuntimeCallCounterId> ids_;
+  std::vector<base::TimeDelta> times_;
+  std::vector<std::string> names_;
+};
+
+// Every iteration measures one phase in a new isolate, so that nothing is
+// cached from earlier iterations. Setting up and tearing down the isolate is
+// not timed.
+class Startup : public benchmark::Fixture {
+ public:
+  void SetUp(const ::benchmark::State& state) override {
+    array_buffer_allocator_.reset(
+        v8::ArrayBuffer::Allocator::NewDefaultAllocator());
+  }
+
+  void TearDown(const ::benchmark::State& state) override {
+    delete[] snapshot_blob_.data;
+    snapshot_blob_ = {nullptr, 0};
+  }
+
+ protected:
+  v8::Isolate* NewIsolate(const v8::StartupData* snapshot_blob = nullptr) {
+    v8::Isolate::CreateParams create_params;
+    create_params.array_buffer_allocator = array_buffer_allocator_.get();
+    create_params.snapshot_blob = snapshot_blob;
+    return v8::Isolate::New(create_params);
+  }
+
+  // Creates a snapshot blob that has one context in addition to the default
+  // context, for Context::FromSnapshot.
+  const v8::StartupData* CreateSnapshotBlob() {
+    v8::SnapshotCreator creator;
+    {
+      v8::Isolate* isolate = creator.GetIsolate();
+      v8::HandleScope handle_scope(isolate);
+      creator.SetDefaultContext(v8::Context::New(isolate));
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      {
+        v8::Context::Scope context_scope(context);
+        Run(context, BundleSource());
+      }
+      CHECK_EQ(0, creator.AddContext(context));
+    }
+    snapshot_blob_ = creator.CreateBlob(
+        v8::SnapshotCreator::FunctionCodeHandling::kClear);
+    return &snapshot_blob_;
+  }
+
+  // Creates a code cache for |source| after running it, so that it includes
+  // the functions that run eagerly.
+  std::unique_ptr<v8::ScriptCompiler::CachedData> CreateCodeCache(
+      const std::string& source) {
+    v8::Isolate* isolate = NewIsolate();
+    std::unique_ptr<v8::ScriptCompiler::CachedData> cache;
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::ScriptCompiler::Source script_source(NewString(isolate, source));
+      v8::Local<v8::UnboundScript> script =
+          v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+              .ToLocalChecked();
+      script->BindToCurrentContext()->Run(context).ToLocalChecked();
+      cache.reset(v8::ScriptCompiler::CreateCodeCache(script));
+    }
+    isolate->Dispose();
+    return cache;
+  }
+
+  static v8::Local<v8::String> NewString(v8::Isolate* isolate,
+                                         const std::string& source) {
+    return v8::String::NewFromUtf8(isolate, source.c_str()).ToLocalChecked();
+  }
+
+  static v8::Local<v8::Value> Run(v8::Local<v8::Context> context,
+                                  const std::string& source) {
+    v8::Isolate* isolate = context->GetIsolate();
+    return v8::Script::Compile(context, NewString(isolate, source))
+        .ToLocalChecked()
+        ->Run(context)
+        .ToLocalChecked();
+  }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> array_buffer_allocator_;
+  v8::StartupData snapshot_blob_ = {nullptr, 0};
+};
+
+// Isolate::New, which deserializes the startup snapshot.
+BENCHMARK_DEFINE_F(Startup, IsolateNew)(benchmark::State& st) {
+  RuntimeCallCounters counters({RuntimeCallCounterId::kDeserializeIsolate});
+  for (auto _ : st) {
+    v8::Isolate* isolate = NewIsolate();
+    st.PauseTiming();
+    counters.Collect(isolate);
+    isolate->Dispose();
+    st.ResumeTiming();
+  }
+  counters.Report(st);
+}
+
+// Context::New of the first context in an isolate, which deserializes the
+// default context of the snapshot.
+BENCHMARK_DEFINE_F(Startup, ContextNew)(benchmark::State& st) {
+  RuntimeCallCounters counters({RuntimeCallCounterId::kDeserializeContext});
+  for (auto _ : st) {
+    st.PauseTiming();
+    v8::Isolate* isolate = NewIsolate();
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      st.ResumeTiming();
+      v8::Context::New(isolate);
+      st.PauseTiming();
+      counters.Collect(isolate);
+    }
+    isolate->Dispose();
+    st.ResumeTiming();
+  }
+  counters.Report(st);
+}
+
+// Context::FromSnapshot of an embedder context that has run a bundle.
+BENCHMARK_DEFINE_F(Startup, ContextFromSnapshot)(benchmark::State& st) {
+  RuntimeCallCounters counters({RuntimeCallCounterId::kDeserializeContext});
+  const v8::StartupData* snapshot_blob = CreateSnapshotBlob();
+  for (auto _ : st) {
+    st.PauseTiming();
+    v8::Isolate* isolate = NewIsolate(snapshot_blob);
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      st.ResumeTiming();
+      v8::Context::FromSnapshot(isolate, 0).ToLocalChecked();
+      st.PauseTiming();
+      counters.Collect(isolate);
+    }
+    isolate->Dispose();
+    st.ResumeTiming();
+  }
+  counters.Report(st);
+}
+
+// The first compile of a bundle, without and with a code cache (argument 1).
+BENCHMARK_DEFINE_F(Startup, CompileScript)(benchmark::State& st) {
+  const bool use_code_cache = st.range(0) != 0;
+  RuntimeCallCounters counters({RuntimeCallCounterId::kCompileScript,
+                                RuntimeCallCounterId::kParseProgram,
+                                RuntimeCallCounterId::kCompileIgnition,
+                                RuntimeCallCounterId::kCompileDeserialize});
+  const std::string source = BundleSource();
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cache;
+  if (use_code_cache) cache = CreateCodeCache(source);
+  for (auto _ : st) {
+    st.PauseTiming();
+    v8::Isolate* isolate = NewIsolate();
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      v8::Local<v8::String> source_string = NewString(isolate, source);
+      // The source takes ownership of the cached data, so hand it a copy
+      // that doesn't own the buffer.
+      v8::ScriptCompiler::Source script_source(
+          source_string,
+          use_code_cache ? new v8::ScriptCompiler::CachedData(
+                               cache->data, cache->length,
+                               v8::ScriptCompiler::CachedData::BufferNotOwned)
+                         : nullptr);
+      st.ResumeTiming();
+      v8::ScriptCompiler::Compile(context, &script_source,
+                                  use_code_cache
+                                      ? v8::ScriptCompiler::kConsumeCodeCache
+                                      : v8::ScriptCompiler::kNoCompileOptions)
+          .ToLocalChecked();
+      st.PauseTiming();
+      if (use_code_cache) CHECK(!script_source.GetCachedData()->rejected);
+      counters.Collect(isolate);
+    }
+    isolate->Dispose();
+    st.ResumeTiming();
+  }
+  counters.Report(st);
+}
+
+// Compiling and running a bundle in a new context, the latency until an
+// application's top-level code has run.
+BENCHMARK_DEFINE_F(Startup, FirstRun)(benchmark::State& st) {
+  RuntimeCallCounters counters({RuntimeCallCounterId::kCompileScript,
+                                RuntimeCallCounterId::kRuntime_CompileLazy,
+                                RuntimeCallCounterId::kJS_Execution});
+  const std::string source = BundleSource();
+  for (auto _ : st) {
+    st.PauseTiming();
+    v8::Isolate* isolate = NewIsolate();
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      st.ResumeTiming();
+      Run(context, source);
+      st.PauseTiming();
+      counters.Collect(isolate);
+    }
+    isolate->Dispose();
+    st.ResumeTiming();
+  }
+  counters.Report(st);
+}
+
+// Synchronously compiling and instantiating the first wasm module in an
+// isolate.
+BENCHMARK_DEFINE_F(Startup, WasmInstantiate)(benchmark::State& st) {
+  for (auto _ : st) {
+    st.PauseTiming();
+    v8::Isolate* isolate = NewIsolate();
+    {
+      v8::Isolate::Scope isolate_scope(isolate);
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      Run(context, std::string("var bytes = ") + kWasmModuleSource + ";");
+      v8::Local<v8::Script> script =
+          v8::Script::Compile(
+              context,
+              NewString(isolate,
+                        "new WebAssembly.Instance("
+                        "    new WebAssembly.Module(bytes)).exports.add(1, 2)"))
+              .ToLocalChecked();
+      st.ResumeTiming();
+      v8::Local<v8::Value> result = script->Run(context).ToLocalChecked();
+      st.PauseTiming();
+      CHECK_EQ(3, result->Int32Value(context).FromJust());
+    }
+    isolate->Dispose();
+    st.ResumeTiming();
+  }
+}
+
+BENCHMARK_REGISTER_F(Startup, IsolateNew)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(Startup, ContextNew)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(Startup, ContextFromSnapshot)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(Startup, CompileScript)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(Startup, FirstRun)->Unit(benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(Startup, WasmInstantiate)->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+}  // namespace internal
+}  // namespace v8
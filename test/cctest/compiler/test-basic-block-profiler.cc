@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <sstream>
+
 #include "src/diagnostics/basic-block-profiler.h"
 #include "src/objects/objects-inl.h"
 #include "test/cctest/cctest.h"
@@ -109,6 +111,38 @@ TEST(ProfileLoop) {
   }
 }
 
+TEST(ProfileJSONAndReset) {
+  BasicBlockProfilerTest m;
+
+  RawMachineLabel blocka, blockb, end;
+  m.Branch(m.Parameter(0), &blocka, &blockb);
+  m.Bind(&blocka);
+  m.Goto(&end);
+  m.Bind(&blockb);
+  m.Goto(&end);
+  m.Bind(&end);
+  m.Return(m.Int32Constant(0));
+
+  m.GenerateCode();
+  m.ResetCounts();
+  m.Call(0);
+
+  std::ostringstream os;
+  BasicBlockProfiler::Get()->PrintJSON(os, CcTest::i_isolate(), true);
+  std::string json = os.str();
+  CHECK_EQ(0u, json.find("{\"functions\":[{\"name\":"));
+  CHECK_NE(std::string::npos, json.find("\"count\":1,"));
+  {
+    uint32_t expected[] = {0, 0, 0, 0, 0, 0};
+    m.Expect(arraysize(expected), expected);
+  }
+
+  // Functions that were not entered since the reset are left out.
+  std::ostringstream empty;
+  BasicBlockProfiler::Get()->PrintJSON(empty, CcTest::i_isolate(), false);
+  CHECK_EQ("{\"functions\":[]}", empty.str());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
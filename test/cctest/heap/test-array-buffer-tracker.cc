@@ -491,6 +491,65 @@ UNINITIALIZED_TEST(ArrayBuffer_SemiSpaceCopyMultipleTasks) {
   isolate->Dispose();
 }
 
+namespace {
+
+class BatchCountingAllocator final : public v8::ArrayBuffer::Allocator {
+ public:
+  BatchCountingAllocator()
+      : allocator_(v8::ArrayBuffer::Allocator::NewDefaultAllocator()) {}
+
+  void* Allocate(size_t length) override {
+    return allocator_->Allocate(length);
+  }
+  void* AllocateUninitialized(size_t length) override {
+    return allocator_->AllocateUninitialized(length);
+  }
+  void Free(void* data, size_t length) override {
+    allocator_->Free(data, length);
+  }
+  void FreeBatch(void* const* data, const size_t* lengths,
+                 size_t count) override {
+    batch_freed_blocks_ += count;
+    v8::ArrayBuffer::Allocator::FreeBatch(data, lengths, count);
+  }
+
+  size_t batch_freed_blocks() const { return batch_freed_blocks_; }
+
+ private:
+  std::unique_ptr<v8::ArrayBuffer::Allocator> allocator_;
+  std::atomic<size_t> batch_freed_blocks_{0};
+};
+
+}  // namespace
+
+UNINITIALIZED_TEST(ArrayBuffer_FreeBatch_Extension) {
+  if (!V8_ARRAY_BUFFER_EXTENSION_BOOL) return;
+  ManualGCScope manual_gc_scope;
+  BatchCountingAllocator allocator;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = &allocator;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    Heap* heap = i_isolate->heap();
+
+    const size_t kNumberOfBuffers = 100;
+    {
+      v8::HandleScope inner_handle_scope(isolate);
+      for (size_t i = 0; i < kNumberOfBuffers; i++) {
+        v8::ArrayBuffer::New(isolate, 100);
+      }
+    }
+    heap::GcAndSweep(heap, OLD_SPACE);
+    heap->array_buffer_sweeper()->EnsureFinished();
+    CHECK_EQ(kNumberOfBuffers, allocator.batch_freed_blocks());
+  }
+  isolate->Dispose();
+}
+
 TEST(ArrayBuffer_ExternalBackingStoreSizeIncreases) {
   if (V8_ARRAY_BUFFER_EXTENSION_BOOL) return;
   CcTest::InitializeVM();
@@ -692,6 +692,36 @@ TEST(BytecodeArrayAging) {
   CHECK_EQ(BytecodeArray::kLastBytecodeAge, array->bytecode_age());
 }
 
+TEST(BytecodeArrayAgingBySize) {
+  static const uint8_t kRawBytes[] = {0xC3, 0x7E, 0xA5, 0x5A};
+  static const int kRawBytesSize = sizeof(kRawBytes);
+  static const int32_t kFrameSize = 32;
+  static const int32_t kParameterCount = 2;
+  FLAG_flush_bytecode_min_size = kRawBytesSize + 1;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+
+  Handle<BytecodeArray> array =
+      factory->NewBytecodeArray(kRawBytesSize, kRawBytes, kFrameSize,
+                                kParameterCount, factory->empty_fixed_array());
+
+  // Small bytecode goes cold at the usual age, but is only old once it has
+  // reached the maximum age.
+  array->set_bytecode_age(BytecodeArray::kIsColdBytecodeAge);
+  CHECK(array->IsCold());
+  CHECK(!array->IsOld());
+  array->set_bytecode_age(BytecodeArray::kIsOldBytecodeAge);
+  CHECK(!array->IsOld());
+  array->set_bytecode_age(BytecodeArray::kLastBytecodeAge);
+  CHECK(array->IsOld());
+
+  FLAG_flush_bytecode_min_size = 0;
+  array->set_bytecode_age(BytecodeArray::kIsOldBytecodeAge);
+  CHECK(array->IsOld());
+}
+
 static const char* not_so_random_string_table[] = {
   "abstract",
   "boolean",
@@ -1187,6 +1217,114 @@ TEST(TestBytecodeFlushing) {
   }
 }
 
+TEST(TestBytecodeFlushingOnMemoryReducingGC) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+  Heap* heap = i_isolate->heap();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo() {"
+        "  var x = 42;"
+        "  var y = 42;"
+        "  var z = x + y;"
+        "};"
+        "foo()";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+    CompileRun(source);
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->shared().is_compiled());
+
+    // Pre-age the bytecode until it is cold, but not yet old.
+    while (!function->shared().GetBytecodeArray().IsCold()) {
+      function->shared().GetBytecodeArray().MakeOlder();
+    }
+    CHECK(!function->shared().GetBytecodeArray().IsOld());
+
+    // A memory-reducing GC flushes cold bytecode as well.
+    heap->CollectAllGarbage(Heap::kReduceMemoryFootprintMask,
+                            GarbageCollectionReason::kTesting);
+    CHECK(!function->shared().is_compiled());
+    CHECK(!function->is_compiled());
+
+    CompileRun("foo()");
+    CHECK(function->shared().is_compiled());
+    CHECK(function->is_compiled());
+  }
+}
+
+TEST(TestFeedbackVectorFlushing) {
+#ifndef V8_LITE_MODE
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+#endif  // V8_LITE_MODE
+  i::FLAG_flush_bytecode = false;
+  i::FLAG_flush_feedback_vectors = true;
+  i::FLAG_lazy_feedback_allocation = true;
+  i::FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+
+  {
+    v8::HandleScope scope(isolate);
+    v8::Context::New(isolate)->Enter();
+    const char* source =
+        "function foo(o) {"
+        "  return o.x + o.y;"
+        "};"
+        "%EnsureFeedbackVectorForFunction(foo);"
+        "foo({x: 1, y: 2})";
+    Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+    CompileRun(source);
+
+    Handle<Object> func_value =
+        Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+            .ToHandleChecked();
+    CHECK(func_value->IsJSFunction());
+    Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+    CHECK(function->has_feedback_vector());
+
+    // Simulate several GCs that use full marking.
+    const int kAgingThreshold = 6;
+    for (int i = 0; i < kAgingThreshold; i++) {
+      CcTest::CollectAllGarbage();
+    }
+
+    // The feedback vector is gone, but the bytecode is kept.
+    CHECK(!function->has_feedback_vector());
+    CHECK(function->has_closure_feedback_cell_array());
+    CHECK(function->shared().is_compiled());
+    CHECK(function->is_compiled());
+
+    // Calling foo again reallocates the feedback vector.
+    CompileRun(
+        "%EnsureFeedbackVectorForFunction(foo);"
+        "foo({x: 1, y: 2})");
+    CHECK(function->has_feedback_vector());
+  }
+}
+
 HEAP_TEST(Regress10560) {
   i::FLAG_flush_bytecode = true;
   i::FLAG_allow_natives_syntax = true;
@@ -3502,10 +3640,10 @@ void DetailedErrorStackTraceTest(const char* src,
   Isolate* isolate = CcTest::i_isolate();
   Handle<Name> key = isolate->factory()->stack_trace_symbol();
 
-  Handle<FixedArray> stack_trace(Handle<FixedArray>::cast(
+  Handle<FrameArray> stack_trace(Handle<FrameArray>::cast(
       Object::GetProperty(isolate, exception, key).ToHandleChecked()));
 
-  test(GetFrameArrayFromStackTrace(isolate, stack_trace));
+  test(stack_trace);
 }
 
 // * Test interpreted function error
@@ -5717,6 +5855,64 @@ TEST(Regress598319) {
   }
 }
 
+TEST(ParallelMarkingProgressBar) {
+  if (!FLAG_incremental_marking || !FLAG_concurrent_marking) return;
+  FLAG_parallel_marking_progress_bar = true;
+  ManualGCScope manual_gc_scope;
+  // This test ensures that a large array whose chunks are claimed by several
+  // markers is fully scanned, i.e. that no chunk is skipped or dropped when
+  // the array is shared between the main thread and concurrent markers.
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  Isolate* isolate = heap->isolate();
+
+  const int kNumberOfObjects = 8 * (FixedArray::kMaxRegularLength + 1);
+  Handle<FixedArray> arr =
+      isolate->factory()->NewFixedArray(kNumberOfObjects, AllocationType::kOld);
+  {
+    v8::HandleScope inner_scope(CcTest::isolate());
+    for (int i = 0; i < kNumberOfObjects; i++) {
+      Handle<FixedArray> tmp =
+          isolate->factory()->NewFixedArray(1, AllocationType::kOld);
+      arr->set(i, *tmp);
+    }
+  }
+  LargePage* page = LargePage::FromHeapObject(*arr);
+  CHECK(page->IsFlagSet(Page::HAS_PROGRESS_BAR));
+
+  CcTest::CollectGarbage(OLD_SPACE);
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  if (collector->sweeping_in_progress()) {
+    collector->EnsureSweepingCompleted();
+  }
+
+  IncrementalMarking* marking = heap->incremental_marking();
+  if (marking->IsStopped()) {
+    heap->StartIncrementalMarking(i::Heap::kNoGCFlags,
+                                  i::GarbageCollectionReason::kTesting);
+  }
+  CHECK(marking->IsMarking());
+  while (!marking->IsComplete()) {
+    marking->Step(1000, i::IncrementalMarking::NO_GC_VIA_STACK_GUARD,
+                  StepOrigin::kV8);
+    if (marking->IsReadyToOverApproximateWeakClosure()) {
+      SafepointScope safepoint_scope(heap);
+      marking->FinalizeIncrementally();
+    }
+  }
+  CHECK_EQ(static_cast<size_t>(arr->Size()), page->ProgressBar());
+  // Finish the cycle. An element missed by any of the markers would be
+  // reclaimed by the sweeper.
+  CcTest::CollectGarbage(OLD_SPACE);
+  if (collector->sweeping_in_progress()) {
+    collector->EnsureSweepingCompleted();
+  }
+  for (int i = 0; i < kNumberOfObjects; i++) {
+    CHECK(arr->get(i).IsFixedArray());
+  }
+}
+
 Handle<FixedArray> ShrinkArrayAndCheckSize(Heap* heap, int length) {
   // Make sure there is no garbage and the compilation cache is empty.
   for (int i = 0; i < 5; i++) {
@@ -6876,6 +7072,61 @@ UNINITIALIZED_TEST(RestoreHeapLimit) {
   reinterpret_cast<v8::Isolate*>(isolate)->Dispose();
 }
 
+struct HeapLimitFractionState {
+  int invocations = 0;
+  size_t live_size = 0;
+  double fraction = 0;
+};
+
+void HeapLimitFractionCallback(void* raw_state, size_t live_size,
+                               size_t heap_limit, double fraction) {
+  HeapLimitFractionState* state =
+      static_cast<HeapLimitFractionState*>(raw_state);
+  CHECK_GE(live_size, fraction * heap_limit);
+  state->invocations++;
+  state->live_size = live_size;
+  state->fraction = fraction;
+}
+
+UNINITIALIZED_TEST(HeapLimitFractionCallback) {
+  if (FLAG_stress_incremental_marking) return;
+  ManualGCScope manual_gc_scope;
+  const size_t kOldGenerationLimit = 50 * MB;
+  FLAG_max_old_space_size = kOldGenerationLimit / MB;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  Isolate* isolate =
+      reinterpret_cast<Isolate*>(v8::Isolate::New(create_params));
+  Heap* heap = isolate->heap();
+  Factory* factory = isolate->factory();
+  HeapLimitFractionState low, high;
+  heap->AddHeapLimitFractionCallback(HeapLimitFractionCallback, &low, 0.2);
+  heap->AddHeapLimitFractionCallback(HeapLimitFractionCallback, &high, 0.9);
+  const int kFixedArrayLength = 1000000;
+  {
+    HandleScope handle_scope(isolate);
+    std::vector<Handle<FixedArray>> arrays;
+    while (heap->OldGenerationSizeOfObjects() < kOldGenerationLimit / 4) {
+      arrays.push_back(
+          factory->NewFixedArray(kFixedArrayLength, AllocationType::kOld));
+    }
+    CcTest::CollectAllGarbage(isolate);
+    CHECK_EQ(1, low.invocations);
+    CHECK_EQ(0.2, low.fraction);
+    CHECK_EQ(0, high.invocations);
+    // The callback is only invoked again once the live size dropped below
+    // the fraction.
+    CcTest::CollectAllGarbage(isolate);
+    CHECK_EQ(1, low.invocations);
+  }
+  CcTest::CollectAllGarbage(isolate);
+  CcTest::CollectAllGarbage(isolate);
+  CHECK_EQ(1, low.invocations);
+  heap->RemoveHeapLimitFractionCallback(HeapLimitFractionCallback, &low);
+  heap->RemoveHeapLimitFractionCallback(HeapLimitFractionCallback, &high);
+  reinterpret_cast<v8::Isolate*>(isolate)->Dispose();
+}
+
 void HeapTester::UncommitFromSpace(Heap* heap) {
   heap->UncommitFromSpace();
   heap->memory_allocator()->unmapper()->EnsureUnmappingCompleted();
@@ -229,6 +229,29 @@ TEST(LazyMemoryMeasurement) {
   CHECK(!platform.TaskPosted());
 }
 
+TEST(ContextMemoryUsage) {
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> small = v8::Context::New(isolate);
+  v8::Local<v8::Context> large = v8::Context::New(isolate);
+  // The first query starts tracking.
+  CHECK_EQ(0u, isolate->GetContextMemoryUsage(small));
+  CHECK_EQ(0u, isolate->GetContextMemoryUsage(large));
+  {
+    v8::Context::Scope context_scope(large);
+    CompileRun(
+        "var retained = [];"
+        "for (var i = 0; i < 1000; i++) retained.push({a: i, b: [i]});");
+  }
+  CcTest::CollectAllGarbage();
+  size_t small_size = isolate->GetContextMemoryUsage(small);
+  size_t large_size = isolate->GetContextMemoryUsage(large);
+  CHECK_LT(0u, small_size);
+  CHECK_LT(small_size + 1000 * JSObject::kHeaderSize, large_size);
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -34,8 +34,10 @@
 #include "src/common/globals.h"
 #include "src/heap/factory.h"
 #include "src/heap/large-spaces.h"
+#include "src/heap/mark-compact.h"
 #include "src/heap/memory-allocator.h"
 #include "src/heap/memory-chunk.h"
+#include "src/heap/object-start-bitmap.h"
 #include "src/heap/spaces-inl.h"
 #include "src/heap/spaces.h"
 #include "src/objects/free-space.h"
@@ -753,6 +755,36 @@ TEST(ShrinkPageToHighWaterMarkTwoWordFiller) {
   CHECK_EQ(0u, shrunk);
 }
 
+TEST(FindObjectContaining) {
+  FLAG_object_start_bitmap = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+
+  const int kLength = 16;
+  std::vector<Handle<FixedArray>> arrays;
+  for (int i = 0; i < 8; i++) {
+    arrays.push_back(
+        isolate->factory()->NewFixedArray(kLength, AllocationType::kOld));
+  }
+  // Let the sweeper rebuild the object start bitmaps of the old space pages.
+  CcTest::CollectAllGarbage();
+  heap->mark_compact_collector()->EnsureSweepingCompleted();
+
+  PagedSpace* old_space = heap->old_space();
+  for (Handle<FixedArray> array : arrays) {
+    Page* page = Page::FromHeapObject(*array);
+    if (ObjectStartBitmap* object_starts = page->object_start_bitmap()) {
+      CHECK(object_starts->IsObjectStart(page, array->address()));
+    }
+    for (Address address = array->address();
+         address < array->address() + array->Size(); address += kTaggedSize) {
+      CHECK_EQ(*array, old_space->FindObjectContaining(address));
+    }
+  }
+}
+
 namespace {
 // PageAllocator that always fails.
 class FailingPageAllocator : public v8::PageAllocator {
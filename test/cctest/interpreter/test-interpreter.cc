@@ -5167,6 +5167,40 @@ TEST(InterpreterCollectSourcePositions_StackOverflow) {
   CHECK_GT(source_position_table.length(), 0);
 }
 
+TEST(InterpreterDiscardLazySourcePositions) {
+  FLAG_enable_lazy_source_positions = true;
+  FLAG_stress_lazy_source_positions = false;
+  HandleAndZoneScope handles;
+  Isolate* isolate = handles.main_isolate();
+
+  const char* source =
+      "(function () {\n"
+      "  return 1;\n"
+      "})";
+
+  Handle<JSFunction> function = Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+      *v8::Local<v8::Function>::Cast(CompileRun(source))));
+
+  Handle<SharedFunctionInfo> sfi = handle(function->shared(), isolate);
+  Handle<BytecodeArray> bytecode_array =
+      handle(sfi->GetBytecodeArray(), isolate);
+  Compiler::CollectSourcePositions(isolate, sfi);
+  CHECK(bytecode_array->HasSourcePositionTable());
+  ByteArray collected = bytecode_array->SourcePositionTable();
+
+  isolate->DiscardLazySourcePositions();
+  CHECK(!bytecode_array->HasSourcePositionTable());
+
+  // The table comes back unchanged when it is needed again.
+  SharedFunctionInfo::EnsureSourcePositionsAvailable(isolate, sfi);
+  CHECK(bytecode_array->HasSourcePositionTable());
+  ByteArray recollected = bytecode_array->SourcePositionTable();
+  CHECK_EQ(collected.length(), recollected.length());
+  for (int i = 0; i < collected.length(); i++) {
+    CHECK_EQ(collected.get(i), recollected.get(i));
+  }
+}
+
 TEST(InterpreterCollectSourcePositions_ThrowFrom1stFrame) {
   FLAG_enable_lazy_source_positions = true;
   FLAG_stress_lazy_source_positions = false;
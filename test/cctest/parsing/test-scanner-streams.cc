@@ -380,6 +380,35 @@ TEST(Utf8ChunkBoundaries) {
   }
 }
 
+TEST(Utf8SeekOverAsciiRuns) {
+  // Seeking forward in a utf-8 stream skips runs of ascii chars at once. Seek
+  // to every position around the non-ascii chars in the middle of the data.
+  const size_t kAsciiRunLength = 40;
+  std::string utf8 = std::string(kAsciiRunLength, 'a') + unicode_utf8 +
+                     std::string(kAsciiRunLength, 'b');
+  std::vector<uint16_t> ucs2(kAsciiRunLength, 'a');
+  for (size_t i = 0; unicode_ucs2[i]; i++) ucs2.push_back(unicode_ucs2[i]);
+  ucs2.insert(ucs2.end(), kAsciiRunLength, 'b');
+
+  for (size_t pos = 0; pos < ucs2.size(); pos++) {
+    // Positions within a surrogate pair cannot be sought to.
+    if (unibrow::Utf16::IsTrailSurrogate(ucs2[pos])) continue;
+
+    const char* chunks[] = {utf8.c_str(), ""};
+    ChunkSource chunk_source(chunks);
+    std::unique_ptr<v8::internal::Utf16CharacterStream> stream(
+        v8::internal::ScannerStream::For(
+            &chunk_source, v8::ScriptCompiler::StreamedSource::UTF8));
+
+    stream->Seek(pos);
+    for (size_t i = pos; i < ucs2.size(); i++) {
+      CHECK_EQ(ucs2[i], stream->Advance());
+    }
+    CHECK_EQ(v8::internal::Utf16CharacterStream::kEndOfInput,
+             stream->Advance());
+  }
+}
+
 TEST(Utf8SingleByteChunks) {
   // Have each byte as a single-byte chunk.
   size_t len = strlen(unicode_utf8);
@@ -891,15 +920,27 @@ TEST(CloneCharacterStreams) {
     CHECK(!two_byte_string_stream->can_be_cloned());
   }
 
-  // Chunk sources currently not cloneable.
+  // One-byte and two-byte chunk sources are cloneable, utf-8 ones are not.
   {
-    const char* chunks[] = {"1234", "\0"};
+    const char* chunks[] = {"abcd", "efghi", "\0"};
     ChunkSource chunk_source(chunks);
     std::unique_ptr<i::Utf16CharacterStream> one_byte_streaming_stream(
         i::ScannerStream::For(&chunk_source,
                               v8::ScriptCompiler::StreamedSource::ONE_BYTE));
-    CHECK(!one_byte_streaming_stream->can_be_cloned());
+    CHECK(one_byte_streaming_stream->can_be_cloned());
+    CHECK(one_byte_streaming_stream->can_be_cloned_for_parallel_access());
 
+    // Clones only see the chunks that have already arrived, so read the
+    // whole stream first.
+    TestCharacterStream(one_byte_source, one_byte_streaming_stream.get(),
+                        length, 0, length);
+    one_byte_streaming_stream->Seek(0);
+    TestCloneCharacterStream(one_byte_source, one_byte_streaming_stream.get(),
+                             length);
+  }
+  {
+    const char* chunks[] = {"1234", "\0"};
+    ChunkSource chunk_source(chunks);
     std::unique_ptr<i::Utf16CharacterStream> utf8_streaming_stream(
         i::ScannerStream::For(&chunk_source,
                               v8::ScriptCompiler::StreamedSource::UTF8));
@@ -908,6 +949,6 @@ TEST(CloneCharacterStreams) {
     std::unique_ptr<i::Utf16CharacterStream> two_byte_streaming_stream(
         i::ScannerStream::For(&chunk_source,
                               v8::ScriptCompiler::StreamedSource::TWO_BYTE));
-    CHECK(!two_byte_streaming_stream->can_be_cloned());
+    CHECK(two_byte_streaming_stream->can_be_cloned());
   }
 }
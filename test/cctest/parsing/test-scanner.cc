@@ -5,6 +5,8 @@
 // Tests v8::internal::Scanner. Note that presently most unit tests for the
 // Scanner are in cctest/test-parsing.cc, rather than here.
 
+#include <string>
+
 #include "src/handles/handles-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
@@ -105,5 +107,49 @@ TEST(AllThePushbacks) {
   }
 }
 
+TEST(WordAtATimeScanning) {
+  // Comments and strings are skipped a word of code units at a time, so check
+  // that their ends are found at every offset.
+  Zone zone(CcTest::i_isolate()->allocator(), ZONE_NAME);
+  for (int length = 0; length < 20; length++) {
+    std::string body;
+    for (int i = 0; i < length; i++) body += static_cast<char>('a' + i % 26);
+
+    {
+      std::string src = "'" + body + "' x";
+      auto scanner = make_scanner(src.c_str());
+      CHECK_TOK(Token::STRING, scanner->Next());
+      CHECK_EQ(body, std::string(scanner->CurrentLiteralAsCString(&zone)));
+      CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+      CHECK_TOK(Token::EOS, scanner->Next());
+    }
+    {
+      std::string src = "\"" + body + "\\t" + body + "\"";
+      auto scanner = make_scanner(src.c_str());
+      CHECK_TOK(Token::STRING, scanner->Next());
+      CHECK_EQ(body + "\t" + body,
+               std::string(scanner->CurrentLiteralAsCString(&zone)));
+      CHECK_TOK(Token::EOS, scanner->Next());
+    }
+    {
+      std::string src = "'" + body + "\n'";
+      auto scanner = make_scanner(src.c_str());
+      CHECK_TOK(Token::ILLEGAL, scanner->Next());
+    }
+
+    const std::string comments[] = {
+        "//" + body + "\nx",
+        "/*" + body + "*/x",
+        "/*" + body + "*" + body + "*/x",
+        "/*" + body + "\n" + body + "*/x",
+    };
+    for (const std::string& src : comments) {
+      auto scanner = make_scanner(src.c_str());
+      CHECK_TOK(Token::IDENTIFIER, scanner->Next());
+      CHECK_TOK(Token::EOS, scanner->Next());
+    }
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -7,8 +7,10 @@
 #include "src/base/utils/random-number-generator.h"
 #include "src/ic/accessor-assembler.h"
 #include "src/ic/stub-cache.h"
+#include "src/logging/tracing-flags.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/smi.h"
+#include "src/tracing/tracing-category-observer.h"
 #include "test/cctest/compiler/code-assembler-tester.h"
 #include "test/cctest/compiler/function-tester.h"
 
@@ -26,18 +28,20 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
   const int kNumParams = 2;
   CodeAssemblerTester data(isolate, kNumParams + 1);  // Include receiver.
   AccessorAssembler m(data.state());
+  StubCache* stub_cache = isolate->load_stub_cache();
 
   {
     TNode<Name> name = m.CAST(m.Parameter(1));
     TNode<Map> map = m.CAST(m.Parameter(2));
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(stub_cache, name, map);
     Node* result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
     } else {
       CHECK_EQ(StubCache::kSecondary, table);
-      result = m.StubCacheSecondaryOffsetForTesting(name, primary_offset);
+      result = m.StubCacheSecondaryOffsetForTesting(stub_cache, name,
+                                                    primary_offset);
     }
     m.Return(m.SmiTag(result));
   }
@@ -79,12 +83,12 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset = stub_cache->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
           expected_result =
-              StubCache::SecondaryOffsetForTesting(*name, primary_offset);
+              stub_cache->SecondaryOffsetForTesting(*name, primary_offset);
         }
       }
       Handle<Object> result = ft.Call(name, map).ToHandleChecked();
@@ -117,15 +121,21 @@ Handle<Code> CreateCodeOfKind(Code::Kind kind) {
 
 }  // namespace
 
-TEST(TryProbeStubCache) {
+namespace {
+
+void TestTryProbeStubCache(int primary_table_bits, int secondary_table_bits) {
   using Label = CodeStubAssembler::Label;
   Isolate* isolate(CcTest::InitIsolateOnce());
   const int kNumParams = 3;
   CodeAssemblerTester data(isolate, kNumParams + 1);  // Include receiver.
   AccessorAssembler m(data.state());
 
-  StubCache stub_cache(isolate);
+  StubCache stub_cache(isolate, primary_table_bits, secondary_table_bits);
   stub_cache.Clear();
+  const int kPrimaryTableSize = stub_cache.primary_table_size();
+  const int kSecondaryTableSize = stub_cache.secondary_table_size();
+  CHECK_EQ(1 << primary_table_bits, kPrimaryTableSize);
+  CHECK_EQ(1 << secondary_table_bits, kSecondaryTableSize);
 
   {
     TNode<Object> receiver = m.CAST(m.Parameter(1));
@@ -167,21 +177,21 @@ TEST(TryProbeStubCache) {
   Factory* factory = isolate->factory();
 
   // Generate some number of names.
-  for (int i = 0; i < StubCache::kPrimaryTableSize / 7; i++) {
+  for (int i = 0; i < kPrimaryTableSize / 7; i++) {
     Handle<Name> name;
     switch (rand_gen.NextInt(3)) {
       case 0: {
         // Generate string.
         std::stringstream ss;
         ss << "s" << std::hex
-           << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+           << (rand_gen.NextInt(Smi::kMaxValue) % kPrimaryTableSize);
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
       case 1: {
         // Generate number string.
         std::stringstream ss;
-        ss << (rand_gen.NextInt(Smi::kMaxValue) % StubCache::kPrimaryTableSize);
+        ss << (rand_gen.NextInt(Smi::kMaxValue) % kPrimaryTableSize);
         name = factory->InternalizeUtf8String(ss.str().c_str());
         break;
       }
@@ -197,7 +207,7 @@ TEST(TryProbeStubCache) {
   }
 
   // Generate some number of receiver maps and receivers.
-  for (int i = 0; i < StubCache::kSecondaryTableSize / 2; i++) {
+  for (int i = 0; i < kSecondaryTableSize / 2; i++) {
     Handle<Map> map = Map::Create(isolate, 0);
     receivers.push_back(factory->NewJSObjectFromMap(map));
   }
@@ -212,7 +222,7 @@ TEST(TryProbeStubCache) {
   DisallowHeapAllocation no_gc;
 
   // Populate {stub_cache}.
-  const int N = StubCache::kPrimaryTableSize + StubCache::kSecondaryTableSize;
+  const int N = kPrimaryTableSize + kSecondaryTableSize;
   for (int i = 0; i < N; i++) {
     int index = rand_gen.NextInt();
     Handle<Name> name = names[index % names.size()];
@@ -221,18 +231,20 @@ TEST(TryProbeStubCache) {
     stub_cache.Set(*name, receiver->map(), MaybeObject::FromObject(*handler));
   }
 
-  // Perform some queries.
-  bool queried_existing = false;
-  bool queried_non_existing = false;
+  // Perform some queries, counting the stub cache hits and misses.
+  unsigned previous_ic_stats = TracingFlags::ic_stats.exchange(
+      v8::tracing::TracingCategoryObserver::ENABLED_BY_NATIVE);
+  uint32_t hits = 0;
+  uint32_t misses = 0;
   for (int i = 0; i < N; i++) {
     int index = rand_gen.NextInt();
     Handle<Name> name = names[index % names.size()];
     Handle<JSObject> receiver = receivers[index % receivers.size()];
     MaybeObject handler = stub_cache.Get(*name, receiver->map());
     if (handler.ptr() == kNullAddress) {
-      queried_non_existing = true;
+      misses++;
     } else {
-      queried_existing = true;
+      hits++;
     }
 
     Handle<Object> expected_handler(handler->GetHeapObjectOrSmi(), isolate);
@@ -246,16 +258,33 @@ TEST(TryProbeStubCache) {
     Handle<JSObject> receiver = receivers[index2 % receivers.size()];
     MaybeObject handler = stub_cache.Get(*name, receiver->map());
     if (handler.ptr() == kNullAddress) {
-      queried_non_existing = true;
+      misses++;
     } else {
-      queried_existing = true;
+      hits++;
     }
 
     Handle<Object> expected_handler(handler->GetHeapObjectOrSmi(), isolate);
     ft.CheckTrue(receiver, name, expected_handler);
   }
+  TracingFlags::ic_stats.store(previous_ic_stats);
+
   // Ensure we performed both kind of queries.
-  CHECK(queried_existing && queried_non_existing);
+  CHECK(hits > 0 && misses > 0);
+  const StubCache::Stats& stats = stub_cache.stats();
+  CHECK_EQ(hits, stats.primary_hits + stats.secondary_hits);
+  CHECK_EQ(misses, stats.misses);
+}
+
+}  // namespace
+
+TEST(TryProbeStubCache) {
+  TestTryProbeStubCache(StubCache::kDefaultPrimaryTableBits,
+                        StubCache::kDefaultSecondaryTableBits);
+}
+
+TEST(TryProbeResizedStubCache) {
+  TestTryProbeStubCache(StubCache::kDefaultPrimaryTableBits + 2,
+                        StubCache::kDefaultSecondaryTableBits + 1);
 }
 
 }  // namespace internal
@@ -933,3 +933,47 @@ TEST(BackingStore_ReallocateShared) {
       v8::BackingStore::Reallocate(isolate, std::move(backing_store), 10);
   CHECK(new_backing_store->IsShared());
 }
+
+TEST(BackingStore_ResizeInPlace) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope handle_scope(isolate);
+  std::shared_ptr<v8::BackingStore> backing_store =
+      v8::ArrayBuffer::NewResizableBackingStore(isolate, 10, 1 * i::MB);
+  CHECK_EQ(backing_store->ByteLength(), 10);
+  CHECK(!backing_store->IsShared());
+  void* start = backing_store->Data();
+  uint8_t* data = reinterpret_cast<uint8_t*>(start);
+  for (uint8_t i = 0; i < 10; i++) {
+    data[i] = i;
+  }
+  Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, backing_store);
+  CHECK_EQ(ab->ByteLength(), 10);
+
+  // Growing keeps the data in place and exposes zeros.
+  CHECK(backing_store->ResizeInPlace(isolate, 256 * i::KB));
+  CHECK_EQ(backing_store->ByteLength(), 256 * i::KB);
+  CHECK_EQ(backing_store->Data(), start);
+  for (uint8_t i = 0; i < 10; i++) {
+    CHECK_EQ(data[i], i);
+  }
+  for (size_t index = 10; index < 256 * i::KB; index += 997) {
+    CHECK_EQ(data[index], 0);
+  }
+  CHECK_EQ(ab->ByteLength(), 10);
+  ab->Detach();
+  ab = v8::ArrayBuffer::New(isolate, backing_store);
+  CHECK_EQ(ab->ByteLength(), 256 * i::KB);
+  CHECK_EQ(ab->GetBackingStore()->Data(), start);
+
+  // Shrinking and growing again exposes zeros past the smaller length.
+  data[5 * i::KB] = 42;
+  CHECK(backing_store->ResizeInPlace(isolate, 4));
+  CHECK(backing_store->ResizeInPlace(isolate, 8 * i::KB));
+  CHECK_EQ(data[3], 3);
+  CHECK_EQ(data[4], 0);
+  CHECK_EQ(data[5 * i::KB], 0);
+
+  CHECK(!backing_store->ResizeInPlace(isolate, 2 * i::MB));
+  CHECK_EQ(backing_store->ByteLength(), 8 * i::KB);
+}
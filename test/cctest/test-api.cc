@@ -38,6 +38,7 @@
 #endif
 
 #include "include/v8-fast-api-calls.h"
+#include "include/v8-profiler.h"
 #include "include/v8-util.h"
 #include "src/api/api-inl.h"
 #include "src/base/overflowing-math.h"
@@ -762,6 +763,37 @@ THREADED_TEST(UsingExternalOneByteString) {
   CcTest::CollectAllGarbage();
 }
 
+TEST(NewExternalUtf8) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  int dispose_count = 0;
+  {
+    v8::HandleScope scope(isolate);
+    // ASCII data is used without copying.
+    const char* ascii = "plain ascii";
+    auto* resource = new TestOneByteResource(i::StrDup(ascii), &dispose_count);
+    Local<String> string =
+        String::NewExternalUtf8(isolate, resource).ToLocalChecked();
+    CHECK(string->IsExternalOneByte());
+    CHECK_EQ(resource, string->GetExternalOneByteStringResource());
+    CHECK(string->StrictEquals(v8_str(ascii)));
+    CHECK_EQ(0, dispose_count);
+
+    // Other data is decoded, and the resource is disposed right away.
+    const char* utf8 = "caf\xC3\xA9 \xE2\x82\xAC";
+    string = String::NewExternalUtf8(
+                 isolate, new TestOneByteResource(i::StrDup(utf8),
+                                                  &dispose_count))
+                 .ToLocalChecked();
+    CHECK(!string->IsExternal());
+    CHECK_EQ(1, dispose_count);
+    CHECK_EQ(6, string->Length());
+    CHECK(string->StrictEquals(v8_str(utf8)));
+  }
+  CcTest::CollectAllAvailableGarbage();
+  CHECK_EQ(2, dispose_count);
+}
+
 
 class RandomLengthResource : public v8::String::ExternalStringResource {
  public:
@@ -2010,6 +2042,39 @@ THREADED_TEST(GlobalPrototype) {
 }
 
 
+TEST(ObjectTemplateInstantiationCacheGrows) {
+  LocalContext env;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  const int kTemplates =
+      2 * i::TemplateInfo::kFastTemplateInstantiationsCacheSize;
+  Local<ObjectTemplate> templ;
+  for (int i = 0; i < kTemplates; i++) {
+    templ = ObjectTemplate::New(isolate);
+  }
+  templ->Set(isolate, "x", v8_num(10));
+  Local<v8::Object> instance1 =
+      templ->NewInstance(env.local()).ToLocalChecked();
+  Local<v8::Object> instance2 =
+      templ->NewInstance(env.local()).ToLocalChecked();
+  CHECK(!instance1->StrictEquals(instance2));
+  CHECK(instance2->Get(env.local(), v8_str("x"))
+            .ToLocalChecked()
+            ->StrictEquals(v8_num(10)));
+  CHECK(instance1->Set(env.local(), v8_str("x"), v8_num(11)).FromJust());
+  CHECK(templ->NewInstance(env.local())
+            .ToLocalChecked()
+            ->Get(env.local(), v8_str("x"))
+            .ToLocalChecked()
+            ->StrictEquals(v8_num(10)));
+
+  // The instantiation is cached in the fast, array-based cache.
+  i::Handle<i::Context> context = v8::Utils::OpenHandle(*env.local());
+  CHECK_GT(context->native_context().fast_template_instantiations_cache()
+               .length(),
+           i::TemplateInfo::kFastTemplateInstantiationsCacheSize);
+}
+
 THREADED_TEST(ObjectTemplate) {
   LocalContext env;
   v8::Isolate* isolate = CcTest::isolate();
@@ -2754,6 +2819,45 @@ THREADED_TEST(InternalFields) {
   CHECK_EQ(17, obj->GetInternalField(0)->Int32Value(env.local()).FromJust());
 }
 
+TEST(InternalFieldAccessor) {
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
+  templ->SetInternalFieldCount(2);
+  templ->SetInternalFieldAccessor(v8_str("first"), 0);
+  templ->SetInternalFieldAccessor(v8_str("second"), 1, v8::ReadOnly);
+  Local<v8::Object> obj = templ->NewInstance(env.local()).ToLocalChecked();
+  obj->SetInternalField(0, v8_num(17));
+  obj->SetInternalField(1, v8_str("value"));
+  CHECK(env->Global()->Set(env.local(), v8_str("obj"), obj).FromJust());
+
+  CompileRun(
+      "function first(o) { return o.first; }"
+      "function second(o) { return o.second; }"
+      "%PrepareFunctionForOptimization(first);"
+      "%PrepareFunctionForOptimization(second);");
+  for (int i = 0; i < 3; i++) {
+    obj->SetInternalField(0, v8_num(17 + i));
+    CHECK_EQ(17 + i, v8_run_int32value(v8_compile("first(obj)")));
+    ExpectString("second(obj)", "value");
+  }
+  CompileRun(
+      "%OptimizeFunctionOnNextCall(first);"
+      "%OptimizeFunctionOnNextCall(second);");
+  obj->SetInternalField(0, v8_num(42));
+  obj->SetInternalField(1, v8_str("other"));
+  CHECK_EQ(42, v8_run_int32value(v8_compile("first(obj)")));
+  ExpectString("second(obj)", "other");
+
+  // The properties look like data properties.
+  ExpectTrue(
+      "var desc = Object.getOwnPropertyDescriptor(obj, 'second');"
+      "desc.value === 'other' && !desc.writable");
+}
+
 TEST(InternalFieldsSubclassing) {
   LocalContext env;
   v8::Isolate* isolate = env->GetIsolate();
@@ -4803,6 +4907,48 @@ THREADED_TEST(GetSetProperty) {
 }
 
 
+THREADED_TEST(GetAndSetProperties) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  Local<v8::Object> obj =
+      CompileRun(
+          "var getter_calls = 0;"
+          "({ a: 1, b: 'two', get c() { return ++getter_calls; }, 0: 'zero' })")
+          .As<v8::Object>();
+  Local<v8::Name> keys[] = {v8_str("a"), v8_str("b"), v8_str("c"),
+                            v8_str("0"), v8_str("missing")};
+  Local<Value> values[arraysize(keys)];
+  CHECK(obj->GetProperties(context.local(), keys, arraysize(keys), values)
+            .FromJust());
+  CHECK(values[0]->StrictEquals(v8_num(1)));
+  CHECK(values[1]->StrictEquals(v8_str("two")));
+  CHECK(values[2]->StrictEquals(v8_num(1)));
+  CHECK(values[3]->StrictEquals(v8_str("zero")));
+  CHECK(values[4]->IsUndefined());
+
+  Local<Value> new_values[] = {v8_num(3), v8_str("four"), v8_num(5),
+                               v8_num(6), v8_num(7)};
+  CHECK(obj->SetProperties(context.local(), keys, new_values, arraysize(keys))
+            .FromJust());
+  CHECK(obj->GetProperties(context.local(), keys, arraysize(keys), values)
+            .FromJust());
+  CHECK(values[0]->StrictEquals(v8_num(3)));
+  CHECK(values[1]->StrictEquals(v8_str("four")));
+  // The accessor has no setter.
+  CHECK(values[2]->StrictEquals(v8_num(2)));
+  CHECK(values[3]->StrictEquals(v8_num(6)));
+  CHECK(values[4]->StrictEquals(v8_num(7)));
+
+  // A throwing getter leaves the values untouched.
+  Local<v8::Object> throwing =
+      CompileRun("({ a: 1, get b() { throw 'b'; } })").As<v8::Object>();
+  v8::TryCatch try_catch(isolate);
+  CHECK(throwing->GetProperties(context.local(), keys, 2, values).IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK(values[0]->StrictEquals(v8_num(3)));
+}
+
 THREADED_TEST(PropertyAttributes) {
   LocalContext context;
   v8::HandleScope scope(context->GetIsolate());
@@ -13839,6 +13985,20 @@ TEST(ExternalAllocatedMemory) {
            isolate->AdjustAmountOfExternalAllocatedMemory(-kTriggerGCSize));
 }
 
+TEST(ExternalAllocatedMemoryInHeapStatistics) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope outer(isolate);
+  const int64_t kSize = 1024 * 1024;
+  int64_t baseline = isolate->AdjustAmountOfExternalAllocatedMemory(kSize);
+  v8::HeapStatistics heap_statistics;
+  isolate->GetHeapStatistics(&heap_statistics);
+  CHECK_EQ(static_cast<size_t>(baseline),
+           heap_statistics.reported_external_memory());
+  CHECK_LT(0, heap_statistics.external_memory_limit());
+  CHECK_EQ(baseline - kSize,
+           isolate->AdjustAmountOfExternalAllocatedMemory(-kSize));
+}
+
 
 TEST(Regress51719) {
   i::FLAG_incremental_marking = false;
@@ -16395,6 +16555,53 @@ TEST(PromiseHook) {
   isolate->SetPromiseHook(nullptr);
 }
 
+TEST(ContextPromiseHooks) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CompileRun(
+      "var log = [];\n"
+      "var ids = new WeakMap();\n"
+      "function id(p) {\n"
+      "  if (p === undefined) return 0;\n"
+      "  if (!ids.has(p)) ids.set(p, ids.size + 1);\n"
+      "  return ids.get(p);\n"
+      "}\n"
+      "function init(p, parent) {\n"
+      "  log.push('init ' + id(p) + ' ' + id(parent));\n"
+      "}\n"
+      "function before(p) { log.push('before ' + id(p)); }\n"
+      "function after(p) { log.push('after ' + id(p)); }\n"
+      "function resolve(p) { log.push('resolve ' + id(p)); }\n");
+  auto get_function = [&](const char* name) {
+    return Local<Function>::Cast(
+        env->Global()->Get(env.local(), v8_str(name)).ToLocalChecked());
+  };
+  env->SetPromiseHooks(get_function("init"), get_function("before"),
+                       get_function("after"), get_function("resolve"));
+
+  CompileRun(
+      "var p = new Promise(r => r(1));\n"
+      "var q = p.then(() => {});\n");
+  isolate->PerformMicrotaskCheckpoint();
+  ExpectString("log.join()",
+               "init 1 0,resolve 1,init 2 1,before 2,resolve 2,after 2");
+
+  // Exceptions thrown by hooks don't affect the promises.
+  CompileRun("function throwing() { throw new Error(); }");
+  env->SetPromiseHooks(get_function("throwing"), get_function("throwing"),
+                       get_function("throwing"), get_function("throwing"));
+  CompileRun("var x = 0; Promise.resolve().then(() => x = 1);");
+  isolate->PerformMicrotaskCheckpoint();
+  ExpectInt32("x", 1);
+
+  env->SetPromiseHooks(Local<Function>(), Local<Function>(), Local<Function>(),
+                       Local<Function>());
+  CompileRun("log = []; Promise.resolve().then(() => {});");
+  isolate->PerformMicrotaskCheckpoint();
+  ExpectString("log.join()", "");
+}
+
 
 TEST(EvalWithSourceURLInMessageScriptResourceNameOrSourceURL) {
   LocalContext context;
@@ -16629,6 +16836,183 @@ TEST(GetHeapSpaceStatistics) {
   CHECK_EQ(total_physical_size, heap_statistics.total_physical_size());
 }
 
+static v8::Local<v8::UnboundScript> CompileUnboundForCache(
+    v8::Isolate* isolate, const std::string& source) {
+  v8::ScriptOrigin origin(v8_str("compilation-cache-test.js"));
+  v8::ScriptCompiler::Source script_source(v8_str(source.c_str()), origin);
+  return v8::ScriptCompiler::CompileUnboundScript(isolate, &script_source)
+      .ToLocalChecked();
+}
+
+TEST(CompilationCacheSharedAcrossContexts) {
+  i::Isolate* i_isolate = CcTest::i_isolate();
+  if (!i::FLAG_compilation_cache || !i_isolate->snapshot_available()) return;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  const std::string source = "var shared_across_contexts = 42;";
+
+  v8::CompilationCacheStatistics before;
+  CHECK(isolate->GetCompilationCacheStatistics(&before));
+  v8::Local<v8::UnboundScript> first;
+  {
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    first = CompileUnboundForCache(isolate, source);
+  }
+  v8::Local<v8::UnboundScript> second;
+  {
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    second = CompileUnboundForCache(isolate, source);
+  }
+  CHECK(v8::Utils::OpenHandle(*first).is_identical_to(
+      v8::Utils::OpenHandle(*second)));
+
+  v8::CompilationCacheStatistics after;
+  CHECK(isolate->GetCompilationCacheStatistics(&after));
+  CHECK_EQ(before.script_hits() + 1, after.script_hits());
+  CHECK_EQ(before.script_misses() + 1, after.script_misses());
+  CHECK_LE(source.length(), after.script_source_size());
+}
+
+TEST(CompilationCacheScriptSizeLimit) {
+  if (!i::FLAG_compilation_cache) return;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CcTest::i_isolate()->compilation_cache()->Clear();
+  i::FLAG_compilation_cache_script_max_size = 1;
+
+  // Three scripts of 400 bytes each don't fit into the 1KB limit together.
+  auto make_source = [](char name) {
+    std::string source = std::string("var ") + name + " = 1; //";
+    source.resize(400, '-');
+    return source;
+  };
+  const std::string a = make_source('a');
+  const std::string b = make_source('b');
+  const std::string c = make_source('c');
+
+  v8::CompilationCacheStatistics stats;
+  CompileUnboundForCache(isolate, a);
+  CompileUnboundForCache(isolate, b);
+  // Using {a} again makes {b} the least recently used script.
+  CompileUnboundForCache(isolate, a);
+  CHECK(isolate->GetCompilationCacheStatistics(&stats));
+  size_t hits = stats.script_hits();
+  size_t evictions = stats.script_evictions();
+  CHECK_EQ(800u, stats.script_source_size());
+
+  CompileUnboundForCache(isolate, c);
+  CHECK(isolate->GetCompilationCacheStatistics(&stats));
+  CHECK_EQ(evictions + 1, stats.script_evictions());
+  CHECK_EQ(800u, stats.script_source_size());
+
+  CompileUnboundForCache(isolate, a);
+  CompileUnboundForCache(isolate, c);
+  CHECK(isolate->GetCompilationCacheStatistics(&stats));
+  CHECK_EQ(hits + 2, stats.script_hits());
+
+  size_t misses = stats.script_misses();
+  CompileUnboundForCache(isolate, b);
+  CHECK(isolate->GetCompilationCacheStatistics(&stats));
+  CHECK_EQ(misses + 1, stats.script_misses());
+
+  i::FLAG_compilation_cache_script_max_size = 0;
+}
+
+TEST(CompilationCacheFunctionConstructorSharedAcrossContexts) {
+  i::Isolate* i_isolate = CcTest::i_isolate();
+  if (!i::FLAG_compilation_cache || !i_isolate->snapshot_available()) return;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  i_isolate->compilation_cache()->Clear();
+  auto shared_of = [](v8::Local<v8::Value> value) {
+    i::Handle<i::JSFunction> function =
+        i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*value));
+    return i::handle(function->shared(), function->GetIsolate());
+  };
+
+  // The second compilation of a source puts it into the cache.
+  i::Handle<i::SharedFunctionInfo> first;
+  {
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    CompileRun("new Function('a', 'return a + 1')");
+    first = shared_of(CompileRun("new Function('a', 'return a + 1')"));
+  }
+
+  v8::CompilationCacheStatistics before;
+  CHECK(isolate->GetCompilationCacheStatistics(&before));
+  {
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    CHECK(first.is_identical_to(
+        shared_of(CompileRun("new Function('a', 'return a + 1')"))));
+    CHECK(first.is_identical_to(shared_of(CompileRun(
+        "(function() { return Function('a', 'return a + 1'); })()"))));
+  }
+  v8::CompilationCacheStatistics after;
+  CHECK(isolate->GetCompilationCacheStatistics(&after));
+  CHECK_EQ(before.eval_hits() + 2, after.eval_hits());
+}
+
+TEST(CompilationCacheEvalSizeLimit) {
+  if (!i::FLAG_compilation_cache) return;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CcTest::i_isolate()->compilation_cache()->Clear();
+  i::FLAG_compilation_cache_eval_max_size = 1;
+
+  // Three sources of 400 bytes each don't fit into the 1KB limit together.
+  auto make_source = [](char name) {
+    std::string source = std::string("var ") + name + " = 1; //";
+    source.resize(400, '-');
+    return source;
+  };
+  const std::string a = make_source('a');
+  const std::string b = make_source('b');
+  const std::string c = make_source('c');
+  auto indirect_eval = [&](const std::string& source) {
+    CHECK(env->Global()
+              ->Set(env.local(), v8_str("source"), v8_str(source.c_str()))
+              .FromJust());
+    CompileRun("(0, eval)(source)");
+  };
+
+  // The second evaluation of a source puts it into the cache.
+  v8::CompilationCacheStatistics stats;
+  indirect_eval(a);
+  indirect_eval(a);
+  indirect_eval(b);
+  indirect_eval(b);
+  // Using {a} again makes {b} the least recently used source.
+  indirect_eval(a);
+  CHECK(isolate->GetCompilationCacheStatistics(&stats));
+  size_t hits = stats.eval_hits();
+  size_t evictions = stats.eval_evictions();
+  CHECK_EQ(800u, stats.eval_source_size());
+
+  indirect_eval(c);
+  indirect_eval(c);
+  CHECK(isolate->GetCompilationCacheStatistics(&stats));
+  CHECK_EQ(evictions + 1, stats.eval_evictions());
+  CHECK_EQ(800u, stats.eval_source_size());
+
+  indirect_eval(a);
+  indirect_eval(c);
+  CHECK(isolate->GetCompilationCacheStatistics(&stats));
+  CHECK_EQ(hits + 2, stats.eval_hits());
+
+  size_t misses = stats.eval_misses();
+  indirect_eval(b);
+  CHECK(isolate->GetCompilationCacheStatistics(&stats));
+  CHECK_EQ(misses + 1, stats.eval_misses());
+
+  i::FLAG_compilation_cache_eval_max_size = 0;
+}
+
 TEST(NumberOfNativeContexts) {
   static const size_t kNumTestContexts = 10;
   i::Isolate* isolate = CcTest::i_isolate();
@@ -20989,6 +21373,97 @@ THREADED_TEST(JSONParseArray) {
                      i::PACKED_ELEMENTS);
 }
 
+namespace {
+// Feeds |json| to |parser| in chunks of |chunk_size| bytes.
+bool FeedJSONInChunks(Local<Context> context,
+                      v8::JSON::StreamingParser* parser, const char* json,
+                      size_t chunk_size) {
+  const uint8_t* data = reinterpret_cast<const uint8_t*>(json);
+  size_t length = strlen(json);
+  for (size_t offset = 0; offset < length; offset += chunk_size) {
+    size_t size = std::min(chunk_size, length - offset);
+    if (parser->Feed(context, data + offset, size).IsNothing()) return false;
+  }
+  return true;
+}
+
+class CollectingJSONClient : public v8::JSON::StreamingParser::Client {
+ public:
+  explicit CollectingJSONClient(v8::Isolate* isolate)
+      : elements_(v8::Array::New(isolate)) {}
+
+  Maybe<bool> OnArrayElement(Local<Context> context,
+                             Local<Value> element) override {
+    return elements_->Set(context, elements_->Length(), element);
+  }
+
+  Local<v8::Array> elements() const { return elements_; }
+
+ private:
+  Local<v8::Array> elements_;
+};
+}  // namespace
+
+THREADED_TEST(JSONStreamingParser) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Local<Object> global = context->Global();
+
+  const char* inputs[] = {
+      " [1, \"a,]\\\"\", {\"x\": [2, {}]}, [], \"\xC3\xA9\xE2\x82\xAC\"] ",
+      "[]",
+      " { \"x\": [1, 2] } ",
+      "\"\xF0\x9F\x98\x80\"",
+  };
+  for (const char* input : inputs) {
+    Local<Value> expected =
+        v8::JSON::Parse(context.local(), v8_str(input)).ToLocalChecked();
+    global->Set(context.local(), v8_str("expected"), expected).FromJust();
+    // Chunks of a single byte split multi-byte characters.
+    for (size_t chunk_size : {1, 2, 3, 100}) {
+      v8::JSON::StreamingParser parser(isolate);
+      CHECK(FeedJSONInChunks(context.local(), &parser, input, chunk_size));
+      Local<Value> value = parser.Finish(context.local()).ToLocalChecked();
+      global->Set(context.local(), v8_str("value"), value).FromJust();
+      CHECK(CompileRun("JSON.stringify(value) === JSON.stringify(expected)")
+                ->IsTrue());
+    }
+  }
+
+  // A client receives the elements of a top-level array one by one.
+  {
+    CollectingJSONClient client(isolate);
+    v8::JSON::StreamingParser parser(isolate, &client);
+    CHECK(FeedJSONInChunks(context.local(), &parser, "[1, [2, 3], {\"a\": 4}]",
+                           1));
+    CHECK(parser.Finish(context.local()).ToLocalChecked()->IsUndefined());
+    global->Set(context.local(), v8_str("value"), client.elements()).FromJust();
+    ExpectString("JSON.stringify(value)", "[1,[2,3],{\"a\":4}]");
+  }
+
+  // A malformed element fails as soon as it is complete.
+  {
+    v8::TryCatch try_catch(isolate);
+    v8::JSON::StreamingParser parser(isolate);
+    const char* input = "[1, tru, 3";
+    CHECK(!FeedJSONInChunks(context.local(), &parser, input, strlen(input)));
+    CHECK(try_catch.HasCaught());
+    CHECK(try_catch.Exception()->IsNativeError());
+  }
+
+  const char* invalid_inputs[] = {"", "  ", "[1, 2", "[1,]", "[,]", "[1] x",
+                                  "[1}", "{"};
+  for (const char* input : invalid_inputs) {
+    v8::TryCatch try_catch(isolate);
+    v8::JSON::StreamingParser parser(isolate);
+    if (FeedJSONInChunks(context.local(), &parser, input, 1)) {
+      CHECK(parser.Finish(context.local()).IsEmpty());
+    }
+    CHECK(try_catch.HasCaught());
+  }
+}
+
 THREADED_TEST(JSONStringifyObject) {
   LocalContext context;
   HandleScope scope(context->GetIsolate());
@@ -21017,6 +21492,89 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+class StringOutputStream : public v8::OutputStream {
+ public:
+  explicit StringOutputStream(int chunk_size, int abort_after = -1)
+      : chunk_size_(chunk_size), abort_after_(abort_after) {}
+
+  void EndOfStream() override { ended_ = true; }
+  int GetChunkSize() override { return chunk_size_; }
+  WriteResult WriteAsciiChunk(char* data, int size) override {
+    CHECK(!ended_);
+    CHECK_LE(size, chunk_size_);
+    if (chunks_ == abort_after_) return kAbort;
+    chunks_++;
+    output_.append(data, size);
+    return kContinue;
+  }
+
+  const std::string& output() const { return output_; }
+  bool ended() const { return ended_; }
+
+ private:
+  int chunk_size_;
+  int abort_after_;
+  int chunks_ = 0;
+  bool ended_ = false;
+  std::string output_;
+};
+}  // namespace
+
+THREADED_TEST(JSONStringifyToUtf8) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  Local<Value> value = CompileRun(
+      "({ascii: 'x'.repeat(100) + '\"\\\\\\n' + 'y'.repeat(37),"
+      "  latin1: '\\xE9'.repeat(10), two_byte: '\\u20AC\\uD83D\\uDE00',"
+      "  lone: '\\uD800x', list: [1, 2.5, null, true]})");
+  Local<String> json =
+      v8::JSON::Stringify(context.local(), value).ToLocalChecked();
+  v8::String::Utf8Value expected(isolate, json);
+
+  for (int chunk_size : {4, 5, 7, 1024}) {
+    StringOutputStream stream(chunk_size);
+    CHECK(v8::JSON::StringifyToUtf8(context.local(), value, &stream)
+              .FromJust());
+    CHECK(stream.ended());
+    CHECK_EQ(std::string(*expected, expected.length()), stream.output());
+  }
+
+  // The gap is applied as by Stringify.
+  {
+    Local<String> gap = v8_str("  ");
+    Local<String> json_with_gap =
+        v8::JSON::Stringify(context.local(), value, gap).ToLocalChecked();
+    v8::String::Utf8Value expected_with_gap(isolate, json_with_gap);
+    StringOutputStream stream(16);
+    CHECK(v8::JSON::StringifyToUtf8(context.local(), value, &stream, gap)
+              .FromJust());
+    CHECK_EQ(std::string(*expected_with_gap, expected_with_gap.length()),
+             stream.output());
+  }
+
+  // Aborting the stream skips EndOfStream.
+  {
+    StringOutputStream stream(4, 2);
+    CHECK(!v8::JSON::StringifyToUtf8(context.local(), value, &stream)
+               .FromJust());
+    CHECK(!stream.ended());
+    CHECK_EQ(8u, stream.output().length());
+  }
+
+  // Exceptions are propagated.
+  {
+    v8::TryCatch try_catch(isolate);
+    Local<Value> cyclic = CompileRun("var cyclic = {}; cyclic.x = cyclic;");
+    StringOutputStream stream(1024);
+    CHECK(v8::JSON::StringifyToUtf8(context.local(), cyclic, &stream)
+              .IsNothing());
+    CHECK(try_catch.HasCaught());
+    CHECK(!stream.ended());
+  }
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -23458,6 +24016,28 @@ TEST(StreamingBiggerScript) {
 }
 
 
+TEST(StreamingScriptWithParallelCompileTasks) {
+  // Eagerly compiled top-level functions of a streamed script are handed to
+  // the compiler dispatcher, which needs to clone the chunked stream.
+  i::FLAG_compiler_dispatcher = true;
+  i::FLAG_parallel_compile_tasks = true;
+  const char* chunks[] = {"var f = (function foo() { ret", "urn 13; });\n",
+                          "var g = (function bar() { return f(); });\n",
+                          "g();", nullptr};
+  RunStreamingTest(chunks);
+}
+
+TEST(StreamingScriptFinalizedOnBackgroundWithLogging) {
+  // Functions finalized off-thread are looked up by their function literal id
+  // when the main thread needs to log them.
+  i::FLAG_finalize_streaming_on_background = true;
+  i::FLAG_log_function_events = true;
+  const char* chunks[] = {"var f = (function foo() { ret", "urn 13; });\n",
+                          "var g = (function bar() { return f(); });\n",
+                          "g();", nullptr};
+  RunStreamingTest(chunks);
+}
+
 TEST(StreamingScriptWithParseError) {
   // Test that parse errors from streamed scripts are propagated correctly.
   {
@@ -27475,6 +28055,61 @@ struct UnexpectedObjectChecker
   }
 };
 
+template <typename T>
+struct ApiTypedArrayChecker
+    : BasicApiChecker<const v8::FastApiTypedArray<T>&,
+                      ApiTypedArrayChecker<T>> {
+  static void FastCallback(v8::ApiObject receiver,
+                           const v8::FastApiTypedArray<T>& argument,
+                           int* fallback) {
+    v8::Object* receiver_obj = reinterpret_cast<v8::Object*>(&receiver);
+    ApiTypedArrayChecker<T>* receiver_ptr =
+        GetInternalField<ApiTypedArrayChecker<T>, kV8WrapperObjectIndex>(
+            receiver_obj);
+    receiver_ptr->result_ |= ApiCheckerResult::kFastCalled;
+    receiver_ptr->fast_length_ = argument.length;
+    receiver_ptr->fast_sum_ = 0;
+    for (size_t i = 0; i < argument.length; ++i) {
+      receiver_ptr->fast_sum_ += argument.data[i];
+    }
+  }
+
+  static void SlowCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Object* receiver_obj = v8::Object::Cast(*info.Holder());
+    ApiTypedArrayChecker<T>* receiver_ptr =
+        GetInternalField<ApiTypedArrayChecker<T>, kV8WrapperObjectIndex>(
+            receiver_obj);
+    receiver_ptr->result_ |= ApiCheckerResult::kSlowCalled;
+  }
+
+  size_t fast_length_ = 0;
+  double fast_sum_ = 0;
+};
+
+struct ApiOneByteStringChecker
+    : BasicApiChecker<const v8::FastOneByteString&, ApiOneByteStringChecker> {
+  static void FastCallback(v8::ApiObject receiver,
+                           const v8::FastOneByteString& argument,
+                           int* fallback) {
+    v8::Object* receiver_obj = reinterpret_cast<v8::Object*>(&receiver);
+    ApiOneByteStringChecker* receiver_ptr =
+        GetInternalField<ApiOneByteStringChecker, kV8WrapperObjectIndex>(
+            receiver_obj);
+    receiver_ptr->result_ |= ApiCheckerResult::kFastCalled;
+    receiver_ptr->fast_value_ = std::string(argument.data, argument.length);
+  }
+
+  static void SlowCallback(const v8::FunctionCallbackInfo<v8::Value>& info) {
+    v8::Object* receiver_obj = v8::Object::Cast(*info.Holder());
+    ApiOneByteStringChecker* receiver_ptr =
+        GetInternalField<ApiOneByteStringChecker, kV8WrapperObjectIndex>(
+            receiver_obj);
+    receiver_ptr->result_ |= ApiCheckerResult::kSlowCalled;
+  }
+
+  std::string fast_value_;
+};
+
 enum class Behavior {
   kNoException,
   kException,  // An exception should be thrown by the callback function.
@@ -27684,6 +28319,99 @@ void CallWithUnexpectedObjectType(v8::Local<v8::Value> receiver) {
   CHECK(checker.DidCallSlow());
 }
 
+template <typename Value, typename Impl>
+void CallWithArgument(BasicApiChecker<Value, Impl>* checker,
+                      const char* argument_source) {
+  LocalContext env;
+  SetupTest(CompileRun(argument_source), &env, checker,
+            "function func(arg) { receiver.api_func(arg); }"
+            "%PrepareFunctionForOptimization(func);"
+            "func(value);");
+  checker->result_ = ApiCheckerResult::kNotCalled;
+  CompileRun(
+      "%OptimizeFunctionOnNextCall(func);"
+      "func(value);");
+}
+
+void CallWithTypedArrays() {
+  {
+    ApiTypedArrayChecker<uint8_t> checker;
+    CallWithArgument(&checker, "new Uint8Array([1, 2, 3])");
+    CHECK(checker.DidCallFast());
+    CHECK(!checker.DidCallSlow());
+    CHECK_EQ(3u, checker.fast_length_);
+    CHECK_EQ(6.0, checker.fast_sum_);
+  }
+  {
+    ApiTypedArrayChecker<double> checker;
+    CallWithArgument(&checker, "new Float64Array([1.5, 2.5])");
+    CHECK(checker.DidCallFast());
+    CHECK(!checker.DidCallSlow());
+    CHECK_EQ(2u, checker.fast_length_);
+    CHECK_EQ(4.0, checker.fast_sum_);
+  }
+  {
+    // Typed arrays with an off-heap backing store.
+    ApiTypedArrayChecker<uint8_t> checker;
+    CallWithArgument(&checker,
+                     "var a = new Uint8Array(new ArrayBuffer(1024));"
+                     "a[0] = 1; a[1023] = 2; a");
+    CHECK(checker.DidCallFast());
+    CHECK_EQ(1024u, checker.fast_length_);
+    CHECK_EQ(3.0, checker.fast_sum_);
+  }
+  {
+    // Typed arrays with another element type use the slow callback.
+    ApiTypedArrayChecker<double> checker;
+    CallWithArgument(&checker, "new Uint8Array([1, 2, 3])");
+    CHECK(!checker.DidCallFast());
+    CHECK(checker.DidCallSlow());
+  }
+  {
+    ApiTypedArrayChecker<uint8_t> checker;
+    CallWithArgument(&checker, "[1, 2, 3]");
+    CHECK(!checker.DidCallFast());
+    CHECK(checker.DidCallSlow());
+  }
+  {
+    ApiTypedArrayChecker<uint8_t> checker;
+    CallWithArgument(&checker,
+                     "var a = new Uint8Array(4);"
+                     "%ArrayBufferDetach(a.buffer); a");
+    CHECK(!checker.DidCallFast());
+    CHECK(checker.DidCallSlow());
+  }
+}
+
+void CallWithOneByteStrings() {
+  {
+    ApiOneByteStringChecker checker;
+    CallWithArgument(&checker, "'hello'");
+    CHECK(checker.DidCallFast());
+    CHECK(!checker.DidCallSlow());
+    CHECK_EQ(std::string("hello"), checker.fast_value_);
+  }
+  {
+    ApiOneByteStringChecker checker;
+    CallWithArgument(&checker, "'\\u0444'");
+    CHECK(!checker.DidCallFast());
+    CHECK(checker.DidCallSlow());
+  }
+  {
+    // Cons strings are not flat.
+    ApiOneByteStringChecker checker;
+    CallWithArgument(&checker, "'a'.repeat(20) + 'b'.repeat(20)");
+    CHECK(!checker.DidCallFast());
+    CHECK(checker.DidCallSlow());
+  }
+  {
+    ApiOneByteStringChecker checker;
+    CallWithArgument(&checker, "42");
+    CHECK(!checker.DidCallFast());
+    CHECK(checker.DidCallSlow());
+  }
+}
+
 class TestCFunctionInfo : public v8::CFunctionInfo {
   const v8::CTypeInfo& ReturnInfo() const override {
     static v8::CTypeInfo return_info =
@@ -27878,6 +28606,10 @@ TEST(FastApiCalls) {
   CallWithUnexpectedObjectType(v8_str("str"));
   CallWithUnexpectedObjectType(CompileRun("new Proxy({}, {});"));
 
+  // Typed array and string arguments
+  CallWithTypedArrays();
+  CallWithOneByteStrings();
+
   // TODO(mslekova): Add corner cases for 64-bit values.
   // TODO(mslekova): Add main cases for float and double.
   // TODO(mslekova): Restructure the tests so that the fast optimized calls
@@ -28069,3 +28801,75 @@ TEST(TriggerThreadSafeMetricsEvent) {
   CHECK_EQ(recorder->count_, 1);  // Increased.
   CHECK_EQ(recorder->module_count_, 42);
 }
+
+namespace {
+
+class CompileAndGCMetricsRecorder : public v8::metrics::Recorder {
+ public:
+  size_t compiled_count_ = 0;
+  size_t gc_count_ = 0;
+  size_t full_gc_count_ = 0;
+
+  void AddMainThreadEvent(const v8::metrics::JavaScriptFunctionCompiled& event,
+                          v8::metrics::Recorder::ContextId id) override {
+    CHECK(event.success);
+    CHECK_LT(0, event.bytecode_size_in_bytes);
+    ++compiled_count_;
+  }
+
+  void AddThreadSafeEvent(
+      const v8::metrics::GarbageCollectionCycle& event) override {
+    ++gc_count_;
+    if (event.is_full) ++full_gc_count_;
+  }
+};
+
+}  // namespace
+
+TEST(TriggerCompileAndGCMetricsEvents) {
+  LocalContext env;
+  v8::Isolate* iso = env->GetIsolate();
+  v8::HandleScope scope(iso);
+  std::shared_ptr<CompileAndGCMetricsRecorder> recorder =
+      std::make_shared<CompileAndGCMetricsRecorder>();
+  iso->SetMetricsRecorder(recorder);
+
+  // Lazy compilation events are delayed until the next foreground task.
+  CompileRun("function f() { return 1; } f();");
+  CHECK_EQ(0, recorder->compiled_count_);
+  v8::base::OS::Sleep(v8::base::TimeDelta::FromMilliseconds(1100));
+  v8::platform::PumpMessageLoop(v8::internal::V8::GetCurrentPlatform(), iso);
+  CHECK_LE(i::FLAG_lazy ? 1 : 0, recorder->compiled_count_);
+
+  // Garbage collection events are reported right away.
+  CcTest::PreciseCollectAllGarbage();
+  CHECK_LE(1, recorder->gc_count_);
+  CHECK_LE(1, recorder->full_gc_count_);
+}
+
+TEST(TieringPolicy) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  v8::HandleScope scope(isolate);
+
+  v8::TieringPolicy policy;
+  policy.set_interrupt_budget(1234);
+  policy.set_budget_for_feedback_vector_allocation(56);
+  isolate->SetTieringPolicy(policy);
+  CHECK_EQ(1234, i_isolate->interrupt_budget());
+  CHECK_EQ(56, i_isolate->budget_for_feedback_vector_allocation());
+
+  // New closures start out with the budgets of the policy.
+  v8::Local<v8::Value> result = CompileRun("(function f() { return 1; })");
+  i::Handle<i::JSFunction> f =
+      i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*result));
+  CHECK_EQ(i::FLAG_lazy_feedback_allocation ? 56 : 1234,
+           f->raw_feedback_cell().interrupt_budget());
+
+  // Values that are not set fall back to the flags.
+  isolate->SetTieringPolicy(v8::TieringPolicy());
+  CHECK_EQ(i::FLAG_interrupt_budget, i_isolate->interrupt_budget());
+  CHECK_EQ(i::FLAG_budget_for_feedback_vector_allocation,
+           i_isolate->budget_for_feedback_vector_allocation());
+}
@@ -674,6 +674,74 @@ TEST(CollectCpuProfile) {
   profile->Delete();
 }
 
+TEST(SamplingOverheadIsRecorded) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env->GetIsolate(), 20)};
+
+  v8::CpuProfiler* profiler = v8::CpuProfiler::New(env->GetIsolate());
+  v8::Local<v8::String> profile_name = v8_str("my_profile");
+  profiler->SetSamplingInterval(100);
+  profiler->StartProfiling(profile_name);
+
+  i::ProfilerEventsProcessor* processor =
+      reinterpret_cast<i::CpuProfiler*>(profiler)->processor();
+  v8::sampler::Sampler* sampler =
+      static_cast<i::SamplingEventsProcessor*>(processor)->sampler();
+  sampler->StartCountingSamples();
+  do {
+    function->Call(env.local(), env->Global(), arraysize(args), args)
+        .ToLocalChecked();
+  } while (sampler->js_sample_count() < 10);
+
+  CHECK_GE(processor->samples_taken(),
+           static_cast<int>(sampler->js_sample_count()));
+  CHECK_LE(0, processor->sampling_time().InMicroseconds());
+
+  profiler->StopProfiling(profile_name)->Delete();
+  profiler->Dispose();
+}
+
+TEST(RestartProfiling) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+
+  CompileRun(cpu_profiler_test_source);
+  v8::Local<v8::Function> function = GetFunction(env.local(), "start");
+  v8::Local<v8::Value> args[] = {v8::Integer::New(env->GetIsolate(), 20)};
+
+  v8::CpuProfiler* profiler = v8::CpuProfiler::New(env->GetIsolate());
+  v8::Local<v8::String> profile_name = v8_str("my_profile");
+  profiler->SetSamplingInterval(100);
+  profiler->StartProfiling(profile_name, true);
+  CHECK_NULL(profiler->RestartProfiling(v8_str("other_profile")));
+
+  v8::CpuProfile* previous = nullptr;
+  for (int i = 0; i < 3; i++) {
+    function->Call(env.local(), env->Global(), arraysize(args), args)
+        .ToLocalChecked();
+    v8::CpuProfile* profile = profiler->RestartProfiling(profile_name);
+    CHECK(profile);
+    CHECK(profile_name->StrictEquals(profile->GetTitle()));
+    CHECK_LE(profile->GetStartTime(), profile->GetEndTime());
+    if (previous) {
+      CHECK_LE(previous->GetEndTime(), profile->GetStartTime());
+      previous->Delete();
+    }
+    previous = profile;
+  }
+  previous->Delete();
+
+  v8::CpuProfile* last = profiler->StopProfiling(profile_name);
+  CHECK(last);
+  last->Delete();
+  CHECK_EQ(0, reinterpret_cast<i::CpuProfiler*>(profiler)->GetProfilesCount());
+  profiler->Dispose();
+}
+
 TEST(CollectCpuProfileCallerLineNumbers) {
   i::FLAG_allow_natives_syntax = true;
   LocalContext env;
@@ -53,10 +53,14 @@ class DateCacheMock: public DateCache {
     return rule == nullptr ? 0 : rule->offset_sec * 1000;
   }
 
-  int GetLocalOffsetFromOS(int64_t time_sec, bool is_utc) override {
-    return local_offset_ + GetDaylightSavingsOffsetFromOS(time_sec);
+  int GetLocalOffsetFromOS(int64_t time_ms, bool is_utc) override {
+    os_calls_++;
+    return local_offset_ + GetDaylightSavingsOffsetFromOS(time_ms / 1000);
   }
 
+ public:
+  int os_calls() const { return os_calls_; }
+
  private:
   Rule* FindRuleFor(int year, int month, int day, int time_in_day_sec) {
     Rule* result = nullptr;
@@ -97,6 +101,7 @@ class DateCacheMock: public DateCache {
   int local_offset_;
   Rule* rules_;
   int rules_count_;
+  int os_calls_ = 0;
 };
 
 static int64_t TimeFromYearMonthDay(DateCache* date_cache,
@@ -167,6 +172,42 @@ TEST(DaylightSavingsTime) {
   CheckDST(august_20);
 }
 
+#ifdef V8_INTL_SUPPORT
+TEST(LocalOffsetCache) {
+  // With ICU timezone data, the segment cache holds whole local offsets.
+  FLAG_icu_timezone_data = true;
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  DateCacheMock::Rule rules[] = {
+      {0, 2, 0, 10, 0, 3600},  // DST from March to November in any year.
+  };
+
+  int local_offset_ms = -36000000;  // -10 hours.
+
+  DateCacheMock* date_cache =
+      new DateCacheMock(local_offset_ms, rules, arraysize(rules));
+
+  reinterpret_cast<Isolate*>(isolate)->set_date_cache(date_cache);
+
+  int64_t start_of_2010 = TimeFromYearMonthDay(date_cache, 2010, 0, 1);
+  int64_t start_of_2011 = TimeFromYearMonthDay(date_cache, 2011, 0, 1);
+  const int64_t kMsPerHour = 3600 * 1000;
+  // Converting each hour of a year only queries the OS around the two
+  // transitions and once per segment extension.
+  for (int64_t time = start_of_2010; time < start_of_2011;
+       time += kMsPerHour) {
+    date_cache->ToLocal(time);
+  }
+  CHECK_LT(date_cache->os_calls(), 100);
+  for (int64_t time = start_of_2010; time < start_of_2011;
+       time += kMsPerHour) {
+    CheckDST(time);
+    CheckDST(time - 1000);
+  }
+}
+#endif  // V8_INTL_SUPPORT
+
 namespace {
 int legacy_parse_count = 0;
 void DateParseLegacyCounterCallback(v8::Isolate* isolate,
@@ -4388,6 +4388,47 @@ TEST(DebugCoverageWithScriptDataOutOfScope) {
   CHECK_EQ(26, function_data.EndOffset());
 }
 
+TEST(DebugCoverageBlockBestEffort) {
+  i::FLAG_always_opt = false;
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  i::Isolate* i_isolate = CcTest::i_isolate();
+  v8::HandleScope scope(isolate);
+  v8::debug::Coverage::SelectMode(isolate,
+                                  v8::debug::CoverageMode::kBlockBestEffort);
+  CHECK(!i_isolate->factory()
+              ->feedback_vectors_for_profiling_tools()
+              ->IsArrayList());
+  CompileRun(
+      "function f(x) {\n"
+      "  if (x) return 1;\n"
+      "  return 2;\n"
+      "}\n"
+      "%PrepareFunctionForOptimization(f);\n"
+      "f(true); f(true);\n"
+      "%OptimizeFunctionOnNextCall(f);\n"
+      "f(true); f(false);");
+
+  // Selecting the mode again must not deoptimize f.
+  v8::debug::Coverage::SelectMode(isolate,
+                                  v8::debug::CoverageMode::kBlockBestEffort);
+  i::Handle<i::JSFunction> f = i::Handle<i::JSFunction>::cast(
+      v8::Utils::OpenHandle(*env->Global()->Get(env.local(), v8_str("f"))
+                                 .ToLocalChecked()));
+  if (i_isolate->use_optimizer()) CHECK(f->HasAttachedOptimizedCode());
+
+  v8::debug::Coverage coverage = v8::debug::Coverage::CollectPrecise(isolate);
+  CHECK_EQ(1u, coverage.ScriptCount());
+  v8::debug::Coverage::ScriptData script_data = coverage.GetScriptData(0);
+  CHECK_EQ(2u, script_data.FunctionCount());
+  // Invocations from optimized code are counted too.
+  v8::debug::Coverage::FunctionData function_data =
+      script_data.GetFunctionData(1);
+  CHECK_EQ(4, function_data.Count());
+  CHECK_LT(0u, function_data.BlockCount());
+}
+
 TEST(BuiltinsExceptionPrediction) {
   v8::Isolate* isolate = CcTest::isolate();
   i::Isolate* iisolate = CcTest::i_isolate();
@@ -4434,6 +4475,42 @@ TEST(DebugGetPossibleBreakpointsReturnLocations) {
   CHECK_EQ(returns_count, 4);
 }
 
+TEST(DebugGetPossibleBreakpointsKeepsOptimizedCode) {
+  i::FLAG_allow_natives_syntax = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  EnableDebugger(isolate);
+  v8::Local<v8::Function> foo = CompileFunction(
+      &env,
+      "function foo(x) { return x + 1; }\n"
+      "%PrepareFunctionForOptimization(foo);\n"
+      "foo(1); foo(2);\n"
+      "%OptimizeFunctionOnNextCall(foo);\n"
+      "foo(3);",
+      "foo");
+  i::Handle<i::JSFunction> function =
+      i::Handle<i::JSFunction>::cast(v8::Utils::OpenHandle(*foo));
+  if (function->HasAttachedOptimizedCode()) {
+    // Listing break locations must not deoptimize the function.
+    v8::PersistentValueVector<v8::debug::Script> scripts(isolate);
+    v8::debug::GetLoadedScripts(isolate, scripts);
+    CHECK_EQ(scripts.Size(), 1);
+    std::vector<v8::debug::BreakLocation> locations;
+    CHECK(scripts.Get(0)->GetPossibleBreakpoints(
+        v8::debug::Location(0, 0), v8::debug::Location(), false, &locations));
+    CHECK(!locations.empty());
+    CHECK(HasBreakInfo(foo));
+    CHECK(function->HasAttachedOptimizedCode());
+
+    // Setting a break point in it does.
+    i::Handle<i::BreakPoint> bp = SetBreakPoint(foo, 0);
+    CHECK(!function->HasAttachedOptimizedCode());
+    ClearBreakPoint(bp);
+  }
+  DisableDebugger(isolate);
+}
+
 TEST(DebugEvaluateNoSideEffect) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
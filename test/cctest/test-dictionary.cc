@@ -34,6 +34,7 @@
 #include "src/handles/global-handles.h"
 #include "src/heap/factory.h"
 #include "src/heap/spaces.h"
+#include "src/objects/dictionary-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/roots/roots.h"
@@ -239,6 +240,49 @@ TEST(HashTableRehash) {
 }
 
 
+TEST(NameDictionaryDeleteWipesDeletedEntries) {
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(context->GetIsolate());
+
+  const int kCount = 40;
+  Handle<NameDictionary> dictionary = NameDictionary::New(isolate, kCount);
+  std::vector<Handle<String>> names;
+  for (int i = 0; i < kCount; i++) {
+    names.push_back(
+        factory->InternalizeString(factory->NewStringFromAsciiChecked(
+            ("name" + std::to_string(i)).c_str())));
+    dictionary =
+        NameDictionary::Add(isolate, dictionary, names.back(),
+                            handle(Smi::FromInt(i), isolate),
+                            PropertyDetails::Empty());
+  }
+
+  // Delete all but the last few names. Deleted entries never take up more
+  // than a quarter of the table.
+  const int kRemaining = 12;
+  for (int i = 0; i < kCount - kRemaining; i++) {
+    InternalIndex entry = dictionary->FindEntry(isolate, names[i]);
+    CHECK(entry.is_found());
+    dictionary = NameDictionary::DeleteEntry(isolate, dictionary, entry);
+    CHECK_LT(dictionary->NumberOfDeletedElements(),
+             dictionary->Capacity() / 4);
+  }
+
+  CHECK_EQ(kRemaining, dictionary->NumberOfElements());
+  for (int i = 0; i < kCount; i++) {
+    InternalIndex entry = dictionary->FindEntry(isolate, names[i]);
+    if (i < kCount - kRemaining) {
+      CHECK(entry.is_not_found());
+    } else {
+      CHECK(entry.is_found());
+      CHECK_EQ(i, Smi::ToInt(dictionary->ValueAt(entry)));
+    }
+  }
+}
+
+
 #ifdef DEBUG
 template<class HashSet>
 static void TestHashSetCausesGC(Handle<HashSet> table) {
@@ -2,11 +2,14 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "src/init/v8.h"
 #include "test/cctest/cctest.h"
 
 #include "src/api/api-inl.h"
 #include "src/codegen/macro-assembler.h"
+#include "src/debug/debug-interface.h"
 #include "src/debug/debug.h"
 #include "src/execution/execution.h"
 #include "src/handles/global-handles.h"
@@ -450,6 +453,41 @@ TEST(VectorSpeculationMode) {
   CHECK_EQ(3, nexus.GetCallCount());
 }
 
+TEST(FeedbackSlotStatesAPI) {
+  if (!i::FLAG_use_ic) return;
+  if (i::FLAG_always_opt) return;
+  FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+
+  CompileRun(
+      "%EnsureFeedbackVectorForFunction(f);"
+      "function f(a, b) { return a.foo + b.foo; }"
+      "f({ foo: 1 }, { foo: 2 });"
+      "f({ foo: 1 }, { bar: 1, foo: 2 });");
+  v8::Local<v8::Function> f = v8::Local<v8::Function>::Cast(
+      CcTest::global()->Get(context.local(), v8_str("f")).ToLocalChecked());
+
+  std::vector<v8::debug::FeedbackSlotState> states =
+      v8::debug::GetFeedbackSlotStates(f);
+  CHECK_EQ(2, states.size());
+  CHECK(v8::debug::InlineCacheState::kMonomorphic == states[0].state);
+  CHECK_EQ(1, states[0].map_count);
+  CHECK(v8::debug::InlineCacheState::kPolymorphic == states[1].state);
+  CHECK_EQ(2, states[1].map_count);
+
+  // f was called twice, so it is found with a threshold of two but not three.
+  auto contains_f = [&](const std::vector<v8::Local<v8::Function>>& fs) {
+    return std::find(fs.begin(), fs.end(), f) != fs.end();
+  };
+  CHECK(contains_f(
+      v8::debug::GetFunctionsWithFeedback(context->GetIsolate(), 2)));
+  CHECK(!contains_f(
+      v8::debug::GetFunctionsWithFeedback(context->GetIsolate(), 3)));
+}
+
 TEST(VectorLoadICStates) {
   if (!i::FLAG_use_ic) return;
   if (i::FLAG_always_opt) return;
@@ -321,6 +321,40 @@ TEST(HeapSnapshotLocations) {
   CHECK_EQ(0, o_loc->col);
 }
 
+static int CountObjectNodesNamed(v8::Isolate* isolate,
+                                 const v8::HeapSnapshot* snapshot,
+                                 const char* name) {
+  int count = 0;
+  for (int i = 0; i < snapshot->GetNodesCount(); i++) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(i);
+    if (node->GetType() != v8::HeapGraphNode::kObject) continue;
+    v8::String::Utf8Value node_name(isolate, node->GetName());
+    if (strcmp(name, *node_name) == 0) count++;
+  }
+  return count;
+}
+
+TEST(HeapSnapshotParallelObjectFiltering) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  CompileRun(
+      "function Node(next) { this.next = next; this.data = [next, {}]; }\n"
+      "var list = null;\n"
+      "for (var i = 0; i < 10000; i++) list = new Node(list);\n");
+  // Reachability is computed sequentially and with parallel tasks. Both
+  // snapshots have to contain all list nodes.
+  i::FLAG_parallel_heap_object_filtering = false;
+  const v8::HeapSnapshot* sequential = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(sequential));
+  i::FLAG_parallel_heap_object_filtering = true;
+  const v8::HeapSnapshot* parallel = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(parallel));
+  CHECK_EQ(10000, CountObjectNodesNamed(env->GetIsolate(), sequential, "Node"));
+  CHECK_EQ(10000, CountObjectNodesNamed(env->GetIsolate(), parallel, "Node"));
+}
+
 TEST(HeapSnapshotObjectSizes) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -1185,6 +1219,42 @@ TEST(HeapSnapshotJSONSerialization) {
 }
 
 
+TEST(HeapSnapshotToStream) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = new A('streamed');");
+  const int snapshots_count = heap_profiler->GetSnapshotCount();
+
+  TestJSONStream stream;
+  CHECK(heap_profiler->TakeHeapSnapshotToStream(&stream));
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(1, stream.eos_signaled());
+  // The snapshot is not retained by the profiler.
+  CHECK_EQ(snapshots_count, heap_profiler->GetSnapshotCount());
+
+  i::ScopedVector<char> json(stream.size());
+  stream.WriteTo(json);
+  OneByteResource* json_res = new OneByteResource(json);
+  v8::Local<v8::String> json_string =
+      v8::String::NewExternalOneByte(env->GetIsolate(), json_res)
+          .ToLocalChecked();
+  env->Global()
+      ->Set(env.local(), v8_str("json_snapshot"), json_string)
+      .FromJust();
+  v8::Local<v8::Value> result = CompileRun(
+      "var parsed = JSON.parse(json_snapshot);\n"
+      "var meta = parsed.snapshot.meta;\n"
+      "parsed.snapshot.node_count * meta.node_fields.length ==\n"
+      "    parsed.nodes.length &&\n"
+      "parsed.snapshot.edge_count * meta.edge_fields.length ==\n"
+      "    parsed.edges.length &&\n"
+      "parsed.strings.indexOf('streamed') >= 0;");
+  CHECK(result->IsTrue());
+}
+
 TEST(HeapSnapshotJSONSerializationAborting) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
@@ -0,0 +1,68 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string.h>
+
+#include "src/init/v8.h"
+
+#include "src/numbers/double.h"
+#include "src/numbers/ryu-dtoa.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/gay-shortest.h"
+
+namespace v8 {
+namespace internal {
+namespace test_ryu_dtoa {
+
+static const int kBufferSize = 100;
+
+static void CheckRyuDtoa(double v, const char* expected, int expected_point) {
+  char buffer_container[kBufferSize];
+  Vector<char> buffer(buffer_container, kBufferSize);
+  int length;
+  int point;
+  RyuDtoa(v, buffer, &length, &point);
+  CHECK_EQ(0, strcmp(expected, buffer.begin()));
+  CHECK_EQ(static_cast<int>(strlen(expected)), length);
+  CHECK_EQ(expected_point, point);
+}
+
+TEST(RyuDtoaVariousDoubles) {
+  CheckRyuDtoa(1.0, "1", 1);
+  CheckRyuDtoa(1.5, "15", 1);
+  CheckRyuDtoa(5e-324, "5", -323);
+  CheckRyuDtoa(1.7976931348623157e308, "17976931348623157", 309);
+  CheckRyuDtoa(4294967272.0, "4294967272", 10);
+  CheckRyuDtoa(4.1855804968213567e298, "4185580496821357", 299);
+  CheckRyuDtoa(5.5626846462680035e-309, "5562684646268003", -308);
+  CheckRyuDtoa(2147483648.0, "2147483648", 10);
+  CheckRyuDtoa(3.5844466002796428e+298, "35844466002796428", 299);
+  CheckRyuDtoa(1e23, "1", 24);
+
+  uint64_t smallest_normal64 = 0x0010'0000'0000'0000;
+  CheckRyuDtoa(Double(smallest_normal64).value(), "22250738585072014", -307);
+  uint64_t largest_denormal64 = 0x000F'FFFF'FFFF'FFFF;
+  CheckRyuDtoa(Double(largest_denormal64).value(), "2225073858507201", -307);
+
+  // Exactly halfway between two shortest candidates: round to even.
+  CheckRyuDtoa(1238149735313913.25, "12381497353139132", 16);
+  CheckRyuDtoa(89476238070273.625, "8947623807027362", 14);
+  // The closest 16 digit number doesn't read back as the input, but another
+  // one does.
+  CheckRyuDtoa(7.1202363472230444e-307, "7120236347223045", -306);
+}
+
+TEST(RyuDtoaGayShortest) {
+  Vector<const PrecomputedShortest> precomputed =
+      PrecomputedShortestRepresentations();
+  for (int i = 0; i < precomputed.length(); ++i) {
+    const PrecomputedShortest current_test = precomputed[i];
+    CheckRyuDtoa(current_test.v, current_test.representation,
+                 current_test.decimal_point);
+  }
+}
+
+}  // namespace test_ryu_dtoa
+}  // namespace internal
+}  // namespace v8
@@ -2477,6 +2477,177 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_always_opt = prev_always_opt_value;
 }
 
+TEST(CodeSerializerAfterExecuteWithAsmModule) {
+  const char* source =
+      "function Module(stdlib) {"
+      "  'use asm';"
+      "  function f() { return 42; }"
+      "  return { f: f };"
+      "}"
+      "Module(this).f()";
+  v8::ScriptCompiler::CachedData* cache =
+      CompileRunAndProduceCache(source, CodeCacheType::kAfterExecute);
+  CHECK_NOT_NULL(cache);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // The asm.js module was serialized uncompiled and is translated again.
+    v8::Local<v8::Value> result = script->BindToCurrentContext()
+                                      ->Run(isolate2->GetCurrentContext())
+                                      .ToLocalChecked();
+    CHECK_EQ(42, result->Int32Value(isolate2->GetCurrentContext()).FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerAfterExecuteWithParallelCompileTasks) {
+  // The function is compiled by the compiler dispatcher rather than by
+  // running it, and should still end up in the code cache.
+  FLAG_compiler_dispatcher = true;
+  FLAG_parallel_compile_tasks = true;
+  const char* source = "var f = (function f() { return 'abc'; }); f;";
+  // External strings can be cloned for the parallel compile tasks.
+  SerializerOneByteResource resource(source, strlen(source));
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str =
+        v8::String::NewExternalOneByte(isolate1, &resource).ToLocalChecked();
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    cache = ScriptCompiler::CreateCodeCacheAfterExecution(
+        script, ScriptCompiler::kIncludePendingCompiles);
+    CHECK(cache);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    DisallowCompilation no_compile_expected(
+        reinterpret_cast<Isolate*>(isolate2));
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    v8::Local<v8::Value> f =
+        context->Global()->Get(context, v8_str("f")).ToLocalChecked();
+    Handle<JSFunction> function =
+        Handle<JSFunction>::cast(v8::Utils::OpenHandle(*f));
+    CHECK(function->shared().is_compiled());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerOptimizeFromCodeCache) {
+  FLAG_allow_natives_syntax = true;
+  FLAG_turbo_nci = true;
+  FLAG_always_opt = false;
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::ScriptCompiler::CachedData* cache;
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_with_origin(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1,
+                                                 &source_with_origin)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CompileRun(
+        "%PrepareFunctionForOptimization(f);"
+        "f();"
+        "%OptimizeFunctionOnNextCall(f);"
+        "f();");
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("f")));
+    CHECK(f->shared().may_have_cached_code());
+
+    cache = ScriptCompiler::CreateCodeCache(script);
+    // Serialization leaves the producing isolate's SFI untouched.
+    CHECK(f->shared().may_have_cached_code());
+    CHECK(!f->shared().optimize_from_code_cache());
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_with_origin(v8_str(source), origin,
+                                                  cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source_with_origin,
+            v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    Handle<JSFunction> f = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*CompileRun("f")));
+    CHECK(!f->shared().may_have_cached_code());
+    CHECK(!f->shared().optimize_from_code_cache());
+    CHECK(f->has_feedback_vector());
+    CHECK(f->IsMarkedForOptimization() ||
+          f->IsMarkedForConcurrentOptimization() ||
+          f->IsInOptimizationQueue() || f->HasOptimizedCode() ||
+          f->IsOptimized());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
@@ -2533,6 +2704,101 @@ TEST(CodeSerializerBitFlip) {
   isolate2->Dispose();
 }
 
+TEST(CodeSerializerWithoutChecksumVerification) {
+  const char* source = "function f() { return 'abc'; }; f() + 'def'";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  // Corrupt the checksum but not the payload, and consume the cache in place
+  // from a buffer the isolate does not own.
+  std::unique_ptr<uint8_t[]> buffer(new uint8_t[cache->length]);
+  memcpy(buffer.get(), cache->data, cache->length);
+  buffer[SerializedCodeData::kChecksumOffset] ^= 0x40;
+  v8::ScriptCompiler::CachedData* mapped_cache =
+      new v8::ScriptCompiler::CachedData(
+          buffer.get(), cache->length,
+          v8::ScriptCompiler::CachedData::BufferNotOwned);
+  delete cache;
+
+  FLAG_verify_code_cache_checksum = false;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, mapped_cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!mapped_cache->rejected);
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
+TEST(CodeSerializerKeepsPreparseData) {
+  const char* source =
+      "function outer() {\n"
+      "  var x = 'abc';\n"
+      "  function inner() { return x; }\n"
+      "  return inner() + 'def';\n"
+      "}\n"
+      "outer()";
+  v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::Local<v8::String> source_str = v8_str(source);
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source(source_str, origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+
+    // The lazy outer function comes out of the cache with the data about its
+    // inner functions that was gathered when the script was first parsed, so
+    // compiling it does not have to preparse them again.
+    i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate2);
+    i::Handle<i::SharedFunctionInfo> toplevel = v8::Utils::OpenHandle(*script);
+    i::SharedFunctionInfo::ScriptIterator iter(
+        i_isolate, i::Script::cast(toplevel->script()));
+    int with_preparse_data = 0;
+    for (i::SharedFunctionInfo info = iter.Next(); !info.is_null();
+         info = iter.Next()) {
+      if (info.HasUncompiledDataWithPreparseData()) with_preparse_data++;
+    }
+    CHECK_EQ(1, with_preparse_data);
+
+    v8::Local<v8::Value> result =
+        script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    CHECK(result->ToString(context)
+              .ToLocalChecked()
+              ->Equals(context, v8_str("abcdef"))
+              .FromJust());
+  }
+  isolate2->Dispose();
+}
+
 TEST(CodeSerializerWithHarmonyScoping) {
   const char* source1 = "'use strict'; let x = 'X'";
   const char* source2 = "'use strict'; let y = 'Y'";
@@ -3883,6 +4149,62 @@ UNINITIALIZED_TEST(ReinitializeHashSeedRehashable) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(SnapshotHashSeedSkipsRehashing) {
+  DisableAlwaysOpt();
+  i::FLAG_rehash_snapshot = true;
+  i::FLAG_hash_seed = 42;
+  i::FLAG_allow_natives_syntax = true;
+  DisableEmbeddedBlobRefcounting();
+  v8::StartupData blob;
+  {
+    v8::SnapshotCreator creator;
+    v8::Isolate* isolate = creator.GetIsolate();
+    {
+      v8::HandleScope handle_scope(isolate);
+      v8::Local<v8::Context> context = v8::Context::New(isolate);
+      v8::Context::Scope context_scope(context);
+      CompileRun(
+          "var o = {};"
+          "%OptimizeObjectForAddingMultipleProperties(o, 3);"
+          "o.a = 1;"
+          "o.b = 2;"
+          "o.c = 3;"
+          "var str = ['some', 'thing'].join('');"
+          "new Set().add(str);");
+      i::Handle<i::String> i_str = i::Handle<i::String>::cast(
+          v8::Utils::OpenHandle(*CompileRun("str")));
+      CHECK(i_str->HasHashCode());
+      creator.SetDefaultContext(context);
+    }
+    blob =
+        creator.CreateBlob(v8::SnapshotCreator::FunctionCodeHandling::kClear);
+    CHECK(blob.CanBeRehashed());
+  }
+
+  // Deserializing with the seed the snapshot was created with leaves the
+  // hashes computed before serialization in place.
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  create_params.snapshot_blob = &blob;
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    CHECK_EQ(static_cast<uint64_t>(42),
+             HashSeed(reinterpret_cast<i::Isolate*>(isolate)));
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    CHECK(!context.IsEmpty());
+    v8::Context::Scope context_scope(context);
+    i::Handle<i::String> i_str = i::Handle<i::String>::cast(
+        v8::Utils::OpenHandle(*CompileRun("str")));
+    CHECK(i_str->HasHashCode());
+    ExpectInt32("o.c", 3);
+  }
+  isolate->Dispose();
+  delete[] blob.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 void CheckSFIsAreWeak(WeakFixedArray sfis, Isolate* isolate) {
   CHECK_GT(sfis.length(), 0);
   int no_of_weak = 0;
@@ -956,3 +956,27 @@ TEST(TerminateInApiMicrotask) {
   }
   CHECK(!isolate->IsExecutionTerminating());
 }
+
+TEST(TerminateAtExecutionDeadline) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  v8::Local<v8::Context> context = v8::Context::New(isolate);
+  v8::Context::Scope context_scope(context);
+  {
+    v8::TryCatch try_catch(isolate);
+    isolate->SetExecutionDeadline(50);
+    CHECK(CompileRun("while (true) {}").IsEmpty());
+    CHECK(try_catch.HasTerminated());
+    CHECK(try_catch.Message().IsEmpty());
+    CHECK(isolate->IsExecutionTerminating());
+  }
+  CHECK(!isolate->IsExecutionTerminating());
+
+  // A cancelled deadline does not terminate a later script.
+  isolate->SetExecutionDeadline(10);
+  isolate->CancelExecutionDeadline();
+  v8::base::OS::Sleep(v8::base::TimeDelta::FromMilliseconds(50));
+  v8::TryCatch try_catch(isolate);
+  CHECK(!CompileRun("1 + 1").IsEmpty());
+  CHECK(!try_catch.HasCaught());
+}
@@ -304,5 +304,48 @@ TEST(TransitionArray_SameFieldNamesDifferentAttributes) {
   DCHECK(transitions.IsSortedNoDuplicates());
 }
 
+TEST(TransitionArray_MemoryReducingGCTrimsSlack) {
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+
+  const int PROPS_COUNT = 5;
+  Handle<String> names[PROPS_COUNT];
+  Handle<Map> maps[PROPS_COUNT];
+  PropertyAttributes attributes = NONE;
+
+  Handle<Map> map0 = Map::Create(isolate, 0);
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    EmbeddedVector<char, 64> buffer;
+    SNPrintF(buffer, "prop%d", i);
+    names[i] = factory->InternalizeUtf8String(buffer.begin());
+    maps[i] = Map::CopyWithField(isolate, map0, names[i],
+                                 FieldType::Any(isolate), attributes,
+                                 PropertyConstness::kMutable,
+                                 Representation::Tagged(), OMIT_TRANSITION)
+                  .ToHandleChecked();
+    TransitionsAccessor(isolate, map0)
+        .Insert(names[i], maps[i], PROPERTY_TRANSITION);
+  }
+  {
+    TestTransitionsAccessor transitions(isolate, map0);
+    CHECK_EQ(PROPS_COUNT, transitions.NumberOfTransitions());
+    CHECK_LT(PROPS_COUNT, transitions.Capacity());
+  }
+
+  // All targets are alive, but the unused capacity is dropped anyway.
+  CcTest::CollectAllAvailableGarbage();
+
+  TestTransitionsAccessor transitions(isolate, map0);
+  CHECK(transitions.IsFullTransitionArrayEncoding());
+  CHECK_EQ(PROPS_COUNT, transitions.NumberOfTransitions());
+  CHECK_EQ(PROPS_COUNT, transitions.Capacity());
+  for (int i = 0; i < PROPS_COUNT; i++) {
+    CHECK_EQ(*maps[i],
+             transitions.SearchTransition(*names[i], kData, attributes));
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -746,6 +746,9 @@ TEST(BasicRTT) {
   CHECK(subref_result->IsMap());
   Handle<Map> submap = Handle<Map>::cast(subref_result);
   CHECK_EQ(*map, submap->wasm_type_info().parent());
+  CHECK_EQ(0, map->wasm_type_info().supertypes().length());
+  CHECK_EQ(1, submap->wasm_type_info().supertypes().length());
+  CHECK_EQ(*map, submap->wasm_type_info().supertypes().get(0));
   CHECK_EQ(reinterpret_cast<Address>(
                tester.instance()->module()->struct_type(subtype_index)),
            submap->wasm_type_info().foreign_address());
@@ -221,6 +221,31 @@ WASM_SIMD_LIFTOFF_TEST(FillStackSlotsWithZero_CheckStartOffset) {
   CHECK_EQ(1, r.Call());
 }
 
+// Post-MVP operations are implemented in Liftoff on x64 and arm64, so that
+// functions using them do not have to wait for TurboFan.
+WASM_SIMD_LIFTOFF_TEST(PostMvpOps) {
+  if (!CpuFeatures::SupportsWasmSimd128()) return;
+  FLAG_SCOPE(wasm_simd_post_mvp);
+  WasmRunner<int32_t> r(ExecutionTier::kLiftoff, kNoLowerSimd);
+  // dot(splat(3), splat(-5)) + trunc(ceil(pmin(splat(1.5), splat(7)))).
+  BUILD(r,
+        WASM_I32_ADD(
+            WASM_SIMD_I32x4_EXTRACT_LANE(
+                0, WASM_SIMD_BINOP(kExprI32x4DotI16x8S,
+                                   WASM_SIMD_I16x8_SPLAT(WASM_I32V(3)),
+                                   WASM_SIMD_I16x8_SPLAT(WASM_I32V(-5)))),
+            WASM_I32_SCONVERT_F32(WASM_SIMD_F32x4_EXTRACT_LANE(
+                0, WASM_SIMD_UNOP(
+                       kExprF32x4Ceil,
+                       WASM_SIMD_BINOP(kExprF32x4Pmin,
+                                       WASM_SIMD_F32x4_SPLAT(WASM_F32(1.5f)),
+                                       WASM_SIMD_F32x4_SPLAT(WASM_F32(7)))))));
+  CHECK_EQ(-28, r.Call());
+#if V8_TARGET_ARCH_X64 || V8_TARGET_ARCH_ARM64
+  CHECK(r.builder().GetFunctionCode(r.function_index())->is_liftoff());
+#endif
+}
+
 #undef WASM_SIMD_LIFTOFF_TEST
 
 }  // namespace test_run_wasm_simd_liftoff
@@ -255,6 +255,24 @@ TEST(DeserializeWireBytesAndSerializedDataInvalid) {
   test.CollectGarbage();
 }
 
+TEST(DeserializeDynamicTieringModule) {
+  // With dynamic tiering, modules get serialized before their functions are
+  // tiered up, i.e. with Liftoff code.
+  FLAG_SCOPE(wasm_dynamic_tiering);
+  WasmSerializationTest test;
+  {
+    HandleScope scope(CcTest::i_isolate());
+    Handle<WasmModuleObject> module_object;
+    CHECK(test.Deserialize().ToHandle(&module_object));
+    WasmCodeRefScope code_ref_scope;
+    WasmCode* code = module_object->native_module()->GetCode(0);
+    CHECK_NOT_NULL(code);
+    if (FLAG_liftoff) CHECK_EQ(ExecutionTier::kLiftoff, code->tier());
+    test.DeserializeAndRun();
+  }
+  test.CollectGarbage();
+}
+
 bool False(v8::Local<v8::Context> context, v8::Local<v8::String> source) {
   return false;
 }
@@ -0,0 +1,59 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+let {session, contextGroup, Protocol} =
+    InspectorTest.start('Checks paging in Runtime.getProperties');
+
+InspectorTest.runAsyncTestSuite([
+  async function testArrayPages() {
+    let objectId = await evaluateToObjectId('[1, 2, 3, 4, 5]');
+    for (let skipCount = 0; ; skipCount += 2) {
+      let result = await getProperties(objectId, {skipCount, pageSize: 2});
+      if (!result.hasMore) break;
+    }
+  },
+
+  async function testLargeArray() {
+    let objectId = await evaluateToObjectId(
+        'Array.from({length: 100000}, (_, i) => i)');
+    await getProperties(objectId, {pageSize: 3});
+    await getProperties(objectId, {skipCount: 99998, pageSize: 3});
+  },
+
+  async function testWithoutPageSize() {
+    let objectId = await evaluateToObjectId('({a: 1, b: 2})');
+    await getProperties(objectId, {skipCount: 1});
+  },
+
+  async function testInternalPropertiesOnFirstPageOnly() {
+    let objectId = await evaluateToObjectId('Object(5)');
+    await getProperties(objectId, {pageSize: 1});
+    await getProperties(objectId, {skipCount: 1, pageSize: 1});
+  },
+
+  async function testInvalidParameters() {
+    let objectId = await evaluateToObjectId('({a: 1})');
+    for (let flags of [{skipCount: -1}, {pageSize: 0},
+                       {pageSize: 1, accessorPropertiesOnly: true}]) {
+      let response = await Protocol.Runtime.getProperties(
+          Object.assign({objectId, ownProperties: true}, flags));
+      InspectorTest.log(response.error.message);
+    }
+  }
+]);
+
+async function evaluateToObjectId(expression) {
+  return (await Protocol.Runtime.evaluate({expression})).result.result.objectId;
+}
+
+async function getProperties(objectId, flags) {
+  let {result} = await Protocol.Runtime.getProperties(
+      Object.assign({objectId, ownProperties: true}, flags));
+  let names = result.result.map(property => property.name).join(', ');
+  let internal = (result.internalProperties || [])
+      .map(property => property.name).join(', ');
+  InspectorTest.log(`[${names}] internal: [${internal}] ` +
+                    `hasMore: ${result.hasMore}`);
+  return result;
+}
@@ -0,0 +1,31 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// toLocaleString and friends cache their ICU objects per locales string.
+// Make sure that alternating between more locales than the cache holds
+// always formats with the requested locale.
+const locales = ["en", "de", "fr", "ar", "hi", "ja", "ru", "zh", "th", "fa",
+                 "es", "it"];
+const date = new Date(2020, 0, 2, 3, 4, 5);
+const expected = locales.map(l => ({
+  number: new Intl.NumberFormat(l).format(1234567.891),
+  date: new Intl.DateTimeFormat(l).format(date),
+  compare: new Intl.Collator(l).compare("a", "ä"),
+}));
+for (let round = 0; round < 3; round++) {
+  for (let i = 0; i < locales.length; i++) {
+    assertEquals(expected[i].number, (1234567.891).toLocaleString(locales[i]));
+    assertEquals(expected[i].date, date.toLocaleDateString(locales[i]));
+    assertEquals(expected[i].compare, "a".localeCompare("ä", locales[i]));
+  }
+}
+
+// The empty string is not a valid locale, it must not hit the entries for
+// undefined locales. Invalid locales are never cached.
+assertEquals(new Intl.NumberFormat().format(1.5), (1.5).toLocaleString());
+assertThrows(() => (1.5).toLocaleString(""), RangeError);
+assertThrows(() => date.toLocaleString(""), RangeError);
+assertThrows(() => "a".localeCompare("b", ""), RangeError);
+assertThrows(() => (1.5).toLocaleString("x-invalid"), RangeError);
+assertThrows(() => (1.5).toLocaleString("x-invalid"), RangeError);
@@ -36,6 +36,11 @@ var MapObjectLargeBenchmark = new BenchmarkSuite('Map-Object-Set-Get-Large', [1e
                 MapSetupObjectBaseLarge, MapTearDown),
 ]);
 
+var MapStringLargeBenchmark = new BenchmarkSuite('Map-String-Get-Large', [1e7], [
+  new Benchmark('Get', false, false, 0, MapGetStringLarge,
+                MapSetupStringLarge, MapTearDown),
+]);
+
 var MapIterationBenchmark = new BenchmarkSuite('Map-Iteration', [1000], [
   new Benchmark('ForEach', false, false, 0, MapForEach, MapSetupSmi, MapTearDown),
 ]);
@@ -246,6 +251,32 @@ function MapSetGetObjectLarge() {
   }
 }
 
+var lookupKeys;
+
+function MapSetupStringLarge() {
+  SetupStringKeys(LargeN);
+  map = new Map;
+  for (var i = 0; i < LargeN; i++) {
+    map.set(keys[i], i);
+  }
+  // Equal strings that are different objects than the keys in the map, and
+  // strings that are not in the map.
+  lookupKeys = Array.from({ length : 2 * LargeN }, (v, i) => 's' + i);
+}
+
+function MapGetStringLarge() {
+  for (var i = 0; i < LargeN; i++) {
+    if (map.get(lookupKeys[i]) !== i) {
+      throw new Error();
+    }
+  }
+  for (var i = LargeN; i < 2 * LargeN; i++) {
+    if (map.get(lookupKeys[i]) !== undefined) {
+      throw new Error();
+    }
+  }
+}
+
 function MapDeleteObject() {
   // This is run more than once per setup so we will end up deleting items
   // more than once. Therefore, we do not the return value of delete.
@@ -0,0 +1,47 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The fastApi object is installed by d8 with --expose-fast-api. Running with
+// and without --turbo-fast-api-calls compares fast API calls to the slow
+// callbacks.
+
+const uint8s = new Uint8Array(64);
+const float64s = new Float64Array(64);
+for (let i = 0; i < uint8s.length; i++) {
+  uint8s[i] = i;
+  float64s[i] = i * 0.5;
+}
+const string = 'a short one-byte string';
+
+function CheckChecksum(before, expected) {
+  if (fastApi.checksum() - before !== expected) throw 'Error';
+}
+
+function Uint8ArraySum() {
+  const before = fastApi.checksum();
+  for (let i = 0; i < iterations; i++) {
+    fastApi.sumUint8Array(uint8s);
+  }
+  CheckChecksum(before, 2016 * iterations);
+}
+
+function Float64ArraySum() {
+  const before = fastApi.checksum();
+  for (let i = 0; i < iterations; i++) {
+    fastApi.sumFloat64Array(float64s);
+  }
+  CheckChecksum(before, 1008 * iterations);
+}
+
+function StringLength() {
+  const before = fastApi.checksum();
+  for (let i = 0; i < iterations; i++) {
+    fastApi.stringLength(string);
+  }
+  CheckChecksum(before, string.length * iterations);
+}
+
+createSuite('Uint8ArraySum', 1000, Uint8ArraySum);
+createSuite('Float64ArraySum', 1000, Float64ArraySum);
+createSuite('StringLength', 1000, StringLength);
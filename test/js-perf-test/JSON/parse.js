@@ -0,0 +1,68 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function MakeRecords(text) {
+  const records = [];
+  for (let i = 0; i < 200; i++) {
+    records.push({
+      id: i,
+      name: text + i,
+      description: text.repeat(8) + '\n' + text.repeat(4),
+      price: i * 1.25 + 0.01,
+      ratio: 1 / (i + 3),
+      tags: ['alpha', 'beta', text],
+    });
+  }
+  return records;
+}
+
+const kOneByteJson = JSON.stringify(MakeRecords('lorem ipsum dolor '));
+const kTwoByteJson = JSON.stringify(MakeRecords('λόρεμ ίψουμ '));
+const kNumbersJson = JSON.stringify(
+    Array.from({length: 2000}, (_, i) => [i * 7.5, -i / 8, i * 1e6 + 0.5]));
+const kLongStringsJson = JSON.stringify(
+    Array.from({length: 20}, (_, i) => 'x'.repeat(1000 + i)));
+
+function ParseOneByte() {
+  return JSON.parse(kOneByteJson);
+}
+createSuite('ParseOneByte', 1000, ParseOneByte, () => {});
+
+function ParseTwoByte() {
+  return JSON.parse(kTwoByteJson);
+}
+createSuite('ParseTwoByte', 1000, ParseTwoByte, () => {});
+
+function ParseNumbers() {
+  return JSON.parse(kNumbersJson);
+}
+createSuite('ParseNumbers', 1000, ParseNumbers, () => {});
+
+function ParseLongStrings() {
+  return JSON.parse(kLongStringsJson);
+}
+createSuite('ParseLongStrings', 1000, ParseLongStrings, () => {});
+
+// Arrays of records of growing length, with and without optional properties.
+function MakeRecordsJson(count, optional) {
+  return JSON.stringify(Array.from({length: count}, (_, i) => {
+    const record = {id: i, name: 'item' + i, price: i + 0.5, active: i % 2};
+    if (optional && i % 3 == 0) record.note = 'note' + i;
+    return record;
+  }));
+}
+
+const kRecords10Json = MakeRecordsJson(10, false);
+const kRecords1000Json = MakeRecordsJson(1000, false);
+const kRecords100000Json = MakeRecordsJson(100000, false);
+const kOptionalRecordsJson = MakeRecordsJson(1000, true);
+
+createSuite('ParseRecords10', 1000, () => JSON.parse(kRecords10Json),
+            () => {});
+createSuite('ParseRecords1000', 1000, () => JSON.parse(kRecords1000Json),
+            () => {});
+createSuite('ParseRecords100000', 1000,
+            () => JSON.parse(kRecords100000Json), () => {});
+createSuite('ParseOptionalRecords', 1000,
+            () => JSON.parse(kOptionalRecordsJson), () => {});
@@ -0,0 +1,17 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+const kLongStrings =
+    Array.from({length: 20}, (_, i) => 'lorem ipsum '.repeat(100 + i));
+const kEscapedStrings =
+    Array.from({length: 20}, (_, i) => 'lorem "ipsum"\n'.repeat(100 + i));
+const kTwoByteStrings =
+    Array.from({length: 20}, (_, i) => 'λόρεμ ίψουμ '.repeat(100 + i));
+
+createSuite('StringifyLongStrings', 1000,
+            () => JSON.stringify(kLongStrings), () => {});
+createSuite('StringifyEscapedStrings', 1000,
+            () => JSON.stringify(kEscapedStrings), () => {});
+createSuite('StringifyTwoByteStrings', 1000,
+            () => JSON.stringify(kTwoByteStrings), () => {});
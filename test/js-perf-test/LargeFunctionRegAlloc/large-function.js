@@ -0,0 +1,75 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file
+
+// Flags: --allow-natives-syntax
+
+// Compares the cost of optimizing a very large generated function (Compile)
+// with the speed of the resulting code (Execute). Run once with the default
+// register allocator and once with --turbo-mid-tier-reg-alloc-threshold to
+// weigh compile time against code quality.
+
+new BenchmarkSuite('Compile', [1000], [
+  new Benchmark('Compile', false, false, 0, Compile)
+]);
+
+new BenchmarkSuite('Execute', [1000], [
+  new Benchmark('Execute', false, false, 0, Execute, Execute_Setup)
+]);
+
+// ----------------------------------------------------------------------------
+
+const kStatements = 2000;
+const kLiveValues = 32;
+
+// Generates a function resembling templating-engine output: a long chain of
+// arithmetic on many simultaneously live values, which stresses the register
+// allocator.
+function GenerateSource(seed) {
+  let source = '';
+  for (let i = 0; i < kLiveValues; i++) {
+    source += `let v${i} = x + ${i + seed};\n`;
+  }
+  for (let i = 0; i < kStatements; i++) {
+    const a = i % kLiveValues;
+    const b = (i * 7 + 3) % kLiveValues;
+    const c = (i * 13 + 5) % kLiveValues;
+    source += `v${a} = (v${b} + v${c} * ${i % 5 + 1}) | 0;\n`;
+  }
+  source += 'return ' +
+      Array.from({length: kLiveValues}, (_, i) => `v${i}`).join(' ^ ') + ';';
+  return source;
+}
+
+let seed = 0;
+
+function OptimizeFresh() {
+  // A fresh source per iteration so that nothing is cached.
+  const f = new Function('x', GenerateSource(seed++));
+  %PrepareFunctionForOptimization(f);
+  f(1);
+  f(2);
+  %OptimizeFunctionOnNextCall(f);
+  f(3);
+  return f;
+}
+
+%NeverOptimizeFunction(Compile);
+function Compile() {
+  OptimizeFresh();
+}
+
+let optimized;
+%NeverOptimizeFunction(Execute_Setup);
+function Execute_Setup() {
+  optimized = OptimizeFresh();
+}
+
+%NeverOptimizeFunction(Execute);
+function Execute() {
+  let result = 0;
+  for (let i = 0; i < 100; i++) {
+    result ^= optimized(i);
+  }
+  return result;
+}
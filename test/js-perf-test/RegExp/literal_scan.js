@@ -0,0 +1,22 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// A log-like subject where the pattern's literal is rare.
+const log = ("INFO 2020-10-01 12:00:00 request handled in 3ms\n".repeat(1000) +
+             "FATAL 2020-10-01 12:00:01 out of memory\n").repeat(4);
+
+const fatal_re = /FATAL (\S+)/g;
+function LiteralScanGlobal() {
+  log.match(fatal_re);
+}
+
+const oom_re = /out of memory/;
+function LiteralScanTest() {
+  oom_re.test(log);
+}
+
+var benchmarks = [ [LiteralScanGlobal, () => {}],
+                   [LiteralScanTest, () => {}],
+                 ];
+createBenchmarkSuite("LiteralScan");
@@ -0,0 +1,22 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('StringAppendAndReadLast', [5], [
+  new Benchmark('StringAppendAndReadLast', true, false, 0,
+  StringAppendAndReadLast),
+]);
+
+const appendPieces = Array.from({length: 500}, (_, i) => '<li>' + i + '</li>');
+
+function StringAppendAndReadLast() {
+  var s = '';
+  var newlines = 0;
+
+  for (var i = 0; i < appendPieces.length; ++i) {
+    s += appendPieces[i];
+    if (s[s.length - 1] === '\n') newlines++;
+  }
+
+  return s.length + newlines;
+}
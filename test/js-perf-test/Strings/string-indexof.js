@@ -34,3 +34,44 @@ function StringIndexOfNonConstant() {
 
   return sum;
 }
+
+new BenchmarkSuite('StringIndexOfTwoByte', [5], [
+  new Benchmark('StringIndexOfTwoByte', true, false, 0,
+  StringIndexOfTwoByte),
+]);
+
+new BenchmarkSuite('StringCompareTwoByte', [5], [
+  new Benchmark('StringCompareTwoByte', true, false, 0,
+  StringCompareTwoByte),
+]);
+
+const twoByteSubject = '一丁七万丈三上下不与'.repeat(100) + '丐';
+const twoByteSearches = ['丐', '丐一', '三上下不与丐'];
+const twoByteStrings = [
+  twoByteSubject,
+  twoByteSubject.substring(0, 999) + '丏' + twoByteSubject.substring(1000),
+  twoByteSubject.split('').join(''),
+];
+
+function StringIndexOfTwoByte() {
+  var sum = 0;
+
+  for (var j = 0; j < twoByteSearches.length; ++j) {
+    sum += twoByteSubject.indexOf(twoByteSearches[j]);
+  }
+
+  return sum;
+}
+
+function StringCompareTwoByte() {
+  var sum = 0;
+
+  for (var i = 0; i < twoByteStrings.length; ++i) {
+    for (var j = 0; j < twoByteStrings.length; ++j) {
+      if (twoByteStrings[i] === twoByteStrings[j]) sum++;
+      if (twoByteStrings[i] < twoByteStrings[j]) sum++;
+    }
+  }
+
+  return sum;
+}
@@ -0,0 +1,42 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+const kLength = 4096;
+const float64s = new Float64Array(kLength);
+const int32s = new Int32Array(kLength);
+for (let i = 0; i < kLength; i++) {
+  float64s[i] = i * 0.5;
+  int32s[i] = i & 0xff;
+}
+
+function SumFloat64Array(array) {
+  let sum = 0;
+  for (let i = 0; i < array.length; i++) {
+    sum += array[i];
+  }
+  return sum;
+}
+
+function DotInt32Array(a, b) {
+  let dot = 0;
+  for (let i = 0; i < a.length; i++) {
+    dot = (dot + a[i] * b[i]) | 0;
+  }
+  return dot;
+}
+
+function TypedArraySum() {
+  for (let i = 0; i < iterations; i++) {
+    if (SumFloat64Array(float64s) !== 4193280) throw 'Error';
+  }
+}
+
+function TypedArrayDot() {
+  for (let i = 0; i < iterations; i++) {
+    if (DotInt32Array(int32s, int32s) !== 88954880) throw 'Error';
+  }
+}
+
+createSuite('TypedArraySum', 1000, TypedArraySum);
+createSuite('TypedArrayDot', 1000, TypedArrayDot);
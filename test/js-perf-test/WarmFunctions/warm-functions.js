@@ -0,0 +1,64 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Many functions that are each called often enough to be warm, but not often
+// enough to be optimized by TurboFan. Running with and without
+// --turbo-nci-as-midtier compares the mid tier to Ignition.
+
+const kFunctionCount = 200;
+const kCallsPerFunction = 50;
+
+function MakeFunctions(salt) {
+  const functions = [];
+  for (let i = 0; i < kFunctionCount; i++) {
+    // Fresh sources give every function its own SharedFunctionInfo.
+    functions.push(new Function('a', `
+      let result = ${salt + i};
+      for (let i = 0; i < a.length; i++) {
+        const o = a[i];
+        if (o.x > o.y) {
+          result += o.x - o.y;
+        } else {
+          result += (o.y * ${i % 7 + 1}) & 0xff;
+        }
+      }
+      return result;`));
+  }
+  return functions;
+}
+
+const input = [];
+for (let i = 0; i < 20; i++) input.push({x: i % 5, y: i % 3});
+
+function CallAll(functions) {
+  let result = 0;
+  for (const f of functions) {
+    for (let i = 0; i < kCallsPerFunction; i++) result += f(input);
+  }
+  return result;
+}
+
+// Startup: the functions are new on every run and warm up from scratch.
+let startup_salt = 0;
+function Startup() {
+  CallAll(MakeFunctions(startup_salt++));
+}
+
+// Steady state: the same functions are called on every run.
+let steady_state_functions;
+function SteadyStateSetup() {
+  steady_state_functions = MakeFunctions(0);
+}
+
+function SteadyState() {
+  CallAll(steady_state_functions);
+}
+
+new BenchmarkSuite('Startup', [1000], [
+  new Benchmark('Startup', false, false, 0, Startup)
+]);
+new BenchmarkSuite('SteadyState', [1000], [
+  new Benchmark('SteadyState', false, false, 0, SteadyState,
+                SteadyStateSetup)
+]);
@@ -0,0 +1,28 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Measures how much heap the feedback vectors of many functions keep alive
+// once those functions stop running.
+
+const kFunctionCount = 2000;
+
+let source = '';
+for (let i = 0; i < kFunctionCount; i++) {
+  source += `function f${i}(o) { return o.a + o.b * ${i} + [o.c].length; }\n`;
+  source += `f${i}({a: 1, b: 2, c: 3}); f${i}({a: 1, b: 2, c: 3});\n`;
+}
+(0, eval)(source);
+
+function HeapUsage() {
+  %CollectGarbage(0);
+  return %GetHeapUsage();
+}
+
+const before = HeapUsage();
+// Let the functions age without running them again.
+for (let i = 0; i < 8; i++) %CollectGarbage(0);
+const after = HeapUsage();
+
+print(`${before} bytes in use with warm feedback`);
+print(`${after} bytes in use after aging`);
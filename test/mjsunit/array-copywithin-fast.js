@@ -0,0 +1,66 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Copying within fast arrays of every elements kind, in both directions.
+(function TestElementsKinds() {
+  const arrays = [
+    [1, 2, 3, 4, 5, 6],
+    [1.5, 2.5, 3.5, 4.5, 5.5, 6.5],
+    [{}, 'a', {}, 'b', {}, 'c'],
+  ];
+  for (const source of arrays) {
+    let a = source.slice();
+    a.copyWithin(0, 2);
+    assertEquals(source.slice(2).concat(source.slice(4)), a);
+
+    a = source.slice();
+    a.copyWithin(2, 0);
+    assertEquals(source.slice(0, 2).concat(source.slice(0, 4)), a);
+
+    a = source.slice();
+    a.copyWithin(-1, 0, 1);
+    assertEquals(source.slice(0, 5).concat(source.slice(0, 1)), a);
+  }
+})();
+
+// Holes are moved along, and copied literals (copy-on-write) are unaffected.
+(function TestHoles() {
+  function literal() { return [1, , 3, , 5.5]; }
+  const a = literal();
+  assertTrue(%HasHoleyElements(a));
+  a.copyWithin(0, 1);
+  assertEquals([, 3, , 5.5, 5.5], a);
+  assertFalse(0 in a);
+  assertFalse(2 in a);
+  assertEquals([1, , 3, , 5.5], literal());
+
+  const b = ['x', , 'y', , 'z'];
+  b.copyWithin(1, 0);
+  assertEquals(['x', 'x', , 'y', , ], b);
+  assertFalse(2 in b);
+})();
+
+// Holes read through to elements on the prototype chain.
+(function TestPrototypeElements() {
+  const proto = [];
+  proto[1] = 'proto';
+  const a = [0, , 2];
+  Object.setPrototypeOf(a, proto);
+  a.copyWithin(0, 1);
+  assertEquals('proto', a[0]);
+  assertTrue(a.hasOwnProperty(0));
+})();
+
+// Argument conversion may shrink the array after its length was read.
+(function TestShrinkingArray() {
+  const a = [1, 2, 3, 4, 5, 6, 7, 8];
+  a.copyWithin(1, { valueOf() { a.length = 3; return 4; } });
+  // Elements 4 to 7 are gone, so elements 1 and 2 are deleted.
+  assertEquals(3, a.length);
+  assertEquals(1, a[0]);
+  assertFalse(1 in a);
+  assertFalse(2 in a);
+})();
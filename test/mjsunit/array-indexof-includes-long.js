@@ -0,0 +1,63 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Long arrays are searched in C++; check every position and start index
+// around the block boundaries.
+
+function check(array, value, expected) {
+  for (let from = 0; from < array.length; from++) {
+    const index = expected >= from ? expected : -1;
+    assertEquals(index, array.indexOf(value, from));
+    assertEquals(index != -1, array.includes(value, from));
+  }
+}
+
+const kLength = 70;
+
+(function testSmis() {
+  const array = [];
+  for (let i = 0; i < kLength; i++) array.push(i);
+  for (let i = 0; i < kLength; i++) check(array, i, i);
+  check(array, kLength, -1);
+  check(array, 0.5, -1);
+  check(array, "1", -1);
+  const holey = array.slice();
+  delete holey[3];
+  check(holey, 3, -1);
+  check(holey, 4, 4);
+})();
+
+(function testDoubles() {
+  const array = [];
+  for (let i = 0; i < kLength; i++) array.push(i + 0.5);
+  for (let i = 0; i < kLength; i += 7) check(array, i + 0.5, i);
+  check(array, 1, -1);
+  array[40] = 0;
+  check(array, -0, 40);
+  check(array, 0, 40);
+  array[50] = NaN;
+  assertEquals(-1, array.indexOf(NaN));
+  assertTrue(array.includes(NaN));
+  const holey = array.slice();
+  delete holey[10];
+  check(holey, 10.5, -1);
+  check(holey, 60.5, 60);
+  assertTrue(holey.includes(undefined));
+})();
+
+(function testObjects() {
+  const array = [];
+  for (let i = 0; i < kLength; i++) array.push({i});
+  for (let i = 0; i < kLength; i += 5) check(array, array[i], i);
+  check(array, {}, -1);
+  check(array, undefined, -1);
+  array[65] = undefined;
+  check(array, undefined, 65);
+  const holey = array.slice();
+  delete holey[20];
+  assertEquals(65, holey.indexOf(undefined, 10));
+  assertTrue(holey.includes(undefined, 10));
+  assertTrue(holey.slice(0, 64).includes(undefined));
+  assertEquals(-1, holey.slice(0, 64).indexOf(undefined));
+})();
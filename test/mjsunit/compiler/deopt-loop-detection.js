@@ -0,0 +1,53 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+// Flags: --deopt-loop-threshold=3
+
+function OptimizeAndDeopt(f, deopt_arg) {
+  %ClearFunctionFeedback(f);
+  %PrepareFunctionForOptimization(f);
+  f(1, true);
+  f(2, false);
+  f(3, true);
+  f(4, false);
+  %OptimizeFunctionOnNextCall(f);
+  f(5, true);
+  f(6, false);
+  assertOptimized(f);
+  f("a", deopt_arg);
+  assertUnoptimized(f);
+}
+
+(function DeoptsAtDifferentPositions() {
+  function f(x, add) {
+    if (add) return x + 1;
+    return x - 1;
+  }
+
+  for (let i = 0; i < 4; i++) {
+    OptimizeAndDeopt(f, i % 2 == 0);
+  }
+  %PrepareFunctionForOptimization(f);
+  %OptimizeFunctionOnNextCall(f);
+  f(7, true);
+  assertOptimized(f);
+})();
+
+(function DeoptsAtTheSamePosition() {
+  function f(x, add) {
+    if (add) return x + 1;
+    return x - 1;
+  }
+
+  for (let i = 0; i < 3; i++) {
+    OptimizeAndDeopt(f, true);
+  }
+  // The third deoptimization for the same reason at the same position in a
+  // row disables optimization of {f}.
+  %PrepareFunctionForOptimization(f);
+  %OptimizeFunctionOnNextCall(f);
+  f(7, true);
+  assertUnoptimized(f);
+})();
@@ -0,0 +1,63 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-escape
+
+// Test variable index access to small literal arrays that do not escape.
+(function testLiteralArrayVariableIndex() {
+  function f(x, y, z, i) {
+    const a = [x, y, z, x + y];
+    return a[i];
+  }
+
+  %PrepareFunctionForOptimization(f);
+  for (let i = 0; i < 4; ++i) f(1, 2, 3, i);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(1, f(1, 2, 3, 0));
+  assertEquals(2, f(1, 2, 3, 1));
+  assertEquals(3, f(1, 2, 3, 2));
+  assertEquals(3, f(1, 2, 3, 3));
+})();
+
+// Test tuple-returning helpers that are inlined into their caller.
+(function testInlinedTupleVariableIndex() {
+  function minMax(a, b, c) {
+    return [Math.min(a, b, c), Math.max(a, b, c), a + b + c];
+  }
+
+  function f(a, b, c) {
+    const t = minMax(a, b, c);
+    let s = 0;
+    for (let i = 0; i < t.length; ++i) s += t[i];
+    return s;
+  }
+
+  %PrepareFunctionForOptimization(minMax);
+  %PrepareFunctionForOptimization(f);
+  assertEquals(10, f(1, 2, 3));
+  assertEquals(10, f(3, 2, 1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(10, f(1, 2, 3));
+  assertEquals(10, f(3, 2, 1));
+})();
+
+// Test that a scalar replaced array is materialized on deoptimization.
+(function testMaterializationOnDeopt() {
+  function f(x, y, z, i, deopt) {
+    const a = [x, y, z];
+    const v = a[i];
+    if (deopt) {
+      %DeoptimizeNow();
+      return a.join();
+    }
+    return v;
+  }
+
+  %PrepareFunctionForOptimization(f);
+  f(1, 2, 3, 0, false);
+  f(1, 2, 3, 2, false);
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(2, f(1, 2, 3, 1, false));
+  assertEquals("1,2,3", f(1, 2, 3, 1, true));
+})();
@@ -30,3 +30,24 @@
   assertEquals(4, f(1, 2));
   assertEquals(5, f(2, 1));
 })();
+
+// Test variable index access to rest parameters
+// with more than 2 elements.
+(function testRestParametersVariableIndexMoreElements() {
+  function g(...args) {
+    let s = 0;
+    for (let i = 0; i < args.length; ++i) s = s * 10 + args[i];
+    return s;
+  }
+
+  function f(w, x, y, z) {
+    return g(w, x, y) + g(w, x, y, z);
+  }
+
+  %PrepareFunctionForOptimization(f);
+  assertEquals(123 + 1234, f(1, 2, 3, 4));
+  assertEquals(432 + 4321, f(4, 3, 2, 1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(123 + 1234, f(1, 2, 3, 4));
+  assertEquals(432 + 4321, f(4, 3, 2, 1));
+})();
@@ -0,0 +1,46 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-loop-unrolling
+
+(function TestCounterExitValue() {
+  function f(n) {
+    let i = 0;
+    while (i < n) i++;
+    return i;
+  }
+  %PrepareFunctionForOptimization(f);
+  for (let n = 0; n < 5; n++) assertEquals(n, f(n));
+  %OptimizeFunctionOnNextCall(f);
+  for (let n = 0; n < 9; n++) assertEquals(n, f(n));
+})();
+
+(function TestTypedArrayReduction() {
+  function sum(a) {
+    let s = 0;
+    for (let i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+  const arrays = [0, 1, 2, 3, 4, 5, 7, 100].map(
+      n => Float64Array.from({length: n}, (_, i) => i));
+  %PrepareFunctionForOptimization(sum);
+  for (const a of arrays) sum(a);
+  %OptimizeFunctionOnNextCall(sum);
+  for (const a of arrays) assertEquals(a.length * (a.length - 1) / 2, sum(a));
+})();
+
+(function TestEarlyExit() {
+  function find(a, x) {
+    for (let i = 0; i < a.length; i++) {
+      if (a[i] === x) return i;
+    }
+    return -1;
+  }
+  const a = [10, 11, 12, 13, 14];
+  %PrepareFunctionForOptimization(find);
+  for (let i = 0; i < 5; i++) find(a, 10 + i);
+  %OptimizeFunctionOnNextCall(find);
+  for (let i = 0; i < 5; i++) assertEquals(i, find(a, 10 + i));
+  assertEquals(-1, find(a, 15));
+})();
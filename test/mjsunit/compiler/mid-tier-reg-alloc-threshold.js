@@ -0,0 +1,24 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-mid-tier-reg-alloc-threshold=100
+
+// Functions above the threshold are allocated with the mid-tier register
+// allocator and must compute the same results as unoptimized code.
+(function() {
+  let source = '';
+  for (let i = 0; i < 16; i++) source += `let v${i} = x + ${i};\n`;
+  for (let i = 0; i < 200; i++) {
+    source += `v${i % 16} = (v${(i * 7) % 16} + v${(i * 3 + 1) % 16}) | 0;\n`;
+  }
+  source += 'return ' +
+      Array.from({length: 16}, (_, i) => `v${i}`).join(' ^ ') + ';';
+  const f = new Function('x', source);
+
+  %PrepareFunctionForOptimization(f);
+  const expected = [f(1), f(2), f(3)];
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, [f(1), f(2), f(3)]);
+  assertOptimized(f);
+})();
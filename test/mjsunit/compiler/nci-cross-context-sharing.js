@@ -0,0 +1,34 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-nci-cross-context-sharing
+// Flags: --opt --no-always-opt
+
+const source = `
+  function make() {
+    return function add(x) { return x + 1; };
+  }
+  make;
+`;
+
+(function CachedCodeIsSharedByAllClosures() {
+  const make1 = Realm.eval(Realm.create(), source);
+  const add1 = make1();
+  %PrepareFunctionForOptimization(add1);
+  assertEquals(2, add1(1));
+  assertEquals(3, add1(2));
+  %OptimizeFunctionOnNextCall(add1);
+  assertEquals(4, add1(3));
+  assertOptimized(add1);
+
+  // A fresh native context runs the cached native context independent code
+  // right away, and so do the further closures created in it.
+  const make2 = Realm.eval(Realm.create(), source);
+  const add2 = make2();
+  assertEquals(5, add2(4));
+  assertOptimized(add2);
+  const add3 = make2();
+  assertEquals(6, add3(5));
+  assertOptimized(add3);
+})();
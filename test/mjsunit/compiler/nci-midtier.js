@@ -0,0 +1,32 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-nci-as-midtier
+// Flags: --no-concurrent-recompilation --interrupt-budget=1024
+// Flags: --opt --no-always-opt
+
+// Warm functions first run native context independent code, which tiers up
+// to TurboFan once the function gets hot.
+function sum(a) {
+  let result = 0;
+  for (let i = 0; i < a.length; i++) {
+    if (a[i] % 3 == 0) {
+      result += a[i] * 2;
+    } else if (a[i] % 3 == 1) {
+      result -= a[i];
+    } else {
+      result += a[i] >> 1;
+    }
+  }
+  return result;
+}
+
+const array = [];
+for (let i = 0; i < 30; i++) array.push(i);
+const expected = sum(array);
+
+for (let i = 0; i < 2000; i++) {
+  assertEquals(expected, sum(array));
+}
+assertOptimized(sum);
@@ -0,0 +1,30 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --use-osr --concurrent-osr --share-osr-code
+
+// Closures created in a loop share the OSR code that the first of them got,
+// while it is compiled concurrently the loops keep running in the interpreter.
+function MakeClosure(step) {
+  return function(n) {
+    let sum = 0;
+    for (let i = 0; i < n; i += step) {
+      sum += i % 7;
+    }
+    return sum;
+  };
+}
+
+function Expected(n, step) {
+  let sum = 0;
+  for (let i = 0; i < n; i += step) sum += i % 7;
+  return sum;
+}
+%NeverOptimizeFunction(Expected);
+
+for (let i = 0; i < 20; i++) {
+  const step = i % 3 + 1;
+  const f = MakeClosure(step);
+  assertEquals(Expected(100000, step), f(100000));
+}
@@ -0,0 +1,95 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+// Named loads from proxies call the get trap from optimized code.
+(function() {
+  const log = [];
+  const proxy = new Proxy({x: 1}, {
+    get(target, name, receiver) {
+      log.push(name);
+      return name === 'x' ? target.x + 1 : undefined;
+    }
+  });
+  function load(p) { return p.x; }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(2, load(proxy));
+  assertEquals(2, load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(2, load(proxy));
+  assertOptimized(load);
+  assertEquals(['x', 'x', 'x'], log);
+
+  // Without a trap, the load goes to the target.
+  const plain = new Proxy({x: 7}, {});
+  assertEquals(7, load(plain));
+  assertOptimized(load);
+
+  // Non-proxy receivers deoptimize.
+  assertEquals(3, load({x: 3}));
+  assertUnoptimized(load);
+})();
+
+// Named stores to proxies call the set trap from optimized code.
+(function() {
+  const target = {};
+  const proxy = new Proxy(target, {
+    set(target, name, value, receiver) {
+      target[name] = value * 2;
+      return true;
+    }
+  });
+  function store(p, v) { p.y = v; }
+
+  %PrepareFunctionForOptimization(store);
+  store(proxy, 1);
+  store(proxy, 2);
+  %OptimizeFunctionOnNextCall(store);
+  store(proxy, 3);
+  assertOptimized(store);
+  assertEquals(6, target.y);
+})();
+
+// Exceptions thrown by traps and invariant violations are catchable.
+(function() {
+  const target = {};
+  Object.defineProperty(target, 'z', {value: 1});
+  let throwing = false;
+  const proxy = new Proxy(target, {
+    get(target, name) {
+      if (throwing) throw 'boom';
+      return 2;
+    }
+  });
+  function load(p) {
+    try {
+      return p.z;
+    } catch (e) {
+      return e;
+    }
+  }
+
+  %PrepareFunctionForOptimization(load);
+  assertInstanceof(load(proxy), TypeError);
+  %OptimizeFunctionOnNextCall(load);
+  assertInstanceof(load(proxy), TypeError);
+  throwing = true;
+  assertEquals('boom', load(proxy));
+  assertOptimized(load);
+})();
+
+// Revoked proxies throw.
+(function() {
+  const {proxy, revoke} = Proxy.revocable({w: 1}, {});
+  function load(p) { return p.w; }
+
+  %PrepareFunctionForOptimization(load);
+  assertEquals(1, load(proxy));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(1, load(proxy));
+  revoke();
+  assertThrows(() => load(proxy), TypeError);
+})();
@@ -0,0 +1,38 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --opt --no-always-opt
+
+function sum(a, b, c) { return a + b + c; }
+function count() { return arguments.length; }
+
+// Spreading and applying an array literal passes its elements directly.
+(function() {
+  function foo() {
+    return sum(...[1, 2, 3]) + sum.apply(undefined, ['a', 'b', 'c']) +
+        count(...[]) + count.apply(null, [{}, {}]);
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals('6abc02', foo());
+  assertEquals('6abc02', foo());
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals('6abc02', foo());
+  assertOptimized(foo);
+})();
+
+// Changing the array iteration protocol is observed by spread calls.
+(function() {
+  function foo() { return sum(...[1, 2, 3]); }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals(6, foo());
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals(6, foo());
+  assertOptimized(foo);
+
+  Array.prototype[Symbol.iterator] = function*() { yield 10; };
+  assertUnoptimized(foo);
+  assertEquals(NaN, foo());
+})();
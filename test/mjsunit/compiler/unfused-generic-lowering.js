@@ -0,0 +1,24 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-turbo-fuse-generic-lowering
+
+// Generic JS operations must be lowered the same way whether or not generic
+// lowering runs as part of early optimization.
+(function() {
+  function foo(a, b) {
+    let sum = 0;
+    for (let i = 0; i < a.length; i++) {
+      sum += a[i] + b;
+    }
+    return [sum, typeof b, b instanceof Object, `${sum}`];
+  }
+
+  %PrepareFunctionForOptimization(foo);
+  assertEquals([6, 'number', false, '6'], foo([1, 2, 3], 0));
+  assertEquals(['01020', 'string', false, '01020'], foo([1, 2], '0'));
+  %OptimizeFunctionOnNextCall(foo);
+  assertEquals([6, 'number', false, '6'], foo([1, 2, 3], 0));
+  assertEquals(['01020', 'string', false, '01020'], foo([1, 2], '0'));
+})();
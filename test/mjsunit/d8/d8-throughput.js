@@ -0,0 +1,22 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --throughput-isolates=3 --throughput-threads=2
+// Flags: --throughput-requests=50 --throughput-warmup=5
+
+// Each isolate loads this script and handles its requests in order.
+let expected = 0;
+let resolved = 0;
+
+function handleRequest(request) {
+  if (request == 0) {
+    assertEquals(expected, resolved);
+    expected = resolved = 0;
+  }
+  assertEquals(expected++, request);
+  assertEquals(request, resolved);
+  // Promise jobs scheduled by a request complete as part of it.
+  Promise.resolve().then(() => resolved++);
+  return new Array(100).fill(request);
+}
@@ -0,0 +1,41 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings in the exact format of toISOString round-trip through Date.parse.
+for (let t of [0, -1, 1, 1e12, -1e12, 8.64e15, -8.64e15, 253402300799999,
+               -62167219200000, -62167219200001, 1262390400000]) {
+  let s = new Date(t).toISOString();
+  assertEquals(t, Date.parse(s));
+  assertEquals(t, new Date(s).getTime());
+}
+
+assertEquals("0000-01-01T00:00:00.000Z",
+             new Date(-62167219200000).toISOString());
+assertEquals("-000001-12-31T23:59:59.999Z",
+             new Date(-62167219200001).toISOString());
+assertEquals("+275760-09-13T00:00:00.000Z", new Date(8.64e15).toISOString());
+assertEquals("-271821-04-20T00:00:00.000Z", new Date(-8.64e15).toISOString());
+
+// Hour 24 is only allowed for the end of a day.
+assertEquals(Date.parse("2010-01-02T00:00:00.000Z"),
+             Date.parse("2010-01-01T24:00:00.000Z"));
+assertEquals(NaN, Date.parse("2010-01-01T24:00:00.001Z"));
+assertEquals(NaN, Date.parse("2010-01-01T24:01:00.000Z"));
+
+// Days past the end of the month overflow into the next one.
+assertEquals(Date.parse("2015-03-03T11:22:33.444Z"),
+             Date.parse("2015-02-31T11:22:33.444Z"));
+
+// Out of range fields.
+assertEquals(NaN, Date.parse("2010-13-01T00:00:00.000Z"));
+assertEquals(NaN, Date.parse("2010-00-01T00:00:00.000Z"));
+assertEquals(NaN, Date.parse("2010-01-00T00:00:00.000Z"));
+assertEquals(NaN, Date.parse("2010-01-32T00:00:00.000Z"));
+assertEquals(NaN, Date.parse("2010-01-01T25:00:00.000Z"));
+assertEquals(NaN, Date.parse("2010-01-01T23:60:00.000Z"));
+assertEquals(NaN, Date.parse("2010-01-01T23:59:60.000Z"));
+
+// Two-byte strings take the same path.
+let two_byte = "2010-01-02T00:00:00.000Z\u1234".substring(0, 24);
+assertEquals(1262390400000, Date.parse(two_byte));
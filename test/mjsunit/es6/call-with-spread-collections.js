@@ -0,0 +1,53 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+function args(...a) { return a; }
+
+(function spreadSetAndIterators() {
+  const set = new Set([1, 2, 3]);
+  assertEquals([1, 2, 3], args(...set));
+  assertEquals([1, 2, 3], args(...set.values()));
+  assertEquals([1, 2, 3], args(...set.keys()));
+  assertEquals([[1, 1], [2, 2], [3, 3]], args(...set.entries()));
+  assertEquals([1, 2, 3], Array.from(new Uint8Array(set)));
+
+  const map = new Map([['a', 1], ['b', 2]]);
+  assertEquals(['a', 'b'], args(...map.keys()));
+  assertEquals([1, 2], args(...map.values()));
+  assertEquals([['a', 1], ['b', 2]], args(...map));
+  assertEquals([['a', 1], ['b', 2]], args(...map.entries()));
+
+  assertEquals(['a', 'b', 'c'], args(...'abc'));
+})();
+
+(function spreadPartiallyConsumedIterator() {
+  const set_iterator = new Set([1, 2, 3]).values();
+  set_iterator.next();
+  assertEquals([2, 3], args(...set_iterator));
+  assertEquals([], args(...set_iterator));
+
+  const map_iterator = new Map([['a', 1], ['b', 2]]).keys();
+  map_iterator.next();
+  assertEquals(['b'], args(...map_iterator));
+  assertEquals([], args(...map_iterator));
+})();
+
+(function spreadExhaustsIterator() {
+  const iterator = new Set([1, 2]).values();
+  assertEquals([1, 2], args(...iterator));
+  assertTrue(iterator.next().done);
+})();
+
+(function spreadWithModifiedNext() {
+  const set_iterator_prototype =
+      Object.getPrototypeOf(new Set()[Symbol.iterator]());
+  const original_next = set_iterator_prototype.next;
+  set_iterator_prototype.next = function() {
+    const result = original_next.call(this);
+    if (!result.done) result.value *= 2;
+    return result;
+  };
+  assertEquals([2, 4], args(...new Set([1, 2])));
+  set_iterator_prototype.next = original_next;
+})();
@@ -0,0 +1,43 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// String keys are found through equal strings of any representation, and
+// other strings in the same bucket chains are told apart.
+function Lookup(map, set, key) {
+  return [map.get(key), map.has(key), set.has(key)];
+}
+%PrepareFunctionForOptimization(Lookup);
+
+function Test() {
+  const map = new Map();
+  const set = new Set();
+  const keys = [];
+  for (let i = 0; i < 1000; i++) {
+    const key = 'key' + i;
+    keys.push(key);
+    map.set(key, i);
+    set.add(key);
+  }
+  map.set('ሴtwo-byte', -1);
+  set.add('ሴtwo-byte');
+
+  for (let i = 0; i < 1000; i += 37) {
+    const long = 'a much longer prefix to get a cons string ' + i;
+    const sliced = long.substring(long.length - String(i).length);
+    assertEquals([i, true, true], Lookup(map, set, 'key' + sliced));
+    assertEquals([i, true, true], Lookup(map, set, keys[i].split('').join('')));
+    assertEquals([undefined, false, false], Lookup(map, set, 'kex' + i));
+    assertEquals([undefined, false, false], Lookup(map, set, long));
+  }
+  assertEquals([-1, true, true],
+               Lookup(map, set, 'ሴ' + 'two-' + 'byte'));
+  assertEquals([undefined, false, false],
+               Lookup(map, set, 'ስ' + 'two-' + 'byte'));
+}
+
+Test();
+%OptimizeFunctionOnNextCall(Lookup);
+Test();
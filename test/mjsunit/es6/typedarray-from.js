@@ -2,7 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
-// Flags: --allow-natives-syntax
+// Flags: --allow-natives-syntax --expose-gc
 
 var typedArrayConstructors = [
   Uint8Array,
@@ -245,3 +245,19 @@ for (var constructor of typedArrayConstructors) {
   assertEquals(constructor, Uint8Array.from.call(constructor, [1]).constructor);
   assertEquals(Uint8Array, constructor.from.call(Uint8Array, [1]).constructor);
 }
+
+// Typed arrays created by the built-in constructors aren't zeroed before
+// the copy, so every element must come from the source.
+for (var constructor of typedArrayConstructors) {
+  // Reuse dead backing stores of the same size.
+  for (var i = 0; i < 10; i++) new constructor(64).fill(7);
+  gc();
+  var expected = [defaultValue(constructor), 1, defaultValue(constructor)];
+  assertArrayLikeEquals(
+      constructor.from({length: 3, 1: 1}), expected, constructor);
+  assertArrayLikeEquals(
+      constructor.from({length: 64}),
+      new Array(64).fill(defaultValue(constructor)), constructor);
+  var source = {length: 4, 0: 1, get 1() { throw 42; }};
+  assertThrowsEquals(() => constructor.from(source), 42);
+}
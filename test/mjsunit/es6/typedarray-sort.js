@@ -149,3 +149,32 @@ for (let constructor of constructorsWithArrays) {
   assertArrayLikeEquals(array, constructor.array.reverse(), constructor.ctor);
   assertEquals(array.length, constructor.array.length);
 }
+
+// Large arrays are sorted with a radix sort; it has to agree with the
+// comparator-based sort, including the order of -0, +0 and NaN.
+for (let constructor of constructorsWithArrays) {
+  const kSize = 3000;
+  const values = constructor.array.concat(constructor.array.map(x => -x));
+  if (constructor.ctor === Float32Array ||
+      constructor.ctor === Float64Array) {
+    values.push(-0, NaN, -Infinity, Infinity, 0.5, -0.5);
+  }
+  const array = new constructor.ctor(kSize);
+  for (let i = 0; i < kSize; ++i) {
+    array[i] = values[(i * 7919) % values.length];
+  }
+  // cmpfn doesn't order -0 before +0, and is inconsistent for NaN.
+  const nans = Array.from(array).filter(x => x !== x);
+  const numbers = Array.from(array).filter(x => x === x).sort(cmpfn);
+  const zeros = numbers.filter(x => x == 0);
+  const negativeZeros = zeros.filter(x => Object.is(x, -0));
+  const positiveZeros = zeros.filter(x => !Object.is(x, -0));
+  const nonZeros = numbers.filter(x => x != 0);
+  const firstPositive = nonZeros.findIndex(x => x > 0);
+  const split = firstPositive < 0 ? nonZeros.length : firstPositive;
+  const expectedOrder = nonZeros.slice(0, split).concat(
+      negativeZeros, positiveZeros, nonZeros.slice(split), nans);
+
+  assertEquals(array.sort(), array);
+  assertArrayLikeEquals(array, expectedOrder, constructor.ctor);
+}
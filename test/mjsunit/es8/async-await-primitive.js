@@ -0,0 +1,47 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Awaiting a value that is not an object resumes after exactly one tick,
+// whatever kind of primitive it is.
+const values = [undefined, null, true, 42, 1.5, -0, "str", Symbol("sym"), 1n];
+
+for (const value of values) {
+  const log = [];
+  async function f() {
+    log.push("f start");
+    const result = await value;
+    assertSame(value, result);
+    log.push("f resumed");
+  }
+  f();
+  Promise.resolve().then(() => log.push("tick 1"))
+                   .then(() => log.push("tick 2"));
+  log.push("sync end");
+  %PerformMicrotaskCheckpoint();
+  assertEquals(["f start", "sync end", "f resumed", "tick 1", "tick 2"], log);
+}
+
+// The same holds for await in async generators.
+{
+  const log = [];
+  async function* g() {
+    log.push(await 1);
+    yield await "x";
+  }
+  g().next().then(result => log.push(result.value));
+  %PerformMicrotaskCheckpoint();
+  assertEquals([1, "x"], log);
+}
+
+// Awaiting in a loop resolves each value in order.
+{
+  let sum = 0;
+  (async function() {
+    for (let i = 0; i < 100; i++) sum += await i;
+  })();
+  %PerformMicrotaskCheckpoint();
+  assertEquals(4950, sum);
+}
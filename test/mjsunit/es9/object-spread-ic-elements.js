@@ -0,0 +1,86 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function testDoubleElements() {
+  function f(src) { return {...src}; }
+  var src = {};
+  src[0] = 1.5;
+  src[1] = 2.5;
+  assertTrue(%HasDoubleElements(src));
+
+  // Uninitialized
+  var a = f(src);
+  assertEquals({ 0: 1.5, 1: 2.5 }, a);
+  assertTrue(%HasDoubleElements(a));
+
+  // Monomorphic
+  var b = f(src);
+  assertEquals({ 0: 1.5, 1: 2.5 }, b);
+  assertTrue(%HaveSameMap(a, b));
+
+  // The clone doesn't share the backing store with its source.
+  b[0] = 3.5;
+  assertEquals(1.5, src[0]);
+  assertEquals(1.5, a[0]);
+  b[1] = "x";
+  assertEquals({ 0: 3.5, 1: "x" }, b);
+  assertEquals({ 0: 1.5, 1: 2.5 }, f(src));
+})();
+
+(function testFrozenElements() {
+  function f(src) { return {...src}; }
+  var src = Object.freeze({ 0: "a", 1: "b", foo: "foo" });
+
+  // Uninitialized
+  var a = f(src);
+  assertEquals({ 0: "a", 1: "b", foo: "foo" }, a);
+
+  // Monomorphic
+  var b = f(src);
+  assertEquals({ 0: "a", 1: "b", foo: "foo" }, b);
+  assertTrue(%HaveSameMap(a, b));
+
+  // The clone is a plain, writable object.
+  assertFalse(Object.isFrozen(b));
+  b[0] = "c";
+  b.foo = "bar";
+  b[2] = "d";
+  assertEquals({ 0: "c", 1: "b", 2: "d", foo: "bar" }, b);
+  assertEquals({ 0: "a", 1: "b", foo: "foo" }, src);
+})();
+
+(function testSpreadThenAdd() {
+  function f(src) { return {...src, x: 1}; }
+  var src = { 0: 0, a: "a", b: "b" };
+  src.c = "c";
+
+  var a = f(src);
+  var b = f(src);
+  assertEquals({ 0: 0, a: "a", b: "b", c: "c", x: 1 }, b);
+  assertTrue(%HaveSameMap(a, b));
+})();
+
+(function testMegamorphicElements() {
+  function f(src) { return {...src}; }
+  f(new Proxy({}, {}));
+
+  // Elements are copied before any getter runs.
+  var src = [1, , 3];
+  Object.defineProperty(src, "foo", {
+    enumerable: true,
+    get() { src[0] = 2; return "foo"; }
+  });
+  var clone = f(src);
+  assertEquals(1, clone[0]);
+  assertFalse(1 in clone);
+  assertEquals(3, clone[2]);
+  assertEquals(["0", "2", "foo"], Object.keys(clone));
+  assertEquals(2, src[0]);
+
+  var frozen = Object.freeze([4, 5]);
+  assertEquals({ 0: 4, 1: 5 }, f(frozen));
+  assertEquals({ 0: 6, 1: 7.5 }, f([6, 7.5]));
+})();
@@ -0,0 +1,55 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Copies and clones of a map reuse its enum cache. Check that enumerating
+// objects with such maps still sees their own values.
+
+function ForInValues(o) {
+  let result = [];
+  for (let key in o) result.push(key, o[key]);
+  return result;
+}
+%PrepareFunctionForOptimization(ForInValues);
+
+// Object spread clones, including a double field.
+{
+  let source = {a: 1, b: 1.5, c: "c"};
+  assertEquals(["a", "b", "c"], Object.keys(source));
+  for (let i = 0; i < 3; i++) {
+    let clone = {...source};
+    clone.b += i;
+    assertEquals(["a", 1, "b", 1.5 + i, "c", "c"], ForInValues(clone));
+    assertEquals([["a", 1], ["b", 1.5 + i], ["c", "c"]],
+                 Object.entries(clone));
+  }
+  assertEquals(["a", 1, "b", 1.5, "c", "c"], ForInValues(source));
+}
+
+// Map copies, e.g. when an object stops being extensible.
+{
+  let o = {x: 1, y: 2.5};
+  assertEquals(["x", "y"], Object.keys(o));
+  Object.preventExtensions(o);
+  o.y = 3.5;
+  assertEquals(["x", 1, "y", 3.5], ForInValues(o));
+  assertEquals([1, 3.5], Object.values(o));
+}
+
+// A source map that shares its descriptors with a transition.
+{
+  let short = {p: 1, q: 2};
+  let long = {p: 1, q: 2, r: 3};
+  assertEquals(["p", "q", "r"], Object.keys(long));
+  assertEquals(["p", "q"], Object.keys(short));
+  let clone = {...short};
+  assertEquals(["p", 1, "q", 2], ForInValues(clone));
+  clone.s = 4;
+  assertEquals(["p", "q", "s"], Object.keys(clone));
+  assertEquals(["p", "q", "r"], Object.keys(long));
+}
+
+%OptimizeFunctionOnNextCall(ForInValues);
+assertEquals(["u", 1, "v", 2.5], ForInValues({...{u: 1, v: 2.5}}));
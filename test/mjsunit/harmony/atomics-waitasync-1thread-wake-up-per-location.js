@@ -0,0 +1,52 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --harmony-sharedarraybuffer --harmony-atomics-waitasync
+
+// Waiters on different locations and buffers are independent of each other.
+(function test() {
+  const sab1 = new SharedArrayBuffer(64);
+  const sab2 = new SharedArrayBuffer(64);
+  const i32a1 = new Int32Array(sab1);
+  const i32a2 = new Int32Array(sab2);
+  const kLocations = 16;
+
+  for (let i = 0; i < kLocations; ++i) {
+    for (let j = 0; j <= i; ++j) {
+      assertTrue(Atomics.waitAsync(i32a1, i, 0).async);
+    }
+    assertTrue(Atomics.waitAsync(i32a2, i, 0).async);
+  }
+  for (let i = 0; i < kLocations; ++i) {
+    assertEquals(i + 1, %AtomicsNumWaitersForTesting(i32a1, i));
+    assertEquals(1, %AtomicsNumWaitersForTesting(i32a2, i));
+  }
+
+  assertEquals(6, Atomics.notify(i32a1, 5));
+  assertEquals(0, %AtomicsNumWaitersForTesting(i32a1, 5));
+  assertEquals(6, %AtomicsNumUnresolvedAsyncPromisesForTesting(i32a1, 5));
+  assertEquals(1, %AtomicsNumWaitersForTesting(i32a2, 5));
+  assertEquals(0, %AtomicsNumUnresolvedAsyncPromisesForTesting(i32a2, 5));
+
+  assertEquals(2, Atomics.notify(i32a1, 7, 2));
+  assertEquals(6, %AtomicsNumWaitersForTesting(i32a1, 7));
+  assertEquals(1, Atomics.notify(i32a2, 7));
+  assertEquals(0, %AtomicsNumWaitersForTesting(i32a2, 7));
+
+  for (let i = 0; i < kLocations; ++i) {
+    Atomics.notify(i32a1, i);
+    Atomics.notify(i32a2, i);
+    assertEquals(0, %AtomicsNumWaitersForTesting(i32a1, i));
+    assertEquals(0, %AtomicsNumWaitersForTesting(i32a2, i));
+  }
+
+  function continuation() {
+    for (let i = 0; i < kLocations; ++i) {
+      assertEquals(0, %AtomicsNumUnresolvedAsyncPromisesForTesting(i32a1, i));
+      assertEquals(0, %AtomicsNumUnresolvedAsyncPromisesForTesting(i32a2, i));
+    }
+  }
+
+  setTimeout(continuation, 0);
+})();
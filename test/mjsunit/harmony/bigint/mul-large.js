@@ -0,0 +1,37 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Products of operands long enough to use Karatsuba multiplication, checked
+// against identities that don't rely on multiplication.
+
+// (2^n - 1)^2 = 2^(2n) - 2^(n+1) + 1.
+for (let n of [2048n, 4096n, 4160n, 10000n, 40000n]) {
+  let x = (1n << n) - 1n;
+  assertEquals((1n << (2n * n)) - (1n << (n + 1n)) + 1n, x * x);
+  assertEquals(-(x * x), x * -x);
+}
+
+// Products with pseudo-random digits and unbalanced lengths.
+let seed = 1;
+function RandomBigInt(hex_digits) {
+  let s = "0x";
+  for (let i = 0; i < hex_digits; i++) {
+    seed = (seed * 1103515245 + 12345) & 0x7fffffff;
+    s += (seed >> 16 & 0xf).toString(16);
+  }
+  return BigInt(s);
+}
+for (let [x_length, y_length] of [[600, 600], [1024, 1000], [700, 2500],
+                                  [5000, 613], [4000, 4000]]) {
+  let x = RandomBigInt(x_length) | 1n;
+  let y = RandomBigInt(y_length) | 1n;
+  let product = x * y;
+  assertEquals(product, y * x);
+  assertEquals(y, product / x);
+  assertEquals(0n, product % x);
+  assertEquals(x, product / y);
+  // Zero digits in the middle of an operand.
+  let z = (x << 3000n) + y;
+  assertEquals((product << 3000n) + y * y, z * y);
+}
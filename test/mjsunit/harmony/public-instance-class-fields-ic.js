@@ -0,0 +1,133 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Instances of the same class share their maps.
+{
+  class C {
+    a = 1;
+    b = "b";
+    c = {};
+  }
+
+  let c1 = new C;
+  let c2 = new C;
+  let c3 = new C;
+  assertEquals(1, c3.a);
+  assertEquals("b", c3.b);
+  assertTrue(%HaveSameMap(c1, c2));
+  assertTrue(%HaveSameMap(c2, c3));
+  assertTrue(%HasFastProperties(c3));
+}
+
+// Fields are defined, setters on the prototype chain aren't called.
+{
+  let setter_calls = 0;
+  class Base {
+    set x(v) { setter_calls++; }
+  }
+  class C extends Base {
+    x = 1;
+  }
+
+  for (let i = 0; i < 5; i++) {
+    let c = new C;
+    assertEquals(1, c.x);
+    assertTrue(c.hasOwnProperty("x"));
+  }
+  assertEquals(0, setter_calls);
+
+  Object.defineProperty(Object.prototype, "y", {
+    set(v) { setter_calls++; },
+    configurable: true
+  });
+  class D {
+    y = 2;
+  }
+  for (let i = 0; i < 5; i++) {
+    assertEquals(2, (new D).y);
+  }
+  assertEquals(0, setter_calls);
+
+  // The same holds for properties following a spread.
+  function spread(o) { return {...o, y: 3}; }
+  for (let i = 0; i < 5; i++) {
+    assertEquals(3, spread({}).y);
+  }
+  assertEquals(0, setter_calls);
+  delete Object.prototype.y;
+}
+
+// Fields on objects returned from a base constructor.
+{
+  class Base {
+    constructor(o) { return o; }
+  }
+  class C extends Base {
+    x = 1;
+  }
+
+  function make(o) { return new C(o); }
+
+  // An existing plain property is overwritten.
+  for (let i = 0; i < 5; i++) {
+    let o = make({ x: 0 });
+    assertEquals(1, o.x);
+  }
+
+  // An existing non-enumerable property becomes enumerable.
+  let o = {};
+  Object.defineProperty(o, "x", { value: 0, writable: true,
+                                  configurable: true });
+  make(o);
+  assertEquals({ value: 1, writable: true, enumerable: true,
+                 configurable: true },
+               Object.getOwnPropertyDescriptor(o, "x"));
+
+  // An accessor is replaced, not called.
+  o = { get x() { return 0; }, set x(v) { assertUnreachable(); } };
+  make(o);
+  assertEquals(1, Object.getOwnPropertyDescriptor(o, "x").value);
+
+  // Non-configurable properties and non-extensible objects throw.
+  assertThrows(() => make(Object.freeze({ x: 0 })), TypeError);
+  assertThrows(() => make(Object.preventExtensions({})), TypeError);
+
+  // Proxies see a defineProperty.
+  let log = [];
+  let proxy = new Proxy({}, {
+    defineProperty(target, key, desc) {
+      log.push(key);
+      return Reflect.defineProperty(target, key, desc);
+    },
+    set() { assertUnreachable(); }
+  });
+  assertEquals(1, make(proxy).x);
+  assertEquals(["x"], log);
+
+  // And still work after all of the above made the IC megamorphic.
+  for (let i = 0; i < 5; i++) {
+    assertEquals(1, make({}).x);
+    assertThrows(() => make(Object.freeze({})), TypeError);
+  }
+}
+
+// Optimized code defines the fields as well.
+{
+  class C {
+    a = 1;
+    b = 2;
+  }
+  function foo() { return new C; }
+
+  %PrepareFunctionForOptimization(foo);
+  foo();
+  foo();
+  %OptimizeFunctionOnNextCall(foo);
+  let c = foo();
+  assertEquals(1, c.a);
+  assertEquals(2, c.b);
+  assertTrue(%HaveSameMap(c, new C));
+}
@@ -0,0 +1,32 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-weak-refs --expose-gc --noincremental-marking
+
+// Several dirty FinalizationRegistries may be cleaned up in one task, but
+// microtasks enqueued by a cleanup function still run before the next
+// FinalizationRegistry is cleaned up.
+
+let log = [];
+let cleanup = function(holdings) {
+  log.push("cleanup");
+  Promise.resolve().then(() => log.push("microtask"));
+}
+
+let fg1 = new FinalizationRegistry(cleanup);
+let fg2 = new FinalizationRegistry(cleanup);
+
+// The objects need to be inside a closure so that we can reliably kill them.
+(function() {
+  fg1.register({}, "holdings1");
+  fg2.register({}, "holdings2");
+})();
+
+// This GC will discover dirty WeakCells and schedule cleanup.
+gc();
+assertEquals([], log);
+
+setTimeout(() => {
+  assertEquals(["cleanup", "microtask", "cleanup", "microtask"], log);
+}, 0);
@@ -0,0 +1,37 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Strings are scanned a machine word at a time.  Check terminating and
+// escaped characters at every offset within and across words, for one-byte
+// and two-byte sources.
+for (let filler of ["a", "é", "π"]) {
+  for (let length = 0; length < 40; length++) {
+    let prefix = filler.repeat(length);
+    assertEquals(prefix, JSON.parse(`"${prefix}"`));
+    assertEquals(prefix + "\"x", JSON.parse(`"${prefix}\\"x"`));
+    assertEquals(prefix + "\\", JSON.parse(`"${prefix}\\\\"`));
+    assertEquals(prefix + "\n" + prefix,
+                 JSON.parse(`"${prefix}\\n${prefix}"`));
+    assertEquals(prefix + "π", JSON.parse(`"${prefix}\\u03c0"`));
+    assertThrows(() => JSON.parse(`"${prefix}\n"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${prefix}\x1f"`), SyntaxError);
+    assertThrows(() => JSON.parse(`"${prefix}`), SyntaxError);
+    assertEquals([prefix, prefix], JSON.parse(`["${prefix}","${prefix}"]`));
+  }
+}
+
+// Short decimals are computed without the generic string to double
+// conversion and must round identically.
+for (let s of ["0.1", "-0.1", "0.3", "1.5", "123456.789", "-0", "-0.0",
+               "0.000001", "99999999999999.9", "999999999999999",
+               "9999999999999999", "1234567890.12345", "1234567890.123456",
+               "0.1e1", "1E-7", "-12.5e+3", "4503599627370497.5",
+               "0.30000000000000004", "1000000000", "-2147483649"]) {
+  assertEquals(Number(s), JSON.parse(s), s);
+  assertEquals(Object.is(Number(s), -0), Object.is(JSON.parse(s), -0), s);
+}
+for (let i = 0; i < 1000; i++) {
+  let s = (Math.random() * 10 ** (i % 12)).toFixed(i % 8);
+  assertEquals(Number(s), JSON.parse(s), s);
+}
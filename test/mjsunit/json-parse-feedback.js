@@ -0,0 +1,41 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Objects in arrays use the shape of their siblings as feedback.  Records
+// with optional properties should still end up with shared maps.
+{
+  let records = JSON.parse(`[
+    {"id": 1, "name": "a", "extra": true},
+    {"id": 2, "name": "b"},
+    {"id": 3, "name": "c", "extra": false},
+    {"id": 4, "name": "d"},
+    {"id": 5, "name": "e", "extra": null}
+  ]`);
+  assertTrue(%HaveSameMap(records[0], records[2]));
+  assertTrue(%HaveSameMap(records[0], records[4]));
+  assertTrue(%HaveSameMap(records[1], records[3]));
+  assertFalse(%HaveSameMap(records[0], records[1]));
+  assertEquals({id: 4, name: "d"}, records[3]);
+  assertEquals({id: 5, name: "e", extra: null}, records[4]);
+}
+
+// Diverging keys and representations fall back to the transition tree.
+{
+  let records = JSON.parse(`[
+    {"x": 1, "y": 2},
+    {"x": 1.5, "y": "two"},
+    {"y": 1, "x": 2},
+    {"x": 3, "y": 4, "z": [5]},
+    [1, 2],
+    {"x": {"nested": 1}, "y": null}
+  ]`);
+  assertEquals({x: 1, y: 2}, records[0]);
+  assertEquals({x: 1.5, y: "two"}, records[1]);
+  assertEquals(["y", "x"], Object.keys(records[2]));
+  assertEquals({x: 3, y: 4, z: [5]}, records[3]);
+  assertEquals([1, 2], records[4]);
+  assertEquals({x: {nested: 1}, y: null}, records[5]);
+}
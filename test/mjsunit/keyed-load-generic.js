@@ -18,3 +18,31 @@
   o[c] = "foo";
   assertEquals("foo", f(o, c));
 })();
+
+(function AbsentNonInternalizedKeys() {
+  function f(o, key) {
+    return o[key];
+  }
+
+  // Make the IC megamorphic.
+  for (let i = 0; i < 10; i++) f({['p' + i]: i}, 'p' + i);
+
+  const fast = {a: 1};
+  const dictionary = {a: 1, b: 2};
+  delete dictionary.a;
+  assertTrue(%HasFastProperties(fast));
+  assertFalse(%HasFastProperties(dictionary));
+  const handler = {get(target, key) { return 'proxy:' + key; }};
+  const with_proxy = Object.create(new Proxy({}, handler));
+
+  for (let i = 0; i < 10; i++) {
+    // Computed keys that were never used as property names before.
+    const key = 'absent' + i;
+    assertEquals(undefined, f(fast, key));
+    assertEquals(undefined, f(dictionary, key));
+    assertEquals(undefined, f([], key));
+    assertEquals(undefined, f('abc', key));
+    assertEquals('proxy:' + key, f(with_proxy, 'absent' + i));
+  }
+  assertEquals(2, f(dictionary, 'b' + ''));
+})();
@@ -0,0 +1,42 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --enable-experimental-regexp-engine
+
+// Experimental regexps always execute in the runtime, where executions from
+// index 0 on internalized subjects are cached.  Repeated executions must
+// still produce fresh results and update the legacy static properties.
+{
+  let re = /(\w+)-(\d+)?/l;
+  for (let i = 0; i < 3; i++) {
+    let result = re.exec("id abc-12 x");
+    assertEquals(["abc-12", "abc", "12"], result);
+    assertEquals(3, result.index);
+    assertEquals("abc", RegExp.$1);
+    assertEquals("12", RegExp.$2);
+    result.push("mutated");
+  }
+  for (let i = 0; i < 3; i++) {
+    assertNull(re.exec("no match here"));
+    assertEquals("abc", RegExp.$1);
+  }
+  assertEquals(["q-", "q", undefined], re.exec("q-"));
+  assertEquals("", RegExp.$2);
+}
+
+// Recompiling the regexp invalidates its cached results.
+{
+  let re = /a(b)/l;
+  assertEquals(["ab", "b"], re.exec("xab"));
+  re.compile("x(a)", "l");
+  assertEquals(["xa", "a"], re.exec("xab"));
+}
+
+// Captures spanning the whole match equal the match.
+{
+  let result = /(\d+)/.exec("abc 123 def");
+  assertEquals(["123", "123"], result);
+  result = /((\w)\w*)/.exec("xyz");
+  assertEquals(["xyz", "xyz", "x"], result);
+}
@@ -0,0 +1,86 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --enable-experimental-regexp-engine
+
+function Test(regexp, subject, expectedResult, expectedLastIndex) {
+  assertEquals(%RegexpTypeTag(regexp), "EXPERIMENTAL");
+  var result = regexp.exec(subject);
+  if (result instanceof Array && expectedResult instanceof Array) {
+    assertArrayEquals(expectedResult, result);
+  } else {
+    assertEquals(expectedResult, result);
+  }
+  assertEquals(expectedLastIndex, regexp.lastIndex);
+}
+
+// The 'l' flag is reflected by the `linear` getter and the flags string.
+{
+  let re = /asdf/l;
+  assertTrue(re.linear);
+  assertEquals("l", re.flags);
+  assertFalse(/asdf/.linear);
+  assertEquals("gls", /asdf/lgs.flags);
+}
+
+// Simple literals and character classes.
+Test(/asdf1/l, "123asdf1xyz", ["asdf1"], 0);
+Test(/asdf1/l, "123asdf2xyz", null, 0);
+Test(/[^a-c]+/l, "abcdefa", ["def"], 0);
+Test(/a.c/l, "a\nc", null, 0);
+Test(/a.c/ls, "a\nc", ["a\nc"], 0);
+Test(/é+/l, "caféé", ["éé"], 0);
+
+// Alternatives prefer the leftmost alternative, like backtracking.
+Test(/a|ab/l, "abc", ["a"], 0);
+Test(/(a|ab)(c|bcd)(d*)/l, "abcd", ["abcd", "a", "bcd", ""], 0);
+
+// Quantifiers.
+Test(/(a*)*b/l, "aaab", ["aaab", "aaa"], 0);
+Test(/(a*)*/l, "b", ["", undefined], 0);
+Test(/a{2,4}?/l, "aaaaa", ["aa"], 0);
+Test(/(?:ab){2}/l, "ababab", ["abab"], 0);
+
+// Captures inside quantifiers are reset on each iteration.
+Test(/((a)|b)+/l, "ab", ["ab", "b", undefined], 0);
+
+// Named captures.
+{
+  let re = /x(?<name>y+)?z/l;
+  assertEquals(%RegexpTypeTag(re), "EXPERIMENTAL");
+  assertEquals("yy", re.exec("axyyz").groups.name);
+}
+
+// Assertions.
+Test(/^abc$/lm, "x\nabc\ny", ["abc"], 0);
+Test(/^abc$/l, "x\nabc\ny", null, 0);
+Test(/\bfoo\b/l, "a foo b", ["foo"], 0);
+Test(/\Bfoo/l, "a foo b", null, 0);
+
+// Sticky and global regexps update lastIndex.
+{
+  let re = /a+/ly;
+  Test(re, "aab", ["aa"], 2);
+  Test(re, "aab", null, 0);
+  re = /x./lg;
+  Test(re, "xaxbxc", ["xa"], 2);
+  Test(re, "xaxbxc", ["xb"], 4);
+  assertEquals(["xa", "xb", "xc"], "xaxbxc".match(/x./lg));
+  assertEquals("-b--b-", "baaab".replace(/a*/lg, "-"));
+}
+
+// Patterns that are catastrophic for a backtracking engine finish quickly.
+{
+  let re = /(a*)*b/l;
+  let subject = "a".repeat(100000);
+  Test(re, subject, null, 0);
+  Test(/(x+x+)+y/l, "x".repeat(10000), null, 0);
+}
+
+// Unsupported features are rejected for regexps with the 'l' flag.
+assertThrows(() => new RegExp("(a)\\1", "l"), SyntaxError);
+assertThrows(() => new RegExp("a(?=b)", "l"), SyntaxError);
+assertThrows(() => new RegExp("(?<=b)a", "l"), SyntaxError);
+assertThrows(() => new RegExp("a", "li"), SyntaxError);
+assertThrows(() => new RegExp("a", "lu"), SyntaxError);
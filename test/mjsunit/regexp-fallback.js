@@ -0,0 +1,43 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+// Flags: --enable-experimental-regexp-engine-on-excessive-backtracks
+// Flags: --regexp-backtracks-before-fallback=100
+
+// This regexp backtracks exponentially on strings of 'a's without a 'b'.  The
+// experimental engine takes over after 100 backtracks, so the match fails
+// quickly instead of hanging.
+{
+  let re = /(a+)+b/;
+  let subject = "a".repeat(100);
+  assertEquals(null, re.exec(subject));
+  assertEquals(%RegexpTypeTag(re), "IRREGEXP");
+
+  // The fallback computes the same captures as irregexp would.
+  assertEquals(["aaab", "aaa"], re.exec("xaaab"));
+  assertEquals(["ab", "a"], re.exec(subject + "x" + "ab"));
+}
+
+// Global regexps fall back for each individual match.
+{
+  let re = /(x+x+)+y/g;
+  let subject = "x".repeat(30) + "y" + "x".repeat(30) + "z" + "xxy";
+  assertEquals(["x".repeat(30) + "y", "xxy"], subject.match(re));
+  assertEquals("-" + "x".repeat(30) + "z-", subject.replace(re, "-"));
+}
+
+// Regexps the experimental engine can't handle don't fall back, and the
+// backtrack limit doesn't apply to them.
+{
+  let re = /(a+)+\1b/;
+  assertEquals(["aab", "a"], re.exec("aab"));
+}
+
+// A user-specified backtrack limit lower than the fallback threshold keeps
+// failing the match.
+{
+  const re = %NewRegExpWithBacktrackLimit("(\\d+)+x", "", 50);
+  assertEquals(null, re.exec("333333333ax3333x"));
+}
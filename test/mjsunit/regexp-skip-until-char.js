@@ -0,0 +1,54 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --no-regexp-tier-up
+
+// Regexps whose Boyer-Moore lookahead ends in a single character may scan for
+// that character in bulk. Check matches before, inside and after a vector's
+// worth of characters, and near the end of the subject.
+
+function filler(n) {
+  return "abcdefghijklmnopqrstuvwxyz0123456789 ".repeat(n / 37 + 1)
+      .substring(0, n);
+}
+
+(function TestLiteralAtAllPositions() {
+  const re = /XYZW/;
+  for (let len = 0; len < 80; len++) {
+    for (let pos = 0; pos <= len; pos++) {
+      const s = filler(pos) + "XYZW" + filler(len - pos);
+      assertEquals(pos, s.search(re));
+    }
+    assertEquals(-1, filler(len).search(re));
+    assertEquals(-1, (filler(len) + "XYZ").search(re));
+  }
+})();
+
+(function TestCharactersWithTheHighBitSet() {
+  // 'é' and 'i' only differ in the high bit of their code unit.
+  const re = /LOGi/;
+  const s = filler(100) + "LOGé" + filler(100) + "LOGi" + filler(100);
+  assertEquals(s.indexOf("LOGi"), s.search(re));
+  assertEquals(-1, (filler(300) + "LOGé").search(re));
+})();
+
+(function TestGlobal() {
+  const s = (filler(50) + "ERR:").repeat(100) + filler(10);
+  assertEquals(100, s.match(/ERR:/g).length);
+  const re = /ERR:/g;
+  let count = 0;
+  let last = -1;
+  let m;
+  while ((m = re.exec(s)) !== null) {
+    assertTrue(m.index > last);
+    last = m.index;
+    count++;
+  }
+  assertEquals(100, count);
+})();
+
+(function TestTwoByteSubject() {
+  const s = "☃" + filler(200) + "XYZW" + filler(20);
+  assertEquals(201, s.search(/XYZW/));
+})();
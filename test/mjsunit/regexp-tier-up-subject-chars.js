@@ -0,0 +1,33 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Tier-up happens once the interpreter has scanned enough subject characters,
+// not after a fixed number of executions.
+// Flags: --regexp-tier-up --regexp-tier-up-subject-chars=100
+// Flags: --allow-natives-syntax --no-force-slow-path --no-regexp-interpret-all
+
+const kLatin1 = true;
+
+let re = /x(\d)/;
+let short_subject = "abcdefghx1";
+for (let i = 0; i < 5; i++) {
+  assertEquals(["x1", "1"], re.exec(short_subject + i));
+  assertTrue(%RegexpHasBytecode(re, kLatin1));
+  assertFalse(%RegexpHasNativeCode(re, kLatin1));
+}
+
+// This execution exhausts the remaining budget, the next one tiers up.
+assertEquals(["x2", "2"], re.exec("-".repeat(60) + "x2"));
+assertTrue(%RegexpHasBytecode(re, kLatin1));
+assertEquals(["x3", "3"], re.exec("x3"));
+assertFalse(%RegexpHasBytecode(re, kLatin1));
+assertTrue(%RegexpHasNativeCode(re, kLatin1));
+
+// Scans for a single character find the same matches as the unoptimized loop.
+for (let s of ["", "a", "xa", "ax1", "-".repeat(40) + "x9x8"]) {
+  let expected = null;
+  let i = s.search(/x\d/);
+  if (i >= 0) expected = [s.substr(i, 2), s[i + 1]];
+  assertEquals(expected, /x(\d)/.exec(s));
+}
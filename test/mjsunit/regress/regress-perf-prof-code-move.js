@@ -0,0 +1,16 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --expose-gc --perf-prof --perf-prof-delete-file
+// Flags: --compact-code-space --stress-compaction
+
+// Code logged to the jitdump file may be moved by compacting GCs.
+function f(x) { return x + 1; }
+%PrepareFunctionForOptimization(f);
+assertEquals(2, f(1));
+%OptimizeFunctionOnNextCall(f);
+assertEquals(3, f(2));
+gc();
+gc();
+assertEquals(4, f(3));
@@ -0,0 +1,19 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --short-builtin-calls
+
+// Optimized code calls and tail-calls builtins; with short builtin calls these
+// are pc-relative and have to survive the code moving around.
+function foo(a, s) {
+  return a.map(x => x + 1).join(s) + String(a.length);
+}
+
+%PrepareFunctionForOptimization(foo);
+assertEquals("2,3,43", foo([1, 2, 3], ","));
+%OptimizeFunctionOnNextCall(foo);
+assertEquals("2,3,43", foo([1, 2, 3], ","));
+gc();
+gc();
+assertEquals("2-3-43", foo([1, 2, 3], "-"));
@@ -0,0 +1,46 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Characters of cons strings read correctly, whether they lie in the
+// appended parts, which are read in place, or further left, which flattens
+// the string.
+function build(pieces) {
+  let s = '';
+  for (const piece of pieces) s += piece;
+  return s;
+}
+
+{
+  const pieces = [];
+  for (let i = 0; i < 50; i++) pieces.push('piece' + i + (i % 7 ? '' : 'Ā'));
+  const expected = pieces.join('');
+
+  // Read the last character after every append.
+  let s = '';
+  for (const piece of pieces) {
+    s += piece;
+    assertEquals(piece.charCodeAt(piece.length - 1),
+                 s.charCodeAt(s.length - 1));
+    assertEquals(piece[0], s[s.length - piece.length]);
+  }
+  assertEquals(expected, s);
+
+  // Read every character of fresh cons strings, from either end.
+  s = build(pieces);
+  for (let i = s.length - 1; i >= 0; i--) {
+    assertEquals(expected.charCodeAt(i), s.charCodeAt(i));
+  }
+  s = build(pieces);
+  for (let i = 0; i < s.length; i++) {
+    assertEquals(expected[i], s[i]);
+  }
+
+  // Right-nested cons strings.
+  s = 'a'.repeat(20) + ('b'.repeat(20) + ('c'.repeat(20) + 'd'.repeat(20)));
+  assertEquals('a', s[0]);
+  assertEquals('b', s[20]);
+  assertEquals('c', s[40]);
+  assertEquals('d', s[79]);
+  assertEquals(NaN, s.charCodeAt(80));
+}
@@ -0,0 +1,40 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Searches for characters beyond Latin-1 in two-byte subjects, at every
+// offset relative to word boundaries.
+{
+  const filler = '一丁伀Āa';
+  for (let length = 0; length < 40; length++) {
+    const prefix = filler.repeat(8).substring(0, length);
+    for (const c of ['丂', 'ā', '￿']) {
+      const subject = prefix + c + prefix;
+      assertEquals(length, subject.indexOf(c));
+      assertEquals(length, subject.indexOf(c + prefix.substring(0, 3)));
+      assertEquals(length, subject.lastIndexOf(c));
+      assertTrue(subject.includes(c));
+      assertEquals(-1, prefix.indexOf(c));
+      assertFalse(prefix.includes(c + 'x'));
+      // The search starts at the given index.
+      assertEquals(-1, subject.indexOf(c, length + 1));
+      assertEquals(length, (subject + subject).indexOf(c, length));
+    }
+  }
+}
+
+// Two-byte strings are compared correctly whether they differ before, at or
+// after a word boundary.
+{
+  const base = '一丁丂七'.repeat(5);
+  for (let i = 0; i < base.length; i++) {
+    const smaller = base.substring(0, i) + '䷿' + base.substring(i + 1);
+    const larger = base.substring(0, i) + '丐' + base.substring(i + 1);
+    assertTrue(smaller < base);
+    assertTrue(larger > base);
+    assertFalse(smaller == base);
+    assertFalse(larger == base);
+    assertTrue(base.substring(0, i) + base.substring(i) == base);
+  }
+  assertTrue(base.substring(0, 7) < base);
+}
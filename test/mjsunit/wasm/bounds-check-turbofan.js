@@ -21,3 +21,30 @@ const module = builder.instantiate();
 assertEquals(0, module.exports.load(0x10000 - 100 - 4));
 // First invalid address (64k - 100)
 assertTraps(kTrapMemOutOfBounds, _ => { module.exports.load(0x10000 - 100);});
+
+(function MaskedIndex() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addMemory(1, undefined, false);
+  // The mask keeps the access within the first page, so no check is needed.
+  builder.addFunction('load_in_bounds', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, ...wasmI32Const(0xfffc), kExprI32And,
+        kExprI32LoadMem, 0, 0])
+      .exportFunc();
+  // The mask plus the offset exceed the smallest memory, so accesses still
+  // need to be checked.
+  builder.addFunction('load_masked_oob', kSig_i_i)
+      .addBody([
+        kExprLocalGet, 0, ...wasmI32Const(0xffff), kExprI32And,
+        kExprI32LoadMem, 0, 4])
+      .exportFunc();
+  const instance = builder.instantiate();
+  %WasmTierUpFunction(instance, 0);
+  %WasmTierUpFunction(instance, 1);
+  assertEquals(0, instance.exports.load_in_bounds(-1));
+  assertEquals(0, instance.exports.load_masked_oob(0xfff8));
+  assertTraps(kTrapMemOutOfBounds, _ => {
+    instance.exports.load_masked_oob(0xfffc);
+  });
+})();
@@ -415,3 +415,30 @@ testCallBinopVoid(kWasmF64);
 
   builder.instantiate(ffi);
 })();
+
+(function F64ConversionsAtTheBoundary() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  builder.addImport("", "func", kSig_d_d);
+  builder.addFunction("main", kSig_d_d)
+      .addBody([kExprLocalGet, 0, kExprCallFunction, 0])
+      .exportFunc();
+  let args = [];
+  const func = x => {
+    args.push(x);
+    return x;
+  };
+  const main = builder.instantiate({"": {func: func}}).exports.main;
+  // Smis, HeapNumbers and doubles that only look like Smis all have to
+  // survive the round trip through both wrappers.
+  const values = [0, -0, 1, -1, 1.5, 0x3fffffff, 0x40000000, -0x80000000,
+                  0x80000000, 2 ** 53, NaN, Infinity, -Infinity];
+  for (const value of values) {
+    assertEquals(value, main(value));
+  }
+  assertEquals(values, args);
+  // Other objects still go through the generic conversion.
+  assertEquals(2.5, main({valueOf: () => 2.5}));
+  assertEquals(3, main("3"));
+  assertEquals(NaN, main(undefined));
+})();
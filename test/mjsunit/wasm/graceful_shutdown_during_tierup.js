@@ -2,7 +2,7 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
-// Flags: --no-wait-for-wasm --wasm-tier-up
+// Flags: --no-wait-for-wasm --wasm-tier-up --no-wasm-dynamic-tiering
 
 load("test/mjsunit/wasm/wasm-module-builder.js");
 
@@ -0,0 +1,96 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+load("test/mjsunit/wasm/wasm-module-builder.js");
+
+// Tables whose maximum size equals their initial size can't grow, so indirect
+// calls through them use the size as a constant. Entries can still change.
+function addFunctions(builder) {
+  let sig_i_ii = builder.addType(kSig_i_ii);
+  let add = builder.addFunction("add", sig_i_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Add])
+      .exportFunc();
+  let sub = builder.addFunction("sub", sig_i_ii)
+      .addBody([kExprLocalGet, 0, kExprLocalGet, 1, kExprI32Sub])
+      .exportFunc();
+  let neg = builder.addFunction("neg", kSig_i_i)
+      .addBody([kExprI32Const, 0, kExprLocalGet, 0, kExprI32Sub])
+      .exportFunc();
+  let main = builder.addFunction("main", kSig_i_iii)
+      .addBody([
+        kExprLocalGet, 1,
+        kExprLocalGet, 2,
+        kExprLocalGet, 0,
+        kExprCallIndirect, sig_i_ii, kTableZero
+      ])
+      .exportFunc();
+  builder.addElementSegment(0, 0, false, [add.index, sub.index, neg.index]);
+  return main.index;
+}
+
+function checkCalls(instance, table) {
+  let main = instance.exports.main;
+  assertEquals(19, main(0, 12, 7));
+  assertEquals(5, main(1, 12, 7));
+  assertTraps(kTrapFuncSigMismatch, () => main(2, 12, 7));
+  assertTraps(kTrapFuncInvalid, () => main(3, 12, 7));
+  assertTraps(kTrapFuncInvalid, () => main(-1, 12, 7));
+
+  table.set(2, instance.exports.add);
+  table.set(0, instance.exports.sub);
+  assertEquals(5, main(0, 12, 7));
+  assertEquals(19, main(2, 12, 7));
+  table.set(0, null);
+  assertTraps(kTrapFuncInvalid, () => main(0, 12, 7));
+  table.set(0, instance.exports.add);
+}
+
+(function TestFixedSizeTable() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.setTableBounds(3, 3);
+  builder.addExportOfKind("table", kExternalTable, 0);
+  let main_index = addFunctions(builder);
+  let instance = builder.instantiate();
+  let table = instance.exports.table;
+  assertThrows(() => table.grow(1), RangeError);
+
+  checkCalls(instance, table);
+  table.set(2, instance.exports.neg);
+  %WasmTierUpFunction(instance, main_index);
+  checkCalls(instance, table);
+})();
+
+(function TestImportedFixedSizeTable() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.addImportedTable("m", "table", 3, 3);
+  let main_index = addFunctions(builder);
+  let table = new WebAssembly.Table(
+      {element: "anyfunc", initial: 3, maximum: 3});
+  let instance = builder.instantiate({m: {table: table}});
+
+  checkCalls(instance, table);
+  table.set(2, instance.exports.neg);
+  %WasmTierUpFunction(instance, main_index);
+  checkCalls(instance, table);
+})();
+
+(function TestGrowableTable() {
+  print(arguments.callee.name);
+  let builder = new WasmModuleBuilder();
+  builder.setTableBounds(3, 4);
+  builder.addExportOfKind("table", kExternalTable, 0);
+  let main_index = addFunctions(builder);
+  let instance = builder.instantiate();
+  let table = instance.exports.table;
+  %WasmTierUpFunction(instance, main_index);
+
+  assertTraps(kTrapFuncInvalid, () => instance.exports.main(3, 12, 7));
+  table.grow(1);
+  table.set(3, instance.exports.sub);
+  assertEquals(5, instance.exports.main(3, 12, 7));
+})();
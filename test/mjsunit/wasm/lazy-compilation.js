@@ -97,3 +97,23 @@ load('test/mjsunit/wasm/wasm-module-builder.js');
   instance2.exports.exp_store(7);
   assertEquals(7, mem1[0]);
 })();
+
+(function prefetchStartFunctionCalleesAndExports() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  const global = builder.addGlobal(kWasmI32, true);
+  const callee = builder.addFunction('callee', kSig_v_v).addBody([
+    kExprGlobalGet, global.index, kExprI32Const, 1, kExprI32Add,
+    kExprGlobalSet, global.index
+  ]);
+  const start = builder.addFunction('start', kSig_v_v).addBody([
+    kExprCallFunction, callee.index, kExprCallFunction, callee.index
+  ]);
+  builder.addStart(start.index);
+  builder.addFunction('get', kSig_i_v)
+      .addBody([kExprGlobalGet, global.index])
+      .exportFunc();
+  builder.addFunction('unused', kSig_i_v).addBody([kExprI32Const, 7]);
+  const instance = builder.instantiate();
+  assertEquals(2, instance.exports.get());
+})();
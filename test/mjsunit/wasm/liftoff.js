@@ -34,6 +34,35 @@ load('test/mjsunit/wasm/wasm-module-builder.js');
   assertTrue(%IsLiftoffFunction(instance.exports.i32_add));
 })();
 
+(function testLoopCarriedLocals() {
+  print(arguments.callee.name);
+  const builder = new WasmModuleBuilder();
+  // Enters the loop with a constant local and two locals sharing a register,
+  // which diverge inside the loop.
+  builder.addFunction('loop', kSig_i_i)
+      .addLocals({i32_count: 3})
+      .addBody([
+        kExprI32Const, 0, kExprLocalSet, 1,                   // sum = 0
+        kExprLocalGet, 0, kExprLocalTee, 2, kExprLocalSet, 3, // a = b = n
+        kExprLoop, kWasmStmt,
+          kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Add,
+          kExprLocalSet, 1,                                   // sum += a
+          kExprLocalGet, 2, kExprI32Const, 2, kExprI32Add,
+          kExprLocalSet, 2,                                   // a += 2
+          kExprLocalGet, 3, kExprI32Const, 1, kExprI32Sub,
+          kExprLocalTee, 3,                                   // --b
+          kExprBrIf, 0,
+        kExprEnd,
+        kExprLocalGet, 1, kExprLocalGet, 2, kExprI32Add       // sum + a
+      ])
+      .exportFunc();
+
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.loop));
+  assertEquals(220, instance.exports.loop(10));
+  assertEquals(4, instance.exports.loop(1));
+})();
+
 async function testLiftoffAsync() {
   print(arguments.callee.name);
   const builder = new WasmModuleBuilder();
@@ -3,7 +3,7 @@
 // found in the LICENSE file.
 
 // Flags: --allow-natives-syntax --wasm-dynamic-tiering --liftoff
-// Flags: --no-wasm-tier-up --no-stress-opt
+// Flags: --wasm-tier-up --wasm-tiering-budget=5 --no-stress-opt
 
 load('test/mjsunit/wasm/wasm-module-builder.js');
 
@@ -36,3 +36,26 @@ while (true) {
   }
 }
 assertTrue(%IsLiftoffFunction(instance.exports.f0));
+
+(function TierUpHotLoop() {
+  const builder = new WasmModuleBuilder();
+  builder.addFunction('loop', kSig_v_i)
+    .addBody([
+      kExprLoop, kWasmStmt,
+        kExprLocalGet, 0,
+        kExprI32Const, 1,
+        kExprI32Sub,
+        kExprLocalTee, 0,
+        kExprBrIf, 0,
+      kExprEnd,
+    ])
+    .exportFunc();
+  const instance = builder.instantiate();
+  assertTrue(%IsLiftoffFunction(instance.exports.loop));
+
+  // A single call whose loop exhausts the budget triggers tier-up.
+  instance.exports.loop(num_iterations);
+
+  // Busy waiting until the function is tiered up.
+  while (%IsLiftoffFunction(instance.exports.loop)) {}
+})();
@@ -12,6 +12,12 @@ TEST(SysInfoTest, NumberOfProcessors) {
   EXPECT_LT(0, SysInfo::NumberOfProcessors());
 }
 
+TEST(SysInfoTest, NumberOfProcessorsAvailable) {
+  EXPECT_LT(0, SysInfo::NumberOfProcessorsAvailable());
+  EXPECT_GE(SysInfo::NumberOfProcessors(),
+            SysInfo::NumberOfProcessorsAvailable());
+}
+
 TEST(SysInfoTest, AmountOfPhysicalMemory) {
   EXPECT_LT(0, SysInfo::AmountOfPhysicalMemory());
 }
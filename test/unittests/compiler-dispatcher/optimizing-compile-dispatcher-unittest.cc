@@ -96,5 +96,47 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, PrioritizesHotSmallFunctions) {
+  const bool block_flag = FLAG_block_concurrent_recompilation;
+  FLAG_block_concurrent_recompilation = true;
+  Handle<JSFunction> cold = RunJS<JSFunction>("function cold() {}; cold");
+  Handle<JSFunction> hot = RunJS<JSFunction>("function hot() {}; hot");
+  Handle<JSFunction> hot_too = RunJS<JSFunction>("function hot2() {}; hot2");
+  for (Handle<JSFunction> fun : {cold, hot, hot_too}) {
+    IsCompiledScope is_compiled_scope;
+    ASSERT_TRUE(
+        Compiler::Compile(fun, Compiler::CLEAR_EXCEPTION, &is_compiled_scope));
+    JSFunction::EnsureFeedbackVector(fun, &is_compiled_scope);
+  }
+  cold->feedback_vector().set_invocation_count(1);
+  hot->feedback_vector().set_invocation_count(1000);
+  hot_too->feedback_vector().set_invocation_count(1000);
+
+  OptimizingCompileDispatcher dispatcher(i_isolate());
+  BlockingCompilationJob* cold_job =
+      new BlockingCompilationJob(i_isolate(), cold);
+  BlockingCompilationJob* hot_job =
+      new BlockingCompilationJob(i_isolate(), hot);
+  BlockingCompilationJob* hot_too_job =
+      new BlockingCompilationJob(i_isolate(), hot_too);
+  dispatcher.QueueForOptimization(cold_job);
+  dispatcher.QueueForOptimization(hot_job);
+  dispatcher.QueueForOptimization(hot_too_job);
+
+  // Hotter jobs first, equally hot jobs in arrival order.
+  OptimizedCompilationJob* next = dispatcher.NextInput();
+  EXPECT_EQ(hot_job, next);
+  delete next;
+  next = dispatcher.NextInput();
+  EXPECT_EQ(hot_too_job, next);
+  delete next;
+  next = dispatcher.NextInput();
+  EXPECT_EQ(cold_job, next);
+  delete next;
+  EXPECT_EQ(nullptr, dispatcher.NextInput());
+  dispatcher.Stop();
+  FLAG_block_concurrent_recompilation = block_flag;
+}
+
 }  // namespace internal
 }  // namespace v8
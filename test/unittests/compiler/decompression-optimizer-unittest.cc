@@ -424,6 +424,57 @@ TEST_F(DecompressionOptimizerTest, Int32LessThanOrEqualFromSpeculative) {
   EXPECT_EQ(LoadMachRep(load), CompressedMachRep(MachineType::AnyTagged()));
 }
 
+TEST_F(DecompressionOptimizerTest, Int32SubFromSmiSub) {
+  // This case tests for what GraphAssembler::SmiSub is lowered to.
+  // Define variables.
+  Node* const control = graph()->start();
+  Node* object = Parameter(Type::Any(), 0);
+  Node* effect = graph()->start();
+  Node* index = Parameter(Type::UnsignedSmall(), 1);
+
+  // Test only for AnyTagged, since TaggedPointer can't be a Smi.
+  // Create the graph.
+  Node* load_1 = graph()->NewNode(machine()->Load(MachineType::AnyTagged()),
+                                  object, index, effect, control);
+  Node* load_2 = graph()->NewNode(machine()->Load(MachineType::AnyTagged()),
+                                  object, index, effect, control);
+  graph()->SetEnd(graph()->NewNode(machine()->Int32Sub(), load_1, load_2));
+  // Change the nodes, and test the change.
+  Reduce();
+  EXPECT_EQ(LoadMachRep(load_1), CompressedMachRep(MachineType::AnyTagged()));
+  EXPECT_EQ(LoadMachRep(load_2), CompressedMachRep(MachineType::AnyTagged()));
+}
+
+TEST_F(DecompressionOptimizerTest, LoopPhiInt32Add) {
+  // Define variables.
+  Node* const control = graph()->start();
+  Node* object = Parameter(Type::Any(), 0);
+  Node* effect = graph()->start();
+  Node* index = Parameter(Type::UnsignedSmall(), 1);
+  const int number_of_inputs = 2;
+
+  // Test only for AnyTagged, since TaggedPointer can't be a Smi.
+  // Create the graph.
+  Node* loop = graph()->NewNode(common()->Loop(number_of_inputs), control,
+                                control);
+  Node* load_1 = graph()->NewNode(machine()->Load(MachineType::AnyTagged()),
+                                  object, index, effect, control);
+  Node* phi = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, number_of_inputs), load_1,
+      load_1, loop);
+  // The back edge input is loaded inside of the loop.
+  Node* load_2 = graph()->NewNode(machine()->Load(MachineType::AnyTagged()),
+                                  object, index, effect, loop);
+  phi->ReplaceInput(1, load_2);
+  graph()->SetEnd(graph()->NewNode(machine()->Int32Add(), phi, load_2));
+  // Change the nodes, and test the change.
+  Reduce();
+  EXPECT_EQ(LoadMachRep(load_1), CompressedMachRep(MachineType::AnyTagged()));
+  EXPECT_EQ(LoadMachRep(load_2), CompressedMachRep(MachineType::AnyTagged()));
+  EXPECT_EQ(PhiRepresentationOf(phi->op()),
+            CompressedMachRep(MachineType::AnyTagged()));
+}
+
 // -----------------------------------------------------------------------------
 // Bitcast cases.
 
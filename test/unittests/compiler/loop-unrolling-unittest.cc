@@ -0,0 +1,125 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-unrolling.h"
+#include "src/compiler/graph-visualizer.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/loop-peeling.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+#include "testing/gmock-support.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopUnrollingTest : public GraphTest {
+ public:
+  LoopUnrollingTest() : GraphTest(1), machine_(zone()) {}
+  ~LoopUnrollingTest() override = default;
+
+ protected:
+  MachineOperatorBuilder machine_;
+
+  MachineOperatorBuilder* machine() { return &machine_; }
+
+  LoopTree* GetLoopTree() {
+    if (FLAG_trace_turbo_graph) {
+      StdoutStream{} << AsRPO(*graph());
+    }
+    return LoopFinder::BuildLoopTree(graph(), tick_counter(), zone());
+  }
+
+  bool UnrollOne(uint32_t count) {
+    LoopTree* loop_tree = GetLoopTree();
+    LoopTree::Loop* loop = loop_tree->outer_loops()[0];
+    LoopUnroller unroller(graph(), common(), loop_tree, zone(),
+                          source_positions(), node_origins());
+    bool result = unroller.Unroll(loop, count);
+    if (FLAG_trace_turbo_graph) {
+      StdoutStream{} << AsRPO(*graph());
+    }
+    return result;
+  }
+
+  Node* InsertReturn(Node* val, Node* effect, Node* control) {
+    Node* zero = graph()->NewNode(common()->Int32Constant(0));
+    Node* r = graph()->NewNode(common()->Return(), zero, val, effect, control);
+    graph()->SetEnd(r);
+    return r;
+  }
+};
+
+TEST_F(LoopUnrollingTest, SimpleLoopWithCounter) {
+  Node* p0 = Parameter(0);
+  Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+  Node* branch = graph()->NewNode(common()->Branch(), p0, loop);
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* exit = graph()->NewNode(common()->LoopExit(), if_false, loop);
+  loop->ReplaceInput(1, if_true);
+
+  Node* base = Int32Constant(0);
+  Node* inc = Int32Constant(1);
+  Node* phi = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                               base, base, loop);
+  Node* add = graph()->NewNode(machine()->Int32Add(), phi, inc);
+  phi->ReplaceInput(1, add);
+  Node* exit_marker = graph()->NewNode(common()->LoopExitValue(), phi, exit);
+  Node* r = InsertReturn(exit_marker, start(), exit);
+
+  EXPECT_TRUE(UnrollOne(2));
+
+  // The copy of the body starts where the original body takes the backedge,
+  // and the copy takes the backedge instead.
+  Node* if_true1 = loop->InputAt(1);
+  EXPECT_NE(if_true, if_true1);
+  EXPECT_THAT(if_true1, IsIfTrue(IsBranch(p0, if_true)));
+  Node* branch1 = NodeProperties::GetControlInput(if_true1);
+  EXPECT_THAT(loop, IsLoop(start(), if_true1));
+  EXPECT_THAT(phi, IsPhi(MachineRepresentation::kTagged, base,
+                         IsInt32Add(add, inc), loop));
+  EXPECT_THAT(add, IsInt32Add(phi, inc));
+
+  // Both iterations leave the loop through the same exit.
+  EXPECT_EQ(IrOpcode::kLoopExit, exit->opcode());
+  Node* merge = exit->InputAt(0);
+  EXPECT_THAT(merge, IsMerge(if_false, IsIfFalse(branch1)));
+  EXPECT_EQ(loop, exit->InputAt(1));
+  EXPECT_THAT(exit_marker->InputAt(0),
+              IsPhi(MachineRepresentation::kTagged, phi, add, merge));
+  EXPECT_THAT(r, IsReturn(exit_marker, start(), exit));
+}
+
+TEST_F(LoopUnrollingTest, UnrolledLoopCanBePeeled) {
+  Node* p0 = Parameter(0);
+  Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+  Node* branch = graph()->NewNode(common()->Branch(), p0, loop);
+  Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+  Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+  Node* exit = graph()->NewNode(common()->LoopExit(), if_false, loop);
+  loop->ReplaceInput(1, if_true);
+  InsertReturn(p0, start(), exit);
+
+  EXPECT_TRUE(UnrollOne(3));
+
+  LoopTree* loop_tree = GetLoopTree();
+  LoopTree::Loop* unrolled = loop_tree->outer_loops()[0];
+  LoopPeeler peeler(graph(), common(), loop_tree, zone(), source_positions(),
+                    node_origins());
+  EXPECT_TRUE(peeler.CanPeel(unrolled));
+  Node* branch2 = NodeProperties::GetControlInput(loop->InputAt(1));
+  Node* branch1 = NodeProperties::GetControlInput(branch2->InputAt(1));
+  EXPECT_THAT(branch1, IsBranch(p0, if_true));
+  EXPECT_THAT(branch2, IsBranch(p0, IsIfTrue(branch1)));
+  EXPECT_THAT(exit->InputAt(0),
+              IsMerge(if_false, IsIfFalse(branch1), IsIfFalse(branch2)));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
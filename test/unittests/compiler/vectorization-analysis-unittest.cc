@@ -0,0 +1,90 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/vectorization-analysis.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class VectorizationAnalysisTest : public GraphTest {
+ public:
+  VectorizationAnalysisTest()
+      : GraphTest(1), machine_(zone()), simplified_(zone()) {}
+  ~VectorizationAnalysisTest() override = default;
+
+ protected:
+  MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  // Builds a loop that loads {type} elements indexed by a counter that is
+  // incremented by {step}.
+  void BuildLoop(ExternalArrayType type, int32_t step) {
+    Node* p0 = Parameter(0);
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* branch = graph()->NewNode(common()->Branch(), p0, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    Node* exit = graph()->NewNode(common()->LoopExit(), if_false, loop);
+    loop->ReplaceInput(1, if_true);
+
+    Node* base = Int32Constant(0);
+    Node* phi = graph()->NewNode(
+        common()->Phi(MachineRepresentation::kWord32, 2), base, base, loop);
+    Node* add =
+        graph()->NewNode(machine()->Int32Add(), phi, Int32Constant(step));
+    phi->ReplaceInput(1, add);
+    Node* effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    Node* load = graph()->NewNode(simplified()->LoadTypedElement(type), p0, p0,
+                                  p0, phi, effect_phi, if_true);
+    effect_phi->ReplaceInput(1, load);
+
+    Node* zero = Int32Constant(0);
+    Node* ret =
+        graph()->NewNode(common()->Return(), zero, phi, effect_phi, exit);
+    graph()->SetEnd(ret);
+  }
+
+  const ZoneVector<VectorizationAnalysis::Candidate>& Analyze() {
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(graph(), tick_counter(), zone());
+    VectorizationAnalysis* analysis =
+        zone()->New<VectorizationAnalysis>(loop_tree, zone());
+    analysis->Run();
+    return analysis->candidates();
+  }
+
+ private:
+  MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
+};
+
+TEST_F(VectorizationAnalysisTest, UnitStrideFloat64Loads) {
+  BuildLoop(kExternalFloat64Array, 1);
+  const auto& candidates = Analyze();
+  ASSERT_EQ(1u, candidates.size());
+  EXPECT_EQ(kExternalFloat64Array, candidates[0].element_type);
+  EXPECT_EQ(1, candidates[0].loads);
+  EXPECT_EQ(0, candidates[0].stores);
+}
+
+TEST_F(VectorizationAnalysisTest, NonUnitStride) {
+  BuildLoop(kExternalFloat64Array, 2);
+  EXPECT_TRUE(Analyze().empty());
+}
+
+TEST_F(VectorizationAnalysisTest, UnsupportedElementType) {
+  BuildLoop(kExternalUint8Array, 1);
+  EXPECT_TRUE(Analyze().empty());
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,152 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/cppgc/concurrent-marker.h"
+
+#include "include/cppgc/allocation.h"
+#include "include/cppgc/member.h"
+#include "include/cppgc/persistent.h"
+#include "src/heap/cppgc/heap-object-header.h"
+#include "src/heap/cppgc/marker.h"
+#include "src/heap/cppgc/stats-collector.h"
+#include "test/unittests/heap/cppgc/tests.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace cppgc {
+namespace internal {
+
+namespace {
+
+class ConcurrentMarkingTest : public testing::TestWithHeap {
+ public:
+  using Config = Heap::Config;
+  static constexpr Config ConcurrentPreciseConfig = {
+      Config::CollectionType::kMajor, Config::StackState::kNoHeapPointers,
+      Config::MarkingType::kIncrementalAndConcurrent,
+      Config::SweepingType::kAtomic};
+
+  void StartConcurrentGC() {
+    Heap* heap = Heap::From(GetHeap());
+    heap->StartIncrementalGarbageCollection(ConcurrentPreciseConfig);
+  }
+
+  void FinishConcurrentGC() {
+    Heap* heap = Heap::From(GetHeap());
+    heap->FinalizeIncrementalGarbageCollectionIfRunning(
+        ConcurrentPreciseConfig);
+  }
+
+  MarkerBase* marker() { return Heap::From(GetHeap())->marker(); }
+};
+
+// static
+constexpr ConcurrentMarkingTest::Config
+    ConcurrentMarkingTest::ConcurrentPreciseConfig;
+
+class GCed : public GarbageCollected<GCed> {
+ public:
+  void SetChild(GCed* child) { child_ = child; }
+  GCed* child() const { return child_.Get(); }
+  void Trace(cppgc::Visitor* visitor) const { visitor->Trace(child_); }
+
+ private:
+  Member<GCed> child_;
+};
+
+template <typename T>
+V8_NOINLINE T access(volatile const T& t) {
+  return t;
+}
+
+constexpr size_t kChainLength = 10000;
+
+}  // namespace
+
+TEST_F(ConcurrentMarkingTest, MarkingObjectsOnBackgroundThread) {
+  Persistent<GCed> root = MakeGarbageCollected<GCed>(GetAllocationHandle());
+  GCed* last = root.Get();
+  for (size_t i = 0; i < kChainLength; ++i) {
+    GCed* next = MakeGarbageCollected<GCed>(GetAllocationHandle());
+    last->SetChild(next);
+    last = next;
+  }
+  StartConcurrentGC();
+  // Wait for the concurrent marker to exhaust the worklist.
+  GetPlatform().WaitAllBackgroundTasks();
+  EXPECT_TRUE(HeapObjectHeader::FromPayload(last).IsMarked());
+  EXPECT_LT(0u, marker()->ConcurrentMarkerForTesting()
+                    .concurrently_marked_bytes());
+  FinishConcurrentGC();
+}
+
+TEST_F(ConcurrentMarkingTest, MarkedBytesIncludeConcurrentlyMarkedObjects) {
+  Persistent<GCed> root = MakeGarbageCollected<GCed>(GetAllocationHandle());
+  GCed* last = root.Get();
+  for (size_t i = 0; i < kChainLength; ++i) {
+    GCed* next = MakeGarbageCollected<GCed>(GetAllocationHandle());
+    last->SetChild(next);
+    last = next;
+  }
+  PreciseGC();
+  // After a GC with atomic sweeping the allocated object size equals the
+  // marked bytes.
+  const size_t atomically_marked_bytes =
+      Heap::From(GetHeap())->stats_collector()->allocated_object_size();
+  StartConcurrentGC();
+  GetPlatform().WaitAllBackgroundTasks();
+  FinishConcurrentGC();
+  EXPECT_EQ(atomically_marked_bytes,
+            Heap::From(GetHeap())->stats_collector()->allocated_object_size());
+}
+
+TEST_F(ConcurrentMarkingTest, WriteBarrierKeepsNewObjectAlive) {
+  Persistent<GCed> root = MakeGarbageCollected<GCed>(GetAllocationHandle());
+  GCed* last = root.Get();
+  for (size_t i = 0; i < kChainLength; ++i) {
+    GCed* next = MakeGarbageCollected<GCed>(GetAllocationHandle());
+    last->SetChild(next);
+    last = next;
+  }
+  StartConcurrentGC();
+  GetPlatform().WaitAllBackgroundTasks();
+  ASSERT_TRUE(HeapObjectHeader::FromPayload(last).IsMarked());
+  // |last| has already been traced, so |object| is only found through the
+  // write barrier.
+  GCed* object = MakeGarbageCollected<GCed>(GetAllocationHandle());
+  last->SetChild(object);
+  FinishConcurrentGC();
+  // Unreachable objects are turned into free list entries by sweeping.
+  EXPECT_FALSE(HeapObjectHeader::FromPayload(access(object)).IsFree());
+}
+
+TEST_F(ConcurrentMarkingTest, ParallelMarkingInAtomicPause) {
+  Persistent<GCed> root = MakeGarbageCollected<GCed>(GetAllocationHandle());
+  GCed* last = root.Get();
+  for (size_t i = 0; i < kChainLength; ++i) {
+    GCed* next = MakeGarbageCollected<GCed>(GetAllocationHandle());
+    last->SetChild(next);
+    last = next;
+  }
+  using MarkingConfig = Marker::MarkingConfig;
+  const MarkingConfig config = {MarkingConfig::CollectionType::kMajor,
+                                MarkingConfig::StackState::kNoHeapPointers,
+                                MarkingConfig::MarkingType::kAtomic};
+  auto* heap = Heap::From(GetHeap());
+  Marker marker(heap->AsBase());
+  marker.StartMarking(config);
+  marker.EnterAtomicPause(config);
+  EXPECT_TRUE(marker.AdvanceMarkingInParallel());
+  EXPECT_FALSE(marker.ConcurrentMarkerForTesting().IsActive());
+  EXPECT_TRUE(HeapObjectHeader::FromPayload(last).IsMarked());
+  EXPECT_LT(0u,
+            marker.ConcurrentMarkerForTesting().concurrently_marked_bytes());
+  marker.LeaveAtomicPause();
+  marker.ProcessWeakness();
+  // Pretend to finish sweeping as StatsCollector verifies that Notify*
+  // methods are called in the right order.
+  heap->stats_collector()->NotifySweepingCompleted();
+}
+
+}  // namespace internal
+}  // namespace cppgc
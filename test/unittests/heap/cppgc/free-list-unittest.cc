@@ -183,5 +183,27 @@ TEST(FreeListTest, Allocate) {
   EXPECT_EQ(0u, empty_block.size);
 }
 
+TEST(FreeListTest, AllocateChecksOnlyFirstEntryOfBiggestBucket) {
+  // Both blocks fall into the bucket for sizes [64, 128).
+  Block small_block(64);
+  Block big_block(96);
+  FreeList list;
+  list.Add({big_block.Address(), big_block.Size()});
+  list.Add({small_block.Address(), small_block.Size()});
+
+  // The head of the biggest bucket is too small and smaller buckets cannot
+  // service the allocation, so the list bails out instead of searching.
+  const auto failed = list.Allocate(80);
+  EXPECT_EQ(nullptr, failed.address);
+
+  // Allocations guaranteed to fit any entry of the bucket are served from its
+  // head.
+  const auto result = list.Allocate(64);
+  EXPECT_EQ(small_block.Address(), result.address);
+  const auto next = list.Allocate(80);
+  EXPECT_EQ(big_block.Address(), next.address);
+  EXPECT_TRUE(list.IsEmpty());
+}
+
 }  // namespace internal
 }  // namespace cppgc
@@ -94,5 +94,20 @@ TEST(GCInvokerTest, ConservativeGCIsInvokedAsPreciseGCViaPlatform) {
   invoker.CollectGarbage(GarbageCollector::Config::ConservativeAtomicConfig());
 }
 
+TEST(GCInvokerTest, MinorConservativeGCIsAlwaysInvokedViaPlatform) {
+  std::shared_ptr<cppgc::TaskRunner> runner =
+      std::shared_ptr<cppgc::TaskRunner>(new MockTaskRunner());
+  MockPlatform platform(runner);
+  MockGarbageCollector gc;
+  GCInvoker invoker(&gc, &platform,
+                    cppgc::Heap::StackSupport::kSupportsConservativeStackScan);
+  EXPECT_CALL(gc, epoch).WillOnce(::testing::Return(0));
+  EXPECT_CALL(gc, CollectGarbage(::testing::_)).Times(0);
+  EXPECT_CALL(*static_cast<MockTaskRunner*>(runner.get()),
+              PostNonNestableTask(::testing::_));
+  invoker.CollectGarbage(
+      GarbageCollector::Config::MinorConservativeAtomicConfig());
+}
+
 }  // namespace internal
 }  // namespace cppgc
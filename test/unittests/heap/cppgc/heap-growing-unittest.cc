@@ -106,5 +106,36 @@ TEST(HeapGrowingTest, SmallHeapGrowing) {
   EXPECT_EQ(1 + HeapGrowing::kMinLimitIncrease, growing.limit());
 }
 
+#if defined(CPPGC_YOUNG_GENERATION)
+TEST(HeapGrowingTest, MinorGCInvokedBeforeMajorGC) {
+  constexpr size_t kObjectSize = 10 * HeapGrowing::kMinLimitIncrease;
+  StatsCollector stats_collector;
+  MockGarbageCollector gc;
+  cppgc::Heap::ResourceConstraints constraints;
+  constraints.initial_heap_size_bytes = kObjectSize;
+  HeapGrowing growing(&gc, &stats_collector, constraints);
+  EXPECT_LT(growing.minor_limit(), growing.limit());
+  EXPECT_CALL(gc, CollectGarbage(::testing::Field(
+                      &GarbageCollector::Config::collection_type,
+                      GarbageCollector::Config::CollectionType::kMinor)));
+  FakeAllocate(&stats_collector, growing.minor_limit() + 1);
+}
+
+TEST(HeapGrowingTest, MinorGCKeepsMajorLimit) {
+  constexpr size_t kObjectSize = 10 * HeapGrowing::kMinLimitIncrease;
+  StatsCollector stats_collector;
+  cppgc::Heap::ResourceConstraints constraints;
+  constraints.initial_heap_size_bytes = kObjectSize;
+  MockGarbageCollector gc;
+  HeapGrowing growing(&gc, &stats_collector, constraints);
+  const size_t limit = growing.limit();
+  stats_collector.NotifyMarkingStarted(StatsCollector::CollectionType::kMinor);
+  stats_collector.NotifyMarkingCompleted(kObjectSize);
+  stats_collector.NotifySweepingCompleted();
+  EXPECT_EQ(limit, growing.limit());
+  EXPECT_LT(kObjectSize, growing.minor_limit());
+}
+#endif  // defined(CPPGC_YOUNG_GENERATION)
+
 }  // namespace internal
 }  // namespace cppgc
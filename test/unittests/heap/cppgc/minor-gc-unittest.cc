@@ -190,6 +190,23 @@ TYPED_TEST(MinorGCTestForType, InterGenerationalPointerForDifferentPageTypes) {
       this, this->GetHeap());
 }
 
+TYPED_TEST(MinorGCTestForType, RememberedSlotOverwrittenAfterBarrier) {
+  using Type = typename TestFixture::Type;
+
+  Persistent<Type> old =
+      MakeGarbageCollected<Type>(this->GetAllocationHandle());
+  TestFixture::CollectMinor();
+  EXPECT_FALSE(HeapObjectHeader::FromPayload(old.Get()).IsYoung());
+
+  old->next = MakeGarbageCollected<Type>(this->GetAllocationHandle());
+  EXPECT_FALSE(Heap::From(this->GetHeap())->remembered_slots().empty());
+
+  // The recorded slot now holds nullptr and must be skipped by the minor GC.
+  old->next = nullptr;
+  TestFixture::CollectMinor();
+  EXPECT_EQ(1u, TestFixture::DestructedObjects());
+}
+
 TYPED_TEST(MinorGCTestForType, OmitGenerationalBarrierForOnStackObject) {
   using Type = typename TestFixture::Type;
 
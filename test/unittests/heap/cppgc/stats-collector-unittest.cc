@@ -47,6 +47,17 @@ TEST_F(StatsCollectorTest, EventPrevGCMarkedObjectSize) {
   EXPECT_EQ(1024u, event.marked_bytes);
 }
 
+TEST_F(StatsCollectorTest, MinorGCAccountsOldGenerationMarkedBytes) {
+  stats.NotifyMarkingStarted();
+  stats.NotifyMarkingCompleted(1024);
+  stats.NotifySweepingCompleted();
+  stats.NotifyMarkingStarted(StatsCollector::CollectionType::kMinor);
+  stats.NotifyMarkingCompleted(512);
+  auto event = stats.NotifySweepingCompleted();
+  EXPECT_EQ(StatsCollector::CollectionType::kMinor, event.collection_type);
+  EXPECT_EQ(1536u, event.marked_bytes);
+}
+
 TEST_F(StatsCollectorTest, AllocationNoReportBelowAllocationThresholdBytes) {
   constexpr size_t kObjectSize = 17;
   EXPECT_LT(kObjectSize, StatsCollector::kAllocationThresholdBytes);
@@ -108,5 +108,37 @@ TEST_F(MemoryControllerTest, OldGenerationAllocationLimit) {
           new_space_capacity, factor, Heap::HeapGrowingMode::kMinimal));
 }
 
+TEST_F(MemoryControllerTest, NewSpaceCapacity) {
+  Heap* heap = i_isolate()->heap();
+  const size_t current = 4 * MB;
+  const size_t min_capacity = 1 * MB;
+  const size_t max_capacity = 16 * MB;
+  const double speed = MB;
+  const double step = 2;
+
+  // Without speed information the capacity is not changed.
+  EXPECT_EQ(current, NewSpaceController::CalculateCapacity(
+                         heap, current, min_capacity, max_capacity, 10, 0, 1,
+                         step));
+  // 5 MB with 25% survival takes 1.25 ms at 1 MB/ms.
+  EXPECT_EQ(5 * MB, NewSpaceController::CalculateCapacity(
+                        heap, current, min_capacity, max_capacity, 25, speed,
+                        1.25, step));
+  // Growing and shrinking is limited by the step factor.
+  EXPECT_EQ(8 * MB, NewSpaceController::CalculateCapacity(
+                        heap, current, min_capacity, max_capacity, 1, speed,
+                        1, step));
+  EXPECT_EQ(2 * MB, NewSpaceController::CalculateCapacity(
+                        heap, current, min_capacity, max_capacity, 100, speed,
+                        0.1, step));
+  // The capacity stays within the given bounds.
+  EXPECT_EQ(max_capacity, NewSpaceController::CalculateCapacity(
+                              heap, max_capacity, min_capacity, max_capacity,
+                              0, speed, 10, step));
+  EXPECT_EQ(min_capacity, NewSpaceController::CalculateCapacity(
+                              heap, min_capacity, min_capacity, max_capacity,
+                              100, speed, 0.01, step));
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -137,6 +137,27 @@ TEST_F(HeapTest, ExternalLimitStaysAboveDefaultForExplicitHandling) {
             kExternalAllocationSoftLimit);
 }
 
+TEST_F(HeapTest, GCPauseBudget) {
+  Heap* heap = i_isolate()->heap();
+  const double saved_scavenge_target = FLAG_scavenge_target_pause_ms;
+  const double saved_compaction_budget = FLAG_compaction_pause_budget_ms;
+  FLAG_scavenge_target_pause_ms = 0.0;
+  FLAG_compaction_pause_budget_ms = 4.0;
+  v8_isolate()->SetGCPauseBudget(2.0, 1.5);
+  EXPECT_EQ(2.0, heap->gc_pause_budget_ms());
+  // The utilization target is clamped to [0, 1].
+  EXPECT_EQ(1.0, heap->mutator_utilization_target());
+  // The stricter of the embedder's budget and the flags applies.
+  EXPECT_EQ(2.0, heap->ScavengeTargetPauseMs());
+  EXPECT_EQ(2.0, heap->CompactionPauseBudgetMs());
+  v8_isolate()->SetGCPauseBudget(0.0, 0.0);
+  EXPECT_EQ(0.0, heap->ScavengeTargetPauseMs());
+  EXPECT_EQ(4.0, heap->CompactionPauseBudgetMs());
+  EXPECT_FALSE(heap->IsBelowMutatorUtilizationTarget());
+  FLAG_scavenge_target_pause_ms = saved_scavenge_target;
+  FLAG_compaction_pause_budget_ms = saved_compaction_budget;
+}
+
 #if V8_TARGET_ARCH_64_BIT
 TEST_F(HeapWithPointerCompressionTest, HeapLayout) {
   // Produce some garbage.
@@ -138,6 +138,65 @@ TEST_F(SafepointTest, StopRunningThreads) {
   CHECK_EQ(safepoint_count, kRuns * kSafepoints);
 }
 
+class ParkingThread final : public v8::base::Thread {
+ public:
+  ParkingThread(Heap* heap, std::atomic<int>* counter)
+      : v8::base::Thread(base::Thread::Options("ThreadWithLocalHeap")),
+        heap_(heap),
+        counter_(counter) {}
+
+  void Run() override {
+    LocalHeap local_heap(heap_);
+
+    for (int i = 0; i < kRuns; i++) {
+      counter_->fetch_add(1);
+      if (i % 3 == 0) {
+        ParkedScope scope(&local_heap);
+      } else if (i % 100 == 0) {
+        local_heap.Safepoint();
+      }
+    }
+  }
+
+  Heap* heap_;
+  std::atomic<int>* counter_;
+};
+
+TEST_F(SafepointTest, StopParkingThreads) {
+  Heap* heap = i_isolate()->heap();
+  FLAG_local_heaps = true;
+
+  const int kThreads = 10;
+  const int kSafepoints = 100;
+  int safepoint_count = 0;
+
+  std::atomic<int> counter(0);
+  std::vector<ParkingThread*> threads;
+
+  for (int i = 0; i < kThreads; i++) {
+    ParkingThread* thread = new ParkingThread(heap, &counter);
+    CHECK(thread->Start());
+    threads.push_back(thread);
+  }
+
+  for (int i = 0; i < kSafepoints; i++) {
+    SafepointScope scope(heap);
+    // No thread may run while the safepoint is active.
+    int count = counter.load();
+    base::OS::Sleep(base::TimeDelta::FromMicroseconds(10));
+    CHECK_EQ(count, counter.load());
+    safepoint_count++;
+  }
+
+  for (ParkingThread* thread : threads) {
+    thread->Join();
+    delete thread;
+  }
+
+  CHECK_EQ(safepoint_count, kSafepoints);
+  CHECK_EQ(kThreads * kRuns, counter.load());
+}
+
 TEST_F(SafepointTest, SkipLocalHeapOfThisThread) {
   Heap* heap = i_isolate()->heap();
   FLAG_local_heaps = true;
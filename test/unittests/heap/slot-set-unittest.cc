@@ -75,6 +75,26 @@ TEST(SlotSet, InsertAndLookup2) {
   SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
 }
 
+TEST(SlotSet, CountSlotsAndMemoryUsage) {
+  SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
+  const size_t empty_size = set->MemoryUsage(SlotSet::kBucketsRegularPage);
+  EXPECT_EQ(0u, set->CountSlots(SlotSet::kBucketsRegularPage));
+
+  // Two slots in the first bucket and one in the last bucket.
+  const int kBucketSize = SlotSet::kBitsPerBucket * kTaggedSize;
+  set->Insert<AccessMode::ATOMIC>(0);
+  set->Insert<AccessMode::ATOMIC>(kTaggedSize);
+  set->Insert<AccessMode::ATOMIC>(Page::kPageSize - kTaggedSize);
+  EXPECT_EQ(3u, set->CountSlots(SlotSet::kBucketsRegularPage));
+  EXPECT_EQ(empty_size + 2 * sizeof(SlotSet::Bucket),
+            set->MemoryUsage(SlotSet::kBucketsRegularPage));
+
+  set->RemoveRange(0, kBucketSize, SlotSet::kBucketsRegularPage,
+                   SlotSet::FREE_EMPTY_BUCKETS);
+  EXPECT_EQ(1u, set->CountSlots(SlotSet::kBucketsRegularPage));
+  SlotSet::Delete(set, SlotSet::kBucketsRegularPage);
+}
+
 TEST(SlotSet, Iterate) {
   SlotSet* set = SlotSet::Allocate(SlotSet::kBucketsRegularPage);
 
@@ -4,6 +4,10 @@
 
 #include "src/heap/worklist.h"
 
+#include <atomic>
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/platform.h"
 #include "test/unittests/test-utils.h"
 
 namespace v8 {
@@ -342,5 +346,122 @@ TEST(WorkListTest, MergeGlobalPool) {
   EXPECT_TRUE(worklist2.IsEmpty());
 }
 
+TEST(WorkListTest, StealStatistics) {
+  TestWorklist worklist;
+  TestWorklist::View worklist_view1(&worklist, 0);
+  TestWorklist::View worklist_view2(&worklist, 1);
+  SomeObject dummy;
+  for (size_t i = 0; i < TestWorklist::kSegmentCapacity; i++) {
+    EXPECT_TRUE(worklist_view1.Push(&dummy));
+  }
+  worklist_view1.FlushToGlobal();
+  SomeObject* retrieved = nullptr;
+  EXPECT_TRUE(worklist_view2.Pop(&retrieved));
+  EXPECT_EQ(0U, worklist_view1.StealCount());
+  EXPECT_EQ(1U, worklist_view2.StealCount());
+  // Taking back an own segment from the global pool is not a steal.
+  EXPECT_TRUE(worklist_view2.Push(&dummy));
+  worklist_view2.FlushToGlobal();
+  while (worklist_view2.Pop(&retrieved)) {
+  }
+  EXPECT_EQ(1U, worklist_view2.StealCount());
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
+TEST(WorkListTest, GlobalPoolGrows) {
+  // Publish more segments than a task deque initially holds.
+  const size_t kNumSegments = 100;
+  TestWorklist worklist;
+  TestWorklist::View worklist_view1(&worklist, 0);
+  TestWorklist::View worklist_view2(&worklist, 1);
+  SomeObject dummy;
+  for (size_t i = 0; i < kNumSegments * TestWorklist::kSegmentCapacity; i++) {
+    EXPECT_TRUE(worklist_view1.Push(&dummy));
+  }
+  worklist_view1.FlushToGlobal();
+  EXPECT_EQ(kNumSegments, worklist.GlobalPoolSize());
+  size_t count = 0;
+  SomeObject* retrieved = nullptr;
+  while (worklist_view2.Pop(&retrieved)) {
+    EXPECT_EQ(&dummy, retrieved);
+    count++;
+  }
+  EXPECT_EQ(kNumSegments * TestWorklist::kSegmentCapacity, count);
+  EXPECT_EQ(kNumSegments, worklist_view2.StealCount());
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
+namespace {
+
+using StressWorklist = Worklist<int, 64>;
+
+// Processes a binary tree of work items: popping an item of depth d > 0
+// pushes two items of depth d - 1. Only task 0 is seeded, so the other tasks
+// have to steal to participate.
+class StealingThread final : public base::Thread {
+ public:
+  StealingThread(StressWorklist* worklist, int task_id,
+                 std::atomic<size_t>* remaining)
+      : base::Thread(Options("StealingThread")),
+        view_(worklist, task_id),
+        remaining_(remaining) {}
+
+  void Run() final {
+    int depth;
+    while (remaining_->load(std::memory_order_relaxed) > 0) {
+      if (!view_.Pop(&depth)) continue;
+      if (depth > 0) {
+        view_.Push(depth - 1);
+        view_.Push(depth - 1);
+      }
+      if (view_.IsGlobalPoolEmpty()) view_.FlushToGlobal();
+      processed_++;
+      remaining_->fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  size_t processed() const { return processed_; }
+  size_t steals() const { return view_.StealCount(); }
+
+ private:
+  StressWorklist::View view_;
+  std::atomic<size_t>* remaining_;
+  size_t processed_ = 0;
+};
+
+}  // namespace
+
+// Doubles as a micro-benchmark for contention on the global pool. The
+// elapsed time and the number of steals are recorded as test properties.
+TEST(WorkListTest, ConcurrentStealing) {
+  const int kNumTasks = 4;
+  const int kDepth = 17;
+  const size_t kTotal = (size_t{1} << (kDepth + 1)) - 1;
+  StressWorklist worklist(kNumTasks);
+  std::atomic<size_t> remaining{kTotal};
+  std::unique_ptr<StealingThread> threads[kNumTasks];
+  for (int i = 0; i < kNumTasks; i++) {
+    threads[i].reset(new StealingThread(&worklist, i, &remaining));
+  }
+  StressWorklist::View(&worklist, 0).Push(kDepth);
+  base::ElapsedTimer timer;
+  timer.Start();
+  for (int i = 0; i < kNumTasks; i++) {
+    EXPECT_TRUE(threads[i]->Start());
+  }
+  size_t processed = 0;
+  size_t steals = 0;
+  for (int i = 0; i < kNumTasks; i++) {
+    threads[i]->Join();
+    processed += threads[i]->processed();
+    steals += threads[i]->steals();
+  }
+  ::testing::Test::RecordProperty(
+      "time_us", static_cast<int>(timer.Elapsed().InMicroseconds()));
+  ::testing::Test::RecordProperty("steals", static_cast<int>(steals));
+  EXPECT_EQ(kTotal, processed);
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -275,5 +275,78 @@ TEST(DefaultWorkerThreadsTaskRunnerUnittest, NoIdleTasks) {
   runner.Terminate();
 }
 
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskPriorities) {
+  DefaultWorkerThreadsTaskRunner runner(1, RealTime);
+
+  std::vector<int> order;
+  base::Semaphore blocker_semaphore(0);
+  base::Semaphore done_semaphore(0);
+
+  // Keep the only worker busy until all tasks are posted.
+  runner.PostTask(
+      std::make_unique<TestTask>([&] { blocker_semaphore.Wait(); }));
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(1); }),
+                  TaskPriority::kBestEffort);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(2); }),
+                  TaskPriority::kUserVisible);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(3); }),
+                  TaskPriority::kUserBlocking);
+  runner.PostTask(std::make_unique<TestTask>([&] { order.push_back(4); }),
+                  TaskPriority::kUserBlocking);
+  runner.PostTask(std::make_unique<TestTask>([&] { done_semaphore.Signal(); }),
+                  TaskPriority::kBestEffort);
+  blocker_semaphore.Signal();
+  done_semaphore.Wait();
+
+  runner.Terminate();
+  ASSERT_EQ(4UL, order.size());
+  ASSERT_EQ(3, order[0]);
+  ASSERT_EQ(4, order[1]);
+  ASSERT_EQ(2, order[2]);
+  ASSERT_EQ(1, order[3]);
+}
+
+// Posts many tasks from several threads at once, as parallel marking,
+// concurrent sweeping and background compilation do.
+TEST(DefaultWorkerThreadsTaskRunnerUnittest, PostTaskFromManyThreads) {
+  static constexpr int kNumWorkers = 8;
+  static constexpr int kNumPosters = 4;
+  static constexpr int kTasksPerPoster = 10000;
+  DefaultWorkerThreadsTaskRunner runner(kNumWorkers, RealTime);
+
+  std::atomic_int count{0};
+
+  class PosterThread : public base::Thread {
+   public:
+    PosterThread(DefaultWorkerThreadsTaskRunner* runner, std::atomic_int* count)
+        : Thread(Options("PosterThread")), runner_(runner), count_(count) {}
+
+    void Run() override {
+      for (int i = 0; i < kTasksPerPoster; ++i) {
+        std::atomic_int* count = count_;
+        runner_->PostTask(std::make_unique<TestTask>([count] { (*count)++; }),
+                          static_cast<TaskPriority>(i % 3));
+      }
+    }
+
+   private:
+    DefaultWorkerThreadsTaskRunner* runner_;
+    std::atomic_int* count_;
+  };
+
+  std::vector<std::unique_ptr<PosterThread>> posters;
+  for (int i = 0; i < kNumPosters; ++i) {
+    posters.push_back(std::make_unique<PosterThread>(&runner, &count));
+    ASSERT_TRUE(posters.back()->Start());
+  }
+  for (auto& poster : posters) poster->Join();
+
+  while (count != kNumPosters * kTasksPerPoster) {
+  }
+
+  runner.Terminate();
+  ASSERT_EQ(kNumPosters * kTasksPerPoster, count);
+}
+
 }  // namespace platform
 }  // namespace v8
@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <map>
+#include <string>
+#include <utility>
 #include <vector>
 
 #include "src/api/api-inl.h"
@@ -572,6 +575,55 @@ TEST_F(RuntimeCallStatsTest, NestedScopes) {
   EXPECT_EQ(100, counter3()->time().InMicroseconds());
 }
 
+TEST_F(RuntimeCallStatsTest, SampledScopes) {
+  int sampling_interval = FLAG_rcs_sampling_interval;
+  FLAG_rcs_sampling_interval = 3;
+  for (int i = 0; i < 5; i++) {
+    RuntimeCallTimerScope scope(stats(), counter_id());
+    Sleep(100);
+    {
+      RuntimeCallTimerScope scope(stats(), counter_id2());
+      Sleep(50);
+    }
+    // Printing snapshots the measured timers only.
+    std::ostringstream out;
+    stats()->Print(out);
+  }
+  {
+    // Scopes outside of a measured stack are neither counted nor timed.
+    RuntimeCallTimerScope scope(stats(), counter_id3());
+    Sleep(50);
+  }
+  FLAG_rcs_sampling_interval = sampling_interval;
+
+  // The first and the fourth stack of scopes were measured, with exact own
+  // times.
+  EXPECT_EQ(2, counter()->count());
+  EXPECT_EQ(2, counter2()->count());
+  EXPECT_EQ(0, counter3()->count());
+  EXPECT_EQ(200, counter()->time().InMicroseconds());
+  EXPECT_EQ(100, counter2()->time().InMicroseconds());
+  EXPECT_EQ(0, counter3()->time().InMicroseconds());
+}
+
+TEST_F(RuntimeCallStatsTest, GetRuntimeCallStats) {
+  {
+    RuntimeCallTimerScope scope(stats(), counter_id());
+    Sleep(50);
+  }
+  std::map<std::string, std::pair<int64_t, int64_t>> entries;
+  auto callback = [](const char* name, int64_t count, int64_t time_in_us,
+                     void* data) {
+    auto* entries =
+        static_cast<std::map<std::string, std::pair<int64_t, int64_t>>*>(data);
+    (*entries)[name] = std::make_pair(count, time_in_us);
+  };
+  EXPECT_TRUE(v8_isolate()->GetRuntimeCallStats(callback, &entries));
+  EXPECT_EQ(std::make_pair(int64_t{1}, int64_t{50}),
+            entries[counter()->name()]);
+  EXPECT_EQ(0u, entries.count(counter2()->name()));
+}
+
 TEST_F(RuntimeCallStatsTest, BasicJavaScript) {
   RuntimeCallCounter* counter =
       stats()->GetCounter(RuntimeCallCounterId::kJS_Execution);
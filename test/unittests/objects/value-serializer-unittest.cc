@@ -972,6 +972,42 @@ TEST_F(ValueSerializerTest, RoundTripArray) {
   ExpectScriptTrue("result.hasOwnProperty(1)");
 }
 
+TEST_F(ValueSerializerTest, RoundTripPackedNumberArrays) {
+  auto elements_kind = [](Local<Value> value) {
+    return i::Handle<i::JSArray>::cast(Utils::OpenHandle(*value))
+        ->GetElementsKind();
+  };
+
+  // Arrays of numbers are decoded with packed number elements.
+  Local<Value> value = RoundTripTest("[1, -2, 1073741823, -1073741824]");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(i::PACKED_SMI_ELEMENTS, elements_kind(value));
+  ExpectScriptTrue("result.toString() === '1,-2,1073741823,-1073741824'");
+
+  value = RoundTripTest("[1, 2.5, -0, NaN, 2147483647]");
+  ASSERT_TRUE(value->IsArray());
+  EXPECT_EQ(i::PACKED_DOUBLE_ELEMENTS, elements_kind(value));
+  ExpectScriptTrue("result.length === 5");
+  ExpectScriptTrue("result[1] === 2.5 && Object.is(result[2], -0)");
+  ExpectScriptTrue("Number.isNaN(result[3]) && result[4] === 2147483647");
+
+  // Properties are still restored.
+  value = RoundTripTest("var y = [1.5, 2]; y.foo = 'bar'; y;");
+  EXPECT_EQ(i::PACKED_DOUBLE_ELEMENTS, elements_kind(value));
+  ExpectScriptTrue("result.toString() === '1.5,2' && result.foo === 'bar'");
+
+  // Other elements use the generic path, even after leading numbers.
+  value = RoundTripTest("[1, 2, 'three']");
+  ExpectScriptTrue("result.toString() === '1,2,three'");
+  value = RoundTripTest("var y = [1, 2, {}]; y[2].self = y; y;");
+  ExpectScriptTrue("result[2].self === result");
+
+  // The encoding of packed number arrays is unchanged.
+  const std::vector<uint8_t> expected = {0xFF, 0x0D, 0x41, 0x02, 0x49, 0x02,
+                                         0x49, 0x01, 0x24, 0x00, 0x02};
+  EXPECT_EQ(expected, EncodeTest("[1, -1]"));
+}
+
 TEST_F(ValueSerializerTest, DecodeArray) {
   // A simple array of integers.
   Local<Value> value =
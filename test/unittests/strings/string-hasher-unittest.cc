@@ -0,0 +1,97 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "src/base/platform/elapsed-timer.h"
+#include "src/strings/string-hasher-inl.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const uint64_t kSeed = 0x1234'5678'9ABC'DEF0;
+
+template <typename Char>
+uint32_t Hash(const std::vector<Char>& chars, uint64_t seed = kSeed) {
+  return StringHasher::HashSequentialString(
+      chars.data(), static_cast<int>(chars.size()), seed);
+}
+
+std::vector<uint8_t> OneByteString(int length) {
+  std::vector<uint8_t> chars(length);
+  for (int i = 0; i < length; i++) chars[i] = 'a' + (i * 7) % 26;
+  return chars;
+}
+
+std::vector<uint16_t> ToTwoByte(const std::vector<uint8_t>& chars) {
+  return std::vector<uint16_t>(chars.begin(), chars.end());
+}
+
+}  // namespace
+
+TEST(StringHasherTest, OneAndTwoByteHashEqually) {
+  for (int length = 1; length < 3 * StringHasher::kMinBlockHashLength;
+       length++) {
+    std::vector<uint8_t> one_byte = OneByteString(length);
+    one_byte.back() = 0xE9;
+    EXPECT_EQ(Hash(one_byte), Hash(ToTwoByte(one_byte))) << length;
+  }
+}
+
+TEST(StringHasherTest, HashDependsOnEveryCharacter) {
+  std::vector<uint8_t> chars =
+      OneByteString(2 * StringHasher::kMinBlockHashLength + 3);
+  uint32_t hash = Hash(chars);
+  for (size_t i = 0; i < chars.size(); i++) {
+    std::vector<uint8_t> changed = chars;
+    changed[i] ^= 1;
+    EXPECT_NE(hash, Hash(changed)) << i;
+  }
+}
+
+TEST(StringHasherTest, HashDependsOnSeedAndLength) {
+  std::vector<uint8_t> chars(StringHasher::kMinBlockHashLength, 0);
+  EXPECT_NE(Hash(chars, 1), Hash(chars, 2));
+  EXPECT_NE(Hash(chars, uint64_t{1} << 40), Hash(chars, uint64_t{1} << 41));
+  std::vector<uint8_t> longer(StringHasher::kMinBlockHashLength + 8, 0);
+  EXPECT_NE(Hash(chars), Hash(longer));
+}
+
+TEST(StringHasherTest, NonIndexHashBits) {
+  // Long digit strings are neither array nor integer indices.
+  std::vector<uint8_t> digits(StringHasher::kMinBlockHashLength, '1');
+  uint32_t hash = Hash(digits);
+  EXPECT_NE(0u, hash & String::kIsNotIntegerIndexMask);
+  EXPECT_FALSE(Name::ContainsCachedArrayIndex(hash));
+  EXPECT_NE(0u, hash >> Name::kHashShift);
+
+  std::vector<uint8_t> index = {'1', '2', '3'};
+  EXPECT_EQ(StringHasher::MakeArrayIndexHash(123, 3), Hash(index));
+}
+
+// Measures hashing throughput for key-sized and long one-byte strings. Run
+// with --gtest_also_run_disabled_tests.
+TEST(StringHasherTest, DISABLED_Throughput) {
+  const size_t kBytesPerLength = 256 * MB;
+  for (int length : {8, 16, 32, 64, 256, 4096}) {
+    std::vector<uint8_t> chars = OneByteString(length);
+    size_t iterations = kBytesPerLength / length;
+    uint32_t sink = 0;
+    base::ElapsedTimer timer;
+    timer.Start();
+    for (size_t i = 0; i < iterations; i++) {
+      chars[0] = static_cast<uint8_t>(i);
+      sink ^= Hash(chars);
+    }
+    double seconds = timer.Elapsed().InSecondsF();
+    printf("length %5d: %8.1f MB/s (%x)\n", length,
+           kBytesPerLength / seconds / MB, sink);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
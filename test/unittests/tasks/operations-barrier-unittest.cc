@@ -0,0 +1,79 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/tasks/operations-barrier.h"
+
+#include "src/base/platform/platform.h"
+#include "src/base/platform/semaphore.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(OperationsBarrierTest, TryLockAfterCancel) {
+  OperationsBarrier barrier;
+  {
+    OperationsBarrier::Token token = barrier.TryLock();
+    EXPECT_TRUE(token);
+  }
+  barrier.CancelAndWait();
+  EXPECT_TRUE(barrier.cancelled());
+  OperationsBarrier::Token token = barrier.TryLock();
+  EXPECT_FALSE(token);
+}
+
+TEST(OperationsBarrierTest, MovedTokenReleasesOnce) {
+  OperationsBarrier barrier;
+  {
+    OperationsBarrier::Token token = barrier.TryLock();
+    OperationsBarrier::Token moved = std::move(token);
+    EXPECT_FALSE(token);
+    EXPECT_TRUE(moved);
+  }
+  // Would not return if the token was not released.
+  barrier.CancelAndWait();
+}
+
+namespace {
+
+class TokenHolderThread final : public base::Thread {
+ public:
+  TokenHolderThread(OperationsBarrier* barrier, base::Semaphore* locked,
+                    base::Semaphore* release)
+      : base::Thread(base::Thread::Options("TokenHolderThread")),
+        barrier_(barrier),
+        locked_(locked),
+        release_(release) {}
+
+  void Run() override {
+    OperationsBarrier::Token token = barrier_->TryLock();
+    EXPECT_TRUE(token);
+    locked_->Signal();
+    release_->Wait();
+  }
+
+ private:
+  OperationsBarrier* const barrier_;
+  base::Semaphore* const locked_;
+  base::Semaphore* const release_;
+};
+
+}  // namespace
+
+TEST(OperationsBarrierTest, CancelAndWaitWaitsForTokens) {
+  OperationsBarrier barrier;
+  base::Semaphore locked(0);
+  base::Semaphore release(0);
+  TokenHolderThread thread(&barrier, &locked, &release);
+  CHECK(thread.Start());
+  locked.Wait();
+  release.Signal();
+  // Returns only after the thread released its token.
+  barrier.CancelAndWait();
+  EXPECT_FALSE(barrier.TryLock());
+  thread.Join();
+}
+
+}  // namespace internal
+}  // namespace v8
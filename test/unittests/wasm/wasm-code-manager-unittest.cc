@@ -150,6 +150,18 @@ TEST_F(DisjointAllocationPoolTest, MergingSkipLargerSrcWithGap) {
   CheckPool(a, {{10, 5}, {20, 15}, {36, 4}});
 }
 
+TEST_F(DisjointAllocationPoolTest, Contains) {
+  DisjointAllocationPool a = Make({{10, 5}, {20, 5}});
+  CHECK(a.Contains({10, 5}));
+  CHECK(a.Contains({11, 3}));
+  CHECK(a.Contains({24, 1}));
+  CHECK(!a.Contains({5, 2}));
+  CHECK(!a.Contains({9, 2}));
+  CHECK(!a.Contains({14, 2}));
+  CHECK(!a.Contains({14, 7}));
+  CHECK(!a.Contains({25, 1}));
+}
+
 }  // namespace wasm_heap_unittest
 }  // namespace wasm
 }  // namespace internal
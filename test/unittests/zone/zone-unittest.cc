@@ -22,5 +22,39 @@ TEST(Zone, 8ByteAlignment) {
   }
 }
 
+TEST(Zone, SegmentsAreRecycled) {
+  AccountingAllocator allocator;
+  Address first_segment_start;
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    first_segment_start =
+        reinterpret_cast<Address>(zone.Allocate<ZoneTest>(16));
+    EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  }
+  EXPECT_EQ(0u, allocator.GetCurrentMemoryUsage());
+  EXPECT_LT(0u, allocator.GetCurrentPoolSize());
+  size_t misses = allocator.GetSegmentPoolMisses();
+  {
+    Zone zone(&allocator, ZONE_NAME);
+    EXPECT_EQ(first_segment_start,
+              reinterpret_cast<Address>(zone.Allocate<ZoneTest>(16)));
+    EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+  }
+  EXPECT_EQ(1u, allocator.GetSegmentPoolHits());
+  EXPECT_EQ(misses, allocator.GetSegmentPoolMisses());
+  allocator.ReleasePooledSegments();
+  EXPECT_EQ(0u, allocator.GetCurrentPoolSize());
+}
+
+TEST(Zone, CompressedSegmentsAreRecycled) {
+  AccountingAllocator allocator;
+  for (int i = 0; i < 3; i++) {
+    Zone zone(&allocator, ZONE_NAME, kCompressGraphZone);
+    zone.Allocate<ZoneTest>(16);
+  }
+  EXPECT_EQ(2u, allocator.GetSegmentPoolHits());
+  EXPECT_EQ(1u, allocator.GetSegmentPoolMisses());
+}
+
 }  // namespace internal
 }  // namespace v8
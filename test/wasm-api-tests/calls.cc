@@ -0,0 +1,37 @@
+// Copyright 2020 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/wasm-api-tests/wasm-api-test.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+TEST_F(WasmCapiTest, ManyCalls) {
+  // Embedders make many small calls from C++; all but the first one take the
+  // cached wrapper and signature.
+  ValueType reps[] = {kWasmI32, kWasmI32, kWasmI32};
+  FunctionSig sig(1, 2, reps);
+  byte code[] = {WASM_I32_ADD(WASM_GET_LOCAL(0), WASM_GET_LOCAL(1))};
+  AddExportedFunction(CStrVector("add"), code, sizeof(code), &sig);
+  Instantiate(nullptr);
+  Func* add = GetExportedFunction(0);
+
+  constexpr int kNumCalls = 100000;
+  int32_t sum = 0;
+  for (int i = 0; i < kNumCalls; i++) {
+    Val args[] = {Val::i32(sum), Val::i32(i & 0xff)};
+    Val results[1];
+    own<Trap> trap = add->call(args, results);
+    ASSERT_EQ(nullptr, trap);
+    sum = results[0].i32();
+  }
+  int32_t expected = 0;
+  for (int i = 0; i < kNumCalls; i++) expected += i & 0xff;
+  EXPECT_EQ(expected, sum);
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
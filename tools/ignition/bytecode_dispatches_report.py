@@ -47,6 +47,10 @@ examples:
 
   # Display the top 5 sources and destinations of dispatches to/from LdaZero
   $ tools/ignition/bytecode_dispatches_report.py -f LdaZero -n 5
+
+  # Print the hottest 20 pairs whose source dispatches to the destination
+  # at least 80% of the time
+  $ tools/ignition/bytecode_dispatches_report.py -c -a 0.8 -n 20
 """
 
 __COUNTER_BITS = struct.calcsize("P") * 8  # Size in bits of a pointer
@@ -79,6 +83,28 @@ def print_top_bytecode_dispatch_pairs(dispatches_table, top_count):
     print("{:>12d}\t{} -> {}".format(counter, source, destination))
 
 
+def find_fusion_candidates(dispatches_table, min_affinity, top_count):
+  def candidates_generator():
+    for source, counters_from_source in iteritems(dispatches_table):
+      total = float(sum(itervalues(counters_from_source)))
+      for destination, counter in iteritems(counters_from_source):
+        affinity = counter / total
+        if affinity >= min_affinity:
+          yield source, destination, counter, affinity
+
+  return heapq.nlargest(top_count, candidates_generator(), key=lambda x: x[2])
+
+
+def print_fusion_candidates(dispatches_table, min_affinity, top_count):
+  fusion_candidates = find_fusion_candidates(
+    dispatches_table, min_affinity, top_count)
+  print("Top {} dispatch pairs with at least {:.0f}% affinity:".format(
+    top_count, min_affinity * 100))
+  for source, destination, counter, affinity in fusion_candidates:
+    print("{:>12d}\t{:>5.1f}%\t{} -> {}".format(counter, affinity * 100,
+                                               source, destination))
+
+
 def find_top_bytecodes(dispatches_table):
   top_bytecodes = []
   for bytecode, counters_from_bytecode in iteritems(dispatches_table):
@@ -207,12 +233,27 @@ def parse_command_line():
     action="store_true",
     help="print the top bytecode dispatch pairs"
   )
+  command_line_parser.add_argument(
+    "--fusion-candidates", "-c",
+    action="store_true",
+    help=("print the top dispatch pairs whose source dispatches to the "
+          "destination most of the time, i.e. candidates for a dispatch "
+          "lookahead (see Bytecodes::IsStarLookahead) or a fused bytecode")
+  )
+  command_line_parser.add_argument(
+    "--min-affinity", "-a",
+    metavar="R",
+    type=float,
+    default=0.5,
+    help=("minimum ratio of the source dispatches going to the destination, "
+          "only applied when using -c (default 0.5)")
+  )
   command_line_parser.add_argument(
     "--top-entries-count", "-n",
     metavar="N",
     type=int,
     default=10,
-    help="print N top entries when running with -t or -f (default 10)"
+    help="print N top entries when running with -t, -c or -f (default 10)"
   )
   command_line_parser.add_argument(
     "--top-dispatches-for-bytecode", "-f",
@@ -272,6 +313,10 @@ def main():
   elif program_options.top_bytecode_dispatch_pairs:
     print_top_bytecode_dispatch_pairs(
       dispatches_table, program_options.top_entries_count)
+  elif program_options.fusion_candidates:
+    print_fusion_candidates(
+      dispatches_table, program_options.min_affinity,
+      program_options.top_entries_count)
   elif program_options.top_dispatches_for_bytecode:
     print_top_dispatch_sources_and_destinations(
       dispatches_table, program_options.top_dispatches_for_bytecode,
@@ -60,3 +60,15 @@ class BytecodeDispatchesReportTest(unittest.TestCase):
       ("a", 2, 0.2),
       ("c", 10, 0.1)
     ])
+
+  def test_find_fusion_candidates(self):
+    fusion_candidates = bdr.find_fusion_candidates({
+      "a": {"a":  1, "b": 9},
+      "b": {"a":  5, "c": 5},
+      "c": {"a": 60, "b": 20, "c": 20}}, 0.5, 10)
+    self.assertListEqual(fusion_candidates, [
+      ("c", "a", 60, 0.6),
+      ("a", "b", 9, 0.9),
+      ("b", "a", 5, 0.5),
+      ("b", "c", 5, 0.5)
+    ])